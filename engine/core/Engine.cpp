@@ -1,9 +1,12 @@
 #include "Engine.h"
 #include "Logger.h"
+#include "JobSystem.h"
 #include "../../include/Core/ModuleRegistry.h"
+#include "../../include/Core/Profiler.h"
 #include "../../include/Core/ModuleConfigLoader.h"
 #include "../../include/Core/RuntimeModuleManager.h"
 #include "../../include/Graphics/GraphicsRenderer.h"
+#include "../../include/Graphics/TextureCompression.h"
 #include "../../include/Resource/ResourceManager.h"
 #include "../../include/Physics/PhysicsEngine.h"
 #include "../../include/Physics/PhysicsDebugManager.h"
@@ -19,6 +22,7 @@
 #include "../modules/audio-openal/OpenALAudioModule.h"
 
 #include <GLFW/glfw3.h>
+#include <algorithm>
 #include <filesystem>
 
 namespace GameEngine {
@@ -86,6 +90,7 @@ namespace GameEngine {
 
             // Register physics module
             auto physicsModule = std::make_unique<Physics::BulletPhysicsModule>();
+            physicsModule->SetJobSystem(m_jobSystem.get());
             m_moduleRegistry->RegisterModule(std::move(physicsModule));
 
             // Register audio module
@@ -104,11 +109,15 @@ namespace GameEngine {
     bool Engine::InitializeRemainingSubsystems() {
         // Initialize resource manager (not yet modularized)
         m_resourceManager = std::make_unique<ResourceManager>();
+        m_resourceManager->SetJobSystem(m_jobSystem.get());
         if (!m_resourceManager->Initialize()) {
             LOG_ERROR("Failed to initialize resource manager");
             return false;
         }
 
+        // Texture compression batches run as background jobs
+        TextureCompression::GetInstance().SetJobSystem(m_jobSystem.get());
+
         // Initialize input manager (not yet modularized)
         GraphicsRenderer* renderer = GetRenderer();
         if (renderer) {
@@ -150,6 +159,12 @@ namespace GameEngine {
         Logger::GetInstance().Initialize();
         LOG_INFO("Game Engine Kiro - Initializing with module system...");
 
+        // Job system first so subsystems can share its workers
+        m_jobSystem = std::make_unique<JobSystem>();
+        m_jobSystem->Initialize();
+        m_frameGraph = std::make_unique<JobGraph>();
+        m_frameGraphDirty = true;
+
         // Try to initialize with module system first
         if (InitializeModuleSystem()) {
             if (LoadConfiguration(configPath)) {
@@ -200,7 +215,9 @@ namespace GameEngine {
             return;
         }
         
+        Profiler::GetInstance().SetThreadName("Main Thread");
         while (m_isRunning && !glfwWindowShouldClose(window)) {
+            GAMEENGINE_PROFILE_FRAME();
             auto currentTime = std::chrono::high_resolution_clock::now();
             m_deltaTime = std::chrono::duration<float>(currentTime - m_lastFrameTime).count();
             m_lastFrameTime = currentTime;
@@ -213,53 +230,30 @@ namespace GameEngine {
     }
 
     void Engine::Update(float deltaTime) {
+        GAMEENGINE_PROFILE_ZONE("Engine::Update");
+
+        // Main-thread work first: input polling and the graphics module own the window and GL context
         if (m_useModuleSystem) {
-            // Update all modules
-            m_moduleRegistry->UpdateModules(deltaTime);
-            
-            // Update non-modular subsystems
-            if (m_input) {
-                m_input->Update();
-            }
-            if (m_scripting) {
-                m_scripting->Update(deltaTime);
-            }
-            
-            // Update audio listener with main camera position, orientation, and velocity
-            if (m_mainCamera) {
-                Audio::IAudioModule* audioModule = GetAudioModule();
-                if (audioModule) {
-                    // Note: We need to cast away const to update velocity, but this is safe in the update loop
-                    Camera* mutableCamera = const_cast<Camera*>(m_mainCamera);
-                    mutableCamera->UpdateVelocity(deltaTime);
-                    
-                    audioModule->SetListenerPosition(m_mainCamera->GetPosition());
-                    audioModule->SetListenerOrientation(m_mainCamera->GetForward(), m_mainCamera->GetUp());
-                    audioModule->SetListenerVelocity(m_mainCamera->GetVelocity());
-                }
-            }
-        } else {
-            // Legacy update path
-            if (m_input) m_input->Update();
-            
-            PhysicsEngine* physics = GetPhysics();
-            if (physics) physics->Update(deltaTime);
-            
-            AudioEngine* audio = GetAudio();
-            if (audio) audio->Update(deltaTime);
-            
-            if (m_scripting) m_scripting->Update(deltaTime);
-            
-            // Update audio listener with main camera position, orientation, and velocity
-            if (m_mainCamera && audio) {
-                // Note: We need to cast away const to update velocity, but this is safe in the update loop
-                Camera* mutableCamera = const_cast<Camera*>(m_mainCamera);
-                mutableCamera->UpdateVelocity(deltaTime);
-                
-                audio->SetListenerPosition(m_mainCamera->GetPosition());
-                audio->SetListenerOrientation(m_mainCamera->GetForward(), m_mainCamera->GetUp());
-                audio->SetListenerVelocity(m_mainCamera->GetVelocity());
-            }
+            m_moduleRegistry->UpdateModules(deltaTime, [](const IEngineModule& module) {
+                return module.GetType() != ModuleType::Physics && module.GetType() != ModuleType::Audio;
+            });
+        }
+        if (m_input) {
+            m_input->Update();
+        }
+        
+        // Physics, audio and registered frame jobs (e.g. animation) run as a dependency graph
+        if (m_frameGraphDirty) {
+            RebuildFrameGraph();
+        }
+        m_frameDeltaTime = deltaTime;
+        if (m_frameGraph->IsAcyclic()) {
+            m_jobSystem->RunAndWait(*m_frameGraph);
+        }
+        
+        // Scripts see this frame's physics and audio state; the Lua state is not thread-safe
+        if (m_scripting) {
+            m_scripting->Update(deltaTime);
         }
         
         // Handle physics debug input (common for both paths)
@@ -273,7 +267,125 @@ namespace GameEngine {
         }
     }
 
+    void Engine::UpdatePhysicsStage(float deltaTime) {
+        if (m_useModuleSystem) {
+            for (IEngineModule* module : m_moduleRegistry->GetModulesByType(ModuleType::Physics)) {
+                if (module->IsInitialized() && module->IsEnabled()) {
+                    module->Update(deltaTime);
+                }
+            }
+        } else if (PhysicsEngine* physics = GetPhysics()) {
+            physics->Update(deltaTime);
+        }
+    }
+
+    void Engine::UpdateAudioStage(float deltaTime) {
+        if (m_useModuleSystem) {
+            for (IEngineModule* module : m_moduleRegistry->GetModulesByType(ModuleType::Audio)) {
+                if (module->IsInitialized() && module->IsEnabled()) {
+                    module->Update(deltaTime);
+                }
+            }
+        } else if (AudioEngine* audio = GetAudio()) {
+            audio->Update(deltaTime);
+        }
+        
+        // Update audio listener with main camera position, orientation, and velocity
+        if (!m_mainCamera) {
+            return;
+        }
+        
+        // Note: We need to cast away const to update velocity, but this is safe in the update loop
+        Camera* mutableCamera = const_cast<Camera*>(m_mainCamera);
+        if (m_useModuleSystem) {
+            Audio::IAudioModule* audioModule = GetAudioModule();
+            if (audioModule) {
+                mutableCamera->UpdateVelocity(deltaTime);
+                audioModule->SetListenerPosition(m_mainCamera->GetPosition());
+                audioModule->SetListenerOrientation(m_mainCamera->GetForward(), m_mainCamera->GetUp());
+                audioModule->SetListenerVelocity(m_mainCamera->GetVelocity());
+            }
+        } else if (AudioEngine* audio = GetAudio()) {
+            mutableCamera->UpdateVelocity(deltaTime);
+            audio->SetListenerPosition(m_mainCamera->GetPosition());
+            audio->SetListenerOrientation(m_mainCamera->GetForward(), m_mainCamera->GetUp());
+            audio->SetListenerVelocity(m_mainCamera->GetVelocity());
+        }
+    }
+
+    void Engine::RebuildFrameGraph() {
+        m_frameGraph->Clear();
+        m_frameGraph->AddJob("Physics", [this]() { UpdatePhysicsStage(m_frameDeltaTime); });
+        m_frameGraph->AddJob("Audio", [this]() { UpdateAudioStage(m_frameDeltaTime); });
+        
+        for (const auto& frameJob : m_frameJobs) {
+            auto job = frameJob.job;
+            m_frameGraph->AddJob(frameJob.name, [this, job]() { job(m_frameDeltaTime); });
+        }
+        
+        for (const auto& dependency : m_frameDependencies) {
+            JobGraph::JobId job = m_frameGraph->FindJob(dependency.first);
+            JobGraph::JobId dependsOn = m_frameGraph->FindJob(dependency.second);
+            if (job == JobGraph::INVALID_JOB || dependsOn == JobGraph::INVALID_JOB) {
+                LOG_WARNING("Frame graph: ignoring dependency '" + dependency.first + "' -> '" + dependency.second + "' (unknown job)");
+                continue;
+            }
+            m_frameGraph->AddDependency(job, dependsOn);
+        }
+        
+        if (!m_frameGraph->IsAcyclic()) {
+            LOG_ERROR("Frame graph has a dependency cycle, frame jobs will not run");
+        }
+        m_frameGraphDirty = false;
+    }
+
+    bool Engine::AddFrameJob(const std::string& name, std::function<void(float)> job,
+                             const std::vector<std::string>& dependencies) {
+        if (!job || name == "Physics" || name == "Audio") {
+            LOG_ERROR("Cannot add frame job '" + name + "'");
+            return false;
+        }
+        
+        for (const auto& frameJob : m_frameJobs) {
+            if (frameJob.name == name) {
+                LOG_ERROR("Frame job '" + name + "' already exists");
+                return false;
+            }
+        }
+        
+        m_frameJobs.push_back({name, std::move(job)});
+        for (const auto& dependency : dependencies) {
+            m_frameDependencies.emplace_back(name, dependency);
+        }
+        m_frameGraphDirty = true;
+        return true;
+    }
+
+    bool Engine::AddFrameDependency(const std::string& job, const std::string& dependsOn) {
+        if (job == dependsOn) {
+            return false;
+        }
+        
+        m_frameDependencies.emplace_back(job, dependsOn);
+        m_frameGraphDirty = true;
+        return true;
+    }
+
+    void Engine::RemoveFrameJob(const std::string& name) {
+        m_frameJobs.erase(std::remove_if(m_frameJobs.begin(), m_frameJobs.end(),
+                                         [&name](const FrameJob& frameJob) { return frameJob.name == name; }),
+                          m_frameJobs.end());
+        m_frameDependencies.erase(std::remove_if(m_frameDependencies.begin(), m_frameDependencies.end(),
+                                                 [&name](const std::pair<std::string, std::string>& dependency) {
+                                                     return dependency.first == name || dependency.second == name;
+                                                 }),
+                                  m_frameDependencies.end());
+        m_frameGraphDirty = true;
+    }
+
     void Engine::Render() {
+        GAMEENGINE_PROFILE_ZONE("Engine::Render");
+
         GraphicsRenderer* renderer = GetRenderer();
         if (!renderer) {
             return;
@@ -314,6 +426,14 @@ namespace GameEngine {
                 ShutdownLegacySubsystems();
             }
             
+            // Finishes pending compression batches; the singleton outlives the job system
+            TextureCompression::GetInstance().SetJobSystem(nullptr);
+            
+            // Last, after every subsystem that may still have jobs in flight
+            if (m_jobSystem) {
+                m_jobSystem->Shutdown();
+            }
+            
             glfwTerminate();
             m_isRunning = false;
             
@@ -4,6 +4,7 @@
 #include <chrono>
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace GameEngine {
     class GraphicsRenderer;
@@ -14,6 +15,8 @@ namespace GameEngine {
     class ScriptingEngine;
     class Camera;
     class ModuleRegistry;
+    class JobSystem;
+    class JobGraph;
     struct EngineConfig;
     
     namespace Graphics {
@@ -77,6 +80,16 @@ namespace GameEngine {
         float GetDeltaTime() const { return m_deltaTime; }
         bool IsRunning() const { return m_isRunning; }
 
+        // Job system shared by engine subsystems
+        JobSystem* GetJobSystem() const { return m_jobSystem.get(); }
+
+        // Per-frame jobs run in the frame graph next to the built-in "Physics" and "Audio"
+        // stages (e.g. "Animation"). Dependencies name other frame jobs or those stages.
+        bool AddFrameJob(const std::string& name, std::function<void(float)> job,
+                         const std::vector<std::string>& dependencies = {});
+        bool AddFrameDependency(const std::string& job, const std::string& dependsOn);
+        void RemoveFrameJob(const std::string& name);
+
         // Callback system for custom game logic
         void SetUpdateCallback(std::function<void(float)> callback) { m_updateCallback = callback; }
         void SetRenderCallback(std::function<void()> callback) { m_renderCallback = callback; }
@@ -87,6 +100,11 @@ namespace GameEngine {
     private:
         void Update(float deltaTime);
         void Render();
+
+        // Frame graph
+        void RebuildFrameGraph();
+        void UpdatePhysicsStage(float deltaTime);
+        void UpdateAudioStage(float deltaTime);
         
         // Module system initialization
         bool InitializeModuleSystem();
@@ -111,6 +129,19 @@ namespace GameEngine {
         std::unique_ptr<ScriptingEngine> m_scripting;
         std::unique_ptr<Physics::PhysicsDebugManager> m_physicsDebugManager;
 
+        // Engine-wide job system and the per-frame update graph
+        struct FrameJob {
+            std::string name;
+            std::function<void(float)> job;
+        };
+
+        std::unique_ptr<JobSystem> m_jobSystem;
+        std::unique_ptr<JobGraph> m_frameGraph;
+        std::vector<FrameJob> m_frameJobs;
+        std::vector<std::pair<std::string, std::string>> m_frameDependencies;   // (job, dependsOn)
+        bool m_frameGraphDirty = true;
+        float m_frameDeltaTime = 0.0f;
+
         bool m_isRunning;
         float m_deltaTime;
         std::chrono::high_resolution_clock::time_point m_lastFrameTime;
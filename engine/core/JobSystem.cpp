@@ -0,0 +1,570 @@
+#include "JobSystem.h"
+#include "Logger.h"
+#include "Core/Profiler.h"
+#include <algorithm>
+
+namespace GameEngine {
+
+    namespace {
+        // Identifies the job system worker running on this thread, if any
+        thread_local const JobSystem* t_jobSystem = nullptr;
+        thread_local size_t t_workerIndex = 0;
+
+        constexpr size_t MAX_INJECTED_GRAB = 16;
+
+        size_t GetLane(JobPriority priority) {
+            return static_cast<size_t>(priority);
+        }
+    }
+
+    /**
+     * A queued job: a plain function, one chunk of a ParallelFor, or one node of a running graph
+     */
+    struct JobSystem::Job {
+        std::function<void()> function;
+        JobGroup* group = nullptr;
+        JobPriority priority = JobPriority::Normal;
+
+        const std::function<void(size_t, size_t)>* range = nullptr;
+        size_t begin = 0;
+        size_t end = 0;
+
+        JobGraph* graph = nullptr;
+        JobGraph::JobId node = 0;
+    };
+
+    // JobGraph implementation
+    JobGraph::JobId JobGraph::AddJob(const std::string& name, std::function<void()> job, JobPriority priority) {
+        if (m_running) {
+            LOG_ERROR("JobGraph: cannot add '" + name + "' while the graph is running");
+            return INVALID_JOB;
+        }
+
+        Node node;
+        node.name = name;
+        node.profileName = Profiler::GetInstance().InternName(name);
+        node.job = std::move(job);
+        node.priority = priority;
+        m_nodes.push_back(std::move(node));
+        m_acyclicState = -1;
+        return m_nodes.size() - 1;
+    }
+
+    bool JobGraph::AddDependency(JobId job, JobId dependsOn) {
+        if (m_running || job >= m_nodes.size() || dependsOn >= m_nodes.size() || job == dependsOn) {
+            return false;
+        }
+
+        auto& successors = m_nodes[dependsOn].successors;
+        if (std::find(successors.begin(), successors.end(), job) != successors.end()) {
+            return true;
+        }
+
+        successors.push_back(job);
+        m_nodes[job].dependencyCount++;
+        m_acyclicState = -1;
+        return true;
+    }
+
+    void JobGraph::Clear() {
+        if (m_running) {
+            LOG_ERROR("JobGraph: cannot clear a running graph");
+            return;
+        }
+
+        m_nodes.clear();
+        m_acyclicState = -1;
+    }
+
+    JobGraph::JobId JobGraph::FindJob(const std::string& name) const {
+        for (size_t i = 0; i < m_nodes.size(); ++i) {
+            if (m_nodes[i].name == name) {
+                return i;
+            }
+        }
+        return INVALID_JOB;
+    }
+
+    bool JobGraph::IsAcyclic() const {
+        if (m_acyclicState < 0) {
+            m_acyclicState = GetTopologicalOrder().size() == m_nodes.size() ? 1 : 0;
+        }
+        return m_acyclicState == 1;
+    }
+
+    bool JobGraph::RunSequential() {
+        std::vector<JobId> order = GetTopologicalOrder();
+        if (order.size() != m_nodes.size()) {
+            LOG_ERROR("JobGraph: dependency cycle, graph not run");
+            return false;
+        }
+
+        for (JobId id : order) {
+            if (m_nodes[id].job) {
+                m_nodes[id].job();
+            }
+        }
+        return true;
+    }
+
+    std::vector<JobGraph::JobId> JobGraph::GetTopologicalOrder() const {
+        // Kahn's algorithm; a cycle leaves some jobs out of the order
+        std::vector<uint32_t> remaining(m_nodes.size());
+        std::vector<JobId> order;
+        order.reserve(m_nodes.size());
+
+        for (size_t i = 0; i < m_nodes.size(); ++i) {
+            remaining[i] = m_nodes[i].dependencyCount;
+            if (remaining[i] == 0) {
+                order.push_back(i);
+            }
+        }
+
+        for (size_t next = 0; next < order.size(); ++next) {
+            for (JobId successor : m_nodes[order[next]].successors) {
+                if (--remaining[successor] == 0) {
+                    order.push_back(successor);
+                }
+            }
+        }
+        return order;
+    }
+
+    // JobSystem implementation
+    JobSystem::JobSystem() = default;
+
+    JobSystem::~JobSystem() {
+        Shutdown();
+    }
+
+    bool JobSystem::Initialize(const JobSystemConfig& config) {
+        if (IsInitialized()) {
+            LOG_WARNING("JobSystem already initialized");
+            return true;
+        }
+
+        m_config = config;
+        if (m_config.workerCount == 0) {
+            const unsigned hardwareThreads = std::thread::hardware_concurrency();
+            m_config.workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+        }
+
+        m_shutdown = false;
+        m_workerQueues.clear();
+        for (size_t i = 0; i < m_config.workerCount; ++i) {
+            m_workerQueues.push_back(std::make_unique<WorkStealingDeque<Job*>>());
+        }
+
+        m_workers.reserve(m_config.workerCount);
+        for (size_t i = 0; i < m_config.workerCount; ++i) {
+            m_workers.emplace_back(&JobSystem::WorkerThread, this, i);
+        }
+
+        LOG_INFO("JobSystem initialized with " + std::to_string(m_workers.size()) + " workers (" +
+                 std::to_string(GetBackgroundWorkerLimit()) + " for background jobs)");
+        return true;
+    }
+
+    void JobSystem::Shutdown() {
+        if (!IsInitialized()) {
+            return;
+        }
+
+        m_shutdown = true;
+        WakeWorkers(true);
+
+        for (auto& worker : m_workers) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+
+        // Finish whatever is left on this thread so no group is left waiting
+        Job* job = nullptr;
+        size_t drained = 0;
+        for (auto& queue : m_workerQueues) {
+            while (queue->Pop(job)) {
+                ExecuteJob(job);
+                ++drained;
+            }
+        }
+        m_workers.clear();
+        while (FindJob(job, NO_WORKER, true)) {
+            ExecuteJob(job);
+            ++drained;
+        }
+        m_workerQueues.clear();
+
+        if (drained > 0) {
+            LOG_INFO("JobSystem ran " + std::to_string(drained) + " remaining jobs during shutdown");
+        }
+        LOG_INFO("JobSystem shutdown complete");
+    }
+
+    void JobSystem::Submit(std::function<void()> job, JobGroup& group, JobPriority priority) {
+        auto* queued = new Job();
+        queued->function = std::move(job);
+        queued->group = &group;
+        queued->priority = priority;
+
+        group.Add();
+        Enqueue(&queued, 1);
+    }
+
+    void JobSystem::ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& body,
+                                JobPriority priority) {
+        if (count == 0) {
+            return;
+        }
+
+        if (grainSize == 0) {
+            // A few chunks per thread leaves room for stealing to even out uneven work
+            grainSize = std::max<size_t>(1, count / ((GetWorkerCount() + 1) * 4));
+        }
+
+        // Background chunks would never be helped by this thread; run the range as frame work
+        if (priority == JobPriority::Background) {
+            priority = JobPriority::Normal;
+        }
+
+        JobGroup group;
+        const size_t chunkCount = (count + grainSize - 1) / grainSize;
+        std::vector<Job*> jobs(chunkCount);
+        for (size_t i = 0; i < chunkCount; ++i) {
+            Job* job = new Job();
+            job->group = &group;
+            job->priority = priority;
+            job->range = &body;
+            job->begin = i * grainSize;
+            job->end = std::min(count, job->begin + grainSize);
+            jobs[i] = job;
+        }
+
+        group.Add(chunkCount);
+        Enqueue(jobs.data(), chunkCount);
+        Wait(group);
+    }
+
+    bool JobSystem::Run(JobGraph& graph, JobGroup& group) {
+        const size_t nodeCount = graph.m_nodes.size();
+        if (nodeCount == 0) {
+            return true;
+        }
+
+        if (!graph.IsAcyclic()) {
+            LOG_ERROR("JobSystem: job graph has a dependency cycle");
+            return false;
+        }
+
+        bool expected = false;
+        if (!graph.m_running.compare_exchange_strong(expected, true)) {
+            LOG_ERROR("JobSystem: job graph is already running");
+            return false;
+        }
+
+        if (graph.m_pendingSize != nodeCount) {
+            graph.m_pending = std::make_unique<std::atomic<uint32_t>[]>(nodeCount);
+            graph.m_pendingSize = nodeCount;
+        }
+
+        std::vector<Job*> roots;
+        for (size_t i = 0; i < nodeCount; ++i) {
+            graph.m_pending[i].store(graph.m_nodes[i].dependencyCount, std::memory_order_relaxed);
+        }
+        for (size_t i = 0; i < nodeCount; ++i) {
+            if (graph.m_nodes[i].dependencyCount == 0) {
+                Job* job = new Job();
+                job->group = &group;
+                job->priority = graph.m_nodes[i].priority;
+                job->graph = &graph;
+                job->node = i;
+                roots.push_back(job);
+            }
+        }
+
+        graph.m_remainingJobs.store(nodeCount, std::memory_order_relaxed);
+        group.Add(nodeCount);
+        Enqueue(roots.data(), roots.size());
+        return true;
+    }
+
+    bool JobSystem::RunAndWait(JobGraph& graph) {
+        JobGroup group;
+        if (!Run(graph, group)) {
+            return false;
+        }
+        Wait(group);
+        return true;
+    }
+
+    void JobSystem::Wait(JobGroup& group) {
+        const size_t workerIndex = GetCurrentWorkerIndex();
+
+        while (!group.IsDone()) {
+            Job* job = nullptr;
+            if (FindJob(job, workerIndex, false)) {
+                ExecuteJob(job);
+            } else {
+                // Remaining jobs are running on other threads
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    // Private methods
+    void JobSystem::WorkerThread(size_t workerIndex) {
+        t_jobSystem = this;
+        t_workerIndex = workerIndex;
+        Profiler::GetInstance().SetThreadName("Job Worker " + std::to_string(workerIndex));
+
+        size_t idleRounds = 0;
+        while (!m_shutdown.load(std::memory_order_acquire)) {
+            Job* job = nullptr;
+            if (FindJob(job, workerIndex, true)) {
+                ExecuteJob(job);
+                idleRounds = 0;
+                continue;
+            }
+
+            // Spin briefly before sleeping; frame work arrives in bursts
+            if (++idleRounds < IDLE_SPIN_ROUNDS) {
+                std::this_thread::yield();
+                continue;
+            }
+            idleRounds = 0;
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepingWorkers.fetch_add(1);
+            m_wakeCondition.wait(lock, [this] {
+                return m_shutdown.load() || HasRunnableWork();
+            });
+            m_sleepingWorkers.fetch_sub(1);
+        }
+
+        t_jobSystem = nullptr;
+    }
+
+    size_t JobSystem::GetCurrentWorkerIndex() const {
+        return t_jobSystem == this ? t_workerIndex : NO_WORKER;
+    }
+
+    size_t JobSystem::GetBackgroundWorkerLimit() const {
+        if (m_config.maxBackgroundWorkers > 0) {
+            return m_config.maxBackgroundWorkers;
+        }
+        return std::max<size_t>(1, m_workers.size() / 2);
+    }
+
+    void JobSystem::Enqueue(Job* const* jobs, size_t count) {
+        if (count == 0) {
+            return;
+        }
+
+        // Without workers (not initialized or shut down) jobs run inline
+        if (m_workerQueues.empty()) {
+            for (size_t i = 0; i < count; ++i) {
+                if (jobs[i]->priority == JobPriority::Background) {
+                    m_activeBackgroundJobs.fetch_add(1);
+                } else {
+                    m_queuedJobs.fetch_add(1);
+                }
+                ExecuteJob(jobs[i]);
+            }
+            return;
+        }
+
+        const size_t workerIndex = GetCurrentWorkerIndex();
+        size_t injected = 0;
+        for (size_t i = 0; i < count; ++i) {
+            // Counted before becoming visible so a fast consumer never sees the count underflow
+            if (jobs[i]->priority == JobPriority::Background) {
+                m_queuedBackgroundJobs.fetch_add(1);
+            } else {
+                m_queuedJobs.fetch_add(1);
+            }
+
+            if (workerIndex != NO_WORKER && jobs[i]->priority != JobPriority::Background) {
+                // Owner push, no lock
+                m_workerQueues[workerIndex]->Push(jobs[i]);
+                continue;
+            }
+            ++injected;
+        }
+
+        if (injected > 0) {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            for (size_t i = 0; i < count; ++i) {
+                const bool background = jobs[i]->priority == JobPriority::Background;
+                if (workerIndex == NO_WORKER || background) {
+                    m_injectionQueues[GetLane(jobs[i]->priority)].push_back(jobs[i]);
+                    if (!background) {
+                        m_injectedFrameJobs.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        }
+
+        WakeWorkers(count > 1);
+    }
+
+    bool JobSystem::FindJob(Job*& job, size_t workerIndex, bool allowBackground) {
+        if (workerIndex != NO_WORKER && m_workerQueues[workerIndex]->Pop(job)) {
+            return true;
+        }
+
+        if (TakeInjectedJob(job, workerIndex, allowBackground)) {
+            return true;
+        }
+
+        return StealJob(job, workerIndex);
+    }
+
+    bool JobSystem::TakeInjectedJob(Job*& job, size_t workerIndex, bool allowBackground) {
+        const bool frameWork = m_injectedFrameJobs.load(std::memory_order_relaxed) > 0;
+        const bool backgroundWork = allowBackground && m_queuedBackgroundJobs.load(std::memory_order_relaxed) > 0;
+        if (!frameWork && !backgroundWork) {
+            return false;
+        }
+
+        Job* taken[MAX_INJECTED_GRAB];
+        size_t takenCount = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+
+            // Workers take a fair share of frame work into their own deque, where others can steal it
+            const size_t available = m_injectedFrameJobs.load(std::memory_order_relaxed);
+            size_t limit = 1;
+            if (workerIndex != NO_WORKER) {
+                limit = std::clamp<size_t>(available / m_workerQueues.size(), 1, MAX_INJECTED_GRAB);
+            }
+
+            for (size_t lane = LANE_COUNT; lane-- > GetLane(JobPriority::Normal) && takenCount < limit;) {
+                auto& queue = m_injectionQueues[lane];
+                while (!queue.empty() && takenCount < limit) {
+                    taken[takenCount++] = queue.front();
+                    queue.pop_front();
+                }
+            }
+            m_injectedFrameJobs.fetch_sub(takenCount, std::memory_order_relaxed);
+
+            if (takenCount == 0 && allowBackground) {
+                auto& queue = m_injectionQueues[GetLane(JobPriority::Background)];
+                if (!queue.empty() && m_activeBackgroundJobs.load() < GetBackgroundWorkerLimit()) {
+                    job = queue.front();
+                    queue.pop_front();
+                    m_activeBackgroundJobs.fetch_add(1);
+                    m_queuedBackgroundJobs.fetch_sub(1);
+                    return true;
+                }
+            }
+        }
+
+        if (takenCount == 0) {
+            return false;
+        }
+
+        // Pushed in reverse so the owner pops them in submission order
+        job = taken[0];
+        for (size_t i = takenCount; i-- > 1;) {
+            m_workerQueues[workerIndex]->Push(taken[i]);
+        }
+        if (takenCount > 1) {
+            WakeWorkers(true);
+        }
+        return true;
+    }
+
+    bool JobSystem::StealJob(Job*& job, size_t workerIndex) {
+        const size_t queueCount = m_workerQueues.size();
+
+        // Start after our own slot so thieves spread over different victims
+        const size_t start = workerIndex == NO_WORKER ? 0 : workerIndex + 1;
+        for (size_t i = 0; i < queueCount; ++i) {
+            const size_t victim = (start + i) % queueCount;
+            if (victim != workerIndex && m_workerQueues[victim]->Steal(job)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void JobSystem::ExecuteJob(Job* job) {
+        const bool background = job->priority == JobPriority::Background;
+        if (!background) {
+            m_queuedJobs.fetch_sub(1);
+        }
+
+        try {
+            if (job->graph) {
+                const auto& node = job->graph->m_nodes[job->node];
+                if (node.job) {
+                    ProfileScope zone(node.profileName, "Job");
+                    node.job();
+                }
+            } else if (job->range) {
+                (*job->range)(job->begin, job->end);
+            } else if (job->function) {
+                job->function();
+            }
+        } catch (const std::exception& e) {
+            LOG_ERROR("JobSystem: job failed: " + std::string(e.what()));
+        } catch (...) {
+            LOG_ERROR("JobSystem: job failed with unknown exception");
+        }
+
+        if (JobGraph* graph = job->graph) {
+            // Release successors whose last dependency this was
+            std::vector<Job*> ready;
+            for (JobGraph::JobId successor : graph->m_nodes[job->node].successors) {
+                if (graph->m_pending[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    Job* next = new Job();
+                    next->group = job->group;
+                    next->priority = graph->m_nodes[successor].priority;
+                    next->graph = graph;
+                    next->node = successor;
+                    ready.push_back(next);
+                }
+            }
+            Enqueue(ready.data(), ready.size());
+
+            if (graph->m_remainingJobs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                graph->m_running = false;
+            }
+        }
+
+        if (background) {
+            m_activeBackgroundJobs.fetch_sub(1);
+            if (m_queuedBackgroundJobs.load() > 0) {
+                WakeWorkers(false);
+            }
+        }
+
+        JobGroup* group = job->group;
+        delete job;
+        if (group) {
+            group->Done();
+        }
+    }
+
+    void JobSystem::WakeWorkers(bool all) {
+        if (m_sleepingWorkers.load() == 0) {
+            return;
+        }
+
+        // Taking the lock orders this wake after a worker's predicate check
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+        }
+        if (all) {
+            m_wakeCondition.notify_all();
+        } else {
+            m_wakeCondition.notify_one();
+        }
+    }
+
+    bool JobSystem::HasRunnableWork() const {
+        return m_queuedJobs.load() > 0 ||
+               (m_queuedBackgroundJobs.load() > 0 && m_activeBackgroundJobs.load() < GetBackgroundWorkerLimit());
+    }
+
+} // namespace GameEngine
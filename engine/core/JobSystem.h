@@ -0,0 +1,165 @@
+#pragma once
+
+#include "Core/WorkStealingDeque.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace GameEngine {
+
+    /**
+     * Priority lanes. Frame-critical and normal jobs share the workers' deques; background
+     * jobs (loading, compilation, streaming) run on a capped number of workers so they can
+     * never occupy every core while a frame is waiting.
+     */
+    enum class JobPriority {
+        Background = 0,
+        Normal = 1,
+        FrameCritical = 2
+    };
+
+    /**
+     * Completion counter for a group of jobs; JobSystem::Wait is the join point
+     */
+    class JobGroup {
+    public:
+        void Add(size_t count = 1) { m_pending.fetch_add(count, std::memory_order_relaxed); }
+        void Done() { m_pending.fetch_sub(1, std::memory_order_acq_rel); }
+        bool IsDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+        size_t GetPending() const { return m_pending.load(std::memory_order_acquire); }
+
+    private:
+        std::atomic<size_t> m_pending{0};
+    };
+
+    /**
+     * Reusable set of jobs with dependencies. Build once, then hand to JobSystem::Run
+     * every frame; a job starts as soon as everything it depends on has finished.
+     */
+    class JobGraph {
+    public:
+        using JobId = size_t;
+        static constexpr JobId INVALID_JOB = static_cast<JobId>(-1);
+
+        JobId AddJob(const std::string& name, std::function<void()> job, JobPriority priority = JobPriority::FrameCritical);
+        bool AddDependency(JobId job, JobId dependsOn);
+        void Clear();
+
+        JobId FindJob(const std::string& name) const;
+        const std::string& GetJobName(JobId job) const { return m_nodes[job].name; }
+        size_t GetJobCount() const { return m_nodes.size(); }
+        bool IsAcyclic() const;
+
+        // Runs every job on the calling thread in dependency order (no job system needed)
+        bool RunSequential();
+
+    private:
+        friend class JobSystem;
+
+        struct Node {
+            std::string name;
+            const char* profileName = nullptr;      // Interned for profiler zones
+            std::function<void()> job;
+            JobPriority priority = JobPriority::FrameCritical;
+            std::vector<JobId> successors;
+            uint32_t dependencyCount = 0;
+        };
+
+        std::vector<Node> m_nodes;
+        mutable int m_acyclicState = -1;                        // -1 unknown, cached until the graph changes
+
+        // Per-run state
+        std::unique_ptr<std::atomic<uint32_t>[]> m_pending;     // Remaining dependencies per job
+        size_t m_pendingSize = 0;
+        std::atomic<size_t> m_remainingJobs{0};
+        std::atomic<bool> m_running{false};
+
+        std::vector<JobId> GetTopologicalOrder() const;
+    };
+
+    struct JobSystemConfig {
+        size_t workerCount = 0;             // 0 = hardware threads - 1 (the main thread helps while waiting)
+        size_t maxBackgroundWorkers = 0;    // 0 = half the workers, at least one
+    };
+
+    /**
+     * Engine-wide job system
+     * One worker per core, each with a lock-free work-stealing deque. Jobs submitted from
+     * outside the workers enter per-lane injection queues. Waiting threads run frame work
+     * instead of blocking, but never pick up background jobs.
+     */
+    class JobSystem {
+    public:
+        JobSystem();
+        ~JobSystem();
+
+        bool Initialize(const JobSystemConfig& config = JobSystemConfig{});
+        void Shutdown();
+        bool IsInitialized() const { return !m_workers.empty(); }
+        size_t GetWorkerCount() const { return m_workers.size(); }
+        bool IsWorkerThread() const { return GetCurrentWorkerIndex() != NO_WORKER; }
+
+        // Submission
+        void Submit(std::function<void()> job, JobGroup& group, JobPriority priority = JobPriority::Normal);
+        void ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& body,
+                         JobPriority priority = JobPriority::FrameCritical);
+
+        // Starts a graph's root jobs; returns false if it has a cycle or is already running
+        bool Run(JobGraph& graph, JobGroup& group);
+        bool RunAndWait(JobGraph& graph);
+
+        // Runs frame and normal jobs on the calling thread until the group completes
+        void Wait(JobGroup& group);
+
+        size_t GetPendingJobCount() const { return m_queuedJobs.load() + m_queuedBackgroundJobs.load(); }
+
+    private:
+        struct Job;
+
+        static constexpr size_t NO_WORKER = static_cast<size_t>(-1);
+        static constexpr size_t LANE_COUNT = 3;
+        static constexpr size_t IDLE_SPIN_ROUNDS = 64;
+
+        JobSystemConfig m_config;
+        std::vector<std::thread> m_workers;
+        std::vector<std::unique_ptr<WorkStealingDeque<Job*>>> m_workerQueues;
+        std::atomic<bool> m_shutdown{false};
+
+        // Injection queues, one per priority lane
+        std::array<std::deque<Job*>, LANE_COUNT> m_injectionQueues;
+        std::mutex m_queueMutex;
+        std::atomic<size_t> m_injectedFrameJobs{0};
+
+        // Frame/normal jobs queued anywhere, background jobs queued and running
+        std::atomic<size_t> m_queuedJobs{0};
+        std::atomic<size_t> m_queuedBackgroundJobs{0};
+        std::atomic<size_t> m_activeBackgroundJobs{0};
+
+        // Idle workers sleep here
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeCondition;
+        std::atomic<size_t> m_sleepingWorkers{0};
+
+        void WorkerThread(size_t workerIndex);
+        size_t GetCurrentWorkerIndex() const;
+
+        size_t GetBackgroundWorkerLimit() const;
+
+        void Enqueue(Job* const* jobs, size_t count);
+        bool FindJob(Job*& job, size_t workerIndex, bool allowBackground);
+        bool TakeInjectedJob(Job*& job, size_t workerIndex, bool allowBackground);
+        bool StealJob(Job*& job, size_t workerIndex);
+        void ExecuteJob(Job* job);
+        void WakeWorkers(bool all);
+        bool HasRunnableWork() const;
+    };
+
+} // namespace GameEngine
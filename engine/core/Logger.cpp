@@ -1,61 +1,306 @@
 #include "Logger.h"
+#include "Core/MPSCRingBuffer.h"
 #include <iostream>
-#include <iomanip>
-#include <sstream>
-#include <chrono>
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <ctime>
+#include <thread>
 
 namespace GameEngine {
+    namespace {
+        // Records carry the raw timestamp; formatting happens on the writer thread
+        struct LogRecord {
+            LogLevel level = LogLevel::Info;
+            std::chrono::system_clock::time_point time;
+            std::string message;
+        };
+
+        // Longest batch the writer builds before writing it out
+        constexpr size_t MAX_BATCH_RECORDS = 1024;
+
+        const char* GetLogLevelString(LogLevel level) {
+            switch (level) {
+                case LogLevel::Debug:    return "DEBUG";
+                case LogLevel::Info:     return "INFO";
+                case LogLevel::Warning:  return "WARNING";
+                case LogLevel::Error:    return "ERROR";
+                case LogLevel::Critical: return "CRITICAL";
+                default:                 return "UNKNOWN";
+            }
+        }
+
+        void AppendRecord(std::string& out, LogLevel level, std::chrono::system_clock::time_point time, const std::string& message) {
+            const std::time_t seconds = std::chrono::system_clock::to_time_t(time);
+            const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()) % 1000;
+
+            std::tm localTime{};
+#ifdef _WIN32
+            localtime_s(&localTime, &seconds);
+#else
+            localtime_r(&seconds, &localTime);
+#endif
+
+            char timestamp[32];
+            const size_t length = std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%d %H:%M:%S", &localTime);
+            std::snprintf(timestamp + length, sizeof(timestamp) - length, ".%03d", static_cast<int>(ms.count()));
+
+            out += '[';
+            out += timestamp;
+            out += "] [";
+            out += GetLogLevelString(level);
+            out += "] ";
+            out += message;
+            out += '\n';
+        }
+    }
+
+    struct Logger::AsyncWriter {
+        explicit AsyncWriter(size_t capacity) : queue(capacity) {}
+
+        MPSCRingBuffer<LogRecord> queue;
+        std::thread thread;
+        std::mutex wakeMutex;
+        std::condition_variable wakeCondition;
+        std::atomic<bool> wakeRequested{false};
+        std::atomic<bool> stopRequested{false};
+    };
+
     Logger& Logger::GetInstance() {
         static Logger instance;
         return instance;
     }
 
+    Logger::Logger() = default;
+
+    Logger::~Logger() {
+        Shutdown();
+    }
+
     void Logger::Initialize(const std::string& filename) {
-        m_logFile = std::make_unique<std::ofstream>(filename, std::ios::app);
-        if (!m_logFile->is_open()) {
-            std::cerr << "Warning: Could not open log file: " << filename << std::endl;
+        {
+            std::lock_guard<std::mutex> lock(m_outputMutex);
+            m_logFile = std::make_unique<std::ofstream>(filename, std::ios::app);
+            if (!m_logFile->is_open()) {
+                std::cerr << "Warning: Could not open log file: " << filename << std::endl;
+            }
+        }
+        m_shutdown.store(false, std::memory_order_release);
+    }
+
+    void Logger::Configure(const LoggerConfig& config) {
+        // Switching to synchronous output: write what is already queued first
+        if (!config.asynchronous) {
+            Flush();
+        }
+
+        m_asynchronous.store(config.asynchronous, std::memory_order_relaxed);
+        m_overflowPolicy.store(config.overflowPolicy, std::memory_order_relaxed);
+        m_consoleOutput.store(config.consoleOutput, std::memory_order_relaxed);
+        m_flushIntervalMs.store(std::max<int64_t>(1, config.flushInterval.count()), std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(m_controlMutex);
+        if (!m_writer) {
+            m_queueCapacity = std::max<size_t>(2, config.queueCapacity);
         }
     }
 
     void Logger::Log(LogLevel level, const std::string& message) {
-        if (level < m_minLogLevel) {
+        if (!IsEnabled(level)) {
             return;
         }
 
-        std::string timestamp = GetTimestamp();
-        std::string levelStr = GetLogLevelString(level);
-        std::string logMessage = "[" + timestamp + "] [" + levelStr + "] " + message;
+        // Registered before checking m_shutdown (both seq_cst), so StopWriter either sees this call
+        // and waits for it before its final drain, or this call sees the shutdown and writes directly
+        struct ProducerScope {
+            std::atomic<size_t>& count;
+            explicit ProducerScope(std::atomic<size_t>& producers) : count(producers) { count.fetch_add(1); }
+            ~ProducerScope() { count.fetch_sub(1, std::memory_order_release); }
+        } producer(m_activeProducers);
 
-        // Output to console
-        std::cout << logMessage << std::endl;
+        if (!m_asynchronous.load(std::memory_order_relaxed) || m_shutdown.load() || !StartWriter()) {
+            WriteSynchronously(level, message);
+            return;
+        }
 
-        // Output to file if available
+        AsyncWriter& writer = *m_writer;
+        LogRecord record{level, std::chrono::system_clock::now(), message};
+
+        // TryPush only moves from the record when it succeeds
+        if (!writer.queue.TryPush(std::move(record))) {
+            if (m_overflowPolicy.load(std::memory_order_relaxed) == LogOverflowPolicy::Drop) {
+                m_droppedMessages.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            do {
+                WakeWriter();
+                std::this_thread::yield();
+                if (!m_writerRunning.load(std::memory_order_acquire)) {
+                    WriteSynchronously(level, message);
+                    return;
+                }
+            } while (!writer.queue.TryPush(std::move(record)));
+        }
+
+        if (level >= LogLevel::Error || writer.queue.Size() > writer.queue.GetCapacity() / 2) {
+            WakeWriter();
+        }
+        if (level == LogLevel::Critical) {
+            Flush();
+        }
+    }
+
+    void Logger::Flush() {
+        if (m_writerRunning.load(std::memory_order_acquire)) {
+            AsyncWriter& writer = *m_writer;
+            const size_t target = writer.queue.GetWriteCount();
+            while (writer.queue.GetReadCount() < target && m_writerRunning.load(std::memory_order_acquire)) {
+                WakeWriter();
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_outputMutex);
+        std::cout.flush();
         if (m_logFile && m_logFile->is_open()) {
-            *m_logFile << logMessage << std::endl;
             m_logFile->flush();
         }
     }
 
-    std::string Logger::GetLogLevelString(LogLevel level) {
-        switch (level) {
-            case LogLevel::Debug:    return "DEBUG";
-            case LogLevel::Info:     return "INFO";
-            case LogLevel::Warning:  return "WARNING";
-            case LogLevel::Error:    return "ERROR";
-            case LogLevel::Critical: return "CRITICAL";
-            default:                 return "UNKNOWN";
+    void Logger::Shutdown() {
+        m_shutdown.store(true);
+        std::lock_guard<std::mutex> lock(m_controlMutex);
+        StopWriter();
+    }
+
+    bool Logger::StartWriter() {
+        if (m_writerRunning.load(std::memory_order_acquire)) {
+            return true;
+        }
+
+        std::lock_guard<std::mutex> lock(m_controlMutex);
+        if (m_shutdown.load(std::memory_order_acquire)) {
+            return false;
+        }
+        if (m_writerRunning.load(std::memory_order_relaxed)) {
+            return true;
+        }
+
+        if (!m_writer) {
+            m_writer = std::make_unique<AsyncWriter>(m_queueCapacity);
+        }
+        m_writer->stopRequested.store(false, std::memory_order_relaxed);
+        m_writer->thread = std::thread(&Logger::WriterThread, this);
+        m_writerRunning.store(true, std::memory_order_release);
+        return true;
+    }
+
+    void Logger::StopWriter() {
+        if (!m_writerRunning.load(std::memory_order_acquire)) {
+            return;
+        }
+
+        m_writer->stopRequested.store(true, std::memory_order_release);
+        WakeWriter();
+        if (m_writer->thread.joinable()) {
+            m_writer->thread.join();
+        }
+        m_writerRunning.store(false, std::memory_order_release);
+
+        // m_shutdown is set, so new Log calls write directly; wait out the ones that may still push
+        while (m_activeProducers.load() != 0) {
+            std::this_thread::yield();
+        }
+
+        // Records pushed while the writer was exiting; this thread is the only consumer now
+        std::string remaining;
+        LogRecord record;
+        while (m_writer->queue.TryPop(record)) {
+            AppendRecord(remaining, record.level, record.time, record.message);
+        }
+        m_writer->queue.PublishReadPosition();
+        if (!remaining.empty()) {
+            WriteOutput(remaining);
         }
     }
 
-    std::string Logger::GetTimestamp() {
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-            now.time_since_epoch()) % 1000;
+    void Logger::WakeWriter() {
+        AsyncWriter& writer = *m_writer;
+        if (writer.wakeRequested.exchange(true, std::memory_order_acq_rel)) {
+            return;     // Already pending
+        }
+        {
+            std::lock_guard<std::mutex> lock(writer.wakeMutex);
+        }
+        writer.wakeCondition.notify_one();
+    }
 
-        std::stringstream ss;
-        ss << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S");
-        ss << '.' << std::setfill('0') << std::setw(3) << ms.count();
-        return ss.str();
+    void Logger::WriterThread() {
+        AsyncWriter& writer = *m_writer;
+        std::string batch;
+        batch.reserve(64 * 1024);
+        LogRecord record;
+        size_t reportedDrops = m_droppedMessages.load(std::memory_order_relaxed);
+
+        for (;;) {
+            size_t count = 0;
+            while (count < MAX_BATCH_RECORDS && writer.queue.TryPop(record)) {
+                AppendRecord(batch, record.level, record.time, record.message);
+                ++count;
+            }
+
+            const size_t drops = m_droppedMessages.load(std::memory_order_relaxed);
+            if (drops != reportedDrops) {
+                AppendRecord(batch, LogLevel::Warning, std::chrono::system_clock::now(),
+                             "Logger queue full, dropped " + std::to_string(drops - reportedDrops) + " message(s)");
+                reportedDrops = drops;
+            }
+
+            if (!batch.empty()) {
+                WriteOutput(batch);
+                batch.clear();
+            }
+            writer.queue.PublishReadPosition();
+
+            if (count == MAX_BATCH_RECORDS) {
+                continue;
+            }
+            if (writer.stopRequested.load(std::memory_order_acquire)) {
+                if (count == 0) {
+                    break;
+                }
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(writer.wakeMutex);
+            writer.wakeCondition.wait_for(lock, std::chrono::milliseconds(m_flushIntervalMs.load(std::memory_order_relaxed)), [&writer]() {
+                return writer.wakeRequested.load(std::memory_order_acquire) || writer.stopRequested.load(std::memory_order_acquire);
+            });
+            writer.wakeRequested.store(false, std::memory_order_release);
+        }
+    }
+
+    void Logger::WriteSynchronously(LogLevel level, const std::string& message) {
+        std::string line;
+        line.reserve(message.size() + 40);
+        AppendRecord(line, level, std::chrono::system_clock::now(), message);
+        WriteOutput(line);
+    }
+
+    void Logger::WriteOutput(const std::string& text) {
+        std::lock_guard<std::mutex> lock(m_outputMutex);
+
+        // Output to console
+        if (m_consoleOutput.load(std::memory_order_relaxed)) {
+            std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+            std::cout.flush();
+        }
+
+        // Output to file if available
+        if (m_logFile && m_logFile->is_open()) {
+            m_logFile->write(text.data(), static_cast<std::streamsize>(text.size()));
+            m_logFile->flush();
+        }
     }
-}
\ No newline at end of file
+}
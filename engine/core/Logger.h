@@ -3,6 +3,16 @@
 #include <string>
 #include <fstream>
 #include <memory>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <cstdint>
+
+// Lowest level compiled in: 0 Debug, 1 Info, 2 Warning, 3 Error, 4 Critical.
+// Log macros below it compile to nothing (set through the GAMEENGINE_MIN_LOG_LEVEL CMake cache variable).
+#ifndef GAMEENGINE_MIN_LOG_LEVEL
+#define GAMEENGINE_MIN_LOG_LEVEL 0
+#endif
 
 namespace GameEngine {
     enum class LogLevel {
@@ -13,13 +23,42 @@ namespace GameEngine {
         Critical
     };
 
+    // What a producer does when the async queue is full
+    enum class LogOverflowPolicy {
+        Drop,       // Discard the message and count it; the writer reports the count
+        Block       // Wait for the writer to make room
+    };
+
+    struct LoggerConfig {
+        bool asynchronous = true;                               // Background writer thread; false writes on the calling thread
+        size_t queueCapacity = 8192;                            // Records, rounded up to a power of two
+        LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Drop;
+        bool consoleOutput = true;
+        std::chrono::milliseconds flushInterval{5};             // Longest a record waits before being written
+    };
+
+    /**
+     * Engine logger
+     * Thread-safe. By default Log only timestamps the message and pushes it onto a lock-free
+     * ring buffer; a background thread formats and writes records in batches. Error and
+     * Critical messages wake the writer immediately, and Critical waits until it is written.
+     */
     class Logger {
     public:
         static Logger& GetInstance();
+        ~Logger();
         
         void Initialize(const std::string& filename = "engine.log");
+        void Configure(const LoggerConfig& config);
         void Log(LogLevel level, const std::string& message);
-        void SetLogLevel(LogLevel level) { m_minLogLevel = level; }
+        void SetLogLevel(LogLevel level) { m_minLogLevel.store(level, std::memory_order_relaxed); }
+        bool IsEnabled(LogLevel level) const { return level >= m_minLogLevel.load(std::memory_order_relaxed); }
+
+        // Blocks until everything logged before the call has been written
+        void Flush();
+        // Stops the writer thread after writing what is queued; later messages are written synchronously
+        void Shutdown();
+        size_t GetDroppedMessageCount() const { return m_droppedMessages.load(std::memory_order_relaxed); }
 
         // Convenience methods
         void Debug(const std::string& message) { Log(LogLevel::Debug, message); }
@@ -29,18 +68,69 @@ namespace GameEngine {
         void Critical(const std::string& message) { Log(LogLevel::Critical, message); }
 
     private:
-        Logger() = default;
-        std::string GetLogLevelString(LogLevel level);
-        std::string GetTimestamp();
+        struct AsyncWriter;
+
+        Logger();
+
+        bool StartWriter();
+        void StopWriter();
+        void WakeWriter();
+        void WriterThread();
+        void WriteSynchronously(LogLevel level, const std::string& message);
+        void WriteOutput(const std::string& text);
 
         std::unique_ptr<std::ofstream> m_logFile;
-        LogLevel m_minLogLevel = LogLevel::Info;
+        std::atomic<LogLevel> m_minLogLevel{LogLevel::Info};
+
+        // Configuration (queue capacity only applies before the writer first starts)
+        std::atomic<bool> m_asynchronous{true};
+        std::atomic<LogOverflowPolicy> m_overflowPolicy{LogOverflowPolicy::Drop};
+        std::atomic<bool> m_consoleOutput{true};
+        std::atomic<int64_t> m_flushIntervalMs{5};
+        size_t m_queueCapacity = 8192;
+
+        // Writer thread; created once and kept for the logger's lifetime so producers never race its destruction
+        std::unique_ptr<AsyncWriter> m_writer;
+        std::atomic<bool> m_writerRunning{false};
+        std::atomic<bool> m_shutdown{false};
+        std::atomic<size_t> m_activeProducers{0};   // Log calls in flight; the final drain waits for them
+        std::atomic<size_t> m_droppedMessages{0};
+        std::mutex m_controlMutex;      // Writer start/stop
+        std::mutex m_outputMutex;       // Console and file streams
     };
 
-    // Convenience macros
-    #define LOG_DEBUG(msg) GameEngine::Logger::GetInstance().Debug(msg)
-    #define LOG_INFO(msg) GameEngine::Logger::GetInstance().Info(msg)
-    #define LOG_WARNING(msg) GameEngine::Logger::GetInstance().Warning(msg)
-    #define LOG_ERROR(msg) GameEngine::Logger::GetInstance().Error(msg)
-    #define LOG_CRITICAL(msg) GameEngine::Logger::GetInstance().Critical(msg)
-}
\ No newline at end of file
+    // Convenience macros; the message is only built when the level is enabled
+    #define GAMEENGINE_LOG(level, msg) \
+        do { \
+            if (GameEngine::Logger::GetInstance().IsEnabled(level)) { \
+                GameEngine::Logger::GetInstance().Log(level, msg); \
+            } \
+        } while (0)
+    #define GAMEENGINE_LOG_DISABLED(msg) do { (void)sizeof(msg); } while (0)
+
+    #if GAMEENGINE_MIN_LOG_LEVEL <= 0
+    #define LOG_DEBUG(msg) GAMEENGINE_LOG(GameEngine::LogLevel::Debug, msg)
+    #else
+    #define LOG_DEBUG(msg) GAMEENGINE_LOG_DISABLED(msg)
+    #endif
+
+    #if GAMEENGINE_MIN_LOG_LEVEL <= 1
+    #define LOG_INFO(msg) GAMEENGINE_LOG(GameEngine::LogLevel::Info, msg)
+    #else
+    #define LOG_INFO(msg) GAMEENGINE_LOG_DISABLED(msg)
+    #endif
+
+    #if GAMEENGINE_MIN_LOG_LEVEL <= 2
+    #define LOG_WARNING(msg) GAMEENGINE_LOG(GameEngine::LogLevel::Warning, msg)
+    #else
+    #define LOG_WARNING(msg) GAMEENGINE_LOG_DISABLED(msg)
+    #endif
+
+    #if GAMEENGINE_MIN_LOG_LEVEL <= 3
+    #define LOG_ERROR(msg) GAMEENGINE_LOG(GameEngine::LogLevel::Error, msg)
+    #else
+    #define LOG_ERROR(msg) GAMEENGINE_LOG_DISABLED(msg)
+    #endif
+
+    #define LOG_CRITICAL(msg) GAMEENGINE_LOG(GameEngine::LogLevel::Critical, msg)
+}
@@ -88,6 +88,11 @@ namespace GameEngine {
                 m_physicsSettings.configuration.angularDamping = std::stof(it->second);
             }
 
+            it = config.parameters.find("multithreadedSimulation");
+            if (it != config.parameters.end()) {
+                m_physicsSettings.configuration.multithreadedSimulation = (it->second == "true");
+            }
+
             // Initialize the physics engine
             if (!InitializePhysicsEngine()) {
                 LOG_ERROR("Failed to initialize Bullet Physics engine");
@@ -230,6 +235,8 @@ namespace GameEngine {
                     return false;
                 }
 
+                // The default world is built in Initialize and takes its workers from here
+                m_physicsEngine->SetJobSystem(m_jobSystem);
                 if (!m_physicsEngine->Initialize(m_physicsSettings.configuration)) {
                     LOG_ERROR("Failed to initialize Bullet Physics engine");
                     m_physicsEngine.reset();
@@ -32,6 +32,9 @@ namespace GameEngine {
             void SetPhysicsSettings(const PhysicsSettings& settings) override;
             PhysicsSettings GetPhysicsSettings() const override;
             
+            // Workers for the multithreaded world and batched queries; set before Initialize
+            void SetJobSystem(JobSystem* jobSystem) { m_jobSystem = jobSystem; }
+
             // World management
             std::shared_ptr<PhysicsWorld> CreateWorld(const PhysicsConfiguration& config) override;
             void SetActiveWorld(std::shared_ptr<PhysicsWorld> world) override;
@@ -48,6 +51,7 @@ namespace GameEngine {
             void ApplyConfiguration();
             
             std::unique_ptr<PhysicsEngine> m_physicsEngine;
+            JobSystem* m_jobSystem = nullptr;
             PhysicsSettings m_physicsSettings;
             bool m_initialized = false;
             bool m_enabled = true;
@@ -94,6 +94,7 @@ public:
     }
 
     m_modelLoader = std::make_unique<ModelLoader>();
+    m_modelLoader->SetJobSystem(m_engine.GetJobSystem());
     if (!m_modelLoader->Initialize()) {
       LOG_ERROR("Failed to initialize model loader");
       return false;
@@ -102,6 +103,7 @@ public:
     CreateGroundPlane();
 
     m_character = std::make_unique<GameExample::XBotCharacter>();
+    m_character->SetJobSystem(m_engine.GetJobSystem());
     if (!m_character->Initialize(m_engine.GetPhysics())) {
       LOG_ERROR("Failed to initialize character");
       return false;
@@ -47,6 +47,7 @@ public:
 
         // Initialize model loader
         m_modelLoader = std::make_shared<ModelLoader>();
+        m_modelLoader->SetJobSystem(m_engine->GetJobSystem());
         if (!m_modelLoader->Initialize()) {
             Logger::GetInstance().Error("Failed to initialize ModelLoader");
             return false;
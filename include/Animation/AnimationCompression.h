@@ -10,6 +10,10 @@
 namespace GameEngine {
 namespace Animation {
 
+    // Forward declarations
+    class PoseLayout;
+    class QuantizedAnimation;
+
     /**
      * Compression settings for animation optimization
      */
@@ -28,6 +32,9 @@ namespace Animation {
         int rotationBits = 16;                 // Bits per rotation component
         int scaleBits = 16;                    // Bits per scale component
         int timeBits = 16;                     // Bits for time values
+
+        // Resampling rate for quantized clips (0 = use the clip frame rate)
+        float sampleRate = 0.0f;
     };
 
     /**
@@ -81,6 +88,11 @@ namespace Animation {
         std::shared_ptr<SkeletalAnimation> CompressAnimation(const SkeletalAnimation& original, 
                                                    const CompressionSettings& settings = CompressionSettings{});
         
+        // Bit-packed storage compression (see QuantizedAnimation)
+        std::shared_ptr<QuantizedAnimation> QuantizeAnimation(const SkeletalAnimation& original,
+                                                              const std::shared_ptr<const PoseLayout>& layout,
+                                                              const CompressionSettings& settings = CompressionSettings{});
+
         // Individual track compression
         template<typename T>
         std::unique_ptr<AnimationTrack<T>> CompressTrack(const AnimationTrack<T>& original,
@@ -3,6 +3,8 @@
 #include "Animation/AnimationSkeleton.h"
 #include "Animation/SkeletalAnimation.h"
 #include "Animation/Pose.h"
+#include "Animation/IndexedPose.h"
+#include "Animation/BakedAnimation.h"
 #include "Animation/BlendTree.h"
 #include "Animation/AnimationEvent.h"
 #include "Core/Math.h"
@@ -107,6 +109,12 @@ namespace Animation {
         std::shared_ptr<SkeletalAnimation> GetAnimation(const std::string& name) const;
         std::vector<std::string> GetAnimationNames() const;
 
+        // Baked playback: layers of a baked animation sample the fixed-rate frames instead of the
+        // keyframe tracks. A baked clip can be shared by every controller using the same skeleton.
+        std::shared_ptr<const BakedAnimation> BakeAnimation(const std::string& name, float sampleRate = 0.0f);
+        bool SetBakedAnimation(const std::string& name, std::shared_ptr<const BakedAnimation> baked); // nullptr restores track sampling
+        bool HasBakedAnimation(const std::string& name) const;
+
         // Update and evaluation
         void Update(float deltaTime);
         void Evaluate(std::vector<Math::Mat4>& boneMatrices);
@@ -189,10 +197,24 @@ namespace Animation {
         std::vector<Math::Mat4> m_cachedBoneMatrices;
         bool m_boneMatricesDirty = true;
 
+        // Dense pose path used for layer blending (batch kernels, no bone name hashing)
+        struct CachedBinding {
+            std::shared_ptr<SkeletalAnimation> animation; // Keeps the key pointer alive
+            AnimationBinding binding;
+            AnimationCursor cursor; // Keyframe search state for this controller's playback
+        };
+        std::shared_ptr<const PoseLayout> m_poseLayout;
+        std::unordered_map<const SkeletalAnimation*, CachedBinding> m_animationBindings;
+        std::unordered_map<const SkeletalAnimation*, std::shared_ptr<const BakedAnimation>> m_bakedAnimations;
+        IndexedPose m_blendedPose;
+        IndexedPose m_layerPose;
+
         // Helper methods
         void UpdateAnimationLayers(float deltaTime);
         void ProcessAnimationEvents(const AnimationLayer& layer, float previousTime, float currentTime);
         void BlendAnimationLayers(Pose& outPose);
+        void RebuildPoseLayout();
+        void EvaluateLayer(const AnimationLayer& layer, IndexedPose& outPose);
         void OptimizeAnimationLayers(); // Remove layers with zero weight or finished animations
         void ValidateParameters();
         void ResetTriggers();
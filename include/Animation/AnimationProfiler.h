@@ -211,6 +211,12 @@ namespace GameEngine {
             void SetMonitoringCallback(std::function<void(const AnimationPerformanceStats&)> callback);
 
         private:
+            // Timer for an operation plus its engine profiler name, interned on first use
+            struct ActiveOperation {
+                AnimationTimer timer;
+                const char* profileName = nullptr;
+            };
+
             bool m_isProfilingActive = false;
             bool m_isPaused = false;
             bool m_memoryTrackingEnabled = true;
@@ -220,7 +226,7 @@ namespace GameEngine {
             // Performance data
             AnimationPerformanceStats m_performanceStats;
             std::unordered_map<std::string, AnimationTimingData> m_operationTimings;
-            std::unordered_map<std::string, AnimationTimer> m_activeTimers;
+            std::unordered_map<std::string, ActiveOperation> m_activeTimers;
 
             // Frame timing
             AnimationTimer m_frameTimer;
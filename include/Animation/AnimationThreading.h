@@ -3,6 +3,10 @@
 #include "Animation/AnimationController.h"
 #include "Animation/AnimationLOD.h"
 #include "Core/Math.h"
+#include "Core/JobSystem.h"
+#include "Core/WorkStealingDeque.h"
+#include <array>
+#include <deque>
 #include <vector>
 #include <memory>
 #include <thread>
@@ -10,7 +14,6 @@
 #include <condition_variable>
 #include <atomic>
 #include <future>
-#include <queue>
 #include <functional>
 #include <chrono>
 
@@ -66,6 +69,15 @@ namespace Animation {
         }
     };
 
+    /**
+     * Completion counter for a group of pool tasks
+     * Lighter than a future per task: submission adds to it, each finished task decrements
+     * it, and AnimationThreadPool::Wait runs queued work on the waiting thread until it
+     * reaches zero. Must outlive the tasks counted against it. It is the job system's
+     * JobGroup, so a pool running on the engine job system can wait on it there.
+     */
+    using AnimationTaskCounter = JobGroup;
+
     /**
      * Animation batch processing data
      */
@@ -81,25 +93,47 @@ namespace Animation {
     };
 
     /**
-     * Thread-safe animation thread pool for parallel animation processing
+     * Work-stealing animation thread pool
+     * Each worker owns a lock-free Chase-Lev deque: it pushes and pops its own tasks without
+     * locks and idle workers steal from the other end. Tasks submitted from outside the pool
+     * enter through a per-priority injection queue, taken by workers a chunk at a time, so
+     * a whole range or batch costs one lock. Prefer the counter-based Submit/SubmitRange/Wait
+     * path; the future-returning calls are kept for existing callers.
+     *
+     * Given the engine job system before Initialize, the pool starts no threads of its own:
+     * every task becomes a job (High/Critical as frame-critical, Low/Normal as normal) and
+     * waits help on the job system. Pausing does not apply there.
      */
     class AnimationThreadPool {
     public:
         // Lifecycle
         AnimationThreadPool();
         ~AnimationThreadPool();
+        void SetJobSystem(JobSystem* jobSystem);
         bool Initialize(const AnimationThreadConfig& config = AnimationThreadConfig{});
         void Shutdown();
 
         // Task submission
         std::future<void> SubmitTask(AnimationTask task);
         std::future<void> SubmitTask(std::function<void()> task, AnimationTaskPriority priority = AnimationTaskPriority::Normal);
+
+        // Counter-based submission (no per-task future). Submissions from a pool thread go
+        // straight to that worker's deque.
+        void Submit(std::function<void()> task, AnimationTaskCounter& counter,
+                    AnimationTaskPriority priority = AnimationTaskPriority::Normal);
+        // Splits [0, count) into chunks of grainSize (0 = pick from thread count) and queues
+        // body(begin, end) for each; anything body references must outlive the counter
+        void SubmitRange(size_t count, size_t grainSize, std::function<void(size_t, size_t)> body,
+                         AnimationTaskCounter& counter,
+                         AnimationTaskPriority priority = AnimationTaskPriority::Normal);
+        void ParallelFor(size_t count, size_t grainSize, std::function<void(size_t, size_t)> body);
         
         // Batch processing
         std::future<void> SubmitBatch(const AnimationBatch& batch);
         void SubmitBatches(const std::vector<AnimationBatch>& batches);
 
-        // Synchronization
+        // Synchronization (waiting threads run queued tasks instead of blocking)
+        void Wait(AnimationTaskCounter& counter);
         void WaitForAll();
         void WaitForCompletion();
         bool IsIdle() const;
@@ -107,7 +141,7 @@ namespace Animation {
         // Configuration
         void SetMaxThreads(size_t maxThreads);
         void SetQueueSize(size_t maxQueueSize);
-        size_t GetThreadCount() const { return m_threads.size(); }
+        size_t GetThreadCount() const;
         size_t GetQueueSize() const;
 
         // Statistics
@@ -130,40 +164,66 @@ namespace Animation {
         bool IsPaused() const { return m_paused; }
 
     private:
+        struct QueuedTask;
+        struct RangeJob;
+
+        static constexpr size_t NO_WORKER = static_cast<size_t>(-1);
+        static constexpr size_t PRIORITY_LEVELS = 4;
+        static constexpr size_t MAX_INJECTED_GRAB = 16;
+        static constexpr size_t IDLE_SPIN_ROUNDS = 64;
+
         // Configuration
         AnimationThreadConfig m_config;
         
+        // Engine job system the tasks run on instead of m_threads, if set
+        JobSystem* m_jobSystem = nullptr;
+        JobGroup m_jobs;
+        
         // Thread management
         std::vector<std::thread> m_threads;
         std::atomic<bool> m_shutdown{false};
         std::atomic<bool> m_paused{false};
         
-        // Task queue
-        std::priority_queue<AnimationTask> m_taskQueue;
+        // Per-worker lock-free deques
+        std::vector<std::unique_ptr<WorkStealingDeque<QueuedTask*>>> m_workerQueues;
+
+        // Injection queues for tasks submitted from outside the pool, one per priority
+        std::array<std::deque<QueuedTask*>, PRIORITY_LEVELS> m_injectionQueues;
         std::mutex m_queueMutex;
-        std::condition_variable m_queueCondition;
-        std::condition_variable m_completionCondition;
+        std::atomic<size_t> m_injectedCount{0};
+
+        // Task accounting (queued anywhere / currently executing)
+        std::atomic<size_t> m_queuedTasks{0};
+        std::atomic<size_t> m_activeTasks{0};
+
+        // Idle workers sleep here
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wakeCondition;
+        std::atomic<size_t> m_sleepingWorkers{0};
         
         // Statistics
+        std::atomic<size_t> m_tasksProcessed{0};
+        std::atomic<size_t> m_tasksQueuedTotal{0};
+        std::atomic<uint64_t> m_taskTimeNs{0};
+        std::atomic<uint64_t> m_queueTimeNs{0};
         mutable std::mutex m_statsMutex;
-        ThreadPoolStats m_stats;
         std::chrono::steady_clock::time_point m_lastStatsUpdate;
         
-        // Work stealing queues (one per thread)
-        std::vector<std::queue<AnimationTask>> m_workStealingQueues;
-        std::vector<std::unique_ptr<std::mutex>> m_workStealingMutexes;
-        
         // Thread worker function
         void WorkerThread(size_t threadId);
+        size_t GetCurrentWorkerIndex() const;
         
         // Task processing
-        bool GetNextTask(AnimationTask& task, size_t threadId);
+        void Enqueue(QueuedTask* const* tasks, size_t count);
+        bool FindTask(QueuedTask*& task, size_t threadId);
+        bool TakeInjectedTask(QueuedTask*& task, size_t threadId);
+        void ExecuteTask(QueuedTask* task);
         void ProcessTask(const AnimationTask& task);
-        void UpdateStats(const AnimationTask& task, float processingTime);
+        void FinishTask(QueuedTask* task);
+        void WakeWorkers(size_t count);
         
         // Work stealing
-        bool StealWork(AnimationTask& task, size_t threadId);
-        void DistributeWork();
+        bool StealWork(QueuedTask*& task, size_t threadId);
     };
 
     /**
@@ -176,6 +236,9 @@ namespace Animation {
         ~MultiThreadedAnimationManager();
         bool Initialize(const AnimationThreadConfig& config = AnimationThreadConfig{});
         void Shutdown();
+        
+        // Runs the updates on the engine job system; set before Initialize
+        void SetJobSystem(JobSystem* jobSystem) { m_jobSystem = jobSystem; }
 
         // Animation instance management
         uint32_t RegisterAnimationController(std::shared_ptr<AnimationController> controller,
@@ -217,6 +280,7 @@ namespace Animation {
 
     private:
         // Core systems
+        JobSystem* m_jobSystem = nullptr;
         std::unique_ptr<AnimationThreadPool> m_threadPool;
         std::shared_ptr<AnimationLODSystem> m_lodSystem;
         
@@ -232,6 +296,10 @@ namespace Animation {
         std::unordered_map<uint32_t, AnimationInstance> m_instances;
         std::mutex m_instancesMutex;
         uint32_t m_nextInstanceId = 1;
+
+        // In-flight UpdateAnimationsBatched work (controllers are read by the pool tasks)
+        std::vector<std::shared_ptr<AnimationController>> m_batchedControllers;
+        AnimationTaskCounter m_batchedUpdates;
         
         // Configuration
         bool m_threadingEnabled = true;
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Animation/IndexedPose.h"
+#include "Animation/SkeletalAnimation.h"
+#include "Core/Math.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GameEngine {
+namespace Animation {
+
+    /**
+     * SkeletalAnimation resampled offline at a fixed rate for a PoseLayout
+     * All frames live in one contiguous buffer. Each frame stores the translations, rotations
+     * and scales of every layout bone back to back, so sampling loads the two frames around
+     * the requested time and blends them with the pose kernels. There is no keyframe search and
+     * no per-key interpolation switch. Bones the clip does not animate are baked at their bind
+     * pose. Curves between samples are reconstructed linearly, so bake fast motion at a higher rate.
+     */
+    class BakedAnimation {
+    public:
+        /**
+         * Bake a clip against a layout; sampleRate <= 0 uses the clip's frame rate
+         */
+        static std::shared_ptr<BakedAnimation> Bake(const SkeletalAnimation& animation,
+                                                    const std::shared_ptr<const PoseLayout>& layout,
+                                                    float sampleRate = 0.0f);
+
+        // Sampling (time is clip-local and clamped to [0, duration]; wrap with SkeletalAnimation::WrapTime)
+        void Sample(float time, IndexedPose& outPose) const;
+
+        // Compatibility: same bone names in the same order as the layout used for baking
+        bool IsCompatibleWith(const PoseLayout& layout) const;
+
+        // Properties
+        const std::string& GetName() const { return m_name; }
+        float GetDuration() const { return m_duration; }
+        float GetSampleRate() const { return m_sampleRate; }
+        size_t GetFrameCount() const { return m_frameCount; }
+        size_t GetBoneCount() const { return m_boneNames.size(); }
+        size_t GetMemoryUsage() const;
+
+    private:
+        std::string m_name;
+        float m_duration = 0.0f;
+        float m_sampleRate = 30.0f;
+        size_t m_frameCount = 0;
+        std::vector<std::string> m_boneNames;
+
+        // Per frame: boneCount Vec3 translations, boneCount Quat rotations, boneCount Vec3 scales
+        std::vector<float> m_frameData;
+        size_t m_frameStride = 0; // Floats per frame
+
+        const Math::Vec3* GetTranslations(size_t frame) const;
+        const Math::Quat* GetRotations(size_t frame) const;
+        const Math::Vec3* GetScales(size_t frame) const;
+    };
+
+} // namespace Animation
+} // namespace GameEngine
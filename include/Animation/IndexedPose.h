@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Animation/Pose.h"
+#include "Animation/AnimationSkeleton.h"
+#include "Animation/SkeletalAnimation.h"
+#include "Core/Math.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace GameEngine {
+namespace Animation {
+
+    /**
+     * Flattened, index-addressed description of an AnimationSkeleton
+     * Bone indices follow AnimationSkeleton::GetAllBones() order. The evaluation order lists
+     * every bone after its parent so hierarchy walks become a single linear pass.
+     * A layout is an immutable snapshot: rebuild it after editing the skeleton hierarchy.
+     */
+    class PoseLayout {
+    public:
+        static std::shared_ptr<const PoseLayout> Create(const AnimationSkeleton& skeleton);
+
+        size_t GetBoneCount() const { return m_boneNames.size(); }
+
+        // Bone lookup (returns -1 when the bone is not part of the layout)
+        int32_t GetBoneIndex(const std::string& boneName) const;
+        int32_t GetBoneIndexById(int32_t boneId) const;
+        const std::string& GetBoneName(size_t index) const { return m_boneNames[index]; }
+        int32_t GetBoneId(size_t index) const { return m_boneIds[index]; }
+
+        // Hierarchy (parent index is -1 for root bones)
+        const std::vector<int32_t>& GetParentIndices() const { return m_parentIndices; }
+        const std::vector<int32_t>& GetEvaluationOrder() const { return m_evaluationOrder; }
+
+        // Bind pose in SoA form
+        const std::vector<Math::Vec3>& GetBindTranslations() const { return m_bindTranslations; }
+        const std::vector<Math::Quat>& GetBindRotations() const { return m_bindRotations; }
+        const std::vector<Math::Vec3>& GetBindScales() const { return m_bindScales; }
+        const std::vector<Math::Mat4>& GetInverseBindPoses() const { return m_inverseBindPoses; }
+
+    private:
+        std::vector<std::string> m_boneNames;
+        std::vector<int32_t> m_boneIds;
+        std::vector<int32_t> m_parentIndices;
+        std::vector<int32_t> m_evaluationOrder;
+
+        std::vector<Math::Vec3> m_bindTranslations;
+        std::vector<Math::Quat> m_bindRotations;
+        std::vector<Math::Vec3> m_bindScales;
+        std::vector<Math::Mat4> m_inverseBindPoses;
+
+        std::unordered_map<std::string, int32_t> m_indicesByName;
+        std::unordered_map<int32_t, int32_t> m_indicesById;
+    };
+
+    /**
+     * Binding of a SkeletalAnimation's bone tracks to PoseLayout indices
+     * Resolve once per (clip, layout) pair so per-frame sampling never hashes bone names.
+     */
+    struct AnimationBinding {
+        struct Entry {
+            const BoneAnimation* boneAnimation = nullptr;
+            int32_t boneIndex = -1;
+        };
+
+        std::vector<Entry> entries;
+
+        static AnimationBinding Create(const SkeletalAnimation& animation, const PoseLayout& layout);
+        bool IsEmpty() const { return entries.empty(); }
+    };
+
+    /**
+     * Per-instance keyframe cursors for an AnimationBinding, parallel to its entries
+     * Kept by the controller playing the clip so the shared SkeletalAnimation is only read.
+     */
+    struct AnimationCursor {
+        std::vector<BoneAnimationCursor> bones;
+
+        void Reset() {
+            for (auto& bone : bones) {
+                bone.Reset();
+            }
+        }
+    };
+
+    /**
+     * Dense, skeleton-indexed pose stored as structure-of-arrays
+     * Translations, rotations and scales live in separate contiguous arrays sized to the
+     * layout's bone count, so blending and hierarchy evaluation walk memory linearly.
+     */
+    class IndexedPose {
+    public:
+        IndexedPose() = default;
+        explicit IndexedPose(std::shared_ptr<const PoseLayout> layout);
+
+        // Layout association
+        void SetLayout(std::shared_ptr<const PoseLayout> layout);
+        const std::shared_ptr<const PoseLayout>& GetLayout() const { return m_layout; }
+        bool HasValidLayout() const { return m_layout != nullptr; }
+        bool IsCompatibleWith(const IndexedPose& other) const;
+
+        // Bone transform access by layout index
+        void SetBoneTransform(size_t index, const BoneTransform& transform);
+        BoneTransform GetBoneTransform(size_t index) const;
+
+        // Raw SoA access
+        std::vector<Math::Vec3>& GetTranslations() { return m_translations; }
+        std::vector<Math::Quat>& GetRotations() { return m_rotations; }
+        std::vector<Math::Vec3>& GetScales() { return m_scales; }
+        const std::vector<Math::Vec3>& GetTranslations() const { return m_translations; }
+        const std::vector<Math::Quat>& GetRotations() const { return m_rotations; }
+        const std::vector<Math::Vec3>& GetScales() const { return m_scales; }
+
+        // Pose operations
+        void ResetToBindPose();
+        void ResetToIdentity();
+
+        // Pose blending (out may alias either input)
+        static void Blend(const IndexedPose& poseA, const IndexedPose& poseB, float weight, IndexedPose& outPose);
+        static void BlendAdditive(const IndexedPose& basePose, const IndexedPose& additivePose, float weight, IndexedPose& outPose);
+        void BlendWith(const IndexedPose& other, float weight);
+        void BlendAdditiveWith(const IndexedPose& additive, float weight);
+
+        // Hierarchy evaluation (parent world * local, in layout evaluation order)
+        void EvaluateLocalToWorld(std::vector<Math::Mat4>& outWorldMatrices) const;
+        void GetSkinningMatrices(std::vector<Math::Mat4>& outMatrices) const;
+
+        // Conversion from/to the name-keyed Pose
+        void FromPose(const Pose& pose);
+        void ToPose(Pose& outPose) const;
+
+        // Pose information
+        size_t GetBoneCount() const { return m_translations.size(); }
+        bool IsEmpty() const { return m_translations.empty(); }
+
+    private:
+        std::shared_ptr<const PoseLayout> m_layout;
+        std::vector<Math::Vec3> m_translations;
+        std::vector<Math::Quat> m_rotations;
+        std::vector<Math::Vec3> m_scales;
+
+        void Resize(size_t boneCount);
+    };
+
+} // namespace Animation
+} // namespace GameEngine
@@ -42,6 +42,18 @@ namespace Animation {
     using ScaleKeyframe = Keyframe<Math::Vec3>;
     using FloatKeyframe = Keyframe<float>;
 
+    /**
+     * Per-instance sampling position within a track
+     * Holds the key index found by the previous sample so forward playback resumes the search
+     * where it left off. Cursors belong to whoever is playing the clip, never to the track, so
+     * tracks stay immutable while sampled and many controllers can share a clip across threads.
+     */
+    struct KeyframeCursor {
+        size_t index = 0;
+
+        void Reset() { index = 0; }
+    };
+
     /**
      * Animation track containing keyframes for a specific property
      */
@@ -69,6 +81,7 @@ namespace Animation {
 
         // Sampling
         T SampleAt(float time) const;
+        T SampleAt(float time, KeyframeCursor& cursor) const; // Amortized O(1) for forward playback
         T SampleAtNormalized(float normalizedTime) const; // 0.0 to 1.0
 
         // Target information
@@ -88,6 +101,8 @@ namespace Animation {
 
         // Helper methods
         size_t FindKeyframeIndex(float time) const;
+        size_t FindKeyframeIndex(float time, size_t hint) const;
+        T SampleSegment(size_t index, float time) const;
         T InterpolateLinear(const Keyframe<T>& k1, const Keyframe<T>& k2, float t) const;
         T InterpolateCubic(const Keyframe<T>& k0, const Keyframe<T>& k1, 
                           const Keyframe<T>& k2, const Keyframe<T>& k3, float t) const;
@@ -12,6 +12,9 @@ namespace Animation {
 
     // Forward declarations
     class SkeletalAnimation;
+    class IndexedPose;
+    struct AnimationBinding;
+    struct AnimationCursor;
 
     /**
      * Represents a single bone's transform at a specific time
@@ -119,6 +122,10 @@ namespace Animation {
         static Pose EvaluateAnimation(const SkeletalAnimation& animation, float time);
         static Pose EvaluateAnimation(const SkeletalAnimation& animation, float time, std::shared_ptr<AnimationSkeleton> skeleton);
 
+        // Evaluate into a dense pose through a pre-resolved binding (no bone name lookups)
+        static void EvaluateAnimation(const SkeletalAnimation& animation, const AnimationBinding& binding, float time, IndexedPose& outPose);
+        static void EvaluateAnimation(const SkeletalAnimation& animation, const AnimationBinding& binding, float time, AnimationCursor& cursor, IndexedPose& outPose);
+
         // Evaluate multiple animations with blending
         struct AnimationLayer {
             const SkeletalAnimation* animation;
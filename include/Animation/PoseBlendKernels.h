@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Core/Math.h"
+#include "Core/SimdLevel.h"
+#include <cstddef>
+
+namespace GameEngine {
+namespace Animation {
+
+    using GameEngine::SimdLevel;
+
+    /**
+     * Batch kernels that blend N bones of two poses at once
+     * Every kernel has a scalar, SSE2 and AVX2 implementation. The widest level supported by
+     * the CPU is selected at startup; all levels produce bit-identical results because they
+     * perform the same IEEE operations in the same order (no FMA contraction, exact sqrt/div).
+     * Output arrays may alias either input array.
+     */
+    class PoseBlendKernels {
+    public:
+        // Runtime dispatch; detection and names come from Core/SimdLevel.h
+        static SimdLevel DetectSupportedLevel() { return DetectSupportedSimdLevel(); }
+        static SimdLevel GetActiveLevel();
+        static SimdLevel SetActiveLevel(SimdLevel level); // Clamped to what the CPU supports
+        static const char* GetLevelName(SimdLevel level) { return GetSimdLevelName(level); }
+
+        // out = a + (b - a) * t
+        static void LerpVectors(const Math::Vec3* a, const Math::Vec3* b, Math::Vec3* out, size_t count, float t);
+
+        // out = base + additive * weight
+        static void AddVectors(const Math::Vec3* base, const Math::Vec3* additive, Math::Vec3* out, size_t count, float weight);
+
+        // out = base * (1 + (additive - 1) * weight), the multiplicative blend used for scales
+        static void AddScales(const Math::Vec3* base, const Math::Vec3* additive, Math::Vec3* out, size_t count, float weight);
+
+        // Normalized quaternion lerp with hemisphere correction (shortest path)
+        static void NlerpRotations(const Math::Quat* a, const Math::Quat* b, Math::Quat* out, size_t count, float t);
+
+        // out = base * nlerp(identity, additive, weight)
+        static void AddRotations(const Math::Quat* base, const Math::Quat* additive, Math::Quat* out, size_t count, float weight);
+    };
+
+} // namespace Animation
+} // namespace GameEngine
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Animation/AnimationCompression.h"
+#include "Animation/IndexedPose.h"
+#include "Animation/SkeletalAnimation.h"
+#include "Core/Math.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace GameEngine {
+namespace Animation {
+
+    /**
+     * Error and size measurements of a quantized clip against its source
+     */
+    struct QuantizationReport {
+        std::string clipName;
+        size_t originalBytes = 0;          // SkeletalAnimation::GetMemoryUsage() of the source
+        size_t compressedBytes = 0;
+        float compressionRatio = 0.0f;     // originalBytes / compressedBytes
+        size_t constantTracks = 0;
+        size_t animatedTracks = 0;
+        float maxPositionError = 0.0f;     // Units
+        float maxRotationError = 0.0f;     // Radians
+        float maxScaleError = 0.0f;
+    };
+
+    /**
+     * Bit-packed animation clip resampled at a fixed rate for a PoseLayout
+     * Every bone channel is either a constant (stored once as floats) or an animated track.
+     * Animated translations and scales are range-quantized per track and component; rotations
+     * use smallest-three packing (2-bit index + three 15-bit components in 48 bits at the
+     * default precision). All animated tracks of one frame are packed back to back in a single
+     * bit stream, and Sample decodes only the two frames around the requested time.
+     */
+    class QuantizedAnimation {
+    public:
+        static std::shared_ptr<QuantizedAnimation> Create(const SkeletalAnimation& animation,
+                                                          const std::shared_ptr<const PoseLayout>& layout,
+                                                          const CompressionSettings& settings = CompressionSettings{});
+
+        // Sampling (time is clip-local and clamped to [0, duration]; wrap with SkeletalAnimation::WrapTime)
+        void Sample(float time, IndexedPose& outPose) const;
+
+        // Compatibility: same bone names in the same order as the layout used for compression
+        bool IsCompatibleWith(const PoseLayout& layout) const;
+
+        // Compare against the source clip at every frame and every frame midpoint
+        QuantizationReport Measure(const SkeletalAnimation& original, const std::shared_ptr<const PoseLayout>& layout) const;
+
+        // Properties
+        const std::string& GetName() const { return m_name; }
+        float GetDuration() const { return m_duration; }
+        float GetSampleRate() const { return m_sampleRate; }
+        size_t GetFrameCount() const { return m_frameCount; }
+        size_t GetBoneCount() const { return m_boneNames.size(); }
+        size_t GetConstantTrackCount() const;
+        size_t GetAnimatedTrackCount() const;
+        size_t GetMemoryUsage() const;
+
+    private:
+        struct ConstantVectorTrack {
+            uint32_t boneIndex = 0;
+            Math::Vec3 value{0.0f};
+        };
+
+        struct ConstantRotationTrack {
+            uint32_t boneIndex = 0;
+            Math::Quat value{1.0f, 0.0f, 0.0f, 0.0f};
+        };
+
+        struct AnimatedVectorTrack {
+            uint32_t boneIndex = 0;
+            uint32_t bitOffset = 0;        // Within a frame
+            Math::Vec3 minimum{0.0f};
+            Math::Vec3 extent{0.0f};       // maximum - minimum
+        };
+
+        struct AnimatedRotationTrack {
+            uint32_t boneIndex = 0;
+            uint32_t bitOffset = 0;        // Within a frame
+        };
+
+        std::string m_name;
+        float m_duration = 0.0f;
+        float m_sampleRate = 30.0f;
+        size_t m_frameCount = 0;
+        std::vector<std::string> m_boneNames;
+
+        uint8_t m_positionBits = 16;       // Per component
+        uint8_t m_rotationBits = 15;       // Per smallest-three component
+        uint8_t m_scaleBits = 16;          // Per component
+
+        std::vector<ConstantVectorTrack> m_constantPositions;
+        std::vector<ConstantRotationTrack> m_constantRotations;
+        std::vector<ConstantVectorTrack> m_constantScales;
+        std::vector<AnimatedVectorTrack> m_animatedPositions;
+        std::vector<AnimatedRotationTrack> m_animatedRotations;
+        std::vector<AnimatedVectorTrack> m_animatedScales;
+
+        std::vector<uint8_t> m_stream;     // Frame-major packed samples, padded for 64-bit reads
+        size_t m_frameBits = 0;
+
+        void DecodeFrame(size_t frame, Math::Vec3* translations, Math::Quat* rotations, Math::Vec3* scales) const;
+    };
+
+} // namespace Animation
+} // namespace GameEngine
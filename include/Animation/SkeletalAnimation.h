@@ -39,6 +39,17 @@ namespace Animation {
         bool HasAnyTracks() const { return HasPositionTrack() || HasRotationTrack() || HasScaleTrack(); }
     };
 
+    /**
+     * Sampling cursors for the tracks of one BoneAnimation, owned by the playing instance
+     */
+    struct BoneAnimationCursor {
+        KeyframeCursor position;
+        KeyframeCursor rotation;
+        KeyframeCursor scale;
+
+        void Reset() { position.Reset(); rotation.Reset(); scale.Reset(); }
+    };
+
     /**
      * Complete skeletal animation containing all bone tracks and metadata
      */
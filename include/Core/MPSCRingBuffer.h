@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace GameEngine {
+
+    /**
+     * @brief Bounded lock-free multi-producer / single-consumer ring buffer
+     *
+     * Each slot carries a sequence number (Vyukov's bounded queue): producers claim a
+     * slot with one compare-and-swap on the write position and publish it by bumping the
+     * slot's sequence; the single consumer reads slots in order without any CAS.
+     * Capacity is rounded up to a power of two.
+     */
+    template<typename T>
+    class MPSCRingBuffer {
+    public:
+        explicit MPSCRingBuffer(size_t capacity) {
+            size_t size = 2;
+            while (size < capacity) {
+                size <<= 1;
+            }
+            m_capacity = size;
+            m_mask = size - 1;
+            m_slots = std::make_unique<Slot[]>(size);
+            for (size_t i = 0; i < size; ++i) {
+                m_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        MPSCRingBuffer(const MPSCRingBuffer&) = delete;
+        MPSCRingBuffer& operator=(const MPSCRingBuffer&) = delete;
+
+        // Any thread. Returns false when the buffer is full.
+        bool TryPush(T&& item) {
+            size_t position = m_writePosition.load(std::memory_order_relaxed);
+            Slot* slot = nullptr;
+            for (;;) {
+                slot = &m_slots[position & m_mask];
+                const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+                const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                if (difference == 0) {
+                    if (m_writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (difference < 0) {
+                    return false;
+                } else {
+                    position = m_writePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            slot->item = std::move(item);
+            slot->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer thread only
+        bool TryPop(T& item) {
+            Slot& slot = m_slots[m_readPosition & m_mask];
+            if (slot.sequence.load(std::memory_order_acquire) != m_readPosition + 1) {
+                return false;
+            }
+
+            item = std::move(slot.item);
+            slot.sequence.store(m_readPosition + m_capacity, std::memory_order_release);
+            ++m_readPosition;
+            return true;
+        }
+
+        // Number of pushes claimed so far (monotonic)
+        size_t GetWriteCount() const { return m_writePosition.load(std::memory_order_acquire); }
+        size_t GetCapacity() const { return m_capacity; }
+
+        // Approximate when producers are active
+        size_t Size() const {
+            const size_t written = m_writePosition.load(std::memory_order_relaxed);
+            const size_t read = m_consumedCount.load(std::memory_order_relaxed);
+            return written > read ? written - read : 0;
+        }
+
+        // Consumer publishes how far it has read, for Size() and flush waits
+        void PublishReadPosition() { m_consumedCount.store(m_readPosition, std::memory_order_release); }
+        size_t GetReadCount() const { return m_consumedCount.load(std::memory_order_acquire); }
+
+    private:
+        struct Slot {
+            std::atomic<size_t> sequence{0};
+            T item{};
+        };
+
+        std::unique_ptr<Slot[]> m_slots;
+        size_t m_capacity = 0;
+        size_t m_mask = 0;
+
+        alignas(64) std::atomic<size_t> m_writePosition{0};
+        alignas(64) size_t m_readPosition = 0;
+        std::atomic<size_t> m_consumedCount{0};
+    };
+
+} // namespace GameEngine
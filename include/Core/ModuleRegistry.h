@@ -39,6 +39,7 @@ namespace GameEngine {
         // Module lifecycle management with enhanced error handling
         ModuleInitializationResult InitializeModules(const EngineConfig& config);
         void UpdateModules(float deltaTime);
+        void UpdateModules(float deltaTime, const std::function<bool(const IEngineModule&)>& filter);
         void ShutdownModules();
 
         // Dependency resolution with error reporting
@@ -0,0 +1,217 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// Set to 0 to compile every GAMEENGINE_PROFILE_* macro out
+#ifndef GAMEENGINE_ENABLE_PROFILER
+#define GAMEENGINE_ENABLE_PROFILER 1
+#endif
+
+// Zones are timed with the CPU timestamp counter where available (a few ns per read)
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define GAMEENGINE_PROFILER_USE_TSC 1
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#else
+#define GAMEENGINE_PROFILER_USE_TSC 0
+#endif
+
+namespace GameEngine {
+
+    enum class ProfileEventType : uint8_t {
+        Zone,           // Timed scope: start + duration
+        Counter,        // Named value at a point in time
+        FrameMarker     // Start of a frame
+    };
+
+    /**
+     * One recorded event. Names are static strings (or interned through Profiler::InternName),
+     * so recording never allocates or copies text. Times are profiler ticks while recorded and
+     * nanoseconds since the profiler epoch once captured.
+     */
+    struct ProfileEvent {
+        const char* name = nullptr;
+        const char* category = nullptr;
+        uint64_t startNs = 0;
+        uint64_t durationNs = 0;        // Zones; frame number for frame markers
+        double value = 0.0;             // Counters
+        ProfileEventType type = ProfileEventType::Zone;
+    };
+
+    /**
+     * A zone placed in its thread's call tree
+     */
+    struct ProfileTimelineZone {
+        const char* name = nullptr;
+        const char* category = nullptr;
+        uint64_t startNs = 0;           // Relative to the profiler epoch
+        uint64_t durationNs = 0;
+        uint32_t depth = 0;             // 0 = outermost zone on the thread
+    };
+
+    struct ProfileThreadTimeline {
+        uint32_t threadId = 0;
+        std::string threadName;
+        std::vector<ProfileTimelineZone> zones;     // Ordered by start; parents before children
+        std::vector<ProfileEvent> counters;
+    };
+
+    struct ProfileCapture {
+        std::vector<ProfileThreadTimeline> threads;
+        std::vector<uint64_t> frameStartsNs;        // Relative to the profiler epoch
+        size_t droppedEvents = 0;
+    };
+
+    /**
+     * @brief Engine-wide instrumentation profiler
+     *
+     * Every thread records into its own buffer of fixed-size event chunks, so a zone costs
+     * two clock reads and one unsynchronized event write. Capture and export read the
+     * buffers without stopping the recording threads. Export writes Chrome trace_event
+     * JSON, viewable in Perfetto or chrome://tracing.
+     */
+    class Profiler {
+    public:
+        static Profiler& GetInstance() {
+            static Profiler instance;
+            return instance;
+        }
+
+        // Recording is off until enabled
+        void SetEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+        bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+        // Per-thread event cap; events past it are dropped and counted
+        void SetMaxEventsPerThread(size_t maxEvents) { m_maxEventsPerThread.store(maxEvents, std::memory_order_relaxed); }
+
+        // Names the calling thread in captures and traces
+        void SetThreadName(const std::string& name);
+
+        // Recording; times are in ticks of Now()
+        static uint64_t Now() {
+#if GAMEENGINE_PROFILER_USE_TSC
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+        void RecordZone(const char* name, const char* category, uint64_t startTicks, uint64_t endTicks);
+        // Zone measured by another timer, ending now
+        void RecordZoneEndingNow(const char* name, const char* category, uint64_t durationNs);
+        void RecordCounter(const char* name, double value);
+        void MarkFrame();
+        uint64_t GetFrameNumber() const { return m_frameNumber.load(std::memory_order_relaxed); }
+
+        // Stable copy of a runtime name (shader, animation operation) for use as a zone or counter name.
+        // Takes a lock; intern once per name and keep the pointer rather than calling it per span
+        const char* InternName(const std::string& name);
+
+        // Discards everything recorded so far; threads reset their buffers on their next event
+        void Clear();
+
+        // Snapshot of all threads with zones nested into per-thread call trees
+        ProfileCapture Capture() const;
+        size_t GetDroppedEventCount() const { return m_droppedEvents.load(std::memory_order_relaxed); }
+
+        // Chrome trace_event JSON
+        std::string ExportChromeTrace() const;
+        bool ExportChromeTrace(const std::string& filename) const;
+
+    private:
+        struct ThreadBuffer;
+        friend struct ProfilerThreadState;
+
+        Profiler();
+        ~Profiler();
+        Profiler(const Profiler&) = delete;
+        Profiler& operator=(const Profiler&) = delete;
+
+        ThreadBuffer& GetThreadBuffer();
+        ProfileEvent* AllocateEvent(ThreadBuffer& buffer);
+        void RecordEvent(const ProfileEvent& event);
+
+        // Tick length, calibrated once against steady_clock at construction (ticks are ns without a TSC)
+        double CalibrateNanosecondsPerTick() const;
+        double GetNanosecondsPerTick() const { return m_nanosecondsPerTick.load(std::memory_order_relaxed); }
+
+        std::atomic<bool> m_enabled{false};
+        std::atomic<uint64_t> m_generation{0};
+        std::atomic<uint64_t> m_frameNumber{0};
+        std::atomic<size_t> m_maxEventsPerThread{1u << 20};
+        std::atomic<size_t> m_droppedEvents{0};
+        uint64_t m_epochTicks = 0;
+        std::chrono::steady_clock::time_point m_epochTime;
+        std::atomic<double> m_nanosecondsPerTick{1.0};
+
+        mutable std::mutex m_threadsMutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> m_threads;
+        uint32_t m_nextThreadId = 1;
+
+        std::mutex m_namesMutex;
+        std::unordered_set<std::string> m_names;
+    };
+
+    /**
+     * RAII zone; records nothing if the profiler was disabled when it opened
+     */
+    class ProfileScope {
+    public:
+        ProfileScope(const char* name, const char* category) {
+            if (Profiler::GetInstance().IsEnabled()) {
+                m_name = name;
+                m_category = category;
+                m_startNs = Profiler::Now();
+            }
+        }
+
+        ~ProfileScope() {
+            if (m_name) {
+                Profiler::GetInstance().RecordZone(m_name, m_category, m_startNs, Profiler::Now());
+            }
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        const char* m_name = nullptr;
+        const char* m_category = nullptr;
+        uint64_t m_startNs = 0;
+    };
+
+    // Instrumentation macros; names must be string literals or interned names
+    #define GAMEENGINE_PROFILE_CONCAT_INNER(a, b) a##b
+    #define GAMEENGINE_PROFILE_CONCAT(a, b) GAMEENGINE_PROFILE_CONCAT_INNER(a, b)
+
+    #if GAMEENGINE_ENABLE_PROFILER
+    #define GAMEENGINE_PROFILE_ZONE_CATEGORY(name, category) \
+        GameEngine::ProfileScope GAMEENGINE_PROFILE_CONCAT(profileScope_, __LINE__)(name, category)
+    #define GAMEENGINE_PROFILE_ZONE(name) GAMEENGINE_PROFILE_ZONE_CATEGORY(name, "Engine")
+    #define GAMEENGINE_PROFILE_FUNCTION() GAMEENGINE_PROFILE_ZONE(__func__)
+    #define GAMEENGINE_PROFILE_COUNTER(name, value) \
+        do { \
+            if (GameEngine::Profiler::GetInstance().IsEnabled()) { \
+                GameEngine::Profiler::GetInstance().RecordCounter(name, static_cast<double>(value)); \
+            } \
+        } while (0)
+    #define GAMEENGINE_PROFILE_FRAME() GameEngine::Profiler::GetInstance().MarkFrame()
+    #else
+    #define GAMEENGINE_PROFILE_ZONE_CATEGORY(name, category) do {} while (0)
+    #define GAMEENGINE_PROFILE_ZONE(name) do {} while (0)
+    #define GAMEENGINE_PROFILE_FUNCTION() do {} while (0)
+    #define GAMEENGINE_PROFILE_COUNTER(name, value) do {} while (0)
+    #define GAMEENGINE_PROFILE_FRAME() do {} while (0)
+    #endif
+
+} // namespace GameEngine
@@ -0,0 +1,18 @@
+#pragma once
+
+namespace GameEngine {
+
+    /**
+     * Instruction set used by the engine's batch kernels (pose blending, crowd movement).
+     * Levels are ordered: each one implies support for the ones before it.
+     */
+    enum class SimdLevel {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    // Widest level the CPU and OS support; detected once on first call
+    SimdLevel DetectSupportedSimdLevel();
+    const char* GetSimdLevelName(SimdLevel level);
+}
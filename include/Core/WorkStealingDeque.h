@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace GameEngine {
+
+    /**
+     * @brief Lock-free Chase-Lev work-stealing deque
+     *
+     * One owner thread pushes and pops at the bottom (LIFO) without locks; any other
+     * thread may steal from the top (FIFO) with a single compare-and-swap. The ring
+     * buffer grows on demand. Outgrown buffers are kept until the deque is destroyed
+     * because a concurrent thief may still be reading from them.
+     *
+     * Based on "Correct and Efficient Work-Stealing for Weak Memory Models"
+     * (Le, Pop, Cohen, Zappa Nardelli, PPoPP 2013). T must be trivially copyable,
+     * typically a pointer to a task.
+     */
+    template<typename T>
+    class WorkStealingDeque {
+        static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque stores trivially copyable items");
+
+    public:
+        explicit WorkStealingDeque(size_t initialCapacity = 256) {
+            size_t capacity = 1;
+            while (capacity < initialCapacity) {
+                capacity <<= 1;
+            }
+            m_buffers.push_back(std::make_unique<Buffer>(capacity));
+            m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+        }
+
+        WorkStealingDeque(const WorkStealingDeque&) = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        // Owner thread only
+        void Push(T item) {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+            const int64_t top = m_top.load(std::memory_order_acquire);
+            Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+
+            if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+                buffer = Grow(buffer, bottom, top);
+            }
+
+            buffer->Store(bottom, item);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        // Owner thread only
+        bool Pop(T& item) {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+            Buffer* buffer = m_buffer.load(std::memory_order_relaxed);
+            m_bottom.store(bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int64_t top = m_top.load(std::memory_order_relaxed);
+
+            if (top > bottom) {
+                // Empty
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            item = buffer->Load(bottom);
+            if (top == bottom) {
+                // Last item: race thieves for it
+                const bool won = m_top.compare_exchange_strong(top, top + 1,
+                                                               std::memory_order_seq_cst,
+                                                               std::memory_order_relaxed);
+                m_bottom.store(bottom + 1, std::memory_order_relaxed);
+                return won;
+            }
+            return true;
+        }
+
+        // Any thread. May fail spuriously when racing another thief or the owner.
+        bool Steal(T& item) {
+            int64_t top = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+            if (top >= bottom) {
+                return false;
+            }
+
+            Buffer* buffer = m_buffer.load(std::memory_order_acquire);
+            T stolen = buffer->Load(top);
+            if (!m_top.compare_exchange_strong(top, top + 1,
+                                               std::memory_order_seq_cst,
+                                               std::memory_order_relaxed)) {
+                return false;
+            }
+
+            item = stolen;
+            return true;
+        }
+
+        // Approximate when other threads are active
+        size_t Size() const {
+            const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+            const int64_t top = m_top.load(std::memory_order_relaxed);
+            return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+        }
+
+        bool IsEmpty() const { return Size() == 0; }
+        size_t GetCapacity() const { return m_buffer.load(std::memory_order_relaxed)->capacity; }
+
+    private:
+        struct Buffer {
+            explicit Buffer(size_t size)
+                : capacity(size), mask(size - 1), items(new std::atomic<T>[size]) {}
+
+            T Load(int64_t index) const {
+                return items[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+            }
+
+            void Store(int64_t index, T item) {
+                items[static_cast<size_t>(index) & mask].store(item, std::memory_order_relaxed);
+            }
+
+            size_t capacity;
+            size_t mask;
+            std::unique_ptr<std::atomic<T>[]> items;
+        };
+
+        Buffer* Grow(Buffer* buffer, int64_t bottom, int64_t top) {
+            auto grown = std::make_unique<Buffer>(buffer->capacity * 2);
+            for (int64_t i = top; i < bottom; ++i) {
+                grown->Store(i, buffer->Load(i));
+            }
+
+            Buffer* result = grown.get();
+            m_buffers.push_back(std::move(grown));
+            m_buffer.store(result, std::memory_order_release);
+            return result;
+        }
+
+        // Top and bottom on separate cache lines; thieves hammer one, the owner the other
+        alignas(64) std::atomic<int64_t> m_top{0};
+        alignas(64) std::atomic<int64_t> m_bottom{0};
+        alignas(64) std::atomic<Buffer*> m_buffer{nullptr};
+
+        // Owner-only; every buffer ever used, freed with the deque
+        std::vector<std::unique_ptr<Buffer>> m_buffers;
+    };
+
+} // namespace GameEngine
@@ -11,6 +11,7 @@ namespace GameEngine {
     class PhysicsEngine;
     class Model;
     class ModelLoader;
+    class JobSystem;
 
     namespace Animation {
         class AnimationController;
@@ -59,11 +60,14 @@ namespace GameEngine {
 
         bool Initialize(PhysicsEngine* physicsEngine = nullptr);
         void Update(float deltaTime, InputManager* input, class ThirdPersonCameraSystem* camera = nullptr);
+        // Workers for importing the character's model; set before Initialize
+        void SetJobSystem(JobSystem* jobSystem);
         void Render(PrimitiveRenderer* renderer);
 
         // Transform (delegated to movement component)
         void SetPosition(const Math::Vec3& position);
         const Math::Vec3& GetPosition() const;
+        Math::Vec3 GetRenderPosition() const;
         
         void SetRotation(float yaw);
         float GetRotation() const;
@@ -64,6 +64,8 @@ namespace GameEngine {
         // Transform interface
         virtual void SetPosition(const Math::Vec3& position) = 0;
         virtual const Math::Vec3& GetPosition() const = 0;
+        // Position to draw at; physics-driven components interpolate between fixed steps
+        virtual Math::Vec3 GetRenderPosition() const { return GetPosition(); }
         virtual void SetRotation(float yaw) = 0;
         virtual float GetRotation() const = 0;
 
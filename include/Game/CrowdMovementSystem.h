@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Core/Math.h"
+#include "Game/CharacterMovementComponent.h"
+#include "Core/SimdLevel.h"
+#include "Physics/PhysicsEngine.h"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace GameEngine {
+    /**
+     * @brief Data-oriented movement for large crowds of NPCs
+     *
+     * Moves thousands of agents with the rules of DeterministicMovementComponent: acceleration
+     * towards an input direction, gravity, jumping, ground snapping and friction. All agents share
+     * one MovementConfig and capsule size. State is kept in structure-of-arrays form and integrated
+     * by scalar, SSE2 or AVX2 kernels, which give bit-identical results, so a replay fed the same
+     * inputs and time steps reproduces every position exactly.
+     *
+     * With a physics engine, each update issues one batched capsule sweep for horizontal movement
+     * and one for ground probing, and no per-agent physics objects are created. Without one, agents
+     * walk on a flat plane at the ground level.
+     */
+    class CrowdMovementSystem {
+    public:
+        using AgentId = uint32_t;
+        static constexpr AgentId INVALID_AGENT = 0xFFFFFFFFu;
+
+        CrowdMovementSystem();
+        ~CrowdMovementSystem();
+
+        // Lifecycle; physicsEngine may be null for flat-ground movement
+        bool Initialize(PhysicsEngine* physicsEngine = nullptr);
+        void Update(float deltaTime);
+        void Shutdown();
+
+        // Agents. Removal moves the last agent into the freed slot, so slot order changes
+        AgentId AddAgent(const Math::Vec3& position);
+        bool RemoveAgent(AgentId id);
+        bool HasAgent(AgentId id) const;
+        size_t GetAgentCount() const { return m_agentIds.size(); }
+        void ClearAgents();
+
+        // Input persists until changed. Only the XZ part of the direction is used, clamped to unit length
+        void SetAgentMoveInput(AgentId id, const Math::Vec3& worldDirection);
+        void RequestJump(AgentId id);
+
+        // Per-agent state
+        void SetAgentPosition(AgentId id, const Math::Vec3& position);
+        Math::Vec3 GetAgentPosition(AgentId id) const;
+        void SetAgentVelocity(AgentId id, const Math::Vec3& velocity);
+        Math::Vec3 GetAgentVelocity(AgentId id) const;
+        float GetAgentRotation(AgentId id) const; // Yaw in degrees, facing the last input direction
+        bool IsAgentGrounded(AgentId id) const;
+        bool IsAgentJumping(AgentId id) const;
+
+        // Bulk readback in slot order, for renderers; ids[i] owns positions[i]
+        std::span<const AgentId> GetAgentIds() const { return m_agentIds; }
+        void GetAgentPositions(std::span<Math::Vec3> positions) const;
+
+        // Shared configuration
+        void SetMovementConfig(const CharacterMovementComponent::MovementConfig& config) { m_config = config; }
+        const CharacterMovementComponent::MovementConfig& GetMovementConfig() const { return m_config; }
+        void SetCharacterSize(float radius, float height);
+        float GetCharacterRadius() const { return m_characterRadius; }
+        float GetCharacterHeight() const { return m_characterHeight; }
+        void SetGroundLevel(float groundLevel) { m_groundLevel = groundLevel; } // Flat ground without physics
+        float GetGroundLevel() const { return m_groundLevel; }
+        void SetGravity(float gravity) { m_gravity = gravity; }
+        float GetGravity() const { return m_gravity; }
+        void SetCollisionFilter(int filterGroup, int filterMask);
+
+        // Kernel selection; clamped to what the CPU supports
+        SimdLevel GetSimdLevel() const { return m_simdLevel; }
+        SimdLevel SetSimdLevel(SimdLevel level);
+
+    private:
+        static constexpr uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+        uint32_t GetSlot(AgentId id) const;
+        void ResizeArrays(size_t count);
+        void SweepHorizontalMovement();
+        void ProbeGround(float deltaTime);
+
+        // Structure-of-arrays agent state, indexed by slot. Flags are 0 or ~0u lane masks
+        std::vector<float> m_positionX, m_positionY, m_positionZ;
+        std::vector<float> m_velocityX, m_velocityY, m_velocityZ;
+        std::vector<float> m_inputX, m_inputZ;
+        std::vector<float> m_facingX, m_facingZ;
+        std::vector<float> m_moveX, m_moveZ;          // Horizontal displacement for the current update
+        std::vector<float> m_groundY;                 // Capsule centre height when standing on the ground
+        std::vector<uint32_t> m_grounded, m_jumping, m_jumpRequested, m_hasGround;
+
+        // Id <-> slot mapping; ids are never reused
+        std::vector<AgentId> m_agentIds;
+        std::vector<uint32_t> m_slotOfAgent;
+
+        // Batched query scratch, reused across updates
+        std::vector<SweepQuery> m_sweepQueries;
+        std::vector<PhysicsEngine::SweepHit> m_sweepHits;
+        std::vector<uint32_t> m_sweepSlots;
+
+        PhysicsEngine* m_physicsEngine = nullptr;
+        CharacterMovementComponent::MovementConfig m_config;
+        SimdLevel m_simdLevel = SimdLevel::Scalar;
+
+        float m_characterRadius = 0.3f;
+        float m_characterHeight = 1.8f;
+        float m_groundLevel = 0.0f;
+        int m_filterGroup = 1;
+        int m_filterMask = -1;
+
+        // Parameters shared with DeterministicMovementComponent
+        float m_gravity = -15.0f;
+        float m_acceleration = 25.0f;
+        float m_airAcceleration = 8.0f;
+        float m_friction = 15.0f;
+        float m_brakingFriction = 25.0f;
+        float m_airFriction = 2.0f;
+        float m_minSpeedThreshold = 0.1f;
+        float m_groundSnapDistance = 0.1f;  // Band above the ground that still counts as standing
+        float m_groundProbeDistance = 0.5f; // How far below the capsule the ground sweep reaches
+        float m_skinWidth = 0.02f;          // Gap kept to walls after a blocked horizontal sweep
+    };
+}
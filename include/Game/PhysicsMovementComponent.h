@@ -23,6 +23,7 @@ namespace GameEngine {
         // Transform interface
         void SetPosition(const Math::Vec3& position) override;
         const Math::Vec3& GetPosition() const override { return m_position; }
+        Math::Vec3 GetRenderPosition() const override;
         void SetRotation(float yaw) override;
         float GetRotation() const override { return m_yaw; }
 
@@ -78,6 +79,8 @@ namespace GameEngine {
 
         // Physics body
         uint32_t m_rigidBodyId = 0;
+        // Dense slot of the body in the engine's interpolation arrays, refreshed by GetRenderPosition
+        mutable uint32_t m_motionSlot = ~0u;   // PhysicsEngine::INVALID_MOTION_SLOT
 
         // Force accumulation
         Math::Vec3 m_accumulatedForces{0.0f};
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Graphics/TextureCompression.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace GameEngine {
+
+    /**
+     * @brief CPU block encoder and decoder for the BCn formats
+     *
+     * Encodes 4x4 blocks of RGBA8 pixels (64 bytes, row by row) into BC1 (DXT1), BC2 (DXT3),
+     * BC3 (DXT5), BC4, BC5 and BC7. CompressionQuality selects the endpoint search:
+     *
+     * - BC1/BC2/BC3 colour: Fast and Normal use a range fit along the principal axis (Normal
+     *   adds a least-squares refinement); High and Ultra use a cluster fit over every ordering
+     *   of the pixels along the axis (Ultra iterates it on the fitted axis).
+     * - BC4/BC5 and BC3 alpha: min/max endpoints, plus the 6-value mode and a small endpoint
+     *   neighbourhood search from Normal up.
+     * - BC7: mode 6 for every block; opaque blocks also try the best-scoring two-subset
+     *   partitions of mode 1 (none at Fast, 64 at Ultra).
+     *
+     * Palette index selection, which dominates encoding time, has an SSE2 path that produces
+     * the same blocks as the scalar code. Whole images are split across threads by block rows.
+     */
+    class BlockCompression {
+    public:
+        // Bytes per 4x4 block, 0 for formats this encoder does not produce
+        static size_t GetBlockSize(CompressionFormat format);
+        static size_t GetCompressedSize(uint32_t width, uint32_t height, CompressionFormat format);
+        static bool IsFormatSupported(CompressionFormat format) { return GetBlockSize(format) > 0; }
+
+        /**
+         * @brief Compress an 8-bit image with 1-4 interleaved channels
+         *
+         * Partial blocks on the right and bottom edges repeat the last row and column. Colour
+         * formats read 1 channel as grey and 2 as grey + alpha; BC4 and BC5 read the first one
+         * and two channels as they are. Rows of blocks run in parallel on the JobSystem if one
+         * is given, otherwise on up to maxThreads threads (0 = one per core; 1 runs serially).
+         */
+        static bool CompressImage(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels,
+                                  CompressionFormat format, CompressionQuality quality,
+                                  std::vector<uint8_t>& output, size_t maxThreads = 0,
+                                  JobSystem* jobSystem = nullptr);
+
+        // Decode to RGBA8; BC4 fills red and BC5 red/green, as sampled by GL. Only the BC7
+        // modes written by this encoder (1 and 6) are decoded, other blocks fail the call.
+        static bool DecompressImage(const uint8_t* blocks, uint32_t width, uint32_t height,
+                                    CompressionFormat format, std::vector<uint8_t>& output);
+
+        // Single blocks; rgba holds 16 RGBA8 pixels, values 16 single-channel pixels
+        static void EncodeBC1(const uint8_t rgba[64], uint8_t block[8], CompressionQuality quality, bool punchThroughAlpha = false);
+        static void EncodeBC2(const uint8_t rgba[64], uint8_t block[16], CompressionQuality quality);
+        static void EncodeBC3(const uint8_t rgba[64], uint8_t block[16], CompressionQuality quality);
+        static void EncodeBC4(const uint8_t values[16], uint8_t block[8], CompressionQuality quality);
+        static void EncodeBC5(const uint8_t red[16], const uint8_t green[16], uint8_t block[16], CompressionQuality quality);
+        static void EncodeBC7(const uint8_t rgba[64], uint8_t block[16], CompressionQuality quality);
+
+        static void DecodeBC1(const uint8_t block[8], uint8_t rgba[64]);
+        static void DecodeBC2(const uint8_t block[16], uint8_t rgba[64]);
+        static void DecodeBC3(const uint8_t block[16], uint8_t rgba[64]);
+        static void DecodeBC4(const uint8_t block[8], uint8_t values[16]);
+        static void DecodeBC5(const uint8_t block[16], uint8_t red[16], uint8_t green[16]);
+        static bool DecodeBC7(const uint8_t block[16], uint8_t rgba[64]);
+
+        // SSE2 index search; disabling it is only useful to compare against the scalar path
+        static bool IsSimdAvailable();
+        static bool IsSimdEnabled();
+        static void SetSimdEnabled(bool enabled);
+    };
+}
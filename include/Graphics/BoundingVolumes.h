@@ -2,6 +2,8 @@
 
 #include "Core/Math.h"
 #include <algorithm>
+#include <array>
+#include <cmath>
 
 namespace GameEngine {
     struct BoundingBox {
@@ -114,4 +116,42 @@ namespace GameEngine {
             radius = newRadius;
         }
     };
-}
\ No newline at end of file
+
+    // Six planes (ax + by + cz + d >= 0 inside) in whatever space the source matrix maps from
+    struct Frustum {
+        std::array<Math::Vec4, 6> planes;
+        
+        Frustum() = default;
+        
+        // Planes of a projection * view (* model) matrix; with the model matrix included they
+        // are in that model's space
+        static Frustum FromMatrix(const Math::Mat4& matrix) {
+            Frustum frustum;
+            for (int i = 0; i < 3; ++i) {
+                for (int side = 0; side < 2; ++side) {
+                    const float sign = side == 0 ? 1.0f : -1.0f;
+                    Math::Vec4& plane = frustum.planes[i * 2 + side];
+                    for (int column = 0; column < 4; ++column) {
+                        plane[column] = matrix[column][3] + sign * matrix[column][i];
+                    }
+                    const float length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+                    if (length > 0.0f) {
+                        plane *= 1.0f / length;
+                    }
+                }
+            }
+            return frustum;
+        }
+        
+        bool Intersects(const BoundingSphere& sphere) const {
+            for (const auto& plane : planes) {
+                const float distance = plane.x * sphere.center.x + plane.y * sphere.center.y +
+                                       plane.z * sphere.center.z + plane.w;
+                if (distance < -sphere.radius) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+}
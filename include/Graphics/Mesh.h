@@ -3,6 +3,7 @@
 #include "../../engine/core/Math.h"
 #include "Resource/ResourceManager.h"
 #include "Graphics/BoundingVolumes.h"
+#include "Graphics/Meshlet.h"
 #include "Graphics/SkeletalMeshData.h"
 #include <vector>
 #include <memory>
@@ -31,6 +32,23 @@ namespace GameEngine {
         TexCoords3 = 9
     };
     
+    // Storage format of an attribute in a packed vertex buffer
+    enum class VertexFormat : uint8_t {
+        Float32 = 0,        // One float per component
+        Float16 = 1,        // One half float per component
+        Octahedral16 = 2,   // Unit vector as two snorm16 octahedral coordinates; shaders decode it
+        Unorm8 = 3,         // One normalized byte per component, [0, 1]
+        UInt8 = 4           // One integer byte per component, read as float by the shader
+    };
+    
+    // Which compact encodings a packed layout may use
+    struct VertexFormatOptions {
+        bool halfFloatTexCoords = true;     // TexCoords, TexCoords2, TexCoords3
+        bool octahedralNormals = false;     // Normal, Tangent, Bitangent; needs shaders that decode them
+        bool unorm8Colors = true;           // Only used when every color is within [0, 1]
+        bool compactSkinning = true;        // uint8 bone indices (< 256) and unorm8 weights
+    };
+    
     // Vertex layout system for flexible attribute management
     struct VertexLayout {
         struct Attribute {
@@ -40,19 +58,31 @@ namespace GameEngine {
             uint32_t dataType; // GL_FLOAT, etc.
             bool normalized;
             bool enabled;
+            VertexFormat format = VertexFormat::Float32;
         };
         
         std::vector<Attribute> attributes;
         uint32_t stride;
         
+        // Offsets and stride describe a packed buffer with only these attributes,
+        // rather than the Vertex struct
+        bool packed = false;
+        
         VertexLayout();
         void AddAttribute(VertexAttribute type, uint32_t size, uint32_t dataType, bool normalized = false);
+        void AddAttribute(VertexAttribute type, VertexFormat format); // Packed attribute
+        const Attribute* FindAttribute(VertexAttribute type) const;
         uint32_t GetAttributeOffset(VertexAttribute type) const;
         bool HasAttribute(VertexAttribute type) const;
         void EnableAttribute(VertexAttribute type);
         void DisableAttribute(VertexAttribute type);
         bool IsAttributeEnabled(VertexAttribute type) const;
         void CalculateStride();
+        
+        // Packed layout with Position (always Float32, at offset 0) followed by the given attributes
+        static VertexLayout CreatePacked(const std::vector<VertexAttribute>& attributes,
+                                         const VertexFormatOptions& options = VertexFormatOptions());
+        static uint32_t GetComponentCount(VertexAttribute type);
     };
     
     struct Vertex {
@@ -109,10 +139,36 @@ namespace GameEngine {
         // Vertex data management
         void SetVertices(const std::vector<Vertex>& vertices);
         void SetIndices(const std::vector<uint32_t>& indices);
+        // Take ownership of storage a loader decoded in place
+        void SetVertices(std::vector<Vertex>&& vertices);
+        void SetIndices(std::vector<uint32_t>&& indices);
+        // Bulk copy from external storage such as a mapped cache file
+        void SetVertices(const Vertex* vertices, size_t count);
+        void SetIndices(const uint32_t* indices, size_t count);
+        // Arrays prepared off the render thread with the static passes below, uploaded once
+        void SetGeometry(std::vector<Vertex>&& vertices, std::vector<uint32_t>&& indices,
+                         const BoundingBox& boundingBox, const BoundingSphere& boundingSphere);
         
+        // Full vertices; empty while the mesh is packed. DecodeVertices() works for either storage
         const std::vector<Vertex>& GetVertices() const { return m_vertices; }
+        std::vector<Vertex> DecodeVertices() const;
         const std::vector<uint32_t>& GetIndices() const { return m_indices; }
         
+        // Packed vertex storage: only the layout's attributes, in their compact formats.
+        // Editing operations (normal/tangent generation, vertex reordering, ...) unpack the mesh.
+        void PackVertices(const VertexFormatOptions& options = VertexFormatOptions()); // Only attributes in use
+        void PackVertices(const VertexLayout& layout);
+        void SetPackedVertices(const uint8_t* data, size_t vertexCount, const VertexLayout& layout);
+        void SetPackedVertices(std::vector<uint8_t>&& data, size_t vertexCount, const VertexLayout& layout);
+        void UnpackVertices();
+        bool IsPacked() const { return m_layout.packed; }
+        const std::vector<uint8_t>& GetPackedVertexData() const { return m_packedVertices; }
+        size_t GetVertexDataSize() const;
+        
+        // Per-vertex access that works for both storage modes
+        Vertex GetVertex(size_t index) const;
+        Math::Vec3 GetVertexPosition(size_t index) const;
+        
         // Vertex layout management
         void SetVertexLayout(const VertexLayout& layout);
         VertexLayout GetVertexLayout() const { return m_layout; }
@@ -121,7 +177,7 @@ namespace GameEngine {
         bool IsAttributeEnabled(VertexAttribute attribute) const;
         
         // Statistics methods
-        uint32_t GetVertexCount() const { return static_cast<uint32_t>(m_vertices.size()); }
+        uint32_t GetVertexCount() const { return IsPacked() ? m_packedVertexCount : static_cast<uint32_t>(m_vertices.size()); }
         uint32_t GetTriangleCount() const { return static_cast<uint32_t>(m_indices.size() / 3); }
         MeshStats GetStats() const;
         
@@ -160,6 +216,13 @@ namespace GameEngine {
         BoundingSphere GetBoundingSphere() const { return m_boundingSphere; }
         void UpdateBounds();
         
+        // Meshlets for per-cluster culling (MeshOptimizer::BuildMeshlets); changing the indices
+        // or the vertex order drops them
+        void SetMeshlets(MeshletData meshlets) { m_meshlets = std::move(meshlets); }
+        const MeshletData& GetMeshlets() const { return m_meshlets; }
+        bool HasMeshlets() const { return !m_meshlets.IsEmpty(); }
+        void ClearMeshlets() { m_meshlets.Clear(); }
+        
         // Mesh optimization methods
         void OptimizeVertexCache();
         void OptimizeVertexFetch();
@@ -168,6 +231,13 @@ namespace GameEngine {
         void GenerateNormals(bool smooth = true);
         void GenerateTangents();
         
+        // The same passes on plain arrays. They touch no GL state, so importers run them on
+        // worker threads and hand the result to SetGeometry
+        static void GenerateNormals(std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, bool smooth = true);
+        static void GenerateTangents(std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+        static void OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount);
+        static void CalculateBounds(const std::vector<Vertex>& vertices, BoundingBox& boundingBox, BoundingSphere& boundingSphere);
+        
         // Validation methods
         bool Validate() const;
         std::vector<std::string> GetValidationErrors() const;
@@ -200,8 +270,14 @@ namespace GameEngine {
         float CalculateTriangleArea(uint32_t i0, uint32_t i1, uint32_t i2) const;
         bool IsTriangleDegenerate(uint32_t i0, uint32_t i1, uint32_t i2, float epsilon = 0.0001f) const;
         
-        // CPU data (always available)
+        void ClearPackedVertices();
+        void ApplyVertexLayout(const VertexLayout& layout);
+        
+        // CPU data (always available). When packed, m_packedVertices holds the vertices and
+        // m_vertices is empty.
         std::vector<Vertex> m_vertices;
+        std::vector<uint8_t> m_packedVertices;
+        uint32_t m_packedVertexCount = 0;
         std::vector<uint32_t> m_indices;
         std::string m_name;
         std::shared_ptr<Material> m_material;
@@ -221,6 +297,8 @@ namespace GameEngine {
         BoundingBox m_boundingBox;
         BoundingSphere m_boundingSphere;
         
+        MeshletData m_meshlets;
+        
         // GPU resources (created lazily)
         mutable uint32_t m_VAO = 0;
         mutable uint32_t m_VBO = 0;
@@ -2,6 +2,7 @@
 
 #include "Graphics/Mesh.h"
 #include "Graphics/BoundingVolumes.h"
+#include "Graphics/Meshlet.h"
 #include "Core/Math.h"
 #include <vector>
 #include <memory>
@@ -79,15 +80,27 @@ namespace GameEngine {
         bool enableDistanceBasedSelection = true;
     };
     
+    // Quadric simplification settings
+    struct SimplificationOptions {
+        uint32_t targetTriangles = 0;  // Stop once this many triangles remain
+        float maxError = 1.0f;  // Stop before exceeding this error, relative to the mesh extent
+        bool preserveBoundaries = true;  // Lock open borders in place instead of sliding along them
+        bool preserveUVSeams = true;  // Keep vertices split by texture coordinates (otherwise welded)
+        bool preserveNormalSeams = true;  // Keep vertices split by normals (otherwise welded)
+        float uvWeight = 1.0f;  // Attribute error weights relative to position error
+        float normalWeight = 0.5f;
+    };
+    
     /**
      * @brief Advanced mesh optimization and LOD generation system
      * 
      * Provides industry-standard mesh optimization algorithms including:
-     * - Tom Forsyth's vertex cache optimization
+     * - Tom Forsyth's vertex cache optimization in linear time
      * - Vertex fetch optimization
-     * - Overdraw reduction
-     * - Mesh simplification with configurable quality levels
+     * - Cluster-based overdraw reduction
+     * - Attribute-aware quadric error simplification with border and seam locking
      * - Automatic LOD generation with distance-based selection
+     * - Meshlet building with per-cluster frustum and backface cone culling
      * - Comprehensive mesh analysis and validation
      */
     class MeshOptimizer {
@@ -107,13 +120,33 @@ namespace GameEngine {
         static std::shared_ptr<Mesh> Simplify(const Mesh& mesh, float ratio);
         static std::shared_ptr<Mesh> SimplifyToTargetError(const Mesh& mesh, float maxError);
         static std::shared_ptr<Mesh> SimplifyToTriangleCount(const Mesh& mesh, uint32_t targetTriangles);
-        
-        // Automatic LOD generation with distance-based selection
+        static std::shared_ptr<Mesh> Simplify(const Mesh& mesh, const SimplificationOptions& options);
+        // Simplified index buffer into the same vertices; resultError receives the relative error reached
+        static std::vector<uint32_t> SimplifyIndices(const std::vector<Vertex>& vertices,
+                                                     const std::vector<uint32_t>& indices,
+                                                     const SimplificationOptions& options,
+                                                     float* resultError = nullptr);
+        
+        // Automatic LOD generation with distance-based selection; levels are simplified in parallel
         static std::vector<std::shared_ptr<Mesh>> GenerateLODChain(const Mesh& mesh, const std::vector<float>& ratios);
+        static std::vector<std::shared_ptr<Mesh>> GenerateLODChain(const Mesh& mesh, const std::vector<float>& ratios,
+                                                                   const SimplificationOptions& options);
         static std::vector<std::shared_ptr<Mesh>> GenerateAutomaticLODs(const Mesh& mesh, uint32_t lodCount);
         static std::shared_ptr<Mesh> SelectLOD(const std::vector<std::shared_ptr<Mesh>>& lodChain, 
                                                float distance, const LODGenerationConfig& config);
         
+        // Meshlets: triangles grouped into clusters of at most maxVertices (<= 256) vertices and
+        // maxTriangles triangles, each with a bounding sphere and normal cone. Building from a
+        // cache-optimized index order gives the most compact meshlets.
+        static MeshletData BuildMeshlets(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                         uint32_t maxVertices = 64, uint32_t maxTriangles = 124);
+        static void BuildMeshlets(Mesh& mesh, uint32_t maxVertices = 64, uint32_t maxTriangles = 124);
+        // Writes the mesh indices of meshlets that intersect the frustum and, with backface culling,
+        // are not facing away from the viewer; frustum and viewer are in mesh space.
+        // Returns the number of visible meshlets.
+        static size_t CullMeshlets(const MeshletData& meshlets, const Frustum& frustum, const Math::Vec3& viewerPosition,
+                                   std::vector<uint32_t>& visibleIndices, bool backfaceCulling = true);
+        
         // Vertex processing
         static void RemoveDuplicateVertices(Mesh& mesh, float epsilon = 0.0001f);
         static void GenerateNormals(Mesh& mesh, bool smooth = true);
@@ -141,7 +174,9 @@ namespace GameEngine {
         static void SetVerboseLogging(bool enabled) { s_verboseLogging = enabled; }
         
         // Public helper methods for testing and external use
+        // ACMR: transformed vertices per triangle (0.5 best for regular grids, 3.0 worst)
         static float CalculateACMR(const std::vector<uint32_t>& indices, size_t cacheSize = 32);
+        // ATVR: transformed vertices per vertex (1.0 best)
         static float CalculateATVR(const std::vector<uint32_t>& indices, size_t vertexCount);
         static float CalculateOverdrawRatio(const std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices);
         
@@ -160,11 +195,7 @@ namespace GameEngine {
         static bool IsTriangleThin(const Math::Vec3& v0, const Math::Vec3& v1, const Math::Vec3& v2, float threshold = 10.0f);
         static bool IsTriangleSmall(const Math::Vec3& v0, const Math::Vec3& v1, const Math::Vec3& v2, float threshold = 0.0001f);
         
-        // Simplification algorithms
-        static std::shared_ptr<Mesh> SimplifyQuadricErrorMetrics(const Mesh& mesh, float ratio, float maxError);
-        static std::shared_ptr<Mesh> SimplifyEdgeCollapse(const Mesh& mesh, uint32_t targetTriangles);
-        
-        // Vertex cache simulation for Tom Forsyth's algorithm
+        // Vertex cache simulation for ACMR/ATVR statistics
         struct VertexCacheSimulator {
             std::vector<uint32_t> cache;
             uint32_t cacheSize;
@@ -177,31 +208,6 @@ namespace GameEngine {
             float GetCacheMissRatio() const;
             void Reset();
         };
-        
-        // Vertex scoring for Tom Forsyth's algorithm
-        static float CalculateVertexScore(uint32_t vertex, const std::vector<uint32_t>& cache, 
-                                         const std::vector<uint32_t>& valence, uint32_t cacheSize);
-        
-        // Edge collapse data structures for simplification
-        struct Edge {
-            uint32_t v0, v1;
-            float cost;
-            Math::Mat4 quadric;
-            
-            bool operator<(const Edge& other) const { return cost < other.cost; }
-        };
-        
-        struct VertexQuadric {
-            Math::Mat4 quadric;
-            std::vector<uint32_t> adjacentTriangles;
-            std::vector<uint32_t> adjacentVertices;
-        };
-        
-        // Utility functions
-        static Math::Mat4 CalculateQuadricMatrix(const Math::Vec3& v0, const Math::Vec3& v1, const Math::Vec3& v2);
-        static float CalculateEdgeCollapseError(const Math::Vec3& v0, const Math::Vec3& v1, const Math::Mat4& quadric);
-        static bool CanCollapseEdge(uint32_t v0, uint32_t v1, const std::vector<Vertex>& vertices, 
-                                   const std::vector<uint32_t>& indices);
     };
     
 } // namespace GameEngine
\ No newline at end of file
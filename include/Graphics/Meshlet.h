@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Graphics/BoundingVolumes.h"
+#include <cstdint>
+#include <vector>
+
+namespace GameEngine {
+
+    /**
+     * @brief A small cluster of a mesh's triangles that is culled as a unit
+     *
+     * Vertices are indices into the mesh's vertex buffer, stored in MeshletData::vertices;
+     * triangles are three byte-sized indices into the meshlet's own vertex list.
+     */
+    struct Meshlet {
+        uint32_t vertexOffset = 0;    // First entry in MeshletData::vertices
+        uint32_t triangleOffset = 0;  // First byte in MeshletData::triangles
+        uint32_t vertexCount = 0;
+        uint32_t triangleCount = 0;
+
+        BoundingSphere bounds;        // Mesh space
+
+        // Backface cone: every triangle faces away from viewers for which
+        // dot(normalize(coneApex - viewer), coneAxis) >= coneCutoff. coneApex lies behind all
+        // triangle planes; coneCutoff 1 disables the test (normals spread too far).
+        Math::Vec3 coneApex = Math::Vec3(0.0f);
+        Math::Vec3 coneAxis = Math::Vec3(0.0f, 0.0f, 1.0f);
+        float coneCutoff = 1.0f;
+    };
+
+    // Meshlets of one mesh with their shared vertex and local triangle arrays
+    struct MeshletData {
+        std::vector<Meshlet> meshlets;
+        std::vector<uint32_t> vertices;
+        std::vector<uint8_t> triangles;
+
+        uint32_t maxVertices = 0;     // Limits the meshlets were built with
+        uint32_t maxTriangles = 0;
+
+        bool IsEmpty() const { return meshlets.empty(); }
+
+        void Clear() {
+            meshlets.clear();
+            vertices.clear();
+            triangles.clear();
+            maxVertices = 0;
+            maxTriangles = 0;
+        }
+
+        size_t GetMemoryUsage() const {
+            return meshlets.size() * sizeof(Meshlet) + vertices.size() * sizeof(uint32_t) + triangles.size();
+        }
+    };
+}
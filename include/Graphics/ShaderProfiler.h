@@ -145,10 +145,17 @@ namespace GameEngine {
         ShaderProfiler(const ShaderProfiler&) = delete;
         ShaderProfiler& operator=(const ShaderProfiler&) = delete;
         
+        // Open timing for a shader; kept between spans so the profiler name is interned once
+        struct ShaderTiming {
+            std::chrono::high_resolution_clock::time_point start;
+            const char* profileName = nullptr;
+            bool running = false;
+        };
+
         bool m_profilingEnabled = false;
         std::unordered_map<std::string, ShaderPerformanceStats> m_shaderStats;
         std::unordered_map<std::string, uint32_t> m_shaderPrograms;
-        std::unordered_map<std::string, std::chrono::high_resolution_clock::time_point> m_timingStart;
+        std::unordered_map<std::string, ShaderTiming> m_timingStart;
         
         // Performance thresholds
         double m_maxFrameTimeMs = 16.67; // 60 FPS
@@ -10,12 +10,16 @@
 
 namespace GameEngine {
     class Texture;
+    class JobSystem;
+    class JobGroup;
 
     enum class CompressionFormat {
         None = 0,
         DXT1 = 0x83F1,      // GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
         DXT3 = 0x83F2,      // GL_COMPRESSED_RGBA_S3TC_DXT3_EXT
         DXT5 = 0x83F3,      // GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+        BC4 = 0x8DBB,       // GL_COMPRESSED_RED_RGTC1
+        BC5 = 0x8DBD,       // GL_COMPRESSED_RG_RGTC2
         BC7 = 0x8E8C,       // GL_COMPRESSED_RGBA_BPTC_UNORM
         ETC2_RGB = 0x9274,  // GL_COMPRESSED_RGB8_ETC2
         ETC2_RGBA = 0x9278, // GL_COMPRESSED_RGBA8_ETC2_EAC
@@ -70,6 +74,9 @@ namespace GameEngine {
         bool Initialize();
         void Shutdown();
 
+        // Batches and block rows run on this JobSystem; pending batches finish before it changes
+        void SetJobSystem(JobSystem* jobSystem);
+
         // Compression operations
         CompressionResult CompressTexture(const std::string& name, const void* data, 
                                         uint32_t width, uint32_t height, uint32_t channels,
@@ -77,11 +84,14 @@ namespace GameEngine {
         CompressionResult CompressTexture(const std::string& name, std::shared_ptr<Texture> texture,
                                         const CompressionSettings& settings);
         
-        // Batch compression
+        // Batch compression: textureNames are image files, loaded and compressed one after the
+        // other in a background job (each image split across the workers by block rows).
+        // Callbacks run on that job's thread. Without a JobSystem the batch runs on the caller.
         void CompressTexturesAsync(const std::vector<std::string>& textureNames,
                                  const CompressionSettings& settings,
                                  CompressionProgressCallback progressCallback = nullptr,
                                  CompressionCompleteCallback completeCallback = nullptr);
+        void WaitForAsyncCompression();
         
         // Format support detection
         bool IsFormatSupported(CompressionFormat format) const;
@@ -106,17 +116,21 @@ namespace GameEngine {
         std::string GetFormatName(CompressionFormat format) const;
 
     private:
-        TextureCompression() = default;
-        ~TextureCompression() = default;
+        TextureCompression();
+        ~TextureCompression();
         TextureCompression(const TextureCompression&) = delete;
         TextureCompression& operator=(const TextureCompression&) = delete;
 
         void DetectSupportedFormats();
+        bool IsFormatSupportedLocked(CompressionFormat format) const;
         CompressionResult CompressWithDXT(const void* data, uint32_t width, uint32_t height, 
                                         uint32_t channels, CompressionFormat format, 
-                                        CompressionQuality quality);
+                                        const CompressionSettings& settings);
+        CompressionResult CompressWithRGTC(const void* data, uint32_t width, uint32_t height, 
+                                         uint32_t channels, CompressionFormat format, 
+                                         const CompressionSettings& settings);
         CompressionResult CompressWithBC7(const void* data, uint32_t width, uint32_t height, 
-                                        uint32_t channels, CompressionQuality quality);
+                                        uint32_t channels, const CompressionSettings& settings);
         CompressionResult CompressWithETC2(const void* data, uint32_t width, uint32_t height, 
                                          uint32_t channels, CompressionFormat format, 
                                          CompressionQuality quality);
@@ -136,5 +150,8 @@ namespace GameEngine {
         mutable std::mutex m_statsMutex;
         CompressionStats m_stats;
         std::atomic<bool> m_initialized{false};
+
+        JobSystem* m_jobSystem = nullptr;
+        std::unique_ptr<JobGroup> m_asyncBatches;
     };
 }
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Graphics/Mesh.h"
+#include <cstdint>
+#include <vector>
+
+namespace GameEngine {
+
+    /**
+     * @brief Conversion between Vertex and packed vertex buffers described by a VertexLayout
+     *
+     * A packed layout stores only the attributes it lists, each in its VertexFormat, at the
+     * offsets computed by VertexLayout::CalculateStride. Position is always Float32 at offset 0
+     * so positions can be read without decoding the rest of the vertex.
+     */
+    class VertexPacking {
+    public:
+        // Attributes that carry data in any vertex (differ from the Vertex defaults); Position is implied
+        static std::vector<VertexAttribute> DetectUsedAttributes(const Vertex* vertices, size_t count);
+
+        // Packed layout for the used attributes, falling back to wider formats where the data
+        // does not fit (bone indices above 255, colors outside [0, 1])
+        static VertexLayout CreateLayout(const Vertex* vertices, size_t count,
+                                         const VertexFormatOptions& options = VertexFormatOptions());
+
+        // destination must hold count * layout.stride bytes
+        static void Pack(const Vertex* vertices, size_t count, const VertexLayout& layout, uint8_t* destination);
+        // Attributes missing from the layout keep their Vertex defaults
+        static void Unpack(const uint8_t* source, size_t count, const VertexLayout& layout, Vertex* destination);
+
+        // Component encodings
+        static uint16_t FloatToHalf(float value);
+        static float HalfToFloat(uint16_t value);
+        static void EncodeOctahedral(const Math::Vec3& direction, int16_t encoded[2]);
+        static Math::Vec3 DecodeOctahedral(const int16_t encoded[2]);
+    };
+}
@@ -1,12 +1,14 @@
 #pragma once
 
 #include "Physics/PhysicsEngine.h"
+#include "Physics/BulletTaskScheduler.h"
 #include "Core/Math.h"
 #include <memory>
 #include <unordered_map>
 
 #ifdef GAMEENGINE_HAS_BULLET
 #include <btBulletDynamicsCommon.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
 
 namespace GameEngine {
     
@@ -28,8 +30,9 @@ namespace GameEngine {
         /**
          * @brief Construct a new BulletPhysicsWorld with configuration
          * @param config The physics configuration
+         * @param jobSystem Workers for the multithreaded world; without one it is single-threaded
          */
-        explicit BulletPhysicsWorld(const PhysicsConfiguration& config);
+        explicit BulletPhysicsWorld(const PhysicsConfiguration& config, JobSystem* jobSystem = nullptr);
         
         /**
          * @brief Destroy the BulletPhysicsWorld and clean up all resources
@@ -42,6 +45,15 @@ namespace GameEngine {
          */
         void Step(float deltaTime) override;
         
+        /**
+         * @brief Advance the simulation by exactly one step of timeStep seconds
+         * 
+         * Used by PhysicsEngine's fixed-step loop; unlike Step, Bullet's own time accumulator and
+         * motion state interpolation are bypassed.
+         * @param timeStep Step length in seconds
+         */
+        void StepFixed(float timeStep);
+        
         /**
          * @brief Set the gravity for the physics world
          * @param gravity New gravity vector
@@ -60,6 +72,15 @@ namespace GameEngine {
          */
         btDiscreteDynamicsWorld* GetBulletWorld() const { return m_dynamicsWorld.get(); }
         
+        /**
+         * @brief Get the number of threads stepping the world
+         * 
+         * Above 1 only when PhysicsConfiguration::multithreadedSimulation was set, a JobSystem
+         * was given and the task scheduler could be installed; the world is then a
+         * btDiscreteDynamicsWorldMt.
+         */
+        int GetSimulationThreadCount() const { return m_taskScheduler ? m_taskScheduler->GetLoopThreadCount() : 1; }
+        
         /**
          * @brief Add a rigid body to the physics world
          * @param bodyId The ID of the rigid body
@@ -111,6 +132,11 @@ namespace GameEngine {
         std::unique_ptr<btDefaultCollisionConfiguration> m_collisionConfig;
         std::unique_ptr<btCollisionDispatcher> m_dispatcher;
         std::unique_ptr<btSequentialImpulseConstraintSolver> m_solver;
+        
+        // Multithreaded mode only: islands go to a pool of solvers, m_solver takes large islands
+        JobSystem* m_jobSystem = nullptr;
+        std::shared_ptr<Physics::BulletTaskScheduler> m_taskScheduler;
+        std::unique_ptr<btConstraintSolverPoolMt> m_solverPool;
         std::unique_ptr<btDiscreteDynamicsWorld> m_dynamicsWorld;
         
         // Body management
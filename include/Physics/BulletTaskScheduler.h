@@ -0,0 +1,67 @@
+#pragma once
+
+#ifdef GAMEENGINE_HAS_BULLET
+
+#include <LinearMath/btThreads.h>
+#include <memory>
+#include <thread>
+
+namespace GameEngine {
+    class JobSystem;
+
+    namespace Physics {
+        /**
+         * @brief Runs Bullet's parallel loops on the engine JobSystem
+         *
+         * Bullet has one process-wide task scheduler and numbers every thread that runs its
+         * parallel code, never reusing a number. Its per-thread tables are sized by
+         * getNumThreads() when a world is built. Loop chunks therefore only run on the
+         * JobSystem's workers and on the thread that installed the scheduler, which may step
+         * worlds itself or from a frame job. Any other caller hands its loop to the workers.
+         * getNumThreads() reports every number Bullet can hand out, so a worker numbered late
+         * still lands inside the tables.
+         *
+         * All multithreaded worlds share one instance through Acquire. It stays installed while
+         * referenced, and Bullet's sequential scheduler is restored after the last release.
+         * Acquire it on the thread Bullet numbered first (the main thread). Loops only run in
+         * parallel when Bullet was built with BT_THREADSAFE.
+         */
+        class BulletTaskScheduler : public btITaskScheduler {
+        public:
+            // Shared scheduler, installed on first use. Returns nullptr if the JobSystem has no
+            // workers, the scheduler is already installed for another JobSystem, or Bullet
+            // rejects it (not called from the thread Bullet numbered first)
+            static std::shared_ptr<BulletTaskScheduler> Acquire(JobSystem& jobSystem);
+
+            ~BulletTaskScheduler() override;
+
+            int getMaxNumThreads() const override;
+            int getNumThreads() const override;
+            // The worker set is the JobSystem's; 1 runs loops on the calling thread, anything more in parallel
+            void setNumThreads(int numThreads) override;
+            void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) override;
+            // Partial sums are added in range order, so results do not depend on scheduling
+            btScalar parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) override;
+
+            // Threads that can work on one loop at once: the workers plus the caller
+            int GetLoopThreadCount() const { return m_loopThreadCount; }
+
+        private:
+            explicit BulletTaskScheduler(JobSystem& jobSystem);
+
+            // Calls runChunk for each of [0, chunkCount) on the caller and up to one helper job per worker
+            template <typename ChunkFunction>
+            void ForEachChunk(size_t chunkCount, const ChunkFunction& runChunk);
+            // The JobSystem's workers and the installing thread; only they may run Bullet work
+            bool IsSchedulerThread() const;
+            bool CanRunBulletWork() const;
+
+            JobSystem* m_jobSystem = nullptr;
+            std::thread::id m_ownerThread;
+            int m_loopThreadCount = 1;
+            bool m_parallel = true;
+        };
+    }
+}
+
+#endif // GAMEENGINE_HAS_BULLET
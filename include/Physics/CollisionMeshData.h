@@ -0,0 +1,49 @@
+#pragma once
+
+#include "../../engine/core/Math.h"
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace GameEngine {
+    class Mesh;
+
+    /**
+     * @brief Immutable triangle data for Mesh and ConvexHull collision shapes
+     *
+     * Shape descriptors hold it through a shared pointer, so any number of bodies built from one
+     * render mesh reference a single copy. The content hash is computed once on construction and
+     * keys the shape cache and the cooked BVH files written next to it.
+     */
+    class CollisionMeshData {
+    public:
+        // indices is a triangle list; leave it empty for point clouds used only by convex hulls
+        CollisionMeshData(std::vector<Math::Vec3> positions, std::vector<uint32_t> indices = {});
+
+        // Positions and indices of a render mesh (packed or not); unindexed meshes get a sequential list
+        static std::shared_ptr<const CollisionMeshData> FromMesh(const Mesh& mesh);
+
+        const std::vector<Math::Vec3>& GetPositions() const { return m_positions; }
+        const std::vector<uint32_t>& GetIndices() const { return m_indices; }
+        size_t GetTriangleCount() const { return m_indices.size() / 3; }
+        uint64_t GetContentHash() const { return m_contentHash; }
+
+        // True when every index is in range and the triangle list is complete
+        bool IsValidTriangleMesh() const;
+
+        /**
+         * @brief Simplified convex hull vertices, at most maxVertices of them (0 = no limit)
+         *
+         * Takes the support points of the positions along evenly spread directions, using as
+         * many directions as fit the budget, so every returned point is an original hull vertex
+         * and the hull keeps its extent along each sampled axis. Point sets that already fit the
+         * budget are returned unchanged.
+         */
+        std::vector<Math::Vec3> ComputeHullVertices(uint32_t maxVertices) const;
+
+    private:
+        std::vector<Math::Vec3> m_positions;
+        std::vector<uint32_t> m_indices;
+        uint64_t m_contentHash = 0;
+    };
+}
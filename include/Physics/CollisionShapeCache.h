@@ -0,0 +1,60 @@
+#pragma once
+
+#ifdef GAMEENGINE_HAS_BULLET
+
+#include "PhysicsEngine.h"
+#include <btBulletDynamicsCommon.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace GameEngine {
+    namespace Physics {
+        /**
+         * @brief Shares Bullet collision shapes between bodies with identical descriptors
+         *
+         * Descriptors are keyed by content, with mesh data compared by its hash rather than by
+         * pointer, so every crate of one size or every instance of a rock mesh uses a single shape.
+         * Scaled meshes and compound children are themselves taken from the cache. When a BVH
+         * directory is set, triangle mesh BVHs are written there after building and loaded from
+         * there on later runs. Not thread-safe.
+         */
+        class CollisionShapeCache {
+        public:
+            explicit CollisionShapeCache(std::string bvhDirectory = "");
+
+            // Shared shape for the descriptor, created on first use; nullptr for invalid descriptors
+            std::shared_ptr<btCollisionShape> Acquire(const CollisionShape& desc);
+
+            void SetBvhDirectory(std::string directory) { m_bvhDirectory = std::move(directory); }
+            const std::string& GetBvhDirectory() const { return m_bvhDirectory; }
+            // Cooked BVH file for a mesh, or an empty string when no directory is set
+            std::string GetBvhPath(const CollisionMeshData& mesh) const;
+
+            // Drops shapes referenced only by the cache and returns how many were dropped
+            size_t Purge();
+            void Clear();
+
+            CollisionShapeCacheStats GetStats() const;
+
+            static uint64_t ComputeKey(const CollisionShape& desc);
+            static bool IsSameShape(const CollisionShape& a, const CollisionShape& b);
+
+        private:
+            friend class CollisionShapeFactory;
+            void RecordBvh(bool loaded) { ++(loaded ? m_stats.bvhLoads : m_stats.bvhBuilds); }
+
+            struct Entry {
+                CollisionShape desc;
+                std::shared_ptr<btCollisionShape> shape;
+                size_t memoryBytes = 0; // Excludes shapes it shares with other entries
+            };
+
+            std::unordered_map<uint64_t, Entry> m_entries;
+            std::string m_bvhDirectory;
+            CollisionShapeCacheStats m_stats;
+        };
+    }
+}
+
+#endif // GAMEENGINE_HAS_BULLET
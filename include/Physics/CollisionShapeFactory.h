@@ -5,18 +5,35 @@
 #include "PhysicsEngine.h"
 #include <btBulletDynamicsCommon.h>
 #include <memory>
+#include <string>
 
 namespace GameEngine {
     namespace Physics {
+        class CollisionShapeCache;
+
         class CollisionShapeFactory {
         public:
-            // Main factory method to create Bullet collision shapes from engine CollisionShape
-            static std::unique_ptr<btCollisionShape> CreateShape(const CollisionShape& desc);
+            // Main factory method to create Bullet collision shapes from engine CollisionShape. Shapes
+            // built on other shapes (scaled meshes, compound children) take them from the cache when
+            // one is given, and mesh BVHs then go through its directory.
+            static std::shared_ptr<btCollisionShape> CreateShape(const CollisionShape& desc, CollisionShapeCache* cache = nullptr);
 
             // Specific shape creation methods (public as per task requirements)
             static std::unique_ptr<btBoxShape> CreateBoxShape(const Math::Vec3& dimensions);
             static std::unique_ptr<btSphereShape> CreateSphereShape(float radius);
             static std::unique_ptr<btCapsuleShape> CreateCapsuleShape(float radius, float height);
+            static std::unique_ptr<btConvexHullShape> CreateConvexHullShape(const CollisionMeshData& mesh, uint32_t maxVertices,
+                                                                            const Math::Vec3& scale = Math::Vec3(1.0f));
+
+            // Unit-scale BVH triangle mesh. With a bvhPath the BVH is loaded from that file when it
+            // was cooked from the same mesh, otherwise built and written there.
+            static std::shared_ptr<btBvhTriangleMeshShape> CreateTriangleMeshShape(const std::shared_ptr<const CollisionMeshData>& mesh,
+                                                                                   const std::string& bvhPath = "",
+                                                                                   bool* loadedFromDisk = nullptr);
+
+            // Approximate memory owned by a shape, BVH included; triangle data is shared through
+            // CollisionMeshData and not counted
+            static size_t EstimateMemoryUsage(const btCollisionShape& shape, bool includeChildren = true);
 
         private:
             // Helper method to validate shape parameters
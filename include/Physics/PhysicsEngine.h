@@ -1,8 +1,12 @@
 #pragma once
 
 #include "../../engine/core/Math.h"
+#include "Physics/CollisionMeshData.h"
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <span>
+#include <string>
 #include <unordered_map>
 
 #ifdef GAMEENGINE_HAS_BULLET
@@ -11,9 +15,12 @@
 #endif
 
 namespace GameEngine {
+    class JobSystem;
+
     namespace Physics {
         class IPhysicsDebugDrawer;
         class BulletDebugDrawer;
+        class CollisionShapeCache;
         enum class PhysicsDebugMode;
     }
 }
@@ -32,6 +39,10 @@ namespace GameEngine {
         float angularDamping = 0.0f;             ///< Default angular damping for rigid bodies
         float contactBreakingThreshold = 0.02f;  ///< Contact breaking threshold
         float contactProcessingThreshold = 0.01f; ///< Contact processing threshold
+        int queryThreads = 0;                    ///< Threads for batched queries (0 = one per core)
+        bool shareCollisionShapes = true;        ///< Bodies with identical shape descriptors share one shape
+        std::string collisionCacheDirectory;     ///< Where cooked mesh BVHs are stored (empty = not stored)
+        bool multithreadedSimulation = false;    ///< Parallel narrowphase and island solving on the engine JobSystem (read when the world is created)
         
         /**
          * @brief Create default physics configuration
@@ -85,6 +96,55 @@ namespace GameEngine {
         float penetrationDepth = 0.0f;
     };
 
+    /**
+     * @brief Collision filtering for batched queries
+     *
+     * Uses Bullet's broadphase filter bits: dynamic bodies are in group 1 (default) and static
+     * bodies in group 2. A body is tested when (bodyGroup & filterMask) != 0 and
+     * (filterGroup & bodyMask) != 0, so static bodies, which do not collide with each other,
+     * are skipped by queries whose group includes bit 2.
+     */
+    struct QueryFilter {
+        int filterGroup = 1;        ///< Group the query belongs to
+        int filterMask = -1;        ///< Groups the query hits
+        uint32_t ignoreBodyId = 0;  ///< Body to skip, e.g. the caster's own; 0 = none
+    };
+
+    struct RaycastQuery {
+        Math::Vec3 origin{0.0f};
+        Math::Vec3 direction{0.0f, -1.0f, 0.0f}; ///< Need not be normalized
+        float maxDistance = 1.0f;
+        QueryFilter filter;
+    };
+
+    struct SweepQuery {
+        Math::Vec3 from{0.0f};
+        Math::Vec3 to{0.0f};
+        float radius = 0.5f;
+        float height = 0.0f;        ///< Capsule height between the sphere centres, 0 = sphere sweep
+        QueryFilter filter;
+    };
+
+    struct OverlapQuery {
+        Math::Vec3 center{0.0f};
+        float radius = 0.5f;
+        QueryFilter filter;
+    };
+
+    /**
+     * @brief Render transforms of moving bodies as parallel arrays
+     *
+     * Filled by PhysicsEngine::SyncTransforms: positions[i] and rotations[i] belong to bodyIds[i].
+     * Reuse one buffer across frames so the arrays keep their capacity.
+     */
+    struct TransformSyncBuffer {
+        std::vector<uint32_t> bodyIds;
+        std::vector<Math::Vec3> positions;
+        std::vector<Math::Quat> rotations;
+
+        size_t Size() const { return bodyIds.size(); }
+    };
+
     struct RigidBody {
         Math::Vec3 position{0.0f};
         Math::Quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
@@ -102,10 +162,33 @@ namespace GameEngine {
             Box,
             Sphere,
             Capsule,
-            Mesh
+            Mesh,        // Static BVH triangle mesh; bodies using it are always static
+            ConvexHull,
+            Compound
         } type = Box;
         
-        Math::Vec3 dimensions{1.0f}; // For box: width, height, depth; For sphere: radius, 0, 0
+        Math::Vec3 dimensions{1.0f}; // For box: width, height, depth; For sphere: radius, 0, 0; For mesh and hull: scale
+
+        std::shared_ptr<const CollisionMeshData> mesh;  // Mesh and ConvexHull
+        uint32_t maxHullVertices = 32;                  // ConvexHull vertex budget after simplification, 0 = keep all
+
+        struct Child;
+        std::vector<Child> children;                    // Compound; the compound's dimensions are unused
+    };
+
+    struct CollisionShape::Child {
+        CollisionShape shape;
+        Math::Vec3 position{0.0f};
+        Math::Quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
+    };
+
+    struct CollisionShapeCacheStats {
+        size_t shapeCount = 0;        ///< Distinct shapes held by the cache
+        size_t hits = 0;              ///< Requests served by an existing shape
+        size_t misses = 0;            ///< Requests that created a shape
+        size_t bvhLoads = 0;          ///< Mesh BVHs read from the collision cache directory
+        size_t bvhBuilds = 0;         ///< Mesh BVHs built from triangles
+        size_t memoryBytes = 0;       ///< Estimated memory of the cached shapes, BVHs included
     };
 
     class PhysicsWorld;
@@ -133,6 +216,7 @@ namespace GameEngine {
         std::shared_ptr<PhysicsWorld> CreateWorld(const Math::Vec3& gravity = Math::Vec3(0.0f, -9.81f, 0.0f));
         std::shared_ptr<PhysicsWorld> CreateWorld(const PhysicsConfiguration& config);
         void SetActiveWorld(std::shared_ptr<PhysicsWorld> world);
+        int GetSimulationThreadCount() const; // 1 unless the active world was built multithreaded
 
         // Rigid body management
         uint32_t CreateRigidBody(const RigidBody& bodyDesc, const CollisionShape& shape);
@@ -144,11 +228,39 @@ namespace GameEngine {
         void SetLinearDamping(uint32_t bodyId, float damping);
         void SetAngularDamping(uint32_t bodyId, float damping);
 
+        // Shape sharing (see PhysicsConfiguration::shareCollisionShapes); cached shapes stay alive
+        // until purged, even after their last body is destroyed
+        CollisionShapeCacheStats GetShapeCacheStats() const;
+        size_t PurgeShapeCache(); // Drops shapes no body uses, returns how many
+
         // Rigid body queries
         bool GetRigidBodyTransform(uint32_t bodyId, Math::Vec3& position, Math::Quat& rotation);
         bool GetRigidBodyVelocity(uint32_t bodyId, Math::Vec3& velocity, Math::Vec3& angularVelocity);
         bool IsRigidBodyGrounded(uint32_t bodyId, float groundCheckDistance = 0.1f);
 
+        // Fixed-step clock: Update runs whole timeStep steps (at most maxSubSteps, dropping any
+        // further backlog) and carries the remainder; alpha is that remainder over timeStep
+        float GetInterpolationAlpha() const { return m_interpolationAlpha; }
+        uint64_t GetStepCount() const { return m_stepCount; }
+
+        // Transform between the last two steps at the current alpha, for rendering; static
+        // bodies report their pose. GetRigidBodyTransform keeps returning the simulated state.
+        bool GetInterpolatedTransform(uint32_t bodyId, Math::Vec3& position, Math::Quat& rotation) const;
+        // Same, for callers polling one body every frame: slotHint caches the body's dense slot
+        // (start it at INVALID_MOTION_SLOT) and is refreshed by a lookup only when it has gone stale
+        static constexpr uint32_t INVALID_MOTION_SLOT = ~0u;
+        bool GetInterpolatedTransform(uint32_t bodyId, uint32_t& slotHint, Math::Vec3& position, Math::Quat& rotation) const;
+
+        /**
+         * @brief Writes interpolated transforms of dynamic and kinematic bodies into buffer
+         *
+         * With movedOnly, only bodies whose render transform changed since the previous call are
+         * written (sleeping bodies drop out once their final pose has been synced), so callers
+         * apply the buffer as a delta. Reads dense internal arrays, with no per-body lookups.
+         * @return Number of bodies written
+         */
+        size_t SyncTransforms(TransformSyncBuffer& buffer, bool movedOnly = true);
+
         // Queries
         RaycastHit Raycast(const Math::Vec3& origin, const Math::Vec3& direction, float maxDistance);
         std::vector<OverlapResult> OverlapSphere(const Math::Vec3& center, float radius);
@@ -164,6 +276,31 @@ namespace GameEngine {
         };
         
         SweepHit SweepCapsule(const Math::Vec3& from, const Math::Vec3& to, float radius, float height);
+
+        /**
+         * @brief Batched queries for callers issuing thousands per frame (AI sight lines, foot IK)
+         *
+         * results[i] answers queries[i]. The batch is split across worker threads that walk the
+         * broadphase tree with their own stacks, so nothing is allocated or logged per query once
+         * the per-thread scratch has grown. Queries read the world as left by the last Update and
+         * must not overlap it, or any body creation, removal or transform change. Only rigid
+         * bodies are reported. Returns false, leaving results untouched, when the buffers are too
+         * small or there is no Bullet world.
+         */
+        bool RaycastBatch(std::span<const RaycastQuery> queries, std::span<RaycastHit> results);
+        bool SweepBatch(std::span<const SweepQuery> queries, std::span<SweepHit> results);
+
+        /**
+         * Query i stores up to maxResultsPerQuery overlaps (deepest contact per body) starting at
+         * results[i * maxResultsPerQuery] and sets counts[i] to the number of bodies found, which
+         * may exceed what was stored.
+         */
+        bool OverlapBatch(std::span<const OverlapQuery> queries, std::span<OverlapResult> results,
+                          std::span<uint32_t> counts, uint32_t maxResultsPerQuery);
+
+        // Workers for batched queries and the multithreaded world; set before Initialize so the
+        // default world gets them. Queries use short-lived threads without one
+        void SetJobSystem(JobSystem* jobSystem) { m_jobSystem = jobSystem; }
         
         // Ghost object management for kinematic collision detection
         uint32_t CreateGhostObject(const CollisionShape& shape, const Math::Vec3& position);
@@ -201,6 +338,14 @@ namespace GameEngine {
         std::shared_ptr<Physics::IPhysicsDebugDrawer> m_debugDrawer;
         Physics::PhysicsDebugMode m_debugMode;
         bool m_debugDrawingEnabled = false;
+
+        JobSystem* m_jobSystem = nullptr;
+
+        // Fixed-step clock
+        double m_timeAccumulator = 0.0;
+        float m_interpolationAlpha = 0.0f;
+        uint64_t m_stepCount = 0;
+        uint64_t m_lastSyncStep = 0;
         
 #ifdef GAMEENGINE_HAS_BULLET
         // Mapping from body ID to Bullet rigid body for direct access
@@ -209,6 +354,40 @@ namespace GameEngine {
         std::unordered_map<uint32_t, btGhostObject*> m_bulletGhostObjects;
         // Bullet debug drawer
         std::unique_ptr<Physics::BulletDebugDrawer> m_bulletDebugDrawer;
+        // Shapes are shared between bodies, so each body and ghost object holds a reference
+        std::unordered_map<uint32_t, std::shared_ptr<btCollisionShape>> m_objectShapes;
+        std::unique_ptr<Physics::CollisionShapeCache> m_shapeCache;
+        std::shared_ptr<btCollisionShape> AcquireShape(const CollisionShape& shape);
+
+        // Dense state of every non-static body for interpolation and bulk sync. The transform
+        // arrays run parallel to m_motionBodies; m_motionSlots maps body IDs to their index.
+        struct BodyMotion {
+            btRigidBody* body = nullptr;
+            uint32_t bodyId = 0;
+            uint64_t lastMovedStep = 0;
+            bool active = false;
+        };
+        std::vector<BodyMotion> m_motionBodies;
+        std::vector<Math::Vec3> m_previousPositions;
+        std::vector<Math::Vec3> m_currentPositions;
+        std::vector<Math::Quat> m_previousRotations;
+        std::vector<Math::Quat> m_currentRotations;
+        std::unordered_map<uint32_t, uint32_t> m_motionSlots;
+        void AddMotionSlot(uint32_t bodyId, btRigidBody* body);
+        void RemoveMotionSlot(uint32_t bodyId);
+        void CapturePreviousTransforms(bool readWorld);
+        void CaptureCurrentTransforms();
+        // Forces applied since the last Update; Bullet clears forces after every step, so they
+        // are applied again before each further step of the same Update
+        std::unordered_map<uint32_t, btVector3> m_frameForces;
+
+        // Scratch for batched queries, one per chunk. Batches take contexts out of the pool and
+        // return them when done, so batches issued from several threads never share one
+        struct QueryContext;
+        std::mutex m_queryContextMutex;
+        std::vector<std::unique_ptr<QueryContext>> m_queryContexts;
+        template <typename Body>
+        void RunQueryChunks(size_t count, const Body& body);
 #endif
     };
 
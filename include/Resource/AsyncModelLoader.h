@@ -3,46 +3,29 @@
 #include "Resource/ModelLoader.h"
 #include "Graphics/Model.h"
 #include <future>
-#include <thread>
-#include <queue>
 #include <mutex>
 #include <condition_variable>
 #include <atomic>
+#include <array>
+#include <chrono>
 #include <functional>
+#include <set>
 #include <unordered_map>
 #include <memory>
-#include <type_traits>
 
 namespace GameEngine {
 
-    /**
-     * @brief Thread pool for managing worker threads
-     */
-    class ThreadPool {
-    public:
-        ThreadPool(size_t numThreads = std::thread::hardware_concurrency());
-        ~ThreadPool();
-
-        // Add task to the queue
-        template<typename F, typename... Args>
-        auto Enqueue(F&& f, Args&&... args) -> std::future<typename std::invoke_result<F, Args...>::type>;
-
-        // Get number of active threads
-        size_t GetThreadCount() const { return m_workers.size(); }
-
-        // Stop all threads
-        void Stop();
-
-    private:
-        std::vector<std::thread> m_workers;
-        std::queue<std::function<void()>> m_tasks;
-        std::mutex m_queueMutex;
-        std::condition_variable m_condition;
-        std::atomic<bool> m_stop{false};
-    };
+    class JobSystem;
+    class JobGroup;
 
     /**
      * @brief Asynchronous model loading system with progress tracking and cancellation
+     *
+     * Loads are scheduled by priority with aging: a queued task gains one priority level per
+     * aging interval, so background work still runs under a steady stream of critical loads.
+     * Dependencies form a DAG; a task is released only when every file it depends on has
+     * loaded, and fails if one of them fails. At most GetMaxConcurrentLoads() tasks run at once,
+     * each as a background job on the engine job system.
      */
     class AsyncModelLoader {
     public:
@@ -62,6 +45,16 @@ namespace GameEngine {
             Critical = 3
         };
 
+        /**
+         * @brief Scheduling state of a load task
+         */
+        enum class TaskState {
+            Waiting,    // Blocked on dependencies
+            Ready,      // Queued, runs when a load slot frees up
+            Running,
+            Finished
+        };
+
         /**
          * @brief Load task information
          */
@@ -77,10 +70,28 @@ namespace GameEngine {
             std::vector<std::string> dependencies; // Files that must be loaded first
             size_t estimatedMemoryUsage = 0; // Estimated memory usage in bytes
             
+            // Scheduler bookkeeping, guarded by the loader's queue mutex
+            TaskState state = TaskState::Waiting;
+            size_t pendingDependencies = 0;
+            std::vector<std::shared_ptr<LoadTask>> dependents; // Released when this task loads
+            uint64_t sequence = 0; // Submission order, breaks priority ties
+            int64_t schedulingRank = 0; // Priority plus aging credit; higher runs first
+            std::chrono::steady_clock::time_point dispatchTime;
+            
             LoadTask(const std::string& path, ModelLoader::LoadingFlags loadFlags, TaskPriority prio = TaskPriority::Normal)
                 : filepath(path), flags(loadFlags), startTime(std::chrono::steady_clock::now()), priority(prio) {}
         };
 
+        /**
+         * @brief Latency of completed loads in one priority class
+         */
+        struct PriorityLatencyStats {
+            uint32_t completedLoads = 0;
+            float averageQueueTimeMs = 0.0f;   // Submission to start of loading
+            float averageLatencyMs = 0.0f;     // Submission to model available
+            float maxLatencyMs = 0.0f;
+        };
+
         /**
          * @brief Loading statistics
          */
@@ -95,6 +106,7 @@ namespace GameEngine {
             size_t totalMemoryLoaded = 0;
             size_t currentMemoryUsage = 0;
             size_t peakMemoryUsage = 0;
+            std::array<PriorityLatencyStats, 4> latencyByPriority; // Indexed by TaskPriority
         };
 
     public:
@@ -102,15 +114,19 @@ namespace GameEngine {
         AsyncModelLoader();
         ~AsyncModelLoader();
 
-        bool Initialize(uint32_t workerThreadCount = 0);
+        bool Initialize();
         void Shutdown();
         bool IsInitialized() const { return m_initialized; }
+        
+        // Loads run as background jobs on this job system; without one they run on the calling thread
+        void SetJobSystem(JobSystem* jobSystem);
 
         // Asynchronous loading
         std::future<std::shared_ptr<Model>> LoadModelAsync(const std::string& filepath);
         std::future<std::shared_ptr<Model>> LoadModelAsync(const std::string& filepath, ModelLoader::LoadingFlags flags);
         std::future<std::shared_ptr<Model>> LoadModelAsync(const std::string& filepath, ModelLoader::LoadingFlags flags, TaskPriority priority);
         std::future<std::shared_ptr<Model>> LoadModelAsync(const std::string& filepath, ModelLoader::LoadingFlags flags, TaskPriority priority, const std::vector<std::string>& dependencies);
+        // The loads start immediately; the batch future collects their results when it is read
         std::future<std::vector<std::shared_ptr<Model>>> LoadModelsAsync(const std::vector<std::string>& filepaths);
         std::future<std::vector<std::shared_ptr<Model>>> LoadModelsAsync(const std::vector<std::string>& filepaths, ModelLoader::LoadingFlags flags);
         std::future<std::vector<std::shared_ptr<Model>>> LoadModelsAsync(const std::vector<std::string>& filepaths, ModelLoader::LoadingFlags flags, TaskPriority priority);
@@ -123,14 +139,14 @@ namespace GameEngine {
         bool IsLoading(const std::string& filepath) const;
 
         // Load management
-        bool CancelLoad(const std::string& filepath);
+        bool CancelLoad(const std::string& filepath); // Queued tasks (and their dependents) fail immediately
         void CancelAllLoads();
+        bool SetLoadPriority(const std::string& filepath, TaskPriority priority); // Queued or waiting tasks only
         void WaitForAllLoads();
         void SetMaxConcurrentLoads(uint32_t maxLoads);
         uint32_t GetMaxConcurrentLoads() const { return m_maxConcurrentLoads; }
 
-        // Thread management
-        void SetWorkerThreadCount(uint32_t count);
+        // Workers of the job system the loads run on
         uint32_t GetWorkerThreadCount() const;
 
         // Configuration
@@ -140,9 +156,12 @@ namespace GameEngine {
         size_t GetMemoryLimit() const { return m_maxMemoryUsage; }
         void SetDefaultPriority(TaskPriority priority);
         TaskPriority GetDefaultPriority() const { return m_defaultPriority; }
+        void SetPriorityAgingInterval(std::chrono::milliseconds interval); // Zero disables aging
+        std::chrono::milliseconds GetPriorityAgingInterval() const { return m_priorityAgingInterval; }
 
         // Statistics and debugging
         LoadingStats GetLoadingStats() const;
+        PriorityLatencyStats GetLatencyStats(TaskPriority priority) const;
         void ResetStats();
         void SetVerboseLogging(bool enabled) { m_verboseLogging = enabled; }
 
@@ -156,12 +175,28 @@ namespace GameEngine {
         void ProcessTaskQueue();
 
     private:
-        std::unique_ptr<ThreadPool> m_threadPool;
+        JobSystem* m_jobSystem = nullptr;
+        std::unique_ptr<JobGroup> m_loadJobs; // Load jobs still running, joined on shutdown
         std::unique_ptr<ModelLoader> m_modelLoader;
         
+        // Orders ready tasks by rank (highest first), then submission order
+        struct ReadyTaskOrder {
+            bool operator()(const std::shared_ptr<LoadTask>& a, const std::shared_ptr<LoadTask>& b) const {
+                if (a->schedulingRank != b->schedulingRank) {
+                    return a->schedulingRank > b->schedulingRank;
+                }
+                return a->sequence < b->sequence;
+            }
+        };
+
         // Task management
-        std::unordered_map<std::string, std::shared_ptr<LoadTask>> m_activeTasks;
-        std::queue<std::shared_ptr<LoadTask>> m_taskQueue; // Priority queue for pending tasks
+        std::unordered_map<std::string, std::shared_ptr<LoadTask>> m_activeTasks; // Running tasks
+        std::unordered_map<std::string, std::shared_ptr<LoadTask>> m_scheduledTasks; // Waiting, ready and running
+        std::set<std::shared_ptr<LoadTask>, ReadyTaskOrder> m_taskQueue; // Ready tasks, best first
+        uint32_t m_runningLoads = 0;
+        uint32_t m_unfinishedTasks = 0; // Scheduled tasks whose promise is not set yet
+        uint64_t m_nextSequence = 0;
+        std::condition_variable m_idleCondition; // Signalled when m_scheduledTasks drains
         std::unordered_map<std::string, std::shared_ptr<Model>> m_loadedModels; // Cache of loaded models
         mutable std::mutex m_tasksMutex;
         mutable std::mutex m_queueMutex;
@@ -172,6 +207,7 @@ namespace GameEngine {
         size_t m_maxMemoryUsage = 1024 * 1024 * 1024; // 1GB default
         ModelLoader::LoadingFlags m_defaultFlags = ModelLoader::LoadingFlags::None;
         TaskPriority m_defaultPriority = TaskPriority::Normal;
+        std::chrono::milliseconds m_priorityAgingInterval{1000}; // One priority level per interval queued
         bool m_verboseLogging = false;
         bool m_initialized = false;
 
@@ -183,6 +219,8 @@ namespace GameEngine {
         mutable LoadingStats m_stats;
         mutable std::mutex m_statsMutex;
         std::vector<float> m_loadTimes; // For calculating average
+        std::array<double, 4> m_queueTimeTotals{}; // Per priority, for the latency averages
+        std::array<double, 4> m_latencyTotals{};
         std::atomic<size_t> m_currentMemoryUsage{0};
         std::atomic<size_t> m_peakMemoryUsage{0};
 
@@ -192,15 +230,18 @@ namespace GameEngine {
         void UpdateStats(bool completed, bool cancelled, bool failed, float loadTimeMs, size_t memoryUsed);
         void LogTaskStart(const std::string& filepath);
         void LogTaskComplete(const std::string& filepath, bool success, float timeMs);
-        bool CanStartNewLoad() const;
-        void WaitForLoadSlot();
+        void RecordLatency(const LoadTask& task);
         std::shared_ptr<Model> LoadModelInternal(const std::string& filepath, ModelLoader::LoadingFlags flags, std::shared_ptr<LoadTask> task);
         
-        // Queue and dependency management
-        void QueueTask(std::shared_ptr<LoadTask> task);
-        std::shared_ptr<LoadTask> GetNextQueuedTask();
-        bool AreDependenciesResolved(const std::shared_ptr<LoadTask>& task) const;
-        void SortTaskQueue(); // Sort by priority
+        // Queue and dependency management (the Locked helpers expect m_queueMutex held)
+        using FailedTask = std::pair<std::shared_ptr<LoadTask>, std::string>;
+        void ScheduleTaskLocked(const std::shared_ptr<LoadTask>& task);
+        void QueueTaskLocked(const std::shared_ptr<LoadTask>& task);
+        void RaisePriorityLocked(const std::shared_ptr<LoadTask>& task, TaskPriority priority);
+        void RemoveTaskLocked(const std::shared_ptr<LoadTask>& task, const std::string& reason, std::vector<FailedTask>& removed);
+        int64_t CalculateSchedulingRank(const LoadTask& task) const;
+        void CompleteTask(const std::shared_ptr<LoadTask>& task, std::shared_ptr<Model> model, std::exception_ptr error);
+        void FailTasks(const std::vector<FailedTask>& tasks);
         
         // Memory management
         void UpdateMemoryUsage(size_t memoryDelta, bool increase);
@@ -208,28 +249,4 @@ namespace GameEngine {
         size_t EstimateModelMemoryUsage(const std::string& filepath) const;
     };
 
-    // Template implementation for ThreadPool::Enqueue
-    template<typename F, typename... Args>
-    auto ThreadPool::Enqueue(F&& f, Args&&... args) -> std::future<typename std::invoke_result<F, Args...>::type> {
-        using return_type = typename std::invoke_result<F, Args...>::type;
-
-        auto task = std::make_shared<std::packaged_task<return_type()>>(
-            std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-        );
-
-        std::future<return_type> result = task->get_future();
-        
-        {
-            std::unique_lock<std::mutex> lock(m_queueMutex);
-            
-            if (m_stop) {
-                throw std::runtime_error("ThreadPool is stopped");
-            }
-            
-            m_tasks.emplace([task]() { (*task)(); });
-        }
-        
-        m_condition.notify_one();
-        return result;
-    }
 }
\ No newline at end of file
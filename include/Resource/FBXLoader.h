@@ -19,6 +19,8 @@
 
 namespace GameEngine {
 
+    class JobSystem;
+
     /**
      * @brief FBXLoader provides specialized FBX model loading capabilities
      * 
@@ -66,6 +68,7 @@ namespace GameEngine {
             bool generateMissingNormals = true;      // Generate normals if missing
             bool generateTangents = true;            // Generate tangent vectors
             float importScale = 1.0f;                // Scale factor for import
+            bool parallelMeshProcessing = true;      // Convert meshes and resolve materials on several threads
             std::vector<std::string> textureSearchPaths; // Additional texture search paths
         };
 
@@ -85,6 +88,7 @@ namespace GameEngine {
         // Configuration
         void SetLoadingConfig(const FBXLoadingConfig& config);
         FBXLoadingConfig GetLoadingConfig() const { return m_config; }
+        void SetJobSystem(JobSystem* jobSystem) { m_jobSystem = jobSystem; } // Optional worker pool for parallel import
 
         // Utility methods
         static bool IsFBXFile(const std::string& filepath);
@@ -94,11 +98,34 @@ namespace GameEngine {
 #ifdef GAMEENGINE_HAS_ASSIMP
         std::unique_ptr<Assimp::Importer> m_importer;
         
+        // A texture referenced by a material; resolved on a worker, loaded on the importing thread
+        struct TextureBinding {
+            std::string uniformName;
+            std::string texturePath;
+            std::string resolvedPath;
+        };
+        
+        // Vertex and index data of one aiMesh, converted and optimized on a worker; the Mesh,
+        // which uploads to the GPU, is created on the importing thread
+        struct MeshData {
+            std::string name;
+            std::vector<Vertex> vertices;
+            std::vector<uint32_t> indices;
+            BoundingBox boundingBox;
+            BoundingSphere boundingSphere;
+            uint32_t materialIndex = 0;
+            bool hasNormals = false;
+            bool hasTangents = false;
+            bool converted = false;
+        };
+        
         // Internal processing methods
         FBXLoadResult ProcessFBXScene(const aiScene* scene, const std::string& filepath);
-        std::shared_ptr<Mesh> ProcessFBXMesh(const aiMesh* mesh, const aiScene* scene);
+        bool ConvertFBXMesh(const aiMesh* mesh, MeshData& data);
+        void PrepareFBXMesh(MeshData& data) const;
+        std::shared_ptr<Mesh> CreateFBXMesh(MeshData& data);
         std::vector<std::shared_ptr<Material>> ProcessFBXMaterials(const aiScene* scene, const std::string& filepath);
-        std::shared_ptr<Material> ProcessFBXMaterial(const aiMaterial* aiMat, const std::string& filepath);
+        std::shared_ptr<Material> ProcessFBXMaterial(const aiMaterial* aiMat, const std::string& filepath, std::vector<TextureBinding>& textures);
         
         // Animation and rigging processing
         std::shared_ptr<Graphics::RenderSkeleton> ProcessFBXSkeleton(const aiScene* scene);
@@ -110,10 +137,10 @@ namespace GameEngine {
         // FBX-specific processing
         void ApplyCoordinateSystemConversion(std::vector<Vertex>& vertices) const;
         Math::Mat4 GetFBXToOpenGLTransform() const;
-        void ProcessFBXNode(const aiNode* node, const aiScene* scene, std::vector<std::shared_ptr<Mesh>>& meshes);
+        void CollectFBXNodeMeshes(const aiNode* node, const aiScene* scene, std::vector<const aiMesh*>& meshes) const;
         
         // Material processing
-        std::shared_ptr<Texture> LoadFBXTexture(const std::string& texturePath, const std::string& modelPath);
+        std::shared_ptr<Texture> LoadFBXTexture(const std::string& texturePath, const std::string& resolvedPath);
         std::string FindTexturePath(const std::string& texturePath, const std::string& modelPath) const;
         Math::Vec3 ConvertFBXColor(const aiColor3D& color) const;
         
@@ -130,6 +157,7 @@ namespace GameEngine {
         // Configuration
         FBXLoadingConfig m_config;
         bool m_initialized = false;
+        JobSystem* m_jobSystem = nullptr;
         
         // Texture cache for shared textures
         std::unordered_map<std::string, std::shared_ptr<Texture>> m_textureCache;
@@ -6,8 +6,10 @@
 #include "Graphics/GraphicsAnimation.h"
 #include "Graphics/RenderSkeleton.h"
 #include "Animation/MorphTarget.h"
+#include "Resource/MappedFile.h"
 #include "Core/Math.h"
 #include <nlohmann/json.hpp>
+#include <chrono>
 #include <string>
 #include <vector>
 #include <memory>
@@ -49,11 +51,32 @@ namespace GameEngine {
          */
         struct AccessorInfo {
             uint32_t bufferView = 0;
+            bool hasBufferView = false;     // Without one the base values are zero (sparse-only accessor)
             uint32_t byteOffset = 0;
             uint32_t componentType = 0;
             uint32_t count = 0;
             std::string type;
             bool normalized = false;
+            
+            // Sparse substitution: sparseCount (index, value) pairs replacing base elements
+            uint32_t sparseCount = 0;
+            uint32_t sparseIndicesBufferView = 0;
+            uint32_t sparseIndicesByteOffset = 0;
+            uint32_t sparseIndicesComponentType = 0;
+            uint32_t sparseValuesBufferView = 0;
+            uint32_t sparseValuesByteOffset = 0;
+        };
+
+        /**
+         * @brief Typed strided view over an accessor's elements inside a buffer
+         */
+        struct AccessorView {
+            const uint8_t* data = nullptr;  // First element; nullptr when there is no buffer view
+            size_t stride = 0;              // Bytes between elements
+            uint32_t count = 0;
+            uint32_t componentType = 0;
+            uint32_t componentCount = 0;
+            bool normalized = false;
         };
 
         /**
@@ -71,9 +94,13 @@ namespace GameEngine {
          * @brief GLTF buffer information
          */
         struct BufferInfo {
-            std::vector<uint8_t> data;
+            std::vector<uint8_t> data;          // Owned bytes (external .bin or data URI)
+            const uint8_t* view = nullptr;      // Or the GLB binary chunk, referenced in place
             uint32_t byteLength = 0;
             std::string uri;
+            
+            const uint8_t* GetData() const { return view ? view : data.data(); }
+            size_t GetSize() const { return view ? byteLength : data.size(); }
         };
 
     public:
@@ -83,15 +110,25 @@ namespace GameEngine {
         // Main loading interface
         LoadResult LoadGLTF(const std::string& filepath);
         LoadResult LoadGLTFFromMemory(const std::vector<uint8_t>& data, const std::string& baseDir = "");
+        // Loads from caller-owned bytes such as a MappedFile; GLB vertex data is decoded in place,
+        // so the memory only has to stay valid for the duration of the call
+        LoadResult LoadGLTFFromMemory(const uint8_t* data, size_t size, const std::string& baseDir = "");
 
         // Format detection
         static bool IsGLTFFile(const std::string& filepath);
         static bool IsGLBFile(const std::string& filepath);
 
+        // Store mesh vertices packed with only the attributes each primitive provides
+        void SetCompactVertices(bool enabled, const VertexFormatOptions& options = VertexFormatOptions());
+        bool IsCompactVerticesEnabled() const { return m_compactVertices; }
+
     private:
         // JSON document and base directory for relative paths
         nlohmann::json m_gltfJson;
         std::string m_baseDirectory;
+        MappedFile m_mappedFile;    // Open only while a .glb is being loaded
+        bool m_compactVertices = false;
+        VertexFormatOptions m_vertexFormatOptions;
         
         // Parsed GLTF data
         std::vector<BufferInfo> m_buffers;
@@ -110,7 +147,11 @@ namespace GameEngine {
         
         // GLB binary format parsing
         bool ParseGLBHeader(const std::vector<uint8_t>& data, uint32_t& jsonLength, uint32_t& binaryLength);
-        bool ExtractGLBChunks(const std::vector<uint8_t>& data, std::string& jsonChunk, std::vector<uint8_t>& binaryChunk);
+        bool ExtractGLBChunks(const uint8_t* data, size_t size, const char*& jsonChunk, size_t& jsonLength,
+                              const uint8_t*& binaryChunk, size_t& binaryLength);
+        bool ParseDocument(const uint8_t* data, size_t size, std::string& errorMessage);
+        LoadResult FinishLoad(std::chrono::high_resolution_clock::time_point startTime);
+        void ClearParsedData();
         
         // GLTF component parsing
         bool ParseBuffers();
@@ -149,6 +190,15 @@ namespace GameEngine {
         std::shared_ptr<MorphTargetSet> ParseMorphTargets(const nlohmann::json& targetsJson);
         
         // Accessor data extraction
+        bool GetAccessorView(uint32_t accessorIndex, AccessorView& view);
+        bool GetBufferViewData(uint32_t bufferViewIndex, uint64_t byteOffset, uint64_t elementSize, uint32_t count,
+                               const uint8_t*& data, size_t& stride);
+        // Decodes an accessor (any component type, normalized, sparse) as floats straight into
+        // destination storage, e.g. one Vertex field with destinationStride = sizeof(Vertex)
+        bool DecodeAccessor(uint32_t accessorIndex, float* destination, size_t destinationStride,
+                            uint32_t destinationComponents, uint32_t expectedCount);
+        bool DecodeIndices(uint32_t accessorIndex, std::vector<uint32_t>& indices);
+        
         template<typename T>
         std::vector<T> GetAccessorData(uint32_t accessorIndex);
         
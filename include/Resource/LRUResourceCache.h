@@ -6,11 +6,20 @@
 #include <string>
 #include <chrono>
 #include <mutex>
+#include <vector>
+#include <functional>
+#include <algorithm>
 
 namespace GameEngine {
 
     class Resource;
 
+    // How a full cache picks its victim
+    enum class CacheEvictionPolicy {
+        LRU,    // Exact LRU: every hit moves the entry to the front
+        Clock   // Second chance: a hit only sets a reference bit, so lookups never reorder the list
+    };
+
     // LRU (Least Recently Used) cache for automatic resource cleanup
     template<typename T>
     class LRUResourceCache {
@@ -19,7 +28,9 @@ namespace GameEngine {
             std::shared_ptr<T> resource;
             std::chrono::steady_clock::time_point lastAccess;
             size_t accessCount = 0;
+            size_t memoryUsage = 0; // Size counted in the cache total; refreshed by UpdateMemoryUsage
             bool isPinned = false; // Pinned resources are never evicted
+            bool referenced = false; // Clock policy: hit since the clock hand last passed
             
             CacheEntry(std::shared_ptr<T> res) 
                 : resource(res), lastAccess(std::chrono::steady_clock::now()) {}
@@ -28,7 +39,8 @@ namespace GameEngine {
         using CacheIterator = typename std::list<std::pair<std::string, CacheEntry>>::iterator;
 
     public:
-        LRUResourceCache(size_t maxSize = 100, size_t maxMemory = 256 * 1024 * 1024);
+        LRUResourceCache(size_t maxSize = 100, size_t maxMemory = 256 * 1024 * 1024,
+                         CacheEvictionPolicy policy = CacheEvictionPolicy::LRU);
         ~LRUResourceCache();
 
         // Cache operations
@@ -38,21 +50,29 @@ namespace GameEngine {
         void Clear();
         
         // Cache management
-        void SetMaxSize(size_t maxSize) { m_maxSize = maxSize; }
-        void SetMaxMemory(size_t maxMemory) { m_maxMemory = maxMemory; }
+        void SetMaxSize(size_t maxSize);
+        void SetMaxMemory(size_t maxMemory);
+        void SetEvictionPolicy(CacheEvictionPolicy policy);
+        CacheEvictionPolicy GetEvictionPolicy() const;
         void EvictLRU(size_t count = 1);
         void EvictByMemory(size_t targetMemory);
         void EvictOlderThan(std::chrono::seconds maxAge);
         
+        // Re-reads a resource's size after it grew or shrank (e.g. streamed in more mips)
+        void UpdateMemoryUsage(const std::string& key);
+        
         // Pinning (prevents eviction)
         void Pin(const std::string& key);
         void Unpin(const std::string& key);
         bool IsPinned(const std::string& key) const;
         
         // Statistics
-        size_t GetSize() const { return m_cacheList.size(); }
-        size_t GetMemoryUsage() const;
+        size_t GetSize() const;
+        size_t GetMemoryUsage() const;  // Running total, O(1)
         float GetHitRatio() const;
+        size_t GetHitCount() const;
+        size_t GetMissCount() const;
+        size_t GetEvictionCount() const;
         void ResetStatistics();
         
         // Cache state
@@ -67,12 +87,15 @@ namespace GameEngine {
     private:
         mutable std::mutex m_cacheMutex;
         
-        // LRU implementation using list + hash map
+        // LRU implementation using list + hash map; front is the most recently used or inserted
         std::list<std::pair<std::string, CacheEntry>> m_cacheList;
         std::unordered_map<std::string, CacheIterator> m_cacheMap;
         
         size_t m_maxSize;
         size_t m_maxMemory;
+        size_t m_memoryUsage = 0;
+        CacheEvictionPolicy m_policy;
+        CacheIterator m_clockHand; // Next clock candidate; end() restarts at the back
         
         // Statistics
         mutable size_t m_hits = 0;
@@ -81,15 +104,76 @@ namespace GameEngine {
         
         // Internal methods
         void MoveToFront(CacheIterator it);
-        void EvictLRUInternal();
+        bool EvictLRUInternal();
+        CacheIterator SelectClockVictim();
+        void EraseEntry(CacheIterator it);
+        void EvictToLimits();
         bool ShouldEvict() const;
-        size_t CalculateMemoryUsage() const;
+        static size_t GetResourceMemoryUsage(const std::shared_ptr<T>& resource);
+    };
+
+    /**
+     * @brief N-way sharded LRUResourceCache
+     *
+     * Keys hash to one of N independently locked shards, so lookups from loader and render
+     * threads rarely contend. Each shard gets 1/N of the size and memory budget, which makes
+     * eviction order approximate across the cache as a whole. N is capped so every shard holds
+     * at least MIN_ENTRIES_PER_SHARD entries of the constructor's size budget (a 100-entry cache
+     * gets 2 shards, not 16 shards of 7); it does not change when the limits are set later.
+     */
+    template<typename T>
+    class ShardedLRUResourceCache {
+    public:
+        static constexpr size_t MIN_ENTRIES_PER_SHARD = 32;
+
+        // shardCount is an upper bound, rounded to a power of two
+        ShardedLRUResourceCache(size_t maxSize = 100, size_t maxMemory = 256 * 1024 * 1024, size_t shardCount = 16,
+                                CacheEvictionPolicy policy = CacheEvictionPolicy::LRU);
+
+        // Cache operations
+        std::shared_ptr<T> Get(const std::string& key) { return GetShard(key).Get(key); }
+        void Put(const std::string& key, std::shared_ptr<T> resource) { GetShard(key).Put(key, std::move(resource)); }
+        void Remove(const std::string& key) { GetShard(key).Remove(key); }
+        bool Contains(const std::string& key) const { return GetShard(key).Contains(key); }
+        void UpdateMemoryUsage(const std::string& key) { GetShard(key).UpdateMemoryUsage(key); }
+        void Clear();
+
+        // Cache management (limits are split evenly between shards)
+        void SetMaxSize(size_t maxSize);
+        void SetMaxMemory(size_t maxMemory);
+        void SetEvictionPolicy(CacheEvictionPolicy policy);
+        void EvictByMemory(size_t targetMemory);
+        void EvictOlderThan(std::chrono::seconds maxAge);
+
+        // Pinning (prevents eviction)
+        void Pin(const std::string& key) { GetShard(key).Pin(key); }
+        void Unpin(const std::string& key) { GetShard(key).Unpin(key); }
+        bool IsPinned(const std::string& key) const { return GetShard(key).IsPinned(key); }
+
+        // Statistics, summed over shards
+        size_t GetShardCount() const { return m_shards.size(); }
+        size_t GetSize() const;
+        size_t GetMemoryUsage() const;
+        float GetHitRatio() const;
+        size_t GetEvictionCount() const;
+        void ResetStatistics();
+
+    private:
+        LRUResourceCache<T>& GetShard(const std::string& key) const {
+            return *m_shards[std::hash<std::string>{}(key) & (m_shards.size() - 1)];
+        }
+
+        static size_t PerShard(size_t total, size_t shardCount) {
+            return total / shardCount + (total % shardCount != 0 ? 1 : 0);
+        }
+
+        std::vector<std::unique_ptr<LRUResourceCache<T>>> m_shards;    // Power-of-two count
     };
 
     // Template implementation
     template<typename T>
-    LRUResourceCache<T>::LRUResourceCache(size_t maxSize, size_t maxMemory)
-        : m_maxSize(maxSize), m_maxMemory(maxMemory) {
+    LRUResourceCache<T>::LRUResourceCache(size_t maxSize, size_t maxMemory, CacheEvictionPolicy policy)
+        : m_maxSize(maxSize), m_maxMemory(maxMemory), m_policy(policy), m_clockHand(m_cacheList.end()) {
     }
 
     template<typename T>
@@ -103,12 +187,16 @@ namespace GameEngine {
         
         auto mapIt = m_cacheMap.find(key);
         if (mapIt != m_cacheMap.end()) {
-            // Cache hit - move to front and update access info
+            // Cache hit - update access info; LRU moves the entry to the front, Clock only marks it
             auto listIt = mapIt->second;
             listIt->second.lastAccess = std::chrono::steady_clock::now();
             listIt->second.accessCount++;
             
-            MoveToFront(listIt);
+            if (m_policy == CacheEvictionPolicy::Clock) {
+                listIt->second.referenced = true;
+            } else {
+                MoveToFront(listIt);
+            }
             m_hits++;
             
             return listIt->second.resource;
@@ -125,6 +213,7 @@ namespace GameEngine {
             return;
         }
         
+        const size_t memoryUsage = GetResourceMemoryUsage(resource);
         std::lock_guard<std::mutex> lock(m_cacheMutex);
         
         // Check if key already exists
@@ -132,23 +221,29 @@ namespace GameEngine {
         if (mapIt != m_cacheMap.end()) {
             // Update existing entry
             auto listIt = mapIt->second;
+            m_memoryUsage = m_memoryUsage - listIt->second.memoryUsage + memoryUsage;
             listIt->second.resource = resource;
+            listIt->second.memoryUsage = memoryUsage;
             listIt->second.lastAccess = std::chrono::steady_clock::now();
             listIt->second.accessCount++;
+            listIt->second.referenced = true;
             
-            MoveToFront(listIt);
+            if (m_policy == CacheEvictionPolicy::LRU) {
+                MoveToFront(listIt);
+            }
+            EvictToLimits();
             return;
         }
         
         // Add new entry
         CacheEntry entry(resource);
+        entry.memoryUsage = memoryUsage;
         m_cacheList.emplace_front(key, std::move(entry));
         m_cacheMap[key] = m_cacheList.begin();
+        m_memoryUsage += memoryUsage;
         
         // Check if we need to evict
-        while (ShouldEvict()) {
-            EvictLRUInternal();
-        }
+        EvictToLimits();
     }
 
     template<typename T>
@@ -157,8 +252,7 @@ namespace GameEngine {
         
         auto mapIt = m_cacheMap.find(key);
         if (mapIt != m_cacheMap.end()) {
-            m_cacheList.erase(mapIt->second);
-            m_cacheMap.erase(mapIt);
+            EraseEntry(mapIt->second);
         }
     }
 
@@ -168,15 +262,43 @@ namespace GameEngine {
         
         m_cacheList.clear();
         m_cacheMap.clear();
-        ResetStatistics();
+        m_memoryUsage = 0;
+        m_clockHand = m_cacheList.end();
+        m_hits = 0;
+        m_misses = 0;
+        m_evictions = 0;
+    }
+
+    template<typename T>
+    void LRUResourceCache<T>::SetMaxSize(size_t maxSize) {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        m_maxSize = maxSize;
+    }
+
+    template<typename T>
+    void LRUResourceCache<T>::SetMaxMemory(size_t maxMemory) {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        m_maxMemory = maxMemory;
+    }
+
+    template<typename T>
+    void LRUResourceCache<T>::SetEvictionPolicy(CacheEvictionPolicy policy) {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        m_policy = policy;
+        m_clockHand = m_cacheList.end();
+    }
+
+    template<typename T>
+    CacheEvictionPolicy LRUResourceCache<T>::GetEvictionPolicy() const {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        return m_policy;
     }
 
     template<typename T>
     void LRUResourceCache<T>::EvictLRU(size_t count) {
         std::lock_guard<std::mutex> lock(m_cacheMutex);
         
-        for (size_t i = 0; i < count && !m_cacheList.empty(); ++i) {
-            EvictLRUInternal();
+        for (size_t i = 0; i < count && EvictLRUInternal(); ++i) {
         }
     }
 
@@ -184,17 +306,8 @@ namespace GameEngine {
     void LRUResourceCache<T>::EvictByMemory(size_t targetMemory) {
         std::lock_guard<std::mutex> lock(m_cacheMutex);
         
-        size_t currentMemory = CalculateMemoryUsage();
-        
-        while (currentMemory > targetMemory && !m_cacheList.empty()) {
-            size_t beforeMemory = currentMemory;
-            EvictLRUInternal();
-            currentMemory = CalculateMemoryUsage();
-            
-            // Prevent infinite loop if eviction doesn't reduce memory
-            if (currentMemory >= beforeMemory) {
-                break;
-            }
+        // Stops early if only pinned entries are left
+        while (m_memoryUsage > targetMemory && EvictLRUInternal()) {
         }
     }
 
@@ -205,19 +318,39 @@ namespace GameEngine {
         auto now = std::chrono::steady_clock::now();
         auto cutoffTime = now - maxAge;
         
-        for (auto it = m_cacheList.rbegin(); it != m_cacheList.rend();) {
-            if (it->second.lastAccess < cutoffTime && !it->second.isPinned) {
-                // Convert reverse iterator to forward iterator for erase
-                auto forwardIt = std::next(it).base();
-                m_cacheMap.erase(it->first);
-                it = std::make_reverse_iterator(m_cacheList.erase(forwardIt));
+        for (auto it = m_cacheList.begin(); it != m_cacheList.end();) {
+            auto current = it++;
+            if (current->second.lastAccess < cutoffTime && !current->second.isPinned) {
+                EraseEntry(current);
                 m_evictions++;
-            } else {
-                ++it;
             }
         }
     }
 
+    template<typename T>
+    void LRUResourceCache<T>::UpdateMemoryUsage(const std::string& key) {
+        std::shared_ptr<T> resource;
+        {
+            std::lock_guard<std::mutex> lock(m_cacheMutex);
+            auto mapIt = m_cacheMap.find(key);
+            if (mapIt == m_cacheMap.end()) {
+                return;
+            }
+            resource = mapIt->second->second.resource;
+        }
+        
+        // Sized outside the lock; a resource may take its own locks to report its size
+        const size_t memoryUsage = GetResourceMemoryUsage(resource);
+        
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        auto mapIt = m_cacheMap.find(key);
+        if (mapIt != m_cacheMap.end() && mapIt->second->second.resource == resource) {
+            m_memoryUsage = m_memoryUsage - mapIt->second->second.memoryUsage + memoryUsage;
+            mapIt->second->second.memoryUsage = memoryUsage;
+            EvictToLimits();
+        }
+    }
+
     template<typename T>
     void LRUResourceCache<T>::Pin(const std::string& key) {
         std::lock_guard<std::mutex> lock(m_cacheMutex);
@@ -249,10 +382,16 @@ namespace GameEngine {
         return false;
     }
 
+    template<typename T>
+    size_t LRUResourceCache<T>::GetSize() const {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        return m_cacheList.size();
+    }
+
     template<typename T>
     size_t LRUResourceCache<T>::GetMemoryUsage() const {
         std::lock_guard<std::mutex> lock(m_cacheMutex);
-        return CalculateMemoryUsage();
+        return m_memoryUsage;
     }
 
     template<typename T>
@@ -267,8 +406,27 @@ namespace GameEngine {
         return static_cast<float>(m_hits) / totalAccesses;
     }
 
+    template<typename T>
+    size_t LRUResourceCache<T>::GetHitCount() const {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        return m_hits;
+    }
+
+    template<typename T>
+    size_t LRUResourceCache<T>::GetMissCount() const {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        return m_misses;
+    }
+
+    template<typename T>
+    size_t LRUResourceCache<T>::GetEvictionCount() const {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        return m_evictions;
+    }
+
     template<typename T>
     void LRUResourceCache<T>::ResetStatistics() {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
         m_hits = 0;
         m_misses = 0;
         m_evictions = 0;
@@ -302,11 +460,7 @@ namespace GameEngine {
         usage.reserve(m_cacheList.size());
         
         for (const auto& pair : m_cacheList) {
-            size_t memUsage = 0;
-            if (pair.second.resource) {
-                memUsage = pair.second.resource->GetMemoryUsage();
-            }
-            usage.emplace_back(pair.first, memUsage);
+            usage.emplace_back(pair.first, pair.second.memoryUsage);
         }
         
         return usage;
@@ -318,11 +472,9 @@ namespace GameEngine {
         
         // Remove entries with expired resources
         for (auto it = m_cacheList.begin(); it != m_cacheList.end();) {
-            if (!it->second.resource) {
-                m_cacheMap.erase(it->first);
-                it = m_cacheList.erase(it);
-            } else {
-                ++it;
+            auto current = it++;
+            if (!current->second.resource) {
+                EraseEntry(current);
             }
         }
     }
@@ -331,68 +483,218 @@ namespace GameEngine {
     void LRUResourceCache<T>::Optimize() {
         std::lock_guard<std::mutex> lock(m_cacheMutex);
         
-        // Sort by access frequency (most accessed first)
+        // Sort by access frequency (most accessed first); list::sort relinks nodes, so map
+        // iterators and the clock hand stay valid
         m_cacheList.sort([](const auto& a, const auto& b) {
             return a.second.accessCount > b.second.accessCount;
         });
-        
-        // Rebuild the map with new iterators
-        m_cacheMap.clear();
-        for (auto it = m_cacheList.begin(); it != m_cacheList.end(); ++it) {
-            m_cacheMap[it->first] = it;
-        }
+        m_clockHand = m_cacheList.end();
     }
 
     template<typename T>
     void LRUResourceCache<T>::MoveToFront(CacheIterator it) {
-        if (it != m_cacheList.begin()) {
-            // Move element to front
-            auto entry = std::move(*it);
-            m_cacheList.erase(it);
-            m_cacheList.push_front(std::move(entry));
-            
-            // Update map
-            m_cacheMap[m_cacheList.front().first] = m_cacheList.begin();
-        }
+        // Relinks the node; iterators (and so the map) stay valid
+        m_cacheList.splice(m_cacheList.begin(), m_cacheList, it);
     }
 
     template<typename T>
-    void LRUResourceCache<T>::EvictLRUInternal() {
+    bool LRUResourceCache<T>::EvictLRUInternal() {
         if (m_cacheList.empty()) {
-            return;
+            return false;
         }
         
-        // Find the least recently used non-pinned resource
-        auto it = m_cacheList.rbegin();
-        while (it != m_cacheList.rend() && it->second.isPinned) {
-            ++it;
+        CacheIterator victim = m_cacheList.end();
+        if (m_policy == CacheEvictionPolicy::Clock) {
+            victim = SelectClockVictim();
+        } else {
+            // Find the least recently used non-pinned resource
+            auto it = m_cacheList.rbegin();
+            while (it != m_cacheList.rend() && it->second.isPinned) {
+                ++it;
+            }
+            if (it != m_cacheList.rend()) {
+                // Convert reverse iterator to forward iterator
+                victim = std::next(it).base();
+            }
         }
         
-        if (it != m_cacheList.rend()) {
-            // Convert reverse iterator to forward iterator for erase
-            auto forwardIt = std::next(it).base();
-            m_cacheMap.erase(it->first);
-            m_cacheList.erase(forwardIt);
-            m_evictions++;
+        if (victim == m_cacheList.end()) {
+            return false;
+        }
+        
+        EraseEntry(victim);
+        m_evictions++;
+        return true;
+    }
+
+    template<typename T>
+    typename LRUResourceCache<T>::CacheIterator LRUResourceCache<T>::SelectClockVictim() {
+        // The hand sweeps from the back (oldest inserts) to the front, then wraps. Referenced
+        // entries get a second chance; two full sweeps find a victim unless everything is pinned.
+        const size_t maxSteps = m_cacheList.size() * 2 + 1;
+        for (size_t step = 0; step < maxSteps; ++step) {
+            if (m_clockHand == m_cacheList.end()) {
+                m_clockHand = std::prev(m_cacheList.end());
+            }
+            
+            CacheIterator candidate = m_clockHand;
+            m_clockHand = (candidate == m_cacheList.begin()) ? m_cacheList.end() : std::prev(candidate);
+            
+            if (candidate->second.isPinned) {
+                continue;
+            }
+            if (candidate->second.referenced) {
+                candidate->second.referenced = false;
+                continue;
+            }
+            return candidate;
+        }
+        return m_cacheList.end();
+    }
+
+    template<typename T>
+    void LRUResourceCache<T>::EraseEntry(CacheIterator it) {
+        if (m_clockHand == it) {
+            m_clockHand = (it == m_cacheList.begin()) ? m_cacheList.end() : std::prev(it);
+        }
+        m_memoryUsage -= it->second.memoryUsage;
+        m_cacheMap.erase(it->first);
+        m_cacheList.erase(it);
+    }
+
+    template<typename T>
+    void LRUResourceCache<T>::EvictToLimits() {
+        // Stops early if only pinned entries are left
+        while (ShouldEvict() && EvictLRUInternal()) {
         }
     }
 
     template<typename T>
     bool LRUResourceCache<T>::ShouldEvict() const {
-        return m_cacheList.size() > m_maxSize || CalculateMemoryUsage() > m_maxMemory;
+        return m_cacheList.size() > m_maxSize || m_memoryUsage > m_maxMemory;
     }
 
     template<typename T>
-    size_t LRUResourceCache<T>::CalculateMemoryUsage() const {
-        size_t totalMemory = 0;
+    size_t LRUResourceCache<T>::GetResourceMemoryUsage(const std::shared_ptr<T>& resource) {
+        return resource ? resource->GetMemoryUsage() : 0;
+    }
+
+    // Sharded cache implementation
+    template<typename T>
+    ShardedLRUResourceCache<T>::ShardedLRUResourceCache(size_t maxSize, size_t maxMemory, size_t shardCount,
+                                                        CacheEvictionPolicy policy) {
+        // Few enough shards that each keeps a useful share of the size budget
+        const size_t maxShards = std::max<size_t>(1, maxSize / MIN_ENTRIES_PER_SHARD);
+        size_t count = 1;
+        while (count < shardCount && count < maxShards) {
+            count <<= 1;
+        }
+        if (count > maxShards && count > 1) {
+            count >>= 1;
+        }
         
-        for (const auto& pair : m_cacheList) {
-            if (pair.second.resource) {
-                totalMemory += pair.second.resource->GetMemoryUsage();
-            }
+        m_shards.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            m_shards.push_back(std::make_unique<LRUResourceCache<T>>(PerShard(maxSize, count), PerShard(maxMemory, count), policy));
+        }
+    }
+
+    template<typename T>
+    void ShardedLRUResourceCache<T>::Clear() {
+        for (auto& shard : m_shards) {
+            shard->Clear();
+        }
+    }
+
+    template<typename T>
+    void ShardedLRUResourceCache<T>::SetMaxSize(size_t maxSize) {
+        for (auto& shard : m_shards) {
+            shard->SetMaxSize(PerShard(maxSize, m_shards.size()));
+        }
+    }
+
+    template<typename T>
+    void ShardedLRUResourceCache<T>::SetMaxMemory(size_t maxMemory) {
+        for (auto& shard : m_shards) {
+            shard->SetMaxMemory(PerShard(maxMemory, m_shards.size()));
+        }
+    }
+
+    template<typename T>
+    void ShardedLRUResourceCache<T>::SetEvictionPolicy(CacheEvictionPolicy policy) {
+        for (auto& shard : m_shards) {
+            shard->SetEvictionPolicy(policy);
+        }
+    }
+
+    template<typename T>
+    void ShardedLRUResourceCache<T>::EvictByMemory(size_t targetMemory) {
+        // Trim each shard to its share of whatever is over the target
+        const size_t current = GetMemoryUsage();
+        if (current <= targetMemory) {
+            return;
+        }
+        
+        const double keepFraction = static_cast<double>(targetMemory) / static_cast<double>(current);
+        for (auto& shard : m_shards) {
+            shard->EvictByMemory(static_cast<size_t>(shard->GetMemoryUsage() * keepFraction));
+        }
+    }
+
+    template<typename T>
+    void ShardedLRUResourceCache<T>::EvictOlderThan(std::chrono::seconds maxAge) {
+        for (auto& shard : m_shards) {
+            shard->EvictOlderThan(maxAge);
+        }
+    }
+
+    template<typename T>
+    size_t ShardedLRUResourceCache<T>::GetSize() const {
+        size_t size = 0;
+        for (const auto& shard : m_shards) {
+            size += shard->GetSize();
+        }
+        return size;
+    }
+
+    template<typename T>
+    size_t ShardedLRUResourceCache<T>::GetMemoryUsage() const {
+        size_t memory = 0;
+        for (const auto& shard : m_shards) {
+            memory += shard->GetMemoryUsage();
+        }
+        return memory;
+    }
+
+    template<typename T>
+    float ShardedLRUResourceCache<T>::GetHitRatio() const {
+        size_t hits = 0;
+        size_t misses = 0;
+        for (const auto& shard : m_shards) {
+            hits += shard->GetHitCount();
+            misses += shard->GetMissCount();
         }
         
-        return totalMemory;
+        if (hits + misses == 0) {
+            return 0.0f;
+        }
+        return static_cast<float>(hits) / (hits + misses);
+    }
+
+    template<typename T>
+    size_t ShardedLRUResourceCache<T>::GetEvictionCount() const {
+        size_t evictions = 0;
+        for (const auto& shard : m_shards) {
+            evictions += shard->GetEvictionCount();
+        }
+        return evictions;
+    }
+
+    template<typename T>
+    void ShardedLRUResourceCache<T>::ResetStatistics() {
+        for (auto& shard : m_shards) {
+            shard->ResetStatistics();
+        }
     }
 
-} // namespace GameEngine
\ No newline at end of file
+} // namespace GameEngine
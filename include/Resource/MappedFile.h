@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace GameEngine {
+
+    /**
+     * @brief Read-only memory mapping of a whole file
+     *
+     * Pages are brought in by the OS on first touch, so opening a large file is cheap and
+     * reading it needs no intermediate buffer. The mapping lives as long as the object.
+     */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        bool Open(const std::string& path);
+        void Close();
+
+        bool IsOpen() const { return m_data != nullptr; }
+        const uint8_t* GetData() const { return m_data; }
+        size_t GetSize() const { return m_size; }
+
+        // Pointer to size bytes at offset, or nullptr if that range is outside the file
+        const uint8_t* GetRange(uint64_t offset, uint64_t size) const {
+            if (!m_data || offset > m_size || size > m_size - offset) {
+                return nullptr;
+            }
+            return m_data + offset;
+        }
+
+    private:
+        const uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+#ifdef _WIN32
+        void* m_fileHandle = nullptr;
+        void* m_mappingHandle = nullptr;
+#else
+        int m_fileDescriptor = -1;
+#endif
+    };
+}
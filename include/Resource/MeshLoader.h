@@ -2,6 +2,7 @@
 
 #include "Graphics/Mesh.h"
 #include "Graphics/Material.h"
+#include "Resource/MappedFile.h"
 #include <string>
 #include <memory>
 #include <vector>
@@ -41,6 +42,9 @@ namespace GameEngine {
         static bool IsOBJFile(const std::string& filepath);
         static std::shared_ptr<Mesh> CreateMeshFromData(const MeshData& meshData);
         static std::vector<std::shared_ptr<Mesh>> CreateMeshesFromResult(const OBJLoadResult& result);
+        // Same, storing the vertices packed with only the attributes the data uses
+        static std::shared_ptr<Mesh> CreateMeshFromData(const MeshData& meshData, const VertexFormatOptions& options);
+        static std::vector<std::shared_ptr<Mesh>> CreateMeshesFromResult(const OBJLoadResult& result, const VertexFormatOptions& options);
         static std::shared_ptr<Mesh> CreateDefaultCube();
         static MeshData CreateDefaultCubeData(); // Headless version for testing
         
@@ -53,6 +57,17 @@ namespace GameEngine {
         static void ScaleOBJMesh(MeshData& meshData, const Math::Vec3& scale);
 
     private:
+        // Per-chunk tokenizer output, defined in MeshLoader.cpp
+        struct OBJChunk;
+        
+        // A run of triangulated corners from one chunk, written to a mesh starting at destination
+        struct OBJCornerRange {
+            uint32_t chunk;
+            size_t begin;
+            size_t end;
+            size_t destination;
+        };
+        
         // Enhanced OBJ parsing with material support
         struct OBJParseState {
             std::vector<Math::Vec3> positions;
@@ -63,41 +78,38 @@ namespace GameEngine {
             std::string currentGroup;
             std::string currentObject;
             std::vector<MeshData> meshes;
+            std::vector<std::vector<OBJCornerRange>> meshRanges; // Parallel to meshes
             MeshData currentMesh;
+            std::vector<OBJCornerRange> currentRanges;
             bool hasFaces = false;
         };
         
         // OBJ parsing implementation
         static MeshData LoadOBJImpl(const std::string& filepath); // Legacy
         static OBJLoadResult LoadOBJWithMaterialsImpl(const std::string& filepath);
-        static bool ParseOBJLine(const std::string& line, OBJParseState& state, const std::string& basePath);
-        static bool ParseVertex(const std::string& line, Math::Vec3& vertex);
-        static bool ParseNormal(const std::string& line, Math::Vec3& normal);
-        static bool ParseTexCoord(const std::string& line, Math::Vec2& texCoord);
-        static bool ParseFace(const std::string& line, OBJParseState& state);
-        static bool ParseMaterialLib(const std::string& line, OBJParseState& state, const std::string& basePath);
-        static bool ParseUseMaterial(const std::string& line, OBJParseState& state);
-        static bool ParseGroup(const std::string& line, OBJParseState& state);
-        static bool ParseObject(const std::string& line, OBJParseState& state);
         
-        // Legacy parsing for backward compatibility
-        static bool ParseOBJLine(const std::string& line, MeshData& meshData, 
-                                std::vector<Math::Vec3>& positions,
-                                std::vector<Math::Vec3>& normals,
-                                std::vector<Math::Vec2>& texCoords);
-        static bool ParseFace(const std::string& line, MeshData& meshData,
-                             const std::vector<Math::Vec3>& positions,
-                             const std::vector<Math::Vec3>& normals,
-                             const std::vector<Math::Vec2>& texCoords);
+        // Tokenization of the mapped file, one chunk of whole lines per task
+        static bool TokenizeOBJFile(const std::string& filepath, MappedFile& file, std::vector<OBJChunk>& chunks,
+                                    OBJParseState& state, std::string& errorMessage);
+        static void TokenizeOBJChunk(const char* begin, const char* end, OBJChunk& chunk);
+        static bool TokenizeOBJLine(const char* p, const char* end, OBJChunk& chunk);
+        static bool TokenizeOBJFace(const char* p, const char* end, OBJChunk& chunk);
+        
+        // Statements replayed in file order after tokenization
+        static bool ApplyMaterialLib(const std::string& mtlFilename, OBJParseState& state, const std::string& basePath);
+        static void ApplyUseMaterial(const std::string& materialName, OBJParseState& state);
+        static void ApplyGroup(const std::string& name, OBJParseState& state);
+        static void ApplyObject(const std::string& name, OBJParseState& state);
         
         // Helper methods
-        static void FinalizeMesh(OBJParseState& state);
+        static void AddCornerRange(OBJParseState& state, uint32_t chunk, size_t begin, size_t end);
+        static void EndCurrentMesh(OBJParseState& state);
         static void StartNewMesh(OBJParseState& state);
+        static void ResolveOBJCorners(const std::vector<OBJChunk>& chunks, OBJParseState& state);
+        static bool FinalizeMeshData(MeshData& meshData);
         static std::string GetDirectoryPath(const std::string& filepath);
         
         // Utility methods
-        static std::vector<std::string> SplitString(const std::string& str, char delimiter);
-        static std::string TrimString(const std::string& str);
         static void CalculateTangents(std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
     };
 }
\ No newline at end of file
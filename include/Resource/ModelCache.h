@@ -13,6 +13,7 @@ namespace GameEngine {
     class Mesh;
     class Material;
     class ModelNode;
+    class MappedFile;
     
     namespace Graphics {
         class GraphicsAnimation;
@@ -24,13 +25,19 @@ namespace GameEngine {
      * 
      * Provides efficient serialization and deserialization of Model objects
      * with version compatibility and cache invalidation management.
+     *
+     * Cache files are laid out for memory mapping: a fixed header, mesh and material
+     * tables, a string table, then each mesh's vertex and index data as contiguous,
+     * aligned blobs. Loading maps the file and copies each blob into its mesh in one go.
+     * Packed meshes keep their compact vertex layout in the file, and meshes with meshlets
+     * store them as three more blobs (meshlet records, meshlet vertices, local triangles).
      */
     class ModelCache {
     public:
         /**
          * @brief Cache file format version for compatibility checking
          */
-        static constexpr uint32_t CACHE_VERSION = 1;
+        static constexpr uint32_t CACHE_VERSION = 4;
         
         /**
          * @brief Magic number for cache file identification
@@ -90,6 +97,10 @@ namespace GameEngine {
         void SetMaxCacheSize(size_t maxSizeBytes);
         void SetMaxCacheAge(std::chrono::hours maxAge);
         void SetCompressionEnabled(bool enabled);
+        // Pack meshes that are stored as full Vertex structs before writing them
+        void SetCompactVertices(bool enabled);
+        // Build meshlets for meshes that have none before writing them
+        void SetBuildMeshlets(bool enabled);
 
         // Statistics and monitoring
         CacheStats GetStats() const;
@@ -111,6 +122,8 @@ namespace GameEngine {
         size_t m_maxCacheSize = 1024 * 1024 * 1024; // 1GB default
         std::chrono::hours m_maxCacheAge = std::chrono::hours(24 * 7); // 1 week default
         bool m_compressionEnabled = true;
+        bool m_compactVertices = false;
+        bool m_buildMeshlets = false;
         bool m_initialized = false;
 
         // Statistics
@@ -124,13 +137,9 @@ namespace GameEngine {
         
         // Serialization methods
         bool SerializeModel(std::shared_ptr<Model> model, std::ofstream& file);
-        std::shared_ptr<Model> DeserializeModel(std::ifstream& file, const std::string& originalPath);
+        std::shared_ptr<Model> DeserializeModel(const MappedFile& file, const std::string& originalPath);
         
         // Component serialization
-        bool SerializeMesh(std::shared_ptr<Mesh> mesh, std::ofstream& file);
-        std::shared_ptr<Mesh> DeserializeMesh(std::ifstream& file);
-        bool SerializeMaterial(std::shared_ptr<Material> material, std::ofstream& file);
-        std::shared_ptr<Material> DeserializeMaterial(std::ifstream& file);
         bool SerializeModelNode(std::shared_ptr<ModelNode> node, std::ofstream& file);
         std::shared_ptr<ModelNode> DeserializeModelNode(std::ifstream& file);
         bool SerializeAnimation(std::shared_ptr<Graphics::GraphicsAnimation> animation, std::ofstream& file);
@@ -141,14 +150,6 @@ namespace GameEngine {
         // Utility serialization methods
         void WriteString(std::ofstream& file, const std::string& str);
         std::string ReadString(std::ifstream& file);
-        void WriteVector3(std::ofstream& file, const Math::Vec3& vec);
-        Math::Vec3 ReadVector3(std::ifstream& file);
-        void WriteVector2(std::ofstream& file, const Math::Vec2& vec);
-        Math::Vec2 ReadVector2(std::ifstream& file);
-        void WriteVector4(std::ofstream& file, const Math::Vec4& vec);
-        Math::Vec4 ReadVector4(std::ifstream& file);
-        void WriteMatrix4(std::ofstream& file, const Math::Mat4& mat);
-        Math::Mat4 ReadMatrix4(std::ifstream& file);
 
         // Cache maintenance
         void EvictOldEntries();
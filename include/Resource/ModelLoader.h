@@ -21,6 +21,7 @@ namespace GameEngine {
     class GLTFLoader;
     class FBXLoader;
     class Model;
+    class JobSystem;
     
     namespace Animation {
         class AnimationImporter;
@@ -127,6 +128,11 @@ namespace GameEngine {
         void SetImportScale(float scale);
         float GetImportScale() const { return m_importScale; }
         
+        // Parallel import: the meshes of one file are converted on several threads
+        void SetParallelProcessingEnabled(bool enabled);
+        bool IsParallelProcessingEnabled() const { return m_parallelProcessing; }
+        void SetJobSystem(JobSystem* jobSystem); // Optional; short-lived threads are used without one
+        
         // Animation import configuration
         void SetAnimationImportEnabled(bool enabled);
         bool IsAnimationImportEnabled() const { return m_animationImportEnabled; }
@@ -150,10 +156,22 @@ namespace GameEngine {
 #ifdef GAMEENGINE_HAS_ASSIMP
         std::unique_ptr<Assimp::Importer> m_importer;
         
+        // Vertex and index data of one aiMesh, converted and bounded on a worker; the Mesh,
+        // which uploads to the GPU, is created on the loading thread
+        struct MeshData {
+            std::string name;
+            std::vector<Vertex> vertices;
+            std::vector<uint32_t> indices;
+            BoundingBox boundingBox;
+            BoundingSphere boundingSphere;
+            bool converted = false;
+        };
+        
         // Internal processing methods
         LoadResult ProcessScene(const aiScene* scene, const std::string& filepath);
-        std::shared_ptr<Mesh> ProcessMesh(const aiMesh* mesh, const aiScene* scene);
-        void ProcessNode(const aiNode* node, const aiScene* scene, std::vector<std::shared_ptr<Mesh>>& meshes);
+        bool ConvertMesh(const aiMesh* mesh, MeshData& data) const;
+        std::shared_ptr<Mesh> CreateMesh(MeshData& data) const;
+        void CollectNodeMeshes(const aiNode* node, const aiScene* scene, std::vector<const aiMesh*>& meshes) const;
         
         // Conversion utilities
         Math::Vec3 ConvertVector3(const aiVector3D& vec) const;
@@ -172,6 +190,8 @@ namespace GameEngine {
         // Configuration
         LoadingFlags m_loadingFlags = LoadingFlags::None;
         float m_importScale = 1.0f;
+        bool m_parallelProcessing = true;
+        JobSystem* m_jobSystem = nullptr;
         bool m_initialized = false;
         bool m_cacheEnabled = true;
         bool m_animationImportEnabled = true;
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace GameEngine {
+
+    class JobSystem;
+
+    /**
+     * @brief Runs body(i) once for every i in [0, count) across worker threads
+     *
+     * Used by the model importers to convert meshes and resolve materials in parallel. Work
+     * goes to the given JobSystem when it is running, otherwise to a few short-lived threads
+     * (at most maxThreads, 0 = one per core); the calling thread always takes a share. Bodies
+     * should write to slot i of a pre-sized output so the assembled result is deterministic.
+     * The first exception thrown by a body is rethrown once every index has run.
+     */
+    void ParallelImportFor(size_t count, const std::function<void(size_t)>& body,
+                           JobSystem* jobSystem = nullptr, size_t maxThreads = 0);
+}
@@ -6,12 +6,17 @@
 #include <typeindex>
 #include <mutex>
 #include <chrono>
+#include <atomic>
+#include <functional>
+#include <future>
 #include "Core/Logger.h"
 
 namespace GameEngine {
     class ResourceMemoryPool;
     class GPUUploadOptimizer;
-    template<typename T> class LRUResourceCache;
+    class JobSystem;
+    class JobGroup;
+    template<typename T> class ShardedLRUResourceCache;
     
     class Resource {
     public:
@@ -49,15 +54,25 @@ namespace GameEngine {
         bool Initialize();
         void Shutdown();
 
+        // LoadAsync runs loads as background jobs here; set before the first LoadAsync
+        void SetJobSystem(JobSystem* jobSystem) { m_jobSystem = jobSystem; }
+
         // Error handling and recovery
         void SetFallbackResourcesEnabled(bool enabled) { m_fallbackResourcesEnabled = enabled; }
         bool IsFallbackResourcesEnabled() const { return m_fallbackResourcesEnabled; }
         void HandleMemoryPressure();
         void HandleResourceLoadFailure(const std::string& path, const std::string& error);
 
+        // Blocks until loaded. Only lookup and insert hold the lock, so loads of different paths run
+        // in parallel; concurrent requests for the same path share one load.
         template<typename T>
         std::shared_ptr<T> Load(const std::string& path);
 
+        // Loads as a background job on the JobSystem (on the calling thread without one); requests for a
+        // path already loading get the same future
+        template<typename T>
+        std::shared_future<std::shared_ptr<T>> LoadAsync(const std::string& path);
+
         template<typename T>
         void Unload(const std::string& path);
 
@@ -92,21 +107,45 @@ namespace GameEngine {
         float GetLRUCacheHitRatio() const;
         float GetMemoryPoolUtilization() const;
         size_t GetGPUUploadQueueSize() const;
+        size_t GetInFlightLoadCount() const;
 
     private:
+        // One load shared by every request for the same key; whoever claims it runs it
+        template<typename T>
+        struct InFlightLoad {
+            std::promise<std::shared_ptr<T>> promise;
+            std::shared_future<std::shared_ptr<T>> future{promise.get_future().share()};
+            std::atomic<bool> claimed{false};
+        };
+
         template<typename T>
         std::string GetResourceKey(const std::string& path);
         
         template<typename T>
         std::shared_ptr<T> CreateResource(const std::string& path);
 
+        // Returns the cached resource, or the in-flight load for the key (isNew if this call created it)
+        template<typename T>
+        std::shared_ptr<InFlightLoad<T>> FindOrStartLoad(const std::string& key, const std::string& path,
+                                                          std::shared_ptr<T>& cached, bool& isNew);
+
+        template<typename T>
+        void RunLoad(InFlightLoad<T>& load, const std::string& key, const std::string& path);
+
+        void EnqueueLoad(std::function<void()> task);
+
         mutable std::mutex m_resourcesMutex;
         std::unordered_map<std::string, std::weak_ptr<Resource>> m_resources;
+        std::unordered_map<std::string, std::shared_ptr<void>> m_inFlightLoads;     // InFlightLoad<T> for the key's T
+
+        // LoadAsync jobs still queued or running; Shutdown waits for them
+        JobSystem* m_jobSystem = nullptr;
+        std::unique_ptr<JobGroup> m_loadJobs;
         std::string m_assetDirectory = "assets/";
         
         // Performance optimization components
         std::unique_ptr<ResourceMemoryPool> m_memoryPool;
-        std::unique_ptr<LRUResourceCache<Resource>> m_lruCache;
+        std::unique_ptr<ShardedLRUResourceCache<Resource>> m_lruCache;
         std::unique_ptr<GPUUploadOptimizer> m_gpuUploadOptimizer;
         
         // Performance settings
@@ -120,54 +159,129 @@ namespace GameEngine {
         
         // Error handling
         bool m_fallbackResourcesEnabled = true;
-        size_t m_loadFailureCount = 0;
-        size_t m_memoryPressureEvents = 0;
+        std::atomic<size_t> m_loadFailureCount{0};
+        std::atomic<size_t> m_memoryPressureEvents{0};
+        std::mutex m_memoryPressureMutex;
         std::chrono::steady_clock::time_point m_lastMemoryPressureCheck;
         
-        // Statistics tracking
-        mutable size_t m_totalLoads = 0;
-        mutable size_t m_cacheHits = 0;
-        mutable size_t m_cacheMisses = 0;
+        // Statistics tracking (updated from any loading thread)
+        mutable std::atomic<size_t> m_totalLoads{0};
+        mutable std::atomic<size_t> m_cacheHits{0};
+        mutable std::atomic<size_t> m_cacheMisses{0};
+        mutable std::atomic<size_t> m_sharedLoads{0};
         mutable size_t m_lruCleanups = 0;
-        mutable size_t m_fallbackResourcesCreated = 0;
+        mutable std::atomic<size_t> m_fallbackResourcesCreated{0};
     };
 
     template<typename T>
     std::shared_ptr<T> ResourceManager::Load(const std::string& path) {
         // Check memory pressure before acquiring lock (every 10 loads)
-        if (m_autoMemoryManagement && (m_totalLoads % 10 == 0)) {
+        if (m_autoMemoryManagement && (m_totalLoads.load(std::memory_order_relaxed) % 10 == 0)) {
             CheckMemoryPressure();
         }
         
-        std::lock_guard<std::mutex> lock(m_resourcesMutex);
-        std::string key = GetResourceKey<T>(path);
+        const std::string key = GetResourceKey<T>(path);
+        std::shared_ptr<T> cached;
+        bool isNew = false;
+        auto load = FindOrStartLoad<T>(key, path, cached, isNew);
+        if (!load) {
+            return cached;
+        }
         
+        // Run it here unless another thread already is (a queued LoadAsync is claimed by whoever gets there first)
+        RunLoad<T>(*load, key, path);
+        return load->future.get();
+    }
+
+    template<typename T>
+    std::shared_future<std::shared_ptr<T>> ResourceManager::LoadAsync(const std::string& path) {
+        const std::string key = GetResourceKey<T>(path);
+        std::shared_ptr<T> cached;
+        bool isNew = false;
+        auto load = FindOrStartLoad<T>(key, path, cached, isNew);
+        if (!load) {
+            std::promise<std::shared_ptr<T>> ready;
+            ready.set_value(cached);
+            return ready.get_future().share();
+        }
+        
+        if (isNew) {
+            EnqueueLoad([this, load, key, path]() { RunLoad<T>(*load, key, path); });
+        }
+        return load->future;
+    }
+
+    template<typename T>
+    std::shared_ptr<ResourceManager::InFlightLoad<T>> ResourceManager::FindOrStartLoad(const std::string& key, const std::string& path,
+                                                                                        std::shared_ptr<T>& cached, bool& isNew) {
         ++m_totalLoads;
         
-        // Check if resource exists and is still valid
-        auto it = m_resources.find(key);
-        if (it != m_resources.end()) {
-            if (auto resource = it->second.lock()) {
-                ++m_cacheHits;
-                resource->UpdateLastAccessTime();
-                LOG_INFO("Resource cache hit: " + path + " (" + std::to_string(resource->GetMemoryUsage() / 1024) + " KB)");
-                return std::static_pointer_cast<T>(resource);
-            } else {
-                // Weak pointer expired, remove it
-                m_resources.erase(it);
+        std::shared_ptr<InFlightLoad<T>> load;
+        {
+            std::lock_guard<std::mutex> lock(m_resourcesMutex);
+            
+            // Check if resource exists and is still valid
+            auto it = m_resources.find(key);
+            if (it != m_resources.end()) {
+                cached = std::static_pointer_cast<T>(it->second.lock());
+                if (!cached) {
+                    // Weak pointer expired, remove it
+                    m_resources.erase(it);
+                }
             }
+            
+            if (!cached) {
+                auto inFlight = m_inFlightLoads.find(key);
+                if (inFlight != m_inFlightLoads.end()) {
+                    load = std::static_pointer_cast<InFlightLoad<T>>(inFlight->second);
+                } else {
+                    load = std::make_shared<InFlightLoad<T>>();
+                    m_inFlightLoads.emplace(key, load);
+                    isNew = true;
+                }
+            }
+        }
+        
+        if (cached) {
+            ++m_cacheHits;
+            cached->UpdateLastAccessTime();
+            LOG_DEBUG("Resource cache hit: " + path + " (" + std::to_string(cached->GetMemoryUsage() / 1024) + " KB)");
+        } else if (isNew) {
+            ++m_cacheMisses;
+        } else {
+            ++m_cacheHits;
+            ++m_sharedLoads;
+            LOG_DEBUG("Resource already loading, sharing the in-flight load: " + path);
         }
+        return load;
+    }
 
-        ++m_cacheMisses;
+    template<typename T>
+    void ResourceManager::RunLoad(InFlightLoad<T>& load, const std::string& key, const std::string& path) {
+        if (load.claimed.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+        
+        // No lock held while loading
+        std::shared_ptr<T> resource;
+        try {
+            resource = CreateResource<T>(path);
+        } catch (...) {
+            LOG_ERROR("Unexpected exception while loading resource: " + path);
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(m_resourcesMutex);
+            if (resource) {
+                m_resources[key] = resource;
+            }
+            m_inFlightLoads.erase(key);
+        }
         
-        // Create new resource
-        auto resource = CreateResource<T>(path);
         if (resource) {
-            m_resources[key] = resource;
             LOG_INFO("Resource loaded: " + path + " (" + std::to_string(resource->GetMemoryUsage() / 1024) + " KB)");
         }
-        
-        return resource;
+        load.promise.set_value(resource);
     }
 
     template<typename T>
@@ -1,4 +1,5 @@
 #include "Animation/AnimationCompression.h"
+#include "Animation/QuantizedAnimation.h"
 #include "Core/Logger.h"
 #include <algorithm>
 #include <cmath>
@@ -75,6 +76,30 @@ namespace Animation {
         return compressed;
     }
 
+    std::shared_ptr<QuantizedAnimation> AnimationCompressor::QuantizeAnimation(const SkeletalAnimation& original,
+                                                                            const std::shared_ptr<const PoseLayout>& layout,
+                                                                            const CompressionSettings& settings) {
+        ResetStats();
+        m_lastStats.originalMemoryBytes = CalculateAnimationMemoryUsage(original);
+        m_lastStats.originalKeyframes = original.GetKeyframeCount();
+
+        auto quantized = QuantizedAnimation::Create(original, layout, settings);
+        if (!quantized) {
+            return nullptr;
+        }
+
+        m_lastStats.compressedKeyframes = quantized->GetFrameCount() * quantized->GetAnimatedTrackCount();
+        m_lastStats.compressedMemoryBytes = quantized->GetMemoryUsage();
+        m_lastStats.Calculate();
+
+        LOG_INFO("Quantized animation '" + original.GetName() + "': " + std::to_string(m_lastStats.originalMemoryBytes) +
+                 " -> " + std::to_string(m_lastStats.compressedMemoryBytes) + " bytes (" +
+                 std::to_string(quantized->GetAnimatedTrackCount()) + " animated, " +
+                 std::to_string(quantized->GetConstantTrackCount()) + " constant tracks)");
+
+        return quantized;
+    }
+
     template<typename T>
     std::unique_ptr<AnimationTrack<T>> AnimationCompressor::CompressTrack(const AnimationTrack<T>& original,
                                                                          const CompressionSettings& settings) {
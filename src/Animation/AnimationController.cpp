@@ -94,6 +94,7 @@ namespace Animation {
 
         m_skeleton = skeleton;
         m_currentPose.SetSkeleton(skeleton);
+        RebuildPoseLayout();
         m_initialized = true;
 
         LOG_INFO("AnimationController: Initialized with skeleton '" + skeleton->GetName() + "'");
@@ -109,6 +110,9 @@ namespace Animation {
         m_animations.clear();
         m_parameters.clear();
         m_animationLayers.clear();
+        m_animationBindings.clear();
+        m_bakedAnimations.clear();
+        m_poseLayout.reset();
         m_eventCallback = nullptr;
         m_skeleton.reset();
         
@@ -246,7 +250,22 @@ namespace Animation {
             return;
         }
 
+        // Drop the replaced clip's binding and baked data unless another name still plays it
+        auto existing = m_animations.find(name);
+        if (existing != m_animations.end() && existing->second != animation) {
+            const SkeletalAnimation* previous = existing->second.get();
+            const bool stillUsed = std::any_of(m_animations.begin(), m_animations.end(), [&](const auto& pair) {
+                return pair.first != name && pair.second.get() == previous;
+            });
+            if (!stillUsed) {
+                m_animationBindings.erase(previous);
+                m_bakedAnimations.erase(previous);
+            }
+        }
+
         m_animations[name] = animation;
+        m_animationBindings.erase(animation.get()); // Re-resolve tracks if the clip was edited
+        m_bakedAnimations.erase(animation.get());
         LOG_INFO("AnimationController: Added animation '" + name + "'");
     }
 
@@ -255,6 +274,8 @@ namespace Animation {
         if (it != m_animations.end()) {
             // Stop the animation if it's currently playing
             Stop(name, 0.0f);
+            m_animationBindings.erase(it->second.get());
+            m_bakedAnimations.erase(it->second.get());
             m_animations.erase(it);
             LOG_INFO("AnimationController: Removed animation '" + name + "'");
         }
@@ -274,6 +295,44 @@ namespace Animation {
         return names;
     }
 
+    std::shared_ptr<const BakedAnimation> AnimationController::BakeAnimation(const std::string& name, float sampleRate) {
+        auto animation = GetAnimation(name);
+        if (!animation || !m_poseLayout) {
+            LOG_WARNING("AnimationController: Cannot bake animation '" + name + "'");
+            return nullptr;
+        }
+
+        std::shared_ptr<const BakedAnimation> baked = BakedAnimation::Bake(*animation, m_poseLayout, sampleRate);
+        SetBakedAnimation(name, baked);
+        return baked;
+    }
+
+    bool AnimationController::SetBakedAnimation(const std::string& name, std::shared_ptr<const BakedAnimation> baked) {
+        auto animation = GetAnimation(name);
+        if (!animation) {
+            LOG_WARNING("AnimationController: Cannot set baked data for unknown animation '" + name + "'");
+            return false;
+        }
+
+        if (!baked) {
+            m_bakedAnimations.erase(animation.get());
+            return true;
+        }
+
+        if (!m_poseLayout || !baked->IsCompatibleWith(*m_poseLayout)) {
+            LOG_WARNING("AnimationController: Baked animation '" + baked->GetName() + "' does not match the controller skeleton");
+            return false;
+        }
+
+        m_bakedAnimations[animation.get()] = std::move(baked);
+        return true;
+    }
+
+    bool AnimationController::HasBakedAnimation(const std::string& name) const {
+        auto it = m_animations.find(name);
+        return it != m_animations.end() && m_bakedAnimations.count(it->second.get()) > 0;
+    }
+
     // Update and evaluation
     void AnimationController::Update(float deltaTime) {
         if (!m_initialized || m_isPaused) {
@@ -538,6 +597,11 @@ namespace Animation {
             return;
         }
 
+        // Bones added after Initialize invalidate the layout snapshot
+        if (!m_poseLayout || m_poseLayout->GetBoneCount() != m_skeleton->GetBoneCount()) {
+            RebuildPoseLayout();
+        }
+
         // Collect valid non-additive layers
         std::vector<std::pair<std::string, const AnimationLayer*>> validLayers;
         std::vector<std::pair<std::string, const AnimationLayer*>> additiveLayers;
@@ -558,13 +622,16 @@ namespace Animation {
             }
         }
 
+        // Layers are sampled and blended as dense poses through the batch kernels
+        IndexedPose& result = m_blendedPose;
+
         // Handle case with no valid layers
         if (validLayers.empty()) {
-            outPose.ResetToBindPose();
+            result.ResetToBindPose();
         } else if (validLayers.size() == 1 && totalWeight >= 1.0f) {
             // Single layer with full weight - direct evaluation
             const AnimationLayer& layer = *validLayers[0].second;
-            outPose = PoseEvaluator::EvaluateAnimation(*layer.animation, layer.time, m_skeleton);
+            EvaluateLayer(layer, result);
         } else {
             // Multi-layer blending with weight normalization
             bool firstLayer = true;
@@ -573,28 +640,23 @@ namespace Animation {
                 const AnimationLayer& layer = *layerPair.second;
                 
                 // Evaluate animation at current time
-                Pose layerPose = PoseEvaluator::EvaluateAnimation(*layer.animation, layer.time, m_skeleton);
+                EvaluateLayer(layer, m_layerPose);
 
                 if (firstLayer) {
                     // Start with first layer
-                    if (totalWeight > 0.0f) {
-                        float normalizedWeight = layer.weight / totalWeight;
-                        if (normalizedWeight < 1.0f) {
-                            // Blend with bind pose if weight is less than 1
-                            Pose bindPose(m_skeleton);
-                            bindPose.ResetToBindPose();
-                            outPose = Pose::Blend(bindPose, layerPose, normalizedWeight);
-                        } else {
-                            outPose = layerPose;
-                        }
+                    float normalizedWeight = totalWeight > 0.0f ? layer.weight / totalWeight : 1.0f;
+                    if (normalizedWeight < 1.0f) {
+                        // Blend with bind pose if weight is less than 1
+                        result.ResetToBindPose();
+                        result.BlendWith(m_layerPose, normalizedWeight);
                     } else {
-                        outPose = layerPose;
+                        result = m_layerPose;
                     }
                     firstLayer = false;
                 } else {
                     // Blend with accumulated result
                     float normalizedWeight = totalWeight > 0.0f ? layer.weight / totalWeight : 0.0f;
-                    outPose.BlendWith(layerPose, normalizedWeight);
+                    result.BlendWith(m_layerPose, normalizedWeight);
                 }
             }
         }
@@ -604,10 +666,12 @@ namespace Animation {
             const AnimationLayer& layer = *layerPair.second;
             
             // Evaluate additive animation
-            Pose additivePose = PoseEvaluator::EvaluateAnimation(*layer.animation, layer.time, m_skeleton);
-            outPose.BlendAdditiveWith(additivePose, layer.weight);
+            EvaluateLayer(layer, m_layerPose);
+            result.BlendAdditiveWith(m_layerPose, layer.weight);
         }
 
+        result.ToPose(outPose);
+
         // Ensure pose is valid
         if (!outPose.ValidatePose()) {
             LOG_WARNING("AnimationController: Generated invalid pose, resetting to bind pose");
@@ -615,6 +679,48 @@ namespace Animation {
         }
     }
 
+    void AnimationController::RebuildPoseLayout() {
+        m_animationBindings.clear();
+
+        if (!m_skeleton) {
+            m_poseLayout.reset();
+            return;
+        }
+
+        m_poseLayout = PoseLayout::Create(*m_skeleton);
+        m_blendedPose.SetLayout(m_poseLayout);
+        m_layerPose.SetLayout(m_poseLayout);
+
+        // Baked frames are only valid while the bone order still matches
+        for (auto it = m_bakedAnimations.begin(); it != m_bakedAnimations.end();) {
+            if (it->second->IsCompatibleWith(*m_poseLayout)) {
+                ++it;
+            } else {
+                LOG_WARNING("AnimationController: Dropping baked animation '" + it->second->GetName() + "' after skeleton change");
+                it = m_bakedAnimations.erase(it);
+            }
+        }
+    }
+
+    void AnimationController::EvaluateLayer(const AnimationLayer& layer, IndexedPose& outPose) {
+        const std::shared_ptr<SkeletalAnimation>& animation = layer.animation;
+
+        auto bakedIt = m_bakedAnimations.find(animation.get());
+        if (bakedIt != m_bakedAnimations.end()) {
+            bakedIt->second->Sample(animation->WrapTime(layer.time), outPose);
+            return;
+        }
+
+        auto it = m_animationBindings.find(animation.get());
+        if (it == m_animationBindings.end()) {
+            CachedBinding cached{animation, AnimationBinding::Create(*animation, *m_poseLayout), {}};
+            it = m_animationBindings.emplace(animation.get(), std::move(cached)).first;
+        }
+
+        CachedBinding& cached = it->second;
+        PoseEvaluator::EvaluateAnimation(*animation, cached.binding, layer.time, cached.cursor, outPose);
+    }
+
     void AnimationController::ValidateParameters() {
         // Remove invalid parameters if needed
         // This is a placeholder for parameter validation
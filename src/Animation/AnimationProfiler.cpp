@@ -5,6 +5,7 @@
 #include "Animation/BlendTree.h"
 #include "Animation/IKSolver.h"
 #include "Core/Logger.h"
+#include "Core/Profiler.h"
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
@@ -143,9 +144,9 @@ namespace GameEngine {
             m_isPaused = false;
             
             // Stop all active timers
-            for (auto& [name, timer] : m_activeTimers) {
-                if (timer.IsRunning()) {
-                    timer.Stop();
+            for (auto& [name, operation] : m_activeTimers) {
+                if (operation.timer.IsRunning()) {
+                    operation.timer.Stop();
                 }
             }
             
@@ -175,6 +176,7 @@ namespace GameEngine {
             
             m_frameTimer.Stop();
             double frameTime = m_frameTimer.GetElapsedMs();
+            GAMEENGINE_PROFILE_COUNTER("Animation Frame Time (ms)", frameTime);
             
             // Update frame time history
             m_frameTimeHistory.push_back(frameTime);
@@ -203,18 +205,29 @@ namespace GameEngine {
         void AnimationProfiler::BeginOperation(const std::string& operationName) {
             if (!IsProfilingActive()) return;
             
-            auto& timer = m_activeTimers[operationName];
-            timer.Start();
+            auto& operation = m_activeTimers[operationName];
+            operation.timer.Start();
         }
 
         void AnimationProfiler::EndOperation(const std::string& operationName) {
             if (!IsProfilingActive()) return;
             
             auto it = m_activeTimers.find(operationName);
-            if (it != m_activeTimers.end() && it->second.IsRunning()) {
-                it->second.Stop();
-                double elapsedTime = it->second.GetElapsedMs();
+            if (it != m_activeTimers.end() && it->second.timer.IsRunning()) {
+                ActiveOperation& operation = it->second;
+                operation.timer.Stop();
+                double elapsedTime = operation.timer.GetElapsedMs();
                 m_operationTimings[operationName].AddSample(elapsedTime);
+
+                // Same span on the engine timeline
+                Profiler& profiler = Profiler::GetInstance();
+                if (profiler.IsEnabled()) {
+                    if (!operation.profileName) {
+                        operation.profileName = profiler.InternName(operationName);
+                    }
+                    const uint64_t durationNs = static_cast<uint64_t>(operation.timer.GetElapsedMicroseconds() * 1000.0);
+                    profiler.RecordZoneEndingNow(operation.profileName, "Animation", durationNs);
+                }
             }
         }
 
@@ -1,12 +1,48 @@
 #include "Animation/AnimationThreading.h"
 #include "Core/Logger.h"
+#include "Core/Profiler.h"
 #include <algorithm>
 #include <chrono>
+#include <stdexcept>
 #include <thread>
 
 namespace GameEngine {
 namespace Animation {
 
+    namespace {
+        // Identifies the pool worker running on this thread, if any
+        thread_local const AnimationThreadPool* t_workerPool = nullptr;
+        thread_local size_t t_workerIndex = 0;
+
+        uint64_t ElapsedNs(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+            return static_cast<uint64_t>(std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(to - from).count()));
+        }
+
+        // Animation is frame work: urgent tasks go in the frame-critical lane, the rest in normal
+        JobPriority ToJobPriority(AnimationTaskPriority priority) {
+            return priority >= AnimationTaskPriority::High ? JobPriority::FrameCritical : JobPriority::Normal;
+        }
+    }
+
+    /**
+     * A queued unit of work. Function tasks are heap-allocated and deleted after running;
+     * range chunks live inside their RangeJob, which is deleted with its last chunk.
+     */
+    struct AnimationThreadPool::QueuedTask {
+        AnimationTask task;
+        AnimationTaskCounter* counter = nullptr;
+        std::unique_ptr<std::promise<void>> promise;    // Future-returning submissions only
+        RangeJob* range = nullptr;
+        size_t begin = 0;
+        size_t end = 0;
+    };
+
+    struct AnimationThreadPool::RangeJob {
+        std::function<void(size_t, size_t)> body;
+        std::vector<QueuedTask> chunks;
+        std::atomic<size_t> remaining{0};
+    };
+
     // AnimationThreadPool implementation
     AnimationThreadPool::AnimationThreadPool() {
         LOG_INFO("AnimationThreadPool created");
@@ -17,23 +53,36 @@ namespace Animation {
         LOG_INFO("AnimationThreadPool destroyed");
     }
 
+    void AnimationThreadPool::SetJobSystem(JobSystem* jobSystem) {
+        if (!m_threads.empty()) {
+            LOG_WARNING("AnimationThreadPool already has workers; set the job system before Initialize");
+            return;
+        }
+        m_jobSystem = jobSystem;
+    }
+
     bool AnimationThreadPool::Initialize(const AnimationThreadConfig& config) {
         LOG_INFO("Initializing AnimationThreadPool");
         
         m_config = config;
+        m_shutdown = false;
+        
+        if (m_jobSystem) {
+            m_lastStatsUpdate = std::chrono::steady_clock::now();
+            LOG_INFO("AnimationThreadPool running on the engine job system");
+            return true;
+        }
         
         // Auto-detect thread count if not specified
         if (m_config.numThreads == 0) {
             m_config.numThreads = std::max(1u, std::thread::hardware_concurrency() - 1);
         }
         
-        // Initialize work stealing queues
-        if (m_config.enableWorkStealing) {
-            m_workStealingQueues.resize(m_config.numThreads);
-            m_workStealingMutexes.resize(m_config.numThreads);
-            for (size_t i = 0; i < m_config.numThreads; ++i) {
-                m_workStealingMutexes[i] = std::make_unique<std::mutex>();
-            }
+        // One lock-free deque per worker, created before any worker can steal from it
+        m_workerQueues.clear();
+        m_workerQueues.reserve(m_config.numThreads);
+        for (size_t i = 0; i < m_config.numThreads; ++i) {
+            m_workerQueues.push_back(std::make_unique<WorkStealingDeque<QueuedTask*>>());
         }
         
         // Create worker threads
@@ -57,13 +106,25 @@ namespace Animation {
     }
 
     void AnimationThreadPool::Shutdown() {
+        // Jobs on the engine job system call back into the pool until they finish
+        if (m_jobSystem) {
+            m_jobSystem->Wait(m_jobs);
+        }
+        
+        if (m_threads.empty() && m_workerQueues.empty() && m_queuedTasks.load() == 0) {
+            return;
+        }
+
         LOG_INFO("Shutting down AnimationThreadPool");
         
         // Signal shutdown
         m_shutdown = true;
         
         // Wake up all threads
-        m_queueCondition.notify_all();
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+        }
+        m_wakeCondition.notify_all();
         
         // Wait for all threads to finish
         for (auto& thread : m_threads) {
@@ -72,43 +133,56 @@ namespace Animation {
             }
         }
         
+        // Drop whatever is still queued, completing counters and futures so nobody waits forever
+        std::vector<QueuedTask*> dropped;
+        QueuedTask* task = nullptr;
+        for (auto& queue : m_workerQueues) {
+            while (queue->Pop(task)) {
+                dropped.push_back(task);
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            for (auto& queue : m_injectionQueues) {
+                dropped.insert(dropped.end(), queue.begin(), queue.end());
+                queue.clear();
+            }
+            m_injectedCount = 0;
+        }
+        
+        if (!dropped.empty()) {
+            LOG_WARNING("AnimationThreadPool shut down with " + std::to_string(dropped.size()) + " unfinished tasks");
+        }
+        for (QueuedTask* droppedTask : dropped) {
+            if (droppedTask->promise) {
+                droppedTask->promise->set_exception(std::make_exception_ptr(std::runtime_error("Thread pool shut down")));
+            }
+            m_queuedTasks.fetch_sub(1);
+            FinishTask(droppedTask);
+        }
+        
         m_threads.clear();
-        m_workStealingQueues.clear();
-        m_workStealingMutexes.clear();
+        m_workerQueues.clear();
         
         LOG_INFO("AnimationThreadPool shutdown complete");
     }
 
     std::future<void> AnimationThreadPool::SubmitTask(AnimationTask task) {
-        auto promise = std::make_shared<std::promise<void>>();
-        auto future = promise->get_future();
-        
-        // Wrap the task to fulfill the promise
-        auto wrappedTask = [task = std::move(task), promise]() mutable {
-            try {
-                task.task();
-                promise->set_value();
-            } catch (...) {
-                promise->set_exception(std::current_exception());
-            }
-        };
+        auto queued = std::make_unique<QueuedTask>();
+        queued->promise = std::make_unique<std::promise<void>>();
+        std::future<void> future = queued->promise->get_future();
         
-        task.task = std::move(wrappedTask);
-        
-        // Add to queue
-        {
-            std::lock_guard<std::mutex> lock(m_queueMutex);
-            if (m_taskQueue.size() >= m_config.maxQueueSize) {
-                LOG_WARNING("Animation thread pool queue is full, dropping task");
-                promise->set_exception(std::make_exception_ptr(std::runtime_error("Queue full")));
-                return future;
-            }
-            
-            m_taskQueue.push(std::move(task));
-            m_stats.totalTasksQueued++;
+        if (m_queuedTasks.load(std::memory_order_relaxed) >= m_config.maxQueueSize) {
+            LOG_WARNING("Animation thread pool queue is full, dropping task");
+            queued->promise->set_exception(std::make_exception_ptr(std::runtime_error("Queue full")));
+            return future;
         }
         
-        m_queueCondition.notify_one();
+        queued->task = std::move(task);
+        queued->task.submitTime = std::chrono::steady_clock::now();
+        
+        QueuedTask* raw = queued.release();
+        Enqueue(&raw, 1);
         return future;
     }
 
@@ -116,26 +190,70 @@ namespace Animation {
         return SubmitTask(AnimationTask(std::move(task), priority));
     }
 
-    std::future<void> AnimationThreadPool::SubmitBatch(const AnimationBatch& batch) {
-        auto promise = std::make_shared<std::promise<void>>();
-        auto future = promise->get_future();
+    void AnimationThreadPool::Submit(std::function<void()> task, AnimationTaskCounter& counter, AnimationTaskPriority priority) {
+        auto* queued = new QueuedTask();
+        queued->task = AnimationTask(std::move(task), priority);
+        queued->counter = &counter;
+        
+        counter.Add();
+        Enqueue(&queued, 1);
+    }
+
+    void AnimationThreadPool::SubmitRange(size_t count, size_t grainSize, std::function<void(size_t, size_t)> body,
+                                          AnimationTaskCounter& counter, AnimationTaskPriority priority) {
+        if (count == 0) {
+            return;
+        }
         
+        if (grainSize == 0) {
+            // A few chunks per worker leaves room for stealing to even out uneven work
+            const size_t workers = std::max<size_t>(1, GetThreadCount());
+            grainSize = std::max<size_t>(1, count / (workers * 4));
+        }
+        
+        const size_t chunkCount = (count + grainSize - 1) / grainSize;
+        const auto submitTime = std::chrono::steady_clock::now();
+        
+        auto* job = new RangeJob();
+        job->body = std::move(body);
+        job->chunks.resize(chunkCount);
+        job->remaining = chunkCount;
+        
+        std::vector<QueuedTask*> tasks(chunkCount);
+        for (size_t i = 0; i < chunkCount; ++i) {
+            QueuedTask& chunk = job->chunks[i];
+            chunk.task.priority = priority;
+            chunk.task.submitTime = submitTime;
+            chunk.counter = &counter;
+            chunk.range = job;
+            chunk.begin = i * grainSize;
+            chunk.end = std::min(count, chunk.begin + grainSize);
+            tasks[i] = &chunk;
+        }
+        
+        counter.Add(chunkCount);
+        Enqueue(tasks.data(), chunkCount);
+    }
+
+    void AnimationThreadPool::ParallelFor(size_t count, size_t grainSize, std::function<void(size_t, size_t)> body) {
+        AnimationTaskCounter counter;
+        SubmitRange(count, grainSize, std::move(body), counter);
+        Wait(counter);
+    }
+
+    std::future<void> AnimationThreadPool::SubmitBatch(const AnimationBatch& batch) {
         if (batch.empty()) {
-            promise->set_value();
-            return future;
+            std::promise<void> promise;
+            promise.set_value();
+            return promise.get_future();
         }
         
         // Create a task that processes the entire batch
-        auto batchTask = [batch, promise]() {
-            try {
-                for (size_t i = 0; i < batch.controllers.size(); ++i) {
-                    if (batch.controllers[i]) {
-                        batch.controllers[i]->Update(batch.deltaTime);
-                    }
+        auto batchTask = [batch]() {
+            for (size_t i = 0; i < batch.controllers.size(); ++i) {
+                if (batch.controllers[i]) {
+                    batch.controllers[i]->Update(batch.deltaTime);
                 }
-                promise->set_value();
-            } catch (...) {
-                promise->set_exception(std::current_exception());
             }
         };
         
@@ -143,16 +261,65 @@ namespace Animation {
     }
 
     void AnimationThreadPool::SubmitBatches(const std::vector<AnimationBatch>& batches) {
+        std::vector<QueuedTask*> tasks;
+        tasks.reserve(batches.size());
+        
         for (const auto& batch : batches) {
-            SubmitBatch(batch);
+            if (batch.empty()) {
+                continue;
+            }
+            
+            auto* queued = new QueuedTask();
+            queued->task = AnimationTask([batch]() {
+                for (size_t i = 0; i < batch.controllers.size(); ++i) {
+                    if (batch.controllers[i]) {
+                        batch.controllers[i]->Update(batch.deltaTime);
+                    }
+                }
+            }, batch.priority);
+            tasks.push_back(queued);
+        }
+        
+        if (!tasks.empty()) {
+            Enqueue(tasks.data(), tasks.size());
+        }
+    }
+
+    void AnimationThreadPool::Wait(AnimationTaskCounter& counter) {
+        if (m_jobSystem) {
+            m_jobSystem->Wait(counter);
+            return;
+        }
+        
+        const size_t worker = GetCurrentWorkerIndex();
+        
+        while (!counter.IsDone()) {
+            QueuedTask* task = nullptr;
+            if (FindTask(task, worker)) {
+                ExecuteTask(task);
+            } else {
+                // Remaining tasks are running on other threads
+                std::this_thread::yield();
+            }
         }
     }
 
     void AnimationThreadPool::WaitForAll() {
-        std::unique_lock<std::mutex> lock(m_queueMutex);
-        m_completionCondition.wait(lock, [this] {
-            return m_taskQueue.empty() && m_stats.activeThreads == 0;
-        });
+        if (m_jobSystem) {
+            m_jobSystem->Wait(m_jobs);
+            return;
+        }
+        
+        const size_t worker = GetCurrentWorkerIndex();
+        
+        while (!IsIdle()) {
+            QueuedTask* task = nullptr;
+            if (FindTask(task, worker)) {
+                ExecuteTask(task);
+            } else {
+                std::this_thread::yield();
+            }
+        }
     }
 
     void AnimationThreadPool::WaitForCompletion() {
@@ -160,8 +327,8 @@ namespace Animation {
     }
 
     bool AnimationThreadPool::IsIdle() const {
-        std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(m_queueMutex));
-        return m_taskQueue.empty() && m_stats.activeThreads == 0;
+        // Queued is read first: a task is counted active before it stops counting as queued
+        return m_queuedTasks.load() == 0 && m_activeTasks.load() == 0;
     }
 
     void AnimationThreadPool::SetMaxThreads(size_t maxThreads) {
@@ -175,19 +342,35 @@ namespace Animation {
         m_config.maxQueueSize = maxQueueSize;
     }
 
+    size_t AnimationThreadPool::GetThreadCount() const {
+        return m_jobSystem ? m_jobSystem->GetWorkerCount() : m_threads.size();
+    }
+
     size_t AnimationThreadPool::GetQueueSize() const {
-        std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(m_queueMutex));
-        return m_taskQueue.size();
+        return m_queuedTasks.load();
     }
 
     AnimationThreadPool::ThreadPoolStats AnimationThreadPool::GetStats() const {
-        std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(m_statsMutex));
-        ThreadPoolStats stats = m_stats;
+        ThreadPoolStats stats;
+        stats.totalTasksProcessed = m_tasksProcessed.load();
+        stats.totalTasksQueued = m_tasksQueuedTotal.load();
+        stats.currentQueueSize = m_queuedTasks.load();
+        stats.activeThreads = m_activeTasks.load();
+        
+        if (stats.totalTasksProcessed > 0) {
+            const double processed = static_cast<double>(stats.totalTasksProcessed);
+            stats.averageTaskTime = static_cast<float>(m_taskTimeNs.load() / processed / 1.0e6);
+            stats.averageQueueTime = static_cast<float>(m_queueTimeNs.load() / processed / 1.0e6);
+        }
         
-        // Calculate current queue size
+        std::chrono::steady_clock::time_point since;
         {
-            std::lock_guard<std::mutex> queueLock(const_cast<std::mutex&>(m_queueMutex));
-            stats.currentQueueSize = m_taskQueue.size();
+            std::lock_guard<std::mutex> lock(m_statsMutex);
+            since = m_lastStatsUpdate;
+        }
+        const float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - since).count();
+        if (seconds > 0.0f) {
+            stats.tasksPerSecond = static_cast<size_t>(stats.totalTasksProcessed / seconds);
         }
         
         return stats;
@@ -195,7 +378,10 @@ namespace Animation {
 
     void AnimationThreadPool::ResetStats() {
         std::lock_guard<std::mutex> lock(m_statsMutex);
-        m_stats = ThreadPoolStats{};
+        m_tasksProcessed = 0;
+        m_tasksQueuedTotal = 0;
+        m_taskTimeNs = 0;
+        m_queueTimeNs = 0;
         m_lastStatsUpdate = std::chrono::steady_clock::now();
     }
 
@@ -206,7 +392,10 @@ namespace Animation {
 
     void AnimationThreadPool::ResumeThreads() {
         m_paused = false;
-        m_queueCondition.notify_all();
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+        }
+        m_wakeCondition.notify_all();
         LOG_DEBUG("Animation thread pool resumed");
     }
 
@@ -214,68 +403,167 @@ namespace Animation {
     void AnimationThreadPool::WorkerThread(size_t threadId) {
         LOG_DEBUG("Animation worker thread started");
         
-        while (!m_shutdown) {
-            AnimationTask task;
-            
-            // Wait for a task or shutdown signal
-            if (!GetNextTask(task, threadId)) {
+        t_workerPool = this;
+        t_workerIndex = threadId;
+        Profiler::GetInstance().SetThreadName("Animation Worker " + std::to_string(threadId));
+        
+        size_t idleRounds = 0;
+        while (!m_shutdown.load(std::memory_order_acquire)) {
+            QueuedTask* task = nullptr;
+            if (!m_paused.load(std::memory_order_relaxed) && FindTask(task, threadId)) {
+                ExecuteTask(task);
+                idleRounds = 0;
                 continue;
             }
             
-            // Process the task
-            {
-                std::lock_guard<std::mutex> lock(m_statsMutex);
-                m_stats.activeThreads++;
-            }
-            
-            auto startTime = std::chrono::high_resolution_clock::now();
-            ProcessTask(task);
-            auto endTime = std::chrono::high_resolution_clock::now();
-            
-            float processingTime = std::chrono::duration<float, std::milli>(endTime - startTime).count();
-            UpdateStats(task, processingTime);
-            
-            {
-                std::lock_guard<std::mutex> lock(m_statsMutex);
-                m_stats.activeThreads--;
+            // Spin briefly before sleeping; frame work tends to arrive in bursts
+            if (++idleRounds < IDLE_SPIN_ROUNDS) {
+                std::this_thread::yield();
+                continue;
             }
+            idleRounds = 0;
             
-            // Notify completion condition
-            m_completionCondition.notify_all();
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_sleepingWorkers.fetch_add(1);
+            m_wakeCondition.wait(lock, [this] {
+                return m_shutdown.load() || (!m_paused.load() && m_queuedTasks.load() > 0);
+            });
+            m_sleepingWorkers.fetch_sub(1);
         }
         
+        t_workerPool = nullptr;
         LOG_DEBUG("Animation worker thread stopped");
     }
 
-    bool AnimationThreadPool::GetNextTask(AnimationTask& task, size_t threadId) {
-        std::unique_lock<std::mutex> lock(m_queueMutex);
+    size_t AnimationThreadPool::GetCurrentWorkerIndex() const {
+        return t_workerPool == this ? t_workerIndex : NO_WORKER;
+    }
+
+    void AnimationThreadPool::Enqueue(QueuedTask* const* tasks, size_t count) {
+        // Counted before becoming visible so a fast consumer never sees the count underflow
+        m_queuedTasks.fetch_add(count);
+        m_tasksQueuedTotal.fetch_add(count, std::memory_order_relaxed);
         
-        // Wait for a task or shutdown
-        m_queueCondition.wait(lock, [this] {
-            return !m_taskQueue.empty() || m_shutdown || m_paused;
-        });
+        if (m_jobSystem) {
+            // One job per task; ExecuteTask still does the pool's counters and statistics
+            for (size_t i = 0; i < count; ++i) {
+                QueuedTask* task = tasks[i];
+                m_jobSystem->Submit([this, task]() { ExecuteTask(task); }, m_jobs, ToJobPriority(task->task.priority));
+            }
+            return;
+        }
+        
+        const size_t worker = GetCurrentWorkerIndex();
+        if (worker != NO_WORKER) {
+            // Owner push, no lock
+            for (size_t i = 0; i < count; ++i) {
+                m_workerQueues[worker]->Push(tasks[i]);
+            }
+        } else {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            for (size_t i = 0; i < count; ++i) {
+                const size_t level = m_config.enablePriority
+                    ? std::min(static_cast<size_t>(tasks[i]->task.priority), PRIORITY_LEVELS - 1)
+                    : static_cast<size_t>(AnimationTaskPriority::Normal);
+                m_injectionQueues[level].push_back(tasks[i]);
+            }
+            m_injectedCount.fetch_add(count, std::memory_order_relaxed);
+        }
+        
+        WakeWorkers(count);
+    }
+
+    bool AnimationThreadPool::FindTask(QueuedTask*& task, size_t threadId) {
+        if (threadId != NO_WORKER && m_workerQueues[threadId]->Pop(task)) {
+            return true;
+        }
+        
+        if (TakeInjectedTask(task, threadId)) {
+            return true;
+        }
         
-        if (m_shutdown) {
+        return m_config.enableWorkStealing && StealWork(task, threadId);
+    }
+
+    bool AnimationThreadPool::TakeInjectedTask(QueuedTask*& task, size_t threadId) {
+        if (m_injectedCount.load(std::memory_order_relaxed) == 0) {
             return false;
         }
         
-        if (m_paused) {
+        // Workers take a fair share into their own deque, where others can steal it back
+        QueuedTask* taken[MAX_INJECTED_GRAB];
+        size_t takenCount = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            const size_t available = m_injectedCount.load(std::memory_order_relaxed);
+            size_t limit = 1;
+            if (threadId != NO_WORKER && m_config.enableWorkStealing) {
+                limit = std::clamp<size_t>(available / m_workerQueues.size(), 1, MAX_INJECTED_GRAB);
+            }
+            
+            for (size_t level = PRIORITY_LEVELS; level-- > 0 && takenCount < limit;) {
+                auto& queue = m_injectionQueues[level];
+                while (!queue.empty() && takenCount < limit) {
+                    taken[takenCount++] = queue.front();
+                    queue.pop_front();
+                }
+            }
+            m_injectedCount.fetch_sub(takenCount, std::memory_order_relaxed);
+        }
+        
+        if (takenCount == 0) {
             return false;
         }
         
-        if (!m_taskQueue.empty()) {
-            task = m_taskQueue.top();
-            m_taskQueue.pop();
-            return true;
+        // Pushed in reverse so the owner pops them in priority order
+        task = taken[0];
+        for (size_t i = takenCount; i-- > 1;) {
+            m_workerQueues[threadId]->Push(taken[i]);
         }
+        if (takenCount > 1) {
+            WakeWorkers(takenCount - 1);
+        }
+        return true;
+    }
+
+    void AnimationThreadPool::ExecuteTask(QueuedTask* task) {
+        // Active before no longer queued, so IsIdle never sees both at zero mid-handoff
+        m_activeTasks.fetch_add(1);
+        m_queuedTasks.fetch_sub(1);
         
-        // Try work stealing if enabled
-        if (m_config.enableWorkStealing) {
-            lock.unlock();
-            return StealWork(task, threadId);
+        const auto startTime = std::chrono::steady_clock::now();
+        std::exception_ptr failure;
+        if (task->range) {
+            try {
+                task->range->body(task->begin, task->end);
+            } catch (...) {
+                LOG_ERROR("Animation range task failed with exception");
+            }
+        } else if (task->promise) {
+            try {
+                task->task.task();
+            } catch (...) {
+                failure = std::current_exception();
+            }
+        } else {
+            ProcessTask(task->task);
         }
+        const auto endTime = std::chrono::steady_clock::now();
         
-        return false;
+        m_taskTimeNs.fetch_add(ElapsedNs(startTime, endTime), std::memory_order_relaxed);
+        m_queueTimeNs.fetch_add(ElapsedNs(task->task.submitTime, startTime), std::memory_order_relaxed);
+        m_tasksProcessed.fetch_add(1, std::memory_order_relaxed);
+        
+        if (task->promise) {
+            if (failure) {
+                task->promise->set_exception(failure);
+            } else {
+                task->promise->set_value();
+            }
+        }
+        
+        FinishTask(task);
+        m_activeTasks.fetch_sub(1);
     }
 
     void AnimationThreadPool::ProcessTask(const AnimationTask& task) {
@@ -288,36 +576,58 @@ namespace Animation {
         }
     }
 
-    void AnimationThreadPool::UpdateStats(const AnimationTask& task, float processingTime) {
-        std::lock_guard<std::mutex> lock(m_statsMutex);
-        
-        m_stats.totalTasksProcessed++;
+    void AnimationThreadPool::FinishTask(QueuedTask* task) {
+        AnimationTaskCounter* counter = task->counter;
         
-        // Update average task time
-        m_stats.averageTaskTime = (m_stats.averageTaskTime * (m_stats.totalTasksProcessed - 1) + processingTime) / m_stats.totalTasksProcessed;
+        if (task->range) {
+            RangeJob* job = task->range;
+            const bool lastChunk = job->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1;
+            if (counter) {
+                counter->Done();
+            }
+            if (lastChunk) {
+                delete job;
+            }
+            return;
+        }
         
-        // Calculate queue time
-        auto currentTime = std::chrono::steady_clock::now();
-        float queueTime = std::chrono::duration<float, std::milli>(currentTime - task.submitTime).count();
-        m_stats.averageQueueTime = (m_stats.averageQueueTime * (m_stats.totalTasksProcessed - 1) + queueTime) / m_stats.totalTasksProcessed;
+        delete task;
+        if (counter) {
+            counter->Done();
+        }
+    }
+
+    void AnimationThreadPool::WakeWorkers(size_t count) {
+        if (m_sleepingWorkers.load() == 0) {
+            return;
+        }
         
-        // Update tasks per second
-        auto timeSinceLastUpdate = std::chrono::duration<float>(currentTime - m_lastStatsUpdate).count();
-        if (timeSinceLastUpdate >= 1.0f) {
-            m_stats.tasksPerSecond = static_cast<size_t>(m_stats.totalTasksProcessed / timeSinceLastUpdate);
-            m_lastStatsUpdate = currentTime;
+        // Taking the lock orders this wake after a worker's predicate check
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+        }
+        if (count == 1) {
+            m_wakeCondition.notify_one();
+        } else {
+            m_wakeCondition.notify_all();
         }
     }
 
-    bool AnimationThreadPool::StealWork(AnimationTask& task, size_t threadId) {
-        // Try to steal work from other threads
-        for (size_t i = 0; i < m_workStealingQueues.size(); ++i) {
-            if (i == threadId) continue;
+    bool AnimationThreadPool::StealWork(QueuedTask*& task, size_t threadId) {
+        const size_t queueCount = m_workerQueues.size();
+        if (queueCount == 0) {
+            return false;
+        }
+        
+        // Start after our own slot so thieves spread over different victims
+        const size_t start = threadId == NO_WORKER ? 0 : threadId + 1;
+        for (size_t i = 0; i < queueCount; ++i) {
+            const size_t victim = (start + i) % queueCount;
+            if (victim == threadId) {
+                continue;
+            }
             
-            std::lock_guard<std::mutex> lock(*m_workStealingMutexes[i]);
-            if (!m_workStealingQueues[i].empty()) {
-                task = m_workStealingQueues[i].front();
-                m_workStealingQueues[i].pop();
+            if (m_workerQueues[victim]->Steal(task)) {
                 return true;
             }
         }
@@ -325,11 +635,6 @@ namespace Animation {
         return false;
     }
 
-    void AnimationThreadPool::DistributeWork() {
-        // Distribute work among work stealing queues
-        // This would be called periodically to balance load
-    }
-
     // MultiThreadedAnimationManager implementation
     MultiThreadedAnimationManager::MultiThreadedAnimationManager() {
         LOG_INFO("MultiThreadedAnimationManager created");
@@ -345,6 +650,7 @@ namespace Animation {
         
         // Initialize thread pool
         m_threadPool = std::make_unique<AnimationThreadPool>();
+        m_threadPool->SetJobSystem(m_jobSystem);
         if (!m_threadPool->Initialize(config)) {
             LOG_ERROR("Failed to initialize animation thread pool");
             return false;
@@ -360,10 +666,12 @@ namespace Animation {
         LOG_INFO("Shutting down MultiThreadedAnimationManager");
         
         if (m_threadPool) {
+            m_threadPool->Wait(m_batchedUpdates);
             m_threadPool->Shutdown();
             m_threadPool.reset();
         }
         
+        m_batchedControllers.clear();
         m_instances.clear();
         
         LOG_INFO("MultiThreadedAnimationManager shutdown complete");
@@ -467,20 +775,14 @@ namespace Animation {
         // Balance workload
         BalanceWorkload(batches);
         
-        // Submit batches to thread pool
-        std::vector<std::future<void>> futures;
-        futures.reserve(batches.size());
-        
-        for (const auto& batch : batches) {
-            futures.push_back(m_threadPool->SubmitBatch(batch));
-        }
-        
-        // Wait for all batches to complete
-        for (auto& future : futures) {
-            future.wait();
-        }
+        // One range over the batches: a single injection lock, no per-batch futures
+        m_threadPool->ParallelFor(batches.size(), 1, [this, &batches](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                ProcessBatch(batches[i]);
+            }
+        });
         
-        auto endTime = std::chrono::high_resolution_clock::now();
+        auto endTime = std::chrono::steady_clock::now();
         float updateTime = std::chrono::duration<float, std::milli>(endTime - startTime).count();
         
         // Update statistics
@@ -507,39 +809,45 @@ namespace Animation {
             batchSize = m_maxBatchSize;
         }
         
-        std::vector<AnimationInstance*> instancesToUpdate;
+        // The previous batched update may still be reading m_batchedControllers
+        if (m_threadPool) {
+            m_threadPool->Wait(m_batchedUpdates);
+        }
+        
+        m_batchedControllers.clear();
         {
             std::lock_guard<std::mutex> lock(m_instancesMutex);
+            m_batchedControllers.reserve(m_instances.size());
             for (auto& pair : m_instances) {
-                if (pair.second.needsUpdate) {
-                    instancesToUpdate.push_back(&pair.second);
+                if (pair.second.needsUpdate && pair.second.controller) {
+                    m_batchedControllers.push_back(pair.second.controller);
                 }
             }
         }
         
-        // Process in batches
-        for (size_t i = 0; i < instancesToUpdate.size(); i += batchSize) {
-            size_t endIdx = std::min(i + batchSize, instancesToUpdate.size());
-            
-            AnimationBatch batch;
-            batch.deltaTime = deltaTime;
-            batch.priority = AnimationTaskPriority::Normal;
-            
-            for (size_t j = i; j < endIdx; ++j) {
-                batch.controllers.push_back(instancesToUpdate[j]->controller);
-                batch.instanceIds.push_back(instancesToUpdate[j]->instanceId);
-            }
-            
-            if (m_threadPool) {
-                m_threadPool->SubmitBatch(batch);
-            } else {
-                ProcessBatch(batch);
+        if (m_batchedControllers.empty()) {
+            return;
+        }
+        
+        if (!m_threadPool) {
+            for (const auto& controller : m_batchedControllers) {
+                controller->Update(deltaTime);
             }
+            return;
         }
+        
+        // Queued as one range of batchSize chunks; completes asynchronously, see WaitForAnimationUpdates
+        m_threadPool->SubmitRange(m_batchedControllers.size(), batchSize,
+            [this, deltaTime](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    m_batchedControllers[i]->Update(deltaTime);
+                }
+            }, m_batchedUpdates);
     }
 
     void MultiThreadedAnimationManager::WaitForAnimationUpdates() {
         if (m_threadPool) {
+            m_threadPool->Wait(m_batchedUpdates);
             m_threadPool->WaitForAll();
         }
     }
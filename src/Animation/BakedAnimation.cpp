@@ -0,0 +1,117 @@
+#include "Animation/BakedAnimation.h"
+#include "Animation/PoseBlendKernels.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace GameEngine {
+namespace Animation {
+
+    namespace {
+        constexpr size_t FLOATS_PER_VEC3 = 3;
+        constexpr size_t FLOATS_PER_QUAT = 4;
+        constexpr size_t FLOATS_PER_BONE = FLOATS_PER_VEC3 * 2 + FLOATS_PER_QUAT;
+    }
+
+    std::shared_ptr<BakedAnimation> BakedAnimation::Bake(const SkeletalAnimation& animation,
+                                                         const std::shared_ptr<const PoseLayout>& layout,
+                                                         float sampleRate) {
+        if (!layout) {
+            LOG_ERROR("BakedAnimation: cannot bake '" + animation.GetName() + "' without a pose layout");
+            return nullptr;
+        }
+
+        auto baked = std::make_shared<BakedAnimation>();
+        baked->m_name = animation.GetName();
+        baked->m_duration = std::max(animation.GetDuration(), 0.0f);
+        baked->m_sampleRate = sampleRate > 0.0f ? sampleRate : std::max(animation.GetFrameRate(), 1.0f);
+        baked->m_frameCount = static_cast<size_t>(std::ceil(baked->m_duration * baked->m_sampleRate)) + 1;
+
+        const size_t boneCount = layout->GetBoneCount();
+        baked->m_boneNames.reserve(boneCount);
+        for (size_t i = 0; i < boneCount; ++i) {
+            baked->m_boneNames.push_back(layout->GetBoneName(i));
+        }
+
+        baked->m_frameStride = boneCount * FLOATS_PER_BONE;
+        baked->m_frameData.resize(baked->m_frameCount * baked->m_frameStride);
+
+        const AnimationBinding binding = AnimationBinding::Create(animation, *layout);
+        AnimationCursor cursor;
+        IndexedPose pose(layout);
+
+        for (size_t frame = 0; frame < baked->m_frameCount; ++frame) {
+            // The last frame lands exactly on the clip end even when duration * rate is fractional
+            float time = std::min(static_cast<float>(frame) / baked->m_sampleRate, baked->m_duration);
+            PoseEvaluator::EvaluateAnimation(animation, binding, time, cursor, pose);
+
+            float* frameData = baked->m_frameData.data() + frame * baked->m_frameStride;
+            std::memcpy(frameData, pose.GetTranslations().data(), boneCount * sizeof(Math::Vec3));
+            frameData += boneCount * FLOATS_PER_VEC3;
+            std::memcpy(frameData, pose.GetRotations().data(), boneCount * sizeof(Math::Quat));
+            frameData += boneCount * FLOATS_PER_QUAT;
+            std::memcpy(frameData, pose.GetScales().data(), boneCount * sizeof(Math::Vec3));
+        }
+
+        return baked;
+    }
+
+    void BakedAnimation::Sample(float time, IndexedPose& outPose) const {
+        const size_t boneCount = GetBoneCount();
+        if (outPose.GetBoneCount() != boneCount || m_frameCount == 0) {
+            LOG_ERROR("BakedAnimation::Sample: pose does not match baked clip '" + m_name + "'");
+            return;
+        }
+
+        const float clampedTime = std::clamp(time, 0.0f, m_duration);
+        const size_t lastFrame = m_frameCount - 1;
+        const size_t frame0 = std::min(static_cast<size_t>(clampedTime * m_sampleRate), lastFrame);
+        const size_t frame1 = std::min(frame0 + 1, lastFrame);
+
+        // The last segment ends at the clip end, so it is shorter when duration * rate is fractional
+        const float time0 = static_cast<float>(frame0) / m_sampleRate;
+        const float time1 = std::min(static_cast<float>(frame1) / m_sampleRate, m_duration);
+        const float alpha = time1 > time0 ? std::clamp((clampedTime - time0) / (time1 - time0), 0.0f, 1.0f) : 0.0f;
+
+        PoseBlendKernels::LerpVectors(GetTranslations(frame0), GetTranslations(frame1), outPose.GetTranslations().data(), boneCount, alpha);
+        PoseBlendKernels::NlerpRotations(GetRotations(frame0), GetRotations(frame1), outPose.GetRotations().data(), boneCount, alpha);
+        PoseBlendKernels::LerpVectors(GetScales(frame0), GetScales(frame1), outPose.GetScales().data(), boneCount, alpha);
+    }
+
+    bool BakedAnimation::IsCompatibleWith(const PoseLayout& layout) const {
+        if (layout.GetBoneCount() != GetBoneCount()) {
+            return false;
+        }
+
+        for (size_t i = 0; i < m_boneNames.size(); ++i) {
+            if (layout.GetBoneName(i) != m_boneNames[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t BakedAnimation::GetMemoryUsage() const {
+        size_t usage = sizeof(BakedAnimation);
+        usage += m_frameData.capacity() * sizeof(float);
+        for (const auto& name : m_boneNames) {
+            usage += name.capacity();
+        }
+        return usage;
+    }
+
+    const Math::Vec3* BakedAnimation::GetTranslations(size_t frame) const {
+        return reinterpret_cast<const Math::Vec3*>(m_frameData.data() + frame * m_frameStride);
+    }
+
+    const Math::Quat* BakedAnimation::GetRotations(size_t frame) const {
+        return reinterpret_cast<const Math::Quat*>(m_frameData.data() + frame * m_frameStride + GetBoneCount() * FLOATS_PER_VEC3);
+    }
+
+    const Math::Vec3* BakedAnimation::GetScales(size_t frame) const {
+        return reinterpret_cast<const Math::Vec3*>(m_frameData.data() + frame * m_frameStride + GetBoneCount() * (FLOATS_PER_VEC3 + FLOATS_PER_QUAT));
+    }
+
+} // namespace Animation
+} // namespace GameEngine
@@ -0,0 +1,274 @@
+#include "Animation/IndexedPose.h"
+#include "Animation/PoseBlendKernels.h"
+#include "Core/Logger.h"
+#include <algorithm>
+
+namespace GameEngine {
+namespace Animation {
+
+    namespace {
+        // Compose T * R * S without building and multiplying three 4x4 matrices
+        inline Math::Mat4 ComposeMatrix(const Math::Vec3& translation, const Math::Quat& rotation, const Math::Vec3& scale) {
+            Math::Mat3 rotationMatrix = glm::mat3_cast(rotation);
+            Math::Mat4 result;
+            result[0] = Math::Vec4(rotationMatrix[0] * scale.x, 0.0f);
+            result[1] = Math::Vec4(rotationMatrix[1] * scale.y, 0.0f);
+            result[2] = Math::Vec4(rotationMatrix[2] * scale.z, 0.0f);
+            result[3] = Math::Vec4(translation, 1.0f);
+            return result;
+        }
+    }
+
+    // PoseLayout implementation
+    std::shared_ptr<const PoseLayout> PoseLayout::Create(const AnimationSkeleton& skeleton) {
+        auto layout = std::make_shared<PoseLayout>();
+        const auto& bones = skeleton.GetAllBones();
+        const size_t boneCount = bones.size();
+
+        layout->m_boneNames.reserve(boneCount);
+        layout->m_boneIds.reserve(boneCount);
+        layout->m_parentIndices.assign(boneCount, -1);
+        layout->m_bindTranslations.resize(boneCount);
+        layout->m_bindRotations.resize(boneCount);
+        layout->m_bindScales.resize(boneCount);
+        layout->m_inverseBindPoses.resize(boneCount);
+
+        for (size_t i = 0; i < boneCount; ++i) {
+            const auto& bone = bones[i];
+            layout->m_boneNames.push_back(bone->GetName());
+            layout->m_boneIds.push_back(bone->GetId());
+            layout->m_indicesByName[bone->GetName()] = static_cast<int32_t>(i);
+            layout->m_indicesById[bone->GetId()] = static_cast<int32_t>(i);
+
+            Bone::DecomposeTransform(bone->GetBindPose(),
+                                     layout->m_bindTranslations[i],
+                                     layout->m_bindRotations[i],
+                                     layout->m_bindScales[i]);
+            layout->m_inverseBindPoses[i] = bone->GetInverseBindPose();
+        }
+
+        // Resolve parent indices
+        std::vector<std::vector<int32_t>> children(boneCount);
+        for (size_t i = 0; i < boneCount; ++i) {
+            if (auto parent = bones[i]->GetParent()) {
+                int32_t parentIndex = layout->GetBoneIndexById(parent->GetId());
+                if (parentIndex >= 0) {
+                    layout->m_parentIndices[i] = parentIndex;
+                    children[parentIndex].push_back(static_cast<int32_t>(i));
+                }
+            }
+        }
+
+        // Breadth-first walk from the roots so every parent precedes its children
+        layout->m_evaluationOrder.reserve(boneCount);
+        for (size_t i = 0; i < boneCount; ++i) {
+            if (layout->m_parentIndices[i] < 0) {
+                layout->m_evaluationOrder.push_back(static_cast<int32_t>(i));
+            }
+        }
+        for (size_t cursor = 0; cursor < layout->m_evaluationOrder.size(); ++cursor) {
+            int32_t boneIndex = layout->m_evaluationOrder[cursor];
+            for (int32_t child : children[boneIndex]) {
+                layout->m_evaluationOrder.push_back(child);
+            }
+        }
+
+        if (layout->m_evaluationOrder.size() != boneCount) {
+            LOG_WARNING("PoseLayout: skeleton '" + skeleton.GetName() + "' contains a bone cycle; unreachable bones are evaluated as roots");
+            std::vector<bool> visited(boneCount, false);
+            for (int32_t index : layout->m_evaluationOrder) {
+                visited[index] = true;
+            }
+            for (size_t i = 0; i < boneCount; ++i) {
+                if (!visited[i]) {
+                    layout->m_parentIndices[i] = -1;
+                    layout->m_evaluationOrder.push_back(static_cast<int32_t>(i));
+                }
+            }
+        }
+
+        return layout;
+    }
+
+    int32_t PoseLayout::GetBoneIndex(const std::string& boneName) const {
+        auto it = m_indicesByName.find(boneName);
+        return (it != m_indicesByName.end()) ? it->second : -1;
+    }
+
+    int32_t PoseLayout::GetBoneIndexById(int32_t boneId) const {
+        auto it = m_indicesById.find(boneId);
+        return (it != m_indicesById.end()) ? it->second : -1;
+    }
+
+    // AnimationBinding implementation
+    AnimationBinding AnimationBinding::Create(const SkeletalAnimation& animation, const PoseLayout& layout) {
+        AnimationBinding binding;
+        binding.entries.reserve(animation.GetBoneAnimations().size());
+
+        for (const auto& [boneName, boneAnimation] : animation.GetBoneAnimations()) {
+            if (!boneAnimation || !boneAnimation->HasAnyTracks()) {
+                continue;
+            }
+
+            int32_t boneIndex = layout.GetBoneIndex(boneName);
+            if (boneIndex < 0) {
+                continue;
+            }
+
+            binding.entries.push_back({boneAnimation.get(), boneIndex});
+        }
+
+        // Sorted by bone index so sampling writes the pose arrays front to back
+        std::sort(binding.entries.begin(), binding.entries.end(),
+                  [](const Entry& a, const Entry& b) { return a.boneIndex < b.boneIndex; });
+
+        return binding;
+    }
+
+    // IndexedPose implementation
+    IndexedPose::IndexedPose(std::shared_ptr<const PoseLayout> layout) {
+        SetLayout(std::move(layout));
+    }
+
+    void IndexedPose::SetLayout(std::shared_ptr<const PoseLayout> layout) {
+        m_layout = std::move(layout);
+        ResetToBindPose();
+    }
+
+    bool IndexedPose::IsCompatibleWith(const IndexedPose& other) const {
+        return m_layout == other.m_layout && GetBoneCount() == other.GetBoneCount();
+    }
+
+    void IndexedPose::SetBoneTransform(size_t index, const BoneTransform& transform) {
+        if (index >= GetBoneCount()) {
+            return;
+        }
+
+        m_translations[index] = transform.position;
+        m_rotations[index] = transform.rotation;
+        m_scales[index] = transform.scale;
+    }
+
+    BoneTransform IndexedPose::GetBoneTransform(size_t index) const {
+        if (index >= GetBoneCount()) {
+            return BoneTransform();
+        }
+
+        return BoneTransform(m_translations[index], m_rotations[index], m_scales[index]);
+    }
+
+    void IndexedPose::ResetToBindPose() {
+        if (!m_layout) {
+            Resize(0);
+            return;
+        }
+
+        m_translations = m_layout->GetBindTranslations();
+        m_rotations = m_layout->GetBindRotations();
+        m_scales = m_layout->GetBindScales();
+    }
+
+    void IndexedPose::ResetToIdentity() {
+        std::fill(m_translations.begin(), m_translations.end(), Math::Vec3(0.0f));
+        std::fill(m_rotations.begin(), m_rotations.end(), Math::Quat(1.0f, 0.0f, 0.0f, 0.0f));
+        std::fill(m_scales.begin(), m_scales.end(), Math::Vec3(1.0f));
+    }
+
+    void IndexedPose::Blend(const IndexedPose& poseA, const IndexedPose& poseB, float weight, IndexedPose& outPose) {
+        if (!poseA.IsCompatibleWith(poseB)) {
+            LOG_ERROR("IndexedPose::Blend: poses do not share a layout");
+            return;
+        }
+
+        const size_t boneCount = poseA.GetBoneCount();
+        if (&outPose != &poseA && &outPose != &poseB) {
+            outPose.m_layout = poseA.m_layout;
+            outPose.Resize(boneCount);
+        }
+
+        PoseBlendKernels::LerpVectors(poseA.m_translations.data(), poseB.m_translations.data(), outPose.m_translations.data(), boneCount, weight);
+        PoseBlendKernels::NlerpRotations(poseA.m_rotations.data(), poseB.m_rotations.data(), outPose.m_rotations.data(), boneCount, weight);
+        PoseBlendKernels::LerpVectors(poseA.m_scales.data(), poseB.m_scales.data(), outPose.m_scales.data(), boneCount, weight);
+    }
+
+    void IndexedPose::BlendAdditive(const IndexedPose& basePose, const IndexedPose& additivePose, float weight, IndexedPose& outPose) {
+        if (!basePose.IsCompatibleWith(additivePose)) {
+            LOG_ERROR("IndexedPose::BlendAdditive: poses do not share a layout");
+            return;
+        }
+
+        const size_t boneCount = basePose.GetBoneCount();
+        if (&outPose != &basePose && &outPose != &additivePose) {
+            outPose.m_layout = basePose.m_layout;
+            outPose.Resize(boneCount);
+        }
+
+        // Same semantics as BoneTransform: base + additive * weight
+        PoseBlendKernels::AddVectors(basePose.m_translations.data(), additivePose.m_translations.data(), outPose.m_translations.data(), boneCount, weight);
+        PoseBlendKernels::AddRotations(basePose.m_rotations.data(), additivePose.m_rotations.data(), outPose.m_rotations.data(), boneCount, weight);
+        PoseBlendKernels::AddScales(basePose.m_scales.data(), additivePose.m_scales.data(), outPose.m_scales.data(), boneCount, weight);
+    }
+
+    void IndexedPose::BlendWith(const IndexedPose& other, float weight) {
+        Blend(*this, other, weight, *this);
+    }
+
+    void IndexedPose::BlendAdditiveWith(const IndexedPose& additive, float weight) {
+        BlendAdditive(*this, additive, weight, *this);
+    }
+
+    void IndexedPose::EvaluateLocalToWorld(std::vector<Math::Mat4>& outWorldMatrices) const {
+        const size_t boneCount = GetBoneCount();
+        outWorldMatrices.resize(boneCount);
+        if (!m_layout || boneCount == 0) {
+            return;
+        }
+
+        const auto& parentIndices = m_layout->GetParentIndices();
+        for (int32_t boneIndex : m_layout->GetEvaluationOrder()) {
+            Math::Mat4 local = ComposeMatrix(m_translations[boneIndex], m_rotations[boneIndex], m_scales[boneIndex]);
+            int32_t parentIndex = parentIndices[boneIndex];
+            outWorldMatrices[boneIndex] = (parentIndex >= 0) ? outWorldMatrices[parentIndex] * local : local;
+        }
+    }
+
+    void IndexedPose::GetSkinningMatrices(std::vector<Math::Mat4>& outMatrices) const {
+        EvaluateLocalToWorld(outMatrices);
+        if (!m_layout) {
+            return;
+        }
+
+        const auto& inverseBindPoses = m_layout->GetInverseBindPoses();
+        for (size_t i = 0; i < outMatrices.size(); ++i) {
+            outMatrices[i] = outMatrices[i] * inverseBindPoses[i];
+        }
+    }
+
+    void IndexedPose::FromPose(const Pose& pose) {
+        if (!m_layout) {
+            return;
+        }
+
+        for (size_t i = 0; i < GetBoneCount(); ++i) {
+            SetBoneTransform(i, pose.GetBoneTransform(m_layout->GetBoneName(i)));
+        }
+    }
+
+    void IndexedPose::ToPose(Pose& outPose) const {
+        if (!m_layout) {
+            return;
+        }
+
+        for (size_t i = 0; i < GetBoneCount(); ++i) {
+            outPose.SetBoneTransform(m_layout->GetBoneName(i), GetBoneTransform(i));
+        }
+    }
+
+    void IndexedPose::Resize(size_t boneCount) {
+        m_translations.resize(boneCount, Math::Vec3(0.0f));
+        m_rotations.resize(boneCount, Math::Quat(1.0f, 0.0f, 0.0f, 0.0f));
+        m_scales.resize(boneCount, Math::Vec3(1.0f));
+    }
+
+} // namespace Animation
+} // namespace GameEngine
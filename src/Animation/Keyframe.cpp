@@ -54,8 +54,29 @@ namespace Animation {
             return m_keyframes.back().value;
         }
 
-        // Find surrounding keyframes
-        size_t index = FindKeyframeIndex(time);
+        return SampleSegment(FindKeyframeIndex(time), time);
+    }
+
+    template<typename T>
+    T AnimationTrack<T>::SampleAt(float time, KeyframeCursor& cursor) const {
+        if (m_keyframes.empty()) {
+            return T{};
+        }
+
+        // Clamp time to valid range; the cursor keeps its position for the next sample
+        if (time <= GetStartTime()) {
+            return m_keyframes.front().value;
+        }
+        if (time >= GetEndTime()) {
+            return m_keyframes.back().value;
+        }
+
+        cursor.index = FindKeyframeIndex(time, cursor.index);
+        return SampleSegment(cursor.index, time);
+    }
+
+    template<typename T>
+    T AnimationTrack<T>::SampleSegment(size_t index, float time) const {
         if (index >= m_keyframes.size() - 1) {
             return m_keyframes.back().value;
         }
@@ -144,12 +165,33 @@ namespace Animation {
 
     template<typename T>
     size_t AnimationTrack<T>::FindKeyframeIndex(float time) const {
-        for (size_t i = 0; i < m_keyframes.size(); ++i) {
-            if (m_keyframes[i].time > time) {
-                return i > 0 ? i - 1 : 0;
+        // Last keyframe whose time is <= time (keyframes are kept sorted)
+        auto it = std::upper_bound(m_keyframes.begin(), m_keyframes.end(), time,
+                                   [](float value, const Keyframe<T>& keyframe) { return value < keyframe.time; });
+        return it == m_keyframes.begin() ? 0 : static_cast<size_t>(it - m_keyframes.begin()) - 1;
+    }
+
+    template<typename T>
+    size_t AnimationTrack<T>::FindKeyframeIndex(float time, size_t hint) const {
+        // Playback usually advances by less than a key per frame, so probe a few keys
+        // forward from the previous result before falling back to a binary search
+        constexpr size_t MaxForwardSteps = 4;
+
+        const size_t count = m_keyframes.size();
+        if (hint >= count || m_keyframes[hint].time > time) {
+            return FindKeyframeIndex(time); // Seek backwards or loop wrap
+        }
+
+        for (size_t step = 0; step < MaxForwardSteps; ++step) {
+            if (hint + 1 >= count || m_keyframes[hint + 1].time > time) {
+                return hint;
             }
+            ++hint;
         }
-        return m_keyframes.size() > 0 ? m_keyframes.size() - 1 : 0;
+
+        auto it = std::upper_bound(m_keyframes.begin() + hint, m_keyframes.end(), time,
+                                   [](float value, const Keyframe<T>& keyframe) { return value < keyframe.time; });
+        return static_cast<size_t>(it - m_keyframes.begin()) - 1;
     }
 
     template<typename T>
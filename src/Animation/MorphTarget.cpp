@@ -43,7 +43,7 @@ namespace GameEngine {
             return;
         }
 
-        auto vertices = mesh.GetVertices();
+        auto vertices = mesh.DecodeVertices();
         ApplyToVertices(const_cast<std::vector<Vertex>&>(vertices), weight);
         mesh.SetVertices(vertices);
     }
@@ -286,7 +286,7 @@ namespace GameEngine {
     }
 
     void MorphTargetController::ApplyToMesh(Mesh& mesh) const {
-        auto vertices = mesh.GetVertices();
+        auto vertices = mesh.DecodeVertices();
         ApplyToVertices(const_cast<std::vector<Vertex>&>(vertices));
         mesh.SetVertices(vertices);
     }
@@ -1,4 +1,6 @@
 #include "Animation/Pose.h"
+#include "Animation/IndexedPose.h"
+#include "Animation/PoseBlendKernels.h"
 #include "Animation/SkeletalAnimation.h"
 #include "Core/Logger.h"
 #include <algorithm>
@@ -7,6 +9,40 @@
 namespace GameEngine {
 namespace Animation {
 
+    namespace {
+        // Gather arrays for the batch blends, per thread so poses can blend on any worker.
+        // Reused across calls; only the first blends on a thread allocate.
+        struct PoseBlendScratch {
+            std::vector<const std::string*> boneNames;
+            std::vector<Math::Vec3> positionsA, positionsB, scalesA, scalesB;
+            std::vector<Math::Quat> rotationsA, rotationsB;
+
+            PoseBlendScratch& Reset(size_t capacity) {
+                boneNames.clear();
+                positionsA.clear(); positionsB.clear();
+                rotationsA.clear(); rotationsB.clear();
+                scalesA.clear(); scalesB.clear();
+                boneNames.reserve(capacity);
+                positionsA.reserve(capacity); positionsB.reserve(capacity);
+                rotationsA.reserve(capacity); rotationsB.reserve(capacity);
+                scalesA.reserve(capacity); scalesB.reserve(capacity);
+                return *this;
+            }
+
+            void Gather(const std::string& boneName, const BoneTransform& transformA, const BoneTransform& transformB) {
+                boneNames.push_back(&boneName);
+                positionsA.push_back(transformA.position);
+                rotationsA.push_back(transformA.rotation);
+                scalesA.push_back(transformA.scale);
+                positionsB.push_back(transformB.position);
+                rotationsB.push_back(transformB.rotation);
+                scalesB.push_back(transformB.scale);
+            }
+        };
+
+        thread_local PoseBlendScratch t_blendScratch;
+    }
+
     // BoneTransform implementation
     Math::Mat4 BoneTransform::ToMatrix() const {
         Math::Mat4 translationMatrix = glm::translate(Math::Mat4(1.0f), position);
@@ -208,21 +244,27 @@ namespace Animation {
         // Set skeleton from poseA (assuming they're compatible)
         result.SetSkeleton(poseA.GetSkeleton());
         
-        // Blend all bone transforms
+        // Gather both sides into contiguous arrays so the batch kernels blend every bone at once
+        PoseBlendScratch& scratch = t_blendScratch.Reset(poseA.m_boneTransforms.size() + poseB.m_boneTransforms.size());
         for (const auto& [boneName, transformA] : poseA.m_boneTransforms) {
-            BoneTransform transformB = poseB.GetBoneTransform(boneName);
-            BoneTransform blended = BoneTransform::Lerp(transformA, transformB, weight);
-            result.SetBoneTransform(boneName, blended);
+            scratch.Gather(boneName, transformA, poseB.GetBoneTransform(boneName));
         }
         
         // Handle bones that exist only in poseB
         for (const auto& [boneName, transformB] : poseB.m_boneTransforms) {
             if (!poseA.HasBoneTransform(boneName)) {
-                BoneTransform bindPose = result.GetBindPoseTransform(boneName);
-                BoneTransform blended = BoneTransform::Lerp(bindPose, transformB, weight);
-                result.SetBoneTransform(boneName, blended);
+                scratch.Gather(boneName, result.GetBindPoseTransform(boneName), transformB);
             }
         }
+
+        const size_t count = scratch.boneNames.size();
+        PoseBlendKernels::LerpVectors(scratch.positionsA.data(), scratch.positionsB.data(), scratch.positionsA.data(), count, weight);
+        PoseBlendKernels::NlerpRotations(scratch.rotationsA.data(), scratch.rotationsB.data(), scratch.rotationsA.data(), count, weight);
+        PoseBlendKernels::LerpVectors(scratch.scalesA.data(), scratch.scalesB.data(), scratch.scalesA.data(), count, weight);
+
+        for (size_t i = 0; i < count; ++i) {
+            result.SetBoneTransform(*scratch.boneNames[i], BoneTransform(scratch.positionsA[i], scratch.rotationsA[i], scratch.scalesA[i]));
+        }
         
         return result;
     }
@@ -230,12 +272,20 @@ namespace Animation {
     Pose Pose::BlendAdditive(const Pose& basePose, const Pose& additivePose, float weight) {
         Pose result = basePose;
         
-        // Apply additive transforms
+        // A holds the base, B the additive side
+        PoseBlendScratch& scratch = t_blendScratch.Reset(additivePose.m_boneTransforms.size());
         for (const auto& [boneName, additiveTransform] : additivePose.m_boneTransforms) {
-            BoneTransform baseTransform = result.GetBoneTransform(boneName);
-            BoneTransform weightedAdditive = additiveTransform * weight;
-            BoneTransform blended = baseTransform + weightedAdditive;
-            result.SetBoneTransform(boneName, blended);
+            scratch.Gather(boneName, result.GetBoneTransform(boneName), additiveTransform);
+        }
+
+        // Apply additive transforms (base + additive * weight)
+        const size_t count = scratch.boneNames.size();
+        PoseBlendKernels::AddVectors(scratch.positionsA.data(), scratch.positionsB.data(), scratch.positionsA.data(), count, weight);
+        PoseBlendKernels::AddRotations(scratch.rotationsA.data(), scratch.rotationsB.data(), scratch.rotationsA.data(), count, weight);
+        PoseBlendKernels::AddScales(scratch.scalesA.data(), scratch.scalesB.data(), scratch.scalesA.data(), count, weight);
+
+        for (size_t i = 0; i < count; ++i) {
+            result.SetBoneTransform(*scratch.boneNames[i], BoneTransform(scratch.positionsA[i], scratch.rotationsA[i], scratch.scalesA[i]));
         }
         
         return result;
@@ -439,6 +489,56 @@ namespace Animation {
         return pose;
     }
 
+    void PoseEvaluator::EvaluateAnimation(const SkeletalAnimation& animation, const AnimationBinding& binding, float time, IndexedPose& outPose) {
+        outPose.ResetToBindPose();
+
+        auto& translations = outPose.GetTranslations();
+        auto& rotations = outPose.GetRotations();
+        auto& scales = outPose.GetScales();
+        const float wrappedTime = animation.WrapTime(time);
+
+        // Animated bones start from identity and take whichever channels are present,
+        // matching EvaluateBoneAnimation for the name-keyed path
+        for (const auto& entry : binding.entries) {
+            const BoneAnimation& boneAnimation = *entry.boneAnimation;
+            const size_t boneIndex = static_cast<size_t>(entry.boneIndex);
+
+            translations[boneIndex] = boneAnimation.HasPositionTrack()
+                ? boneAnimation.positionTrack->SampleAt(wrappedTime) : Math::Vec3(0.0f);
+            rotations[boneIndex] = boneAnimation.HasRotationTrack()
+                ? boneAnimation.rotationTrack->SampleAt(wrappedTime) : Math::Quat(1.0f, 0.0f, 0.0f, 0.0f);
+            scales[boneIndex] = boneAnimation.HasScaleTrack()
+                ? boneAnimation.scaleTrack->SampleAt(wrappedTime) : Math::Vec3(1.0f);
+        }
+    }
+
+    void PoseEvaluator::EvaluateAnimation(const SkeletalAnimation& animation, const AnimationBinding& binding, float time, AnimationCursor& cursor, IndexedPose& outPose) {
+        if (cursor.bones.size() != binding.entries.size()) {
+            cursor.bones.assign(binding.entries.size(), BoneAnimationCursor());
+        }
+
+        outPose.ResetToBindPose();
+
+        auto& translations = outPose.GetTranslations();
+        auto& rotations = outPose.GetRotations();
+        auto& scales = outPose.GetScales();
+        const float wrappedTime = animation.WrapTime(time);
+
+        for (size_t i = 0; i < binding.entries.size(); ++i) {
+            const auto& entry = binding.entries[i];
+            const BoneAnimation& boneAnimation = *entry.boneAnimation;
+            const size_t boneIndex = static_cast<size_t>(entry.boneIndex);
+            BoneAnimationCursor& boneCursor = cursor.bones[i];
+
+            translations[boneIndex] = boneAnimation.HasPositionTrack()
+                ? boneAnimation.positionTrack->SampleAt(wrappedTime, boneCursor.position) : Math::Vec3(0.0f);
+            rotations[boneIndex] = boneAnimation.HasRotationTrack()
+                ? boneAnimation.rotationTrack->SampleAt(wrappedTime, boneCursor.rotation) : Math::Quat(1.0f, 0.0f, 0.0f, 0.0f);
+            scales[boneIndex] = boneAnimation.HasScaleTrack()
+                ? boneAnimation.scaleTrack->SampleAt(wrappedTime, boneCursor.scale) : Math::Vec3(1.0f);
+        }
+    }
+
     Pose PoseEvaluator::EvaluateAnimationLayers(const std::vector<AnimationLayer>& layers, std::shared_ptr<AnimationSkeleton> skeleton) {
         if (layers.empty()) {
             return Pose(skeleton);
@@ -0,0 +1,529 @@
+#include "Animation/PoseBlendKernels.h"
+#include "Core/Logger.h"
+#include <atomic>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define GAMEENGINE_POSE_KERNELS_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #define POSE_KERNEL_TARGET_SSE2
+        #define POSE_KERNEL_TARGET_AVX2
+    #else
+        #define POSE_KERNEL_TARGET_SSE2 __attribute__((target("sse2")))
+        #define POSE_KERNEL_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+namespace GameEngine {
+namespace Animation {
+
+    namespace {
+        static_assert(sizeof(Math::Vec3) == 3 * sizeof(float), "Pose kernels require tightly packed Vec3");
+        static_assert(sizeof(Math::Quat) == 4 * sizeof(float), "Pose kernels require tightly packed Quat");
+
+        // Memory order of glm::quat components
+#ifdef GLM_FORCE_QUAT_DATA_WXYZ
+        constexpr int QX = 1, QY = 2, QZ = 3, QW = 0;
+#else
+        constexpr int QX = 0, QY = 1, QZ = 2, QW = 3;
+#endif
+
+        using FloatKernel = void (*)(const float*, const float*, float*, size_t, float);
+
+        struct KernelTable {
+            SimdLevel level;
+            FloatKernel lerp;
+            FloatKernel add;
+            FloatKernel addScale;
+            FloatKernel nlerpQuat;
+            FloatKernel addQuat;
+        };
+
+        // ---------------------------------------------------------------------------------
+        // Scalar reference kernels. SIMD variants must mirror the operation order exactly.
+        // ---------------------------------------------------------------------------------
+
+        void LerpScalar(const float* a, const float* b, float* out, size_t count, float t) {
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = a[i] + (b[i] - a[i]) * t;
+            }
+        }
+
+        void AddScalar(const float* base, const float* additive, float* out, size_t count, float weight) {
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = base[i] + additive[i] * weight;
+            }
+        }
+
+        void AddScaleScalar(const float* base, const float* additive, float* out, size_t count, float weight) {
+            for (size_t i = 0; i < count; ++i) {
+                out[i] = base[i] * (1.0f + (additive[i] - 1.0f) * weight);
+            }
+        }
+
+        inline void NormalizeQuat(const float r[4], const float fallback[4], float* out) {
+            float lengthSq = r[0] * r[0] + r[1] * r[1] + r[2] * r[2] + r[3] * r[3];
+            if (lengthSq > 1e-12f) {
+                float invLength = 1.0f / std::sqrt(lengthSq);
+                for (int c = 0; c < 4; ++c) {
+                    out[c] = r[c] * invLength;
+                }
+            } else {
+                for (int c = 0; c < 4; ++c) {
+                    out[c] = fallback[c];
+                }
+            }
+        }
+
+        inline void NlerpQuatScalar(const float* a, const float* b, float* out, float t) {
+            float d = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+            float sign = (d < 0.0f) ? -1.0f : 1.0f;
+
+            float r[4];
+            for (int c = 0; c < 4; ++c) {
+                r[c] = a[c] + (b[c] * sign - a[c]) * t;
+            }
+
+            float fallback[4] = {a[0], a[1], a[2], a[3]};
+            NormalizeQuat(r, fallback, out);
+        }
+
+        inline void MultiplyQuat(const float* p, const float* q, float* out) {
+            float x = p[QW] * q[QX] + p[QX] * q[QW] + p[QY] * q[QZ] - p[QZ] * q[QY];
+            float y = p[QW] * q[QY] + p[QY] * q[QW] + p[QZ] * q[QX] - p[QX] * q[QZ];
+            float z = p[QW] * q[QZ] + p[QZ] * q[QW] + p[QX] * q[QY] - p[QY] * q[QX];
+            float w = p[QW] * q[QW] - p[QX] * q[QX] - p[QY] * q[QY] - p[QZ] * q[QZ];
+            out[QX] = x;
+            out[QY] = y;
+            out[QZ] = z;
+            out[QW] = w;
+        }
+
+        inline void AddQuatScalar(const float* base, const float* additive, float* out, float weight) {
+            float identity[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+            identity[QW] = 1.0f;
+
+            float sign = (additive[QW] < 0.0f) ? -1.0f : 1.0f;
+            float r[4];
+            for (int c = 0; c < 4; ++c) {
+                r[c] = identity[c] + (additive[c] * sign - identity[c]) * weight;
+            }
+
+            float weighted[4];
+            NormalizeQuat(r, identity, weighted);
+            MultiplyQuat(base, weighted, out);
+        }
+
+        void NlerpQuatsScalar(const float* a, const float* b, float* out, size_t count, float t) {
+            for (size_t i = 0; i < count; ++i) {
+                NlerpQuatScalar(a + i * 4, b + i * 4, out + i * 4, t);
+            }
+        }
+
+        void AddQuatsScalar(const float* base, const float* additive, float* out, size_t count, float weight) {
+            for (size_t i = 0; i < count; ++i) {
+                AddQuatScalar(base + i * 4, additive + i * 4, out + i * 4, weight);
+            }
+        }
+
+#if GAMEENGINE_POSE_KERNELS_X86
+        // ---------------------------------------------------------------------------------
+        // SSE2 kernels: four floats or four quaternions (transposed to SoA) per iteration
+        // ---------------------------------------------------------------------------------
+
+        POSE_KERNEL_TARGET_SSE2
+        void LerpSSE2(const float* a, const float* b, float* out, size_t count, float t) {
+            const __m128 vt = _mm_set1_ps(t);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 va = _mm_loadu_ps(a + i);
+                __m128 vb = _mm_loadu_ps(b + i);
+                _mm_storeu_ps(out + i, _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), vt)));
+            }
+            LerpScalar(a + i, b + i, out + i, count - i, t);
+        }
+
+        POSE_KERNEL_TARGET_SSE2
+        void AddSSE2(const float* base, const float* additive, float* out, size_t count, float weight) {
+            const __m128 vw = _mm_set1_ps(weight);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 vbase = _mm_loadu_ps(base + i);
+                __m128 vadd = _mm_loadu_ps(additive + i);
+                _mm_storeu_ps(out + i, _mm_add_ps(vbase, _mm_mul_ps(vadd, vw)));
+            }
+            AddScalar(base + i, additive + i, out + i, count - i, weight);
+        }
+
+        POSE_KERNEL_TARGET_SSE2
+        void AddScaleSSE2(const float* base, const float* additive, float* out, size_t count, float weight) {
+            const __m128 vw = _mm_set1_ps(weight);
+            const __m128 one = _mm_set1_ps(1.0f);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 vbase = _mm_loadu_ps(base + i);
+                __m128 vadd = _mm_loadu_ps(additive + i);
+                __m128 factor = _mm_add_ps(one, _mm_mul_ps(_mm_sub_ps(vadd, one), vw));
+                _mm_storeu_ps(out + i, _mm_mul_ps(vbase, factor));
+            }
+            AddScaleScalar(base + i, additive + i, out + i, count - i, weight);
+        }
+
+        struct Quat4 {
+            __m128 c[4]; // c[k] holds memory component k of four quaternions
+        };
+
+        POSE_KERNEL_TARGET_SSE2
+        inline Quat4 LoadQuat4(const float* q) {
+            Quat4 r;
+            r.c[0] = _mm_loadu_ps(q);
+            r.c[1] = _mm_loadu_ps(q + 4);
+            r.c[2] = _mm_loadu_ps(q + 8);
+            r.c[3] = _mm_loadu_ps(q + 12);
+            _MM_TRANSPOSE4_PS(r.c[0], r.c[1], r.c[2], r.c[3]);
+            return r;
+        }
+
+        POSE_KERNEL_TARGET_SSE2
+        inline void StoreQuat4(float* q, Quat4 r) {
+            _MM_TRANSPOSE4_PS(r.c[0], r.c[1], r.c[2], r.c[3]);
+            _mm_storeu_ps(q, r.c[0]);
+            _mm_storeu_ps(q + 4, r.c[1]);
+            _mm_storeu_ps(q + 8, r.c[2]);
+            _mm_storeu_ps(q + 12, r.c[3]);
+        }
+
+        POSE_KERNEL_TARGET_SSE2
+        inline __m128 Dot4(const Quat4& a, const Quat4& b) {
+            __m128 d = _mm_mul_ps(a.c[0], b.c[0]);
+            d = _mm_add_ps(d, _mm_mul_ps(a.c[1], b.c[1]));
+            d = _mm_add_ps(d, _mm_mul_ps(a.c[2], b.c[2]));
+            d = _mm_add_ps(d, _mm_mul_ps(a.c[3], b.c[3]));
+            return d;
+        }
+
+        POSE_KERNEL_TARGET_SSE2
+        inline Quat4 Normalize4(const Quat4& r, const Quat4& fallback) {
+            __m128 lengthSq = Dot4(r, r);
+            __m128 valid = _mm_cmpgt_ps(lengthSq, _mm_set1_ps(1e-12f));
+            __m128 invLength = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lengthSq));
+            Quat4 out;
+            for (int c = 0; c < 4; ++c) {
+                __m128 normalized = _mm_mul_ps(r.c[c], invLength);
+                out.c[c] = _mm_or_ps(_mm_and_ps(valid, normalized), _mm_andnot_ps(valid, fallback.c[c]));
+            }
+            return out;
+        }
+
+        POSE_KERNEL_TARGET_SSE2
+        inline Quat4 Multiply4(const Quat4& p, const Quat4& q) {
+            Quat4 out;
+            out.c[QX] = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(p.c[QW], q.c[QX]), _mm_mul_ps(p.c[QX], q.c[QW])),
+                                              _mm_mul_ps(p.c[QY], q.c[QZ])), _mm_mul_ps(p.c[QZ], q.c[QY]));
+            out.c[QY] = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(p.c[QW], q.c[QY]), _mm_mul_ps(p.c[QY], q.c[QW])),
+                                              _mm_mul_ps(p.c[QZ], q.c[QX])), _mm_mul_ps(p.c[QX], q.c[QZ]));
+            out.c[QZ] = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(p.c[QW], q.c[QZ]), _mm_mul_ps(p.c[QZ], q.c[QW])),
+                                              _mm_mul_ps(p.c[QX], q.c[QY])), _mm_mul_ps(p.c[QY], q.c[QX]));
+            out.c[QW] = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(p.c[QW], q.c[QW]), _mm_mul_ps(p.c[QX], q.c[QX])),
+                                              _mm_mul_ps(p.c[QY], q.c[QY])), _mm_mul_ps(p.c[QZ], q.c[QZ]));
+            return out;
+        }
+
+        POSE_KERNEL_TARGET_SSE2
+        void NlerpQuatsSSE2(const float* a, const float* b, float* out, size_t count, float t) {
+            const __m128 vt = _mm_set1_ps(t);
+            const __m128 signBit = _mm_set1_ps(-0.0f);
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                Quat4 qa = LoadQuat4(a + i * 4);
+                Quat4 qb = LoadQuat4(b + i * 4);
+
+                // Flip b into a's hemisphere: xor with the sign bit where dot < 0
+                __m128 flip = _mm_and_ps(_mm_cmplt_ps(Dot4(qa, qb), _mm_setzero_ps()), signBit);
+
+                Quat4 r;
+                for (int c = 0; c < 4; ++c) {
+                    __m128 bc = _mm_xor_ps(qb.c[c], flip);
+                    r.c[c] = _mm_add_ps(qa.c[c], _mm_mul_ps(_mm_sub_ps(bc, qa.c[c]), vt));
+                }
+
+                StoreQuat4(out + i * 4, Normalize4(r, qa));
+            }
+            NlerpQuatsScalar(a + i * 4, b + i * 4, out + i * 4, count - i, t);
+        }
+
+        POSE_KERNEL_TARGET_SSE2
+        void AddQuatsSSE2(const float* base, const float* additive, float* out, size_t count, float weight) {
+            const __m128 vw = _mm_set1_ps(weight);
+            const __m128 signBit = _mm_set1_ps(-0.0f);
+
+            Quat4 identity;
+            for (int c = 0; c < 4; ++c) {
+                identity.c[c] = _mm_set1_ps(c == QW ? 1.0f : 0.0f);
+            }
+
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                Quat4 qbase = LoadQuat4(base + i * 4);
+                Quat4 qadd = LoadQuat4(additive + i * 4);
+
+                // dot(identity, additive) is additive.w
+                __m128 flip = _mm_and_ps(_mm_cmplt_ps(qadd.c[QW], _mm_setzero_ps()), signBit);
+
+                Quat4 r;
+                for (int c = 0; c < 4; ++c) {
+                    __m128 ac = _mm_xor_ps(qadd.c[c], flip);
+                    r.c[c] = _mm_add_ps(identity.c[c], _mm_mul_ps(_mm_sub_ps(ac, identity.c[c]), vw));
+                }
+
+                StoreQuat4(out + i * 4, Multiply4(qbase, Normalize4(r, identity)));
+            }
+            AddQuatsScalar(base + i * 4, additive + i * 4, out + i * 4, count - i, weight);
+        }
+
+        // ---------------------------------------------------------------------------------
+        // AVX2 kernels: eight floats or eight quaternions per iteration. The in-lane transpose
+        // permutes quaternion order between lanes, which is harmless for element-wise math and
+        // undone by the inverse transpose on store.
+        // ---------------------------------------------------------------------------------
+
+        POSE_KERNEL_TARGET_AVX2
+        void LerpAVX2(const float* a, const float* b, float* out, size_t count, float t) {
+            const __m256 vt = _mm256_set1_ps(t);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 va = _mm256_loadu_ps(a + i);
+                __m256 vb = _mm256_loadu_ps(b + i);
+                _mm256_storeu_ps(out + i, _mm256_add_ps(va, _mm256_mul_ps(_mm256_sub_ps(vb, va), vt)));
+            }
+            LerpSSE2(a + i, b + i, out + i, count - i, t);
+        }
+
+        POSE_KERNEL_TARGET_AVX2
+        void AddAVX2(const float* base, const float* additive, float* out, size_t count, float weight) {
+            const __m256 vw = _mm256_set1_ps(weight);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 vbase = _mm256_loadu_ps(base + i);
+                __m256 vadd = _mm256_loadu_ps(additive + i);
+                _mm256_storeu_ps(out + i, _mm256_add_ps(vbase, _mm256_mul_ps(vadd, vw)));
+            }
+            AddSSE2(base + i, additive + i, out + i, count - i, weight);
+        }
+
+        POSE_KERNEL_TARGET_AVX2
+        void AddScaleAVX2(const float* base, const float* additive, float* out, size_t count, float weight) {
+            const __m256 vw = _mm256_set1_ps(weight);
+            const __m256 one = _mm256_set1_ps(1.0f);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 vbase = _mm256_loadu_ps(base + i);
+                __m256 vadd = _mm256_loadu_ps(additive + i);
+                __m256 factor = _mm256_add_ps(one, _mm256_mul_ps(_mm256_sub_ps(vadd, one), vw));
+                _mm256_storeu_ps(out + i, _mm256_mul_ps(vbase, factor));
+            }
+            AddScaleSSE2(base + i, additive + i, out + i, count - i, weight);
+        }
+
+        struct Quat8 {
+            __m256 c[4];
+        };
+
+        POSE_KERNEL_TARGET_AVX2
+        inline void Transpose8(__m256& r0, __m256& r1, __m256& r2, __m256& r3) {
+            __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+            __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+            __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+            __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+            r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+            r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+            r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        POSE_KERNEL_TARGET_AVX2
+        inline Quat8 LoadQuat8(const float* q) {
+            Quat8 r;
+            r.c[0] = _mm256_loadu_ps(q);
+            r.c[1] = _mm256_loadu_ps(q + 8);
+            r.c[2] = _mm256_loadu_ps(q + 16);
+            r.c[3] = _mm256_loadu_ps(q + 24);
+            Transpose8(r.c[0], r.c[1], r.c[2], r.c[3]);
+            return r;
+        }
+
+        POSE_KERNEL_TARGET_AVX2
+        inline void StoreQuat8(float* q, Quat8 r) {
+            Transpose8(r.c[0], r.c[1], r.c[2], r.c[3]);
+            _mm256_storeu_ps(q, r.c[0]);
+            _mm256_storeu_ps(q + 8, r.c[1]);
+            _mm256_storeu_ps(q + 16, r.c[2]);
+            _mm256_storeu_ps(q + 24, r.c[3]);
+        }
+
+        POSE_KERNEL_TARGET_AVX2
+        inline __m256 Dot8(const Quat8& a, const Quat8& b) {
+            __m256 d = _mm256_mul_ps(a.c[0], b.c[0]);
+            d = _mm256_add_ps(d, _mm256_mul_ps(a.c[1], b.c[1]));
+            d = _mm256_add_ps(d, _mm256_mul_ps(a.c[2], b.c[2]));
+            d = _mm256_add_ps(d, _mm256_mul_ps(a.c[3], b.c[3]));
+            return d;
+        }
+
+        POSE_KERNEL_TARGET_AVX2
+        inline Quat8 Normalize8(const Quat8& r, const Quat8& fallback) {
+            __m256 lengthSq = Dot8(r, r);
+            __m256 valid = _mm256_cmp_ps(lengthSq, _mm256_set1_ps(1e-12f), _CMP_GT_OQ);
+            __m256 invLength = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(lengthSq));
+            Quat8 out;
+            for (int c = 0; c < 4; ++c) {
+                out.c[c] = _mm256_blendv_ps(fallback.c[c], _mm256_mul_ps(r.c[c], invLength), valid);
+            }
+            return out;
+        }
+
+        POSE_KERNEL_TARGET_AVX2
+        inline Quat8 Multiply8(const Quat8& p, const Quat8& q) {
+            Quat8 out;
+            out.c[QX] = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(p.c[QW], q.c[QX]), _mm256_mul_ps(p.c[QX], q.c[QW])),
+                                                    _mm256_mul_ps(p.c[QY], q.c[QZ])), _mm256_mul_ps(p.c[QZ], q.c[QY]));
+            out.c[QY] = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(p.c[QW], q.c[QY]), _mm256_mul_ps(p.c[QY], q.c[QW])),
+                                                    _mm256_mul_ps(p.c[QZ], q.c[QX])), _mm256_mul_ps(p.c[QX], q.c[QZ]));
+            out.c[QZ] = _mm256_sub_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(p.c[QW], q.c[QZ]), _mm256_mul_ps(p.c[QZ], q.c[QW])),
+                                                    _mm256_mul_ps(p.c[QX], q.c[QY])), _mm256_mul_ps(p.c[QY], q.c[QX]));
+            out.c[QW] = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(_mm256_mul_ps(p.c[QW], q.c[QW]), _mm256_mul_ps(p.c[QX], q.c[QX])),
+                                                    _mm256_mul_ps(p.c[QY], q.c[QY])), _mm256_mul_ps(p.c[QZ], q.c[QZ]));
+            return out;
+        }
+
+        POSE_KERNEL_TARGET_AVX2
+        void NlerpQuatsAVX2(const float* a, const float* b, float* out, size_t count, float t) {
+            const __m256 vt = _mm256_set1_ps(t);
+            const __m256 signBit = _mm256_set1_ps(-0.0f);
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                Quat8 qa = LoadQuat8(a + i * 4);
+                Quat8 qb = LoadQuat8(b + i * 4);
+
+                __m256 flip = _mm256_and_ps(_mm256_cmp_ps(Dot8(qa, qb), _mm256_setzero_ps(), _CMP_LT_OQ), signBit);
+
+                Quat8 r;
+                for (int c = 0; c < 4; ++c) {
+                    __m256 bc = _mm256_xor_ps(qb.c[c], flip);
+                    r.c[c] = _mm256_add_ps(qa.c[c], _mm256_mul_ps(_mm256_sub_ps(bc, qa.c[c]), vt));
+                }
+
+                StoreQuat8(out + i * 4, Normalize8(r, qa));
+            }
+            NlerpQuatsSSE2(a + i * 4, b + i * 4, out + i * 4, count - i, t);
+        }
+
+        POSE_KERNEL_TARGET_AVX2
+        void AddQuatsAVX2(const float* base, const float* additive, float* out, size_t count, float weight) {
+            const __m256 vw = _mm256_set1_ps(weight);
+            const __m256 signBit = _mm256_set1_ps(-0.0f);
+
+            Quat8 identity;
+            for (int c = 0; c < 4; ++c) {
+                identity.c[c] = _mm256_set1_ps(c == QW ? 1.0f : 0.0f);
+            }
+
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                Quat8 qbase = LoadQuat8(base + i * 4);
+                Quat8 qadd = LoadQuat8(additive + i * 4);
+
+                __m256 flip = _mm256_and_ps(_mm256_cmp_ps(qadd.c[QW], _mm256_setzero_ps(), _CMP_LT_OQ), signBit);
+
+                Quat8 r;
+                for (int c = 0; c < 4; ++c) {
+                    __m256 ac = _mm256_xor_ps(qadd.c[c], flip);
+                    r.c[c] = _mm256_add_ps(identity.c[c], _mm256_mul_ps(_mm256_sub_ps(ac, identity.c[c]), vw));
+                }
+
+                StoreQuat8(out + i * 4, Multiply8(qbase, Normalize8(r, identity)));
+            }
+            AddQuatsSSE2(base + i * 4, additive + i * 4, out + i * 4, count - i, weight);
+        }
+#endif // GAMEENGINE_POSE_KERNELS_X86
+
+        const KernelTable s_scalarKernels = {
+            SimdLevel::Scalar, LerpScalar, AddScalar, AddScaleScalar, NlerpQuatsScalar, AddQuatsScalar
+        };
+
+#if GAMEENGINE_POSE_KERNELS_X86
+        const KernelTable s_sse2Kernels = {
+            SimdLevel::SSE2, LerpSSE2, AddSSE2, AddScaleSSE2, NlerpQuatsSSE2, AddQuatsSSE2
+        };
+
+        const KernelTable s_avx2Kernels = {
+            SimdLevel::AVX2, LerpAVX2, AddAVX2, AddScaleAVX2, NlerpQuatsAVX2, AddQuatsAVX2
+        };
+#endif
+
+        const KernelTable* GetKernelTable(SimdLevel level) {
+#if GAMEENGINE_POSE_KERNELS_X86
+            switch (level) {
+                case SimdLevel::AVX2: return &s_avx2Kernels;
+                case SimdLevel::SSE2: return &s_sse2Kernels;
+                default: break;
+            }
+#else
+            (void)level;
+#endif
+            return &s_scalarKernels;
+        }
+
+        std::atomic<const KernelTable*>& ActiveKernels() {
+            static std::atomic<const KernelTable*> s_active{GetKernelTable(PoseBlendKernels::DetectSupportedLevel())};
+            return s_active;
+        }
+
+        inline const KernelTable& Kernels() {
+            return *ActiveKernels().load(std::memory_order_acquire);
+        }
+    }
+
+    SimdLevel PoseBlendKernels::GetActiveLevel() {
+        return Kernels().level;
+    }
+
+    SimdLevel PoseBlendKernels::SetActiveLevel(SimdLevel level) {
+        SimdLevel supported = DetectSupportedLevel();
+        if (static_cast<int>(level) > static_cast<int>(supported)) {
+            LOG_WARNING(std::string("PoseBlendKernels: ") + GetLevelName(level) + " not supported, using " + GetLevelName(supported));
+            level = supported;
+        }
+
+        ActiveKernels().store(GetKernelTable(level), std::memory_order_release);
+        return level;
+    }
+
+    void PoseBlendKernels::LerpVectors(const Math::Vec3* a, const Math::Vec3* b, Math::Vec3* out, size_t count, float t) {
+        Kernels().lerp(reinterpret_cast<const float*>(a), reinterpret_cast<const float*>(b),
+                       reinterpret_cast<float*>(out), count * 3, t);
+    }
+
+    void PoseBlendKernels::AddVectors(const Math::Vec3* base, const Math::Vec3* additive, Math::Vec3* out, size_t count, float weight) {
+        Kernels().add(reinterpret_cast<const float*>(base), reinterpret_cast<const float*>(additive),
+                      reinterpret_cast<float*>(out), count * 3, weight);
+    }
+
+    void PoseBlendKernels::AddScales(const Math::Vec3* base, const Math::Vec3* additive, Math::Vec3* out, size_t count, float weight) {
+        Kernels().addScale(reinterpret_cast<const float*>(base), reinterpret_cast<const float*>(additive),
+                           reinterpret_cast<float*>(out), count * 3, weight);
+    }
+
+    void PoseBlendKernels::NlerpRotations(const Math::Quat* a, const Math::Quat* b, Math::Quat* out, size_t count, float t) {
+        Kernels().nlerpQuat(reinterpret_cast<const float*>(a), reinterpret_cast<const float*>(b),
+                            reinterpret_cast<float*>(out), count, t);
+    }
+
+    void PoseBlendKernels::AddRotations(const Math::Quat* base, const Math::Quat* additive, Math::Quat* out, size_t count, float weight) {
+        Kernels().addQuat(reinterpret_cast<const float*>(base), reinterpret_cast<const float*>(additive),
+                          reinterpret_cast<float*>(out), count, weight);
+    }
+
+} // namespace Animation
+} // namespace GameEngine
@@ -0,0 +1,356 @@
+#include "Animation/QuantizedAnimation.h"
+#include "Animation/PoseBlendKernels.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace GameEngine {
+namespace Animation {
+
+    namespace {
+        constexpr float INV_SQRT2 = 0.70710678118654752f;
+        constexpr float SQRT2 = 1.41421356237309505f;
+        constexpr size_t STREAM_PADDING_BYTES = 8; // Lets every read load a full 64-bit word
+
+        // Bit stream access with unaligned 64-bit words (little-endian targets)
+        inline void WriteBits(std::vector<uint8_t>& stream, size_t bitOffset, uint32_t value, uint32_t bitCount) {
+            uint64_t word;
+            std::memcpy(&word, stream.data() + (bitOffset >> 3), sizeof(word));
+            word |= static_cast<uint64_t>(value & ((1ull << bitCount) - 1)) << (bitOffset & 7);
+            std::memcpy(stream.data() + (bitOffset >> 3), &word, sizeof(word));
+        }
+
+        inline uint32_t ReadBits(const uint8_t* stream, size_t bitOffset, uint32_t bitCount) {
+            uint64_t word;
+            std::memcpy(&word, stream + (bitOffset >> 3), sizeof(word));
+            return static_cast<uint32_t>((word >> (bitOffset & 7)) & ((1ull << bitCount) - 1));
+        }
+
+        inline uint32_t Quantize(float value, float minimum, float extent, uint32_t bits) {
+            if (extent <= 0.0f) {
+                return 0;
+            }
+            const float maxValue = static_cast<float>((1u << bits) - 1);
+            float normalized = std::clamp((value - minimum) / extent, 0.0f, 1.0f);
+            return static_cast<uint32_t>(normalized * maxValue + 0.5f);
+        }
+
+        inline float Dequantize(uint32_t value, float minimum, float extent, uint32_t bits) {
+            const float maxValue = static_cast<float>((1u << bits) - 1);
+            return minimum + extent * (static_cast<float>(value) / maxValue);
+        }
+
+        inline uint32_t RotationRecordBits(uint32_t componentBits) {
+            // 2-bit index, three components and one padding bit (48 bits at 15 bits per component)
+            return 3 * componentBits + 3;
+        }
+
+        // Angle between rotations from the quaternion chord (|a - b| = 2 sin(angle / 4)),
+        // which stays accurate for the tiny angles where acos(dot) loses all precision in float
+        float RotationAngle(const Math::Quat& a, const Math::Quat& b) {
+            const Math::Quat aligned = glm::dot(a, b) < 0.0f ? -b : b;
+            const Math::Quat difference = a - aligned;
+            const float chord = std::sqrt(glm::dot(difference, difference));
+            return 4.0f * std::asin(std::min(chord * 0.5f, 1.0f));
+        }
+    }
+
+    std::shared_ptr<QuantizedAnimation> QuantizedAnimation::Create(const SkeletalAnimation& animation,
+                                                                   const std::shared_ptr<const PoseLayout>& layout,
+                                                                   const CompressionSettings& settings) {
+        if (!layout) {
+            LOG_ERROR("QuantizedAnimation: cannot compress '" + animation.GetName() + "' without a pose layout");
+            return nullptr;
+        }
+
+        auto clip = std::make_shared<QuantizedAnimation>();
+        clip->m_name = animation.GetName();
+        clip->m_duration = std::max(animation.GetDuration(), 0.0f);
+        clip->m_sampleRate = settings.sampleRate > 0.0f ? settings.sampleRate : std::max(animation.GetFrameRate(), 1.0f);
+        clip->m_frameCount = static_cast<size_t>(std::ceil(clip->m_duration * clip->m_sampleRate)) + 1;
+        clip->m_positionBits = static_cast<uint8_t>(std::clamp(settings.positionBits, 4, 24));
+        clip->m_rotationBits = static_cast<uint8_t>(std::clamp(settings.rotationBits, 4, 15));
+        clip->m_scaleBits = static_cast<uint8_t>(std::clamp(settings.scaleBits, 4, 24));
+
+        const size_t boneCount = layout->GetBoneCount();
+        const size_t frameCount = clip->m_frameCount;
+        for (size_t i = 0; i < boneCount; ++i) {
+            clip->m_boneNames.push_back(layout->GetBoneName(i));
+        }
+
+        // Resample the clip; frames are stored frame-major while analysing tracks
+        std::vector<Math::Vec3> translations(frameCount * boneCount);
+        std::vector<Math::Quat> rotations(frameCount * boneCount);
+        std::vector<Math::Vec3> scales(frameCount * boneCount);
+        {
+            const AnimationBinding binding = AnimationBinding::Create(animation, *layout);
+            AnimationCursor cursor;
+            IndexedPose pose(layout);
+            for (size_t frame = 0; frame < frameCount; ++frame) {
+                float time = std::min(static_cast<float>(frame) / clip->m_sampleRate, clip->m_duration);
+                PoseEvaluator::EvaluateAnimation(animation, binding, time, cursor, pose);
+                std::copy(pose.GetTranslations().begin(), pose.GetTranslations().end(), translations.begin() + frame * boneCount);
+                std::copy(pose.GetRotations().begin(), pose.GetRotations().end(), rotations.begin() + frame * boneCount);
+                std::copy(pose.GetScales().begin(), pose.GetScales().end(), scales.begin() + frame * boneCount);
+            }
+        }
+
+        // Classify every channel as constant or animated and assign bit offsets
+        uint32_t frameBits = 0;
+        auto classifyVectors = [&](const std::vector<Math::Vec3>& samples, float tolerance, uint32_t componentBits,
+                                   std::vector<ConstantVectorTrack>& constants, std::vector<AnimatedVectorTrack>& animated) {
+            for (size_t bone = 0; bone < boneCount; ++bone) {
+                const Math::Vec3 first = samples[bone];
+                Math::Vec3 minimum = first;
+                Math::Vec3 maximum = first;
+                float maxDeviation = 0.0f;
+                for (size_t frame = 1; frame < frameCount; ++frame) {
+                    const Math::Vec3& value = samples[frame * boneCount + bone];
+                    minimum = glm::min(minimum, value);
+                    maximum = glm::max(maximum, value);
+                    maxDeviation = std::max(maxDeviation, glm::length(value - first));
+                }
+
+                if (maxDeviation <= tolerance) {
+                    constants.push_back({static_cast<uint32_t>(bone), first});
+                } else {
+                    animated.push_back({static_cast<uint32_t>(bone), frameBits, minimum, maximum - minimum});
+                    frameBits += 3 * componentBits;
+                }
+            }
+        };
+
+        classifyVectors(translations, settings.positionTolerance, clip->m_positionBits, clip->m_constantPositions, clip->m_animatedPositions);
+        classifyVectors(scales, settings.scaleTolerance, clip->m_scaleBits, clip->m_constantScales, clip->m_animatedScales);
+
+        for (size_t bone = 0; bone < boneCount; ++bone) {
+            const Math::Quat first = rotations[bone];
+            float maxDeviation = 0.0f;
+            for (size_t frame = 1; frame < frameCount; ++frame) {
+                maxDeviation = std::max(maxDeviation, RotationAngle(first, rotations[frame * boneCount + bone]));
+            }
+
+            if (maxDeviation <= settings.rotationTolerance) {
+                clip->m_constantRotations.push_back({static_cast<uint32_t>(bone), first});
+            } else {
+                clip->m_animatedRotations.push_back({static_cast<uint32_t>(bone), frameBits});
+                frameBits += RotationRecordBits(clip->m_rotationBits);
+            }
+        }
+
+        clip->m_frameBits = frameBits;
+        clip->m_stream.assign((frameCount * frameBits + 7) / 8 + STREAM_PADDING_BYTES, 0);
+
+        // Pack frames
+        for (size_t frame = 0; frame < frameCount; ++frame) {
+            const size_t frameOffset = frame * frameBits;
+
+            auto packVectors = [&](const std::vector<Math::Vec3>& samples, const std::vector<AnimatedVectorTrack>& tracks, uint32_t bits) {
+                for (const auto& track : tracks) {
+                    const Math::Vec3& value = samples[frame * boneCount + track.boneIndex];
+                    size_t offset = frameOffset + track.bitOffset;
+                    for (int component = 0; component < 3; ++component) {
+                        WriteBits(clip->m_stream, offset, Quantize(value[component], track.minimum[component], track.extent[component], bits), bits);
+                        offset += bits;
+                    }
+                }
+            };
+
+            packVectors(translations, clip->m_animatedPositions, clip->m_positionBits);
+            packVectors(scales, clip->m_animatedScales, clip->m_scaleBits);
+
+            const uint32_t rotationBits = clip->m_rotationBits;
+            for (const auto& track : clip->m_animatedRotations) {
+                const Math::Quat rotation = glm::normalize(rotations[frame * boneCount + track.boneIndex]);
+                float components[4] = {rotation.x, rotation.y, rotation.z, rotation.w};
+
+                uint32_t largest = 0;
+                for (uint32_t c = 1; c < 4; ++c) {
+                    if (std::abs(components[c]) > std::abs(components[largest])) {
+                        largest = c;
+                    }
+                }
+                // q and -q are the same rotation; keep the dropped component positive
+                const float sign = components[largest] < 0.0f ? -1.0f : 1.0f;
+
+                size_t offset = frameOffset + track.bitOffset;
+                WriteBits(clip->m_stream, offset, largest, 2);
+                offset += 2;
+                for (uint32_t c = 0; c < 4; ++c) {
+                    if (c == largest) {
+                        continue;
+                    }
+                    WriteBits(clip->m_stream, offset, Quantize(components[c] * sign, -INV_SQRT2, SQRT2, rotationBits), rotationBits);
+                    offset += rotationBits;
+                }
+            }
+        }
+
+        return clip;
+    }
+
+    void QuantizedAnimation::DecodeFrame(size_t frame, Math::Vec3* translations, Math::Quat* rotations, Math::Vec3* scales) const {
+        const uint8_t* stream = m_stream.data();
+        const size_t frameOffset = frame * m_frameBits;
+
+        auto decodeVectors = [&](const std::vector<ConstantVectorTrack>& constants, const std::vector<AnimatedVectorTrack>& tracks,
+                                 uint32_t bits, Math::Vec3* out) {
+            for (const auto& track : constants) {
+                out[track.boneIndex] = track.value;
+            }
+            for (const auto& track : tracks) {
+                size_t offset = frameOffset + track.bitOffset;
+                Math::Vec3 value;
+                for (int component = 0; component < 3; ++component) {
+                    value[component] = Dequantize(ReadBits(stream, offset, bits), track.minimum[component], track.extent[component], bits);
+                    offset += bits;
+                }
+                out[track.boneIndex] = value;
+            }
+        };
+
+        decodeVectors(m_constantPositions, m_animatedPositions, m_positionBits, translations);
+        decodeVectors(m_constantScales, m_animatedScales, m_scaleBits, scales);
+
+        for (const auto& track : m_constantRotations) {
+            rotations[track.boneIndex] = track.value;
+        }
+
+        const uint32_t rotationBits = m_rotationBits;
+        for (const auto& track : m_animatedRotations) {
+            size_t offset = frameOffset + track.bitOffset;
+            const uint32_t largest = ReadBits(stream, offset, 2);
+            offset += 2;
+
+            float components[4];
+            float sumSquares = 0.0f;
+            for (uint32_t c = 0; c < 4; ++c) {
+                if (c == largest) {
+                    continue;
+                }
+                components[c] = Dequantize(ReadBits(stream, offset, rotationBits), -INV_SQRT2, SQRT2, rotationBits);
+                sumSquares += components[c] * components[c];
+                offset += rotationBits;
+            }
+            components[largest] = std::sqrt(std::max(0.0f, 1.0f - sumSquares));
+
+            rotations[track.boneIndex] = glm::normalize(Math::Quat(components[3], components[0], components[1], components[2]));
+        }
+    }
+
+    void QuantizedAnimation::Sample(float time, IndexedPose& outPose) const {
+        const size_t boneCount = GetBoneCount();
+        if (outPose.GetBoneCount() != boneCount || m_frameCount == 0) {
+            LOG_ERROR("QuantizedAnimation::Sample: pose does not match compressed clip '" + m_name + "'");
+            return;
+        }
+
+        const float clampedTime = std::clamp(time, 0.0f, m_duration);
+        const size_t lastFrame = m_frameCount - 1;
+        const size_t frame0 = std::min(static_cast<size_t>(clampedTime * m_sampleRate), lastFrame);
+        const size_t frame1 = std::min(frame0 + 1, lastFrame);
+
+        // The last segment ends at the clip end, so it is shorter when duration * rate is fractional
+        const float time0 = static_cast<float>(frame0) / m_sampleRate;
+        const float time1 = std::min(static_cast<float>(frame1) / m_sampleRate, m_duration);
+        const float alpha = time1 > time0 ? std::clamp((clampedTime - time0) / (time1 - time0), 0.0f, 1.0f) : 0.0f;
+
+        Math::Vec3* translations = outPose.GetTranslations().data();
+        Math::Quat* rotations = outPose.GetRotations().data();
+        Math::Vec3* scales = outPose.GetScales().data();
+        DecodeFrame(frame0, translations, rotations, scales);
+        if (frame1 == frame0 || alpha <= 0.0f) {
+            return;
+        }
+
+        // Second frame goes to per-thread scratch so clips can be shared across threads
+        thread_local std::vector<Math::Vec3> nextTranslations;
+        thread_local std::vector<Math::Quat> nextRotations;
+        thread_local std::vector<Math::Vec3> nextScales;
+        nextTranslations.resize(boneCount);
+        nextRotations.resize(boneCount);
+        nextScales.resize(boneCount);
+        DecodeFrame(frame1, nextTranslations.data(), nextRotations.data(), nextScales.data());
+
+        PoseBlendKernels::LerpVectors(translations, nextTranslations.data(), translations, boneCount, alpha);
+        PoseBlendKernels::NlerpRotations(rotations, nextRotations.data(), rotations, boneCount, alpha);
+        PoseBlendKernels::LerpVectors(scales, nextScales.data(), scales, boneCount, alpha);
+    }
+
+    bool QuantizedAnimation::IsCompatibleWith(const PoseLayout& layout) const {
+        if (layout.GetBoneCount() != GetBoneCount()) {
+            return false;
+        }
+
+        for (size_t i = 0; i < m_boneNames.size(); ++i) {
+            if (layout.GetBoneName(i) != m_boneNames[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    QuantizationReport QuantizedAnimation::Measure(const SkeletalAnimation& original, const std::shared_ptr<const PoseLayout>& layout) const {
+        QuantizationReport report;
+        report.clipName = m_name;
+        report.originalBytes = original.GetMemoryUsage();
+        report.compressedBytes = GetMemoryUsage();
+        report.compressionRatio = report.compressedBytes > 0
+            ? static_cast<float>(report.originalBytes) / static_cast<float>(report.compressedBytes) : 0.0f;
+        report.constantTracks = GetConstantTrackCount();
+        report.animatedTracks = GetAnimatedTrackCount();
+
+        if (!layout || !IsCompatibleWith(*layout)) {
+            LOG_WARNING("QuantizedAnimation::Measure: layout does not match compressed clip '" + m_name + "'");
+            return report;
+        }
+
+        const AnimationBinding binding = AnimationBinding::Create(original, *layout);
+        AnimationCursor cursor;
+        IndexedPose reference(layout);
+        IndexedPose decoded(layout);
+
+        for (size_t step = 0; step < m_frameCount * 2; ++step) {
+            float time = std::min(static_cast<float>(step) * 0.5f / m_sampleRate, m_duration);
+            PoseEvaluator::EvaluateAnimation(original, binding, time, cursor, reference);
+            Sample(time, decoded);
+
+            for (size_t bone = 0; bone < GetBoneCount(); ++bone) {
+                report.maxPositionError = std::max(report.maxPositionError,
+                    glm::length(reference.GetTranslations()[bone] - decoded.GetTranslations()[bone]));
+                report.maxRotationError = std::max(report.maxRotationError,
+                    RotationAngle(reference.GetRotations()[bone], decoded.GetRotations()[bone]));
+                report.maxScaleError = std::max(report.maxScaleError,
+                    glm::length(reference.GetScales()[bone] - decoded.GetScales()[bone]));
+            }
+        }
+
+        return report;
+    }
+
+    size_t QuantizedAnimation::GetConstantTrackCount() const {
+        return m_constantPositions.size() + m_constantRotations.size() + m_constantScales.size();
+    }
+
+    size_t QuantizedAnimation::GetAnimatedTrackCount() const {
+        return m_animatedPositions.size() + m_animatedRotations.size() + m_animatedScales.size();
+    }
+
+    size_t QuantizedAnimation::GetMemoryUsage() const {
+        size_t usage = sizeof(QuantizedAnimation);
+        usage += m_constantPositions.capacity() * sizeof(ConstantVectorTrack);
+        usage += m_constantRotations.capacity() * sizeof(ConstantRotationTrack);
+        usage += m_constantScales.capacity() * sizeof(ConstantVectorTrack);
+        usage += m_animatedPositions.capacity() * sizeof(AnimatedVectorTrack);
+        usage += m_animatedRotations.capacity() * sizeof(AnimatedRotationTrack);
+        usage += m_animatedScales.capacity() * sizeof(AnimatedVectorTrack);
+        usage += m_stream.capacity();
+        for (const auto& name : m_boneNames) {
+            usage += sizeof(std::string) + name.capacity();
+        }
+        return usage;
+    }
+
+} // namespace Animation
+} // namespace GameEngine
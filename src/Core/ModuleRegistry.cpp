@@ -402,6 +402,14 @@ namespace GameEngine {
         }
     }
 
+    void ModuleRegistry::UpdateModules(float deltaTime, const std::function<bool(const IEngineModule&)>& filter) {
+        for (IEngineModule* module : m_initializationOrder) {
+            if (module->IsInitialized() && module->IsEnabled() && filter(*module)) {
+                module->Update(deltaTime);
+            }
+        }
+    }
+
     void ModuleRegistry::ShutdownModules() {
         LOG_INFO("Shutting down modules...");
 
@@ -1,5 +1,6 @@
 #include "Core/PerformanceMonitor.h"
 #include "Core/Logger.h"
+#include "Core/Profiler.h"
 #include <algorithm>
 #include <numeric>
 
@@ -19,6 +20,7 @@ namespace GameEngine {
     PerformanceMonitor::~PerformanceMonitor() = default;
 
     void PerformanceMonitor::BeginFrame() {
+        // Profiler frames are marked once per frame by Engine::Run, not here
         m_frameStart = std::chrono::high_resolution_clock::now();
     }
 
@@ -36,6 +38,8 @@ namespace GameEngine {
             }
             
             UpdateStats();
+            GAMEENGINE_PROFILE_COUNTER("Frame Time (ms)", frameTimeMs);
+            GAMEENGINE_PROFILE_COUNTER("FPS", m_frameStats.fps);
         } else {
             m_firstFrame = false;
         }
@@ -80,6 +84,7 @@ namespace GameEngine {
 
     void PerformanceMonitor::UpdateMemoryUsage() {
         m_frameStats.memoryUsageMB = GetProcessMemoryUsage();
+        GAMEENGINE_PROFILE_COUNTER("Memory (MB)", m_frameStats.memoryUsageMB);
         
         // Log memory warnings
         if (m_frameStats.memoryUsageMB > 200) {
@@ -0,0 +1,376 @@
+#include "Core/Profiler.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+namespace GameEngine {
+
+    /**
+     * Events recorded by one thread. Only the owning thread appends; it publishes each event
+     * with a release store of the chunk count so readers can copy without stopping it. The
+     * mutex guards the chunk list and the name, and is taken by the owner only when it moves
+     * to the next chunk or resets after Clear. Chunks are kept and reused after Clear.
+     */
+    struct Profiler::ThreadBuffer {
+        static constexpr size_t CHUNK_EVENTS = 4096;
+
+        struct Chunk {
+            ProfileEvent events[CHUNK_EVENTS];
+            std::atomic<size_t> count{0};
+        };
+
+        uint32_t threadId = 0;
+        std::string name;
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        std::atomic<uint64_t> generation{0};
+        std::atomic<bool> threadExited{false};
+
+        // Owner thread only
+        Chunk* current = nullptr;
+        size_t currentIndex = 0;
+        size_t eventCount = 0;
+    };
+
+    /**
+     * The calling thread's buffer, created on its first event. Marks it finished when the
+     * thread exits so Clear can free it.
+     */
+    struct ProfilerThreadState {
+        Profiler::ThreadBuffer* buffer = nullptr;
+        std::string name;       // Set before the buffer exists
+
+        ~ProfilerThreadState() {
+            if (buffer) {
+                buffer->threadExited.store(true, std::memory_order_release);
+                buffer = nullptr;
+            }
+        }
+    };
+
+    namespace {
+        thread_local ProfilerThreadState t_threadState;
+
+        void AppendJsonString(std::string& out, const char* text) {
+            out += '"';
+            for (const char* c = text ? text : ""; *c; ++c) {
+                switch (*c) {
+                    case '"':  out += "\\\""; break;
+                    case '\\': out += "\\\\"; break;
+                    case '\n': out += "\\n"; break;
+                    case '\r': out += "\\r"; break;
+                    case '\t': out += "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(*c) < 0x20) {
+                            char escaped[8];
+                            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(*c));
+                            out += escaped;
+                        } else {
+                            out += *c;
+                        }
+                        break;
+                }
+            }
+            out += '"';
+        }
+
+        // Chrome trace timestamps are in microseconds
+        void AppendMicroseconds(std::string& out, uint64_t ns) {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.3f", static_cast<double>(ns) / 1000.0);
+            out += buffer;
+        }
+    }
+
+    Profiler::Profiler()
+        : m_epochTicks(Now())
+        , m_epochTime(std::chrono::steady_clock::now()) {
+        m_nanosecondsPerTick.store(CalibrateNanosecondsPerTick(), std::memory_order_relaxed);
+    }
+
+    Profiler::~Profiler() = default;
+
+    Profiler::ThreadBuffer& Profiler::GetThreadBuffer() {
+        if (t_threadState.buffer) {
+            return *t_threadState.buffer;
+        }
+
+        auto buffer = std::make_unique<ThreadBuffer>();
+        buffer->chunks.push_back(std::make_unique<ThreadBuffer::Chunk>());
+        buffer->current = buffer->chunks.back().get();
+        buffer->generation.store(m_generation.load(std::memory_order_acquire), std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(m_threadsMutex);
+        buffer->threadId = m_nextThreadId++;
+        buffer->name = t_threadState.name.empty() ? "Thread " + std::to_string(buffer->threadId) : t_threadState.name;
+        t_threadState.buffer = buffer.get();
+        m_threads.push_back(std::move(buffer));
+        return *t_threadState.buffer;
+    }
+
+    void Profiler::SetThreadName(const std::string& name) {
+        t_threadState.name = name;
+        if (ThreadBuffer* buffer = t_threadState.buffer) {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            buffer->name = name;
+        }
+    }
+
+    ProfileEvent* Profiler::AllocateEvent(ThreadBuffer& buffer) {
+        // Clear happened since this thread last recorded: start over, reusing the chunks
+        const uint64_t generation = m_generation.load(std::memory_order_acquire);
+        if (buffer.generation.load(std::memory_order_relaxed) != generation) {
+            std::lock_guard<std::mutex> lock(buffer.mutex);
+            for (auto& chunk : buffer.chunks) {
+                chunk->count.store(0, std::memory_order_relaxed);
+            }
+            buffer.current = buffer.chunks[0].get();
+            buffer.currentIndex = 0;
+            buffer.eventCount = 0;
+            buffer.generation.store(generation, std::memory_order_release);
+        }
+
+        if (buffer.eventCount >= m_maxEventsPerThread.load(std::memory_order_relaxed)) {
+            m_droppedEvents.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        if (buffer.current->count.load(std::memory_order_relaxed) == ThreadBuffer::CHUNK_EVENTS) {
+            std::lock_guard<std::mutex> lock(buffer.mutex);
+            if (++buffer.currentIndex == buffer.chunks.size()) {
+                buffer.chunks.push_back(std::make_unique<ThreadBuffer::Chunk>());
+            }
+            buffer.current = buffer.chunks[buffer.currentIndex].get();
+        }
+
+        return &buffer.current->events[buffer.current->count.load(std::memory_order_relaxed)];
+    }
+
+    void Profiler::RecordEvent(const ProfileEvent& event) {
+        ThreadBuffer& buffer = GetThreadBuffer();
+        ProfileEvent* slot = AllocateEvent(buffer);
+        if (!slot) {
+            return;
+        }
+
+        // Only this thread writes the count; a plain release store publishes the event
+        *slot = event;
+        buffer.current->count.store(buffer.current->count.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        buffer.eventCount++;
+    }
+
+    void Profiler::RecordZone(const char* name, const char* category, uint64_t startTicks, uint64_t endTicks) {
+        ProfileEvent event;
+        event.name = name;
+        event.category = category;
+        event.startNs = startTicks;
+        event.durationNs = endTicks > startTicks ? endTicks - startTicks : 0;
+        event.type = ProfileEventType::Zone;
+        RecordEvent(event);
+    }
+
+    void Profiler::RecordZoneEndingNow(const char* name, const char* category, uint64_t durationNs) {
+        const uint64_t endTicks = Now();
+        const uint64_t durationTicks = static_cast<uint64_t>(static_cast<double>(durationNs) / GetNanosecondsPerTick());
+        RecordZone(name, category, endTicks - std::min(durationTicks, endTicks), endTicks);
+    }
+
+    double Profiler::CalibrateNanosecondsPerTick() const {
+#if GAMEENGINE_PROFILER_USE_TSC
+        // Needs a couple of milliseconds since the epoch for a stable ratio; runs once, on first use of the profiler
+        constexpr auto MIN_CALIBRATION_TIME = std::chrono::milliseconds(2);
+        while (std::chrono::steady_clock::now() - m_epochTime < MIN_CALIBRATION_TIME) {
+            std::this_thread::yield();
+        }
+
+        const uint64_t ticks = Now();
+        const auto elapsed = std::chrono::steady_clock::now() - m_epochTime;
+        const double elapsedNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        return ticks > m_epochTicks ? elapsedNs / static_cast<double>(ticks - m_epochTicks) : 1.0;
+#else
+        return 1.0;
+#endif
+    }
+
+    void Profiler::RecordCounter(const char* name, double value) {
+        ProfileEvent event;
+        event.name = name;
+        event.category = "Counter";
+        event.startNs = Now();
+        event.value = value;
+        event.type = ProfileEventType::Counter;
+        RecordEvent(event);
+    }
+
+    void Profiler::MarkFrame() {
+        const uint64_t frame = m_frameNumber.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (!IsEnabled()) {
+            return;
+        }
+
+        ProfileEvent event;
+        event.name = "Frame";
+        event.category = "Frame";
+        event.startNs = Now();
+        event.durationNs = frame;
+        event.type = ProfileEventType::FrameMarker;
+        RecordEvent(event);
+    }
+
+    const char* Profiler::InternName(const std::string& name) {
+        std::lock_guard<std::mutex> lock(m_namesMutex);
+        return m_names.insert(name).first->c_str();
+    }
+
+    void Profiler::Clear() {
+        m_generation.fetch_add(1, std::memory_order_acq_rel);
+        m_droppedEvents.store(0, std::memory_order_relaxed);
+
+        // Buffers of threads that have exited will never be reset by their owner
+        std::lock_guard<std::mutex> lock(m_threadsMutex);
+        m_threads.erase(std::remove_if(m_threads.begin(), m_threads.end(),
+                                       [](const std::unique_ptr<ThreadBuffer>& buffer) {
+                                           return buffer->threadExited.load(std::memory_order_acquire);
+                                       }),
+                        m_threads.end());
+    }
+
+    ProfileCapture Profiler::Capture() const {
+        ProfileCapture capture;
+        capture.droppedEvents = GetDroppedEventCount();
+        const double nsPerTick = GetNanosecondsPerTick();
+        auto toNanoseconds = [this, nsPerTick](uint64_t ticks) {
+            return ticks > m_epochTicks ? static_cast<uint64_t>(static_cast<double>(ticks - m_epochTicks) * nsPerTick) : 0;
+        };
+        const uint64_t generation = m_generation.load(std::memory_order_acquire);
+
+        std::lock_guard<std::mutex> threadsLock(m_threadsMutex);
+        for (const auto& buffer : m_threads) {
+            ProfileThreadTimeline timeline;
+            std::vector<ProfileEvent> zones;
+            {
+                std::lock_guard<std::mutex> lock(buffer->mutex);
+                if (buffer->generation.load(std::memory_order_acquire) != generation) {
+                    continue;   // Recorded before the last Clear
+                }
+
+                timeline.threadId = buffer->threadId;
+                timeline.threadName = buffer->name;
+                for (const auto& chunk : buffer->chunks) {
+                    const size_t count = chunk->count.load(std::memory_order_acquire);
+                    for (size_t i = 0; i < count; ++i) {
+                        const ProfileEvent& event = chunk->events[i];
+                        switch (event.type) {
+                            case ProfileEventType::Zone:        zones.push_back(event); break;
+                            case ProfileEventType::Counter:     timeline.counters.push_back(event); break;
+                            case ProfileEventType::FrameMarker: capture.frameStartsNs.push_back(toNanoseconds(event.startNs)); break;
+                        }
+                    }
+                }
+            }
+
+            // Zones are recorded when they close (children first); order by start, parents first
+            std::sort(zones.begin(), zones.end(), [](const ProfileEvent& a, const ProfileEvent& b) {
+                return a.startNs != b.startNs ? a.startNs < b.startNs : a.durationNs > b.durationNs;
+            });
+
+            std::vector<uint64_t> openZoneEnds;
+            timeline.zones.reserve(zones.size());
+            for (const ProfileEvent& zone : zones) {
+                while (!openZoneEnds.empty() && zone.startNs >= openZoneEnds.back()) {
+                    openZoneEnds.pop_back();
+                }
+
+                ProfileTimelineZone entry;
+                entry.name = zone.name;
+                entry.category = zone.category;
+                entry.startNs = toNanoseconds(zone.startNs);
+                entry.durationNs = static_cast<uint64_t>(static_cast<double>(zone.durationNs) * nsPerTick);
+                entry.depth = static_cast<uint32_t>(openZoneEnds.size());
+                timeline.zones.push_back(entry);
+                openZoneEnds.push_back(zone.startNs + zone.durationNs);
+            }
+
+            for (ProfileEvent& counter : timeline.counters) {
+                counter.startNs = toNanoseconds(counter.startNs);
+            }
+
+            if (!timeline.zones.empty() || !timeline.counters.empty()) {
+                capture.threads.push_back(std::move(timeline));
+            }
+        }
+
+        std::sort(capture.frameStartsNs.begin(), capture.frameStartsNs.end());
+        return capture;
+    }
+
+    std::string Profiler::ExportChromeTrace() const {
+        const ProfileCapture capture = Capture();
+
+        std::string json;
+        json.reserve(256 + capture.threads.size() * 4096);
+        json += "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        json += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"GameEngineKiro\"}}";
+
+        for (const auto& thread : capture.threads) {
+            const std::string tid = std::to_string(thread.threadId);
+
+            json += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + tid + ",\"args\":{\"name\":";
+            AppendJsonString(json, thread.threadName.c_str());
+            json += "}}";
+
+            for (const auto& zone : thread.zones) {
+                json += ",\n{\"name\":";
+                AppendJsonString(json, zone.name);
+                json += ",\"cat\":";
+                AppendJsonString(json, zone.category);
+                json += ",\"ph\":\"X\",\"ts\":";
+                AppendMicroseconds(json, zone.startNs);
+                json += ",\"dur\":";
+                AppendMicroseconds(json, zone.durationNs);
+                json += ",\"pid\":1,\"tid\":" + tid + "}";
+            }
+
+            for (const auto& counter : thread.counters) {
+                char value[32];
+                std::snprintf(value, sizeof(value), "%.6g", counter.value);
+                json += ",\n{\"name\":";
+                AppendJsonString(json, counter.name);
+                json += ",\"ph\":\"C\",\"ts\":";
+                AppendMicroseconds(json, counter.startNs);
+                json += ",\"pid\":1,\"tid\":" + tid + ",\"args\":{\"value\":" + value + "}}";
+            }
+        }
+
+        // Global instant events mark frame boundaries across every thread
+        for (size_t i = 0; i < capture.frameStartsNs.size(); ++i) {
+            json += ",\n{\"name\":\"Frame\",\"cat\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"ts\":";
+            AppendMicroseconds(json, capture.frameStartsNs[i]);
+            json += ",\"pid\":1,\"tid\":0}";
+        }
+
+        json += "\n]}\n";
+        return json;
+    }
+
+    bool Profiler::ExportChromeTrace(const std::string& filename) const {
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            LOG_ERROR("Profiler: could not open trace file: " + filename);
+            return false;
+        }
+
+        const std::string json = ExportChromeTrace();
+        file.write(json.data(), static_cast<std::streamsize>(json.size()));
+        if (!file) {
+            LOG_ERROR("Profiler: failed to write trace file: " + filename);
+            return false;
+        }
+
+        LOG_INFO("Profiler: wrote Chrome trace to " + filename);
+        return true;
+    }
+
+} // namespace GameEngine
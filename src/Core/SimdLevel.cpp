@@ -0,0 +1,73 @@
+#include "Core/SimdLevel.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define GAMEENGINE_SIMD_X86 1
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #include <immintrin.h>
+    #endif
+#endif
+
+namespace GameEngine {
+
+    namespace {
+#if GAMEENGINE_SIMD_X86
+        bool CpuSupportsAVX2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7) {
+                return false;
+            }
+
+            // AVX2 needs OS support for saving YMM state (OSXSAVE + XCR0 bits 1 and 2)
+            __cpuid(info, 1);
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+            if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) {
+                return false;
+            }
+
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#endif
+        }
+
+        bool CpuSupportsSSE2() {
+#if defined(_M_X64) || defined(__x86_64__)
+            return true; // Part of the x86-64 baseline
+#elif defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 1);
+            return (info[3] & (1 << 26)) != 0;
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse2");
+#endif
+        }
+#endif // GAMEENGINE_SIMD_X86
+    }
+
+    SimdLevel DetectSupportedSimdLevel() {
+#if GAMEENGINE_SIMD_X86
+        static const SimdLevel s_supported = CpuSupportsAVX2() ? SimdLevel::AVX2
+                                           : CpuSupportsSSE2() ? SimdLevel::SSE2
+                                           : SimdLevel::Scalar;
+        return s_supported;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    const char* GetSimdLevelName(SimdLevel level) {
+        switch (level) {
+            case SimdLevel::Scalar: return "Scalar";
+            case SimdLevel::SSE2:   return "SSE2";
+            case SimdLevel::AVX2:   return "AVX2";
+            default:                return "Unknown";
+        }
+    }
+}
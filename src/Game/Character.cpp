@@ -60,6 +60,10 @@ namespace GameEngine {
         return true;
     }
 
+    void Character::SetJobSystem(JobSystem* jobSystem) {
+        m_modelLoader->SetJobSystem(jobSystem);
+    }
+
     void Character::Update(float deltaTime, InputManager* input, ThirdPersonCameraSystem* camera) {
         if (m_movementComponent) {
             // Update movement
@@ -75,10 +79,11 @@ namespace GameEngine {
 
         // Get color based on current movement component type
         Math::Vec4 currentColor = GetMovementTypeColor();
+        const Math::Vec3 renderPosition = GetRenderPosition();
         
         if (IsUsingFBXModel()) {
             // Render FBX model meshes with rotation and offset
-            Math::Vec3 basePosition = GetPosition();
+            Math::Vec3 basePosition = renderPosition;
             Math::Vec3 scale(m_modelScale, m_modelScale, m_modelScale);
             
             // Create rotation quaternion from yaw angle
@@ -116,13 +121,13 @@ namespace GameEngine {
                      std::to_string(m_modelOffset.x) + ", " + std::to_string(m_modelOffset.y) + ", " + std::to_string(m_modelOffset.z) + ")");
         } else {
             // Draw character as a capsule (fallback when no FBX model) - matches physics collision shape
-            renderer->DrawCapsule(GetPosition(), m_radius, m_height, currentColor);
+            renderer->DrawCapsule(renderPosition, m_radius, m_height, currentColor);
         }
 
         // Render debug collision capsule if enabled
         if (m_showDebugCapsule) {
             Math::Vec4 debugColor(1.0f, 0.0f, 0.0f, 0.5f); // Semi-transparent red
-            renderer->DrawCapsule(GetPosition(), m_radius, m_height, debugColor);
+            renderer->DrawCapsule(renderPosition, m_radius, m_height, debugColor);
         }
     }
 
@@ -141,6 +146,13 @@ namespace GameEngine {
         return defaultPos;
     }
 
+    Math::Vec3 Character::GetRenderPosition() const {
+        if (m_movementComponent) {
+            return m_movementComponent->GetRenderPosition();
+        }
+        return GetPosition();
+    }
+
     void Character::SetRotation(float yaw) {
         if (m_movementComponent) {
             m_movementComponent->SetRotation(yaw);
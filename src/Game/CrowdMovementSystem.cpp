@@ -0,0 +1,814 @@
+#include "Game/CrowdMovementSystem.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define GAMEENGINE_CROWD_KERNELS_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #define CROWD_KERNEL_TARGET_SSE2
+        #define CROWD_KERNEL_TARGET_AVX2
+    #else
+        #define CROWD_KERNEL_TARGET_SSE2 __attribute__((target("sse2")))
+        #define CROWD_KERNEL_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+namespace GameEngine {
+
+    namespace {
+        constexpr float MIN_INPUT_LENGTH_SQ = 1e-6f;
+        constexpr uint32_t LANE_TRUE = 0xFFFFFFFFu;
+
+        struct AgentArrays {
+            float* positionX;
+            float* positionY;
+            float* positionZ;
+            float* velocityX;
+            float* velocityY;
+            float* velocityZ;
+            const float* inputX;
+            const float* inputZ;
+            float* facingX;
+            float* facingZ;
+            float* moveX;
+            float* moveZ;
+            const float* groundY;
+            uint32_t* grounded;
+            uint32_t* jumping;
+            uint32_t* jumpRequested;
+            const uint32_t* hasGround;
+        };
+
+        // Per-update constants; the products with deltaTime are formed once so every level sees the same values
+        struct StepParams {
+            float deltaTime;
+            float groundAccelerationStep;
+            float airAccelerationStep;
+            float gravityStep;
+            float maxSpeed;
+            float jumpVelocity;
+            uint32_t canJump;
+            float frictionStep;
+            float brakingFrictionStep;
+            float airFrictionStep;
+            float minSpeed;
+            float snapDistance;
+        };
+
+        using StepKernel = void (*)(const AgentArrays&, const StepParams&, size_t, size_t);
+
+        struct KernelTable {
+            StepKernel accelerate;
+            StepKernel integrate;
+            StepKernel settle;
+        };
+
+        // ---------------------------------------------------------------------------------
+        // Scalar reference kernels. SIMD variants must mirror the operation order exactly.
+        // ---------------------------------------------------------------------------------
+
+        // Jump, input acceleration with speed clamp, gravity, and this update's horizontal displacement
+        void AccelerateScalar(const AgentArrays& a, const StepParams& p, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                bool grounded = a.grounded[i] != 0;
+                float vy = a.velocityY[i];
+                if (a.jumpRequested[i] != 0 && grounded && p.canJump != 0) {
+                    vy = p.jumpVelocity;
+                    grounded = false;
+                    a.jumping[i] = LANE_TRUE;
+                }
+                a.jumpRequested[i] = 0;
+
+                float vx = a.velocityX[i];
+                float vz = a.velocityZ[i];
+                float ix = a.inputX[i];
+                float iz = a.inputZ[i];
+                float inputLengthSq = ix * ix + iz * iz;
+                if (inputLengthSq >= MIN_INPUT_LENGTH_SQ) {
+                    float inputLength = std::sqrt(inputLengthSq);
+                    float dirX = ix / inputLength;
+                    float dirZ = iz / inputLength;
+                    float accelerationStep = grounded ? p.groundAccelerationStep : p.airAccelerationStep;
+                    vx = vx + dirX * accelerationStep;
+                    vz = vz + dirZ * accelerationStep;
+
+                    float speed = std::sqrt(vx * vx + vz * vz);
+                    if (speed > p.maxSpeed) {
+                        float scale = p.maxSpeed / speed;
+                        vx = vx * scale;
+                        vz = vz * scale;
+                    }
+                    a.facingX[i] = dirX;
+                    a.facingZ[i] = dirZ;
+                }
+
+                if (!grounded) {
+                    vy = vy + p.gravityStep;
+                }
+
+                a.velocityX[i] = vx;
+                a.velocityY[i] = vy;
+                a.velocityZ[i] = vz;
+                a.grounded[i] = grounded ? LANE_TRUE : 0;
+                a.moveX[i] = vx * p.deltaTime;
+                a.moveZ[i] = vz * p.deltaTime;
+            }
+        }
+
+        void IntegrateScalar(const AgentArrays& a, const StepParams& p, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                a.positionX[i] = a.positionX[i] + a.moveX[i];
+                a.positionY[i] = a.positionY[i] + a.velocityY[i] * p.deltaTime;
+                a.positionZ[i] = a.positionZ[i] + a.moveZ[i];
+            }
+        }
+
+        // Landing and ground snapping, then ground friction, braking or air resistance
+        void SettleScalar(const AgentArrays& a, const StepParams& p, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                bool grounded = a.grounded[i] != 0;
+                float py = a.positionY[i];
+                float vy = a.velocityY[i];
+                float groundY = a.groundY[i];
+                float snapLimit = groundY + p.snapDistance;
+
+                // Walking down a step or slope keeps contact inside the snap band
+                bool hasGround = a.hasGround[i] != 0;
+                bool land = hasGround && vy <= 0.0f && (py <= groundY || (grounded && py <= snapLimit));
+                if (land) {
+                    py = groundY;
+                    vy = 0.0f;
+                    grounded = true;
+                    a.jumping[i] = 0;
+                } else if (!hasGround || py > snapLimit) {
+                    grounded = false;
+                }
+
+                float vx = a.velocityX[i];
+                float vz = a.velocityZ[i];
+                float ix = a.inputX[i];
+                float iz = a.inputZ[i];
+                bool hasInput = ix * ix + iz * iz >= MIN_INPUT_LENGTH_SQ;
+                float dragStep = grounded ? (hasInput ? p.frictionStep : p.brakingFrictionStep) : p.airFrictionStep;
+                float speed = std::sqrt(vx * vx + vz * vz);
+                float factor = speed > dragStep ? (speed - dragStep) / speed : 0.0f;
+                if (grounded && speed <= p.minSpeed) {
+                    factor = 0.0f;
+                }
+
+                a.positionY[i] = py;
+                a.velocityX[i] = vx * factor;
+                a.velocityY[i] = vy;
+                a.velocityZ[i] = vz * factor;
+                a.grounded[i] = grounded ? LANE_TRUE : 0;
+            }
+        }
+
+#if GAMEENGINE_CROWD_KERNELS_X86
+        // ---------------------------------------------------------------------------------
+        // SSE2 kernels: four agents per iteration, branches replaced by lane masks
+        // ---------------------------------------------------------------------------------
+
+        CROWD_KERNEL_TARGET_SSE2
+        inline __m128 SelectSSE2(__m128 mask, __m128 ifTrue, __m128 ifFalse) {
+            return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+        }
+
+        CROWD_KERNEL_TARGET_SSE2
+        inline __m128 LoadMaskSSE2(const uint32_t* flags) {
+            return _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(flags)));
+        }
+
+        CROWD_KERNEL_TARGET_SSE2
+        inline void StoreMaskSSE2(uint32_t* flags, __m128 mask) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(flags), _mm_castps_si128(mask));
+        }
+
+        CROWD_KERNEL_TARGET_SSE2
+        void AccelerateSSE2(const AgentArrays& a, const StepParams& p, size_t begin, size_t end) {
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 canJump = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(p.canJump)));
+            const __m128 jumpVelocity = _mm_set1_ps(p.jumpVelocity);
+            const __m128 minInputSq = _mm_set1_ps(MIN_INPUT_LENGTH_SQ);
+            const __m128 groundStep = _mm_set1_ps(p.groundAccelerationStep);
+            const __m128 airStep = _mm_set1_ps(p.airAccelerationStep);
+            const __m128 maxSpeed = _mm_set1_ps(p.maxSpeed);
+            const __m128 gravityStep = _mm_set1_ps(p.gravityStep);
+            const __m128 dt = _mm_set1_ps(p.deltaTime);
+
+            size_t i = begin;
+            for (; i + 4 <= end; i += 4) {
+                __m128 grounded = LoadMaskSSE2(a.grounded + i);
+                __m128 vy = _mm_loadu_ps(a.velocityY + i);
+                __m128 jump = _mm_and_ps(_mm_and_ps(LoadMaskSSE2(a.jumpRequested + i), grounded), canJump);
+                vy = SelectSSE2(jump, jumpVelocity, vy);
+                grounded = _mm_andnot_ps(jump, grounded);
+                StoreMaskSSE2(a.jumping + i, _mm_or_ps(LoadMaskSSE2(a.jumping + i), jump));
+                StoreMaskSSE2(a.jumpRequested + i, zero);
+
+                __m128 vx = _mm_loadu_ps(a.velocityX + i);
+                __m128 vz = _mm_loadu_ps(a.velocityZ + i);
+                __m128 ix = _mm_loadu_ps(a.inputX + i);
+                __m128 iz = _mm_loadu_ps(a.inputZ + i);
+                __m128 inputLengthSq = _mm_add_ps(_mm_mul_ps(ix, ix), _mm_mul_ps(iz, iz));
+                __m128 hasInput = _mm_cmpge_ps(inputLengthSq, minInputSq);
+                __m128 inputLength = _mm_sqrt_ps(_mm_max_ps(inputLengthSq, minInputSq));
+                __m128 dirX = _mm_div_ps(ix, inputLength);
+                __m128 dirZ = _mm_div_ps(iz, inputLength);
+                __m128 accelerationStep = SelectSSE2(grounded, groundStep, airStep);
+                __m128 nvx = _mm_add_ps(vx, _mm_mul_ps(dirX, accelerationStep));
+                __m128 nvz = _mm_add_ps(vz, _mm_mul_ps(dirZ, accelerationStep));
+
+                __m128 speed = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(nvx, nvx), _mm_mul_ps(nvz, nvz)));
+                __m128 overSpeed = _mm_cmpgt_ps(speed, maxSpeed);
+                __m128 scale = _mm_div_ps(maxSpeed, _mm_max_ps(speed, maxSpeed));
+                nvx = SelectSSE2(overSpeed, _mm_mul_ps(nvx, scale), nvx);
+                nvz = SelectSSE2(overSpeed, _mm_mul_ps(nvz, scale), nvz);
+
+                vx = SelectSSE2(hasInput, nvx, vx);
+                vz = SelectSSE2(hasInput, nvz, vz);
+                _mm_storeu_ps(a.facingX + i, SelectSSE2(hasInput, dirX, _mm_loadu_ps(a.facingX + i)));
+                _mm_storeu_ps(a.facingZ + i, SelectSSE2(hasInput, dirZ, _mm_loadu_ps(a.facingZ + i)));
+
+                vy = SelectSSE2(grounded, vy, _mm_add_ps(vy, gravityStep));
+
+                _mm_storeu_ps(a.velocityX + i, vx);
+                _mm_storeu_ps(a.velocityY + i, vy);
+                _mm_storeu_ps(a.velocityZ + i, vz);
+                StoreMaskSSE2(a.grounded + i, grounded);
+                _mm_storeu_ps(a.moveX + i, _mm_mul_ps(vx, dt));
+                _mm_storeu_ps(a.moveZ + i, _mm_mul_ps(vz, dt));
+            }
+            AccelerateScalar(a, p, i, end);
+        }
+
+        CROWD_KERNEL_TARGET_SSE2
+        void IntegrateSSE2(const AgentArrays& a, const StepParams& p, size_t begin, size_t end) {
+            const __m128 dt = _mm_set1_ps(p.deltaTime);
+
+            size_t i = begin;
+            for (; i + 4 <= end; i += 4) {
+                _mm_storeu_ps(a.positionX + i, _mm_add_ps(_mm_loadu_ps(a.positionX + i), _mm_loadu_ps(a.moveX + i)));
+                _mm_storeu_ps(a.positionY + i, _mm_add_ps(_mm_loadu_ps(a.positionY + i),
+                                                          _mm_mul_ps(_mm_loadu_ps(a.velocityY + i), dt)));
+                _mm_storeu_ps(a.positionZ + i, _mm_add_ps(_mm_loadu_ps(a.positionZ + i), _mm_loadu_ps(a.moveZ + i)));
+            }
+            IntegrateScalar(a, p, i, end);
+        }
+
+        CROWD_KERNEL_TARGET_SSE2
+        void SettleSSE2(const AgentArrays& a, const StepParams& p, size_t begin, size_t end) {
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 allTrue = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            const __m128 snapDistance = _mm_set1_ps(p.snapDistance);
+            const __m128 minInputSq = _mm_set1_ps(MIN_INPUT_LENGTH_SQ);
+            const __m128 frictionStep = _mm_set1_ps(p.frictionStep);
+            const __m128 brakingStep = _mm_set1_ps(p.brakingFrictionStep);
+            const __m128 airStep = _mm_set1_ps(p.airFrictionStep);
+            const __m128 minSpeed = _mm_set1_ps(p.minSpeed);
+
+            size_t i = begin;
+            for (; i + 4 <= end; i += 4) {
+                __m128 grounded = LoadMaskSSE2(a.grounded + i);
+                __m128 py = _mm_loadu_ps(a.positionY + i);
+                __m128 vy = _mm_loadu_ps(a.velocityY + i);
+                __m128 groundY = _mm_loadu_ps(a.groundY + i);
+                __m128 snapLimit = _mm_add_ps(groundY, snapDistance);
+
+                __m128 hasGround = LoadMaskSSE2(a.hasGround + i);
+                __m128 inSnapBand = _mm_or_ps(_mm_cmple_ps(py, groundY),
+                                              _mm_and_ps(grounded, _mm_cmple_ps(py, snapLimit)));
+                __m128 land = _mm_and_ps(_mm_and_ps(hasGround, _mm_cmple_ps(vy, zero)), inSnapBand);
+                __m128 leave = _mm_andnot_ps(land, _mm_or_ps(_mm_andnot_ps(hasGround, allTrue),
+                                                             _mm_cmpgt_ps(py, snapLimit)));
+                py = SelectSSE2(land, groundY, py);
+                vy = SelectSSE2(land, zero, vy);
+                grounded = _mm_andnot_ps(leave, _mm_or_ps(grounded, land));
+                StoreMaskSSE2(a.jumping + i, _mm_andnot_ps(land, LoadMaskSSE2(a.jumping + i)));
+
+                __m128 vx = _mm_loadu_ps(a.velocityX + i);
+                __m128 vz = _mm_loadu_ps(a.velocityZ + i);
+                __m128 ix = _mm_loadu_ps(a.inputX + i);
+                __m128 iz = _mm_loadu_ps(a.inputZ + i);
+                __m128 hasInput = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(ix, ix), _mm_mul_ps(iz, iz)), minInputSq);
+                __m128 dragStep = SelectSSE2(grounded, SelectSSE2(hasInput, frictionStep, brakingStep), airStep);
+                __m128 speed = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vz, vz)));
+                __m128 moving = _mm_cmpgt_ps(speed, dragStep);
+                __m128 factor = _mm_and_ps(moving, _mm_div_ps(_mm_sub_ps(speed, dragStep), speed));
+                factor = _mm_andnot_ps(_mm_and_ps(grounded, _mm_cmple_ps(speed, minSpeed)), factor);
+
+                _mm_storeu_ps(a.positionY + i, py);
+                _mm_storeu_ps(a.velocityX + i, _mm_mul_ps(vx, factor));
+                _mm_storeu_ps(a.velocityY + i, vy);
+                _mm_storeu_ps(a.velocityZ + i, _mm_mul_ps(vz, factor));
+                StoreMaskSSE2(a.grounded + i, grounded);
+            }
+            SettleScalar(a, p, i, end);
+        }
+
+        // ---------------------------------------------------------------------------------
+        // AVX2 kernels: eight agents per iteration, SSE2 handles the tail
+        // ---------------------------------------------------------------------------------
+
+        CROWD_KERNEL_TARGET_AVX2
+        inline __m256 LoadMaskAVX2(const uint32_t* flags) {
+            return _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(flags)));
+        }
+
+        CROWD_KERNEL_TARGET_AVX2
+        inline void StoreMaskAVX2(uint32_t* flags, __m256 mask) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(flags), _mm256_castps_si256(mask));
+        }
+
+        CROWD_KERNEL_TARGET_AVX2
+        void AccelerateAVX2(const AgentArrays& a, const StepParams& p, size_t begin, size_t end) {
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 canJump = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(p.canJump)));
+            const __m256 jumpVelocity = _mm256_set1_ps(p.jumpVelocity);
+            const __m256 minInputSq = _mm256_set1_ps(MIN_INPUT_LENGTH_SQ);
+            const __m256 groundStep = _mm256_set1_ps(p.groundAccelerationStep);
+            const __m256 airStep = _mm256_set1_ps(p.airAccelerationStep);
+            const __m256 maxSpeed = _mm256_set1_ps(p.maxSpeed);
+            const __m256 gravityStep = _mm256_set1_ps(p.gravityStep);
+            const __m256 dt = _mm256_set1_ps(p.deltaTime);
+
+            size_t i = begin;
+            for (; i + 8 <= end; i += 8) {
+                __m256 grounded = LoadMaskAVX2(a.grounded + i);
+                __m256 vy = _mm256_loadu_ps(a.velocityY + i);
+                __m256 jump = _mm256_and_ps(_mm256_and_ps(LoadMaskAVX2(a.jumpRequested + i), grounded), canJump);
+                vy = _mm256_blendv_ps(vy, jumpVelocity, jump);
+                grounded = _mm256_andnot_ps(jump, grounded);
+                StoreMaskAVX2(a.jumping + i, _mm256_or_ps(LoadMaskAVX2(a.jumping + i), jump));
+                StoreMaskAVX2(a.jumpRequested + i, zero);
+
+                __m256 vx = _mm256_loadu_ps(a.velocityX + i);
+                __m256 vz = _mm256_loadu_ps(a.velocityZ + i);
+                __m256 ix = _mm256_loadu_ps(a.inputX + i);
+                __m256 iz = _mm256_loadu_ps(a.inputZ + i);
+                __m256 inputLengthSq = _mm256_add_ps(_mm256_mul_ps(ix, ix), _mm256_mul_ps(iz, iz));
+                __m256 hasInput = _mm256_cmp_ps(inputLengthSq, minInputSq, _CMP_GE_OQ);
+                __m256 inputLength = _mm256_sqrt_ps(_mm256_max_ps(inputLengthSq, minInputSq));
+                __m256 dirX = _mm256_div_ps(ix, inputLength);
+                __m256 dirZ = _mm256_div_ps(iz, inputLength);
+                __m256 accelerationStep = _mm256_blendv_ps(airStep, groundStep, grounded);
+                __m256 nvx = _mm256_add_ps(vx, _mm256_mul_ps(dirX, accelerationStep));
+                __m256 nvz = _mm256_add_ps(vz, _mm256_mul_ps(dirZ, accelerationStep));
+
+                __m256 speed = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(nvx, nvx), _mm256_mul_ps(nvz, nvz)));
+                __m256 overSpeed = _mm256_cmp_ps(speed, maxSpeed, _CMP_GT_OQ);
+                __m256 scale = _mm256_div_ps(maxSpeed, _mm256_max_ps(speed, maxSpeed));
+                nvx = _mm256_blendv_ps(nvx, _mm256_mul_ps(nvx, scale), overSpeed);
+                nvz = _mm256_blendv_ps(nvz, _mm256_mul_ps(nvz, scale), overSpeed);
+
+                vx = _mm256_blendv_ps(vx, nvx, hasInput);
+                vz = _mm256_blendv_ps(vz, nvz, hasInput);
+                _mm256_storeu_ps(a.facingX + i, _mm256_blendv_ps(_mm256_loadu_ps(a.facingX + i), dirX, hasInput));
+                _mm256_storeu_ps(a.facingZ + i, _mm256_blendv_ps(_mm256_loadu_ps(a.facingZ + i), dirZ, hasInput));
+
+                vy = _mm256_blendv_ps(_mm256_add_ps(vy, gravityStep), vy, grounded);
+
+                _mm256_storeu_ps(a.velocityX + i, vx);
+                _mm256_storeu_ps(a.velocityY + i, vy);
+                _mm256_storeu_ps(a.velocityZ + i, vz);
+                StoreMaskAVX2(a.grounded + i, grounded);
+                _mm256_storeu_ps(a.moveX + i, _mm256_mul_ps(vx, dt));
+                _mm256_storeu_ps(a.moveZ + i, _mm256_mul_ps(vz, dt));
+            }
+            AccelerateSSE2(a, p, i, end);
+        }
+
+        CROWD_KERNEL_TARGET_AVX2
+        void IntegrateAVX2(const AgentArrays& a, const StepParams& p, size_t begin, size_t end) {
+            const __m256 dt = _mm256_set1_ps(p.deltaTime);
+
+            size_t i = begin;
+            for (; i + 8 <= end; i += 8) {
+                _mm256_storeu_ps(a.positionX + i, _mm256_add_ps(_mm256_loadu_ps(a.positionX + i),
+                                                                _mm256_loadu_ps(a.moveX + i)));
+                _mm256_storeu_ps(a.positionY + i, _mm256_add_ps(_mm256_loadu_ps(a.positionY + i),
+                                                                _mm256_mul_ps(_mm256_loadu_ps(a.velocityY + i), dt)));
+                _mm256_storeu_ps(a.positionZ + i, _mm256_add_ps(_mm256_loadu_ps(a.positionZ + i),
+                                                                _mm256_loadu_ps(a.moveZ + i)));
+            }
+            IntegrateSSE2(a, p, i, end);
+        }
+
+        CROWD_KERNEL_TARGET_AVX2
+        void SettleAVX2(const AgentArrays& a, const StepParams& p, size_t begin, size_t end) {
+            const __m256 zero = _mm256_setzero_ps();
+            const __m256 allTrue = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            const __m256 snapDistance = _mm256_set1_ps(p.snapDistance);
+            const __m256 minInputSq = _mm256_set1_ps(MIN_INPUT_LENGTH_SQ);
+            const __m256 frictionStep = _mm256_set1_ps(p.frictionStep);
+            const __m256 brakingStep = _mm256_set1_ps(p.brakingFrictionStep);
+            const __m256 airStep = _mm256_set1_ps(p.airFrictionStep);
+            const __m256 minSpeed = _mm256_set1_ps(p.minSpeed);
+
+            size_t i = begin;
+            for (; i + 8 <= end; i += 8) {
+                __m256 grounded = LoadMaskAVX2(a.grounded + i);
+                __m256 py = _mm256_loadu_ps(a.positionY + i);
+                __m256 vy = _mm256_loadu_ps(a.velocityY + i);
+                __m256 groundY = _mm256_loadu_ps(a.groundY + i);
+                __m256 snapLimit = _mm256_add_ps(groundY, snapDistance);
+
+                __m256 hasGround = LoadMaskAVX2(a.hasGround + i);
+                __m256 inSnapBand = _mm256_or_ps(_mm256_cmp_ps(py, groundY, _CMP_LE_OQ),
+                                                 _mm256_and_ps(grounded, _mm256_cmp_ps(py, snapLimit, _CMP_LE_OQ)));
+                __m256 land = _mm256_and_ps(_mm256_and_ps(hasGround, _mm256_cmp_ps(vy, zero, _CMP_LE_OQ)), inSnapBand);
+                __m256 leave = _mm256_andnot_ps(land, _mm256_or_ps(_mm256_andnot_ps(hasGround, allTrue),
+                                                                   _mm256_cmp_ps(py, snapLimit, _CMP_GT_OQ)));
+                py = _mm256_blendv_ps(py, groundY, land);
+                vy = _mm256_blendv_ps(vy, zero, land);
+                grounded = _mm256_andnot_ps(leave, _mm256_or_ps(grounded, land));
+                StoreMaskAVX2(a.jumping + i, _mm256_andnot_ps(land, LoadMaskAVX2(a.jumping + i)));
+
+                __m256 vx = _mm256_loadu_ps(a.velocityX + i);
+                __m256 vz = _mm256_loadu_ps(a.velocityZ + i);
+                __m256 ix = _mm256_loadu_ps(a.inputX + i);
+                __m256 iz = _mm256_loadu_ps(a.inputZ + i);
+                __m256 hasInput = _mm256_cmp_ps(_mm256_add_ps(_mm256_mul_ps(ix, ix), _mm256_mul_ps(iz, iz)),
+                                                minInputSq, _CMP_GE_OQ);
+                __m256 dragStep = _mm256_blendv_ps(airStep, _mm256_blendv_ps(brakingStep, frictionStep, hasInput), grounded);
+                __m256 speed = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vz, vz)));
+                __m256 moving = _mm256_cmp_ps(speed, dragStep, _CMP_GT_OQ);
+                __m256 factor = _mm256_and_ps(moving, _mm256_div_ps(_mm256_sub_ps(speed, dragStep), speed));
+                factor = _mm256_andnot_ps(_mm256_and_ps(grounded, _mm256_cmp_ps(speed, minSpeed, _CMP_LE_OQ)), factor);
+
+                _mm256_storeu_ps(a.positionY + i, py);
+                _mm256_storeu_ps(a.velocityX + i, _mm256_mul_ps(vx, factor));
+                _mm256_storeu_ps(a.velocityY + i, vy);
+                _mm256_storeu_ps(a.velocityZ + i, _mm256_mul_ps(vz, factor));
+                StoreMaskAVX2(a.grounded + i, grounded);
+            }
+            SettleSSE2(a, p, i, end);
+        }
+#endif // GAMEENGINE_CROWD_KERNELS_X86
+
+        const KernelTable& GetKernelTable(SimdLevel level) {
+            static const KernelTable s_scalar = {AccelerateScalar, IntegrateScalar, SettleScalar};
+#if GAMEENGINE_CROWD_KERNELS_X86
+            static const KernelTable s_sse2 = {AccelerateSSE2, IntegrateSSE2, SettleSSE2};
+            static const KernelTable s_avx2 = {AccelerateAVX2, IntegrateAVX2, SettleAVX2};
+            switch (level) {
+                case SimdLevel::AVX2: return s_avx2;
+                case SimdLevel::SSE2: return s_sse2;
+                default:              return s_scalar;
+            }
+#else
+            (void)level;
+            return s_scalar;
+#endif
+        }
+    }
+
+    CrowdMovementSystem::CrowdMovementSystem()
+        : m_simdLevel(DetectSupportedSimdLevel()) {
+    }
+
+    CrowdMovementSystem::~CrowdMovementSystem() {
+    }
+
+    bool CrowdMovementSystem::Initialize(PhysicsEngine* physicsEngine) {
+        m_physicsEngine = physicsEngine;
+
+        LOG_INFO(std::string("CrowdMovementSystem initialized with ") + GetSimdLevelName(m_simdLevel) +
+                 " kernels" + (physicsEngine ? ", batched capsule sweeps" : ", flat ground"));
+        return true;
+    }
+
+    void CrowdMovementSystem::Shutdown() {
+        ClearAgents();
+        m_sweepQueries = {};
+        m_sweepHits = {};
+        m_sweepSlots = {};
+        m_physicsEngine = nullptr;
+    }
+
+    void CrowdMovementSystem::Update(float deltaTime) {
+        const size_t count = m_agentIds.size();
+        if (count == 0 || deltaTime <= 0.0f) {
+            return;
+        }
+
+        StepParams params;
+        params.deltaTime = deltaTime;
+        params.groundAccelerationStep = m_acceleration * deltaTime;
+        params.airAccelerationStep = m_airAcceleration * m_config.airControl * deltaTime;
+        params.gravityStep = m_gravity * m_config.gravityScale * deltaTime;
+        params.maxSpeed = m_config.maxWalkSpeed;
+        params.jumpVelocity = m_config.jumpZVelocity;
+        params.canJump = m_config.canJump ? LANE_TRUE : 0;
+        params.frictionStep = m_friction * deltaTime;
+        params.brakingFrictionStep = m_brakingFriction * deltaTime;
+        params.airFrictionStep = m_airFriction * deltaTime;
+        params.minSpeed = m_minSpeedThreshold;
+        params.snapDistance = m_groundSnapDistance;
+
+        AgentArrays arrays;
+        arrays.positionX = m_positionX.data();
+        arrays.positionY = m_positionY.data();
+        arrays.positionZ = m_positionZ.data();
+        arrays.velocityX = m_velocityX.data();
+        arrays.velocityY = m_velocityY.data();
+        arrays.velocityZ = m_velocityZ.data();
+        arrays.inputX = m_inputX.data();
+        arrays.inputZ = m_inputZ.data();
+        arrays.facingX = m_facingX.data();
+        arrays.facingZ = m_facingZ.data();
+        arrays.moveX = m_moveX.data();
+        arrays.moveZ = m_moveZ.data();
+        arrays.groundY = m_groundY.data();
+        arrays.grounded = m_grounded.data();
+        arrays.jumping = m_jumping.data();
+        arrays.jumpRequested = m_jumpRequested.data();
+        arrays.hasGround = m_hasGround.data();
+
+        const KernelTable& kernels = GetKernelTable(m_simdLevel);
+        kernels.accelerate(arrays, params, 0, count);
+        if (m_physicsEngine) {
+            SweepHorizontalMovement();
+        }
+        kernels.integrate(arrays, params, 0, count);
+
+        if (m_physicsEngine) {
+            ProbeGround(deltaTime);
+        } else {
+            std::fill(m_groundY.begin(), m_groundY.end(), m_groundLevel + m_characterHeight * 0.5f);
+            std::fill(m_hasGround.begin(), m_hasGround.end(), LANE_TRUE);
+        }
+        kernels.settle(arrays, params, 0, count);
+    }
+
+    void CrowdMovementSystem::SweepHorizontalMovement() {
+        const size_t count = m_agentIds.size();
+        const float capsuleHeight = std::max(0.0f, m_characterHeight - 2.0f * m_characterRadius);
+        const float minWalkableNormalY = std::cos(glm::radians(m_config.maxSlopeAngle));
+
+        m_sweepQueries.clear();
+        m_sweepSlots.clear();
+        for (size_t i = 0; i < count; ++i) {
+            const float moveX = m_moveX[i];
+            const float moveZ = m_moveZ[i];
+            if (moveX * moveX + moveZ * moveZ <= 1e-12f) {
+                continue;
+            }
+
+            // Grounded agents sweep raised by the step height so kerbs and stairs do not block them
+            const float lift = m_grounded[i] != 0 ? m_config.maxStepHeight : 0.0f;
+            SweepQuery query;
+            query.from = Math::Vec3(m_positionX[i], m_positionY[i] + lift, m_positionZ[i]);
+            query.to = query.from + Math::Vec3(moveX, 0.0f, moveZ);
+            query.radius = m_characterRadius;
+            query.height = capsuleHeight;
+            query.filter.filterGroup = m_filterGroup;
+            query.filter.filterMask = m_filterMask;
+            m_sweepQueries.push_back(query);
+            m_sweepSlots.push_back(static_cast<uint32_t>(i));
+        }
+
+        if (m_sweepQueries.empty()) {
+            return;
+        }
+        m_sweepHits.resize(m_sweepQueries.size());
+        if (!m_physicsEngine->SweepBatch(m_sweepQueries, m_sweepHits)) {
+            return;
+        }
+
+        for (size_t q = 0; q < m_sweepSlots.size(); ++q) {
+            const PhysicsEngine::SweepHit& hit = m_sweepHits[q];
+            if (!hit.hasHit || hit.normal.y >= minWalkableNormalY) {
+                continue; // Walkable slopes are climbed through the ground probe
+            }
+
+            // Stop short of the wall and slide the velocity along it
+            const uint32_t i = m_sweepSlots[q];
+            const float moveLength = std::sqrt(m_moveX[i] * m_moveX[i] + m_moveZ[i] * m_moveZ[i]);
+            const float allowed = std::max(0.0f, hit.distance - m_skinWidth);
+            const float scale = allowed / moveLength;
+            m_moveX[i] = m_moveX[i] * scale;
+            m_moveZ[i] = m_moveZ[i] * scale;
+
+            const float normalLength = std::sqrt(hit.normal.x * hit.normal.x + hit.normal.z * hit.normal.z);
+            if (normalLength > 1e-6f) {
+                const float nx = hit.normal.x / normalLength;
+                const float nz = hit.normal.z / normalLength;
+                const float intoWall = m_velocityX[i] * nx + m_velocityZ[i] * nz;
+                if (intoWall < 0.0f) {
+                    m_velocityX[i] = m_velocityX[i] - nx * intoWall;
+                    m_velocityZ[i] = m_velocityZ[i] - nz * intoWall;
+                }
+            }
+        }
+    }
+
+    void CrowdMovementSystem::ProbeGround(float deltaTime) {
+        const size_t count = m_agentIds.size();
+        const float capsuleHeight = std::max(0.0f, m_characterHeight - 2.0f * m_characterRadius);
+        const float minWalkableNormalY = std::cos(glm::radians(m_config.maxSlopeAngle));
+
+        m_sweepQueries.resize(count);
+        m_sweepHits.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            // Start above the step height, or above last update's position when falling fast
+            const float rise = std::max(m_config.maxStepHeight, -m_velocityY[i] * deltaTime);
+            SweepQuery& query = m_sweepQueries[i];
+            query.from = Math::Vec3(m_positionX[i], m_positionY[i] + rise, m_positionZ[i]);
+            query.to = Math::Vec3(m_positionX[i], m_positionY[i] - m_groundProbeDistance, m_positionZ[i]);
+            query.radius = m_characterRadius;
+            query.height = capsuleHeight;
+            query.filter.filterGroup = m_filterGroup;
+            query.filter.filterMask = m_filterMask;
+            query.filter.ignoreBodyId = 0;
+        }
+
+        if (!m_physicsEngine->SweepBatch(m_sweepQueries, m_sweepHits)) {
+            std::fill(m_hasGround.begin(), m_hasGround.end(), 0u);
+            return;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            const PhysicsEngine::SweepHit& hit = m_sweepHits[i];
+            if (hit.hasHit && hit.normal.y >= minWalkableNormalY) {
+                m_groundY[i] = m_sweepQueries[i].from.y - hit.distance;
+                m_hasGround[i] = LANE_TRUE;
+            } else {
+                m_hasGround[i] = 0;
+            }
+        }
+    }
+
+    CrowdMovementSystem::AgentId CrowdMovementSystem::AddAgent(const Math::Vec3& position) {
+        const AgentId id = static_cast<AgentId>(m_slotOfAgent.size());
+        const size_t slot = m_agentIds.size();
+        m_agentIds.push_back(id);
+        m_slotOfAgent.push_back(static_cast<uint32_t>(slot));
+        ResizeArrays(slot + 1);
+
+        m_positionX[slot] = position.x;
+        m_positionY[slot] = position.y;
+        m_positionZ[slot] = position.z;
+        m_facingZ[slot] = 1.0f;
+        m_groundY[slot] = m_groundLevel + m_characterHeight * 0.5f;
+        m_grounded[slot] = LANE_TRUE; // As DeterministicMovementComponent; the first update drops it if airborne
+        return id;
+    }
+
+    bool CrowdMovementSystem::RemoveAgent(AgentId id) {
+        const uint32_t slot = GetSlot(id);
+        if (slot == NO_SLOT) {
+            return false;
+        }
+
+        const size_t last = m_agentIds.size() - 1;
+        if (slot != last) {
+            auto moveLast = [slot, last](auto& array) { array[slot] = array[last]; };
+            moveLast(m_positionX); moveLast(m_positionY); moveLast(m_positionZ);
+            moveLast(m_velocityX); moveLast(m_velocityY); moveLast(m_velocityZ);
+            moveLast(m_inputX); moveLast(m_inputZ);
+            moveLast(m_facingX); moveLast(m_facingZ);
+            moveLast(m_moveX); moveLast(m_moveZ);
+            moveLast(m_groundY);
+            moveLast(m_grounded); moveLast(m_jumping); moveLast(m_jumpRequested); moveLast(m_hasGround);
+
+            m_agentIds[slot] = m_agentIds[last];
+            m_slotOfAgent[m_agentIds[slot]] = slot;
+        }
+
+        m_agentIds.pop_back();
+        m_slotOfAgent[id] = NO_SLOT;
+        ResizeArrays(last);
+        return true;
+    }
+
+    bool CrowdMovementSystem::HasAgent(AgentId id) const {
+        return GetSlot(id) != NO_SLOT;
+    }
+
+    void CrowdMovementSystem::ClearAgents() {
+        m_agentIds.clear();
+        std::fill(m_slotOfAgent.begin(), m_slotOfAgent.end(), NO_SLOT);
+        ResizeArrays(0);
+    }
+
+    void CrowdMovementSystem::SetAgentMoveInput(AgentId id, const Math::Vec3& worldDirection) {
+        const uint32_t slot = GetSlot(id);
+        if (slot == NO_SLOT) {
+            return;
+        }
+
+        Math::Vec3 input(worldDirection.x, 0.0f, worldDirection.z);
+        const float length = glm::length(input);
+        if (length > 1.0f) {
+            input /= length;
+        }
+        m_inputX[slot] = input.x;
+        m_inputZ[slot] = input.z;
+    }
+
+    void CrowdMovementSystem::RequestJump(AgentId id) {
+        const uint32_t slot = GetSlot(id);
+        if (slot != NO_SLOT) {
+            m_jumpRequested[slot] = LANE_TRUE;
+        }
+    }
+
+    void CrowdMovementSystem::SetAgentPosition(AgentId id, const Math::Vec3& position) {
+        const uint32_t slot = GetSlot(id);
+        if (slot == NO_SLOT) {
+            return;
+        }
+        m_positionX[slot] = position.x;
+        m_positionY[slot] = position.y;
+        m_positionZ[slot] = position.z;
+    }
+
+    Math::Vec3 CrowdMovementSystem::GetAgentPosition(AgentId id) const {
+        const uint32_t slot = GetSlot(id);
+        if (slot == NO_SLOT) {
+            return Math::Vec3(0.0f);
+        }
+        return Math::Vec3(m_positionX[slot], m_positionY[slot], m_positionZ[slot]);
+    }
+
+    void CrowdMovementSystem::SetAgentVelocity(AgentId id, const Math::Vec3& velocity) {
+        const uint32_t slot = GetSlot(id);
+        if (slot == NO_SLOT) {
+            return;
+        }
+        m_velocityX[slot] = velocity.x;
+        m_velocityY[slot] = velocity.y;
+        m_velocityZ[slot] = velocity.z;
+    }
+
+    Math::Vec3 CrowdMovementSystem::GetAgentVelocity(AgentId id) const {
+        const uint32_t slot = GetSlot(id);
+        if (slot == NO_SLOT) {
+            return Math::Vec3(0.0f);
+        }
+        return Math::Vec3(m_velocityX[slot], m_velocityY[slot], m_velocityZ[slot]);
+    }
+
+    float CrowdMovementSystem::GetAgentRotation(AgentId id) const {
+        const uint32_t slot = GetSlot(id);
+        if (slot == NO_SLOT) {
+            return 0.0f;
+        }
+        return glm::degrees(std::atan2(m_facingX[slot], m_facingZ[slot]));
+    }
+
+    bool CrowdMovementSystem::IsAgentGrounded(AgentId id) const {
+        const uint32_t slot = GetSlot(id);
+        return slot != NO_SLOT && m_grounded[slot] != 0;
+    }
+
+    bool CrowdMovementSystem::IsAgentJumping(AgentId id) const {
+        const uint32_t slot = GetSlot(id);
+        return slot != NO_SLOT && m_jumping[slot] != 0;
+    }
+
+    void CrowdMovementSystem::GetAgentPositions(std::span<Math::Vec3> positions) const {
+        const size_t count = std::min(positions.size(), m_agentIds.size());
+        for (size_t i = 0; i < count; ++i) {
+            positions[i] = Math::Vec3(m_positionX[i], m_positionY[i], m_positionZ[i]);
+        }
+    }
+
+    void CrowdMovementSystem::SetCharacterSize(float radius, float height) {
+        m_characterRadius = std::max(radius, 0.01f);
+        m_characterHeight = std::max(height, 2.0f * m_characterRadius);
+    }
+
+    void CrowdMovementSystem::SetCollisionFilter(int filterGroup, int filterMask) {
+        m_filterGroup = filterGroup;
+        m_filterMask = filterMask;
+    }
+
+    SimdLevel CrowdMovementSystem::SetSimdLevel(SimdLevel level) {
+        const SimdLevel supported = DetectSupportedSimdLevel();
+        if (static_cast<int>(level) > static_cast<int>(supported)) {
+            LOG_WARNING(std::string("CrowdMovementSystem: ") + GetSimdLevelName(level) +
+                       " not supported, using " + GetSimdLevelName(supported));
+            level = supported;
+        }
+        m_simdLevel = level;
+        return level;
+    }
+
+    uint32_t CrowdMovementSystem::GetSlot(AgentId id) const {
+        return id < m_slotOfAgent.size() ? m_slotOfAgent[id] : NO_SLOT;
+    }
+
+    void CrowdMovementSystem::ResizeArrays(size_t count) {
+        for (auto* array : {&m_positionX, &m_positionY, &m_positionZ, &m_velocityX, &m_velocityY, &m_velocityZ,
+                            &m_inputX, &m_inputZ, &m_facingX, &m_facingZ, &m_moveX, &m_moveZ, &m_groundY}) {
+            array->resize(count, 0.0f);
+        }
+        for (auto* flags : {&m_grounded, &m_jumping, &m_jumpRequested, &m_hasGround}) {
+            flags->resize(count, 0u);
+        }
+    }
+}
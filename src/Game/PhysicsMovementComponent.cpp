@@ -48,6 +48,16 @@ namespace GameEngine {
         m_physicsEngine = nullptr;
     }
 
+    Math::Vec3 PhysicsMovementComponent::GetRenderPosition() const {
+        Math::Vec3 position;
+        Math::Quat rotation;
+        if (m_physicsEngine && m_rigidBodyId != 0 &&
+            m_physicsEngine->GetInterpolatedTransform(m_rigidBodyId, m_motionSlot, position, rotation)) {
+            return position;
+        }
+        return m_position;
+    }
+
     void PhysicsMovementComponent::SetPosition(const Math::Vec3& position) {
         m_position = position;
         if (m_physicsEngine && m_rigidBodyId != 0) {
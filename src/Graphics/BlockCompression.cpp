@@ -0,0 +1,1386 @@
+#include "Graphics/BlockCompression.h"
+#include "Resource/ParallelImport.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#define GAMEENGINE_BLOCK_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace GameEngine {
+
+    namespace {
+        std::atomic<bool> s_simdEnabled{true};
+
+        // Pixels or palette entries widened to int16 for the index search; channels a format
+        // does not encode stay zero so they add no error
+        struct alignas(16) BlockPixels {
+            int16_t rgba[16][4];
+        };
+
+        // BC7 two-subset partitions (bit i set: pixel i is in subset 1) and subset 1 anchors
+        const uint16_t BC7_PARTITIONS2[64] = {
+            0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80, 0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+            0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE, 0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+            0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A, 0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+            0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C, 0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+        };
+
+        const uint8_t BC7_ANCHORS2[64] = {
+            15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+            15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2,
+            15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6,
+             6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15
+        };
+
+        const int BC7_WEIGHTS3[8] = {0, 9, 18, 27, 37, 46, 55, 64};
+        const int BC7_WEIGHTS4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+        // ------------------------------------------------------------------ index search
+
+        // Nearest palette entry for each pixel by squared distance; ties keep the lower index
+        uint32_t FindClosestScalar(const BlockPixels& pixels, int pixelCount, const BlockPixels& palette,
+                                   int paletteSize, uint8_t* indices) {
+            uint32_t total = 0;
+            for (int i = 0; i < pixelCount; ++i) {
+                uint32_t best = std::numeric_limits<uint32_t>::max();
+                uint8_t bestIndex = 0;
+                for (int p = 0; p < paletteSize; ++p) {
+                    uint32_t error = 0;
+                    for (int c = 0; c < 4; ++c) {
+                        const int32_t d = pixels.rgba[i][c] - palette.rgba[p][c];
+                        error += static_cast<uint32_t>(d * d);
+                    }
+                    if (error < best) {
+                        best = error;
+                        bestIndex = static_cast<uint8_t>(p);
+                    }
+                }
+                indices[i] = bestIndex;
+                total += best;
+            }
+            return total;
+        }
+
+#ifdef GAMEENGINE_BLOCK_SSE2
+        // Four pixels per iteration: madd squares and sums channel pairs, the shuffles add the
+        // RG and BA halves of each pixel. Integer math keeps the result identical to the scalar path.
+        uint32_t FindClosestSSE2(const BlockPixels& pixels, int pixelCount, const BlockPixels& palette,
+                                 int paletteSize, uint8_t* indices) {
+            alignas(16) int32_t errors[16];
+            alignas(16) int32_t bestIndices[16];
+
+            for (int group = 0; group < pixelCount; group += 4) {
+                const __m128i p01 = _mm_load_si128(reinterpret_cast<const __m128i*>(pixels.rgba[group]));
+                const __m128i p23 = _mm_load_si128(reinterpret_cast<const __m128i*>(pixels.rgba[group + 2]));
+                __m128i bestError = _mm_set1_epi32(std::numeric_limits<int32_t>::max());
+                __m128i bestIndex = _mm_setzero_si128();
+
+                for (int p = 0; p < paletteSize; ++p) {
+                    int64_t packed;
+                    std::memcpy(&packed, palette.rgba[p], sizeof(packed));
+                    const __m128i entry = _mm_set1_epi64x(packed);
+
+                    const __m128i d01 = _mm_sub_epi16(p01, entry);
+                    const __m128i d23 = _mm_sub_epi16(p23, entry);
+                    const __m128 s01 = _mm_castsi128_ps(_mm_madd_epi16(d01, d01));
+                    const __m128 s23 = _mm_castsi128_ps(_mm_madd_epi16(d23, d23));
+                    const __m128i rg = _mm_castps_si128(_mm_shuffle_ps(s01, s23, _MM_SHUFFLE(2, 0, 2, 0)));
+                    const __m128i ba = _mm_castps_si128(_mm_shuffle_ps(s01, s23, _MM_SHUFFLE(3, 1, 3, 1)));
+                    const __m128i error = _mm_add_epi32(rg, ba);
+
+                    const __m128i closer = _mm_cmplt_epi32(error, bestError);
+                    bestError = _mm_or_si128(_mm_and_si128(closer, error), _mm_andnot_si128(closer, bestError));
+                    bestIndex = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32(p)), _mm_andnot_si128(closer, bestIndex));
+                }
+
+                _mm_store_si128(reinterpret_cast<__m128i*>(&errors[group]), bestError);
+                _mm_store_si128(reinterpret_cast<__m128i*>(&bestIndices[group]), bestIndex);
+            }
+
+            uint32_t total = 0;
+            for (int i = 0; i < pixelCount; ++i) {
+                indices[i] = static_cast<uint8_t>(bestIndices[i]);
+                total += static_cast<uint32_t>(errors[i]);
+            }
+            return total;
+        }
+#endif
+
+        uint32_t FindClosest(const BlockPixels& pixels, int pixelCount, const BlockPixels& palette,
+                             int paletteSize, uint8_t* indices) {
+#ifdef GAMEENGINE_BLOCK_SSE2
+            if (s_simdEnabled.load(std::memory_order_relaxed)) {
+                return FindClosestSSE2(pixels, pixelCount, palette, paletteSize, indices);
+            }
+#endif
+            return FindClosestScalar(pixels, pixelCount, palette, paletteSize, indices);
+        }
+
+        // ------------------------------------------------------------------ endpoint fitting
+
+        // Mean and dominant direction of the points over the first `channels` channels
+        void PrincipalAxis(const float (*points)[4], int count, int channels, float mean[4], float axis[4]) {
+            for (int c = 0; c < 4; ++c) {
+                mean[c] = 0.0f;
+                axis[c] = 0.0f;
+            }
+            if (count == 0) {
+                return;
+            }
+            for (int i = 0; i < count; ++i) {
+                for (int c = 0; c < channels; ++c) {
+                    mean[c] += points[i][c];
+                }
+            }
+            for (int c = 0; c < channels; ++c) {
+                mean[c] /= static_cast<float>(count);
+            }
+
+            float covariance[4][4] = {};
+            for (int i = 0; i < count; ++i) {
+                float d[4] = {};
+                for (int c = 0; c < channels; ++c) {
+                    d[c] = points[i][c] - mean[c];
+                }
+                for (int r = 0; r < channels; ++r) {
+                    for (int c = r; c < channels; ++c) {
+                        covariance[r][c] += d[r] * d[c];
+                    }
+                }
+            }
+
+            // Power iteration, started from the channel with the largest variance
+            int start = 0;
+            for (int c = 0; c < channels; ++c) {
+                for (int r = 0; r < c; ++r) {
+                    covariance[c][r] = covariance[r][c];
+                }
+                if (covariance[c][c] > covariance[start][start]) {
+                    start = c;
+                }
+            }
+            float v[4] = {};
+            for (int c = 0; c < channels; ++c) {
+                v[c] = covariance[start][c];
+            }
+
+            for (int iteration = 0; iteration < 8; ++iteration) {
+                float next[4] = {};
+                float largest = 0.0f;
+                for (int r = 0; r < channels; ++r) {
+                    for (int c = 0; c < channels; ++c) {
+                        next[r] += covariance[r][c] * v[c];
+                    }
+                    largest = std::max(largest, std::abs(next[r]));
+                }
+                if (largest <= 0.0f) {
+                    break;
+                }
+                for (int c = 0; c < channels; ++c) {
+                    v[c] = next[c] / largest;
+                }
+            }
+
+            float length = 0.0f;
+            for (int c = 0; c < channels; ++c) {
+                length += v[c] * v[c];
+            }
+            length = std::sqrt(length);
+            if (length <= 1e-6f) {
+                // Flat block: any direction works
+                for (int c = 0; c < channels; ++c) {
+                    axis[c] = 1.0f / std::sqrt(static_cast<float>(channels));
+                }
+                return;
+            }
+            for (int c = 0; c < channels; ++c) {
+                axis[c] = v[c] / length;
+            }
+        }
+
+        // Endpoints at the extreme projections onto the principal axis, moved inwards by `inset`
+        // of the range
+        void RangeFit(const float (*points)[4], int count, int channels, float inset, float a[4], float b[4]) {
+            float mean[4], axis[4];
+            PrincipalAxis(points, count, channels, mean, axis);
+
+            float minT = std::numeric_limits<float>::max();
+            float maxT = -std::numeric_limits<float>::max();
+            for (int i = 0; i < count; ++i) {
+                float t = 0.0f;
+                for (int c = 0; c < channels; ++c) {
+                    t += (points[i][c] - mean[c]) * axis[c];
+                }
+                minT = std::min(minT, t);
+                maxT = std::max(maxT, t);
+            }
+            if (count == 0) {
+                minT = maxT = 0.0f;
+            }
+
+            const float shrink = (maxT - minT) * inset;
+            minT += shrink;
+            maxT -= shrink;
+            for (int c = 0; c < 4; ++c) {
+                a[c] = c < channels ? std::clamp(mean[c] + axis[c] * minT, 0.0f, 255.0f) : 0.0f;
+                b[c] = c < channels ? std::clamp(mean[c] + axis[c] * maxT, 0.0f, 255.0f) : 0.0f;
+            }
+        }
+
+        // Endpoints minimising sum |(1 - w) a + w b - x|^2 for fixed palette weights; false
+        // when every point sits on the same weight
+        bool LeastSquaresFit(const float (*points)[4], const float* weights, int count, int channels, float a[4], float b[4]) {
+            float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+            float ax[4] = {}, bx[4] = {};
+            for (int i = 0; i < count; ++i) {
+                const float beta = weights[i];
+                const float alpha = 1.0f - beta;
+                aa += alpha * alpha;
+                bb += beta * beta;
+                ab += alpha * beta;
+                for (int c = 0; c < channels; ++c) {
+                    ax[c] += alpha * points[i][c];
+                    bx[c] += beta * points[i][c];
+                }
+            }
+
+            const float det = aa * bb - ab * ab;
+            if (std::abs(det) < 1e-6f) {
+                return false;
+            }
+            for (int c = 0; c < channels; ++c) {
+                a[c] = std::clamp((ax[c] * bb - bx[c] * ab) / det, 0.0f, 255.0f);
+                b[c] = std::clamp((bx[c] * aa - ax[c] * ab) / det, 0.0f, 255.0f);
+            }
+            return true;
+        }
+
+        // ------------------------------------------------------------------ BC1 colour
+
+        uint16_t PackRGB565(const float color[4]) {
+            const auto quantize = [](float value, int maxValue) {
+                return static_cast<uint16_t>(std::lround(std::clamp(value, 0.0f, 255.0f) * maxValue / 255.0f));
+            };
+            return static_cast<uint16_t>((quantize(color[0], 31) << 11) | (quantize(color[1], 63) << 5) | quantize(color[2], 31));
+        }
+
+        void UnpackRGB565(uint16_t packed, int color[3]) {
+            const int r = (packed >> 11) & 31;
+            const int g = (packed >> 5) & 63;
+            const int b = packed & 31;
+            color[0] = (r << 3) | (r >> 2);
+            color[1] = (g << 2) | (g >> 4);
+            color[2] = (b << 3) | (b >> 2);
+        }
+
+        // Palette as decoded: four colours, or three plus transparent black when c0 <= c1
+        void BuildBC1Palette(uint16_t c0, uint16_t c1, bool fourColor, int palette[4][4]) {
+            UnpackRGB565(c0, palette[0]);
+            UnpackRGB565(c1, palette[1]);
+            palette[0][3] = 255;
+            palette[1][3] = 255;
+            for (int c = 0; c < 3; ++c) {
+                if (fourColor) {
+                    palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+                    palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+                } else {
+                    palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+                    palette[3][c] = 0;
+                }
+            }
+            palette[2][3] = 255;
+            palette[3][3] = fourColor ? 255 : 0;
+        }
+
+        // Endpoint pair per 8-bit value whose 1/3 interpolant is closest to it, for solid blocks
+        struct SingleColorTables {
+            uint8_t match5[256][2];
+            uint8_t match6[256][2];
+
+            SingleColorTables() {
+                Build(match5, 5);
+                Build(match6, 6);
+            }
+
+            static void Build(uint8_t table[256][2], int bits) {
+                const int levels = 1 << bits;
+                for (int value = 0; value < 256; ++value) {
+                    int bestError = std::numeric_limits<int>::max();
+                    for (int a = 0; a < levels; ++a) {
+                        const int ea = bits == 5 ? (a << 3) | (a >> 2) : (a << 2) | (a >> 4);
+                        for (int b = 0; b < levels; ++b) {
+                            const int eb = bits == 5 ? (b << 3) | (b >> 2) : (b << 2) | (b >> 4);
+                            const int error = std::abs((2 * ea + eb) / 3 - value) * 256 + std::abs(ea - eb);
+                            if (error < bestError) {
+                                bestError = error;
+                                table[value][0] = static_cast<uint8_t>(a);
+                                table[value][1] = static_cast<uint8_t>(b);
+                            }
+                        }
+                    }
+                }
+            }
+        };
+
+        const SingleColorTables& GetSingleColorTables() {
+            static const SingleColorTables tables;
+            return tables;
+        }
+
+        struct ColorCandidate {
+            uint16_t c0 = 0;
+            uint16_t c1 = 0;
+            uint8_t indices[16] = {};
+            uint32_t error = std::numeric_limits<uint32_t>::max();
+        };
+
+        // Error of the quantized endpoints over the pixels that take part in the fit
+        void EvaluateColor(const BlockPixels& pixels, int count, const float a[4], const float b[4],
+                           bool fourColor, ColorCandidate& best) {
+            ColorCandidate candidate;
+            candidate.c0 = PackRGB565(a);
+            candidate.c1 = PackRGB565(b);
+
+            int decoded[4][4];
+            BuildBC1Palette(candidate.c0, candidate.c1, fourColor, decoded);
+            BlockPixels palette = {};
+            const int paletteSize = fourColor ? 4 : 3;
+            for (int p = 0; p < paletteSize; ++p) {
+                for (int c = 0; c < 3; ++c) {
+                    palette.rgba[p][c] = static_cast<int16_t>(decoded[p][c]);
+                }
+            }
+
+            candidate.error = FindClosest(pixels, count, palette, paletteSize, candidate.indices);
+            if (candidate.error < best.error) {
+                best = candidate;
+            }
+        }
+
+        // Palette weights of the BC1 indices, in the order the colours lie along the line
+        const float BC1_WEIGHTS4[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+        const float BC1_WEIGHTS3[3] = {0.0f, 1.0f, 0.5f};
+
+        void RefineColor(const float (*points)[4], const BlockPixels& pixels, int count, bool fourColor,
+                         int iterations, ColorCandidate& best) {
+            for (int iteration = 0; iteration < iterations; ++iteration) {
+                float weights[16];
+                for (int i = 0; i < count; ++i) {
+                    weights[i] = fourColor ? BC1_WEIGHTS4[best.indices[i]] : BC1_WEIGHTS3[best.indices[i]];
+                }
+                float a[4] = {}, b[4] = {};
+                if (!LeastSquaresFit(points, weights, count, 3, a, b)) {
+                    return;
+                }
+                const uint32_t previous = best.error;
+                EvaluateColor(pixels, count, a, b, fourColor, best);
+                if (best.error >= previous) {
+                    return;
+                }
+            }
+        }
+
+        // Best least-squares endpoints over every split of the pixels, ordered along `axis`,
+        // into the four palette clusters; returns false if no split was solvable
+        bool ClusterFit(const float (*points)[4], int count, const float axis[4], float bestA[4], float bestB[4]) {
+            int order[16];
+            float projection[16];
+            for (int i = 0; i < count; ++i) {
+                order[i] = i;
+                projection[i] = points[i][0] * axis[0] + points[i][1] * axis[1] + points[i][2] * axis[2];
+            }
+            std::sort(order, order + count, [&projection](int l, int r) { return projection[l] < projection[r]; });
+
+            // Prefix sums of the ordered points
+            float prefix[17][3] = {};
+            for (int i = 0; i < count; ++i) {
+                for (int c = 0; c < 3; ++c) {
+                    prefix[i + 1][c] = prefix[i][c] + points[order[i]][c];
+                }
+            }
+
+            // At the least-squares optimum the error is sum |x|^2 minus this gain, so the split
+            // with the largest gain wins; endpoints are only solved for the winner
+            float bestGain = -1.0f;
+            float bestAx[3] = {}, bestBx[3] = {};
+            float bestAa = 0.0f, bestBb = 0.0f, bestAb = 0.0f, bestDet = 0.0f;
+            const float* total = prefix[count];
+            for (int i = 0; i <= count; ++i) {
+                for (int j = i; j <= count; ++j) {
+                    const float n1 = static_cast<float>(j - i);
+                    for (int k = j; k <= count; ++k) {
+                        // Clusters [0, i) at a, [i, j) at 1/3, [j, k) at 2/3, [k, count) at b
+                        const float n2 = static_cast<float>(k - j);
+                        const float aa = static_cast<float>(i) + n1 * (4.0f / 9.0f) + n2 * (1.0f / 9.0f);
+                        const float bb = static_cast<float>(count - k) + n1 * (1.0f / 9.0f) + n2 * (4.0f / 9.0f);
+                        const float ab = (n1 + n2) * (2.0f / 9.0f);
+                        const float det = aa * bb - ab * ab;
+                        if (det < 1e-6f) {
+                            continue;
+                        }
+
+                        float ax[3], bx[3];
+                        float axax = 0.0f, bxbx = 0.0f, axbx = 0.0f;
+                        for (int c = 0; c < 3; ++c) {
+                            // s0 + 2/3 s1 + 1/3 s2 and s3 + 1/3 s1 + 2/3 s2 from the prefix sums
+                            ax[c] = (prefix[i][c] + prefix[j][c] + prefix[k][c]) * (1.0f / 3.0f);
+                            bx[c] = total[c] - ax[c];
+                            axax += ax[c] * ax[c];
+                            bxbx += bx[c] * bx[c];
+                            axbx += ax[c] * bx[c];
+                        }
+
+                        const float gain = (bb * axax + aa * bxbx - 2.0f * ab * axbx) / det;
+                        if (gain > bestGain) {
+                            bestGain = gain;
+                            bestAa = aa;
+                            bestBb = bb;
+                            bestAb = ab;
+                            bestDet = det;
+                            for (int c = 0; c < 3; ++c) {
+                                bestAx[c] = ax[c];
+                                bestBx[c] = bx[c];
+                            }
+                        }
+                    }
+                }
+            }
+            if (bestGain < 0.0f) {
+                return false;
+            }
+
+            for (int c = 0; c < 3; ++c) {
+                bestA[c] = std::clamp((bestAx[c] * bestBb - bestBx[c] * bestAb) / bestDet, 0.0f, 255.0f);
+                bestB[c] = std::clamp((bestBx[c] * bestAa - bestAx[c] * bestAb) / bestDet, 0.0f, 255.0f);
+            }
+            return true;
+        }
+
+        /**
+         * Encode the colour half of a BC1/BC2/BC3 block. `transparent` marks pixels written as
+         * index 3 of the three-colour mode (BC1 punch-through only); BC2/BC3 always decode
+         * four colours, so fourColorOnly disables the three-colour mode.
+         */
+        void EncodeColorBlock(const uint8_t rgba[64], const bool transparent[16], bool fourColorOnly,
+                              CompressionQuality quality, uint8_t block[8]) {
+            BlockPixels pixels = {};
+            float points[16][4] = {};
+            int pixelIndex[16];
+            int count = 0;
+            bool anyTransparent = false;
+            for (int i = 0; i < 16; ++i) {
+                if (transparent && transparent[i]) {
+                    anyTransparent = true;
+                    continue;
+                }
+                for (int c = 0; c < 3; ++c) {
+                    pixels.rgba[count][c] = rgba[i * 4 + c];
+                    points[count][c] = rgba[i * 4 + c];
+                }
+                pixelIndex[count++] = i;
+            }
+
+            const bool fourColor = fourColorOnly || !anyTransparent;
+            ColorCandidate best;
+
+            // A fully transparent block keeps zero endpoints: three-colour mode, every pixel on index 3
+            if (count > 0) {
+                bool solid = true;
+                for (int i = 1; i < count && solid; ++i) {
+                    solid = pixels.rgba[i][0] == pixels.rgba[0][0] && pixels.rgba[i][1] == pixels.rgba[0][1] &&
+                            pixels.rgba[i][2] == pixels.rgba[0][2];
+                }
+
+                if (solid && fourColor) {
+                    // Single colour: endpoints whose 1/3 interpolant matches each channel best
+                    const auto& tables = GetSingleColorTables();
+                    const int r = pixels.rgba[0][0], g = pixels.rgba[0][1], b = pixels.rgba[0][2];
+                    best.c0 = static_cast<uint16_t>((tables.match5[r][0] << 11) | (tables.match6[g][0] << 5) | tables.match5[b][0]);
+                    best.c1 = static_cast<uint16_t>((tables.match5[r][1] << 11) | (tables.match6[g][1] << 5) | tables.match5[b][1]);
+                    std::fill(best.indices, best.indices + count, static_cast<uint8_t>(best.c0 == best.c1 ? 0 : 2));
+                    best.error = 0;
+                } else {
+                    float a[4], b[4];
+                    RangeFit(points, count, 3, fourColor ? 1.0f / 16.0f : 0.0f, a, b);
+                    EvaluateColor(pixels, count, a, b, fourColor, best);
+
+                    if (quality == CompressionQuality::Normal) {
+                        RefineColor(points, pixels, count, fourColor, 1, best);
+                    } else if (quality == CompressionQuality::High || quality == CompressionQuality::Ultra) {
+                        RefineColor(points, pixels, count, fourColor, 2, best);
+
+                        if (fourColor && count > 2) {
+                            float mean[4], axis[4];
+                            PrincipalAxis(points, count, 3, mean, axis);
+                            const int passes = quality == CompressionQuality::Ultra ? 3 : 1;
+                            for (int pass = 0; pass < passes; ++pass) {
+                                float clusterA[4] = {}, clusterB[4] = {};
+                                if (!ClusterFit(points, count, axis, clusterA, clusterB)) {
+                                    break;
+                                }
+                                const uint32_t previous = best.error;
+                                EvaluateColor(pixels, count, clusterA, clusterB, fourColor, best);
+
+                                // Re-sort along the fitted line for the next pass
+                                float length = 0.0f;
+                                for (int c = 0; c < 3; ++c) {
+                                    axis[c] = clusterB[c] - clusterA[c];
+                                    length += axis[c] * axis[c];
+                                }
+                                if (best.error >= previous || length <= 1e-6f) {
+                                    break;
+                                }
+                                length = std::sqrt(length);
+                                for (int c = 0; c < 3; ++c) {
+                                    axis[c] /= length;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Endpoint order selects the mode: c0 > c1 decodes four colours, c0 <= c1 three
+            uint16_t c0 = best.c0, c1 = best.c1;
+            uint8_t indices[16];
+            std::fill(indices, indices + 16, static_cast<uint8_t>(3));
+            const bool swap = fourColor ? c0 < c1 : c0 > c1;
+            for (int i = 0; i < count; ++i) {
+                uint8_t index = best.indices[i];
+                if (swap && (fourColor || index < 2)) {
+                    index = static_cast<uint8_t>(index ^ 1);
+                }
+                indices[pixelIndex[i]] = index;
+            }
+            if (swap) {
+                std::swap(c0, c1);
+            }
+            if (fourColor && c0 == c1) {
+                // Equal endpoints decode in three-colour mode, where only index 0..2 are the colour
+                for (int i = 0; i < 16; ++i) {
+                    indices[i] = 0;
+                }
+            }
+
+            block[0] = static_cast<uint8_t>(c0 & 0xFF);
+            block[1] = static_cast<uint8_t>(c0 >> 8);
+            block[2] = static_cast<uint8_t>(c1 & 0xFF);
+            block[3] = static_cast<uint8_t>(c1 >> 8);
+            for (int row = 0; row < 4; ++row) {
+                block[4 + row] = static_cast<uint8_t>(indices[row * 4] | (indices[row * 4 + 1] << 2) |
+                                                      (indices[row * 4 + 2] << 4) | (indices[row * 4 + 3] << 6));
+            }
+        }
+
+        void DecodeColorBlock(const uint8_t block[8], bool fourColorOnly, uint8_t rgba[64]) {
+            const uint16_t c0 = static_cast<uint16_t>(block[0] | (block[1] << 8));
+            const uint16_t c1 = static_cast<uint16_t>(block[2] | (block[3] << 8));
+            int palette[4][4];
+            BuildBC1Palette(c0, c1, fourColorOnly || c0 > c1, palette);
+
+            for (int i = 0; i < 16; ++i) {
+                const int index = (block[4 + i / 4] >> ((i % 4) * 2)) & 3;
+                for (int c = 0; c < 4; ++c) {
+                    rgba[i * 4 + c] = static_cast<uint8_t>(palette[index][c]);
+                }
+            }
+        }
+
+        // ------------------------------------------------------------------ BC4 channel
+
+        int BuildBC4Palette(int e0, int e1, int palette[8]) {
+            palette[0] = e0;
+            palette[1] = e1;
+            if (e0 > e1) {
+                for (int i = 1; i < 7; ++i) {
+                    palette[i + 1] = ((7 - i) * e0 + i * e1 + 3) / 7;
+                }
+            } else {
+                for (int i = 1; i < 5; ++i) {
+                    palette[i + 1] = ((5 - i) * e0 + i * e1 + 2) / 5;
+                }
+                palette[6] = 0;
+                palette[7] = 255;
+            }
+            return 8;
+        }
+
+        struct ChannelCandidate {
+            int e0 = 0;
+            int e1 = 0;
+            uint8_t indices[16] = {};
+            uint32_t error = std::numeric_limits<uint32_t>::max();
+        };
+
+        void EvaluateChannel(const BlockPixels& pixels, int e0, int e1, ChannelCandidate& best) {
+            int decoded[8];
+            BuildBC4Palette(e0, e1, decoded);
+            BlockPixels palette = {};
+            for (int p = 0; p < 8; ++p) {
+                palette.rgba[p][0] = static_cast<int16_t>(decoded[p]);
+            }
+
+            ChannelCandidate candidate;
+            candidate.e0 = e0;
+            candidate.e1 = e1;
+            candidate.error = FindClosest(pixels, 16, palette, 8, candidate.indices);
+            if (candidate.error < best.error) {
+                best = candidate;
+            }
+        }
+
+        void EncodeChannelBlock(const uint8_t values[16], CompressionQuality quality, uint8_t block[8]) {
+            BlockPixels pixels = {};
+            int minValue = 255, maxValue = 0;
+            int innerMin = 255, innerMax = 0;
+            for (int i = 0; i < 16; ++i) {
+                pixels.rgba[i][0] = values[i];
+                minValue = std::min<int>(minValue, values[i]);
+                maxValue = std::max<int>(maxValue, values[i]);
+                if (values[i] != 0 && values[i] != 255) {
+                    innerMin = std::min<int>(innerMin, values[i]);
+                    innerMax = std::max<int>(innerMax, values[i]);
+                }
+            }
+
+            ChannelCandidate best;
+            if (minValue == maxValue) {
+                EvaluateChannel(pixels, minValue, minValue, best);
+            } else {
+                // Eight interpolated values between the extremes
+                EvaluateChannel(pixels, maxValue, minValue, best);
+
+                if (quality != CompressionQuality::Fast) {
+                    // Six values between the inner extremes, with exact 0 and 255 on the side
+                    if (innerMin <= innerMax) {
+                        EvaluateChannel(pixels, innerMin, innerMax, best);
+                    }
+
+                    if (quality != CompressionQuality::Normal) {
+                        const int radius = quality == CompressionQuality::Ultra ? 4 : 2;
+                        const int centre0 = best.e0, centre1 = best.e1;
+                        const bool eightValues = centre0 > centre1;
+                        for (int d0 = -radius; d0 <= radius; ++d0) {
+                            for (int d1 = -radius; d1 <= radius; ++d1) {
+                                const int e0 = std::clamp(centre0 + d0, 0, 255);
+                                const int e1 = std::clamp(centre1 + d1, 0, 255);
+                                if ((e0 > e1) == eightValues) {
+                                    EvaluateChannel(pixels, e0, e1, best);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            block[0] = static_cast<uint8_t>(best.e0);
+            block[1] = static_cast<uint8_t>(best.e1);
+            uint64_t bits = 0;
+            for (int i = 0; i < 16; ++i) {
+                bits |= static_cast<uint64_t>(best.indices[i]) << (i * 3);
+            }
+            for (int i = 0; i < 6; ++i) {
+                block[2 + i] = static_cast<uint8_t>(bits >> (i * 8));
+            }
+        }
+
+        void DecodeChannelBlock(const uint8_t block[8], uint8_t values[16]) {
+            int palette[8];
+            BuildBC4Palette(block[0], block[1], palette);
+            uint64_t bits = 0;
+            for (int i = 0; i < 6; ++i) {
+                bits |= static_cast<uint64_t>(block[2 + i]) << (i * 8);
+            }
+            for (int i = 0; i < 16; ++i) {
+                values[i] = static_cast<uint8_t>(palette[(bits >> (i * 3)) & 7]);
+            }
+        }
+
+        // ------------------------------------------------------------------ BC7
+
+        class BitWriter {
+        public:
+            explicit BitWriter(uint8_t* data) : m_data(data) { std::memset(m_data, 0, 16); }
+
+            void Write(uint32_t value, int count) {
+                for (int i = 0; i < count; ++i, ++m_bit) {
+                    if ((value >> i) & 1u) {
+                        m_data[m_bit >> 3] |= static_cast<uint8_t>(1u << (m_bit & 7));
+                    }
+                }
+            }
+
+        private:
+            uint8_t* m_data;
+            int m_bit = 0;
+        };
+
+        class BitReader {
+        public:
+            explicit BitReader(const uint8_t* data) : m_data(data) {}
+
+            uint32_t Read(int count) {
+                uint32_t value = 0;
+                for (int i = 0; i < count; ++i, ++m_bit) {
+                    value |= static_cast<uint32_t>((m_data[m_bit >> 3] >> (m_bit & 7)) & 1u) << i;
+                }
+                return value;
+            }
+
+        private:
+            const uint8_t* m_data;
+            int m_bit = 0;
+        };
+
+        int Interpolate(int e0, int e1, int weight) {
+            return ((64 - weight) * e0 + weight * e1 + 32) >> 6;
+        }
+
+        // Mode 1 endpoint: 6 bits plus the subset's shared p-bit, expanded to 8 bits
+        int ExpandMode1(int value, int pBit) {
+            const int v7 = (value << 1) | pBit;
+            return (v7 << 1) | (v7 >> 6);
+        }
+
+        struct Mode6Candidate {
+            int q[2][4] = {};
+            int p[2] = {};
+            uint8_t indices[16] = {};
+            uint32_t error = std::numeric_limits<uint32_t>::max();
+        };
+
+        // Tries the four p-bit combinations for the float endpoints
+        void EvaluateMode6(const BlockPixels& pixels, const float a[4], const float b[4], Mode6Candidate& best) {
+            for (int p0 = 0; p0 < 2; ++p0) {
+                for (int p1 = 0; p1 < 2; ++p1) {
+                    Mode6Candidate candidate;
+                    candidate.p[0] = p0;
+                    candidate.p[1] = p1;
+                    int e0[4], e1[4];
+                    for (int c = 0; c < 4; ++c) {
+                        candidate.q[0][c] = std::clamp(static_cast<int>(std::lround((a[c] - p0) * 0.5f)), 0, 127);
+                        candidate.q[1][c] = std::clamp(static_cast<int>(std::lround((b[c] - p1) * 0.5f)), 0, 127);
+                        e0[c] = (candidate.q[0][c] << 1) | p0;
+                        e1[c] = (candidate.q[1][c] << 1) | p1;
+                    }
+
+                    BlockPixels palette;
+                    for (int w = 0; w < 16; ++w) {
+                        for (int c = 0; c < 4; ++c) {
+                            palette.rgba[w][c] = static_cast<int16_t>(Interpolate(e0[c], e1[c], BC7_WEIGHTS4[w]));
+                        }
+                    }
+                    candidate.error = FindClosest(pixels, 16, palette, 16, candidate.indices);
+                    if (candidate.error < best.error) {
+                        best = candidate;
+                    }
+                }
+            }
+        }
+
+        uint32_t EncodeMode6(const BlockPixels& pixels, const float (*points)[4], int refinements, uint8_t block[16]) {
+            float a[4], b[4];
+            RangeFit(points, 16, 4, 0.0f, a, b);
+            Mode6Candidate best;
+            EvaluateMode6(pixels, a, b, best);
+
+            for (int iteration = 0; iteration < refinements; ++iteration) {
+                float weights[16];
+                for (int i = 0; i < 16; ++i) {
+                    weights[i] = BC7_WEIGHTS4[best.indices[i]] / 64.0f;
+                }
+                if (!LeastSquaresFit(points, weights, 16, 4, a, b)) {
+                    break;
+                }
+                const uint32_t previous = best.error;
+                EvaluateMode6(pixels, a, b, best);
+                if (best.error >= previous) {
+                    break;
+                }
+            }
+
+            // The anchor (pixel 0) index has an implicit zero top bit
+            if (best.indices[0] & 8) {
+                for (int c = 0; c < 4; ++c) {
+                    std::swap(best.q[0][c], best.q[1][c]);
+                }
+                std::swap(best.p[0], best.p[1]);
+                for (int i = 0; i < 16; ++i) {
+                    best.indices[i] = static_cast<uint8_t>(15 - best.indices[i]);
+                }
+            }
+
+            BitWriter writer(block);
+            writer.Write(1u << 6, 7);
+            for (int c = 0; c < 4; ++c) {
+                writer.Write(static_cast<uint32_t>(best.q[0][c]), 7);
+                writer.Write(static_cast<uint32_t>(best.q[1][c]), 7);
+            }
+            writer.Write(static_cast<uint32_t>(best.p[0]), 1);
+            writer.Write(static_cast<uint32_t>(best.p[1]), 1);
+            for (int i = 0; i < 16; ++i) {
+                writer.Write(best.indices[i], i == 0 ? 3 : 4);
+            }
+            return best.error;
+        }
+
+        struct Mode1Subset {
+            int q[2][3] = {};
+            int p = 0;
+            uint8_t indices[16] = {};
+            uint32_t error = std::numeric_limits<uint32_t>::max();
+        };
+
+        void EvaluateMode1Subset(const BlockPixels& pixels, int count, const float a[4], const float b[4], Mode1Subset& best) {
+            for (int p = 0; p < 2; ++p) {
+                Mode1Subset candidate;
+                candidate.p = p;
+                int e0[3], e1[3];
+                for (int c = 0; c < 3; ++c) {
+                    // 8-bit value v is roughly 4q + 2p
+                    candidate.q[0][c] = std::clamp(static_cast<int>(std::lround((a[c] - 2.0f * p) * 0.25f)), 0, 63);
+                    candidate.q[1][c] = std::clamp(static_cast<int>(std::lround((b[c] - 2.0f * p) * 0.25f)), 0, 63);
+                    e0[c] = ExpandMode1(candidate.q[0][c], p);
+                    e1[c] = ExpandMode1(candidate.q[1][c], p);
+                }
+
+                BlockPixels palette = {};
+                for (int w = 0; w < 8; ++w) {
+                    for (int c = 0; c < 3; ++c) {
+                        palette.rgba[w][c] = static_cast<int16_t>(Interpolate(e0[c], e1[c], BC7_WEIGHTS3[w]));
+                    }
+                    palette.rgba[w][3] = 255;
+                }
+                candidate.error = FindClosest(pixels, count, palette, 8, candidate.indices);
+                if (candidate.error < best.error) {
+                    best = candidate;
+                }
+            }
+        }
+
+        // Count, sums and second moments (xx, yy, zz, xy, xz, yz) of a set of RGB points
+        struct Moments {
+            float count = 0.0f;
+            float sum[3] = {};
+            float products[6] = {};
+
+            void Add(const float point[4]) {
+                count += 1.0f;
+                for (int c = 0; c < 3; ++c) {
+                    sum[c] += point[c];
+                }
+                products[0] += point[0] * point[0];
+                products[1] += point[1] * point[1];
+                products[2] += point[2] * point[2];
+                products[3] += point[0] * point[1];
+                products[4] += point[0] * point[2];
+                products[5] += point[1] * point[2];
+            }
+
+            void Add(const Moments& other, float sign) {
+                count += sign * other.count;
+                for (int c = 0; c < 3; ++c) {
+                    sum[c] += sign * other.sum[c];
+                }
+                for (int c = 0; c < 6; ++c) {
+                    products[c] += sign * other.products[c];
+                }
+            }
+        };
+
+        // Squared distance of the points from their best-fit line: the scatter matrix trace minus
+        // its largest eigenvalue, estimated by the Rayleigh quotient after two power iterations
+        float LineResidual(const Moments& moments) {
+            if (moments.count < 2.0f) {
+                return 0.0f;
+            }
+            const float* s = moments.sum;
+            const float inverse = 1.0f / moments.count;
+            const float xx = moments.products[0] - s[0] * s[0] * inverse;
+            const float yy = moments.products[1] - s[1] * s[1] * inverse;
+            const float zz = moments.products[2] - s[2] * s[2] * inverse;
+            const float xy = moments.products[3] - s[0] * s[1] * inverse;
+            const float xz = moments.products[4] - s[0] * s[2] * inverse;
+            const float yz = moments.products[5] - s[1] * s[2] * inverse;
+            const float trace = xx + yy + zz;
+
+            // Start from the column of the largest diagonal entry
+            float v[3];
+            if (xx >= yy && xx >= zz) {
+                v[0] = xx; v[1] = xy; v[2] = xz;
+            } else if (yy >= zz) {
+                v[0] = xy; v[1] = yy; v[2] = yz;
+            } else {
+                v[0] = xz; v[1] = yz; v[2] = zz;
+            }
+            for (int iteration = 0; iteration < 2; ++iteration) {
+                const float next[3] = {
+                    xx * v[0] + xy * v[1] + xz * v[2],
+                    xy * v[0] + yy * v[1] + yz * v[2],
+                    xz * v[0] + yz * v[1] + zz * v[2]
+                };
+                const float largest = std::max({std::abs(next[0]), std::abs(next[1]), std::abs(next[2])});
+                if (largest <= 1e-6f) {
+                    return 0.0f;
+                }
+                for (int c = 0; c < 3; ++c) {
+                    v[c] = next[c] / largest;
+                }
+            }
+
+            const float cv[3] = {
+                xx * v[0] + xy * v[1] + xz * v[2],
+                xy * v[0] + yy * v[1] + yz * v[2],
+                xz * v[0] + yz * v[1] + zz * v[2]
+            };
+            const float eigenvalue = (v[0] * cv[0] + v[1] * cv[1] + v[2] * cv[2]) / (v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+            return std::max(trace - eigenvalue, 0.0f);
+        }
+
+        float ScorePartition(const Moments pixelMoments[16], const Moments& total, uint16_t partition) {
+            Moments second;
+            for (int i = 0; i < 16; ++i) {
+                if ((partition >> i) & 1) {
+                    second.Add(pixelMoments[i], 1.0f);
+                }
+            }
+            Moments first = total;
+            first.Add(second, -1.0f);
+            return LineResidual(first) + LineResidual(second);
+        }
+
+        uint32_t EncodeMode1(const BlockPixels& pixels, const float (*points)[4], int partitionIndex, int refinements, uint8_t block[16]) {
+            const uint16_t partition = BC7_PARTITIONS2[partitionIndex];
+            Mode1Subset subsets[2];
+            uint8_t indices[16] = {};
+
+            for (int subset = 0; subset < 2; ++subset) {
+                BlockPixels subsetPixels = {};
+                float subsetPoints[16][4];
+                int members[16];
+                int count = 0;
+                for (int i = 0; i < 16; ++i) {
+                    if (((partition >> i) & 1) == subset) {
+                        std::memcpy(subsetPixels.rgba[count], pixels.rgba[i], sizeof(subsetPixels.rgba[0]));
+                        std::memcpy(subsetPoints[count], points[i], sizeof(subsetPoints[0]));
+                        members[count++] = i;
+                    }
+                }
+
+                float a[4], b[4];
+                RangeFit(subsetPoints, count, 3, 0.0f, a, b);
+                Mode1Subset& best = subsets[subset];
+                EvaluateMode1Subset(subsetPixels, count, a, b, best);
+
+                for (int iteration = 0; iteration < refinements; ++iteration) {
+                    float weights[16];
+                    for (int i = 0; i < count; ++i) {
+                        weights[i] = BC7_WEIGHTS3[best.indices[i]] / 64.0f;
+                    }
+                    if (!LeastSquaresFit(subsetPoints, weights, count, 3, a, b)) {
+                        break;
+                    }
+                    const uint32_t previous = best.error;
+                    EvaluateMode1Subset(subsetPixels, count, a, b, best);
+                    if (best.error >= previous) {
+                        break;
+                    }
+                }
+
+                // Anchor indices have an implicit zero top bit
+                const int anchor = subset == 0 ? 0 : BC7_ANCHORS2[partitionIndex];
+                const int anchorSlot = static_cast<int>(std::find(members, members + count, anchor) - members);
+                if (best.indices[anchorSlot] & 4) {
+                    for (int c = 0; c < 3; ++c) {
+                        std::swap(best.q[0][c], best.q[1][c]);
+                    }
+                    for (int i = 0; i < count; ++i) {
+                        best.indices[i] = static_cast<uint8_t>(7 - best.indices[i]);
+                    }
+                }
+                for (int i = 0; i < count; ++i) {
+                    indices[members[i]] = best.indices[i];
+                }
+            }
+
+            BitWriter writer(block);
+            writer.Write(1u << 1, 2);
+            writer.Write(static_cast<uint32_t>(partitionIndex), 6);
+            for (int c = 0; c < 3; ++c) {
+                for (int subset = 0; subset < 2; ++subset) {
+                    writer.Write(static_cast<uint32_t>(subsets[subset].q[0][c]), 6);
+                    writer.Write(static_cast<uint32_t>(subsets[subset].q[1][c]), 6);
+                }
+            }
+            writer.Write(static_cast<uint32_t>(subsets[0].p), 1);
+            writer.Write(static_cast<uint32_t>(subsets[1].p), 1);
+            const int anchor = BC7_ANCHORS2[partitionIndex];
+            for (int i = 0; i < 16; ++i) {
+                writer.Write(indices[i], i == 0 || i == anchor ? 2 : 3);
+            }
+            return subsets[0].error + subsets[1].error;
+        }
+
+        void EncodeBC7Block(const uint8_t rgba[64], CompressionQuality quality, uint8_t block[16]) {
+            BlockPixels pixels;
+            float points[16][4];
+            bool opaque = true;
+            for (int i = 0; i < 16; ++i) {
+                for (int c = 0; c < 4; ++c) {
+                    pixels.rgba[i][c] = rgba[i * 4 + c];
+                    points[i][c] = rgba[i * 4 + c];
+                }
+                opaque = opaque && rgba[i * 4 + 3] == 255;
+            }
+
+            int refinements = 0;
+            int partitionsToTry = 0;
+            switch (quality) {
+                case CompressionQuality::Fast: refinements = 0; partitionsToTry = 0; break;
+                case CompressionQuality::Normal: refinements = 1; partitionsToTry = 4; break;
+                case CompressionQuality::High: refinements = 2; partitionsToTry = 16; break;
+                case CompressionQuality::Ultra: refinements = 2; partitionsToTry = 64; break;
+            }
+
+            uint32_t bestError = EncodeMode6(pixels, points, refinements, block);
+            if (!opaque || partitionsToTry == 0 || bestError == 0) {
+                return;
+            }
+
+            // Mode 1 on the partitions whose subsets lie closest to a line each
+            Moments pixelMoments[16], total;
+            for (int i = 0; i < 16; ++i) {
+                pixelMoments[i].Add(points[i]);
+                total.Add(pixelMoments[i], 1.0f);
+            }
+            std::pair<float, int> scores[64];
+            for (int p = 0; p < 64; ++p) {
+                scores[p] = {ScorePartition(pixelMoments, total, BC7_PARTITIONS2[p]), p};
+            }
+            std::partial_sort(scores, scores + partitionsToTry, scores + 64);
+
+            uint8_t candidate[16];
+            for (int i = 0; i < partitionsToTry; ++i) {
+                const uint32_t error = EncodeMode1(pixels, points, scores[i].second, refinements, candidate);
+                if (error < bestError) {
+                    bestError = error;
+                    std::memcpy(block, candidate, 16);
+                }
+            }
+        }
+
+        bool DecodeBC7Block(const uint8_t block[16], uint8_t rgba[64]) {
+            BitReader reader(block);
+            if (block[0] & 1u) {
+                return false;
+            }
+
+            if (block[0] & 2u) {
+                // Mode 1
+                reader.Read(2);
+                const int partitionIndex = static_cast<int>(reader.Read(6));
+                int q[2][2][3];
+                for (int c = 0; c < 3; ++c) {
+                    for (int subset = 0; subset < 2; ++subset) {
+                        q[subset][0][c] = static_cast<int>(reader.Read(6));
+                        q[subset][1][c] = static_cast<int>(reader.Read(6));
+                    }
+                }
+                const int p[2] = {static_cast<int>(reader.Read(1)), static_cast<int>(reader.Read(1))};
+                const int anchor = BC7_ANCHORS2[partitionIndex];
+                for (int i = 0; i < 16; ++i) {
+                    const int index = static_cast<int>(reader.Read(i == 0 || i == anchor ? 2 : 3));
+                    const int subset = (BC7_PARTITIONS2[partitionIndex] >> i) & 1;
+                    for (int c = 0; c < 3; ++c) {
+                        rgba[i * 4 + c] = static_cast<uint8_t>(Interpolate(ExpandMode1(q[subset][0][c], p[subset]),
+                                                                           ExpandMode1(q[subset][1][c], p[subset]),
+                                                                           BC7_WEIGHTS3[index]));
+                    }
+                    rgba[i * 4 + 3] = 255;
+                }
+                return true;
+            }
+
+            // Mode 6: six zero bits, then the mode bit
+            if ((block[0] & 0x7F) != 0x40) {
+                return false;
+            }
+            reader.Read(7);
+            int q[2][4];
+            for (int c = 0; c < 4; ++c) {
+                q[0][c] = static_cast<int>(reader.Read(7));
+                q[1][c] = static_cast<int>(reader.Read(7));
+            }
+            const int p0 = static_cast<int>(reader.Read(1));
+            const int p1 = static_cast<int>(reader.Read(1));
+            for (int i = 0; i < 16; ++i) {
+                const int index = static_cast<int>(reader.Read(i == 0 ? 3 : 4));
+                for (int c = 0; c < 4; ++c) {
+                    rgba[i * 4 + c] = static_cast<uint8_t>(Interpolate((q[0][c] << 1) | p0, (q[1][c] << 1) | p1, BC7_WEIGHTS4[index]));
+                }
+            }
+            return true;
+        }
+
+        // ------------------------------------------------------------------ image access
+
+        // 4x4 block as RGBA8, clamping to the last row and column on partial blocks
+        void FetchBlock(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels,
+                        uint32_t blockX, uint32_t blockY, uint8_t rgba[64]) {
+            for (uint32_t y = 0; y < 4; ++y) {
+                const uint32_t sy = std::min(blockY * 4 + y, height - 1);
+                for (uint32_t x = 0; x < 4; ++x) {
+                    const uint32_t sx = std::min(blockX * 4 + x, width - 1);
+                    const uint8_t* source = pixels + (static_cast<size_t>(sy) * width + sx) * channels;
+                    uint8_t* out = rgba + (y * 4 + x) * 4;
+                    switch (channels) {
+                        case 1: out[0] = out[1] = out[2] = source[0]; out[3] = 255; break;
+                        case 2: out[0] = out[1] = out[2] = source[0]; out[3] = source[1]; break;
+                        case 3: out[0] = source[0]; out[1] = source[1]; out[2] = source[2]; out[3] = 255; break;
+                        default: std::memcpy(out, source, 4); break;
+                    }
+                }
+            }
+        }
+
+        // First two source channels as they are, for BC4/BC5; single-channel input fills both
+        void FetchChannels(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels,
+                           uint32_t blockX, uint32_t blockY, uint8_t red[16], uint8_t green[16]) {
+            for (uint32_t y = 0; y < 4; ++y) {
+                const uint32_t sy = std::min(blockY * 4 + y, height - 1);
+                for (uint32_t x = 0; x < 4; ++x) {
+                    const uint32_t sx = std::min(blockX * 4 + x, width - 1);
+                    const uint8_t* source = pixels + (static_cast<size_t>(sy) * width + sx) * channels;
+                    red[y * 4 + x] = source[0];
+                    green[y * 4 + x] = source[channels > 1 ? 1 : 0];
+                }
+            }
+        }
+    }
+
+    size_t BlockCompression::GetBlockSize(CompressionFormat format) {
+        switch (format) {
+            case CompressionFormat::DXT1:
+            case CompressionFormat::BC4:
+                return 8;
+            case CompressionFormat::DXT3:
+            case CompressionFormat::DXT5:
+            case CompressionFormat::BC5:
+            case CompressionFormat::BC7:
+                return 16;
+            default:
+                return 0;
+        }
+    }
+
+    size_t BlockCompression::GetCompressedSize(uint32_t width, uint32_t height, CompressionFormat format) {
+        const size_t blocksX = (static_cast<size_t>(width) + 3) / 4;
+        const size_t blocksY = (static_cast<size_t>(height) + 3) / 4;
+        return blocksX * blocksY * GetBlockSize(format);
+    }
+
+    bool BlockCompression::CompressImage(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels,
+                                         CompressionFormat format, CompressionQuality quality,
+                                         std::vector<uint8_t>& output, size_t maxThreads, JobSystem* jobSystem) {
+        const size_t blockSize = GetBlockSize(format);
+        if (!pixels || width == 0 || height == 0 || channels == 0 || channels > 4 || blockSize == 0) {
+            return false;
+        }
+
+        const uint32_t blocksX = (width + 3) / 4;
+        const uint32_t blocksY = (height + 3) / 4;
+        output.resize(static_cast<size_t>(blocksX) * blocksY * blockSize);
+        const bool punchThrough = channels == 2 || channels == 4;
+
+        ParallelImportFor(blocksY, [&](size_t row) {
+            const uint32_t blockY = static_cast<uint32_t>(row);
+            uint8_t* out = output.data() + static_cast<size_t>(blockY) * blocksX * blockSize;
+            uint8_t rgba[64];
+            uint8_t red[16], green[16];
+
+            for (uint32_t blockX = 0; blockX < blocksX; ++blockX, out += blockSize) {
+                switch (format) {
+                    case CompressionFormat::DXT1:
+                        FetchBlock(pixels, width, height, channels, blockX, blockY, rgba);
+                        EncodeBC1(rgba, out, quality, punchThrough);
+                        break;
+                    case CompressionFormat::DXT3:
+                        FetchBlock(pixels, width, height, channels, blockX, blockY, rgba);
+                        EncodeBC2(rgba, out, quality);
+                        break;
+                    case CompressionFormat::DXT5:
+                        FetchBlock(pixels, width, height, channels, blockX, blockY, rgba);
+                        EncodeBC3(rgba, out, quality);
+                        break;
+                    case CompressionFormat::BC4:
+                        FetchChannels(pixels, width, height, channels, blockX, blockY, red, green);
+                        EncodeBC4(red, out, quality);
+                        break;
+                    case CompressionFormat::BC5:
+                        FetchChannels(pixels, width, height, channels, blockX, blockY, red, green);
+                        EncodeBC5(red, green, out, quality);
+                        break;
+                    case CompressionFormat::BC7:
+                        FetchBlock(pixels, width, height, channels, blockX, blockY, rgba);
+                        EncodeBC7(rgba, out, quality);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }, jobSystem, maxThreads);
+
+        return true;
+    }
+
+    bool BlockCompression::DecompressImage(const uint8_t* blocks, uint32_t width, uint32_t height,
+                                           CompressionFormat format, std::vector<uint8_t>& output) {
+        const size_t blockSize = GetBlockSize(format);
+        if (!blocks || width == 0 || height == 0 || blockSize == 0) {
+            return false;
+        }
+
+        const uint32_t blocksX = (width + 3) / 4;
+        const uint32_t blocksY = (height + 3) / 4;
+        output.assign(static_cast<size_t>(width) * height * 4, 0);
+
+        uint8_t rgba[64];
+        uint8_t red[16], green[16];
+        for (uint32_t blockY = 0; blockY < blocksY; ++blockY) {
+            for (uint32_t blockX = 0; blockX < blocksX; ++blockX) {
+                const uint8_t* block = blocks + (static_cast<size_t>(blockY) * blocksX + blockX) * blockSize;
+                switch (format) {
+                    case CompressionFormat::DXT1: DecodeBC1(block, rgba); break;
+                    case CompressionFormat::DXT3: DecodeBC2(block, rgba); break;
+                    case CompressionFormat::DXT5: DecodeBC3(block, rgba); break;
+                    case CompressionFormat::BC4:
+                        DecodeBC4(block, red);
+                        for (int i = 0; i < 16; ++i) {
+                            rgba[i * 4] = red[i];
+                            rgba[i * 4 + 1] = 0;
+                            rgba[i * 4 + 2] = 0;
+                            rgba[i * 4 + 3] = 255;
+                        }
+                        break;
+                    case CompressionFormat::BC5:
+                        DecodeBC5(block, red, green);
+                        for (int i = 0; i < 16; ++i) {
+                            rgba[i * 4] = red[i];
+                            rgba[i * 4 + 1] = green[i];
+                            rgba[i * 4 + 2] = 0;
+                            rgba[i * 4 + 3] = 255;
+                        }
+                        break;
+                    case CompressionFormat::BC7:
+                        if (!DecodeBC7(block, rgba)) {
+                            return false;
+                        }
+                        break;
+                    default:
+                        return false;
+                }
+
+                for (uint32_t y = 0; y < 4 && blockY * 4 + y < height; ++y) {
+                    const uint32_t pixelCount = std::min(4u, width - blockX * 4);
+                    std::memcpy(output.data() + ((static_cast<size_t>(blockY) * 4 + y) * width + blockX * 4) * 4,
+                                rgba + y * 16, pixelCount * 4);
+                }
+            }
+        }
+        return true;
+    }
+
+    void BlockCompression::EncodeBC1(const uint8_t rgba[64], uint8_t block[8], CompressionQuality quality, bool punchThroughAlpha) {
+        bool transparent[16] = {};
+        for (int i = 0; i < 16; ++i) {
+            transparent[i] = punchThroughAlpha && rgba[i * 4 + 3] < 128;
+        }
+        EncodeColorBlock(rgba, transparent, false, quality, block);
+    }
+
+    void BlockCompression::EncodeBC2(const uint8_t rgba[64], uint8_t block[16], CompressionQuality quality) {
+        // Explicit 4-bit alpha, pixel 0 in the low nibble
+        for (int i = 0; i < 8; ++i) {
+            const int a0 = (rgba[(i * 2) * 4 + 3] * 15 + 127) / 255;
+            const int a1 = (rgba[(i * 2 + 1) * 4 + 3] * 15 + 127) / 255;
+            block[i] = static_cast<uint8_t>(a0 | (a1 << 4));
+        }
+        EncodeColorBlock(rgba, nullptr, true, quality, block + 8);
+    }
+
+    void BlockCompression::EncodeBC3(const uint8_t rgba[64], uint8_t block[16], CompressionQuality quality) {
+        uint8_t alpha[16];
+        for (int i = 0; i < 16; ++i) {
+            alpha[i] = rgba[i * 4 + 3];
+        }
+        EncodeChannelBlock(alpha, quality, block);
+        EncodeColorBlock(rgba, nullptr, true, quality, block + 8);
+    }
+
+    void BlockCompression::EncodeBC4(const uint8_t values[16], uint8_t block[8], CompressionQuality quality) {
+        EncodeChannelBlock(values, quality, block);
+    }
+
+    void BlockCompression::EncodeBC5(const uint8_t red[16], const uint8_t green[16], uint8_t block[16], CompressionQuality quality) {
+        EncodeChannelBlock(red, quality, block);
+        EncodeChannelBlock(green, quality, block + 8);
+    }
+
+    void BlockCompression::EncodeBC7(const uint8_t rgba[64], uint8_t block[16], CompressionQuality quality) {
+        EncodeBC7Block(rgba, quality, block);
+    }
+
+    void BlockCompression::DecodeBC1(const uint8_t block[8], uint8_t rgba[64]) {
+        DecodeColorBlock(block, false, rgba);
+    }
+
+    void BlockCompression::DecodeBC2(const uint8_t block[16], uint8_t rgba[64]) {
+        DecodeColorBlock(block + 8, true, rgba);
+        for (int i = 0; i < 16; ++i) {
+            rgba[i * 4 + 3] = static_cast<uint8_t>(((block[i / 2] >> ((i % 2) * 4)) & 15) * 17);
+        }
+    }
+
+    void BlockCompression::DecodeBC3(const uint8_t block[16], uint8_t rgba[64]) {
+        DecodeColorBlock(block + 8, true, rgba);
+        uint8_t alpha[16];
+        DecodeChannelBlock(block, alpha);
+        for (int i = 0; i < 16; ++i) {
+            rgba[i * 4 + 3] = alpha[i];
+        }
+    }
+
+    void BlockCompression::DecodeBC4(const uint8_t block[8], uint8_t values[16]) {
+        DecodeChannelBlock(block, values);
+    }
+
+    void BlockCompression::DecodeBC5(const uint8_t block[16], uint8_t red[16], uint8_t green[16]) {
+        DecodeChannelBlock(block, red);
+        DecodeChannelBlock(block + 8, green);
+    }
+
+    bool BlockCompression::DecodeBC7(const uint8_t block[16], uint8_t rgba[64]) {
+        return DecodeBC7Block(block, rgba);
+    }
+
+    bool BlockCompression::IsSimdAvailable() {
+#ifdef GAMEENGINE_BLOCK_SSE2
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool BlockCompression::IsSimdEnabled() {
+        return IsSimdAvailable() && s_simdEnabled.load(std::memory_order_relaxed);
+    }
+
+    void BlockCompression::SetSimdEnabled(bool enabled) {
+        s_simdEnabled.store(enabled, std::memory_order_relaxed);
+    }
+}
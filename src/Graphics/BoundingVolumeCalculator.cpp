@@ -285,9 +285,10 @@ namespace GameEngine {
         for (const auto& mesh : meshes) {
             if (!mesh) continue;
             
-            const auto& vertices = mesh->GetVertices();
-            for (const auto& vertex : vertices) {
-                positions.push_back(vertex.position);
+            // Positions decode one at a time, so packed meshes need no full copy
+            const uint32_t vertexCount = mesh->GetVertexCount();
+            for (uint32_t i = 0; i < vertexCount; ++i) {
+                positions.push_back(mesh->GetVertexPosition(i));
             }
         }
         
@@ -1,4 +1,5 @@
 #include "Graphics/Mesh.h"
+#include "Graphics/VertexPacking.h"
 #include "Resource/MeshLoader.h"
 #include "Core/Logger.h"
 #include "Core/OpenGLContext.h"
@@ -7,6 +8,7 @@
 #include <unordered_set>
 #include <cmath>
 #include <cfloat>
+#include <cstring>
 
 namespace GameEngine {
     // VertexLayout implementation
@@ -30,7 +32,8 @@ namespace GameEngine {
         stride = 0;
         for (auto& attr : attributes) {
             attr.offset = stride;
-            if (attr.enabled) {
+            // Packed buffers keep space for disabled attributes so the data stays decodable
+            if (attr.enabled || packed) {
                 uint32_t attributeSize = 0;
                 switch (attr.dataType) {
                     case GL_FLOAT:
@@ -42,6 +45,11 @@ namespace GameEngine {
                     case GL_UNSIGNED_INT:
                         attributeSize = attr.size * sizeof(unsigned int);
                         break;
+                    case GL_HALF_FLOAT:
+                    case GL_SHORT:
+                    case GL_UNSIGNED_SHORT:
+                        attributeSize = attr.size * sizeof(uint16_t);
+                        break;
                     case GL_BYTE:
                         attributeSize = attr.size * sizeof(char);
                         break;
@@ -74,6 +82,105 @@ namespace GameEngine {
         CalculateStride();
     }
     
+    void VertexLayout::AddAttribute(VertexAttribute type, VertexFormat format) {
+        // Positions stay full precision; bounds and picking read them without decoding
+        if (type == VertexAttribute::Position) {
+            format = VertexFormat::Float32;
+        }
+        
+        uint32_t size = GetComponentCount(type);
+        uint32_t dataType = GL_FLOAT;
+        bool normalized = false;
+        switch (format) {
+            case VertexFormat::Float32:
+                break;
+            case VertexFormat::Float16:
+                dataType = GL_HALF_FLOAT;
+                break;
+            case VertexFormat::Octahedral16:
+                size = 2;
+                dataType = GL_SHORT;
+                normalized = true;
+                break;
+            case VertexFormat::Unorm8:
+                dataType = GL_UNSIGNED_BYTE;
+                normalized = true;
+                break;
+            case VertexFormat::UInt8:
+                dataType = GL_UNSIGNED_BYTE;
+                break;
+        }
+        
+        packed = true;
+        AddAttribute(type, size, dataType, normalized);
+        for (auto& attr : attributes) {
+            if (attr.type == type) {
+                attr.format = format;
+            }
+        }
+    }
+    
+    const VertexLayout::Attribute* VertexLayout::FindAttribute(VertexAttribute type) const {
+        for (const auto& attr : attributes) {
+            if (attr.type == type) {
+                return &attr;
+            }
+        }
+        return nullptr;
+    }
+    
+    VertexLayout VertexLayout::CreatePacked(const std::vector<VertexAttribute>& attributeTypes, const VertexFormatOptions& options) {
+        VertexLayout layout;
+        layout.attributes.clear();
+        layout.packed = true;
+        layout.AddAttribute(VertexAttribute::Position, VertexFormat::Float32);
+        
+        for (VertexAttribute type : attributeTypes) {
+            VertexFormat format = VertexFormat::Float32;
+            switch (type) {
+                case VertexAttribute::Position:
+                    continue;
+                case VertexAttribute::Normal:
+                case VertexAttribute::Tangent:
+                case VertexAttribute::Bitangent:
+                    format = options.octahedralNormals ? VertexFormat::Octahedral16 : VertexFormat::Float32;
+                    break;
+                case VertexAttribute::TexCoords:
+                case VertexAttribute::TexCoords2:
+                case VertexAttribute::TexCoords3:
+                    format = options.halfFloatTexCoords ? VertexFormat::Float16 : VertexFormat::Float32;
+                    break;
+                case VertexAttribute::Color:
+                    format = options.unorm8Colors ? VertexFormat::Unorm8 : VertexFormat::Float32;
+                    break;
+                case VertexAttribute::BoneIds:
+                    format = options.compactSkinning ? VertexFormat::UInt8 : VertexFormat::Float32;
+                    break;
+                case VertexAttribute::BoneWeights:
+                    format = options.compactSkinning ? VertexFormat::Unorm8 : VertexFormat::Float32;
+                    break;
+            }
+            layout.AddAttribute(type, format);
+        }
+        
+        return layout;
+    }
+    
+    uint32_t VertexLayout::GetComponentCount(VertexAttribute type) {
+        switch (type) {
+            case VertexAttribute::TexCoords:
+            case VertexAttribute::TexCoords2:
+            case VertexAttribute::TexCoords3:
+                return 2;
+            case VertexAttribute::Color:
+            case VertexAttribute::BoneIds:
+            case VertexAttribute::BoneWeights:
+                return 4;
+            default:
+                return 3;
+        }
+    }
+    
     uint32_t VertexLayout::GetAttributeOffset(VertexAttribute type) const {
         for (const auto& attr : attributes) {
             if (attr.type == type) {
@@ -252,6 +359,7 @@ namespace GameEngine {
     }
 
     void Mesh::SetVertices(const std::vector<Vertex>& vertices) {
+        ClearPackedVertices();
         m_vertices = vertices;
         CalculateBounds();
         SetupMesh();
@@ -259,10 +367,60 @@ namespace GameEngine {
 
     void Mesh::SetIndices(const std::vector<uint32_t>& indices) {
         m_indices = indices;
+        m_meshlets.Clear();
+        SetupMesh();
+    }
+
+    void Mesh::SetVertices(std::vector<Vertex>&& vertices) {
+        ClearPackedVertices();
+        m_vertices = std::move(vertices);
+        CalculateBounds();
+        SetupMesh();
+    }
+
+    void Mesh::SetIndices(std::vector<uint32_t>&& indices) {
+        m_indices = std::move(indices);
+        m_meshlets.Clear();
+        SetupMesh();
+    }
+
+    void Mesh::SetVertices(const Vertex* vertices, size_t count) {
+        ClearPackedVertices();
+        m_vertices.assign(vertices, vertices + count);
+        CalculateBounds();
+        SetupMesh();
+    }
+
+    void Mesh::SetIndices(const uint32_t* indices, size_t count) {
+        m_indices.assign(indices, indices + count);
+        m_meshlets.Clear();
+        SetupMesh();
+    }
+
+    void Mesh::SetGeometry(std::vector<Vertex>&& vertices, std::vector<uint32_t>&& indices,
+                           const BoundingBox& boundingBox, const BoundingSphere& boundingSphere) {
+        ClearPackedVertices();
+        m_vertices = std::move(vertices);
+        m_indices = std::move(indices);
+        m_meshlets.Clear();
+        m_boundingBox = boundingBox;
+        m_boundingSphere = boundingSphere;
         SetupMesh();
     }
     
     void Mesh::SetVertexLayout(const VertexLayout& layout) {
+        if (layout.packed) {
+            // A packed layout describes the storage, so convert the vertices to it
+            PackVertices(layout);
+            return;
+        }
+        if (IsPacked()) {
+            UnpackVertices();
+        }
+        ApplyVertexLayout(layout);
+    }
+    
+    void Mesh::ApplyVertexLayout(const VertexLayout& layout) {
         m_layout = layout;
         // Force recreation of GPU resources with new layout
         if (m_gpuResourcesCreated) {
@@ -276,6 +434,98 @@ namespace GameEngine {
         }
     }
     
+    std::vector<Vertex> Mesh::DecodeVertices() const {
+        if (!IsPacked()) {
+            return m_vertices;
+        }
+        // Decode into the caller's copy; const access never touches the mesh, so it is safe across threads
+        std::vector<Vertex> vertices(m_packedVertexCount);
+        VertexPacking::Unpack(m_packedVertices.data(), m_packedVertexCount, m_layout, vertices.data());
+        return vertices;
+    }
+    
+    void Mesh::PackVertices(const VertexFormatOptions& options) {
+        if (IsPacked()) {
+            UnpackVertices();
+        }
+        PackVertices(VertexPacking::CreateLayout(m_vertices.data(), m_vertices.size(), options));
+    }
+    
+    void Mesh::PackVertices(const VertexLayout& layout) {
+        if (!layout.packed) {
+            Logger::GetInstance().Log(LogLevel::Warning, "PackVertices called with an unpacked layout for mesh: " + m_name);
+            return;
+        }
+        if (IsPacked()) {
+            UnpackVertices();
+        }
+        
+        std::vector<uint8_t> data(m_vertices.size() * layout.stride);
+        VertexPacking::Pack(m_vertices.data(), m_vertices.size(), layout, data.data());
+        SetPackedVertices(std::move(data), m_vertices.size(), layout);
+    }
+    
+    void Mesh::SetPackedVertices(const uint8_t* data, size_t vertexCount, const VertexLayout& layout) {
+        SetPackedVertices(std::vector<uint8_t>(data, data + vertexCount * layout.stride), vertexCount, layout);
+    }
+    
+    void Mesh::SetPackedVertices(std::vector<uint8_t>&& data, size_t vertexCount, const VertexLayout& layout) {
+        if (!layout.packed || data.size() != vertexCount * layout.stride) {
+            Logger::GetInstance().Log(LogLevel::Error, "Packed vertex data does not match its layout for mesh: " + m_name);
+            return;
+        }
+        
+        m_packedVertices = std::move(data);
+        m_packedVertexCount = static_cast<uint32_t>(vertexCount);
+        m_vertices.clear();
+        m_vertices.shrink_to_fit();
+        ApplyVertexLayout(layout);
+        CalculateBounds();
+        SetupMesh();
+    }
+    
+    void Mesh::UnpackVertices() {
+        if (!IsPacked()) {
+            return;
+        }
+        m_vertices = DecodeVertices();
+        ClearPackedVertices();
+        SetupMesh();
+    }
+    
+    size_t Mesh::GetVertexDataSize() const {
+        return IsPacked() ? m_packedVertices.size() : m_vertices.size() * sizeof(Vertex);
+    }
+    
+    Vertex Mesh::GetVertex(size_t index) const {
+        if (!IsPacked()) {
+            return m_vertices[index];
+        }
+        Vertex vertex;
+        VertexPacking::Unpack(m_packedVertices.data() + index * m_layout.stride, 1, m_layout, &vertex);
+        return vertex;
+    }
+    
+    Math::Vec3 Mesh::GetVertexPosition(size_t index) const {
+        if (!IsPacked()) {
+            return m_vertices[index].position;
+        }
+        // Position is always Float32 at offset 0 of a packed vertex
+        Math::Vec3 position;
+        std::memcpy(&position.x, m_packedVertices.data() + index * m_layout.stride, sizeof(float) * 3);
+        return position;
+    }
+    
+    void Mesh::ClearPackedVertices() {
+        if (!IsPacked()) {
+            return;
+        }
+        m_packedVertices.clear();
+        m_packedVertices.shrink_to_fit();
+        m_packedVertexCount = 0;
+        ApplyVertexLayout(VertexLayout());
+    }
+    
     void Mesh::EnableAttribute(VertexAttribute attribute) {
         m_layout.EnableAttribute(attribute);
         // Force recreation of GPU resources
@@ -302,8 +552,14 @@ namespace GameEngine {
         stats.triangleCount = GetTriangleCount();
         stats.memoryUsage = GetMemoryUsage();
         
-        // Analyze vertex attributes
-        if (!m_vertices.empty()) {
+        // Analyze vertex attributes; a packed layout only carries attributes that hold data
+        if (IsPacked()) {
+            stats.hasNormals = m_layout.HasAttribute(VertexAttribute::Normal);
+            stats.hasTangents = m_layout.HasAttribute(VertexAttribute::Tangent);
+            stats.hasTextureCoords = m_layout.HasAttribute(VertexAttribute::TexCoords);
+            stats.hasColors = m_layout.HasAttribute(VertexAttribute::Color);
+            stats.hasBoneWeights = m_layout.HasAttribute(VertexAttribute::BoneWeights);
+        } else if (!m_vertices.empty()) {
             stats.hasNormals = std::any_of(m_vertices.begin(), m_vertices.end(),
                 [](const Vertex& v) { return glm::length(v.normal) > 0.001f; });
             stats.hasTangents = std::any_of(m_vertices.begin(), m_vertices.end(),
@@ -344,11 +600,13 @@ namespace GameEngine {
         
         // Count duplicate vertices
         std::unordered_set<size_t> uniqueVertices;
-        for (const auto& vertex : m_vertices) {
+        const uint32_t vertexCount = GetVertexCount();
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            const Math::Vec3 position = GetVertexPosition(i);
             // Simple hash based on position
-            size_t hash = std::hash<float>{}(vertex.position.x) ^
-                         (std::hash<float>{}(vertex.position.y) << 1) ^
-                         (std::hash<float>{}(vertex.position.z) << 2);
+            size_t hash = std::hash<float>{}(position.x) ^
+                         (std::hash<float>{}(position.y) << 1) ^
+                         (std::hash<float>{}(position.z) << 2);
             if (uniqueVertices.find(hash) != uniqueVertices.end()) {
                 stats.duplicateVertices++;
             } else {
@@ -364,7 +622,7 @@ namespace GameEngine {
     }
 
     void Mesh::SetupMesh() const {
-        if (m_vertices.empty()) {
+        if (GetVertexCount() == 0) {
             Logger::GetInstance().Log(LogLevel::Warning, "Attempting to setup mesh with no vertices");
             return;
         }
@@ -381,7 +639,11 @@ namespace GameEngine {
 
         // Vertex buffer
         glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-        glBufferData(GL_ARRAY_BUFFER, m_vertices.size() * sizeof(Vertex), m_vertices.data(), GL_STATIC_DRAW);
+        if (IsPacked()) {
+            glBufferData(GL_ARRAY_BUFFER, m_packedVertices.size(), m_packedVertices.data(), GL_STATIC_DRAW);
+        } else {
+            glBufferData(GL_ARRAY_BUFFER, m_vertices.size() * sizeof(Vertex), m_vertices.data(), GL_STATIC_DRAW);
+        }
 
         // Index buffer
         if (!m_indices.empty()) {
@@ -405,7 +667,7 @@ namespace GameEngine {
             Logger::GetInstance().Log(LogLevel::Error, "OpenGL error in SetupMesh: " + std::to_string(error));
         } else {
             Logger::GetInstance().Log(LogLevel::Debug, "Mesh setup completed successfully with " + 
-                                     std::to_string(m_vertices.size()) + " vertices and " + 
+                                     std::to_string(GetVertexCount()) + " vertices and " + 
                                      std::to_string(m_indices.size()) + " indices");
         }
     }
@@ -418,6 +680,14 @@ namespace GameEngine {
             uint32_t location = static_cast<uint32_t>(attr.type);
             glEnableVertexAttribArray(location);
             
+            // Packed buffers use the offsets computed by the layout itself
+            if (m_layout.packed) {
+                glVertexAttribPointer(location, attr.size, attr.dataType,
+                                    attr.normalized ? GL_TRUE : GL_FALSE,
+                                    m_layout.stride, reinterpret_cast<void*>(static_cast<uintptr_t>(attr.offset)));
+                continue;
+            }
+            
             // Get the actual offset in the Vertex struct
             void* offset = nullptr;
             switch (attr.type) {
@@ -485,7 +755,7 @@ namespace GameEngine {
         if (!m_indices.empty()) {
             glDrawElements(primitiveMode, static_cast<GLsizei>(m_indices.size()), GL_UNSIGNED_INT, 0);
         } else {
-            glDrawArrays(primitiveMode, 0, static_cast<GLsizei>(m_vertices.size()));
+            glDrawArrays(primitiveMode, 0, static_cast<GLsizei>(GetVertexCount()));
         }
         
         Unbind();
@@ -507,7 +777,7 @@ namespace GameEngine {
             glDrawElementsInstanced(primitiveMode, static_cast<GLsizei>(m_indices.size()), 
                                   GL_UNSIGNED_INT, 0, instanceCount);
         } else {
-            glDrawArraysInstanced(primitiveMode, 0, static_cast<GLsizei>(m_vertices.size()), instanceCount);
+            glDrawArraysInstanced(primitiveMode, 0, static_cast<GLsizei>(GetVertexCount()), instanceCount);
         }
         
         Unbind();
@@ -539,8 +809,10 @@ namespace GameEngine {
         }
         
         // Clear CPU-side data
+        ClearPackedVertices();
         m_vertices.clear();
         m_indices.clear();
+        m_meshlets.Clear();
         
         Logger::GetInstance().Log(LogLevel::Debug, "Mesh cleanup completed");
     }
@@ -550,7 +822,7 @@ namespace GameEngine {
         size_t baseSize = Resource::GetMemoryUsage();
         
         // Calculate mesh memory usage
-        size_t vertexMemory = m_vertices.size() * sizeof(Vertex);
+        size_t vertexMemory = GetVertexDataSize();
         size_t indexMemory = m_indices.size() * sizeof(uint32_t);
         
         // Add skeletal data memory usage
@@ -562,7 +834,8 @@ namespace GameEngine {
         // Add estimated GPU memory usage (VAO, VBO, EBO are relatively small)
         size_t gpuMemory = vertexMemory + indexMemory + skeletalMemory;
         
-        return baseSize + vertexMemory + indexMemory + skeletalMemory + gpuMemory;
+        return baseSize + vertexMemory + indexMemory + skeletalMemory + gpuMemory +
+               m_meshlets.GetMemoryUsage();
     }
     
     void Mesh::EnsureGPUResourcesCreated() const {
@@ -594,7 +867,7 @@ namespace GameEngine {
                                  ", VBO: " + std::to_string(m_VBO) + ", EBO: " + std::to_string(m_EBO));
         
         // Setup mesh data if available
-        if (!m_vertices.empty()) {
+        if (GetVertexCount() > 0) {
             SetupMesh();
         }
     }
@@ -608,6 +881,22 @@ namespace GameEngine {
         
         LOG_INFO("Optimizing vertex cache using Tom Forsyth's algorithm...");
         
+        OptimizeVertexCache(m_indices, GetVertexCount());
+        m_meshlets.Clear();
+        
+        LOG_INFO("Vertex cache optimization completed");
+        
+        // Update GPU resources
+        if (m_gpuResourcesCreated) {
+            SetupMesh();
+        }
+    }
+    
+    void Mesh::OptimizeVertexCache(std::vector<uint32_t>& indices, size_t vertexCount) {
+        if (indices.size() < 3) {
+            return;
+        }
+        
         // Tom Forsyth's vertex cache optimization algorithm
         const uint32_t CACHE_SIZE = 32; // Typical GPU vertex cache size
         const float CACHE_DECAY_POWER = 1.5f;
@@ -615,17 +904,17 @@ namespace GameEngine {
         const float VALENCE_BOOST_SCALE = 2.0f;
         const float VALENCE_BOOST_POWER = 0.5f;
         
-        uint32_t numVertices = static_cast<uint32_t>(m_vertices.size());
-        uint32_t numTriangles = static_cast<uint32_t>(m_indices.size() / 3);
+        const uint32_t numVertices = static_cast<uint32_t>(vertexCount);
+        const uint32_t numTriangles = static_cast<uint32_t>(indices.size() / 3);
         
         // Build adjacency information
         std::vector<std::vector<uint32_t>> vertexTriangles(numVertices);
         std::vector<bool> triangleAdded(numTriangles, false);
         
         for (uint32_t i = 0; i < numTriangles; ++i) {
-            uint32_t i0 = m_indices[i * 3];
-            uint32_t i1 = m_indices[i * 3 + 1];
-            uint32_t i2 = m_indices[i * 3 + 2];
+            uint32_t i0 = indices[i * 3];
+            uint32_t i1 = indices[i * 3 + 1];
+            uint32_t i2 = indices[i * 3 + 2];
             
             if (i0 < numVertices) vertexTriangles[i0].push_back(i);
             if (i1 < numVertices) vertexTriangles[i1].push_back(i);
@@ -684,7 +973,7 @@ namespace GameEngine {
         
         // Optimize triangle order
         std::vector<uint32_t> newIndices;
-        newIndices.reserve(m_indices.size());
+        newIndices.reserve(indices.size());
         
         for (uint32_t addedTriangles = 0; addedTriangles < numTriangles; ++addedTriangles) {
             // Find best triangle to add next
@@ -694,9 +983,9 @@ namespace GameEngine {
             for (uint32_t i = 0; i < numTriangles; ++i) {
                 if (triangleAdded[i]) continue;
                 
-                uint32_t i0 = m_indices[i * 3];
-                uint32_t i1 = m_indices[i * 3 + 1];
-                uint32_t i2 = m_indices[i * 3 + 2];
+                uint32_t i0 = indices[i * 3];
+                uint32_t i1 = indices[i * 3 + 1];
+                uint32_t i2 = indices[i * 3 + 2];
                 
                 float score = 0.0f;
                 if (i0 < numVertices) score += vertexScore[i0];
@@ -711,9 +1000,9 @@ namespace GameEngine {
             
             // Add best triangle
             triangleAdded[bestTriangle] = true;
-            uint32_t i0 = m_indices[bestTriangle * 3];
-            uint32_t i1 = m_indices[bestTriangle * 3 + 1];
-            uint32_t i2 = m_indices[bestTriangle * 3 + 2];
+            uint32_t i0 = indices[bestTriangle * 3];
+            uint32_t i1 = indices[bestTriangle * 3 + 1];
+            uint32_t i2 = indices[bestTriangle * 3 + 2];
             
             newIndices.push_back(i0);
             newIndices.push_back(i1);
@@ -750,9 +1039,9 @@ namespace GameEngine {
                 // Update scores of adjacent vertices
                 for (uint32_t adjTri : triangles) {
                     if (!triangleAdded[adjTri]) {
-                        uint32_t ai0 = m_indices[adjTri * 3];
-                        uint32_t ai1 = m_indices[adjTri * 3 + 1];
-                        uint32_t ai2 = m_indices[adjTri * 3 + 2];
+                        uint32_t ai0 = indices[adjTri * 3];
+                        uint32_t ai1 = indices[adjTri * 3 + 1];
+                        uint32_t ai2 = indices[adjTri * 3 + 2];
                         
                         if (ai0 < numVertices) vertexScore[ai0] = calculateVertexScore(ai0);
                         if (ai1 < numVertices) vertexScore[ai1] = calculateVertexScore(ai1);
@@ -767,17 +1056,11 @@ namespace GameEngine {
         }
         
         // Replace indices with optimized version
-        m_indices = newIndices;
-        
-        LOG_INFO("Vertex cache optimization completed");
-        
-        // Update GPU resources
-        if (m_gpuResourcesCreated) {
-            SetupMesh();
-        }
+        indices = std::move(newIndices);
     }
     
     void Mesh::OptimizeVertexFetch() {
+        UnpackVertices();
         if (m_vertices.empty() || m_indices.empty()) {
             LOG_WARNING("Cannot optimize vertex fetch: insufficient data");
             return;
@@ -818,6 +1101,7 @@ namespace GameEngine {
         
         // Replace vertices with reordered version
         m_vertices = newVertices;
+        m_meshlets.Clear();
         
         LOG_INFO("Vertex fetch optimization completed");
         
@@ -855,9 +1139,10 @@ namespace GameEngine {
                 
                 // Calculate centroid depth
                 float depth = 0.0f;
-                if (tri.indices[0] < m_vertices.size()) depth += m_vertices[tri.indices[0]].position.z;
-                if (tri.indices[1] < m_vertices.size()) depth += m_vertices[tri.indices[1]].position.z;
-                if (tri.indices[2] < m_vertices.size()) depth += m_vertices[tri.indices[2]].position.z;
+                const uint32_t vertexCount = GetVertexCount();
+                if (tri.indices[0] < vertexCount) depth += GetVertexPosition(tri.indices[0]).z;
+                if (tri.indices[1] < vertexCount) depth += GetVertexPosition(tri.indices[1]).z;
+                if (tri.indices[2] < vertexCount) depth += GetVertexPosition(tri.indices[2]).z;
                 tri.depth = depth / 3.0f;
                 
                 triangles.push_back(tri);
@@ -872,6 +1157,7 @@ namespace GameEngine {
         
         // Rebuild indices
         m_indices.clear();
+        m_meshlets.Clear();
         m_indices.reserve(triangles.size() * 3);
         
         for (const auto& tri : triangles) {
@@ -889,6 +1175,7 @@ namespace GameEngine {
     }
     
     void Mesh::RemoveDuplicateVertices(float epsilon) {
+        UnpackVertices();
         if (m_vertices.empty()) return;
         
         std::vector<Vertex> uniqueVertices;
@@ -930,6 +1217,7 @@ namespace GameEngine {
         
         size_t originalCount = m_vertices.size();
         m_vertices = uniqueVertices;
+        m_meshlets.Clear();
         
         LOG_INFO("Removed duplicate vertices: " + std::to_string(originalCount) + 
                 " -> " + std::to_string(m_vertices.size()) + 
@@ -942,26 +1230,38 @@ namespace GameEngine {
     }
     
     void Mesh::GenerateNormals(bool smooth) {
+        UnpackVertices();
         if (m_vertices.empty() || m_indices.empty()) return;
         
+        GenerateNormals(m_vertices, m_indices, smooth);
+        
+        LOG_INFO("Generated " + std::string(smooth ? "smooth" : "flat") + " normals for mesh");
+        
+        // Update GPU resources
+        if (m_gpuResourcesCreated) {
+            SetupMesh();
+        }
+    }
+    
+    void Mesh::GenerateNormals(std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, bool smooth) {
         // Reset all normals
-        for (auto& vertex : m_vertices) {
+        for (auto& vertex : vertices) {
             vertex.normal = Math::Vec3(0.0f);
         }
         
         // Calculate face normals and accumulate
-        for (size_t i = 0; i < m_indices.size(); i += 3) {
-            if (i + 2 >= m_indices.size()) break;
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            if (i + 2 >= indices.size()) break;
             
-            uint32_t i0 = m_indices[i];
-            uint32_t i1 = m_indices[i + 1];
-            uint32_t i2 = m_indices[i + 2];
+            uint32_t i0 = indices[i];
+            uint32_t i1 = indices[i + 1];
+            uint32_t i2 = indices[i + 2];
             
-            if (i0 >= m_vertices.size() || i1 >= m_vertices.size() || i2 >= m_vertices.size()) continue;
+            if (i0 >= vertices.size() || i1 >= vertices.size() || i2 >= vertices.size()) continue;
             
-            Math::Vec3 v0 = m_vertices[i0].position;
-            Math::Vec3 v1 = m_vertices[i1].position;
-            Math::Vec3 v2 = m_vertices[i2].position;
+            Math::Vec3 v0 = vertices[i0].position;
+            Math::Vec3 v1 = vertices[i1].position;
+            Math::Vec3 v2 = vertices[i2].position;
             
             Math::Vec3 edge1 = v1 - v0;
             Math::Vec3 edge2 = v2 - v0;
@@ -969,27 +1269,34 @@ namespace GameEngine {
             
             if (smooth) {
                 // Accumulate normals for smooth shading
-                m_vertices[i0].normal += faceNormal;
-                m_vertices[i1].normal += faceNormal;
-                m_vertices[i2].normal += faceNormal;
+                vertices[i0].normal += faceNormal;
+                vertices[i1].normal += faceNormal;
+                vertices[i2].normal += faceNormal;
             } else {
                 // Set same normal for flat shading
-                m_vertices[i0].normal = faceNormal;
-                m_vertices[i1].normal = faceNormal;
-                m_vertices[i2].normal = faceNormal;
+                vertices[i0].normal = faceNormal;
+                vertices[i1].normal = faceNormal;
+                vertices[i2].normal = faceNormal;
             }
         }
         
         if (smooth) {
             // Normalize accumulated normals
-            for (auto& vertex : m_vertices) {
+            for (auto& vertex : vertices) {
                 if (glm::length(vertex.normal) > 0.001f) {
                     vertex.normal = glm::normalize(vertex.normal);
                 }
             }
         }
+    }
+    
+    void Mesh::GenerateTangents() {
+        UnpackVertices();
+        if (m_vertices.empty() || m_indices.empty()) return;
         
-        LOG_INFO("Generated " + std::string(smooth ? "smooth" : "flat") + " normals for mesh");
+        GenerateTangents(m_vertices, m_indices);
+        
+        LOG_INFO("Generated tangents and bitangents for mesh");
         
         // Update GPU resources
         if (m_gpuResourcesCreated) {
@@ -997,28 +1304,26 @@ namespace GameEngine {
         }
     }
     
-    void Mesh::GenerateTangents() {
-        if (m_vertices.empty() || m_indices.empty()) return;
-        
+    void Mesh::GenerateTangents(std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) {
         // Reset tangents and bitangents
-        for (auto& vertex : m_vertices) {
+        for (auto& vertex : vertices) {
             vertex.tangent = Math::Vec3(0.0f);
             vertex.bitangent = Math::Vec3(0.0f);
         }
         
         // Calculate tangents for each triangle
-        for (size_t i = 0; i < m_indices.size(); i += 3) {
-            if (i + 2 >= m_indices.size()) break;
+        for (size_t i = 0; i < indices.size(); i += 3) {
+            if (i + 2 >= indices.size()) break;
             
-            uint32_t i0 = m_indices[i];
-            uint32_t i1 = m_indices[i + 1];
-            uint32_t i2 = m_indices[i + 2];
+            uint32_t i0 = indices[i];
+            uint32_t i1 = indices[i + 1];
+            uint32_t i2 = indices[i + 2];
             
-            if (i0 >= m_vertices.size() || i1 >= m_vertices.size() || i2 >= m_vertices.size()) continue;
+            if (i0 >= vertices.size() || i1 >= vertices.size() || i2 >= vertices.size()) continue;
             
-            Vertex& v0 = m_vertices[i0];
-            Vertex& v1 = m_vertices[i1];
-            Vertex& v2 = m_vertices[i2];
+            Vertex& v0 = vertices[i0];
+            Vertex& v1 = vertices[i1];
+            Vertex& v2 = vertices[i2];
             
             Math::Vec3 edge1 = v1.position - v0.position;
             Math::Vec3 edge2 = v2.position - v0.position;
@@ -1043,7 +1348,7 @@ namespace GameEngine {
         }
         
         // Normalize tangents and bitangents
-        for (auto& vertex : m_vertices) {
+        for (auto& vertex : vertices) {
             if (glm::length(vertex.tangent) > 0.0f) {
                 vertex.tangent = glm::normalize(vertex.tangent);
             } else {
@@ -1056,13 +1361,6 @@ namespace GameEngine {
                 vertex.bitangent = Math::Vec3(0.0f, 0.0f, 1.0f);
             }
         }
-        
-        LOG_INFO("Generated tangents and bitangents for mesh");
-        
-        // Update GPU resources
-        if (m_gpuResourcesCreated) {
-            SetupMesh();
-        }
     }
     
     // Validation methods
@@ -1073,19 +1371,20 @@ namespace GameEngine {
     std::vector<std::string> Mesh::GetValidationErrors() const {
         std::vector<std::string> errors;
         
-        if (m_vertices.empty()) {
+        const uint32_t vertexCount = GetVertexCount();
+        if (vertexCount == 0) {
             errors.push_back("Mesh has no vertices");
         }
         
-        if (m_indices.empty() && m_vertices.size() % 3 != 0) {
+        if (m_indices.empty() && vertexCount % 3 != 0) {
             errors.push_back("Mesh has no indices and vertex count is not divisible by 3");
         }
         
         // Check for out-of-bounds indices
         for (size_t i = 0; i < m_indices.size(); ++i) {
-            if (m_indices[i] >= m_vertices.size()) {
+            if (m_indices[i] >= vertexCount) {
                 errors.push_back("Index " + std::to_string(i) + " is out of bounds (" + 
-                                std::to_string(m_indices[i]) + " >= " + std::to_string(m_vertices.size()) + ")");
+                                std::to_string(m_indices[i]) + " >= " + std::to_string(vertexCount) + ")");
             }
         }
         
@@ -1107,18 +1406,22 @@ namespace GameEngine {
     }
     
     bool Mesh::HasValidUVCoordinates() const {
-        if (m_vertices.empty()) return false;
+        const uint32_t vertexCount = GetVertexCount();
+        if (vertexCount == 0) return false;
         
         // Check if any vertex has non-zero UV coordinates
-        return std::any_of(m_vertices.begin(), m_vertices.end(),
-            [](const Vertex& v) { 
-                return v.texCoords.x != 0.0f || v.texCoords.y != 0.0f ||
-                       (v.texCoords.x >= 0.0f && v.texCoords.x <= 1.0f && 
-                        v.texCoords.y >= 0.0f && v.texCoords.y <= 1.0f);
-            });
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            const Math::Vec2 uv = IsPacked() ? GetVertex(i).texCoords : m_vertices[i].texCoords;
+            if (uv.x != 0.0f || uv.y != 0.0f ||
+                (uv.x >= 0.0f && uv.x <= 1.0f && uv.y >= 0.0f && uv.y <= 1.0f)) {
+                return true;
+            }
+        }
+        return false;
     }
     
     void Mesh::GenerateFallbackUVCoordinates() {
+        UnpackVertices();
         if (m_vertices.empty()) return;
         
         // Generate simple planar UV coordinates based on position
@@ -1151,51 +1454,61 @@ namespace GameEngine {
         }
     }
     
-    // Helper methods
-    void Mesh::CalculateBounds() {
-        m_boundingBox = BoundingBox();
-        m_boundingSphere = BoundingSphere();
-        
-        if (m_vertices.empty()) {
-            return;
-        }
-        
-        // Calculate axis-aligned bounding box
-        for (const auto& vertex : m_vertices) {
-            m_boundingBox.Expand(vertex.position);
-        }
-        
-        // Calculate optimal bounding sphere using Ritter's algorithm
-        if (m_boundingBox.IsValid()) {
-            // Start with sphere from bounding box center
-            Math::Vec3 center = m_boundingBox.GetCenter();
-            float radius = 0.0f;
-            
-            // Find the point farthest from center
-            for (const auto& vertex : m_vertices) {
-                float distance = glm::length(vertex.position - center);
-                radius = std::max(radius, distance);
+    namespace {
+        // Axis-aligned box, then a sphere around its centre refined with Ritter's algorithm
+        template <typename PositionAt>
+        void ComputeBounds(size_t vertexCount, const PositionAt& positionAt, BoundingBox& boundingBox, BoundingSphere& boundingSphere) {
+            boundingBox = BoundingBox();
+            boundingSphere = BoundingSphere();
+            if (vertexCount == 0) {
+                return;
             }
             
-            m_boundingSphere = BoundingSphere(center, radius);
+            for (size_t i = 0; i < vertexCount; ++i) {
+                boundingBox.Expand(positionAt(i));
+            }
             
-            // Refine sphere using iterative approach for better fit
-            for (int iteration = 0; iteration < 2; ++iteration) {
-                for (const auto& vertex : m_vertices) {
-                    m_boundingSphere.Expand(vertex.position);
+            if (boundingBox.IsValid()) {
+                // Start with sphere from bounding box center
+                Math::Vec3 center = boundingBox.GetCenter();
+                float radius = 0.0f;
+                
+                // Find the point farthest from center
+                for (size_t i = 0; i < vertexCount; ++i) {
+                    float distance = glm::length(positionAt(i) - center);
+                    radius = std::max(radius, distance);
+                }
+                
+                boundingSphere = BoundingSphere(center, radius);
+                
+                // Refine sphere using iterative approach for better fit
+                for (int iteration = 0; iteration < 2; ++iteration) {
+                    for (size_t i = 0; i < vertexCount; ++i) {
+                        boundingSphere.Expand(positionAt(i));
+                    }
                 }
             }
         }
     }
     
+    // Helper methods
+    void Mesh::CalculateBounds() {
+        ComputeBounds(GetVertexCount(), [this](size_t i) { return GetVertexPosition(i); }, m_boundingBox, m_boundingSphere);
+    }
+    
+    void Mesh::CalculateBounds(const std::vector<Vertex>& vertices, BoundingBox& boundingBox, BoundingSphere& boundingSphere) {
+        ComputeBounds(vertices.size(), [&vertices](size_t i) { return vertices[i].position; }, boundingBox, boundingSphere);
+    }
+    
     float Mesh::CalculateTriangleArea(uint32_t i0, uint32_t i1, uint32_t i2) const {
-        if (i0 >= m_vertices.size() || i1 >= m_vertices.size() || i2 >= m_vertices.size()) {
+        const uint32_t vertexCount = GetVertexCount();
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) {
             return 0.0f;
         }
         
-        Math::Vec3 v0 = m_vertices[i0].position;
-        Math::Vec3 v1 = m_vertices[i1].position;
-        Math::Vec3 v2 = m_vertices[i2].position;
+        Math::Vec3 v0 = GetVertexPosition(i0);
+        Math::Vec3 v1 = GetVertexPosition(i1);
+        Math::Vec3 v2 = GetVertexPosition(i2);
         
         Math::Vec3 edge1 = v1 - v0;
         Math::Vec3 edge2 = v2 - v0;
@@ -1204,7 +1517,8 @@ namespace GameEngine {
     }
     
     bool Mesh::IsTriangleDegenerate(uint32_t i0, uint32_t i1, uint32_t i2, float epsilon) const {
-        if (i0 >= m_vertices.size() || i1 >= m_vertices.size() || i2 >= m_vertices.size()) {
+        const uint32_t vertexCount = GetVertexCount();
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) {
             return true;
         }
         
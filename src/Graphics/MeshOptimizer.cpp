@@ -1,4 +1,5 @@
 #include "Graphics/MeshOptimizer.h"
+#include "Resource/ParallelImport.h"
 #include "Core/Logger.h"
 #include <algorithm>
 #include <unordered_map>
@@ -7,6 +8,8 @@
 #include <chrono>
 #include <cmath>
 #include <cfloat>
+#include <cstring>
+#include <functional>
 
 namespace GameEngine {
     
@@ -14,6 +17,268 @@ namespace GameEngine {
     uint32_t MeshOptimizer::s_cacheSize = 32;  // Typical GPU vertex cache size
     bool MeshOptimizer::s_verboseLogging = false;
     
+    namespace {
+        constexpr uint32_t INVALID_INDEX = ~0u;
+        
+        // Tom Forsyth's vertex scoring constants
+        constexpr float CACHE_DECAY_POWER = 1.5f;
+        constexpr float LAST_TRI_SCORE = 0.75f;
+        constexpr float VALENCE_BOOST_SCALE = 2.0f;
+        constexpr float VALENCE_BOOST_POWER = 0.5f;
+        constexpr uint32_t VALENCE_TABLE_SIZE = 64;
+        
+        // Vertex scores by cache position (cacheSize = not cached) and remaining triangle count,
+        // precomputed so the optimizer never calls pow per vertex
+        struct VertexScoreTable {
+            std::vector<float> cachePosition;
+            float valence[VALENCE_TABLE_SIZE];
+            
+            explicit VertexScoreTable(uint32_t cacheSize) : cachePosition(cacheSize + 1, 0.0f) {
+                for (uint32_t i = 0; i < cacheSize; ++i) {
+                    cachePosition[i] = i < 3 ? LAST_TRI_SCORE
+                        : std::pow(1.0f - static_cast<float>(i - 3) / (cacheSize - 3), CACHE_DECAY_POWER);
+                }
+                valence[0] = 0.0f;
+                for (uint32_t i = 1; i < VALENCE_TABLE_SIZE; ++i) {
+                    valence[i] = VALENCE_BOOST_SCALE * std::pow(static_cast<float>(i), -VALENCE_BOOST_POWER);
+                }
+            }
+            
+            float Score(uint32_t position, uint32_t liveTriangles) const {
+                if (liveTriangles == 0) return 0.0f;
+                return cachePosition[position] + valence[std::min(liveTriangles, VALENCE_TABLE_SIZE - 1)];
+            }
+        };
+        
+        // Simplification measures vertices as position relative to the mesh bounds followed by
+        // weighted texture coordinates and normal
+        constexpr int QUADRIC_SIZE = 8;
+        constexpr int QUADRIC_TERMS = QUADRIC_SIZE * (QUADRIC_SIZE + 1) / 2;
+        constexpr float BORDER_WEIGHT = 10.0f;
+        
+        // Garland-Heckbert quadric over position and attributes, error(v) = v'Av + 2b'v + c,
+        // summed with area weights and divided by the total weight when a collapse is scored
+        struct Quadric {
+            float a[QUADRIC_TERMS] = {};  // Upper triangle of A, row by row
+            float b[QUADRIC_SIZE] = {};
+            float c = 0.0f;
+            float weight = 0.0f;
+            
+            void Add(const Quadric& other) {
+                for (int i = 0; i < QUADRIC_TERMS; ++i) a[i] += other.a[i];
+                for (int i = 0; i < QUADRIC_SIZE; ++i) b[i] += other.b[i];
+                c += other.c;
+                weight += other.weight;
+            }
+            
+            float Evaluate(const float* v) const {
+                float result = c;
+                int term = 0;
+                for (int i = 0; i < QUADRIC_SIZE; ++i) {
+                    float row = a[term++] * v[i];
+                    for (int j = i + 1; j < QUADRIC_SIZE; ++j) {
+                        row += 2.0f * a[term++] * v[j];
+                    }
+                    result += v[i] * (row + 2.0f * b[i]);
+                }
+                return result;
+            }
+        };
+        
+        float Dot(const float* a, const float* b) {
+            float result = 0.0f;
+            for (int i = 0; i < QUADRIC_SIZE; ++i) result += a[i] * b[i];
+            return result;
+        }
+        
+        // Squared distance to the plane of triangle pqr in attribute space: A = I - e1e1' - e2e2'
+        // for an orthonormal basis e1, e2 of the triangle
+        Quadric TriangleQuadric(const float* p, const float* q, const float* r, float weight) {
+            Quadric quadric;
+            float e1[QUADRIC_SIZE], e2[QUADRIC_SIZE];
+            for (int i = 0; i < QUADRIC_SIZE; ++i) {
+                e1[i] = q[i] - p[i];
+                e2[i] = r[i] - p[i];
+            }
+            const float length1 = std::sqrt(Dot(e1, e1));
+            if (length1 <= 0.0f) return quadric;
+            for (float& value : e1) value /= length1;
+            
+            const float projection = Dot(e1, e2);
+            for (int i = 0; i < QUADRIC_SIZE; ++i) e2[i] -= projection * e1[i];
+            const float length2 = std::sqrt(Dot(e2, e2));
+            if (length2 <= 0.0f) return quadric;
+            for (float& value : e2) value /= length2;
+            
+            int term = 0;
+            for (int i = 0; i < QUADRIC_SIZE; ++i) {
+                for (int j = i; j < QUADRIC_SIZE; ++j) {
+                    quadric.a[term++] = weight * ((i == j ? 1.0f : 0.0f) - e1[i] * e1[j] - e2[i] * e2[j]);
+                }
+            }
+            const float pe1 = Dot(p, e1);
+            const float pe2 = Dot(p, e2);
+            for (int i = 0; i < QUADRIC_SIZE; ++i) {
+                quadric.b[i] = weight * (pe1 * e1[i] + pe2 * e2[i] - p[i]);
+            }
+            quadric.c = weight * std::max(Dot(p, p) - pe1 * pe1 - pe2 * pe2, 0.0f);
+            quadric.weight = weight;
+            return quadric;
+        }
+        
+        // Squared distance to a plane through the position part only
+        Quadric PlaneQuadric(const Math::Vec3& normal, float distance, float weight) {
+            Quadric quadric;
+            int term = 0;
+            for (int i = 0; i < QUADRIC_SIZE; ++i) {
+                for (int j = i; j < QUADRIC_SIZE; ++j) {
+                    quadric.a[term++] = i < 3 && j < 3 ? weight * normal[i] * normal[j] : 0.0f;
+                }
+            }
+            for (int i = 0; i < 3; ++i) {
+                quadric.b[i] = weight * distance * normal[i];
+            }
+            quadric.c = weight * distance * distance;
+            quadric.weight = weight;
+            return quadric;
+        }
+        
+        struct PositionKey {
+            uint32_t bits[3];
+            
+            explicit PositionKey(const Math::Vec3& position) {
+                for (int i = 0; i < 3; ++i) {
+                    const float value = position[i] + 0.0f;  // -0 and +0 are the same position
+                    std::memcpy(&bits[i], &value, sizeof(value));
+                }
+            }
+            
+            bool operator==(const PositionKey& other) const {
+                return bits[0] == other.bits[0] && bits[1] == other.bits[1] && bits[2] == other.bits[2];
+            }
+        };
+        
+        struct PositionKeyHash {
+            size_t operator()(const PositionKey& key) const {
+                return (static_cast<size_t>(key.bits[0]) * 73856093u) ^ (static_cast<size_t>(key.bits[1]) * 19349663u) ^
+                       (static_cast<size_t>(key.bits[2]) * 83492791u);
+            }
+        };
+        
+        // Vertices at one position are wedges of it; wedges that differ only in attributes the
+        // caller does not preserve are welded
+        bool IsSameWedge(const Vertex& a, const Vertex& b, const SimplificationOptions& options) {
+            const bool sameNormal = a.normal == b.normal;
+            const bool sameUV = a.texCoords == b.texCoords && a.tangent == b.tangent && a.bitangent == b.bitangent;
+            return (sameNormal || !options.preserveNormalSeams) && (sameUV || !options.preserveUVSeams) &&
+                   a.color == b.color && a.boneIds == b.boneIds && a.boneWeights == b.boneWeights &&
+                   a.texCoords2 == b.texCoords2 && a.texCoords3 == b.texCoords3;
+        }
+        
+        enum class SimplifyVertexKind : uint8_t {
+            Manifold,  // Interior vertex, collapses along any edge
+            Border,  // On a simple open border, collapses along the border only
+            Locked  // Seam, non-manifold or preserved border vertex, never moves
+        };
+        
+        // Indexed binary min-heap holding each vertex's cheapest collapse, so a vertex is queued
+        // once and rescoring it moves its entry instead of leaving a stale one behind
+        class CollapseQueue {
+        public:
+            explicit CollapseQueue(size_t vertexCount) : m_slots(vertexCount, INVALID_INDEX) {}
+            
+            bool Empty() const { return m_heap.empty(); }
+            uint32_t TopVertex() const { return m_heap[0].vertex; }
+            float TopError() const { return m_heap[0].error; }
+            
+            void Update(uint32_t vertex, float error) {
+                if (m_slots[vertex] == INVALID_INDEX) {
+                    m_slots[vertex] = static_cast<uint32_t>(m_heap.size());
+                    m_heap.push_back({error, vertex});
+                    SiftUp(m_slots[vertex]);
+                } else {
+                    const uint32_t slot = m_slots[vertex];
+                    m_heap[slot].error = error;
+                    SiftUp(slot);
+                    SiftDown(m_slots[vertex]);
+                }
+            }
+            
+            void Remove(uint32_t vertex) {
+                const uint32_t slot = m_slots[vertex];
+                if (slot == INVALID_INDEX) return;
+                m_slots[vertex] = INVALID_INDEX;
+                if (slot + 1 == m_heap.size()) {
+                    m_heap.pop_back();
+                    return;
+                }
+                const uint32_t moved = m_heap.back().vertex;
+                Place(slot, m_heap.back());
+                m_heap.pop_back();
+                SiftUp(slot);
+                SiftDown(m_slots[moved]);
+            }
+            
+        private:
+            struct Entry {
+                float error;
+                uint32_t vertex;
+                
+                // Ties break on the vertex so results do not depend on insertion order
+                bool operator<(const Entry& other) const {
+                    return error < other.error || (error == other.error && vertex < other.vertex);
+                }
+            };
+            
+            void Place(uint32_t slot, const Entry& entry) {
+                m_heap[slot] = entry;
+                m_slots[entry.vertex] = slot;
+            }
+            
+            void SiftUp(uint32_t slot) {
+                const Entry entry = m_heap[slot];
+                while (slot > 0) {
+                    const uint32_t parent = (slot - 1) / 2;
+                    if (!(entry < m_heap[parent])) break;
+                    Place(slot, m_heap[parent]);
+                    slot = parent;
+                }
+                Place(slot, entry);
+            }
+            
+            void SiftDown(uint32_t slot) {
+                const Entry entry = m_heap[slot];
+                const uint32_t count = static_cast<uint32_t>(m_heap.size());
+                while (true) {
+                    uint32_t child = slot * 2 + 1;
+                    if (child >= count) break;
+                    if (child + 1 < count && m_heap[child + 1] < m_heap[child]) child++;
+                    if (!(m_heap[child] < entry)) break;
+                    Place(slot, m_heap[child]);
+                    slot = child;
+                }
+                Place(slot, entry);
+            }
+            
+            std::vector<Entry> m_heap;
+            std::vector<uint32_t> m_slots;
+        };
+        
+        // Keeps the referenced vertices in first-use order and rewrites the indices to match
+        std::vector<Vertex> CompactVertices(const std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+            std::vector<uint32_t> remap(vertices.size(), INVALID_INDEX);
+            std::vector<Vertex> compacted;
+            for (uint32_t& index : indices) {
+                if (remap[index] == INVALID_INDEX) {
+                    remap[index] = static_cast<uint32_t>(compacted.size());
+                    compacted.push_back(vertices[index]);
+                }
+                index = remap[index];
+            }
+            return compacted;
+        }
+    }
+    
     // MeshOptimizationStats implementation
     void MeshOptimizationStats::CalculateImprovements() {
         if (originalVertexCount > 0) {
@@ -60,8 +325,6 @@ namespace GameEngine {
         
         auto optimizedIndices = OptimizeIndices(indices, mesh.GetVertexCount());
         
-        // Create a new mesh with optimized indices
-        auto vertices = mesh.GetVertices();
         mesh.SetIndices(optimizedIndices);
         
         if (s_verboseLogging) {
@@ -73,7 +336,7 @@ namespace GameEngine {
     }
     
     void MeshOptimizer::OptimizeVertexFetch(Mesh& mesh) {
-        auto vertices = mesh.GetVertices();
+        auto vertices = mesh.DecodeVertices();
         auto indices = mesh.GetIndices();
         
         if (vertices.empty() || indices.empty()) {
@@ -102,131 +365,126 @@ namespace GameEngine {
             return indices;
         }
         
-        // Tom Forsyth's vertex cache optimization algorithm
-        const float CACHE_DECAY_POWER = 1.5f;
-        const float LAST_TRI_SCORE = 0.75f;
-        const float VALENCE_BOOST_SCALE = 2.0f;
-        const float VALENCE_BOOST_POWER = 0.5f;
-        
-        uint32_t numTriangles = static_cast<uint32_t>(indices.size() / 3);
+        // Tom Forsyth's algorithm with linear bookkeeping: triangle adjacency in flat arrays,
+        // scores from lookup tables, and after each emitted triangle only the vertices that moved
+        // through the cache are rescored and only their triangles are candidates
+        const uint32_t cacheSize = std::max(s_cacheSize, 4u);
+        const VertexScoreTable scores(cacheSize);
+        const size_t numTriangles = indices.size() / 3;
         
-        // Build adjacency information
-        std::vector<std::vector<uint32_t>> vertexTriangles(vertexCount);
-        std::vector<bool> triangleAdded(numTriangles, false);
-        
-        for (uint32_t i = 0; i < numTriangles; ++i) {
-            uint32_t i0 = indices[i * 3];
-            uint32_t i1 = indices[i * 3 + 1];
-            uint32_t i2 = indices[i * 3 + 2];
-            
-            if (i0 < vertexCount) vertexTriangles[i0].push_back(i);
-            if (i1 < vertexCount) vertexTriangles[i1].push_back(i);
-            if (i2 < vertexCount) vertexTriangles[i2].push_back(i);
+        // Live triangles of vertex v: adjacency[offsets[v]] .. adjacency[offsets[v] + liveTriangles[v] - 1]
+        std::vector<uint32_t> liveTriangles(vertexCount, 0);
+        for (size_t i = 0; i < numTriangles * 3; ++i) {
+            if (indices[i] < vertexCount) liveTriangles[indices[i]]++;
+        }
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        for (size_t v = 0; v < vertexCount; ++v) {
+            offsets[v + 1] = offsets[v] + liveTriangles[v];
+        }
+        std::vector<uint32_t> adjacency(offsets[vertexCount]);
+        {
+            std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < numTriangles * 3; ++i) {
+                if (indices[i] < vertexCount) adjacency[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+            }
         }
         
-        // Vertex cache simulation
-        std::vector<uint32_t> cache;
-        std::vector<uint32_t> vertexValence(vertexCount);
-        
-        // Initialize vertex valence
-        for (size_t i = 0; i < vertexCount; ++i) {
-            vertexValence[i] = static_cast<uint32_t>(vertexTriangles[i].size());
+        std::vector<float> vertexScores(vertexCount);
+        for (size_t v = 0; v < vertexCount; ++v) {
+            vertexScores[v] = scores.Score(cacheSize, liveTriangles[v]);
         }
         
-        // Calculate vertex scores
-        auto calculateVertexScore = [&](uint32_t vertex) -> float {
-            if (vertexValence[vertex] == 0) return -1.0f;
-            
-            float score = 0.0f;
-            
-            // Cache position score
-            auto cacheIt = std::find(cache.begin(), cache.end(), vertex);
-            if (cacheIt != cache.end()) {
-                uint32_t cachePos = static_cast<uint32_t>(std::distance(cache.begin(), cacheIt));
-                if (cachePos < 3) {
-                    score = LAST_TRI_SCORE;
-                } else {
-                    const float scaler = 1.0f / (s_cacheSize - 3);
-                    score = 1.0f - (cachePos - 3) * scaler;
-                    score = std::pow(score, CACHE_DECAY_POWER);
-                }
+        std::vector<float> triangleScores(numTriangles, 0.0f);
+        uint32_t current = 0;
+        for (size_t t = 0; t < numTriangles; ++t) {
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t vertex = indices[t * 3 + k];
+                if (vertex < vertexCount) triangleScores[t] += vertexScores[vertex];
             }
-            
-            // Valence score
-            float valenceScore = std::pow(static_cast<float>(vertexValence[vertex]), -VALENCE_BOOST_POWER);
-            score += VALENCE_BOOST_SCALE * valenceScore;
-            
-            return score;
-        };
+            if (triangleScores[t] > triangleScores[current]) current = static_cast<uint32_t>(t);
+        }
+        
+        std::vector<uint8_t> triangleAdded(numTriangles, 0);
+        std::vector<uint32_t> cache, newCache;
+        cache.reserve(cacheSize + 3);
+        newCache.reserve(cacheSize + 3);
+        std::vector<uint32_t> deadEndStack;  // Recently used vertices to restart from
+        size_t inputCursor = 0;
         
-        // Optimize triangle order
         std::vector<uint32_t> newIndices;
-        newIndices.reserve(indices.size());
+        newIndices.reserve(numTriangles * 3);
         
-        for (uint32_t addedTriangles = 0; addedTriangles < numTriangles; ++addedTriangles) {
-            // Find best triangle to add next
-            uint32_t bestTriangle = 0;
-            float bestScore = -1.0f;
+        while (current != INVALID_INDEX) {
+            const uint32_t* triangle = &indices[current * 3];
+            newIndices.insert(newIndices.end(), triangle, triangle + 3);
+            triangleAdded[current] = 1;
             
-            for (uint32_t i = 0; i < numTriangles; ++i) {
-                if (triangleAdded[i]) continue;
-                
-                uint32_t i0 = indices[i * 3];
-                uint32_t i1 = indices[i * 3 + 1];
-                uint32_t i2 = indices[i * 3 + 2];
-                
-                float score = 0.0f;
-                if (i0 < vertexCount) score += calculateVertexScore(i0);
-                if (i1 < vertexCount) score += calculateVertexScore(i1);
-                if (i2 < vertexCount) score += calculateVertexScore(i2);
+            // The triangle's vertices move to the front of the cache and lose the triangle
+            newCache.clear();
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t vertex = triangle[k];
+                if (vertex >= vertexCount || std::find(newCache.begin(), newCache.end(), vertex) != newCache.end()) {
+                    continue;
+                }
+                newCache.push_back(vertex);
+                deadEndStack.push_back(vertex);
                 
-                if (score > bestScore) {
-                    bestScore = score;
-                    bestTriangle = i;
+                uint32_t* vertexTriangles = &adjacency[offsets[vertex]];
+                uint32_t& count = liveTriangles[vertex];
+                for (uint32_t i = 0; i < count;) {
+                    if (vertexTriangles[i] == current) {
+                        vertexTriangles[i] = vertexTriangles[--count];
+                    } else {
+                        ++i;
+                    }
+                }
+            }
+            for (uint32_t vertex : cache) {
+                if (vertex != triangle[0] && vertex != triangle[1] && vertex != triangle[2]) {
+                    newCache.push_back(vertex);
                 }
             }
             
-            // Add best triangle
-            triangleAdded[bestTriangle] = true;
-            uint32_t i0 = indices[bestTriangle * 3];
-            uint32_t i1 = indices[bestTriangle * 3 + 1];
-            uint32_t i2 = indices[bestTriangle * 3 + 2];
-            
-            newIndices.push_back(i0);
-            newIndices.push_back(i1);
-            newIndices.push_back(i2);
-            
-            // Update cache
-            auto updateCache = [&](uint32_t vertex) {
-                if (vertex >= vertexCount) return;
+            // Rescore every vertex that entered, moved within or dropped out of the cache
+            for (size_t i = 0; i < newCache.size(); ++i) {
+                const uint32_t vertex = newCache[i];
+                const float score = scores.Score(i < cacheSize ? static_cast<uint32_t>(i) : cacheSize, liveTriangles[vertex]);
+                const float delta = score - vertexScores[vertex];
+                vertexScores[vertex] = score;
                 
-                // Remove vertex from cache if present
-                cache.erase(std::remove(cache.begin(), cache.end(), vertex), cache.end());
-                // Add to front
-                cache.insert(cache.begin(), vertex);
-                // Limit cache size
-                if (cache.size() > s_cacheSize) {
-                    cache.resize(s_cacheSize);
+                const uint32_t* vertexTriangles = &adjacency[offsets[vertex]];
+                for (uint32_t j = 0; j < liveTriangles[vertex]; ++j) {
+                    triangleScores[vertexTriangles[j]] += delta;
                 }
-            };
+            }
             
-            updateCache(i0);
-            updateCache(i1);
-            updateCache(i2);
+            // Next triangle: the best one touching the cache
+            newCache.resize(std::min<size_t>(newCache.size(), cacheSize));
+            std::swap(cache, newCache);
             
-            // Update vertex valences
-            auto updateVertex = [&](uint32_t vertex) {
-                if (vertex >= vertexCount) return;
-                
-                // Remove this triangle from vertex's triangle list
-                auto& triangles = vertexTriangles[vertex];
-                triangles.erase(std::remove(triangles.begin(), triangles.end(), bestTriangle), triangles.end());
-                vertexValence[vertex] = static_cast<uint32_t>(triangles.size());
-            };
+            current = INVALID_INDEX;
+            float bestScore = 0.0f;
+            for (uint32_t vertex : cache) {
+                const uint32_t* vertexTriangles = &adjacency[offsets[vertex]];
+                for (uint32_t j = 0; j < liveTriangles[vertex]; ++j) {
+                    if (current == INVALID_INDEX || triangleScores[vertexTriangles[j]] > bestScore) {
+                        current = vertexTriangles[j];
+                        bestScore = triangleScores[current];
+                    }
+                }
+            }
             
-            updateVertex(i0);
-            updateVertex(i1);
-            updateVertex(i2);
+            // Dead end: continue from a recently used vertex with triangles left, otherwise from
+            // the first triangle not emitted yet
+            while (current == INVALID_INDEX && !deadEndStack.empty()) {
+                const uint32_t vertex = deadEndStack.back();
+                deadEndStack.pop_back();
+                if (liveTriangles[vertex] > 0) current = adjacency[offsets[vertex]];
+            }
+            while (current == INVALID_INDEX && inputCursor < numTriangles) {
+                if (!triangleAdded[inputCursor]) current = static_cast<uint32_t>(inputCursor);
+                ++inputCursor;
+            }
         }
         
         return newIndices;
@@ -235,7 +493,7 @@ namespace GameEngine {
     // Overdraw optimization
     void MeshOptimizer::OptimizeOverdraw(Mesh& mesh, float threshold) {
         auto indices = mesh.GetIndices();
-        auto vertices = mesh.GetVertices();
+        auto vertices = mesh.DecodeVertices();
         
         if (indices.empty() || vertices.empty() || indices.size() < 3) {
             if (s_verboseLogging) {
@@ -259,57 +517,120 @@ namespace GameEngine {
     std::vector<uint32_t> MeshOptimizer::OptimizeOverdrawIndices(const std::vector<uint32_t>& indices,
                                                                  const std::vector<Vertex>& vertices,
                                                                  float threshold) {
-        struct Triangle {
-            uint32_t indices[3];
-            float depth;
-            Math::Vec3 normal;
+        const size_t numTriangles = indices.size() / 3;
+        if (numTriangles < 2 || vertices.empty()) {
+            return indices;
+        }
+        
+        // Sander et al. cluster sorting: split the cache-optimized order into clusters whose
+        // cache efficiency stays within threshold, then draw clusters facing away from the mesh
+        // center first since they are the most likely to occlude the rest
+        const uint32_t cacheSize = std::max(s_cacheSize, 3u);
+        std::vector<uint32_t> cacheTimestamps(vertices.size(), 0);
+        uint32_t timestamp = cacheSize + 1;
+        
+        // FIFO cache simulation: a vertex is cached until cacheSize newer vertices were loaded
+        auto triangleMisses = [&](size_t triangle) {
+            uint32_t misses = 0;
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t vertex = indices[triangle * 3 + k];
+                if (vertex >= vertices.size()) {
+                    ++misses;
+                } else if (timestamp - cacheTimestamps[vertex] > cacheSize) {
+                    cacheTimestamps[vertex] = timestamp++;
+                    ++misses;
+                }
+            }
+            return misses;
         };
+        auto resetCache = [&]() { timestamp += cacheSize + 1; };
         
-        std::vector<Triangle> triangles;
+        // Hard boundaries where the optimized order restarted (every vertex missed)
+        std::vector<uint32_t> hardBoundaries;
+        for (size_t t = 0; t < numTriangles; ++t) {
+            if (triangleMisses(t) == 3 || t == 0) {
+                hardBoundaries.push_back(static_cast<uint32_t>(t));
+            }
+        }
+        hardBoundaries.push_back(static_cast<uint32_t>(numTriangles));
         
-        // Calculate triangle depths and normals
-        for (size_t i = 0; i < indices.size(); i += 3) {
-            if (i + 2 < indices.size()) {
-                Triangle tri;
-                tri.indices[0] = indices[i];
-                tri.indices[1] = indices[i + 1];
-                tri.indices[2] = indices[i + 2];
-                
-                if (tri.indices[0] < vertices.size() && 
-                    tri.indices[1] < vertices.size() && 
-                    tri.indices[2] < vertices.size()) {
-                    
-                    const Math::Vec3& v0 = vertices[tri.indices[0]].position;
-                    const Math::Vec3& v1 = vertices[tri.indices[1]].position;
-                    const Math::Vec3& v2 = vertices[tri.indices[2]].position;
-                    
-                    // Calculate centroid depth
-                    tri.depth = (v0.z + v1.z + v2.z) / 3.0f;
-                    
-                    // Calculate normal
-                    Math::Vec3 edge1 = v1 - v0;
-                    Math::Vec3 edge2 = v2 - v0;
-                    tri.normal = glm::normalize(glm::cross(edge1, edge2));
-                    
-                    triangles.push_back(tri);
+        // Soft boundaries inside each run, once a cluster's ACMR gets within threshold of the run's
+        std::vector<uint32_t> clusters;
+        for (size_t h = 0; h + 1 < hardBoundaries.size(); ++h) {
+            const uint32_t start = hardBoundaries[h];
+            const uint32_t end = hardBoundaries[h + 1];
+            
+            resetCache();
+            uint32_t runMisses = 0;
+            for (uint32_t t = start; t < end; ++t) {
+                runMisses += triangleMisses(t);
+            }
+            const float clusterThreshold = threshold * static_cast<float>(runMisses) / (end - start);
+            
+            resetCache();
+            clusters.push_back(start);
+            uint32_t clusterMisses = 0;
+            uint32_t clusterTriangles = 0;
+            for (uint32_t t = start; t < end; ++t) {
+                clusterMisses += triangleMisses(t);
+                clusterTriangles++;
+                if (t + 1 < end && static_cast<float>(clusterMisses) <= clusterThreshold * clusterTriangles) {
+                    clusters.push_back(t + 1);
+                    resetCache();
+                    clusterMisses = 0;
+                    clusterTriangles = 0;
                 }
             }
         }
+        const size_t clusterCount = clusters.size();
+        clusters.push_back(static_cast<uint32_t>(numTriangles));
         
-        // Sort triangles by depth (back-to-front for better overdraw)
-        std::sort(triangles.begin(), triangles.end(),
-            [](const Triangle& a, const Triangle& b) {
-                return a.depth > b.depth; // Back-to-front
+        Math::Vec3 meshCenter(0.0f);
+        for (const auto& vertex : vertices) {
+            meshCenter += vertex.position;
+        }
+        meshCenter *= 1.0f / static_cast<float>(vertices.size());
+        
+        // Sort key: area-weighted cluster centroid offset along the cluster's average normal
+        std::vector<float> sortKeys(clusterCount, 0.0f);
+        for (size_t c = 0; c < clusterCount; ++c) {
+            Math::Vec3 centroid(0.0f);
+            Math::Vec3 normal(0.0f);
+            float area = 0.0f;
+            for (uint32_t t = clusters[c]; t < clusters[c + 1]; ++t) {
+                const uint32_t i0 = indices[t * 3], i1 = indices[t * 3 + 1], i2 = indices[t * 3 + 2];
+                if (i0 >= vertices.size() || i1 >= vertices.size() || i2 >= vertices.size()) continue;
+                
+                const Math::Vec3& v0 = vertices[i0].position;
+                const Math::Vec3& v1 = vertices[i1].position;
+                const Math::Vec3& v2 = vertices[i2].position;
+                const Math::Vec3 triangleNormal = glm::cross(v1 - v0, v2 - v0);
+                const float triangleArea = glm::length(triangleNormal);
+                
+                centroid += (v0 + v1 + v2) * (triangleArea / 3.0f);
+                normal += triangleNormal;
+                area += triangleArea;
+            }
+            
+            const float normalLength = glm::length(normal);
+            if (area > 0.0f && normalLength > 0.0f) {
+                sortKeys[c] = glm::dot(centroid * (1.0f / area) - meshCenter, normal * (1.0f / normalLength));
+            }
+        }
+        
+        std::vector<uint32_t> order(clusterCount);
+        for (size_t c = 0; c < clusterCount; ++c) {
+            order[c] = static_cast<uint32_t>(c);
+        }
+        std::stable_sort(order.begin(), order.end(),
+            [&sortKeys](uint32_t a, uint32_t b) {
+                return sortKeys[a] > sortKeys[b];
             });
         
-        // Rebuild indices
         std::vector<uint32_t> newIndices;
-        newIndices.reserve(triangles.size() * 3);
-        
-        for (const auto& tri : triangles) {
-            newIndices.push_back(tri.indices[0]);
-            newIndices.push_back(tri.indices[1]);
-            newIndices.push_back(tri.indices[2]);
+        newIndices.reserve(numTriangles * 3);
+        for (uint32_t c : order) {
+            newIndices.insert(newIndices.end(), indices.begin() + clusters[c] * 3, indices.begin() + clusters[c + 1] * 3);
         }
         
         return newIndices;
@@ -320,7 +641,7 @@ namespace GameEngine {
         if (ratio >= 1.0f) {
             // No simplification needed, return copy
             auto newMesh = std::make_shared<Mesh>();
-            newMesh->SetVertices(mesh.GetVertices());
+            newMesh->SetVertices(mesh.DecodeVertices());
             newMesh->SetIndices(mesh.GetIndices());
             return newMesh;
         }
@@ -329,7 +650,9 @@ namespace GameEngine {
             LOG_INFO("Simplifying mesh with ratio: " + std::to_string(ratio));
         }
         
-        return SimplifyQuadricErrorMetrics(mesh, ratio, 0.01f);
+        SimplificationOptions options;
+        options.targetTriangles = std::max(1u, static_cast<uint32_t>(mesh.GetIndices().size() / 3 * std::max(ratio, 0.0f)));
+        return Simplify(mesh, options);
     }
     
     std::shared_ptr<Mesh> MeshOptimizer::SimplifyToTargetError(const Mesh& mesh, float maxError) {
@@ -337,7 +660,9 @@ namespace GameEngine {
             LOG_INFO("Simplifying mesh to target error: " + std::to_string(maxError));
         }
         
-        return SimplifyQuadricErrorMetrics(mesh, 0.1f, maxError);
+        SimplificationOptions options;
+        options.maxError = maxError;
+        return Simplify(mesh, options);
     }
     
     std::shared_ptr<Mesh> MeshOptimizer::SimplifyToTriangleCount(const Mesh& mesh, uint32_t targetTriangles) {
@@ -345,7 +670,7 @@ namespace GameEngine {
         if (targetTriangles >= currentTriangles) {
             // No simplification needed
             auto newMesh = std::make_shared<Mesh>();
-            newMesh->SetVertices(mesh.GetVertices());
+            newMesh->SetVertices(mesh.DecodeVertices());
             newMesh->SetIndices(mesh.GetIndices());
             return newMesh;
         }
@@ -356,26 +681,407 @@ namespace GameEngine {
             LOG_INFO("Simplifying mesh to " + std::to_string(targetTriangles) + " triangles (ratio: " + std::to_string(ratio) + ")");
         }
         
-        return SimplifyEdgeCollapse(mesh, targetTriangles);
+        SimplificationOptions options;
+        options.targetTriangles = targetTriangles;
+        return Simplify(mesh, options);
+    }
+    
+    std::shared_ptr<Mesh> MeshOptimizer::Simplify(const Mesh& mesh, const SimplificationOptions& options) {
+        const auto vertices = mesh.DecodeVertices();
+        const auto& indices = mesh.GetIndices();
+        
+        if (vertices.empty() || indices.empty() || indices.size() < 3) {
+            return nullptr;
+        }
+        
+        float error = 0.0f;
+        auto newIndices = SimplifyIndices(vertices, indices, options, &error);
+        auto newVertices = CompactVertices(vertices, newIndices);
+        
+        if (s_verboseLogging) {
+            LOG_INFO("Simplified mesh: " + std::to_string(indices.size() / 3) + " -> " + std::to_string(newIndices.size() / 3) +
+                     " triangles, relative error " + std::to_string(error));
+        }
+        
+        auto newMesh = std::make_shared<Mesh>();
+        newMesh->SetVertices(std::move(newVertices));
+        newMesh->SetIndices(std::move(newIndices));
+        return newMesh;
+    }
+    
+    std::vector<uint32_t> MeshOptimizer::SimplifyIndices(const std::vector<Vertex>& vertices,
+                                                         const std::vector<uint32_t>& indices,
+                                                         const SimplificationOptions& options,
+                                                         float* resultError) {
+        if (resultError) {
+            *resultError = 0.0f;
+        }
+        
+        // Triangles with out-of-range indices are dropped
+        const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+        std::vector<uint32_t> triangles;
+        triangles.reserve(indices.size() - indices.size() % 3);
+        for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+            if (indices[i] < vertexCount && indices[i + 1] < vertexCount && indices[i + 2] < vertexCount) {
+                triangles.insert(triangles.end(), indices.begin() + i, indices.begin() + i + 3);
+            }
+        }
+        if (triangles.size() / 3 <= options.targetTriangles) {
+            return triangles;
+        }
+        
+        // Group vertices by exact position, then weld wedges of a position that only differ in
+        // attributes the options do not preserve; positions left with several wedges are seams
+        std::vector<uint32_t> positionId(vertexCount);
+        {
+            std::unordered_map<PositionKey, uint32_t, PositionKeyHash> positions;
+            positions.reserve(vertexCount);
+            for (uint32_t v = 0; v < vertexCount; ++v) {
+                positionId[v] = positions.emplace(PositionKey(vertices[v].position), v).first->second;
+            }
+        }
+        
+        std::vector<uint32_t> weld(vertexCount);
+        std::vector<uint32_t> nextWedge(vertexCount, INVALID_INDEX);
+        std::vector<uint32_t> wedgeCount(vertexCount, 0);
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            const uint32_t first = positionId[v];
+            weld[v] = v;
+            if (first == v) {
+                wedgeCount[v] = 1;
+                continue;
+            }
+            for (uint32_t wedge = first; wedge != INVALID_INDEX; wedge = nextWedge[wedge]) {
+                if (IsSameWedge(vertices[v], vertices[wedge], options)) {
+                    weld[v] = wedge;
+                    break;
+                }
+            }
+            if (weld[v] == v) {
+                nextWedge[v] = nextWedge[first];
+                nextWedge[first] = v;
+                wedgeCount[first]++;
+            }
+        }
+        
+        size_t writeIndex = 0;
+        for (size_t i = 0; i < triangles.size(); i += 3) {
+            const uint32_t a = weld[triangles[i]], b = weld[triangles[i + 1]], c = weld[triangles[i + 2]];
+            if (a != b && b != c && a != c) {
+                triangles[writeIndex++] = a;
+                triangles[writeIndex++] = b;
+                triangles[writeIndex++] = c;
+            }
+        }
+        triangles.resize(writeIndex);
+        const size_t triangleCount = triangles.size() / 3;
+        if (triangleCount <= options.targetTriangles) {
+            return triangles;
+        }
+        
+        // Directed edges between positions classify the topology: an edge without its reverse
+        // is on an open border, an edge used twice in the same direction is non-manifold
+        std::vector<uint64_t> edges;
+        edges.reserve(triangles.size());
+        for (size_t i = 0; i < triangles.size(); i += 3) {
+            for (size_t k = 0; k < 3; ++k) {
+                const uint64_t from = positionId[triangles[i + k]];
+                const uint64_t to = positionId[triangles[i + (k + 1) % 3]];
+                edges.push_back((from << 32) | to);
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+        auto isOpenEdge = [&edges](uint32_t from, uint32_t to) {
+            return !std::binary_search(edges.begin(), edges.end(), (static_cast<uint64_t>(to) << 32) | from);
+        };
+        
+        std::vector<uint32_t> borderOut(vertexCount, 0), borderIn(vertexCount, 0);
+        std::vector<uint8_t> nonManifold(vertexCount, 0);
+        for (size_t i = 0; i < edges.size(); ++i) {
+            const uint32_t from = static_cast<uint32_t>(edges[i] >> 32);
+            const uint32_t to = static_cast<uint32_t>(edges[i]);
+            if (i > 0 && edges[i] == edges[i - 1]) {
+                nonManifold[from] = nonManifold[to] = 1;
+            } else if (from != to && isOpenEdge(from, to)) {
+                borderOut[from]++;
+                borderIn[to]++;
+            }
+        }
+        
+        std::vector<SimplifyVertexKind> kind(vertexCount, SimplifyVertexKind::Manifold);
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            const uint32_t p = positionId[v];
+            if (wedgeCount[p] > 1 || nonManifold[p]) {
+                kind[v] = SimplifyVertexKind::Locked;
+            } else if (borderOut[p] > 0 || borderIn[p] > 0) {
+                const bool simpleBorder = borderOut[p] == 1 && borderIn[p] == 1;
+                kind[v] = options.preserveBoundaries || !simpleBorder ? SimplifyVertexKind::Locked : SimplifyVertexKind::Border;
+            }
+        }
+        
+        // Attribute vectors, with positions scaled so errors are relative to the mesh extent
+        Math::Vec3 minBounds = vertices[0].position;
+        Math::Vec3 maxBounds = vertices[0].position;
+        for (const auto& vertex : vertices) {
+            for (int i = 0; i < 3; ++i) {
+                minBounds[i] = std::min(minBounds[i], vertex.position[i]);
+                maxBounds[i] = std::max(maxBounds[i], vertex.position[i]);
+            }
+        }
+        const float extent = std::max({maxBounds.x - minBounds.x, maxBounds.y - minBounds.y, maxBounds.z - minBounds.z});
+        const float scale = extent > 0.0f ? 1.0f / extent : 1.0f;
+        const Math::Vec3 center = (minBounds + maxBounds) * 0.5f;
+        
+        std::vector<float> attributes(static_cast<size_t>(vertexCount) * QUADRIC_SIZE);
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            float* attribute = &attributes[static_cast<size_t>(v) * QUADRIC_SIZE];
+            const Vertex& vertex = vertices[v];
+            for (int i = 0; i < 3; ++i) {
+                attribute[i] = (vertex.position[i] - center[i]) * scale;
+                attribute[5 + i] = vertex.normal[i] * options.normalWeight;
+            }
+            attribute[3] = vertex.texCoords.x * options.uvWeight;
+            attribute[4] = vertex.texCoords.y * options.uvWeight;
+        }
+        auto attributesOf = [&attributes](uint32_t v) { return &attributes[static_cast<size_t>(v) * QUADRIC_SIZE]; };
+        auto positionOf = [&attributes](uint32_t v) {
+            const float* attribute = &attributes[static_cast<size_t>(v) * QUADRIC_SIZE];
+            return Math::Vec3(attribute[0], attribute[1], attribute[2]);
+        };
+        
+        // Area-weighted triangle quadrics, plus planes through open border edges perpendicular to
+        // the triangle so borders keep their shape
+        std::vector<Quadric> quadrics(vertexCount);
+        std::vector<std::vector<uint32_t>> vertexTriangles(vertexCount);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            const uint32_t* triangle = &triangles[t * 3];
+            for (size_t k = 0; k < 3; ++k) {
+                vertexTriangles[triangle[k]].push_back(static_cast<uint32_t>(t));
+            }
+            
+            const Math::Vec3 p0 = positionOf(triangle[0]);
+            const Math::Vec3 normal = glm::cross(positionOf(triangle[1]) - p0, positionOf(triangle[2]) - p0);
+            const float area = 0.5f * glm::length(normal);
+            if (area <= 0.0f) continue;
+            
+            const Quadric quadric = TriangleQuadric(attributesOf(triangle[0]), attributesOf(triangle[1]),
+                                                    attributesOf(triangle[2]), area);
+            for (size_t k = 0; k < 3; ++k) {
+                quadrics[triangle[k]].Add(quadric);
+            }
+            
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t from = triangle[k];
+                const uint32_t to = triangle[(k + 1) % 3];
+                if (!isOpenEdge(positionId[from], positionId[to])) continue;
+                
+                const Math::Vec3 edge = positionOf(to) - positionOf(from);
+                const Math::Vec3 planeNormal = glm::normalize(glm::cross(edge, normal));
+                const Quadric border = PlaneQuadric(planeNormal, -glm::dot(planeNormal, positionOf(from)),
+                                                    BORDER_WEIGHT * glm::dot(edge, edge));
+                quadrics[from].Add(border);
+                quadrics[to].Add(border);
+            }
+        }
+        
+        std::vector<uint8_t> triangleRemoved(triangleCount, 0);
+        size_t liveTriangles = triangleCount;
+        
+        // Edge from-to is on the border when exactly one live triangle holds both positions
+        auto isBorderEdge = [&](uint32_t from, uint32_t to) {
+            const uint32_t toPosition = positionId[to];
+            uint32_t shared = 0;
+            for (uint32_t t : vertexTriangles[from]) {
+                if (triangleRemoved[t]) continue;
+                const uint32_t* triangle = &triangles[t * 3];
+                if (positionId[triangle[0]] == toPosition || positionId[triangle[1]] == toPosition ||
+                    positionId[triangle[2]] == toPosition) {
+                    shared++;
+                }
+            }
+            return shared == 1;
+        };
+        
+        auto canMove = [&](uint32_t from, uint32_t to) {
+            return kind[from] == SimplifyVertexKind::Manifold ||
+                   (kind[from] == SimplifyVertexKind::Border && isBorderEdge(from, to));
+        };
+        
+        // Collapsing from onto to keeps to's attributes, so the cost is both quadrics at to
+        auto collapseError = [&](uint32_t from, uint32_t to) {
+            const float* target = attributesOf(to);
+            const float weight = quadrics[from].weight + quadrics[to].weight;
+            const float error = quadrics[from].Evaluate(target) + quadrics[to].Evaluate(target);
+            return weight > 0.0f ? std::max(error / weight, 0.0f) : 0.0f;
+        };
+        
+        // Triangles around from that survive the collapse must not flip or degenerate
+        auto flipsTriangle = [&](uint32_t from, uint32_t to) {
+            const Math::Vec3 target = positionOf(to);
+            for (uint32_t t : vertexTriangles[from]) {
+                if (triangleRemoved[t]) continue;
+                const uint32_t* triangle = &triangles[t * 3];
+                if (triangle[0] == to || triangle[1] == to || triangle[2] == to) continue;
+                
+                Math::Vec3 corners[3] = {positionOf(triangle[0]), positionOf(triangle[1]), positionOf(triangle[2])};
+                const Math::Vec3 before = glm::cross(corners[1] - corners[0], corners[2] - corners[0]);
+                for (size_t k = 0; k < 3; ++k) {
+                    if (triangle[k] == from) corners[k] = target;
+                }
+                const Math::Vec3 after = glm::cross(corners[1] - corners[0], corners[2] - corners[0]);
+                if (glm::dot(before, after) <= 0.0f) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        
+        // Each vertex is queued with its cheapest valid collapse; a collapse rescores the target
+        // and its whole one-ring, which covers every cost and flip test it can change
+        CollapseQueue queue(vertexCount);
+        std::vector<uint32_t> collapseTarget(vertexCount, INVALID_INDEX);
+        std::vector<std::pair<float, uint32_t>> choices;
+        auto gatherNeighbors = [&](uint32_t vertex, std::vector<uint32_t>& output) {
+            output.clear();
+            for (uint32_t t : vertexTriangles[vertex]) {
+                if (triangleRemoved[t]) continue;
+                for (size_t k = 0; k < 3; ++k) {
+                    const uint32_t neighbor = triangles[t * 3 + k];
+                    if (neighbor != vertex && std::find(output.begin(), output.end(), neighbor) == output.end()) {
+                        output.push_back(neighbor);
+                    }
+                }
+            }
+        };
+        std::vector<uint32_t> candidates;
+        auto rescore = [&](uint32_t from) {
+            collapseTarget[from] = INVALID_INDEX;
+            if (kind[from] != SimplifyVertexKind::Locked) {
+                gatherNeighbors(from, candidates);
+                choices.clear();
+                for (uint32_t to : candidates) {
+                    if (canMove(from, to)) {
+                        choices.push_back({collapseError(from, to), to});
+                    }
+                }
+                std::sort(choices.begin(), choices.end());
+                for (const auto& choice : choices) {
+                    if (!flipsTriangle(from, choice.second)) {
+                        collapseTarget[from] = choice.second;
+                        queue.Update(from, choice.first);
+                        return;
+                    }
+                }
+            }
+            queue.Remove(from);
+        };
+        for (uint32_t v = 0; v < vertexCount; ++v) {
+            if (!vertexTriangles[v].empty()) {
+                rescore(v);
+            }
+        }
+        
+        std::vector<uint32_t> neighbors;
+        const float maxError = options.maxError * options.maxError;
+        float reachedError = 0.0f;
+        
+        while (liveTriangles > options.targetTriangles && !queue.Empty()) {
+            const uint32_t from = queue.TopVertex();
+            const uint32_t to = collapseTarget[from];
+            const float error = queue.TopError();
+            if (error > maxError) {
+                break;
+            }
+            queue.Remove(from);
+            
+            // Triangles on the collapsed edge disappear, the rest of from's fan moves to to
+            quadrics[to].Add(quadrics[from]);
+            auto& toTriangles = vertexTriangles[to];
+            for (uint32_t t : vertexTriangles[from]) {
+                if (triangleRemoved[t]) continue;
+                uint32_t* triangle = &triangles[t * 3];
+                if (triangle[0] == to || triangle[1] == to || triangle[2] == to) {
+                    triangleRemoved[t] = 1;
+                    liveTriangles--;
+                    continue;
+                }
+                for (size_t k = 0; k < 3; ++k) {
+                    if (triangle[k] == from) triangle[k] = to;
+                }
+                toTriangles.push_back(t);
+            }
+            std::vector<uint32_t>().swap(vertexTriangles[from]);
+            toTriangles.erase(std::remove_if(toTriangles.begin(), toTriangles.end(),
+                [&triangleRemoved](uint32_t t) { return triangleRemoved[t] != 0; }), toTriangles.end());
+            reachedError = std::max(reachedError, error);
+            
+            rescore(to);
+            gatherNeighbors(to, neighbors);
+            for (uint32_t neighbor : neighbors) {
+                rescore(neighbor);
+            }
+        }
+        
+        std::vector<uint32_t> result;
+        result.reserve(liveTriangles * 3);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            if (!triangleRemoved[t]) {
+                result.insert(result.end(), triangles.begin() + t * 3, triangles.begin() + t * 3 + 3);
+            }
+        }
+        
+        if (resultError) {
+            *resultError = std::sqrt(reachedError);
+        }
+        return result;
     }
     
     // LOD generation
     std::vector<std::shared_ptr<Mesh>> MeshOptimizer::GenerateLODChain(const Mesh& mesh, const std::vector<float>& ratios) {
+        return GenerateLODChain(mesh, ratios, SimplificationOptions());
+    }
+    
+    std::vector<std::shared_ptr<Mesh>> MeshOptimizer::GenerateLODChain(const Mesh& mesh, const std::vector<float>& ratios,
+                                                                       const SimplificationOptions& options) {
         std::vector<std::shared_ptr<Mesh>> lodChain;
+        const auto vertices = mesh.DecodeVertices();
+        const auto& indices = mesh.GetIndices();
         
         // Add original mesh as LOD 0
         auto originalMesh = std::make_shared<Mesh>();
-        originalMesh->SetVertices(mesh.GetVertices());
-        originalMesh->SetIndices(mesh.GetIndices());
+        originalMesh->SetVertices(vertices);
+        originalMesh->SetIndices(indices);
         lodChain.push_back(originalMesh);
         
-        // Generate simplified LODs
+        std::vector<float> levelRatios;
         for (float ratio : ratios) {
             if (ratio > 0.0f && ratio < 1.0f) {
-                auto lodMesh = Simplify(mesh, ratio);
-                if (lodMesh && lodMesh->GetTriangleCount() > 0) {
-                    lodChain.push_back(lodMesh);
-                }
+                levelRatios.push_back(ratio);
+            }
+        }
+        
+        // Every level simplifies the original, so levels run in parallel into their own slots;
+        // the meshes are created afterwards on this thread since they own GL buffers
+        struct LODData {
+            std::vector<Vertex> vertices;
+            std::vector<uint32_t> indices;
+        };
+        std::vector<LODData> levels(levelRatios.size());
+        const uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+        
+        ParallelImportFor(levelRatios.size(), [&](size_t i) {
+            SimplificationOptions levelOptions = options;
+            levelOptions.targetTriangles = std::max(1u, static_cast<uint32_t>(triangleCount * levelRatios[i]));
+            levels[i].indices = SimplifyIndices(vertices, indices, levelOptions);
+            levels[i].vertices = CompactVertices(vertices, levels[i].indices);
+        });
+        
+        for (auto& level : levels) {
+            if (!level.indices.empty()) {
+                auto lodMesh = std::make_shared<Mesh>();
+                lodMesh->SetVertices(std::move(level.vertices));
+                lodMesh->SetIndices(std::move(level.indices));
+                lodChain.push_back(lodMesh);
             }
         }
         
@@ -414,9 +1120,232 @@ namespace GameEngine {
         return lodChain.back();
     }
     
+    // Meshlets
+    MeshletData MeshOptimizer::BuildMeshlets(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                             uint32_t maxVertices, uint32_t maxTriangles) {
+        MeshletData data;
+        data.maxVertices = std::clamp(maxVertices, 3u, 256u);
+        data.maxTriangles = std::max(maxTriangles, 1u);
+        
+        const size_t vertexCount = vertices.size();
+        const size_t triangleCount = indices.size() / 3;
+        
+        // Live triangles of vertex v: adjacency[offsets[v]] .. adjacency[offsets[v] + liveTriangles[v] - 1];
+        // emitted triangles are swapped out so growing a meshlet only looks at open ones
+        std::vector<uint8_t> emitted(triangleCount, 0);
+        std::vector<uint32_t> liveTriangles(vertexCount, 0);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            const uint32_t* triangle = &indices[t * 3];
+            if (triangle[0] >= vertexCount || triangle[1] >= vertexCount || triangle[2] >= vertexCount) {
+                emitted[t] = 1;
+                continue;
+            }
+            for (size_t k = 0; k < 3; ++k) liveTriangles[triangle[k]]++;
+        }
+        std::vector<uint32_t> offsets(vertexCount + 1, 0);
+        for (size_t v = 0; v < vertexCount; ++v) {
+            offsets[v + 1] = offsets[v] + liveTriangles[v];
+        }
+        std::vector<uint32_t> adjacency(offsets[vertexCount]);
+        {
+            std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t t = 0; t < triangleCount; ++t) {
+                if (emitted[t]) continue;
+                for (size_t k = 0; k < 3; ++k) adjacency[fill[indices[t * 3 + k]]++] = static_cast<uint32_t>(t);
+            }
+        }
+        
+        auto centroidOf = [&](uint32_t t) {
+            const uint32_t* triangle = &indices[t * 3];
+            return (vertices[triangle[0]].position + vertices[triangle[1]].position + vertices[triangle[2]].position) / 3.0f;
+        };
+        
+        std::vector<uint32_t> localIndex(vertexCount, INVALID_INDEX);
+        std::vector<uint32_t> meshletVertices;
+        std::vector<uint8_t> meshletTriangles;
+        Math::Vec3 centroidSum(0.0f);
+        size_t inputCursor = 0;
+        
+        auto emitTriangle = [&](uint32_t t) {
+            emitted[t] = 1;
+            for (size_t k = 0; k < 3; ++k) {
+                const uint32_t vertex = indices[t * 3 + k];
+                if (localIndex[vertex] == INVALID_INDEX) {
+                    localIndex[vertex] = static_cast<uint32_t>(meshletVertices.size());
+                    meshletVertices.push_back(vertex);
+                }
+                meshletTriangles.push_back(static_cast<uint8_t>(localIndex[vertex]));
+                
+                uint32_t* live = &adjacency[offsets[vertex]];
+                uint32_t& count = liveTriangles[vertex];
+                for (uint32_t i = 0; i < count; ++i) {
+                    if (live[i] == t) {
+                        live[i] = live[--count];
+                        break;
+                    }
+                }
+            }
+            centroidSum += centroidOf(t);
+        };
+        
+        auto finishMeshlet = [&]() {
+            Meshlet meshlet;
+            meshlet.vertexOffset = static_cast<uint32_t>(data.vertices.size());
+            meshlet.triangleOffset = static_cast<uint32_t>(data.triangles.size());
+            meshlet.vertexCount = static_cast<uint32_t>(meshletVertices.size());
+            meshlet.triangleCount = static_cast<uint32_t>(meshletTriangles.size() / 3);
+            
+            BoundingBox box(vertices[meshletVertices[0]].position, vertices[meshletVertices[0]].position);
+            for (uint32_t vertex : meshletVertices) {
+                box.Expand(vertices[vertex].position);
+            }
+            meshlet.bounds.center = box.GetCenter();
+            for (uint32_t vertex : meshletVertices) {
+                meshlet.bounds.radius = std::max(meshlet.bounds.radius, glm::length(vertices[vertex].position - meshlet.bounds.center));
+            }
+            
+            // The cone is only kept when every face normal is within ~84 degrees of the axis;
+            // its apex is moved back along the axis until it is behind every triangle plane
+            std::vector<std::pair<Math::Vec3, Math::Vec3>> planes;  // Unit normal, point
+            planes.reserve(meshlet.triangleCount);
+            Math::Vec3 normalSum(0.0f);
+            for (size_t i = 0; i < meshletTriangles.size(); i += 3) {
+                const Math::Vec3& p0 = vertices[meshletVertices[meshletTriangles[i]]].position;
+                const Math::Vec3& p1 = vertices[meshletVertices[meshletTriangles[i + 1]]].position;
+                const Math::Vec3& p2 = vertices[meshletVertices[meshletTriangles[i + 2]]].position;
+                const Math::Vec3 normal = glm::cross(p1 - p0, p2 - p0);
+                const float length = glm::length(normal);
+                if (length > 0.0f) {
+                    planes.push_back({normal / length, p0});
+                    normalSum += planes.back().first;
+                }
+            }
+            const float sumLength = glm::length(normalSum);
+            meshlet.coneApex = meshlet.bounds.center;
+            if (!planes.empty() && sumLength > 0.0f) {
+                meshlet.coneAxis = normalSum / sumLength;
+                float minDot = 1.0f;
+                for (const auto& plane : planes) {
+                    minDot = std::min(minDot, glm::dot(plane.first, meshlet.coneAxis));
+                }
+                if (minDot > 0.1f) {
+                    float apexDistance = -FLT_MAX;
+                    for (const auto& plane : planes) {
+                        apexDistance = std::max(apexDistance, glm::dot(meshlet.bounds.center - plane.second, plane.first) /
+                                                              glm::dot(meshlet.coneAxis, plane.first));
+                    }
+                    meshlet.coneApex = meshlet.bounds.center - meshlet.coneAxis * apexDistance;
+                    meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+                }
+            }
+            
+            data.meshlets.push_back(meshlet);
+            data.vertices.insert(data.vertices.end(), meshletVertices.begin(), meshletVertices.end());
+            data.triangles.insert(data.triangles.end(), meshletTriangles.begin(), meshletTriangles.end());
+            
+            for (uint32_t vertex : meshletVertices) {
+                localIndex[vertex] = INVALID_INDEX;
+            }
+            meshletVertices.clear();
+            meshletTriangles.clear();
+            centroidSum = Math::Vec3(0.0f);
+        };
+        
+        std::vector<uint32_t> previousVertices;
+        while (true) {
+            // Seed next to the previous meshlet so neighbouring clusters stay compact,
+            // otherwise continue with the next open triangle in index order
+            uint32_t seed = INVALID_INDEX;
+            for (uint32_t vertex : previousVertices) {
+                if (liveTriangles[vertex] > 0) {
+                    seed = adjacency[offsets[vertex]];
+                    break;
+                }
+            }
+            while (seed == INVALID_INDEX && inputCursor < triangleCount) {
+                if (!emitted[inputCursor]) seed = static_cast<uint32_t>(inputCursor);
+                inputCursor++;
+            }
+            if (seed == INVALID_INDEX) break;
+            
+            emitTriangle(seed);
+            
+            // Grow with the open triangle that adds the fewest vertices, breaking ties by
+            // distance to the meshlet's centroid
+            while (meshletTriangles.size() / 3 < data.maxTriangles) {
+                const Math::Vec3 center = centroidSum / static_cast<float>(meshletTriangles.size() / 3);
+                uint32_t best = INVALID_INDEX;
+                uint32_t bestExtra = 4;
+                float bestDistance = FLT_MAX;
+                for (size_t i = 0; i < meshletVertices.size() && bestExtra > 0; ++i) {
+                    const uint32_t vertex = meshletVertices[i];
+                    const uint32_t* live = &adjacency[offsets[vertex]];
+                    for (uint32_t j = 0; j < liveTriangles[vertex]; ++j) {
+                        const uint32_t t = live[j];
+                        const uint32_t* triangle = &indices[t * 3];
+                        const uint32_t extra = (localIndex[triangle[0]] == INVALID_INDEX) +
+                                               (localIndex[triangle[1]] == INVALID_INDEX) +
+                                               (localIndex[triangle[2]] == INVALID_INDEX);
+                        if (meshletVertices.size() + extra > data.maxVertices || extra > bestExtra) continue;
+                        const Math::Vec3 offset = centroidOf(t) - center;
+                        const float distance = glm::dot(offset, offset);
+                        if (extra < bestExtra || distance < bestDistance) {
+                            best = t;
+                            bestExtra = extra;
+                            bestDistance = distance;
+                        }
+                    }
+                }
+                if (best == INVALID_INDEX) break;
+                emitTriangle(best);
+            }
+            
+            previousVertices = meshletVertices;
+            finishMeshlet();
+        }
+        
+        if (s_verboseLogging) {
+            LOG_INFO("Built " + std::to_string(data.meshlets.size()) + " meshlets from " +
+                     std::to_string(triangleCount) + " triangles");
+        }
+        
+        return data;
+    }
+    
+    void MeshOptimizer::BuildMeshlets(Mesh& mesh, uint32_t maxVertices, uint32_t maxTriangles) {
+        mesh.SetMeshlets(BuildMeshlets(mesh.DecodeVertices(), mesh.GetIndices(), maxVertices, maxTriangles));
+    }
+    
+    size_t MeshOptimizer::CullMeshlets(const MeshletData& meshlets, const Frustum& frustum, const Math::Vec3& viewerPosition,
+                                       std::vector<uint32_t>& visibleIndices, bool backfaceCulling) {
+        visibleIndices.clear();
+        size_t visibleCount = 0;
+        
+        for (const auto& meshlet : meshlets.meshlets) {
+            if (!frustum.Intersects(meshlet.bounds)) {
+                continue;
+            }
+            if (backfaceCulling && meshlet.coneCutoff < 1.0f) {
+                const Math::Vec3 fromViewer = meshlet.coneApex - viewerPosition;
+                if (glm::dot(fromViewer, meshlet.coneAxis) >= meshlet.coneCutoff * glm::length(fromViewer)) {
+                    continue;
+                }
+            }
+            
+            const uint32_t* localVertices = &meshlets.vertices[meshlet.vertexOffset];
+            const uint8_t* triangles = &meshlets.triangles[meshlet.triangleOffset];
+            for (uint32_t i = 0; i < meshlet.triangleCount * 3; ++i) {
+                visibleIndices.push_back(localVertices[triangles[i]]);
+            }
+            visibleCount++;
+        }
+        
+        return visibleCount;
+    }
+    
     // Vertex processing
     void MeshOptimizer::RemoveDuplicateVertices(Mesh& mesh, float epsilon) {
-        auto vertices = mesh.GetVertices();
+        auto vertices = mesh.DecodeVertices();
         auto indices = mesh.GetIndices();
         
         if (vertices.empty()) return;
@@ -424,18 +1353,44 @@ namespace GameEngine {
         std::vector<Vertex> uniqueVertices;
         std::vector<uint32_t> vertexRemap(vertices.size());
         
+        // Unique vertices are bucketed by epsilon-sized position cells, so a vertex only needs
+        // comparing against the neighboring cells; the first matching unique vertex still wins
+        std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+        const float cellSize = epsilon > 0.0f ? epsilon : 1.0f;
+        auto cellCoordinate = [cellSize](float value) -> int64_t {
+            const float scaled = value / cellSize;
+            return scaled > -1e15f && scaled < 1e15f ? static_cast<int64_t>(std::floor(scaled)) : 0;
+        };
+        auto cellKey = [](int64_t x, int64_t y, int64_t z) {
+            return (static_cast<uint64_t>(x) * 73856093u) ^ (static_cast<uint64_t>(y) * 19349663u) ^
+                   (static_cast<uint64_t>(z) * 83492791u);
+        };
+        
         for (size_t i = 0; i < vertices.size(); ++i) {
-            bool found = false;
-            for (size_t j = 0; j < uniqueVertices.size(); ++j) {
-                if (vertices[i].IsNearlyEqual(uniqueVertices[j], epsilon)) {
-                    vertexRemap[i] = static_cast<uint32_t>(j);
-                    found = true;
-                    break;
+            const Math::Vec3& position = vertices[i].position;
+            const int64_t x = cellCoordinate(position.x), y = cellCoordinate(position.y), z = cellCoordinate(position.z);
+            
+            uint32_t match = INVALID_INDEX;
+            for (int64_t dx = -1; dx <= 1; ++dx) {
+                for (int64_t dy = -1; dy <= 1; ++dy) {
+                    for (int64_t dz = -1; dz <= 1; ++dz) {
+                        auto cell = cells.find(cellKey(x + dx, y + dy, z + dz));
+                        if (cell == cells.end()) continue;
+                        for (uint32_t j : cell->second) {
+                            if (j < match && vertices[i].IsNearlyEqual(uniqueVertices[j], epsilon)) {
+                                match = j;
+                                break;
+                            }
+                        }
+                    }
                 }
             }
             
-            if (!found) {
+            if (match != INVALID_INDEX) {
+                vertexRemap[i] = match;
+            } else {
                 vertexRemap[i] = static_cast<uint32_t>(uniqueVertices.size());
+                cells[cellKey(x, y, z)].push_back(vertexRemap[i]);
                 uniqueVertices.push_back(vertices[i]);
             }
         }
@@ -465,7 +1420,7 @@ namespace GameEngine {
     }
     
     void MeshOptimizer::FlipNormals(Mesh& mesh) {
-        auto vertices = mesh.GetVertices();
+        auto vertices = mesh.DecodeVertices();
         for (auto& vertex : vertices) {
             vertex.normal = -vertex.normal;
         }
@@ -480,7 +1435,7 @@ namespace GameEngine {
     MeshAnalysis MeshOptimizer::AnalyzeMesh(const Mesh& mesh) {
         MeshAnalysis analysis;
         
-        const auto& vertices = mesh.GetVertices();
+        const auto vertices = mesh.DecodeVertices();
         const auto& indices = mesh.GetIndices();
         
         analysis.vertexCount = static_cast<uint32_t>(vertices.size());
@@ -594,7 +1549,7 @@ namespace GameEngine {
     std::vector<std::string> MeshOptimizer::GetMeshIssues(const Mesh& mesh) {
         std::vector<std::string> issues;
         
-        const auto& vertices = mesh.GetVertices();
+        const auto vertices = mesh.DecodeVertices();
         const auto& indices = mesh.GetIndices();
         
         if (vertices.empty()) {
@@ -667,7 +1622,7 @@ namespace GameEngine {
         
         // Create copy for comparison
         Mesh originalMesh;
-        originalMesh.SetVertices(mesh.GetVertices());
+        originalMesh.SetVertices(mesh.DecodeVertices());
         originalMesh.SetIndices(mesh.GetIndices());
         
         // Perform optimizations
@@ -725,7 +1680,12 @@ namespace GameEngine {
         }
         
         // Generate LOD chain
-        auto lodChain = GenerateLODChain(mesh, config.simplificationRatios);
+        SimplificationOptions options;
+        options.maxError = config.maxError;
+        options.preserveBoundaries = config.preserveBoundaries;
+        options.preserveUVSeams = config.preserveUVSeams;
+        options.preserveNormalSeams = config.preserveNormalSeams;
+        auto lodChain = GenerateLODChain(mesh, config.simplificationRatios, options);
         
         // Optimize each LOD level
         for (auto& lodMesh : lodChain) {
@@ -792,7 +1752,7 @@ namespace GameEngine {
     }
     
     float MeshOptimizer::CalculateACMR(const std::vector<uint32_t>& indices, size_t cacheSize) {
-        if (indices.empty()) return 0.0f;
+        if (indices.size() < 3) return 0.0f;
         
         VertexCacheSimulator cache(static_cast<uint32_t>(cacheSize));
         
@@ -800,13 +1760,19 @@ namespace GameEngine {
             cache.AccessVertex(index);
         }
         
-        return cache.GetCacheMissRatio();
+        return static_cast<float>(cache.cacheMisses) / static_cast<float>(indices.size() / 3);
     }
     
     float MeshOptimizer::CalculateATVR(const std::vector<uint32_t>& indices, size_t vertexCount) {
         if (indices.empty() || vertexCount == 0) return 0.0f;
         
-        return static_cast<float>(indices.size()) / static_cast<float>(vertexCount);
+        VertexCacheSimulator cache(s_cacheSize);
+        
+        for (uint32_t index : indices) {
+            cache.AccessVertex(index);
+        }
+        
+        return static_cast<float>(cache.cacheMisses) / static_cast<float>(vertexCount);
     }
     
     float MeshOptimizer::CalculateOverdrawRatio(const std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices) {
@@ -906,70 +1872,6 @@ namespace GameEngine {
         return area < threshold;
     }
     
-    // Simplification algorithms
-    std::shared_ptr<Mesh> MeshOptimizer::SimplifyQuadricErrorMetrics(const Mesh& mesh, float ratio, float maxError) {
-        // Simplified implementation of quadric error metrics
-        // This is a basic version - a full implementation would be much more complex
-        
-        auto vertices = mesh.GetVertices();
-        auto indices = mesh.GetIndices();
-        
-        if (vertices.empty() || indices.empty() || indices.size() < 3) {
-            return nullptr;
-        }
-        
-        uint32_t targetTriangles = static_cast<uint32_t>(indices.size() / 3 * ratio);
-        if (targetTriangles == 0) targetTriangles = 1;
-        
-        // For now, use simple edge collapse
-        return SimplifyEdgeCollapse(mesh, targetTriangles);
-    }
-    
-    std::shared_ptr<Mesh> MeshOptimizer::SimplifyEdgeCollapse(const Mesh& mesh, uint32_t targetTriangles) {
-        // Simplified edge collapse implementation
-        // This is a basic version for demonstration purposes
-        
-        auto vertices = mesh.GetVertices();
-        auto indices = mesh.GetIndices();
-        
-        if (vertices.empty() || indices.empty() || indices.size() < 3) {
-            return nullptr;
-        }
-        
-        uint32_t currentTriangles = static_cast<uint32_t>(indices.size() / 3);
-        if (targetTriangles >= currentTriangles) {
-            // No simplification needed
-            auto newMesh = std::make_shared<Mesh>();
-            newMesh->SetVertices(vertices);
-            newMesh->SetIndices(indices);
-            return newMesh;
-        }
-        
-        // Simple decimation: remove every nth triangle
-        uint32_t removeCount = currentTriangles - targetTriangles;
-        uint32_t step = currentTriangles / removeCount;
-        if (step == 0) step = 1;
-        
-        std::vector<uint32_t> newIndices;
-        for (uint32_t i = 0; i < currentTriangles; ++i) {
-            if (i % step != 0 || newIndices.size() / 3 >= targetTriangles) {
-                // Keep this triangle
-                if ((i * 3 + 2) < indices.size()) {
-                    newIndices.push_back(indices[i * 3]);
-                    newIndices.push_back(indices[i * 3 + 1]);
-                    newIndices.push_back(indices[i * 3 + 2]);
-                }
-            }
-        }
-        
-        auto newMesh = std::make_shared<Mesh>();
-        newMesh->SetVertices(vertices);
-        newIndices.resize((targetTriangles * 3));
-        newMesh->SetIndices(newIndices);
-        
-        return newMesh;
-    }
-    
     // Vertex cache simulator implementation
     bool MeshOptimizer::VertexCacheSimulator::AccessVertex(uint32_t vertex) {
         totalAccesses++;
@@ -1005,87 +1907,4 @@ namespace GameEngine {
         totalAccesses = 0;
     }
     
-    // Vertex scoring for Tom Forsyth's algorithm
-    float MeshOptimizer::CalculateVertexScore(uint32_t vertex, const std::vector<uint32_t>& cache, 
-                                             const std::vector<uint32_t>& valence, uint32_t cacheSize) {
-        const float CACHE_DECAY_POWER = 1.5f;
-        const float LAST_TRI_SCORE = 0.75f;
-        const float VALENCE_BOOST_SCALE = 2.0f;
-        const float VALENCE_BOOST_POWER = 0.5f;
-        
-        if (vertex >= valence.size() || valence[vertex] == 0) {
-            return -1.0f;
-        }
-        
-        float score = 0.0f;
-        
-        // Cache position score
-        auto cacheIt = std::find(cache.begin(), cache.end(), vertex);
-        if (cacheIt != cache.end()) {
-            uint32_t cachePos = static_cast<uint32_t>(std::distance(cache.begin(), cacheIt));
-            if (cachePos < 3) {
-                score = LAST_TRI_SCORE;
-            } else {
-                const float scaler = 1.0f / (cacheSize - 3);
-                score = 1.0f - (cachePos - 3) * scaler;
-                score = std::pow(score, CACHE_DECAY_POWER);
-            }
-        }
-        
-        // Valence score
-        float valenceScore = std::pow(static_cast<float>(valence[vertex]), -VALENCE_BOOST_POWER);
-        score += VALENCE_BOOST_SCALE * valenceScore;
-        
-        return score;
-    }
-    
-    // Utility functions for quadric error metrics (simplified)
-    Math::Mat4 MeshOptimizer::CalculateQuadricMatrix(const Math::Vec3& v0, const Math::Vec3& v1, const Math::Vec3& v2) {
-        // Calculate plane equation for triangle
-        Math::Vec3 edge1 = v1 - v0;
-        Math::Vec3 edge2 = v2 - v0;
-        Math::Vec3 normal = glm::normalize(glm::cross(edge1, edge2));
-        float d = -glm::dot(normal, v0);
-        
-        // Create quadric matrix from plane equation ax + by + cz + d = 0
-        Math::Mat4 quadric(0.0f);
-        quadric[0][0] = normal.x * normal.x;
-        quadric[0][1] = normal.x * normal.y;
-        quadric[0][2] = normal.x * normal.z;
-        quadric[0][3] = normal.x * d;
-        
-        quadric[1][0] = normal.y * normal.x;
-        quadric[1][1] = normal.y * normal.y;
-        quadric[1][2] = normal.y * normal.z;
-        quadric[1][3] = normal.y * d;
-        
-        quadric[2][0] = normal.z * normal.x;
-        quadric[2][1] = normal.z * normal.y;
-        quadric[2][2] = normal.z * normal.z;
-        quadric[2][3] = normal.z * d;
-        
-        quadric[3][0] = d * normal.x;
-        quadric[3][1] = d * normal.y;
-        quadric[3][2] = d * normal.z;
-        quadric[3][3] = d * d;
-        
-        return quadric;
-    }
-    
-    float MeshOptimizer::CalculateEdgeCollapseError(const Math::Vec3& v0, const Math::Vec3& v1, const Math::Mat4& quadric) {
-        // Calculate error for collapsing edge to midpoint
-        Math::Vec3 midpoint = (v0 + v1) * 0.5f;
-        Math::Vec4 point(midpoint, 1.0f);
-        
-        // Error = point^T * quadric * point
-        Math::Vec4 temp = quadric * point;
-        return glm::dot(point, temp);
-    }
-    
-    bool MeshOptimizer::CanCollapseEdge(uint32_t v0, uint32_t v1, const std::vector<Vertex>& vertices, 
-                                       const std::vector<uint32_t>& indices) {
-        // Simple check - in a full implementation, this would check for topology preservation
-        return v0 < vertices.size() && v1 < vertices.size() && v0 != v1;
-    }
-    
 } // namespace GameEngine
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Graphics/ShaderProfiler.h"
 #include "Core/Logger.h"
+#include "Core/Profiler.h"
 #include <glad/glad.h>
 #include <algorithm>
 #include <sstream>
@@ -55,20 +56,33 @@ namespace GameEngine {
     void ShaderProfiler::BeginShaderTiming(const std::string& shaderName) {
         if (!m_profilingEnabled) return;
         
-        m_timingStart[shaderName] = std::chrono::high_resolution_clock::now();
+        ShaderTiming& timing = m_timingStart[shaderName];
+        timing.start = std::chrono::high_resolution_clock::now();
+        timing.running = true;
     }
 
     void ShaderProfiler::EndShaderTiming(const std::string& shaderName) {
         if (!m_profilingEnabled) return;
         
         auto it = m_timingStart.find(shaderName);
-        if (it != m_timingStart.end()) {
+        if (it != m_timingStart.end() && it->second.running) {
+            ShaderTiming& timing = it->second;
             auto endTime = std::chrono::high_resolution_clock::now();
-            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - it->second);
+            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - timing.start);
             double frameTimeMs = duration.count() / 1000.0;
             
             RecordFrameTime(shaderName, frameTimeMs);
-            m_timingStart.erase(it);
+
+            // Same span on the engine timeline
+            Profiler& profiler = Profiler::GetInstance();
+            if (profiler.IsEnabled()) {
+                if (!timing.profileName) {
+                    timing.profileName = profiler.InternName(shaderName);
+                }
+                const auto durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - timing.start).count();
+                profiler.RecordZoneEndingNow(timing.profileName, "Shader", static_cast<uint64_t>(durationNs));
+            }
+            timing.running = false;
         }
     }
 
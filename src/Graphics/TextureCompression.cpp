@@ -1,11 +1,15 @@
 #include "Graphics/TextureCompression.h"
+#include "Graphics/BlockCompression.h"
 #include "Graphics/Texture.h"
+#include "Resource/TextureLoader.h"
 #include "Core/Logger.h"
+#include "Core/JobSystem.h"
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 #include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <unordered_set>
 
 namespace GameEngine {
     TextureCompression& TextureCompression::GetInstance() {
@@ -13,6 +17,17 @@ namespace GameEngine {
         return instance;
     }
 
+    TextureCompression::TextureCompression() : m_asyncBatches(std::make_unique<JobGroup>()) {
+    }
+
+    TextureCompression::~TextureCompression() = default;
+
+    void TextureCompression::SetJobSystem(JobSystem* jobSystem) {
+        // Batches already queued belong to the old JobSystem
+        WaitForAsyncCompression();
+        m_jobSystem = jobSystem;
+    }
+
     bool TextureCompression::Initialize() {
         if (m_initialized.load()) {
             LOG_WARNING("TextureCompression already initialized");
@@ -51,6 +66,8 @@ namespace GameEngine {
 
         LOG_INFO("Shutting down TextureCompression");
 
+        WaitForAsyncCompression();
+
         std::lock_guard<std::mutex> lock(m_compressionMutex);
         
         m_supportedFormats.clear();
@@ -82,14 +99,14 @@ namespace GameEngine {
             return result;
         }
 
-        std::lock_guard<std::mutex> lock(m_compressionMutex);
-
         auto startTime = std::chrono::high_resolution_clock::now();
 
         CompressionResult result;
-        result.originalSize = width * height * channels;
+        const size_t originalSize = static_cast<size_t>(width) * height * channels;
+        result.originalSize = originalSize;
 
-        // Determine compression format
+        // Determine compression format; encoding itself runs without the lock so batches and
+        // callers on other threads compress concurrently
         CompressionFormat format = settings.format;
         if (format == CompressionFormat::None) {
             format = GetBestFormat(width, height, channels, settings.quality);
@@ -117,11 +134,16 @@ namespace GameEngine {
                 case CompressionFormat::DXT1:
                 case CompressionFormat::DXT3:
                 case CompressionFormat::DXT5:
-                    result = CompressWithDXT(data, width, height, channels, format, settings.quality);
+                    result = CompressWithDXT(data, width, height, channels, format, settings);
+                    break;
+
+                case CompressionFormat::BC4:
+                case CompressionFormat::BC5:
+                    result = CompressWithRGTC(data, width, height, channels, format, settings);
                     break;
                     
                 case CompressionFormat::BC7:
-                    result = CompressWithBC7(data, width, height, channels, settings.quality);
+                    result = CompressWithBC7(data, width, height, channels, settings);
                     break;
                     
                 case CompressionFormat::ETC2_RGB:
@@ -143,6 +165,7 @@ namespace GameEngine {
             result.success = false;
             result.errorMessage = "Compression failed: " + std::string(e.what());
         }
+        result.originalSize = originalSize;
 
         // Calculate compression time
         auto endTime = std::chrono::high_resolution_clock::now();
@@ -181,34 +204,60 @@ namespace GameEngine {
                                                  const CompressionSettings& settings,
                                                  CompressionProgressCallback progressCallback,
                                                  CompressionCompleteCallback completeCallback) {
-        // This is a simplified synchronous implementation
-        // In a full implementation, this would use thread pools
-        
-        for (size_t i = 0; i < textureNames.size(); ++i) {
-            const std::string& textureName = textureNames[i];
-            
-            if (progressCallback) {
-                float progress = static_cast<float>(i) / static_cast<float>(textureNames.size());
-                progressCallback(textureName, progress);
-            }
-            
-            // Note: This would need actual texture data to compress
-            // For now, just simulate the callback
-            if (completeCallback) {
+        auto batch = [this, textureNames, settings, progressCallback, completeCallback]() {
+            TextureLoader loader;
+
+            for (size_t i = 0; i < textureNames.size(); ++i) {
+                const std::string& textureName = textureNames[i];
+
+                if (progressCallback) {
+                    float progress = static_cast<float>(i) / static_cast<float>(textureNames.size());
+                    progressCallback(textureName, progress);
+                }
+
                 CompressionResult result;
-                result.success = false;
-                result.errorMessage = "Async compression not fully implemented";
-                completeCallback(textureName, result);
+                TextureLoader::ImageData image = loader.LoadImageData(textureName);
+                if (image.isValid) {
+                    result = CompressTexture(textureName, image.data, static_cast<uint32_t>(image.width),
+                                             static_cast<uint32_t>(image.height), static_cast<uint32_t>(image.channels),
+                                             settings);
+                } else {
+                    result.success = false;
+                    result.errorMessage = "Failed to load image: " + textureName;
+                    UpdateStats(result);
+                }
+
+                if (completeCallback) {
+                    completeCallback(textureName, result);
+                }
+            }
+
+            if (progressCallback) {
+                progressCallback("", 1.0f); // Signal completion
             }
+        };
+
+        if (!m_jobSystem) {
+            batch();
+            return;
         }
-        
-        if (progressCallback) {
-            progressCallback("", 1.0f); // Signal completion
+        // Background priority keeps long batches out of the frame's way; the rows of each image
+        // still run as normal jobs, so a started image finishes promptly
+        m_jobSystem->Submit(std::move(batch), *m_asyncBatches, JobPriority::Background);
+    }
+
+    void TextureCompression::WaitForAsyncCompression() {
+        if (m_jobSystem) {
+            m_jobSystem->Wait(*m_asyncBatches);
         }
     }
 
     bool TextureCompression::IsFormatSupported(CompressionFormat format) const {
         std::lock_guard<std::mutex> lock(m_compressionMutex);
+        return IsFormatSupportedLocked(format);
+    }
+
+    bool TextureCompression::IsFormatSupportedLocked(CompressionFormat format) const {
         return std::find(m_supportedFormats.begin(), m_supportedFormats.end(), format) != m_supportedFormats.end();
     }
 
@@ -222,28 +271,31 @@ namespace GameEngine {
         std::lock_guard<std::mutex> lock(m_compressionMutex);
 
         // Simple heuristic for format selection
-        if (channels == 3) {
+        if (channels == 1 && IsFormatSupportedLocked(CompressionFormat::BC4)) {
+            // Single-channel masks and height maps
+            return CompressionFormat::BC4;
+        } else if (channels == 3) {
             // RGB textures
-            if (IsFormatSupported(CompressionFormat::BC7)) {
+            if (IsFormatSupportedLocked(CompressionFormat::BC7)) {
                 return CompressionFormat::BC7;
-            } else if (IsFormatSupported(CompressionFormat::DXT1)) {
+            } else if (IsFormatSupportedLocked(CompressionFormat::DXT1)) {
                 return CompressionFormat::DXT1;
-            } else if (IsFormatSupported(CompressionFormat::ETC2_RGB)) {
+            } else if (IsFormatSupportedLocked(CompressionFormat::ETC2_RGB)) {
                 return CompressionFormat::ETC2_RGB;
             }
-        } else if (channels == 4) {
-            // RGBA textures
-            if (quality == CompressionQuality::Ultra && IsFormatSupported(CompressionFormat::BC7)) {
+        } else if (channels == 2 || channels == 4) {
+            // RGBA and grey + alpha textures
+            if (quality == CompressionQuality::Ultra && IsFormatSupportedLocked(CompressionFormat::BC7)) {
                 return CompressionFormat::BC7;
-            } else if (IsFormatSupported(CompressionFormat::DXT5)) {
+            } else if (IsFormatSupportedLocked(CompressionFormat::DXT5)) {
                 return CompressionFormat::DXT5;
-            } else if (IsFormatSupported(CompressionFormat::ETC2_RGBA)) {
+            } else if (IsFormatSupportedLocked(CompressionFormat::ETC2_RGBA)) {
                 return CompressionFormat::ETC2_RGBA;
             }
         }
 
         // Fallback to ASTC if available
-        if (IsFormatSupported(CompressionFormat::ASTC_4x4)) {
+        if (IsFormatSupportedLocked(CompressionFormat::ASTC_4x4)) {
             return CompressionFormat::ASTC_4x4;
         }
 
@@ -263,9 +315,11 @@ namespace GameEngine {
     size_t TextureCompression::EstimateCompressedSize(uint32_t width, uint32_t height, CompressionFormat format) const {
         switch (format) {
             case CompressionFormat::DXT1:
+            case CompressionFormat::BC4:
                 return (width * height) / 2; // 4 bits per pixel
             case CompressionFormat::DXT3:
             case CompressionFormat::DXT5:
+            case CompressionFormat::BC5:
                 return width * height; // 8 bits per pixel
             case CompressionFormat::BC7:
                 return width * height; // 8 bits per pixel
@@ -296,6 +350,8 @@ namespace GameEngine {
             case CompressionFormat::DXT1: return "DXT1";
             case CompressionFormat::DXT3: return "DXT3";
             case CompressionFormat::DXT5: return "DXT5";
+            case CompressionFormat::BC4: return "BC4";
+            case CompressionFormat::BC5: return "BC5";
             case CompressionFormat::BC7: return "BC7";
             case CompressionFormat::ETC2_RGB: return "ETC2_RGB";
             case CompressionFormat::ETC2_RGBA: return "ETC2_RGBA";
@@ -308,33 +364,55 @@ namespace GameEngine {
     void TextureCompression::DetectSupportedFormats() {
         m_supportedFormats.clear();
 
-        // Check for S3TC (DXT) support
-        if (gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-            // For now, assume basic formats are supported
-            // In a real implementation, you'd check GL_EXTENSIONS
+        // Without a current context there is nothing to query
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+            LOG_WARNING("No OpenGL context - no compressed texture formats available");
+            return;
+        }
+
+        GLint majorVersion = 0, minorVersion = 0;
+        glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
+        glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
+        auto hasVersion = [&](GLint major, GLint minor) {
+            return majorVersion > major || (majorVersion == major && minorVersion >= minor);
+        };
+
+        std::unordered_set<std::string> extensions;
+        GLint extensionCount = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+        for (GLint i = 0; i < extensionCount; ++i) {
+            if (const GLubyte* extension = glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i))) {
+                extensions.insert(reinterpret_cast<const char*>(extension));
+            }
+        }
+        auto hasExtension = [&](const char* name) { return extensions.count(name) > 0; };
+
+        // S3TC (DXT) never became core
+        if (hasExtension("GL_EXT_texture_compression_s3tc")) {
             m_supportedFormats.push_back(CompressionFormat::DXT1);
             m_supportedFormats.push_back(CompressionFormat::DXT3);
             m_supportedFormats.push_back(CompressionFormat::DXT5);
         }
 
-        // Check for BPTC (BC7) support - requires OpenGL 4.2+
-        GLint majorVersion, minorVersion;
-        glGetIntegerv(GL_MAJOR_VERSION, &majorVersion);
-        glGetIntegerv(GL_MINOR_VERSION, &minorVersion);
-        
-        if (majorVersion > 4 || (majorVersion == 4 && minorVersion >= 2)) {
+        // RGTC (BC4/BC5) is core since OpenGL 3.0
+        if (hasVersion(3, 0) || hasExtension("GL_ARB_texture_compression_rgtc")) {
+            m_supportedFormats.push_back(CompressionFormat::BC4);
+            m_supportedFormats.push_back(CompressionFormat::BC5);
+        }
+
+        // BPTC (BC7) is core since OpenGL 4.2
+        if (hasVersion(4, 2) || hasExtension("GL_ARB_texture_compression_bptc")) {
             m_supportedFormats.push_back(CompressionFormat::BC7);
         }
 
-        // Check for ETC2 support (OpenGL 4.3+)
-        if (majorVersion > 4 || (majorVersion == 4 && minorVersion >= 3)) {
+        // ETC2 is core since OpenGL 4.3
+        if (hasVersion(4, 3) || hasExtension("GL_ARB_ES3_compatibility")) {
             m_supportedFormats.push_back(CompressionFormat::ETC2_RGB);
             m_supportedFormats.push_back(CompressionFormat::ETC2_RGBA);
         }
 
-        // Check for ASTC support - simplified check
-        // In a real implementation, you'd check for the specific extension
-        if (majorVersion >= 4) {
+        // ASTC is only an extension on desktop GL
+        if (hasExtension("GL_KHR_texture_compression_astc_ldr")) {
             m_supportedFormats.push_back(CompressionFormat::ASTC_4x4);
             m_supportedFormats.push_back(CompressionFormat::ASTC_8x8);
         }
@@ -344,25 +422,55 @@ namespace GameEngine {
 
     CompressionResult TextureCompression::CompressWithDXT(const void* data, uint32_t width, uint32_t height, 
                                                         uint32_t channels, CompressionFormat format, 
-                                                        CompressionQuality quality) {
+                                                        const CompressionSettings& settings) {
         CompressionResult result;
-        
-        // This is a placeholder implementation
-        // Real DXT compression would require a library like squish or DirectXTex
-        result.success = false;
-        result.errorMessage = "DXT compression not implemented (requires external library)";
+
+        // DXT1 keeps 1-bit alpha for inputs that have an alpha channel
+        const size_t maxThreads = settings.enableMultithreading ? 0 : 1;
+        result.success = BlockCompression::CompressImage(static_cast<const uint8_t*>(data), width, height, channels,
+                                                         format, settings.quality, result.compressedData, maxThreads,
+                                                         m_jobSystem);
+        if (result.success) {
+            result.compressedSize = result.compressedData.size();
+        } else {
+            result.errorMessage = "DXT compression failed: unsupported channel count";
+        }
         
         return result;
     }
 
+    CompressionResult TextureCompression::CompressWithRGTC(const void* data, uint32_t width, uint32_t height, 
+                                                         uint32_t channels, CompressionFormat format, 
+                                                         const CompressionSettings& settings) {
+        CompressionResult result;
+
+        // BC4 stores the first channel, BC5 the first two (tangent-space normal XY)
+        const size_t maxThreads = settings.enableMultithreading ? 0 : 1;
+        result.success = BlockCompression::CompressImage(static_cast<const uint8_t*>(data), width, height, channels,
+                                                         format, settings.quality, result.compressedData, maxThreads,
+                                                         m_jobSystem);
+        if (result.success) {
+            result.compressedSize = result.compressedData.size();
+        } else {
+            result.errorMessage = "RGTC compression failed: unsupported channel count";
+        }
+
+        return result;
+    }
+
     CompressionResult TextureCompression::CompressWithBC7(const void* data, uint32_t width, uint32_t height, 
-                                                        uint32_t channels, CompressionQuality quality) {
+                                                        uint32_t channels, const CompressionSettings& settings) {
         CompressionResult result;
-        
-        // This is a placeholder implementation
-        // Real BC7 compression would require a library like DirectXTex or Intel ISPC
-        result.success = false;
-        result.errorMessage = "BC7 compression not implemented (requires external library)";
+
+        const size_t maxThreads = settings.enableMultithreading ? 0 : 1;
+        result.success = BlockCompression::CompressImage(static_cast<const uint8_t*>(data), width, height, channels,
+                                                         CompressionFormat::BC7, settings.quality, result.compressedData,
+                                                         maxThreads, m_jobSystem);
+        if (result.success) {
+            result.compressedSize = result.compressedData.size();
+        } else {
+            result.errorMessage = "BC7 compression failed: unsupported channel count";
+        }
         
         return result;
     }
@@ -418,9 +526,11 @@ namespace GameEngine {
             case CompressionFormat::DXT1:
             case CompressionFormat::DXT3:
             case CompressionFormat::DXT5:
+            case CompressionFormat::BC4:
+            case CompressionFormat::BC5:
             case CompressionFormat::BC7:
-                // DXT/BC formats require dimensions to be multiples of 4
-                return (width % 4 == 0) && (height % 4 == 0);
+                // BC formats: partial edge blocks are padded by the encoder
+                return true;
                 
             case CompressionFormat::ETC2_RGB:
             case CompressionFormat::ETC2_RGBA:
@@ -0,0 +1,275 @@
+#include "Graphics/VertexPacking.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace GameEngine {
+
+    namespace {
+        // First float of the Vertex field behind an attribute; glm vectors are contiguous
+        float* AttributeData(Vertex& vertex, VertexAttribute type) {
+            switch (type) {
+                case VertexAttribute::Position: return &vertex.position.x;
+                case VertexAttribute::Normal: return &vertex.normal.x;
+                case VertexAttribute::TexCoords: return &vertex.texCoords.x;
+                case VertexAttribute::Tangent: return &vertex.tangent.x;
+                case VertexAttribute::Bitangent: return &vertex.bitangent.x;
+                case VertexAttribute::Color: return &vertex.color.x;
+                case VertexAttribute::BoneIds: return &vertex.boneIds.x;
+                case VertexAttribute::BoneWeights: return &vertex.boneWeights.x;
+                case VertexAttribute::TexCoords2: return &vertex.texCoords2.x;
+                case VertexAttribute::TexCoords3: return &vertex.texCoords3.x;
+            }
+            return nullptr;
+        }
+
+        const float* AttributeData(const Vertex& vertex, VertexAttribute type) {
+            return AttributeData(const_cast<Vertex&>(vertex), type);
+        }
+
+        bool IsNonZero(const float* values, uint32_t count) {
+            for (uint32_t i = 0; i < count; ++i) {
+                if (values[i] != 0.0f) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        uint8_t ToUnorm8(float value) {
+            return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+        }
+
+        int16_t ToSnorm16(float value) {
+            return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+        }
+
+        float SignNotZero(float value) {
+            return value >= 0.0f ? 1.0f : -1.0f;
+        }
+    }
+
+    std::vector<VertexAttribute> VertexPacking::DetectUsedAttributes(const Vertex* vertices, size_t count) {
+        bool normal = false, texCoords = false, tangent = false, bitangent = false, color = false;
+        bool skinning = false, texCoords2 = false, texCoords3 = false;
+        const Math::Vec4 white(1.0f, 1.0f, 1.0f, 1.0f);
+
+        for (size_t i = 0; i < count; ++i) {
+            const Vertex& v = vertices[i];
+            normal = normal || IsNonZero(&v.normal.x, 3);
+            texCoords = texCoords || IsNonZero(&v.texCoords.x, 2);
+            tangent = tangent || IsNonZero(&v.tangent.x, 3);
+            bitangent = bitangent || IsNonZero(&v.bitangent.x, 3);
+            color = color || v.color != white;
+            skinning = skinning || IsNonZero(&v.boneWeights.x, 4) || IsNonZero(&v.boneIds.x, 4);
+            texCoords2 = texCoords2 || IsNonZero(&v.texCoords2.x, 2);
+            texCoords3 = texCoords3 || IsNonZero(&v.texCoords3.x, 2);
+        }
+
+        std::vector<VertexAttribute> used;
+        if (normal) used.push_back(VertexAttribute::Normal);
+        if (texCoords) used.push_back(VertexAttribute::TexCoords);
+        if (tangent) used.push_back(VertexAttribute::Tangent);
+        if (bitangent) used.push_back(VertexAttribute::Bitangent);
+        if (color) used.push_back(VertexAttribute::Color);
+        if (skinning) {
+            used.push_back(VertexAttribute::BoneIds);
+            used.push_back(VertexAttribute::BoneWeights);
+        }
+        if (texCoords2) used.push_back(VertexAttribute::TexCoords2);
+        if (texCoords3) used.push_back(VertexAttribute::TexCoords3);
+        return used;
+    }
+
+    VertexLayout VertexPacking::CreateLayout(const Vertex* vertices, size_t count, const VertexFormatOptions& options) {
+        VertexFormatOptions adjusted = options;
+
+        for (size_t i = 0; i < count && (adjusted.unorm8Colors || adjusted.compactSkinning); ++i) {
+            const Vertex& v = vertices[i];
+            for (int c = 0; c < 4; ++c) {
+                if (v.color[c] < 0.0f || v.color[c] > 1.0f) {
+                    adjusted.unorm8Colors = false;
+                }
+                const float boneId = v.boneIds[c];
+                if (boneId < 0.0f || boneId > 255.0f || boneId != std::floor(boneId)) {
+                    adjusted.compactSkinning = false;
+                }
+            }
+        }
+
+        return VertexLayout::CreatePacked(DetectUsedAttributes(vertices, count), adjusted);
+    }
+
+    void VertexPacking::Pack(const Vertex* vertices, size_t count, const VertexLayout& layout, uint8_t* destination) {
+        for (size_t i = 0; i < count; ++i) {
+            uint8_t* out = destination + i * layout.stride;
+            for (const auto& attr : layout.attributes) {
+                const float* values = AttributeData(vertices[i], attr.type);
+                const uint32_t components = VertexLayout::GetComponentCount(attr.type);
+                uint8_t* field = out + attr.offset;
+
+                switch (attr.format) {
+                    case VertexFormat::Float32:
+                        std::memcpy(field, values, components * sizeof(float));
+                        break;
+                    case VertexFormat::Float16:
+                        for (uint32_t c = 0; c < components; ++c) {
+                            const uint16_t half = FloatToHalf(values[c]);
+                            std::memcpy(field + c * sizeof(uint16_t), &half, sizeof(half));
+                        }
+                        break;
+                    case VertexFormat::Octahedral16: {
+                        int16_t encoded[2];
+                        EncodeOctahedral(Math::Vec3(values[0], values[1], values[2]), encoded);
+                        std::memcpy(field, encoded, sizeof(encoded));
+                        break;
+                    }
+                    case VertexFormat::Unorm8:
+                        for (uint32_t c = 0; c < components; ++c) {
+                            field[c] = ToUnorm8(values[c]);
+                        }
+                        break;
+                    case VertexFormat::UInt8:
+                        for (uint32_t c = 0; c < components; ++c) {
+                            field[c] = static_cast<uint8_t>(std::clamp(std::lround(values[c]), 0L, 255L));
+                        }
+                        break;
+                }
+            }
+        }
+    }
+
+    void VertexPacking::Unpack(const uint8_t* source, size_t count, const VertexLayout& layout, Vertex* destination) {
+        for (size_t i = 0; i < count; ++i) {
+            const uint8_t* in = source + i * layout.stride;
+            Vertex vertex = {};
+            for (const auto& attr : layout.attributes) {
+                float* values = AttributeData(vertex, attr.type);
+                const uint32_t components = VertexLayout::GetComponentCount(attr.type);
+                const uint8_t* field = in + attr.offset;
+
+                switch (attr.format) {
+                    case VertexFormat::Float32:
+                        std::memcpy(values, field, components * sizeof(float));
+                        break;
+                    case VertexFormat::Float16:
+                        for (uint32_t c = 0; c < components; ++c) {
+                            uint16_t half;
+                            std::memcpy(&half, field + c * sizeof(uint16_t), sizeof(half));
+                            values[c] = HalfToFloat(half);
+                        }
+                        break;
+                    case VertexFormat::Octahedral16: {
+                        int16_t encoded[2];
+                        std::memcpy(encoded, field, sizeof(encoded));
+                        const Math::Vec3 direction = DecodeOctahedral(encoded);
+                        values[0] = direction.x;
+                        values[1] = direction.y;
+                        values[2] = direction.z;
+                        break;
+                    }
+                    case VertexFormat::Unorm8:
+                        for (uint32_t c = 0; c < components; ++c) {
+                            values[c] = field[c] / 255.0f;
+                        }
+                        break;
+                    case VertexFormat::UInt8:
+                        for (uint32_t c = 0; c < components; ++c) {
+                            values[c] = static_cast<float>(field[c]);
+                        }
+                        break;
+                }
+            }
+            destination[i] = vertex;
+        }
+    }
+
+    uint16_t VertexPacking::FloatToHalf(float value) {
+        // Round to nearest even; overflow goes to infinity, NaN stays NaN
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        const uint32_t sign = bits & 0x80000000u;
+        bits ^= sign;
+
+        uint16_t half;
+        if (bits >= 0x47800000u) {
+            half = bits > 0x7F800000u ? 0x7E00 : 0x7C00;
+        } else if (bits < 0x38800000u) {
+            // Denormal or zero: let the FPU align the mantissa by adding 0.5
+            const uint32_t magicBits = 0x3F000000u;
+            float input;
+            std::memcpy(&input, &bits, sizeof(input));
+            float aligned;
+            std::memcpy(&aligned, &magicBits, sizeof(aligned));
+            aligned += input;
+            uint32_t alignedBits;
+            std::memcpy(&alignedBits, &aligned, sizeof(alignedBits));
+            half = static_cast<uint16_t>(alignedBits - magicBits);
+        } else {
+            const uint32_t mantissaOdd = (bits >> 13) & 1u;
+            bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xFFFu;
+            bits += mantissaOdd;
+            half = static_cast<uint16_t>(bits >> 13);
+        }
+        return static_cast<uint16_t>(half | (sign >> 16));
+    }
+
+    float VertexPacking::HalfToFloat(uint16_t value) {
+        const uint32_t sign = static_cast<uint32_t>(value & 0x8000u) << 16;
+        const uint32_t exponent = (value >> 10) & 0x1Fu;
+        const uint32_t mantissa = value & 0x3FFu;
+
+        uint32_t bits;
+        if (exponent == 0) {
+            // Zero or denormal: mantissa * 2^-24
+            const float magnitude = static_cast<float>(mantissa) * (1.0f / 16777216.0f);
+            std::memcpy(&bits, &magnitude, sizeof(bits));
+            bits |= sign;
+        } else if (exponent == 31) {
+            bits = sign | 0x7F800000u | (mantissa << 13);
+        } else {
+            bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+        }
+
+        float result;
+        std::memcpy(&result, &bits, sizeof(result));
+        return result;
+    }
+
+    void VertexPacking::EncodeOctahedral(const Math::Vec3& direction, int16_t encoded[2]) {
+        const float l1 = std::abs(direction.x) + std::abs(direction.y) + std::abs(direction.z);
+        if (l1 <= 0.0f) {
+            encoded[0] = 0;
+            encoded[1] = 0;
+            return;
+        }
+
+        // Project onto the octahedron, then fold the lower hemisphere over the diagonals
+        float x = direction.x / l1;
+        float y = direction.y / l1;
+        if (direction.z < 0.0f) {
+            const float foldedX = (1.0f - std::abs(y)) * SignNotZero(x);
+            const float foldedY = (1.0f - std::abs(x)) * SignNotZero(y);
+            x = foldedX;
+            y = foldedY;
+        }
+
+        encoded[0] = ToSnorm16(x);
+        encoded[1] = ToSnorm16(y);
+    }
+
+    Math::Vec3 VertexPacking::DecodeOctahedral(const int16_t encoded[2]) {
+        float x = std::max(encoded[0] / 32767.0f, -1.0f);
+        float y = std::max(encoded[1] / 32767.0f, -1.0f);
+        const float z = 1.0f - std::abs(x) - std::abs(y);
+        if (z < 0.0f) {
+            const float unfoldedX = (1.0f - std::abs(y)) * SignNotZero(x);
+            const float unfoldedY = (1.0f - std::abs(x)) * SignNotZero(y);
+            x = unfoldedX;
+            y = unfoldedY;
+        }
+
+        const float length = std::sqrt(x * x + y * y + z * z);
+        return Math::Vec3(x / length, y / length, z / length);
+    }
+}
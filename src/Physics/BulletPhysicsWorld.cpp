@@ -4,7 +4,48 @@
 
 #ifdef GAMEENGINE_HAS_BULLET
 
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include <algorithm>
+#include <tuple>
+
 namespace GameEngine {
+    namespace {
+        // Overlapping pairs per narrowphase task
+        constexpr int NarrowphaseGrainSize = 40;
+
+        /**
+         * Parallel narrowphase that leaves the manifold list in a fixed order. Workers append new
+         * manifolds to per-thread lists and releases swap entries around, so without sorting the
+         * order manifolds are fed to the island solvers would depend on thread scheduling.
+         */
+        class DeterministicCollisionDispatcherMt : public btCollisionDispatcherMt {
+        public:
+            DeterministicCollisionDispatcherMt(btCollisionConfiguration* config, int grainSize)
+                : btCollisionDispatcherMt(config, grainSize) {
+            }
+
+            void dispatchAllCollisionPairs(btOverlappingPairCache* pairCache, const btDispatcherInfo& info,
+                                           btDispatcher* dispatcher) override {
+                btCollisionDispatcherMt::dispatchAllCollisionPairs(pairCache, info, dispatcher);
+
+                const int count = m_manifoldsPtr.size();
+                if (count < 2) {
+                    return;
+                }
+
+                // By body pair; the world array index is the same on every run with the same scene
+                btPersistentManifold** manifolds = &m_manifoldsPtr[0];
+                std::stable_sort(manifolds, manifolds + count, [](const btPersistentManifold* a, const btPersistentManifold* b) {
+                    return std::make_tuple(a->getBody0()->getWorldArrayIndex(), a->getBody1()->getWorldArrayIndex()) <
+                           std::make_tuple(b->getBody0()->getWorldArrayIndex(), b->getBody1()->getWorldArrayIndex());
+                });
+                for (int i = 0; i < count; ++i) {
+                    manifolds[i]->m_index1a = i;
+                }
+            }
+        };
+    }
     
     BulletPhysicsWorld::BulletPhysicsWorld(const Math::Vec3& gravity) 
         : PhysicsWorld(gravity), m_gravity(gravity) {
@@ -17,8 +58,8 @@ namespace GameEngine {
         LOG_INFO("BulletPhysicsWorld created with gravity");
     }
     
-    BulletPhysicsWorld::BulletPhysicsWorld(const PhysicsConfiguration& config)
-        : PhysicsWorld(config.gravity), m_configuration(config), m_gravity(config.gravity) {
+    BulletPhysicsWorld::BulletPhysicsWorld(const PhysicsConfiguration& config, JobSystem* jobSystem)
+        : PhysicsWorld(config.gravity), m_jobSystem(jobSystem), m_configuration(config), m_gravity(config.gravity) {
         InitializeBulletComponents();
         SetConfiguration(config);
         LOG_INFO("BulletPhysicsWorld created with configuration");
@@ -30,12 +71,45 @@ namespace GameEngine {
     }
     
     void BulletPhysicsWorld::InitializeBulletComponents() {
+        // The scheduler must be installed before the parallel dispatcher sizes its per-thread tables
+        if (m_configuration.multithreadedSimulation) {
+            if (m_jobSystem) {
+                m_taskScheduler = Physics::BulletTaskScheduler::Acquire(*m_jobSystem);
+            } else {
+                LOG_WARNING("Multithreaded physics runs on a job system, but none was given to the world");
+            }
+            if (!m_taskScheduler) {
+                LOG_WARNING("Multithreaded physics unavailable, using a single-threaded world");
+            }
+        }
+        
         // Create broadphase
         m_broadphase = std::make_unique<btDbvtBroadphase>();
         
         // Create collision configuration
         m_collisionConfig = std::make_unique<btDefaultCollisionConfiguration>();
         
+        if (m_taskScheduler) {
+            // Narrowphase split over overlapping pairs, islands solved in parallel by a pool of
+            // solvers with one per thread; islands too large for one solver use m_solver, which
+            // splits them into independent batches
+            m_dispatcher = std::make_unique<DeterministicCollisionDispatcherMt>(m_collisionConfig.get(), NarrowphaseGrainSize);
+            m_solverPool = std::make_unique<btConstraintSolverPoolMt>(m_taskScheduler->GetLoopThreadCount());
+            m_solver = std::make_unique<btSequentialImpulseConstraintSolverMt>();
+            
+            m_dynamicsWorld = std::make_unique<btDiscreteDynamicsWorldMt>(
+                m_dispatcher.get(),
+                m_broadphase.get(),
+                m_solverPool.get(),
+                m_solver.get(),
+                m_collisionConfig.get()
+            );
+            
+            LOG_INFO("Bullet Physics components initialized with " + std::to_string(m_taskScheduler->GetLoopThreadCount()) +
+                     " simulation threads");
+            return;
+        }
+        
         // Create collision dispatcher
         m_dispatcher = std::make_unique<btCollisionDispatcher>(m_collisionConfig.get());
         
@@ -75,9 +149,11 @@ namespace GameEngine {
         // Reset all components in reverse order of creation
         m_dynamicsWorld.reset();
         m_solver.reset();
+        m_solverPool.reset();
         m_dispatcher.reset();
         m_collisionConfig.reset();
         m_broadphase.reset();
+        m_taskScheduler.reset();
         
         LOG_INFO("Bullet Physics components cleaned up");
     }
@@ -92,6 +168,16 @@ namespace GameEngine {
         m_dynamicsWorld->stepSimulation(deltaTime, m_configuration.maxSubSteps, m_configuration.timeStep);
     }
     
+    void BulletPhysicsWorld::StepFixed(float timeStep) {
+        if (!m_dynamicsWorld) {
+            LOG_ERROR("Cannot step physics: Bullet dynamics world is null");
+            return;
+        }
+        
+        // Zero substeps makes Bullet run a single step of exactly timeStep
+        m_dynamicsWorld->stepSimulation(timeStep, 0, timeStep);
+    }
+    
     void BulletPhysicsWorld::SetGravity(const Math::Vec3& gravity) {
         m_gravity = gravity;
         
@@ -0,0 +1,168 @@
+#include "Physics/BulletTaskScheduler.h"
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+
+#ifdef GAMEENGINE_HAS_BULLET
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace GameEngine {
+    namespace Physics {
+        std::shared_ptr<BulletTaskScheduler> BulletTaskScheduler::Acquire(JobSystem& jobSystem) {
+            static std::mutex mutex;
+            static std::weak_ptr<BulletTaskScheduler> shared;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (auto scheduler = shared.lock()) {
+                if (scheduler->m_jobSystem != &jobSystem) {
+                    LOG_WARNING("Bullet task scheduler already running on another job system");
+                    return nullptr;
+                }
+                return scheduler;
+            }
+
+            if (jobSystem.GetWorkerCount() == 0) {
+                LOG_WARNING("Bullet task scheduler needs an initialized job system with workers");
+                return nullptr;
+            }
+
+            std::shared_ptr<BulletTaskScheduler> scheduler(new BulletTaskScheduler(jobSystem));
+            btSetTaskScheduler(scheduler.get());
+            if (btGetTaskScheduler() != scheduler.get()) {
+                LOG_WARNING("Bullet rejected the task scheduler: it must be installed from Bullet's main thread");
+                return nullptr;
+            }
+
+            shared = scheduler;
+            LOG_INFO("Bullet task scheduler installed with " + std::to_string(scheduler->m_loopThreadCount) + " threads");
+            return scheduler;
+        }
+
+        BulletTaskScheduler::BulletTaskScheduler(JobSystem& jobSystem)
+            : btITaskScheduler("GameEngineJobSystem"),
+              m_jobSystem(&jobSystem),
+              m_ownerThread(std::this_thread::get_id()) {
+            m_loopThreadCount = static_cast<int>(std::min<size_t>(jobSystem.GetWorkerCount() + 1, BT_MAX_THREAD_COUNT));
+        }
+
+        BulletTaskScheduler::~BulletTaskScheduler() {
+            if (btGetTaskScheduler() == this) {
+                btSetTaskScheduler(btGetSequentialTaskScheduler());
+            }
+        }
+
+        int BulletTaskScheduler::getMaxNumThreads() const {
+            return static_cast<int>(BT_MAX_THREAD_COUNT);
+        }
+
+        int BulletTaskScheduler::getNumThreads() const {
+            // Bullet sizes its per-thread tables from this. Which numbers the workers get depends
+            // on the order threads first ran Bullet code, so the tables cover every number
+            return static_cast<int>(BT_MAX_THREAD_COUNT);
+        }
+
+        void BulletTaskScheduler::setNumThreads(int numThreads) {
+            m_parallel = numThreads > 1;
+        }
+
+        bool BulletTaskScheduler::IsSchedulerThread() const {
+            return m_jobSystem->IsWorkerThread() || std::this_thread::get_id() == m_ownerThread;
+        }
+
+        bool BulletTaskScheduler::CanRunBulletWork() const {
+            // Bullet numbers a thread for good the first time it asks for its index, so other
+            // threads must not ask
+            return IsSchedulerThread() && btGetCurrentThreadIndex() < BT_MAX_THREAD_COUNT;
+        }
+
+        template <typename ChunkFunction>
+        void BulletTaskScheduler::ForEachChunk(size_t chunkCount, const ChunkFunction& runChunk) {
+            std::atomic<size_t> nextChunk{0};
+            JobGroup group;
+            std::function<void()> claimChunks = [&]() {
+                if (!IsSchedulerThread()) {
+                    // Picked up by some other thread waiting on its own jobs; leave it to a worker
+                    m_jobSystem->Submit(claimChunks, group, JobPriority::FrameCritical);
+                    return;
+                }
+                if (btGetCurrentThreadIndex() >= BT_MAX_THREAD_COUNT) {
+                    return;
+                }
+                for (size_t chunk = nextChunk.fetch_add(1); chunk < chunkCount; chunk = nextChunk.fetch_add(1)) {
+                    runChunk(chunk);
+                }
+            };
+
+            // Helpers claim chunks until none are left; a caller that may not run Bullet work needs at least one
+            const bool callerRuns = CanRunBulletWork();
+            size_t helpers = m_parallel ? std::min(chunkCount, static_cast<size_t>(m_loopThreadCount - 1)) : 0;
+            helpers = callerRuns ? std::min(helpers, chunkCount - 1) : std::max<size_t>(helpers, 1);
+
+            for (size_t i = 0; i < helpers; ++i) {
+                m_jobSystem->Submit(claimChunks, group, JobPriority::FrameCritical);
+            }
+            if (callerRuns) {
+                claimChunks();
+                m_jobSystem->Wait(group);
+            } else {
+                // Helpers this thread picked up in Wait would only be handed back to the queue
+                while (!group.IsDone()) {
+                    std::this_thread::yield();
+                }
+            }
+
+            // Every claimer drains the counter, so it only stays low if no thread was allowed to run
+            if (nextChunk.load() < chunkCount) {
+                LOG_ERROR("Bullet parallel loop skipped: no job system thread has a Bullet thread index");
+            }
+        }
+
+        void BulletTaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) {
+            const size_t count = iEnd > iBegin ? static_cast<size_t>(iEnd - iBegin) : 0;
+            const size_t grain = static_cast<size_t>(std::max(grainSize, 1));
+            if (count == 0) {
+                return;
+            }
+            if ((!m_parallel || count <= grain) && CanRunBulletWork()) {
+                body.forLoop(iBegin, iEnd);
+                return;
+            }
+
+            ForEachChunk((count + grain - 1) / grain, [&](size_t chunk) {
+                const int begin = iBegin + static_cast<int>(chunk * grain);
+                body.forLoop(begin, std::min(iEnd, begin + static_cast<int>(grain)));
+            });
+        }
+
+        btScalar BulletTaskScheduler::parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) {
+            const size_t count = iEnd > iBegin ? static_cast<size_t>(iEnd - iBegin) : 0;
+            const size_t grain = static_cast<size_t>(std::max(grainSize, 1));
+            if (count == 0) {
+                return btScalar(0);
+            }
+            if ((!m_parallel || count <= grain) && CanRunBulletWork()) {
+                return body.sumLoop(iBegin, iEnd);
+            }
+
+            // One partial sum per fixed-size chunk, whichever thread runs it
+            const size_t chunkCount = (count + grain - 1) / grain;
+            std::vector<btScalar> partialSums(chunkCount, btScalar(0));
+            ForEachChunk(chunkCount, [&](size_t chunk) {
+                const int begin = iBegin + static_cast<int>(chunk * grain);
+                partialSums[chunk] = body.sumLoop(begin, std::min(iEnd, begin + static_cast<int>(grain)));
+            });
+
+            btScalar sum = 0;
+            for (btScalar partial : partialSums) {
+                sum += partial;
+            }
+            return sum;
+        }
+    }
+}
+
+#endif // GAMEENGINE_HAS_BULLET
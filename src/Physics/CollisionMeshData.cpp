@@ -0,0 +1,111 @@
+#include "Physics/CollisionMeshData.h"
+#include "Graphics/Mesh.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace GameEngine {
+    namespace {
+        // FNV-1a over raw bytes; positions are hashed bit for bit, so -0 and 0 differ
+        uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; ++i) {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        // Indices of the support points along count directions on a Fibonacci sphere, without repeats
+        std::vector<uint32_t> SupportPoints(const std::vector<Math::Vec3>& positions, uint32_t count) {
+            constexpr float goldenAngle = 2.39996323f;
+            std::vector<uint32_t> support;
+            support.reserve(count);
+            for (uint32_t i = 0; i < count; ++i) {
+                const float y = 1.0f - 2.0f * (static_cast<float>(i) + 0.5f) / static_cast<float>(count);
+                const float radius = std::sqrt(std::max(0.0f, 1.0f - y * y));
+                const float phi = goldenAngle * static_cast<float>(i);
+                const Math::Vec3 direction(radius * std::cos(phi), y, radius * std::sin(phi));
+
+                uint32_t best = 0;
+                float bestDot = glm::dot(positions[0], direction);
+                for (uint32_t p = 1; p < positions.size(); ++p) {
+                    const float d = glm::dot(positions[p], direction);
+                    if (d > bestDot) {
+                        bestDot = d;
+                        best = p;
+                    }
+                }
+                if (std::find(support.begin(), support.end(), best) == support.end()) {
+                    support.push_back(best);
+                }
+            }
+            return support;
+        }
+    }
+
+    CollisionMeshData::CollisionMeshData(std::vector<Math::Vec3> positions, std::vector<uint32_t> indices)
+        : m_positions(std::move(positions)), m_indices(std::move(indices)) {
+        uint64_t hash = 14695981039346656037ull;
+        const uint64_t counts[2] = { m_positions.size(), m_indices.size() };
+        hash = HashBytes(hash, counts, sizeof(counts));
+        hash = HashBytes(hash, m_positions.data(), m_positions.size() * sizeof(Math::Vec3));
+        hash = HashBytes(hash, m_indices.data(), m_indices.size() * sizeof(uint32_t));
+        m_contentHash = hash;
+    }
+
+    std::shared_ptr<const CollisionMeshData> CollisionMeshData::FromMesh(const Mesh& mesh) {
+        const uint32_t vertexCount = mesh.GetVertexCount();
+        std::vector<Math::Vec3> positions(vertexCount);
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            positions[i] = mesh.GetVertexPosition(i);
+        }
+
+        std::vector<uint32_t> indices = mesh.GetIndices();
+        if (indices.empty()) {
+            indices.resize(vertexCount - vertexCount % 3);
+            std::iota(indices.begin(), indices.end(), 0u);
+        }
+        return std::make_shared<const CollisionMeshData>(std::move(positions), std::move(indices));
+    }
+
+    bool CollisionMeshData::IsValidTriangleMesh() const {
+        if (m_indices.empty() || m_indices.size() % 3 != 0) {
+            return false;
+        }
+        const uint32_t vertexCount = static_cast<uint32_t>(m_positions.size());
+        return std::all_of(m_indices.begin(), m_indices.end(), [vertexCount](uint32_t index) { return index < vertexCount; });
+    }
+
+    std::vector<Math::Vec3> CollisionMeshData::ComputeHullVertices(uint32_t maxVertices) const {
+        if (maxVertices == 0 || m_positions.size() <= maxVertices) {
+            return m_positions;
+        }
+
+        // Fewer directions than vertices can still find more distinct supports on very round
+        // shapes, so shrink until the set fits, then grow while it still does
+        maxVertices = std::max(maxVertices, 4u);
+        uint32_t directions = maxVertices;
+        std::vector<uint32_t> support = SupportPoints(m_positions, directions);
+        while (support.size() > maxVertices && directions > 4) {
+            directions = std::max(4u, directions * 3 / 4);
+            support = SupportPoints(m_positions, directions);
+        }
+        for (int attempt = 0; attempt < 8 && support.size() < maxVertices; ++attempt) {
+            const uint32_t moreDirections = directions + directions / 2 + 1;
+            std::vector<uint32_t> larger = SupportPoints(m_positions, moreDirections);
+            if (larger.size() > maxVertices) {
+                break;
+            }
+            directions = moreDirections;
+            support = std::move(larger);
+        }
+
+        std::vector<Math::Vec3> hull;
+        hull.reserve(support.size());
+        for (uint32_t index : support) {
+            hull.push_back(m_positions[index]);
+        }
+        return hull;
+    }
+}
@@ -0,0 +1,162 @@
+#ifdef GAMEENGINE_HAS_BULLET
+
+#include "Physics/CollisionShapeCache.h"
+#include "Physics/CollisionShapeFactory.h"
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
+
+namespace GameEngine {
+    namespace Physics {
+        namespace {
+            // FNV-1a, matching CollisionMeshData's content hash
+            uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+                const uint8_t* bytes = static_cast<const uint8_t*>(data);
+                for (size_t i = 0; i < size; ++i) {
+                    hash ^= bytes[i];
+                    hash *= 1099511628211ull;
+                }
+                return hash;
+            }
+
+            template<typename T>
+            uint64_t HashValue(uint64_t hash, const T& value) {
+                return HashBytes(hash, &value, sizeof(value));
+            }
+
+            bool SameMesh(const std::shared_ptr<const CollisionMeshData>& a, const std::shared_ptr<const CollisionMeshData>& b) {
+                if (a == b) {
+                    return true;
+                }
+                return a && b && a->GetContentHash() == b->GetContentHash() &&
+                       a->GetPositions().size() == b->GetPositions().size() &&
+                       a->GetIndices().size() == b->GetIndices().size();
+            }
+        }
+
+        CollisionShapeCache::CollisionShapeCache(std::string bvhDirectory)
+            : m_bvhDirectory(std::move(bvhDirectory)) {
+        }
+
+        std::shared_ptr<btCollisionShape> CollisionShapeCache::Acquire(const CollisionShape& desc) {
+            const uint64_t key = ComputeKey(desc);
+            auto it = m_entries.find(key);
+            if (it != m_entries.end() && IsSameShape(it->second.desc, desc)) {
+                ++m_stats.hits;
+                return it->second.shape;
+            }
+
+            ++m_stats.misses;
+            // Creation may add entries for scaled meshes and compound children, so look the key up again
+            std::shared_ptr<btCollisionShape> shape = CollisionShapeFactory::CreateShape(desc, this);
+            if (shape && m_entries.find(key) == m_entries.end()) {
+                // A key collision with a different descriptor leaves the new shape uncached
+                m_entries.emplace(key, Entry{ desc, shape, CollisionShapeFactory::EstimateMemoryUsage(*shape, false) });
+            }
+            return shape;
+        }
+
+        std::string CollisionShapeCache::GetBvhPath(const CollisionMeshData& mesh) const {
+            if (m_bvhDirectory.empty()) {
+                return std::string();
+            }
+            std::ostringstream name;
+            name << std::hex << std::setw(16) << std::setfill('0') << mesh.GetContentHash() << ".bvh";
+            return (std::filesystem::path(m_bvhDirectory) / name.str()).string();
+        }
+
+        size_t CollisionShapeCache::Purge() {
+            // Scaled meshes and compounds hold their children, so repeat until nothing is released
+            size_t purged = 0;
+            bool released = true;
+            while (released) {
+                released = false;
+                for (auto it = m_entries.begin(); it != m_entries.end();) {
+                    if (it->second.shape.use_count() == 1) {
+                        it = m_entries.erase(it);
+                        ++purged;
+                        released = true;
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+            return purged;
+        }
+
+        void CollisionShapeCache::Clear() {
+            m_entries.clear();
+            m_stats = CollisionShapeCacheStats{};
+        }
+
+        CollisionShapeCacheStats CollisionShapeCache::GetStats() const {
+            CollisionShapeCacheStats stats = m_stats;
+            stats.shapeCount = m_entries.size();
+            stats.memoryBytes = 0;
+            for (const auto& [key, entry] : m_entries) {
+                stats.memoryBytes += entry.memoryBytes;
+            }
+            return stats;
+        }
+
+        uint64_t CollisionShapeCache::ComputeKey(const CollisionShape& desc) {
+            uint64_t hash = 14695981039346656037ull;
+            hash = HashValue(hash, static_cast<int>(desc.type));
+            switch (desc.type) {
+                case CollisionShape::Mesh:
+                case CollisionShape::ConvexHull:
+                    hash = HashValue(hash, desc.dimensions);
+                    hash = HashValue(hash, desc.mesh ? desc.mesh->GetContentHash() : 0ull);
+                    if (desc.type == CollisionShape::ConvexHull) {
+                        hash = HashValue(hash, desc.maxHullVertices);
+                    }
+                    break;
+
+                case CollisionShape::Compound:
+                    for (const CollisionShape::Child& child : desc.children) {
+                        hash = HashValue(hash, ComputeKey(child.shape));
+                        hash = HashValue(hash, child.position);
+                        hash = HashValue(hash, child.rotation);
+                    }
+                    break;
+
+                default:
+                    hash = HashValue(hash, desc.dimensions);
+                    break;
+            }
+            return hash;
+        }
+
+        bool CollisionShapeCache::IsSameShape(const CollisionShape& a, const CollisionShape& b) {
+            if (a.type != b.type) {
+                return false;
+            }
+            switch (a.type) {
+                case CollisionShape::Mesh:
+                    return a.dimensions == b.dimensions && SameMesh(a.mesh, b.mesh);
+
+                case CollisionShape::ConvexHull:
+                    return a.dimensions == b.dimensions && a.maxHullVertices == b.maxHullVertices && SameMesh(a.mesh, b.mesh);
+
+                case CollisionShape::Compound:
+                    if (a.children.size() != b.children.size()) {
+                        return false;
+                    }
+                    for (size_t i = 0; i < a.children.size(); ++i) {
+                        const CollisionShape::Child& childA = a.children[i];
+                        const CollisionShape::Child& childB = b.children[i];
+                        if (childA.position != childB.position || childA.rotation != childB.rotation ||
+                            !IsSameShape(childA.shape, childB.shape)) {
+                            return false;
+                        }
+                    }
+                    return true;
+
+                default:
+                    return a.dimensions == b.dimensions;
+            }
+        }
+    }
+}
+
+#endif // GAMEENGINE_HAS_BULLET
@@ -1,14 +1,151 @@
 #ifdef GAMEENGINE_HAS_BULLET
 
 #include "Physics/CollisionShapeFactory.h"
+#include "Physics/CollisionShapeCache.h"
 #include "Physics/BulletUtils.h"
+#include <BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.h>
+#include <BulletCollision/CollisionShapes/btOptimizedBvh.h>
+#include <LinearMath/btAlignedAllocator.h>
 #include <iostream>
 #include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 
 namespace GameEngine {
     namespace Physics {
-        
-        std::unique_ptr<btCollisionShape> CollisionShapeFactory::CreateShape(const CollisionShape& desc) {
+        namespace {
+            // Owns the index/vertex array a BVH mesh shape reads from. It is a base class of the
+            // shape below so that it is constructed before, and destroyed after, the Bullet shape.
+            struct TriangleMeshStorage {
+                explicit TriangleMeshStorage(std::shared_ptr<const CollisionMeshData> data)
+                    : meshData(std::move(data)) {
+                    btIndexedMesh part;
+                    part.m_numTriangles = static_cast<int>(meshData->GetTriangleCount());
+                    part.m_triangleIndexBase = reinterpret_cast<const unsigned char*>(meshData->GetIndices().data());
+                    part.m_triangleIndexStride = 3 * sizeof(uint32_t);
+                    part.m_numVertices = static_cast<int>(meshData->GetPositions().size());
+                    part.m_vertexBase = reinterpret_cast<const unsigned char*>(meshData->GetPositions().data());
+                    part.m_vertexStride = sizeof(Math::Vec3);
+                    part.m_indexType = PHY_INTEGER;
+                    part.m_vertexType = PHY_FLOAT;
+                    meshInterface.addIndexedMesh(part, PHY_INTEGER);
+                }
+
+                ~TriangleMeshStorage() {
+                    if (bvhBuffer) {
+                        btAlignedFree(bvhBuffer);
+                    }
+                }
+
+                std::shared_ptr<const CollisionMeshData> meshData;
+                btTriangleIndexVertexArray meshInterface;
+                void* bvhBuffer = nullptr; // Holds a BVH deserialized in place, which the shape does not own
+            };
+
+            class CookedTriangleMeshShape : private TriangleMeshStorage, public btBvhTriangleMeshShape {
+            public:
+                explicit CookedTriangleMeshShape(std::shared_ptr<const CollisionMeshData> data)
+                    : TriangleMeshStorage(std::move(data)), btBvhTriangleMeshShape(&meshInterface, true, false) {}
+
+                void AdoptBvh(void* buffer, btOptimizedBvh* bvh) {
+                    bvhBuffer = buffer;
+                    setOptimizedBvh(bvh);
+                }
+            };
+
+            // Cooked BVH file layout: this header followed by the in-place serialized btOptimizedBvh.
+            // The BVH is only valid for the exact mesh and Bullet build that produced it.
+            struct BvhFileHeader {
+                char magic[4];
+                uint32_t version;
+                uint32_t bulletVersion;
+                uint32_t pointerSize;
+                uint64_t meshHash;
+                uint64_t triangleCount;
+                uint32_t dataSize;
+                uint32_t reserved;
+            };
+
+            constexpr char BvhFileMagic[4] = { 'G', 'B', 'V', 'H' };
+            constexpr uint32_t BvhFileVersion = 1;
+
+            BvhFileHeader MakeBvhHeader(const CollisionMeshData& mesh, uint32_t dataSize) {
+                BvhFileHeader header{};
+                std::memcpy(header.magic, BvhFileMagic, sizeof(header.magic));
+                header.version = BvhFileVersion;
+                header.bulletVersion = static_cast<uint32_t>(btGetVersion());
+                header.pointerSize = sizeof(void*);
+                header.meshHash = mesh.GetContentHash();
+                header.triangleCount = mesh.GetTriangleCount();
+                header.dataSize = dataSize;
+                return header;
+            }
+
+            bool LoadBvh(CookedTriangleMeshShape& shape, const CollisionMeshData& mesh, const std::string& path) {
+                std::ifstream file(path, std::ios::binary);
+                if (!file) {
+                    return false;
+                }
+
+                BvhFileHeader header{};
+                if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+                    return false;
+                }
+                const BvhFileHeader expected = MakeBvhHeader(mesh, header.dataSize);
+                if (std::memcmp(&header, &expected, sizeof(header)) != 0 || header.dataSize == 0) {
+                    return false;
+                }
+
+                void* buffer = btAlignedAlloc(header.dataSize, 16);
+                if (!file.read(static_cast<char*>(buffer), header.dataSize)) {
+                    btAlignedFree(buffer);
+                    return false;
+                }
+
+                btOptimizedBvh* bvh = btOptimizedBvh::deSerializeInPlace(buffer, header.dataSize, false);
+                if (!bvh) {
+                    btAlignedFree(buffer);
+                    return false;
+                }
+                shape.AdoptBvh(buffer, bvh);
+                return true;
+            }
+
+            void SaveBvh(btBvhTriangleMeshShape& shape, const CollisionMeshData& mesh, const std::string& path) {
+                btOptimizedBvh* bvh = shape.getOptimizedBvh();
+                const uint32_t dataSize = bvh->calculateSerializeBufferSize();
+                void* buffer = btAlignedAlloc(dataSize, 16);
+                bvh->serializeInPlace(buffer, dataSize, false);
+
+                // Written under a temporary name so a concurrent reader never sees a partial file
+                std::error_code error;
+                const std::filesystem::path target(path);
+                if (target.has_parent_path()) {
+                    std::filesystem::create_directories(target.parent_path(), error);
+                }
+                const std::filesystem::path temporary = target.string() + ".tmp";
+                {
+                    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+                    const BvhFileHeader header = MakeBvhHeader(mesh, dataSize);
+                    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                    file.write(static_cast<const char*>(buffer), dataSize);
+                    if (!file) {
+                        std::cerr << "CollisionShapeFactory: Failed to write BVH cache file " << temporary.string() << std::endl;
+                    }
+                }
+                btAlignedFree(buffer);
+
+                std::filesystem::remove(target, error);
+                std::filesystem::rename(temporary, target, error);
+                if (error) {
+                    std::cerr << "CollisionShapeFactory: Failed to store BVH cache file " << path << ": " << error.message() << std::endl;
+                    std::filesystem::remove(temporary, error);
+                }
+            }
+        }
+
+        std::shared_ptr<btCollisionShape> CollisionShapeFactory::CreateShape(const CollisionShape& desc, CollisionShapeCache* cache) {
             if (!ValidateShapeParameters(desc)) {
                 std::cerr << "CollisionShapeFactory: Invalid shape parameters provided" << std::endl;
                 return nullptr;
@@ -24,9 +161,46 @@ namespace GameEngine {
                 case CollisionShape::Capsule:
                     return CreateCapsuleShape(desc.dimensions.x, desc.dimensions.y); // radius in x, height in y
                 
-                case CollisionShape::Mesh:
-                    std::cerr << "CollisionShapeFactory: Mesh collision shapes not yet implemented" << std::endl;
-                    return nullptr;
+                case CollisionShape::Mesh: {
+                    if (desc.dimensions == Math::Vec3(1.0f)) {
+                        bool loaded = false;
+                        auto shape = CreateTriangleMeshShape(desc.mesh, cache ? cache->GetBvhPath(*desc.mesh) : std::string(), &loaded);
+                        if (cache && shape) {
+                            cache->RecordBvh(loaded);
+                        }
+                        return shape;
+                    }
+
+                    // Scaled instances wrap the unit-scale mesh so they share its BVH
+                    CollisionShape unitScale = desc;
+                    unitScale.dimensions = Math::Vec3(1.0f);
+                    std::shared_ptr<btCollisionShape> base = cache ? cache->Acquire(unitScale) : CreateShape(unitScale);
+                    if (!base) {
+                        return nullptr;
+                    }
+                    auto* scaled = new btScaledBvhTriangleMeshShape(static_cast<btBvhTriangleMeshShape*>(base.get()),
+                                                                    BulletUtils::ToBullet(desc.dimensions));
+                    return std::shared_ptr<btCollisionShape>(scaled, [base](btCollisionShape* shape) { delete shape; });
+                }
+
+                case CollisionShape::ConvexHull:
+                    return CreateConvexHullShape(*desc.mesh, desc.maxHullVertices, desc.dimensions);
+
+                case CollisionShape::Compound: {
+                    auto compound = std::make_unique<btCompoundShape>(true, static_cast<int>(desc.children.size()));
+                    std::vector<std::shared_ptr<btCollisionShape>> childShapes;
+                    childShapes.reserve(desc.children.size());
+                    for (const CollisionShape::Child& child : desc.children) {
+                        std::shared_ptr<btCollisionShape> childShape = cache ? cache->Acquire(child.shape) : CreateShape(child.shape);
+                        if (!childShape) {
+                            return nullptr;
+                        }
+                        compound->addChildShape(BulletUtils::ToBullet(child.position, child.rotation), childShape.get());
+                        childShapes.push_back(std::move(childShape));
+                    }
+                    return std::shared_ptr<btCollisionShape>(compound.release(),
+                                                             [childShapes = std::move(childShapes)](btCollisionShape* shape) { delete shape; });
+                }
                 
                 default:
                     std::cerr << "CollisionShapeFactory: Unknown collision shape type: " << desc.type << std::endl;
@@ -49,6 +223,96 @@ namespace GameEngine {
             return std::make_unique<btCapsuleShape>(radius, height);
         }
 
+        std::unique_ptr<btConvexHullShape> CollisionShapeFactory::CreateConvexHullShape(const CollisionMeshData& mesh, uint32_t maxVertices,
+                                                                                        const Math::Vec3& scale) {
+            const std::vector<Math::Vec3> points = mesh.ComputeHullVertices(maxVertices);
+            auto hull = std::make_unique<btConvexHullShape>(reinterpret_cast<const btScalar*>(points.data()),
+                                                            static_cast<int>(points.size()), static_cast<int>(sizeof(Math::Vec3)));
+            // Drops interior points; setLocalScaling afterwards also refreshes the cached AABB
+            hull->optimizeConvexHull();
+            hull->setLocalScaling(BulletUtils::ToBullet(scale));
+            return hull;
+        }
+
+        std::shared_ptr<btBvhTriangleMeshShape> CollisionShapeFactory::CreateTriangleMeshShape(const std::shared_ptr<const CollisionMeshData>& mesh,
+                                                                                               const std::string& bvhPath,
+                                                                                               bool* loadedFromDisk) {
+            if (loadedFromDisk) {
+                *loadedFromDisk = false;
+            }
+            if (!mesh || !mesh->IsValidTriangleMesh()) {
+                std::cerr << "CollisionShapeFactory: Triangle mesh shapes need a valid indexed triangle list" << std::endl;
+                return nullptr;
+            }
+
+            auto shape = std::make_shared<CookedTriangleMeshShape>(mesh);
+            if (!bvhPath.empty() && LoadBvh(*shape, *mesh, bvhPath)) {
+                if (loadedFromDisk) {
+                    *loadedFromDisk = true;
+                }
+                return shape;
+            }
+
+            shape->buildOptimizedBvh();
+            if (!bvhPath.empty()) {
+                SaveBvh(*shape, *mesh, bvhPath);
+            }
+            return shape;
+        }
+
+        size_t CollisionShapeFactory::EstimateMemoryUsage(const btCollisionShape& shape, bool includeChildren) {
+            switch (shape.getShapeType()) {
+                case BOX_SHAPE_PROXYTYPE:
+                    return sizeof(btBoxShape);
+
+                case SPHERE_SHAPE_PROXYTYPE:
+                    return sizeof(btSphereShape);
+
+                case CAPSULE_SHAPE_PROXYTYPE:
+                    return sizeof(btCapsuleShape);
+
+                case CONVEX_HULL_SHAPE_PROXYTYPE: {
+                    const auto& hull = static_cast<const btConvexHullShape&>(shape);
+                    return sizeof(btConvexHullShape) + static_cast<size_t>(hull.getNumPoints()) * sizeof(btVector3);
+                }
+
+                case TRIANGLE_MESH_SHAPE_PROXYTYPE: {
+                    // getOptimizedBvh has no const overload
+                    auto& mesh = const_cast<btBvhTriangleMeshShape&>(static_cast<const btBvhTriangleMeshShape&>(shape));
+                    size_t bytes = sizeof(btBvhTriangleMeshShape) + sizeof(btTriangleIndexVertexArray);
+                    if (const btOptimizedBvh* bvh = mesh.getOptimizedBvh()) {
+                        bytes += bvh->calculateSerializeBufferSize();
+                    }
+                    return bytes;
+                }
+
+                case SCALED_TRIANGLE_MESH_SHAPE_PROXYTYPE: {
+                    const auto& scaled = static_cast<const btScaledBvhTriangleMeshShape&>(shape);
+                    size_t bytes = sizeof(btScaledBvhTriangleMeshShape);
+                    if (includeChildren && scaled.getChildShape()) {
+                        bytes += EstimateMemoryUsage(*scaled.getChildShape(), true);
+                    }
+                    return bytes;
+                }
+
+                case COMPOUND_SHAPE_PROXYTYPE: {
+                    const auto& compound = static_cast<const btCompoundShape&>(shape);
+                    // Each child has its own entry and a leaf in the compound's dynamic AABB tree
+                    size_t bytes = sizeof(btCompoundShape) +
+                                   static_cast<size_t>(compound.getNumChildShapes()) * (sizeof(btCompoundShapeChild) + 2 * sizeof(btDbvtNode));
+                    if (includeChildren) {
+                        for (int i = 0; i < compound.getNumChildShapes(); ++i) {
+                            bytes += EstimateMemoryUsage(*compound.getChildShape(i), true);
+                        }
+                    }
+                    return bytes;
+                }
+
+                default:
+                    return sizeof(btCollisionShape);
+            }
+        }
+
         bool CollisionShapeFactory::ValidateShapeParameters(const CollisionShape& desc) {
             switch (desc.type) {
                 case CollisionShape::Box:
@@ -64,9 +328,20 @@ namespace GameEngine {
                     return desc.dimensions.x > 0.0f && desc.dimensions.y > 0.0f;
                 
                 case CollisionShape::Mesh:
-                    // Mesh validation would require checking mesh data
-                    // For now, return false since mesh shapes aren't implemented
-                    return false;
+                    // Needs an indexed triangle list and a non-zero scale
+                    return desc.mesh && desc.mesh->IsValidTriangleMesh() &&
+                           desc.dimensions.x != 0.0f && desc.dimensions.y != 0.0f && desc.dimensions.z != 0.0f;
+
+                case CollisionShape::ConvexHull:
+                    // Needs points; scale must be positive
+                    return desc.mesh && !desc.mesh->GetPositions().empty() &&
+                           desc.dimensions.x > 0.0f && desc.dimensions.y > 0.0f && desc.dimensions.z > 0.0f;
+
+                case CollisionShape::Compound:
+                    // Needs at least one child, and every child must be valid itself
+                    return !desc.children.empty() &&
+                           std::all_of(desc.children.begin(), desc.children.end(),
+                                       [](const CollisionShape::Child& child) { return ValidateShapeParameters(child.shape); });
                 
                 default:
                     return false;
@@ -75,4 +350,4 @@ namespace GameEngine {
     }
 }
 
-#endif // GAMEENGINE_HAS_BULLET
\ No newline at end of file
+#endif // GAMEENGINE_HAS_BULLET
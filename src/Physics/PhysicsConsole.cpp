@@ -293,6 +293,7 @@ namespace GameEngine {
             oss << "  CCD Enabled: " << (config.enableCCD ? "Yes" : "No") << "\n";
             oss << "  Linear Damping: " << FormatFloat(config.linearDamping) << "\n";
             oss << "  Angular Damping: " << FormatFloat(config.angularDamping) << "\n";
+            oss << "  Simulation Threads: " << m_engine->GetSimulationThreadCount() << "\n";
             
             return oss.str();
         }
@@ -1,14 +1,31 @@
 #include "Physics/PhysicsEngine.h"
 #include "Physics/PhysicsDebugDrawer.h"
 #include "Core/Logger.h"
+#include "Resource/ParallelImport.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
 
 #ifdef GAMEENGINE_HAS_BULLET
 #include "Physics/BulletPhysicsWorld.h"
 #include "Physics/BulletUtils.h"
 #include "Physics/CollisionShapeFactory.h"
+#include "Physics/CollisionShapeCache.h"
+#include <BulletCollision/CollisionDispatch/btCollisionObjectWrapper.h>
+#include <BulletCollision/CollisionDispatch/btManifoldResult.h>
 #endif
 
 namespace GameEngine {
+#ifdef GAMEENGINE_HAS_BULLET
+    namespace {
+        // Normalized lerp along the shorter arc; steps are small enough that it tracks slerp closely
+        Math::Quat NlerpShortest(const Math::Quat& from, const Math::Quat& to, float t) {
+            const float sign = glm::dot(from, to) < 0.0f ? -1.0f : 1.0f;
+            return glm::normalize(from * (1.0f - t) + to * (sign * t));
+        }
+    }
+#endif
+
     PhysicsEngine::PhysicsEngine() 
         : m_debugMode(Physics::PhysicsDebugMode::None), m_debugDrawingEnabled(false) {
     }
@@ -30,6 +47,8 @@ namespace GameEngine {
                  ", MaxSubSteps: " + std::to_string(config.maxSubSteps) + 
                  ", SolverIterations: " + std::to_string(config.solverIterations));
         
+        m_shapeCache = std::make_unique<Physics::CollisionShapeCache>(config.collisionCacheDirectory);
+
         // Create and set default physics world
         m_activeWorld = CreateWorld(config);
         if (!m_activeWorld) {
@@ -49,19 +68,100 @@ namespace GameEngine {
 #ifdef GAMEENGINE_HAS_BULLET
         m_bulletBodies.clear();
         m_bulletGhostObjects.clear();
+        m_motionBodies.clear();
+        m_previousPositions.clear();
+        m_currentPositions.clear();
+        m_previousRotations.clear();
+        m_currentRotations.clear();
+        m_motionSlots.clear();
+        m_frameForces.clear();
 #endif
+        m_timeAccumulator = 0.0;
+        m_interpolationAlpha = 0.0f;
         m_activeWorld.reset();
+#ifdef GAMEENGINE_HAS_BULLET
+        // Released after the world so no collision object outlives its shape
+        m_objectShapes.clear();
+        m_shapeCache.reset();
+#endif
         LOG_INFO("Physics Engine shutdown");
     }
 
     void PhysicsEngine::Update(float deltaTime) {
-        if (m_activeWorld) {
-            m_activeWorld->Step(deltaTime);
+        if (!m_activeWorld) {
+            return;
+        }
+
+        // Without substeps the world takes the frame delta as one variable step, as Bullet does
+        const float timeStep = m_configuration.timeStep;
+        const bool fixedStep = m_configuration.maxSubSteps > 0 && timeStep > 0.0f;
+        float stepTime = deltaTime;
+        int steps = 1;
+        if (fixedStep) {
+            stepTime = timeStep;
+            m_timeAccumulator += deltaTime;
+            steps = static_cast<int>(m_timeAccumulator / timeStep);
+            if (steps > m_configuration.maxSubSteps) {
+                // Too far behind to catch up: drop the backlog rather than spiral
+                steps = m_configuration.maxSubSteps;
+                m_timeAccumulator = std::fmod(m_timeAccumulator, static_cast<double>(timeStep));
+            } else {
+                m_timeAccumulator -= steps * static_cast<double>(timeStep);
+            }
+            m_interpolationAlpha = std::clamp(static_cast<float>(m_timeAccumulator / timeStep), 0.0f, 1.0f);
+        } else {
+            m_timeAccumulator = 0.0;
+            m_interpolationAlpha = 1.0f;
+        }
+
+#ifdef GAMEENGINE_HAS_BULLET
+        auto bulletWorldPtr = std::dynamic_pointer_cast<BulletPhysicsWorld>(m_activeWorld);
+        for (int step = 0; step < steps; ++step) {
+            if (step > 0) {
+                for (const auto& [bodyId, force] : m_frameForces) {
+                    auto bulletBodyIt = m_bulletBodies.find(bodyId);
+                    if (bulletBodyIt != m_bulletBodies.end()) {
+                        bulletBodyIt->second->applyCentralForce(force);
+                    }
+                }
+            }
+            if (step == steps - 1) {
+                // Only the last step's start pose is needed to interpolate; after a single step
+                // it is the pose captured at the end of the previous Update
+                CapturePreviousTransforms(steps > 1);
+            }
+
+            if (bulletWorldPtr && fixedStep) {
+                bulletWorldPtr->StepFixed(stepTime);
+            } else {
+                m_activeWorld->Step(stepTime);
+            }
+            ++m_stepCount;
+        }
+
+        if (steps > 0) {
+            CaptureCurrentTransforms();
+        } else if (bulletWorldPtr && bulletWorldPtr->GetBulletWorld()) {
+            // Bullet drops forces on frames without a step too
+            bulletWorldPtr->GetBulletWorld()->clearForces();
+        }
+        m_frameForces.clear();
+#else
+        for (int step = 0; step < steps; ++step) {
+            m_activeWorld->Step(stepTime);
+            ++m_stepCount;
         }
+#endif
     }
 
     void PhysicsEngine::SetConfiguration(const PhysicsConfiguration& config) {
         m_configuration = config;
+
+#ifdef GAMEENGINE_HAS_BULLET
+        if (m_shapeCache) {
+            m_shapeCache->SetBvhDirectory(config.collisionCacheDirectory);
+        }
+#endif
         
         // Apply configuration to active world if it exists
         if (m_activeWorld) {
@@ -144,7 +244,7 @@ namespace GameEngine {
 
     std::shared_ptr<PhysicsWorld> PhysicsEngine::CreateWorld(const PhysicsConfiguration& config) {
 #ifdef GAMEENGINE_HAS_BULLET
-        return std::make_shared<BulletPhysicsWorld>(config);
+        return std::make_shared<BulletPhysicsWorld>(config, m_jobSystem);
 #else
         return std::make_shared<PhysicsWorld>(config.gravity);
 #endif
@@ -160,15 +260,21 @@ namespace GameEngine {
 #ifdef GAMEENGINE_HAS_BULLET
         if (m_activeWorld) {
             // Create Bullet collision shape
-            auto bulletShape = Physics::CollisionShapeFactory::CreateShape(shape);
+            auto bulletShape = AcquireShape(shape);
             if (!bulletShape) {
                 LOG_ERROR("Failed to create collision shape for rigid body");
                 return 0;
             }
+
+            // Bullet only collides triangle meshes correctly when they do not move
+            const bool isStatic = bodyDesc.isStatic || shape.type == CollisionShape::Mesh;
+            if (isStatic && !bodyDesc.isStatic) {
+                LOG_WARNING("Triangle mesh shapes are static only; rigid body " + std::to_string(id) + " created as static");
+            }
             
             // Calculate local inertia
             btVector3 localInertia(0, 0, 0);
-            if (!bodyDesc.isStatic && bodyDesc.mass > 0.0f) {
+            if (!isStatic && bodyDesc.mass > 0.0f) {
                 bulletShape->calculateLocalInertia(bodyDesc.mass, localInertia);
             }
             
@@ -178,9 +284,9 @@ namespace GameEngine {
             
             // Create rigid body construction info
             btRigidBody::btRigidBodyConstructionInfo rbInfo(
-                bodyDesc.isStatic ? 0.0f : bodyDesc.mass,
+                isStatic ? 0.0f : bodyDesc.mass,
                 motionState.release(),
-                bulletShape.release(),
+                bulletShape.get(),
                 localInertia
             );
             
@@ -188,8 +294,9 @@ namespace GameEngine {
             rbInfo.m_restitution = bodyDesc.restitution;
             rbInfo.m_friction = bodyDesc.friction;
             
-            // Create the rigid body
+            // Create the rigid body; batched queries map hits back to the ID through the user index
             auto bulletBody = std::make_unique<btRigidBody>(rbInfo);
+            bulletBody->setUserIndex(static_cast<int>(id));
             
             // Set kinematic flag if needed
             if (bodyDesc.isKinematic) {
@@ -198,7 +305,7 @@ namespace GameEngine {
             }
             
             // Set initial velocity
-            if (!bodyDesc.isStatic) {
+            if (!isStatic) {
                 bulletBody->setLinearVelocity(Physics::BulletUtils::ToBullet(bodyDesc.velocity));
                 bulletBody->setAngularVelocity(Physics::BulletUtils::ToBullet(bodyDesc.angularVelocity));
             }
@@ -209,6 +316,10 @@ namespace GameEngine {
                 btRigidBody* rawBodyPtr = bulletBody.release();
                 bulletWorldPtr->AddRigidBody(id, rawBodyPtr);
                 m_bulletBodies[id] = rawBodyPtr;
+                m_objectShapes[id] = std::move(bulletShape);
+                if (!isStatic) {
+                    AddMotionSlot(id, rawBodyPtr);
+                }
                 LOG_DEBUG("Created Bullet rigid body with ID: " + std::to_string(id));
             } else {
                 LOG_ERROR("Active world is not a BulletPhysicsWorld");
@@ -233,6 +344,9 @@ namespace GameEngine {
                 bulletWorldPtr->RemoveRigidBody(bodyId);
             }
             
+            RemoveMotionSlot(bodyId);
+            m_frameForces.erase(bodyId);
+            
             // Clean up the rigid body and its components
             if (bulletBody) {
                 // Delete motion state
@@ -240,15 +354,12 @@ namespace GameEngine {
                     delete bulletBody->getMotionState();
                 }
                 
-                // Delete collision shape
-                if (bulletBody->getCollisionShape()) {
-                    delete bulletBody->getCollisionShape();
-                }
-                
                 // Delete the rigid body itself
                 delete bulletBody;
             }
             
+            // Release the body's reference to its (possibly shared) collision shape
+            m_objectShapes.erase(bodyId);
             m_bulletBodies.erase(bulletBodyIt);
             LOG_DEBUG("Destroyed Bullet rigid body with ID: " + std::to_string(bodyId));
         } else {
@@ -280,6 +391,15 @@ namespace GameEngine {
                     }
                     bulletBody->activate(true);
                 }
+
+                // Teleports are not interpolated
+                auto slotIt = m_motionSlots.find(bodyId);
+                if (slotIt != m_motionSlots.end()) {
+                    const uint32_t slot = slotIt->second;
+                    m_previousPositions[slot] = m_currentPositions[slot] = position;
+                    m_previousRotations[slot] = m_currentRotations[slot] = rotation;
+                    m_motionBodies[slot].lastMovedStep = m_stepCount;
+                }
                 
                 LOG_DEBUG("Updated transform for rigid body with ID: " + std::to_string(bodyId));
             }
@@ -300,6 +420,11 @@ namespace GameEngine {
                 btVector3 bulletForce = Physics::BulletUtils::ToBullet(force);
                 bulletBody->applyCentralForce(bulletForce);
                 bulletBody->activate(true);
+
+                auto [frameForceIt, inserted] = m_frameForces.try_emplace(bodyId, bulletForce);
+                if (!inserted) {
+                    frameForceIt->second += bulletForce;
+                }
                 LOG_DEBUG("Applied force to rigid body with ID: " + std::to_string(bodyId));
             }
         } else {
@@ -371,6 +496,119 @@ namespace GameEngine {
 #endif
     }
 
+    CollisionShapeCacheStats PhysicsEngine::GetShapeCacheStats() const {
+#ifdef GAMEENGINE_HAS_BULLET
+        if (m_shapeCache) {
+            return m_shapeCache->GetStats();
+        }
+#endif
+        return CollisionShapeCacheStats{};
+    }
+
+    size_t PhysicsEngine::PurgeShapeCache() {
+#ifdef GAMEENGINE_HAS_BULLET
+        if (m_shapeCache) {
+            const size_t purged = m_shapeCache->Purge();
+            LOG_DEBUG("Purged " + std::to_string(purged) + " unused collision shapes");
+            return purged;
+        }
+#endif
+        return 0;
+    }
+
+    int PhysicsEngine::GetSimulationThreadCount() const {
+#ifdef GAMEENGINE_HAS_BULLET
+        if (auto bulletWorldPtr = std::dynamic_pointer_cast<BulletPhysicsWorld>(m_activeWorld)) {
+            return bulletWorldPtr->GetSimulationThreadCount();
+        }
+#endif
+        return 1;
+    }
+
+#ifdef GAMEENGINE_HAS_BULLET
+    void PhysicsEngine::AddMotionSlot(uint32_t bodyId, btRigidBody* body) {
+        const btTransform& transform = body->getWorldTransform();
+        const Math::Vec3 position = Physics::BulletUtils::FromBullet(transform.getOrigin());
+        const Math::Quat rotation = Physics::BulletUtils::FromBullet(transform.getRotation());
+
+        m_motionSlots[bodyId] = static_cast<uint32_t>(m_motionBodies.size());
+        m_motionBodies.push_back(BodyMotion{ body, bodyId, m_stepCount, body->isActive() });
+        m_previousPositions.push_back(position);
+        m_currentPositions.push_back(position);
+        m_previousRotations.push_back(rotation);
+        m_currentRotations.push_back(rotation);
+    }
+
+    void PhysicsEngine::RemoveMotionSlot(uint32_t bodyId) {
+        auto slotIt = m_motionSlots.find(bodyId);
+        if (slotIt == m_motionSlots.end()) {
+            return;
+        }
+
+        // Move the last slot into the hole to keep the arrays dense
+        const uint32_t slot = slotIt->second;
+        const uint32_t last = static_cast<uint32_t>(m_motionBodies.size() - 1);
+        if (slot != last) {
+            m_motionBodies[slot] = m_motionBodies[last];
+            m_previousPositions[slot] = m_previousPositions[last];
+            m_currentPositions[slot] = m_currentPositions[last];
+            m_previousRotations[slot] = m_previousRotations[last];
+            m_currentRotations[slot] = m_currentRotations[last];
+            m_motionSlots[m_motionBodies[slot].bodyId] = slot;
+        }
+        m_motionBodies.pop_back();
+        m_previousPositions.pop_back();
+        m_currentPositions.pop_back();
+        m_previousRotations.pop_back();
+        m_currentRotations.pop_back();
+        m_motionSlots.erase(slotIt);
+    }
+
+    void PhysicsEngine::CapturePreviousTransforms(bool readWorld) {
+        // The current arrays are only stale when earlier steps of this Update moved bodies
+        for (size_t i = 0; i < m_motionBodies.size(); ++i) {
+            const BodyMotion& motion = m_motionBodies[i];
+            if (readWorld && (motion.active || motion.body->isActive())) {
+                const btTransform& transform = motion.body->getWorldTransform();
+                m_previousPositions[i] = Physics::BulletUtils::FromBullet(transform.getOrigin());
+                m_previousRotations[i] = Physics::BulletUtils::FromBullet(transform.getRotation());
+            } else {
+                m_previousPositions[i] = m_currentPositions[i];
+                m_previousRotations[i] = m_currentRotations[i];
+            }
+        }
+    }
+
+    void PhysicsEngine::CaptureCurrentTransforms() {
+        // Sleeping bodies keep their pose, so only bodies awake before or after the step are read
+        for (size_t i = 0; i < m_motionBodies.size(); ++i) {
+            BodyMotion& motion = m_motionBodies[i];
+            const bool awake = motion.body->isActive();
+            if (awake || motion.active) {
+                const btTransform& transform = motion.body->getWorldTransform();
+                const Math::Vec3 position = Physics::BulletUtils::FromBullet(transform.getOrigin());
+                const Math::Quat rotation = Physics::BulletUtils::FromBullet(transform.getRotation());
+                if (position != m_currentPositions[i] || rotation != m_currentRotations[i]) {
+                    motion.lastMovedStep = m_stepCount;
+                }
+                m_currentPositions[i] = position;
+                m_currentRotations[i] = rotation;
+            }
+            motion.active = awake;
+        }
+    }
+
+    std::shared_ptr<btCollisionShape> PhysicsEngine::AcquireShape(const CollisionShape& shape) {
+        if (!m_configuration.shareCollisionShapes) {
+            return Physics::CollisionShapeFactory::CreateShape(shape);
+        }
+        if (!m_shapeCache) {
+            m_shapeCache = std::make_unique<Physics::CollisionShapeCache>(m_configuration.collisionCacheDirectory);
+        }
+        return m_shapeCache->Acquire(shape);
+    }
+#endif
+
     bool PhysicsEngine::GetRigidBodyTransform(uint32_t bodyId, Math::Vec3& position, Math::Quat& rotation) {
 #ifdef GAMEENGINE_HAS_BULLET
         auto bulletBodyIt = m_bulletBodies.find(bodyId);
@@ -387,6 +625,83 @@ namespace GameEngine {
         return false;
     }
 
+    bool PhysicsEngine::GetInterpolatedTransform(uint32_t bodyId, Math::Vec3& position, Math::Quat& rotation) const {
+#ifdef GAMEENGINE_HAS_BULLET
+        auto slotIt = m_motionSlots.find(bodyId);
+        if (slotIt != m_motionSlots.end()) {
+            const uint32_t slot = slotIt->second;
+            position = Math::Lerp(m_previousPositions[slot], m_currentPositions[slot], m_interpolationAlpha);
+            rotation = NlerpShortest(m_previousRotations[slot], m_currentRotations[slot], m_interpolationAlpha);
+            return true;
+        }
+
+        // Static bodies do not move
+        auto bulletBodyIt = m_bulletBodies.find(bodyId);
+        if (bulletBodyIt != m_bulletBodies.end() && bulletBodyIt->second) {
+            const btTransform& transform = bulletBodyIt->second->getWorldTransform();
+            position = Physics::BulletUtils::FromBullet(transform.getOrigin());
+            rotation = Physics::BulletUtils::FromBullet(transform.getRotation());
+            return true;
+        }
+#endif
+        return false;
+    }
+
+    bool PhysicsEngine::GetInterpolatedTransform(uint32_t bodyId, uint32_t& slotHint, Math::Vec3& position, Math::Quat& rotation) const {
+#ifdef GAMEENGINE_HAS_BULLET
+        // Removals swap the last body into the freed slot, so a cached slot is checked before use
+        if (slotHint >= m_motionBodies.size() || m_motionBodies[slotHint].bodyId != bodyId) {
+            auto slotIt = m_motionSlots.find(bodyId);
+            if (slotIt == m_motionSlots.end()) {
+                slotHint = INVALID_MOTION_SLOT;
+                return GetInterpolatedTransform(bodyId, position, rotation);
+            }
+            slotHint = slotIt->second;
+        }
+
+        position = Math::Lerp(m_previousPositions[slotHint], m_currentPositions[slotHint], m_interpolationAlpha);
+        rotation = NlerpShortest(m_previousRotations[slotHint], m_currentRotations[slotHint], m_interpolationAlpha);
+        return true;
+#else
+        slotHint = INVALID_MOTION_SLOT;
+        return GetInterpolatedTransform(bodyId, position, rotation);
+#endif
+    }
+
+    size_t PhysicsEngine::SyncTransforms(TransformSyncBuffer& buffer, bool movedOnly) {
+        buffer.bodyIds.clear();
+        buffer.positions.clear();
+        buffer.rotations.clear();
+
+#ifdef GAMEENGINE_HAS_BULLET
+        const size_t count = m_motionBodies.size();
+        buffer.bodyIds.reserve(count);
+        buffer.positions.reserve(count);
+        buffer.rotations.reserve(count);
+
+        const float alpha = m_interpolationAlpha;
+        for (size_t i = 0; i < count; ++i) {
+            const BodyMotion& motion = m_motionBodies[i];
+            // Bodies that moved in the last step are still interpolating; ones that stopped
+            // since the previous sync still need their final pose written once
+            if (movedOnly && motion.lastMovedStep < m_lastSyncStep) {
+                continue;
+            }
+
+            buffer.bodyIds.push_back(motion.bodyId);
+            if (motion.lastMovedStep == m_stepCount) {
+                buffer.positions.push_back(Math::Lerp(m_previousPositions[i], m_currentPositions[i], alpha));
+                buffer.rotations.push_back(NlerpShortest(m_previousRotations[i], m_currentRotations[i], alpha));
+            } else {
+                buffer.positions.push_back(m_currentPositions[i]);
+                buffer.rotations.push_back(m_currentRotations[i]);
+            }
+        }
+        m_lastSyncStep = m_stepCount;
+#endif
+        return buffer.Size();
+    }
+
     bool PhysicsEngine::GetRigidBodyVelocity(uint32_t bodyId, Math::Vec3& velocity, Math::Vec3& angularVelocity) {
 #ifdef GAMEENGINE_HAS_BULLET
         auto bulletBodyIt = m_bulletBodies.find(bodyId);
@@ -681,13 +996,373 @@ namespace GameEngine {
 #endif
     }
 
+#ifdef GAMEENGINE_HAS_BULLET
+    namespace {
+        // Below this many queries per thread the hand-off costs more than the queries themselves
+        constexpr size_t MinQueriesPerChunk = 32;
+
+        btDiscreteDynamicsWorld* GetQueryWorld(const std::shared_ptr<PhysicsWorld>& world) {
+            auto bulletWorldPtr = std::dynamic_pointer_cast<BulletPhysicsWorld>(world);
+            return bulletWorldPtr ? bulletWorldPtr->GetBulletWorld() : nullptr;
+        }
+
+        btDbvtBroadphase* GetQueryBroadphase(btDiscreteDynamicsWorld* bulletWorld) {
+            return bulletWorld ? dynamic_cast<btDbvtBroadphase*>(bulletWorld->getBroadphase()) : nullptr;
+        }
+
+        // Gathers the rigid bodies in the broadphase leaves a query reaches, applying the query
+        // filter up front so the narrowphase only runs on bodies that can be reported
+        struct CandidateCollector : public btDbvt::ICollide {
+            std::vector<btCollisionObject*>& candidates;
+            const QueryFilter& filter;
+
+            CandidateCollector(std::vector<btCollisionObject*>& c, const QueryFilter& f)
+                : candidates(c), filter(f) {
+                candidates.clear();
+            }
+
+            using btDbvt::ICollide::Process;
+            void Process(const btDbvtNode* leaf) override {
+                const btBroadphaseProxy* proxy = static_cast<const btBroadphaseProxy*>(leaf->data);
+                if (!(proxy->m_collisionFilterGroup & filter.filterMask) ||
+                    !(filter.filterGroup & proxy->m_collisionFilterMask)) {
+                    return;
+                }
+
+                btCollisionObject* object = static_cast<btCollisionObject*>(proxy->m_clientObject);
+                const int bodyId = object->getUserIndex();
+                if (bodyId > 0 && static_cast<uint32_t>(bodyId) != filter.ignoreBodyId && btRigidBody::upcast(object)) {
+                    candidates.push_back(object);
+                }
+            }
+        };
+
+        // Both trees are walked as btDbvtBroadphase keeps dynamic and static proxies apart. Unless
+        // Bullet is built with BT_THREADSAFE, btDbvtBroadphase::rayTest shares one traversal stack
+        // between callers, so each worker passes its own to rayTestInternal instead.
+        void CollectInBox(const btDbvtBroadphase& broadphase, const btVector3& aabbMin, const btVector3& aabbMax,
+                          CandidateCollector& collector) {
+            const btDbvtVolume volume = btDbvtVolume::FromMM(aabbMin, aabbMax);
+            for (const btDbvt& tree : broadphase.m_sets) {
+                tree.collideTV(tree.m_root, volume, collector);
+            }
+        }
+
+        // shapeMin/shapeMax are the swept shape's bounds around its origin, zero for a ray
+        void CollectAlongSegment(const btDbvtBroadphase& broadphase, const btVector3& from, const btVector3& to,
+                                 const btVector3& shapeMin, const btVector3& shapeMax,
+                                 btAlignedObjectArray<const btDbvtNode*>& stack, CandidateCollector& collector) {
+            btVector3 direction = to - from;
+            const btScalar length = direction.length();
+            if (length <= SIMD_EPSILON) {
+                CollectInBox(broadphase, from + shapeMin, from + shapeMax, collector);
+                return;
+            }
+
+            direction /= length;
+            const btVector3 inverse(direction.x() == btScalar(0) ? btScalar(BT_LARGE_FLOAT) : btScalar(1) / direction.x(),
+                                    direction.y() == btScalar(0) ? btScalar(BT_LARGE_FLOAT) : btScalar(1) / direction.y(),
+                                    direction.z() == btScalar(0) ? btScalar(BT_LARGE_FLOAT) : btScalar(1) / direction.z());
+            unsigned int signs[3] = { inverse.x() < 0, inverse.y() < 0, inverse.z() < 0 };
+
+            for (const btDbvt& tree : broadphase.m_sets) {
+                tree.rayTestInternal(tree.m_root, from, to, inverse, signs, length, shapeMin, shapeMax, stack, collector);
+            }
+        }
+
+        // Keeps the deepest contact a collision algorithm reports between the query sphere and one body
+        struct DeepestContactResult : public btManifoldResult {
+            const btCollisionObject* queryObject;
+            bool hasContact = false;
+            btScalar depth = 0;
+            btVector3 point{0, 0, 0};   // On the query sphere
+            btVector3 normal{0, 0, 0};  // From the body towards the query
+
+            DeepestContactResult(const btCollisionObjectWrapper* queryWrap, const btCollisionObjectWrapper* bodyWrap)
+                : btManifoldResult(queryWrap, bodyWrap), queryObject(queryWrap->getCollisionObject()) {}
+
+            void addContactPoint(const btVector3& normalOnBInWorld, const btVector3& pointInWorld, btScalar distance) override {
+                // Closest-point algorithms also report pairs that are near but separated
+                if (distance > 0 || (hasContact && distance >= depth)) {
+                    return;
+                }
+
+                // Points and normal follow the manifold's body order, which some algorithms swap
+                const bool swapped = m_manifoldPtr && m_manifoldPtr->getBody0() != queryObject;
+                hasContact = true;
+                depth = distance;
+                normal = swapped ? -normalOnBInWorld : normalOnBInWorld;
+                point = swapped ? pointInWorld : pointInWorld + normalOnBInWorld * distance;
+            }
+        };
+    }
+
+    struct PhysicsEngine::QueryContext {
+        btAlignedObjectArray<const btDbvtNode*> stack;
+        std::vector<btCollisionObject*> candidates;
+        btCollisionObject queryObject;
+
+        // Overlap tests allocate collision algorithms and manifolds from a dispatcher's pools, which
+        // are not thread-safe, so every context gets a small dispatcher of its own
+        std::unique_ptr<btDefaultCollisionConfiguration> collisionConfig;
+        std::unique_ptr<btCollisionDispatcher> dispatcher;
+
+        btCollisionDispatcher& GetDispatcher() {
+            if (!dispatcher) {
+                btDefaultCollisionConstructionInfo info;
+                info.m_defaultMaxPersistentManifoldPoolSize = 16;
+                info.m_defaultMaxCollisionAlgorithmPoolSize = 16;
+                collisionConfig = std::make_unique<btDefaultCollisionConfiguration>(info);
+                dispatcher = std::make_unique<btCollisionDispatcher>(collisionConfig.get());
+            }
+            return *dispatcher;
+        }
+    };
+
+    template <typename Body>
+    void PhysicsEngine::RunQueryChunks(size_t count, const Body& body) {
+        const size_t threads = m_configuration.queryThreads > 0
+            ? static_cast<size_t>(m_configuration.queryThreads)
+            : std::max(1u, std::thread::hardware_concurrency());
+        const size_t chunks = std::max<size_t>(1, std::min(threads, (count + MinQueriesPerChunk - 1) / MinQueriesPerChunk));
+
+        std::vector<std::unique_ptr<QueryContext>> contexts(chunks);
+        {
+            std::lock_guard<std::mutex> lock(m_queryContextMutex);
+            for (auto& context : contexts) {
+                if (m_queryContexts.empty()) {
+                    context = std::make_unique<QueryContext>();
+                } else {
+                    context = std::move(m_queryContexts.back());
+                    m_queryContexts.pop_back();
+                }
+            }
+        }
+
+        // One contiguous range and one context per chunk, so workers never share scratch
+        const size_t perChunk = (count + chunks - 1) / chunks;
+        auto runChunk = [&](size_t chunk) {
+            const size_t begin = chunk * perChunk;
+            const size_t end = std::min(count, begin + perChunk);
+            if (begin < end) {
+                body(*contexts[chunk], begin, end);
+            }
+        };
+
+        if (chunks == 1) {
+            runChunk(0);
+        } else {
+            ParallelImportFor(chunks, runChunk, m_jobSystem, threads);
+        }
+
+        // Contexts of a batch that threw are dropped rather than returned
+        std::lock_guard<std::mutex> lock(m_queryContextMutex);
+        for (auto& context : contexts) {
+            m_queryContexts.push_back(std::move(context));
+        }
+    }
+#endif
+
+    bool PhysicsEngine::RaycastBatch(std::span<const RaycastQuery> queries, std::span<RaycastHit> results) {
+        if (results.size() < queries.size()) {
+            LOG_ERROR("Raycast batch: " + std::to_string(queries.size()) + " queries but room for " +
+                     std::to_string(results.size()) + " results");
+            return false;
+        }
+
+#ifdef GAMEENGINE_HAS_BULLET
+        btDbvtBroadphase* broadphase = GetQueryBroadphase(GetQueryWorld(m_activeWorld));
+        if (!broadphase) {
+            LOG_WARNING("Cannot perform raycast batch: No active Bullet world");
+            return false;
+        }
+
+        RunQueryChunks(queries.size(), [&](QueryContext& context, size_t begin, size_t end) {
+            const btVector3 zero(0, 0, 0);
+            for (size_t i = begin; i < end; ++i) {
+                const RaycastQuery& query = queries[i];
+                RaycastHit& result = results[i];
+                result = RaycastHit{};
+
+                const float directionLength = glm::length(query.direction);
+                if (directionLength <= 0.0f || query.maxDistance <= 0.0f) {
+                    continue;
+                }
+
+                const btVector3 rayFrom = Physics::BulletUtils::ToBullet(query.origin);
+                const btVector3 rayTo = Physics::BulletUtils::ToBullet(
+                    query.origin + query.direction * (query.maxDistance / directionLength));
+
+                CandidateCollector collector(context.candidates, query.filter);
+                CollectAlongSegment(*broadphase, rayFrom, rayTo, zero, zero, context.stack, collector);
+
+                const btTransform fromTransform(btQuaternion::getIdentity(), rayFrom);
+                const btTransform toTransform(btQuaternion::getIdentity(), rayTo);
+                btCollisionWorld::ClosestRayResultCallback callback(rayFrom, rayTo);
+                for (btCollisionObject* object : context.candidates) {
+                    btCollisionWorld::rayTestSingle(fromTransform, toTransform, object, object->getCollisionShape(),
+                                                    object->getWorldTransform(), callback);
+                }
+
+                if (callback.hasHit()) {
+                    result.hasHit = true;
+                    result.bodyId = static_cast<uint32_t>(callback.m_collisionObject->getUserIndex());
+                    result.point = Physics::BulletUtils::FromBullet(callback.m_hitPointWorld);
+                    result.normal = Physics::BulletUtils::FromBullet(callback.m_hitNormalWorld);
+                    result.distance = callback.m_closestHitFraction * query.maxDistance;
+                }
+            }
+        });
+        return true;
+#else
+        LOG_WARNING("Raycast batch not supported: Bullet Physics not available");
+        return false;
+#endif
+    }
+
+    bool PhysicsEngine::SweepBatch(std::span<const SweepQuery> queries, std::span<SweepHit> results) {
+        if (results.size() < queries.size()) {
+            LOG_ERROR("Sweep batch: " + std::to_string(queries.size()) + " queries but room for " +
+                     std::to_string(results.size()) + " results");
+            return false;
+        }
+
+#ifdef GAMEENGINE_HAS_BULLET
+        btDiscreteDynamicsWorld* bulletWorld = GetQueryWorld(m_activeWorld);
+        btDbvtBroadphase* broadphase = GetQueryBroadphase(bulletWorld);
+        if (!broadphase) {
+            LOG_WARNING("Cannot perform sweep batch: No active Bullet world");
+            return false;
+        }
+        const btScalar allowedPenetration = bulletWorld->getDispatchInfo().m_allowedCcdPenetration;
+
+        RunQueryChunks(queries.size(), [&](QueryContext& context, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const SweepQuery& query = queries[i];
+                SweepHit& result = results[i];
+                result = SweepHit{};
+
+                btSphereShape sphere(query.radius);
+                btCapsuleShape capsule(query.radius, query.height);
+                const btConvexShape* castShape = query.height > 0.0f
+                    ? static_cast<const btConvexShape*>(&capsule) : static_cast<const btConvexShape*>(&sphere);
+
+                btVector3 shapeMin, shapeMax;
+                castShape->getAabb(btTransform::getIdentity(), shapeMin, shapeMax);
+
+                const btVector3 sweepFrom = Physics::BulletUtils::ToBullet(query.from);
+                const btVector3 sweepTo = Physics::BulletUtils::ToBullet(query.to);
+                CandidateCollector collector(context.candidates, query.filter);
+                CollectAlongSegment(*broadphase, sweepFrom, sweepTo, shapeMin, shapeMax, context.stack, collector);
+
+                const btTransform fromTransform(btQuaternion::getIdentity(), sweepFrom);
+                const btTransform toTransform(btQuaternion::getIdentity(), sweepTo);
+                btCollisionWorld::ClosestConvexResultCallback callback(sweepFrom, sweepTo);
+                for (btCollisionObject* object : context.candidates) {
+                    btCollisionWorld::objectQuerySingle(castShape, fromTransform, toTransform, object,
+                                                        object->getCollisionShape(), object->getWorldTransform(),
+                                                        callback, allowedPenetration);
+                }
+
+                if (callback.hasHit()) {
+                    result.hasHit = true;
+                    result.bodyId = static_cast<uint32_t>(callback.m_hitCollisionObject->getUserIndex());
+                    result.point = Physics::BulletUtils::FromBullet(callback.m_hitPointWorld);
+                    result.normal = Physics::BulletUtils::FromBullet(callback.m_hitNormalWorld);
+                    result.fraction = callback.m_closestHitFraction;
+                    result.distance = glm::length(query.to - query.from) * result.fraction;
+                }
+            }
+        });
+        return true;
+#else
+        LOG_WARNING("Sweep batch not supported: Bullet Physics not available");
+        return false;
+#endif
+    }
+
+    bool PhysicsEngine::OverlapBatch(std::span<const OverlapQuery> queries, std::span<OverlapResult> results,
+                                     std::span<uint32_t> counts, uint32_t maxResultsPerQuery) {
+        if (counts.size() < queries.size() || results.size() < queries.size() * maxResultsPerQuery) {
+            LOG_ERROR("Overlap batch: " + std::to_string(queries.size()) + " queries of up to " +
+                     std::to_string(maxResultsPerQuery) + " results but room for " + std::to_string(results.size()) +
+                     " results and " + std::to_string(counts.size()) + " counts");
+            return false;
+        }
+
+#ifdef GAMEENGINE_HAS_BULLET
+        btDiscreteDynamicsWorld* bulletWorld = GetQueryWorld(m_activeWorld);
+        btDbvtBroadphase* broadphase = GetQueryBroadphase(bulletWorld);
+        if (!broadphase) {
+            LOG_WARNING("Cannot perform overlap batch: No active Bullet world");
+            return false;
+        }
+        const btDispatcherInfo& dispatchInfo = bulletWorld->getDispatchInfo();
+
+        RunQueryChunks(queries.size(), [&](QueryContext& context, size_t begin, size_t end) {
+            btCollisionDispatcher& dispatcher = context.GetDispatcher();
+            for (size_t i = begin; i < end; ++i) {
+                const OverlapQuery& query = queries[i];
+                OverlapResult* queryResults = results.data() + i * maxResultsPerQuery;
+                uint32_t found = 0;
+
+                btSphereShape sphere(query.radius);
+                const btTransform transform(btQuaternion::getIdentity(), Physics::BulletUtils::ToBullet(query.center));
+                btVector3 aabbMin, aabbMax;
+                sphere.getAabb(transform, aabbMin, aabbMax);
+
+                CandidateCollector collector(context.candidates, query.filter);
+                CollectInBox(*broadphase, aabbMin, aabbMax, collector);
+
+                context.queryObject.setCollisionShape(&sphere);
+                context.queryObject.setWorldTransform(transform);
+                const btCollisionObjectWrapper queryWrap(nullptr, &sphere, &context.queryObject, transform, -1, -1);
+
+                for (btCollisionObject* object : context.candidates) {
+                    const btCollisionObjectWrapper bodyWrap(nullptr, object->getCollisionShape(), object,
+                                                            object->getWorldTransform(), -1, -1);
+                    btCollisionAlgorithm* algorithm = dispatcher.findAlgorithm(&queryWrap, &bodyWrap, nullptr,
+                                                                               BT_CLOSEST_POINT_ALGORITHMS);
+                    if (!algorithm) {
+                        continue;
+                    }
+
+                    DeepestContactResult contact(&queryWrap, &bodyWrap);
+                    algorithm->processCollision(&queryWrap, &bodyWrap, dispatchInfo, &contact);
+                    algorithm->~btCollisionAlgorithm();
+                    dispatcher.freeCollisionAlgorithm(algorithm);
+
+                    if (!contact.hasContact) {
+                        continue;
+                    }
+                    if (found < maxResultsPerQuery) {
+                        OverlapResult& result = queryResults[found];
+                        result.bodyId = static_cast<uint32_t>(object->getUserIndex());
+                        result.contactPoint = Physics::BulletUtils::FromBullet(contact.point);
+                        result.contactNormal = Physics::BulletUtils::FromBullet(contact.normal);
+                        result.penetrationDepth = contact.depth;
+                    }
+                    ++found;
+                }
+
+                context.queryObject.setCollisionShape(nullptr);
+                counts[i] = found;
+            }
+        });
+        return true;
+#else
+        LOG_WARNING("Overlap batch not supported: Bullet Physics not available");
+        return false;
+#endif
+    }
+
     uint32_t PhysicsEngine::CreateGhostObject(const CollisionShape& shape, const Math::Vec3& position) {
         uint32_t id = m_nextBodyId++;
         
 #ifdef GAMEENGINE_HAS_BULLET
         if (m_activeWorld) {
             // Create Bullet collision shape
-            auto bulletShape = Physics::CollisionShapeFactory::CreateShape(shape);
+            auto bulletShape = AcquireShape(shape);
             if (!bulletShape) {
                 LOG_ERROR("Failed to create collision shape for ghost object");
                 return 0;
@@ -695,7 +1370,7 @@ namespace GameEngine {
             
             // Create ghost object
             auto ghostObject = std::make_unique<btGhostObject>();
-            ghostObject->setCollisionShape(bulletShape.release());
+            ghostObject->setCollisionShape(bulletShape.get());
             
             // Set initial transform
             btTransform transform;
@@ -715,6 +1390,7 @@ namespace GameEngine {
                     bulletWorld->addCollisionObject(rawGhostPtr, btBroadphaseProxy::SensorTrigger, 
                                                    btBroadphaseProxy::AllFilter & ~btBroadphaseProxy::SensorTrigger);
                     m_bulletGhostObjects[id] = rawGhostPtr;
+                    m_objectShapes[id] = std::move(bulletShape);
                     LOG_DEBUG("Created Bullet ghost object with ID: " + std::to_string(id));
                 } else {
                     LOG_ERROR("Bullet world is null");
@@ -747,15 +1423,12 @@ namespace GameEngine {
             
             // Clean up the ghost object and its components
             if (ghostObject) {
-                // Delete collision shape
-                if (ghostObject->getCollisionShape()) {
-                    delete ghostObject->getCollisionShape();
-                }
-                
                 // Delete the ghost object itself
                 delete ghostObject;
             }
             
+            // Release the ghost object's reference to its (possibly shared) collision shape
+            m_objectShapes.erase(ghostId);
             m_bulletGhostObjects.erase(ghostIt);
             LOG_DEBUG("Destroyed Bullet ghost object with ID: " + std::to_string(ghostId));
         } else {
@@ -1,90 +1,35 @@
 #include "Resource/AsyncModelLoader.h"
+#include "Core/JobSystem.h"
 #include "Core/Logger.h"
 #include <algorithm>
 #include <chrono>
 
 namespace GameEngine {
 
-    // ThreadPool Implementation
-    ThreadPool::ThreadPool(size_t numThreads) {
-        if (numThreads == 0) {
-            numThreads = std::max(1u, std::thread::hardware_concurrency());
-        }
-
-        for (size_t i = 0; i < numThreads; ++i) {
-            m_workers.emplace_back([this] {
-                for (;;) {
-                    std::function<void()> task;
-                    
-                    {
-                        std::unique_lock<std::mutex> lock(m_queueMutex);
-                        m_condition.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
-                        
-                        if (m_stop && m_tasks.empty()) {
-                            return;
-                        }
-                        
-                        task = std::move(m_tasks.front());
-                        m_tasks.pop();
-                    }
-                    
-                    task();
-                }
-            });
-        }
-    }
-
-    ThreadPool::~ThreadPool() {
-        Stop();
-    }
-
-    void ThreadPool::Stop() {
-        {
-            std::unique_lock<std::mutex> lock(m_queueMutex);
-            m_stop = true;
-        }
-        
-        m_condition.notify_all();
-        
-        for (std::thread& worker : m_workers) {
-            if (worker.joinable()) {
-                worker.join();
-            }
-        }
-        
-        m_workers.clear();
-    }
-
     // AsyncModelLoader Implementation
-    AsyncModelLoader::AsyncModelLoader() = default;
+    AsyncModelLoader::AsyncModelLoader() : m_loadJobs(std::make_unique<JobGroup>()) {}
 
     AsyncModelLoader::~AsyncModelLoader() {
         Shutdown();
     }
 
-    bool AsyncModelLoader::Initialize(uint32_t workerThreadCount) {
+    bool AsyncModelLoader::Initialize() {
         if (m_initialized) {
             LOG_WARNING("AsyncModelLoader already initialized");
             return true;
         }
 
         try {
-            // Initialize thread pool
-            if (workerThreadCount == 0) {
-                workerThreadCount = std::max(1u, std::thread::hardware_concurrency());
-            }
-            
-            m_threadPool = std::make_unique<ThreadPool>(workerThreadCount);
-            
-            // Initialize model loader
+            // Initialize model loader; it converts meshes on the same job system
             m_modelLoader = std::make_unique<ModelLoader>();
             if (!m_modelLoader->Initialize()) {
                 LOG_ERROR("Failed to initialize ModelLoader for AsyncModelLoader");
                 return false;
             }
+            m_modelLoader->SetJobSystem(m_jobSystem);
 
             m_initialized = true;
-            LOG_INFO("AsyncModelLoader initialized with " + std::to_string(workerThreadCount) + " worker threads");
+            LOG_INFO("AsyncModelLoader initialized with " + std::to_string(GetWorkerThreadCount()) + " worker threads");
             return true;
 
         } catch (const std::exception& e) {
@@ -93,6 +38,13 @@ namespace GameEngine {
         }
     }
 
+    void AsyncModelLoader::SetJobSystem(JobSystem* jobSystem) {
+        m_jobSystem = jobSystem;
+        if (m_modelLoader) {
+            m_modelLoader->SetJobSystem(jobSystem);
+        }
+    }
+
     void AsyncModelLoader::Shutdown() {
         if (!m_initialized) {
             return;
@@ -106,10 +58,9 @@ namespace GameEngine {
         // Wait for all tasks to complete
         WaitForAllLoads();
 
-        // Shutdown thread pool
-        if (m_threadPool) {
-            m_threadPool->Stop();
-            m_threadPool.reset();
+        // Load jobs can still be returning after their promise was set
+        if (m_jobSystem) {
+            m_jobSystem->Wait(*m_loadJobs);
         }
 
         // Shutdown model loader
@@ -126,9 +77,8 @@ namespace GameEngine {
         
         {
             std::lock_guard<std::mutex> lock(m_queueMutex);
-            while (!m_taskQueue.empty()) {
-                m_taskQueue.pop();
-            }
+            m_taskQueue.clear();
+            m_scheduledTasks.clear();
         }
         
         {
@@ -173,54 +123,29 @@ namespace GameEngine {
             }
         }
 
-        // Check if already loading
-        {
-            std::lock_guard<std::mutex> lock(m_tasksMutex);
-            auto it = m_activeTasks.find(filepath);
-            if (it != m_activeTasks.end() && !it->second->cancelled) {
-                throw std::runtime_error("Model is already being loaded: " + filepath);
-            }
-        }
-
         // Create load task
         auto task = std::make_shared<LoadTask>(filepath, flags, priority);
         task->dependencies = dependencies;
         task->estimatedMemoryUsage = EstimateModelMemoryUsage(filepath);
         
-        // Get future before moving task
+        // Get future before handing the task to the scheduler
         auto future = task->promise.get_future();
 
-        // Check if we can start immediately or need to queue
-        if (CanStartNewLoad() && AreDependenciesResolved(task)) {
-            // Add to active tasks
-            {
-                std::lock_guard<std::mutex> lock(m_tasksMutex);
-                m_activeTasks[filepath] = task;
-            }
-
-            // Update statistics
-            UpdateStats(false, false, false, 0.0f, 0);
-
-            // Submit to thread pool
-            try {
-                m_threadPool->Enqueue([this, task]() {
-                    ProcessLoadTask(task);
-                });
-            } catch (const std::exception& e) {
-                // Remove from active tasks if enqueue failed
-                {
-                    std::lock_guard<std::mutex> lock(m_tasksMutex);
-                    m_activeTasks.erase(filepath);
-                }
-                throw;
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            
+            // Check if already loading
+            auto it = m_scheduledTasks.find(filepath);
+            if (it != m_scheduledTasks.end() && !it->second->cancelled) {
+                throw std::runtime_error("Model is already being loaded: " + filepath);
             }
-
-            LogTaskStart(filepath);
-        } else {
-            // Queue the task
-            QueueTask(task);
+            
+            ScheduleTaskLocked(task);
         }
 
+        // Start it right away if a load slot is free and nothing more urgent is queued
+        ProcessTaskQueue();
+
         return future;
     }
 
@@ -229,46 +154,7 @@ namespace GameEngine {
     }
 
     std::future<std::vector<std::shared_ptr<Model>>> AsyncModelLoader::LoadModelsAsync(const std::vector<std::string>& filepaths, ModelLoader::LoadingFlags flags) {
-        if (!m_initialized) {
-            throw std::runtime_error("AsyncModelLoader not initialized");
-        }
-
-        // Create a promise for the batch result
-        auto promise = std::make_shared<std::promise<std::vector<std::shared_ptr<Model>>>>();
-        auto future = promise->get_future();
-
-        // Submit batch loading task
-        m_threadPool->Enqueue([this, filepaths, flags, promise]() {
-            std::vector<std::shared_ptr<Model>> results;
-            results.reserve(filepaths.size());
-
-            std::vector<std::future<std::shared_ptr<Model>>> futures;
-            futures.reserve(filepaths.size());
-
-            try {
-                // Start all individual loads
-                for (const auto& filepath : filepaths) {
-                    futures.push_back(LoadModelAsync(filepath, flags));
-                }
-
-                // Collect results
-                for (auto& fut : futures) {
-                    try {
-                        results.push_back(fut.get());
-                    } catch (const std::exception& e) {
-                        LOG_ERROR("Failed to load model in batch: " + std::string(e.what()));
-                        results.push_back(nullptr);
-                    }
-                }
-
-                promise->set_value(std::move(results));
-
-            } catch (const std::exception& e) {
-                promise->set_exception(std::current_exception());
-            }
-        });
-
-        return future;
+        return LoadModelsAsync(filepaths, flags, m_defaultPriority);
     }
 
     std::future<std::vector<std::shared_ptr<Model>>> AsyncModelLoader::LoadModelsAsync(const std::vector<std::string>& filepaths, ModelLoader::LoadingFlags flags, TaskPriority priority) {
@@ -276,42 +162,33 @@ namespace GameEngine {
             throw std::runtime_error("AsyncModelLoader not initialized");
         }
 
-        // Create a promise for the batch result
-        auto promise = std::make_shared<std::promise<std::vector<std::shared_ptr<Model>>>>();
-        auto future = promise->get_future();
+        // Start all individual loads here. Collecting them is deferred to whoever reads the
+        // batch future, so no job system worker sits blocked on other loads.
+        std::vector<std::future<std::shared_ptr<Model>>> futures;
+        futures.reserve(filepaths.size());
+        try {
+            for (const auto& filepath : filepaths) {
+                futures.push_back(LoadModelAsync(filepath, flags, priority));
+            }
+        } catch (const std::exception&) {
+            std::promise<std::vector<std::shared_ptr<Model>>> promise;
+            promise.set_exception(std::current_exception());
+            return promise.get_future();
+        }
 
-        // Submit batch loading task
-        m_threadPool->Enqueue([this, filepaths, flags, priority, promise]() {
+        return std::async(std::launch::deferred, [futures = std::move(futures)]() mutable {
             std::vector<std::shared_ptr<Model>> results;
-            results.reserve(filepaths.size());
-
-            std::vector<std::future<std::shared_ptr<Model>>> futures;
-            futures.reserve(filepaths.size());
-
-            try {
-                // Start all individual loads
-                for (const auto& filepath : filepaths) {
-                    futures.push_back(LoadModelAsync(filepath, flags, priority));
-                }
-
-                // Collect results
-                for (auto& fut : futures) {
-                    try {
-                        results.push_back(fut.get());
-                    } catch (const std::exception& e) {
-                        LOG_ERROR("Failed to load model in batch: " + std::string(e.what()));
-                        results.push_back(nullptr);
-                    }
+            results.reserve(futures.size());
+            for (auto& fut : futures) {
+                try {
+                    results.push_back(fut.get());
+                } catch (const std::exception& e) {
+                    LOG_ERROR("Failed to load model in batch: " + std::string(e.what()));
+                    results.push_back(nullptr);
                 }
-
-                promise->set_value(std::move(results));
-
-            } catch (const std::exception& e) {
-                promise->set_exception(std::current_exception());
             }
+            return results;
         });
-
-        return future;
     }
 
     void AsyncModelLoader::SetProgressCallback(ProgressCallback callback) {
@@ -358,69 +235,104 @@ namespace GameEngine {
     }
 
     bool AsyncModelLoader::CancelLoad(const std::string& filepath) {
-        std::lock_guard<std::mutex> lock(m_tasksMutex);
-        auto it = m_activeTasks.find(filepath);
-        if (it != m_activeTasks.end()) {
-            it->second->cancelled = true;
-            LOG_INFO("Cancelled loading of model: " + filepath);
-            return true;
+        std::vector<FailedTask> removed;
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            auto it = m_scheduledTasks.find(filepath);
+            if (it == m_scheduledTasks.end()) {
+                return false;
+            }
+            
+            // A running load stops at its next cancellation check; queued ones are dropped now
+            auto task = it->second;
+            task->cancelled = true;
+            if (task->state == TaskState::Waiting || task->state == TaskState::Ready) {
+                RemoveTaskLocked(task, "Load cancelled", removed);
+            }
         }
-        return false;
+        
+        FailTasks(removed);
+        LOG_INFO("Cancelled loading of model: " + filepath);
+        return true;
     }
 
     void AsyncModelLoader::CancelAllLoads() {
-        std::lock_guard<std::mutex> lock(m_tasksMutex);
-        for (auto& pair : m_activeTasks) {
-            pair.second->cancelled = true;
+        std::vector<FailedTask> removed;
+        size_t cancelledCount = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            std::vector<std::shared_ptr<LoadTask>> tasks;
+            tasks.reserve(m_scheduledTasks.size());
+            for (const auto& pair : m_scheduledTasks) {
+                tasks.push_back(pair.second);
+            }
+            
+            cancelledCount = tasks.size();
+            for (auto& task : tasks) {
+                task->cancelled = true;
+                if (task->state == TaskState::Waiting || task->state == TaskState::Ready) {
+                    RemoveTaskLocked(task, "Load cancelled", removed);
+                }
+            }
         }
-        if (!m_activeTasks.empty()) {
-            LOG_INFO("Cancelled " + std::to_string(m_activeTasks.size()) + " active model loads");
+        
+        FailTasks(removed);
+        if (cancelledCount > 0) {
+            LOG_INFO("Cancelled " + std::to_string(cancelledCount) + " active model loads");
         }
     }
 
-    void AsyncModelLoader::WaitForAllLoads() {
-        std::vector<std::shared_ptr<LoadTask>> tasksToWait;
+    bool AsyncModelLoader::SetLoadPriority(const std::string& filepath, TaskPriority priority) {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        auto it = m_scheduledTasks.find(filepath);
+        if (it == m_scheduledTasks.end()) {
+            return false;
+        }
         
-        {
-            std::lock_guard<std::mutex> lock(m_tasksMutex);
-            tasksToWait.reserve(m_activeTasks.size());
-            for (const auto& pair : m_activeTasks) {
-                tasksToWait.push_back(pair.second);
-            }
+        auto task = it->second;
+        if (task->state == TaskState::Ready) {
+            m_taskQueue.erase(task);
+            task->priority = priority;
+            QueueTaskLocked(task);
+            return true;
         }
-
-        // Wait for all tasks to complete (or be cancelled)
-        for (auto& task : tasksToWait) {
-            try {
-                // This will block until the task completes or throws
-                auto future = task->promise.get_future();
-                if (future.valid()) {
-                    future.wait();
+        
+        if (task->state == TaskState::Waiting) {
+            // Inputs of a waiting task inherit a raised priority so they don't hold it back
+            task->priority = priority;
+            for (const auto& dependency : task->dependencies) {
+                auto depIt = m_scheduledTasks.find(dependency);
+                if (depIt != m_scheduledTasks.end()) {
+                    RaisePriorityLocked(depIt->second, priority);
                 }
-            } catch (...) {
-                // Ignore exceptions during shutdown
             }
+            return true;
         }
+        
+        return false; // Already running or finished
     }
 
-    void AsyncModelLoader::SetMaxConcurrentLoads(uint32_t maxLoads) {
-        m_maxConcurrentLoads = std::max(1u, maxLoads);
-        LOG_INFO("Set max concurrent loads to " + std::to_string(m_maxConcurrentLoads));
+    void AsyncModelLoader::WaitForAllLoads() {
+        std::unique_lock<std::mutex> lock(m_queueMutex);
+        m_idleCondition.wait(lock, [this] { return m_scheduledTasks.empty() && m_unfinishedTasks == 0; });
     }
 
-    void AsyncModelLoader::SetWorkerThreadCount(uint32_t count) {
-        if (m_initialized) {
-            LOG_WARNING("Cannot change worker thread count while AsyncModelLoader is initialized");
-            return;
+    void AsyncModelLoader::SetMaxConcurrentLoads(uint32_t maxLoads) {
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_maxConcurrentLoads = std::max(1u, maxLoads);
         }
+        LOG_INFO("Set max concurrent loads to " + std::to_string(maxLoads));
         
-        // This will take effect on next initialization
-        LOG_INFO("Worker thread count will be set to " + std::to_string(count) + " on next initialization");
+        // A raised limit can start queued work straight away
+        if (m_initialized) {
+            ProcessTaskQueue();
+        }
     }
 
     uint32_t AsyncModelLoader::GetWorkerThreadCount() const {
-        if (m_threadPool) {
-            return static_cast<uint32_t>(m_threadPool->GetThreadCount());
+        if (m_jobSystem) {
+            return static_cast<uint32_t>(m_jobSystem->GetWorkerCount());
         }
         return 0;
     }
@@ -443,25 +355,43 @@ namespace GameEngine {
         m_defaultPriority = priority;
     }
 
+    void AsyncModelLoader::SetPriorityAgingInterval(std::chrono::milliseconds interval) {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_priorityAgingInterval = std::max(std::chrono::milliseconds(0), interval);
+        
+        // Ranks depend on the interval, so re-rank everything already queued
+        std::vector<std::shared_ptr<LoadTask>> readyTasks(m_taskQueue.begin(), m_taskQueue.end());
+        m_taskQueue.clear();
+        for (auto& task : readyTasks) {
+            QueueTaskLocked(task);
+        }
+    }
+
     AsyncModelLoader::LoadingStats AsyncModelLoader::GetLoadingStats() const {
         std::lock_guard<std::mutex> lock(m_statsMutex);
         return m_stats;
     }
 
+    AsyncModelLoader::PriorityLatencyStats AsyncModelLoader::GetLatencyStats(TaskPriority priority) const {
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        return m_stats.latencyByPriority[static_cast<size_t>(priority)];
+    }
+
     void AsyncModelLoader::ResetStats() {
         std::lock_guard<std::mutex> lock(m_statsMutex);
         m_stats = LoadingStats{};
         m_loadTimes.clear();
+        m_queueTimeTotals = {};
+        m_latencyTotals = {};
         LOG_INFO("Reset AsyncModelLoader statistics");
     }
 
     void AsyncModelLoader::CleanupCompletedTasks() {
+        std::lock_guard<std::mutex> queueLock(m_queueMutex);
         std::lock_guard<std::mutex> lock(m_tasksMutex);
-        
         auto it = m_activeTasks.begin();
         while (it != m_activeTasks.end()) {
-            auto future = it->second->promise.get_future();
-            if (future.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            if (it->second->state == TaskState::Finished) {
                 it = m_activeTasks.erase(it);
             } else {
                 ++it;
@@ -471,60 +401,44 @@ namespace GameEngine {
 
     void AsyncModelLoader::ProcessLoadTask(std::shared_ptr<LoadTask> task) {
         auto startTime = std::chrono::steady_clock::now();
+        std::shared_ptr<Model> model;
+        std::exception_ptr error;
+        bool cancelled = false;
         
         try {
-            if (task->cancelled) {
-                UpdateStats(false, true, false, 0.0f, 0);
-                task->promise.set_exception(std::make_exception_ptr(std::runtime_error("Load cancelled")));
-                return;
+            // The scheduler reserved a load slot for this task before dispatching it
+            if (!task->cancelled) {
+                model = LoadModelInternal(task->filepath, task->flags, task);
             }
 
-            // Wait for available load slot
-            WaitForLoadSlot();
-
-            if (task->cancelled) {
-                UpdateStats(false, true, false, 0.0f, 0);
-                task->promise.set_exception(std::make_exception_ptr(std::runtime_error("Load cancelled")));
-                return;
-            }
+            cancelled = task->cancelled;
+            if (!cancelled) {
+                // Calculate load time
+                auto endTime = std::chrono::steady_clock::now();
+                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+                float loadTimeMs = static_cast<float>(duration.count());
 
-            // Load the model
-            auto model = LoadModelInternal(task->filepath, task->flags, task);
+                // Update final progress
+                UpdateProgress(task->filepath, 1.0f, "Complete");
 
-            if (task->cancelled) {
-                UpdateStats(false, true, false, 0.0f, 0);
-                task->promise.set_exception(std::make_exception_ptr(std::runtime_error("Load cancelled")));
-                return;
-            }
+                // Update statistics
+                size_t memoryUsed = model ? model->GetMemoryUsage() : 0;
+                UpdateStats(true, false, false, loadTimeMs, memoryUsed);
 
-            // Calculate load time
-            auto endTime = std::chrono::steady_clock::now();
-            auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
-            float loadTimeMs = static_cast<float>(duration.count());
-
-            // Update final progress
-            UpdateProgress(task->filepath, 1.0f, "Complete");
-
-            // Update statistics
-            size_t memoryUsed = model ? model->GetMemoryUsage() : 0;
-            UpdateStats(true, false, false, loadTimeMs, memoryUsed);
-
-            // Cache the model if successful
-            if (model) {
-                {
-                    std::lock_guard<std::mutex> lock(m_cacheMutex);
-                    m_loadedModels[task->filepath] = model;
+                // Cache the model if successful; dependents check the cache
+                if (model) {
+                    {
+                        std::lock_guard<std::mutex> lock(m_cacheMutex);
+                        m_loadedModels[task->filepath] = model;
+                    }
+                    UpdateMemoryUsage(memoryUsed, true);
+                    
+                    // Check if we need to free memory
+                    FreeMemoryIfNeeded();
                 }
-                UpdateMemoryUsage(memoryUsed, true);
-                
-                // Check if we need to free memory
-                FreeMemoryIfNeeded();
-            }
 
-            // Set result
-            task->promise.set_value(model);
-
-            LogTaskComplete(task->filepath, model != nullptr, loadTimeMs);
+                LogTaskComplete(task->filepath, model != nullptr, loadTimeMs);
+            }
 
         } catch (const std::exception& e) {
             auto endTime = std::chrono::steady_clock::now();
@@ -534,17 +448,25 @@ namespace GameEngine {
             UpdateStats(false, false, true, loadTimeMs, 0);
             UpdateProgress(task->filepath, 0.0f, "Failed: " + std::string(e.what()));
             
-            task->promise.set_exception(std::current_exception());
+            model.reset();
+            error = std::current_exception();
             LogTaskComplete(task->filepath, false, loadTimeMs);
         }
 
+        if (cancelled) {
+            UpdateStats(false, true, false, 0.0f, 0);
+            model.reset();
+            error = std::make_exception_ptr(std::runtime_error("Load cancelled"));
+        }
+
         // Remove from active tasks
         {
             std::lock_guard<std::mutex> lock(m_tasksMutex);
             m_activeTasks.erase(task->filepath);
         }
 
-        // Process any queued tasks that might now be able to start
+        // Release dependents, set the result, then fill the freed load slot
+        CompleteTask(task, model, error);
         ProcessTaskQueue();
     }
 
@@ -629,21 +551,20 @@ namespace GameEngine {
         }
     }
 
-    bool AsyncModelLoader::CanStartNewLoad() const {
-        std::lock_guard<std::mutex> lock(m_tasksMutex);
-        uint32_t activeCount = 0;
-        for (const auto& pair : m_activeTasks) {
-            if (!pair.second->cancelled) {
-                activeCount++;
-            }
-        }
-        return activeCount < m_maxConcurrentLoads;
-    }
-
-    void AsyncModelLoader::WaitForLoadSlot() {
-        while (!CanStartNewLoad()) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        }
+    void AsyncModelLoader::RecordLatency(const LoadTask& task) {
+        auto now = std::chrono::steady_clock::now();
+        double queueTimeMs = std::chrono::duration<double, std::milli>(task.dispatchTime - task.startTime).count();
+        double latencyMs = std::chrono::duration<double, std::milli>(now - task.startTime).count();
+        size_t index = static_cast<size_t>(task.priority);
+        
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        auto& latency = m_stats.latencyByPriority[index];
+        latency.completedLoads++;
+        m_queueTimeTotals[index] += queueTimeMs;
+        m_latencyTotals[index] += latencyMs;
+        latency.averageQueueTimeMs = static_cast<float>(m_queueTimeTotals[index] / latency.completedLoads);
+        latency.averageLatencyMs = static_cast<float>(m_latencyTotals[index] / latency.completedLoads);
+        latency.maxLatencyMs = std::max(latency.maxLatencyMs, static_cast<float>(latencyMs));
     }
 
     std::shared_ptr<Model> AsyncModelLoader::LoadModelInternal(const std::string& filepath, ModelLoader::LoadingFlags flags, std::shared_ptr<LoadTask> task) {
@@ -686,9 +607,40 @@ namespace GameEngine {
     }
 
     // Queue and dependency management methods
-    void AsyncModelLoader::QueueTask(std::shared_ptr<LoadTask> task) {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
-        m_taskQueue.push(task);
+    void AsyncModelLoader::ScheduleTaskLocked(const std::shared_ptr<LoadTask>& task) {
+        task->sequence = m_nextSequence++;
+        task->state = TaskState::Waiting;
+        task->pendingDependencies = 0;
+        m_scheduledTasks[task->filepath] = task;
+        m_unfinishedTasks++;
+        
+        // Link to each input that is not loaded yet; inputs nobody asked for are queued too
+        for (const auto& dependency : task->dependencies) {
+            if (dependency == task->filepath) {
+                continue;
+            }
+            
+            {
+                std::lock_guard<std::mutex> cacheLock(m_cacheMutex);
+                if (m_loadedModels.find(dependency) != m_loadedModels.end()) {
+                    continue;
+                }
+            }
+            
+            std::shared_ptr<LoadTask> input;
+            auto it = m_scheduledTasks.find(dependency);
+            if (it != m_scheduledTasks.end() && !it->second->cancelled) {
+                input = it->second;
+            } else {
+                input = std::make_shared<LoadTask>(dependency, task->flags, task->priority);
+                input->estimatedMemoryUsage = EstimateModelMemoryUsage(dependency);
+                ScheduleTaskLocked(input);
+            }
+            
+            RaisePriorityLocked(input, task->priority);
+            input->dependents.push_back(task);
+            task->pendingDependencies++;
+        }
         
         // Update statistics
         {
@@ -696,23 +648,62 @@ namespace GameEngine {
             m_stats.queuedLoads++;
         }
         
+        if (task->pendingDependencies == 0) {
+            QueueTaskLocked(task);
+        }
+        
         if (m_verboseLogging) {
-            LOG_INFO("Queued task for " + task->filepath + " (priority: " + std::to_string(static_cast<int>(task->priority)) + ")");
+            LOG_INFO("Queued task for " + task->filepath + " (priority: " + std::to_string(static_cast<int>(task->priority)) +
+                     ", waiting on " + std::to_string(task->pendingDependencies) + " dependencies)");
         }
     }
 
-    std::shared_ptr<AsyncModelLoader::LoadTask> AsyncModelLoader::GetNextQueuedTask() {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
+    void AsyncModelLoader::QueueTaskLocked(const std::shared_ptr<LoadTask>& task) {
+        task->state = TaskState::Ready;
+        task->schedulingRank = CalculateSchedulingRank(*task);
+        m_taskQueue.insert(task);
+    }
+
+    void AsyncModelLoader::RaisePriorityLocked(const std::shared_ptr<LoadTask>& task, TaskPriority priority) {
+        if (task->priority >= priority) {
+            return;
+        }
         
-        if (m_taskQueue.empty()) {
-            return nullptr;
+        if (task->state == TaskState::Ready) {
+            // The rank is the set key; take the task out before changing it
+            m_taskQueue.erase(task);
+            task->priority = priority;
+            QueueTaskLocked(task);
+            return;
         }
         
-        // For now, simple FIFO queue. Could be enhanced with priority queue
-        auto task = m_taskQueue.front();
-        m_taskQueue.pop();
+        task->priority = priority;
+        if (task->state == TaskState::Waiting) {
+            for (const auto& dependency : task->dependencies) {
+                auto it = m_scheduledTasks.find(dependency);
+                if (it != m_scheduledTasks.end()) {
+                    RaisePriorityLocked(it->second, priority);
+                }
+            }
+        }
+    }
+
+    void AsyncModelLoader::RemoveTaskLocked(const std::shared_ptr<LoadTask>& task, const std::string& reason, std::vector<FailedTask>& removed) {
+        if (task->state != TaskState::Waiting && task->state != TaskState::Ready) {
+            return;
+        }
+        
+        if (task->state == TaskState::Ready) {
+            m_taskQueue.erase(task);
+        }
+        task->state = TaskState::Finished;
+        task->cancelled = true;
+        
+        auto it = m_scheduledTasks.find(task->filepath);
+        if (it != m_scheduledTasks.end() && it->second == task) {
+            m_scheduledTasks.erase(it);
+        }
         
-        // Update statistics
         {
             std::lock_guard<std::mutex> statsLock(m_statsMutex);
             if (m_stats.queuedLoads > 0) {
@@ -720,69 +711,152 @@ namespace GameEngine {
             }
         }
         
-        return task;
+        removed.emplace_back(task, reason);
+        
+        // Nothing that needs this file can load any more
+        auto dependents = std::move(task->dependents);
+        task->dependents.clear();
+        for (const auto& dependent : dependents) {
+            RemoveTaskLocked(dependent, "Dependency failed to load: " + task->filepath, removed);
+        }
     }
 
-    bool AsyncModelLoader::AreDependenciesResolved(const std::shared_ptr<LoadTask>& task) const {
-        std::lock_guard<std::mutex> lock(m_cacheMutex);
+    int64_t AsyncModelLoader::CalculateSchedulingRank(const LoadTask& task) const {
+        const int64_t level = static_cast<int64_t>(task.priority);
+        if (m_priorityAgingInterval.count() <= 0) {
+            return level;
+        }
         
-        for (const auto& dependency : task->dependencies) {
-            auto it = m_loadedModels.find(dependency);
-            if (it == m_loadedModels.end()) {
-                return false; // Dependency not yet loaded
+        // In nanoseconds: submitting one aging interval earlier is worth one priority level.
+        // The order this gives never changes while tasks wait, so the queue needs no re-sorting.
+        const int64_t interval = std::chrono::duration_cast<std::chrono::nanoseconds>(m_priorityAgingInterval).count();
+        const int64_t submitted = std::chrono::duration_cast<std::chrono::nanoseconds>(task.startTime.time_since_epoch()).count();
+        return level * interval - submitted;
+    }
+
+    void AsyncModelLoader::CompleteTask(const std::shared_ptr<LoadTask>& task, std::shared_ptr<Model> model, std::exception_ptr error) {
+        std::vector<FailedTask> failed;
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            task->state = TaskState::Finished;
+            if (m_runningLoads > 0) {
+                m_runningLoads--;
+            }
+            
+            auto it = m_scheduledTasks.find(task->filepath);
+            if (it != m_scheduledTasks.end() && it->second == task) {
+                m_scheduledTasks.erase(it);
+            }
+            
+            auto dependents = std::move(task->dependents);
+            task->dependents.clear();
+            for (const auto& dependent : dependents) {
+                if (dependent->state != TaskState::Waiting) {
+                    continue; // Already cancelled
+                }
+                
+                if (!model) {
+                    RemoveTaskLocked(dependent, "Dependency failed to load: " + task->filepath, failed);
+                } else if (--dependent->pendingDependencies == 0) {
+                    QueueTaskLocked(dependent);
+                }
             }
         }
         
-        return true; // All dependencies resolved
+        if (model) {
+            RecordLatency(*task);
+        }
+        
+        // Set result
+        if (error) {
+            task->promise.set_exception(error);
+        } else {
+            task->promise.set_value(model);
+        }
+        
+        FailTasks(failed);
+        
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_unfinishedTasks--;
+        }
+        m_idleCondition.notify_all();
     }
 
-    void AsyncModelLoader::SortTaskQueue() {
-        // This would require converting to priority_queue or custom sorting
-        // For now, keeping simple FIFO queue
+    void AsyncModelLoader::FailTasks(const std::vector<FailedTask>& tasks) {
+        if (tasks.empty()) {
+            return;
+        }
+        
+        for (const auto& failedTask : tasks) {
+            {
+                std::lock_guard<std::mutex> statsLock(m_statsMutex);
+                m_stats.totalLoadsCancelled++;
+            }
+            failedTask.first->promise.set_exception(std::make_exception_ptr(std::runtime_error(failedTask.second)));
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            m_unfinishedTasks -= static_cast<uint32_t>(tasks.size());
+        }
+        m_idleCondition.notify_all();
     }
 
     std::vector<std::string> AsyncModelLoader::GetQueuedTasks() const {
         std::lock_guard<std::mutex> lock(m_queueMutex);
         
+        // Ready tasks in the order they will start, then tasks still waiting on dependencies
         std::vector<std::string> queuedTasks;
-        std::queue<std::shared_ptr<LoadTask>> tempQueue = m_taskQueue;
+        for (const auto& task : m_taskQueue) {
+            queuedTasks.push_back(task->filepath);
+        }
         
-        while (!tempQueue.empty()) {
-            queuedTasks.push_back(tempQueue.front()->filepath);
-            tempQueue.pop();
+        std::vector<std::shared_ptr<LoadTask>> waiting;
+        for (const auto& pair : m_scheduledTasks) {
+            if (pair.second->state == TaskState::Waiting) {
+                waiting.push_back(pair.second);
+            }
+        }
+        std::sort(waiting.begin(), waiting.end(), [](const auto& a, const auto& b) { return a->sequence < b->sequence; });
+        for (const auto& task : waiting) {
+            queuedTasks.push_back(task->filepath);
         }
         
         return queuedTasks;
     }
 
     bool AsyncModelLoader::HasDependenciesResolved(const std::string& filepath) const {
-        std::lock_guard<std::mutex> lock(m_tasksMutex);
-        auto it = m_activeTasks.find(filepath);
-        if (it != m_activeTasks.end()) {
-            return AreDependenciesResolved(it->second);
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        auto it = m_scheduledTasks.find(filepath);
+        if (it != m_scheduledTasks.end()) {
+            return it->second->state != TaskState::Waiting;
         }
         return true; // No task found, assume resolved
     }
 
     void AsyncModelLoader::ProcessTaskQueue() {
-        // Check if we can start any queued tasks
-        while (CanStartNewLoad()) {
-            auto task = GetNextQueuedTask();
-            if (!task) {
-                break; // No more queued tasks
-            }
-            
-            if (task->cancelled) {
-                continue; // Skip cancelled tasks
+        // Take the best ready tasks while load slots are free
+        std::vector<std::shared_ptr<LoadTask>> dispatched;
+        {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            auto now = std::chrono::steady_clock::now();
+            while (m_runningLoads < m_maxConcurrentLoads && !m_taskQueue.empty()) {
+                auto task = *m_taskQueue.begin();
+                m_taskQueue.erase(m_taskQueue.begin());
+                task->state = TaskState::Running;
+                task->dispatchTime = now;
+                m_runningLoads++;
+                dispatched.push_back(task);
             }
             
-            if (!AreDependenciesResolved(task)) {
-                // Put back in queue if dependencies not resolved
-                QueueTask(task);
-                break;
+            if (!dispatched.empty()) {
+                std::lock_guard<std::mutex> statsLock(m_statsMutex);
+                m_stats.queuedLoads -= std::min(m_stats.queuedLoads, static_cast<uint32_t>(dispatched.size()));
             }
-            
-            // Start the task
+        }
+        
+        for (auto& task : dispatched) {
             {
                 std::lock_guard<std::mutex> lock(m_tasksMutex);
                 m_activeTasks[task->filepath] = task;
@@ -791,16 +865,22 @@ namespace GameEngine {
             UpdateStats(false, false, false, 0.0f, 0);
             
             try {
-                m_threadPool->Enqueue([this, task]() {
-                    ProcessLoadTask(task);
-                });
                 LogTaskStart(task->filepath);
+                if (m_jobSystem) {
+                    m_jobSystem->Submit([this, task]() {
+                        ProcessLoadTask(task);
+                    }, *m_loadJobs, JobPriority::Background);
+                } else {
+                    ProcessLoadTask(task);
+                }
             } catch (const std::exception& e) {
                 {
                     std::lock_guard<std::mutex> lock(m_tasksMutex);
                     m_activeTasks.erase(task->filepath);
                 }
                 LOG_ERROR("Failed to start queued task: " + std::string(e.what()));
+                UpdateStats(false, false, true, 0.0f, 0);
+                CompleteTask(task, nullptr, std::current_exception());
             }
         }
     }
@@ -1,4 +1,5 @@
 #include "Resource/FBXLoader.h"
+#include "Resource/ParallelImport.h"
 #include "Graphics/Texture.h"
 #include "Core/Logger.h"
 #include <filesystem>
@@ -268,37 +269,49 @@ FBXLoader::FBXLoadResult FBXLoader::ProcessFBXScene(const aiScene* scene, const
             Logger::GetInstance().Info("FBXLoader: Finished material processing.");
         }
         
-        // Process all meshes in the scene
+        // Process all meshes in the scene. Each aiMesh converts independently into its own
+        // slot, so the result keeps node traversal order regardless of which thread ran it.
         Logger::GetInstance().Info("FBXLoader: Starting mesh processing...");
         try {
-            ProcessFBXNode(scene->mRootNode, scene, result.meshes);
+            std::vector<const aiMesh*> sourceMeshes;
+            CollectFBXNodeMeshes(scene->mRootNode, scene, sourceMeshes);
+            
+            const bool bindBones = result.skeleton && m_config.importSkeleton;
+            std::vector<MeshData> meshData(sourceMeshes.size());
+            ParallelImportFor(sourceMeshes.size(), [&](size_t i) {
+                const aiMesh* sourceMesh = sourceMeshes[i];
+                try {
+                    if (!ConvertFBXMesh(sourceMesh, meshData[i])) {
+                        Logger::GetInstance().Warning("FBXLoader: ConvertFBXMesh failed for mesh " + std::to_string(i));
+                        return;
+                    }
+                    
+                    // Bind skin weights from the aiMesh this mesh was built from
+                    if (bindBones && sourceMesh->HasBones()) {
+                        ProcessBoneWeights(sourceMesh, scene, meshData[i].vertices);
+                    }
+                    
+                    PrepareFBXMesh(meshData[i]);
+                } catch (const std::exception& e) {
+                    meshData[i].converted = false;
+                    Logger::GetInstance().Error("FBXLoader: Exception processing mesh " + std::to_string(i) + ": " + std::string(e.what()));
+                }
+            }, m_jobSystem, m_config.parallelMeshProcessing ? 0 : 1);
+            
+            // Meshes upload their buffers, so they are created here rather than on the workers
+            for (MeshData& data : meshData) {
+                if (data.converted) {
+                    if (auto engineMesh = CreateFBXMesh(data)) {
+                        result.meshes.push_back(std::move(engineMesh));
+                    }
+                }
+            }
             Logger::GetInstance().Info("FBXLoader: Finished mesh processing, found " + std::to_string(result.meshes.size()) + " meshes");
         } catch (const std::exception& e) {
             Logger::GetInstance().Error("FBXLoader: Exception during mesh processing: " + std::string(e.what()));
             throw; // Re-throw to be caught by outer try-catch
         }
         
-        // Process bone weights for meshes if we have a skeleton
-        if (result.skeleton && m_config.importSkeleton) {
-            Logger::GetInstance().Info("FBXLoader: Starting skeleton binding...");
-            for (auto& mesh : result.meshes) {
-                if (mesh) {
-                    // Find the corresponding aiMesh and process bone weights
-                    for (uint32_t i = 0; i < scene->mNumMeshes; i++) {
-                        const aiMesh* aiMesh = scene->mMeshes[i];
-                        if (aiMesh->mName.length > 0 && mesh->GetName() == std::string(aiMesh->mName.C_Str())) {
-                            Logger::GetInstance().Info("FBXLoader: Processing bone weights for mesh: " + mesh->GetName());
-                            auto vertices = mesh->GetVertices();
-                            ProcessBoneWeights(aiMesh, scene, const_cast<std::vector<Vertex>&>(vertices));
-                            mesh->SetVertices(vertices);
-                            break;
-                        }
-                    }
-                }
-            }
-            Logger::GetInstance().Info("FBXLoader: Finished skeleton binding.");
-        }
-        
         // Process animations if enabled
         if (m_config.importAnimations && scene->mNumAnimations > 0) {
             Logger::GetInstance().Info("FBXLoader: Starting animation import...");
@@ -357,36 +370,30 @@ FBXLoader::FBXLoadResult FBXLoader::ProcessFBXScene(const aiScene* scene, const
     return result;
 }
 
-std::shared_ptr<Mesh> FBXLoader::ProcessFBXMesh(const aiMesh* mesh, const aiScene* scene) {
+bool FBXLoader::ConvertFBXMesh(const aiMesh* mesh, MeshData& data) {
     if (!mesh) {
-        Logger::GetInstance().Error("FBXLoader::ProcessFBXMesh: mesh is null");
-        return nullptr;
+        Logger::GetInstance().Error("FBXLoader::ConvertFBXMesh: mesh is null");
+        return false;
     }
     
     std::string meshName = mesh->mName.length > 0 ? std::string(mesh->mName.C_Str()) : "unnamed_mesh";
-    Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Starting to process mesh '" + meshName + "'");
+    Logger::GetInstance().Info("FBXLoader::ConvertFBXMesh: Starting to process mesh '" + meshName + "'");
     Logger::GetInstance().Info("  Vertices: " + std::to_string(mesh->mNumVertices));
     Logger::GetInstance().Info("  Faces: " + std::to_string(mesh->mNumFaces));
     Logger::GetInstance().Info("  Has bones: " + std::string(mesh->HasBones() ? "Yes" : "No"));
     
     try {
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Creating engine mesh...");
-        auto engineMesh = std::make_shared<Mesh>();
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Engine mesh created successfully");
-        
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Initializing vertex and index arrays...");
-        std::vector<Vertex> vertices;
-        std::vector<uint32_t> indices;
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Arrays initialized");
+        std::vector<Vertex>& vertices = data.vertices;
+        std::vector<uint32_t>& indices = data.indices;
         
         // Process vertices
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Starting vertex processing...");
+        Logger::GetInstance().Info("FBXLoader::ConvertFBXMesh: Starting vertex processing...");
         vertices.reserve(mesh->mNumVertices);
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Reserved space for " + std::to_string(mesh->mNumVertices) + " vertices");
+        Logger::GetInstance().Info("FBXLoader::ConvertFBXMesh: Reserved space for " + std::to_string(mesh->mNumVertices) + " vertices");
         
         for (uint32_t i = 0; i < mesh->mNumVertices; i++) {
             if (i % 1000 == 0) { // Log every 1000 vertices to avoid spam
-                Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Processing vertex " + std::to_string(i) + "/" + std::to_string(mesh->mNumVertices));
+                Logger::GetInstance().Info("FBXLoader::ConvertFBXMesh: Processing vertex " + std::to_string(i) + "/" + std::to_string(mesh->mNumVertices));
             }
             
             Vertex vertex;
@@ -435,23 +442,23 @@ std::shared_ptr<Mesh> FBXLoader::ProcessFBXMesh(const aiMesh* mesh, const aiScen
             vertices.push_back(vertex);
         }
         
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Finished processing " + std::to_string(vertices.size()) + " vertices");
+        Logger::GetInstance().Info("FBXLoader::ConvertFBXMesh: Finished processing " + std::to_string(vertices.size()) + " vertices");
         
         // Apply coordinate system conversion if enabled
         if (m_config.convertToOpenGLCoordinates) {
-            Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Applying coordinate system conversion...");
+            Logger::GetInstance().Info("FBXLoader::ConvertFBXMesh: Applying coordinate system conversion...");
             ApplyCoordinateSystemConversion(vertices);
-            Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Coordinate system conversion completed");
+            Logger::GetInstance().Info("FBXLoader::ConvertFBXMesh: Coordinate system conversion completed");
         }
         
         // Process indices
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Starting index processing...");
+        Logger::GetInstance().Info("FBXLoader::ConvertFBXMesh: Starting index processing...");
         indices.reserve(mesh->mNumFaces * 3);
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Reserved space for " + std::to_string(mesh->mNumFaces * 3) + " indices");
+        Logger::GetInstance().Info("FBXLoader::ConvertFBXMesh: Reserved space for " + std::to_string(mesh->mNumFaces * 3) + " indices");
         
         for (uint32_t i = 0; i < mesh->mNumFaces; i++) {
             if (i % 1000 == 0) { // Log every 1000 faces to avoid spam
-                Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Processing face " + std::to_string(i) + "/" + std::to_string(mesh->mNumFaces));
+                Logger::GetInstance().Info("FBXLoader::ConvertFBXMesh: Processing face " + std::to_string(i) + "/" + std::to_string(mesh->mNumFaces));
             }
             
             const aiFace& face = mesh->mFaces[i];
@@ -462,47 +469,66 @@ std::shared_ptr<Mesh> FBXLoader::ProcessFBXMesh(const aiMesh* mesh, const aiScen
                 indices.push_back(face.mIndices[1]);
                 indices.push_back(face.mIndices[2]);
             } else {
-                Logger::GetInstance().Warning("FBXLoader::ProcessFBXMesh: Non-triangular face with " + 
+                Logger::GetInstance().Warning("FBXLoader::ConvertFBXMesh: Non-triangular face with " + 
                                             std::to_string(face.mNumIndices) + " indices found");
             }
         }
         
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Finished processing " + std::to_string(indices.size()) + " indices");
+        Logger::GetInstance().Info("FBXLoader::ConvertFBXMesh: Finished processing " + std::to_string(indices.size()) + " indices");
         
-        // Set mesh data
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Setting vertices on engine mesh...");
-        engineMesh->SetVertices(vertices);
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Setting indices on engine mesh...");
-        engineMesh->SetIndices(indices);
-        Logger::GetInstance().Info("FBXLoader::ProcessFBXMesh: Mesh data set successfully");
+        data.name = mesh->mName.length > 0 ? std::string(mesh->mName.C_Str()) : std::string();
+        data.materialIndex = mesh->mMaterialIndex;
+        data.hasNormals = mesh->mNormals != nullptr;
+        data.hasTangents = mesh->mTangents != nullptr;
+        data.converted = true;
+        return true;
         
-        // Set mesh name if available
-        if (mesh->mName.length > 0) {
-            engineMesh->SetName(std::string(mesh->mName.C_Str()));
+    } catch (const std::exception& e) {
+        Logger::GetInstance().Error("FBXLoader::ConvertFBXMesh: Exception processing mesh: " + std::string(e.what()));
+        return false;
+    }
+}
+
+void FBXLoader::PrepareFBXMesh(MeshData& data) const {
+    // Apply mesh optimizations if enabled
+    if (m_config.optimizeMeshes) {
+        if (m_config.generateMissingNormals && !data.hasNormals) {
+            Mesh::GenerateNormals(data.vertices, data.indices, true);
+        }
+        if (m_config.generateTangents && !data.hasTangents) {
+            Mesh::GenerateTangents(data.vertices, data.indices);
         }
+        Mesh::OptimizeVertexCache(data.indices, data.vertices.size());
+    }
+    
+    Mesh::CalculateBounds(data.vertices, data.boundingBox, data.boundingSphere);
+}
+
+std::shared_ptr<Mesh> FBXLoader::CreateFBXMesh(MeshData& data) {
+    try {
+        auto engineMesh = std::make_shared<Mesh>();
+        const size_t vertexCount = data.vertices.size();
+        const size_t triangleCount = data.indices.size() / 3;
         
-        // Set material index
-        engineMesh->SetMaterialIndex(mesh->mMaterialIndex);
+        // Set mesh data; the passes already ran in PrepareFBXMesh, so this only uploads
+        engineMesh->SetGeometry(std::move(data.vertices), std::move(data.indices), data.boundingBox, data.boundingSphere);
         
-        // Apply mesh optimizations if enabled
-        if (m_config.optimizeMeshes) {
-            if (m_config.generateMissingNormals && !mesh->mNormals) {
-                engineMesh->GenerateNormals(true);
-            }
-            if (m_config.generateTangents && !mesh->mTangents) {
-                engineMesh->GenerateTangents();
-            }
-            engineMesh->OptimizeVertexCache();
+        // Set mesh name if available
+        if (!data.name.empty()) {
+            engineMesh->SetName(data.name);
         }
         
+        // Set material index
+        engineMesh->SetMaterialIndex(data.materialIndex);
+        
         Logger::GetInstance().Debug("Processed FBX mesh '" + engineMesh->GetName() + "': " + 
-                                  std::to_string(vertices.size()) + " vertices, " + 
-                                  std::to_string(indices.size() / 3) + " triangles");
+                                  std::to_string(vertexCount) + " vertices, " + 
+                                  std::to_string(triangleCount) + " triangles");
         
         return engineMesh;
         
     } catch (const std::exception& e) {
-        Logger::GetInstance().Error("FBXLoader::ProcessFBXMesh: Exception processing mesh: " + std::string(e.what()));
+        Logger::GetInstance().Error("FBXLoader::CreateFBXMesh: Exception creating mesh: " + std::string(e.what()));
         return nullptr;
     }
 }
@@ -514,13 +540,27 @@ std::vector<std::shared_ptr<Material>> FBXLoader::ProcessFBXMaterials(const aiSc
         return materials;
     }
     
-    materials.reserve(scene->mNumMaterials);
+    // Material properties and texture path lookups (filesystem probing) run per material in parallel
+    std::vector<std::shared_ptr<Material>> processed(scene->mNumMaterials);
+    std::vector<std::vector<TextureBinding>> textures(scene->mNumMaterials);
+    ParallelImportFor(scene->mNumMaterials, [&](size_t i) {
+        processed[i] = ProcessFBXMaterial(scene->mMaterials[i], filepath, textures[i]);
+    }, m_jobSystem, m_config.parallelMeshProcessing ? 0 : 1);
     
+    // Texture objects are created here on the importing thread: they may need the GL context
+    // and share m_textureCache between materials
+    materials.reserve(scene->mNumMaterials);
     for (uint32_t i = 0; i < scene->mNumMaterials; i++) {
-        auto material = ProcessFBXMaterial(scene->mMaterials[i], filepath);
-        if (material) {
-            materials.push_back(material);
+        if (!processed[i]) {
+            continue;
+        }
+        for (const auto& binding : textures[i]) {
+            auto texture = LoadFBXTexture(binding.texturePath, binding.resolvedPath);
+            if (texture) {
+                processed[i]->SetTexture(binding.uniformName, texture);
+            }
         }
+        materials.push_back(processed[i]);
     }
     
     Logger::GetInstance().Info("Processed " + std::to_string(materials.size()) + " FBX materials");
@@ -528,7 +568,7 @@ std::vector<std::shared_ptr<Material>> FBXLoader::ProcessFBXMaterials(const aiSc
     return materials;
 }
 
-std::shared_ptr<Material> FBXLoader::ProcessFBXMaterial(const aiMaterial* aiMat, const std::string& filepath) {
+std::shared_ptr<Material> FBXLoader::ProcessFBXMaterial(const aiMaterial* aiMat, const std::string& filepath, std::vector<TextureBinding>& textures) {
     if (!aiMat) {
         Logger::GetInstance().Warning("FBXLoader::ProcessFBXMaterial: aiMaterial is null");
         return nullptr;
@@ -575,36 +615,21 @@ std::shared_ptr<Material> FBXLoader::ProcessFBXMaterial(const aiMaterial* aiMat,
             material->SetRoughness(roughness);
         }
         
-        // Process textures if enabled
+        // Resolve texture files if enabled; the textures themselves are loaded by ProcessFBXMaterials
         if (m_config.importTextures) {
             Logger::GetInstance().Debug("Processing textures for material: " + materialName);
             
-            // Diffuse texture
-            aiString texturePath;
-            if (aiMat->GetTexture(aiTextureType_DIFFUSE, 0, &texturePath) == AI_SUCCESS) {
-                Logger::GetInstance().Debug("Found diffuse texture: " + std::string(texturePath.C_Str()));
-                auto texture = LoadFBXTexture(std::string(texturePath.C_Str()), filepath);
-                if (texture) {
-                    material->SetTexture("u_diffuseTexture", texture);
-                    Logger::GetInstance().Debug("Successfully set diffuse texture for material: " + materialName);
-                }
-            }
-            
-            // Normal texture
-            if (aiMat->GetTexture(aiTextureType_NORMALS, 0, &texturePath) == AI_SUCCESS) {
-                Logger::GetInstance().Debug("Found normal texture: " + std::string(texturePath.C_Str()));
-                auto texture = LoadFBXTexture(std::string(texturePath.C_Str()), filepath);
-                if (texture) {
-                    material->SetTexture("u_normalTexture", texture);
-                }
-            }
-            
-            // Specular texture
-            if (aiMat->GetTexture(aiTextureType_SPECULAR, 0, &texturePath) == AI_SUCCESS) {
-                Logger::GetInstance().Debug("Found specular texture: " + std::string(texturePath.C_Str()));
-                auto texture = LoadFBXTexture(std::string(texturePath.C_Str()), filepath);
-                if (texture) {
-                    material->SetTexture("u_specularTexture", texture);
+            const std::pair<aiTextureType, const char*> textureSlots[] = {
+                {aiTextureType_DIFFUSE, "u_diffuseTexture"},
+                {aiTextureType_NORMALS, "u_normalTexture"},
+                {aiTextureType_SPECULAR, "u_specularTexture"}
+            };
+            for (const auto& [type, uniformName] : textureSlots) {
+                aiString texturePath;
+                if (aiMat->GetTexture(type, 0, &texturePath) == AI_SUCCESS) {
+                    Logger::GetInstance().Debug("Found " + std::string(uniformName) + " texture: " + std::string(texturePath.C_Str()));
+                    std::string path(texturePath.C_Str());
+                    textures.push_back({uniformName, path, FindTexturePath(path, filepath)});
                 }
             }
         }
@@ -648,82 +673,40 @@ Math::Mat4 FBXLoader::GetFBXToOpenGLTransform() const {
     return Math::Mat4(1.0f);
 }
 
-void FBXLoader::ProcessFBXNode(const aiNode* node, const aiScene* scene, std::vector<std::shared_ptr<Mesh>>& meshes) {
+void FBXLoader::CollectFBXNodeMeshes(const aiNode* node, const aiScene* scene, std::vector<const aiMesh*>& meshes) const {
     if (!node) {
-        Logger::GetInstance().Debug("FBXLoader::ProcessFBXNode: Node is null, returning");
         return;
     }
     
-    std::string nodeName = node->mName.length > 0 ? std::string(node->mName.C_Str()) : "unnamed_node";
-    Logger::GetInstance().Debug("FBXLoader::ProcessFBXNode: Processing node '" + nodeName + "' with " + 
-                              std::to_string(node->mNumMeshes) + " meshes and " + 
-                              std::to_string(node->mNumChildren) + " children");
-    
-    // Process all meshes in this node
     for (uint32_t i = 0; i < node->mNumMeshes; i++) {
-        try {
-            uint32_t meshIndex = node->mMeshes[i];
-            Logger::GetInstance().Debug("FBXLoader::ProcessFBXNode: Processing mesh " + std::to_string(i) + 
-                                      " (scene index: " + std::to_string(meshIndex) + ")");
-            
-            if (meshIndex >= scene->mNumMeshes) {
-                Logger::GetInstance().Error("FBXLoader::ProcessFBXNode: Invalid mesh index " + std::to_string(meshIndex) + 
-                                          " (scene has " + std::to_string(scene->mNumMeshes) + " meshes)");
-                continue;
-            }
-            
-            aiMesh* mesh = scene->mMeshes[meshIndex];
-            if (!mesh) {
-                Logger::GetInstance().Error("FBXLoader::ProcessFBXNode: Mesh at index " + std::to_string(meshIndex) + " is null");
-                continue;
-            }
-            
-            Logger::GetInstance().Debug("FBXLoader::ProcessFBXNode: About to call ProcessFBXMesh for mesh '" + 
-                                      (mesh->mName.length > 0 ? std::string(mesh->mName.C_Str()) : "unnamed_mesh") + "'");
-            
-            auto engineMesh = ProcessFBXMesh(mesh, scene);
-            
-            Logger::GetInstance().Debug("FBXLoader::ProcessFBXNode: ProcessFBXMesh completed");
-            
-            if (engineMesh) {
-                meshes.push_back(engineMesh);
-                Logger::GetInstance().Debug("FBXLoader::ProcessFBXNode: Added mesh to result list (total: " + std::to_string(meshes.size()) + ")");
-            } else {
-                Logger::GetInstance().Warning("FBXLoader::ProcessFBXNode: ProcessFBXMesh returned null for mesh " + std::to_string(i));
-            }
-        } catch (const std::exception& e) {
-            Logger::GetInstance().Error("FBXLoader::ProcessFBXNode: Exception processing mesh " + std::to_string(i) + ": " + std::string(e.what()));
-            // Continue processing other meshes
+        uint32_t meshIndex = node->mMeshes[i];
+        if (meshIndex >= scene->mNumMeshes) {
+            Logger::GetInstance().Error("FBXLoader::CollectFBXNodeMeshes: Invalid mesh index " + std::to_string(meshIndex) + 
+                                      " (scene has " + std::to_string(scene->mNumMeshes) + " meshes)");
+            continue;
         }
+        
+        const aiMesh* mesh = scene->mMeshes[meshIndex];
+        if (!mesh) {
+            Logger::GetInstance().Error("FBXLoader::CollectFBXNodeMeshes: Mesh at index " + std::to_string(meshIndex) + " is null");
+            continue;
+        }
+        meshes.push_back(mesh);
     }
     
-    Logger::GetInstance().Debug("FBXLoader::ProcessFBXNode: Finished processing meshes for node '" + nodeName + 
-                              "', now processing " + std::to_string(node->mNumChildren) + " child nodes");
-    
-    // Recursively process child nodes
     for (uint32_t i = 0; i < node->mNumChildren; i++) {
-        try {
-            Logger::GetInstance().Debug("FBXLoader::ProcessFBXNode: Processing child node " + std::to_string(i));
-            ProcessFBXNode(node->mChildren[i], scene, meshes);
-            Logger::GetInstance().Debug("FBXLoader::ProcessFBXNode: Completed child node " + std::to_string(i));
-        } catch (const std::exception& e) {
-            Logger::GetInstance().Error("FBXLoader::ProcessFBXNode: Exception processing child node " + std::to_string(i) + ": " + std::string(e.what()));
-            // Continue processing other child nodes
-        }
+        CollectFBXNodeMeshes(node->mChildren[i], scene, meshes);
     }
-    
-    Logger::GetInstance().Debug("FBXLoader::ProcessFBXNode: Completed processing node '" + nodeName + "'");
 }
 
-std::shared_ptr<Texture> FBXLoader::LoadFBXTexture(const std::string& texturePath, const std::string& modelPath) {
+std::shared_ptr<Texture> FBXLoader::LoadFBXTexture(const std::string& texturePath, const std::string& resolvedPath) {
     // Check cache first
     auto it = m_textureCache.find(texturePath);
     if (it != m_textureCache.end()) {
         return it->second;
     }
     
-    // Find the actual texture file path
-    std::string actualPath = FindTexturePath(texturePath, modelPath);
+    const std::string& actualPath = resolvedPath;
     
     if (actualPath.empty() || !std::filesystem::exists(actualPath)) {
         Logger::GetInstance().Warning("FBXLoader: Texture not found: " + texturePath + ", creating default texture");
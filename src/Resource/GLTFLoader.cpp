@@ -11,6 +11,8 @@
 #include <algorithm>
 #include <cstring>
 #include <cstdint>
+#include <limits>
+#include <type_traits>
 
 namespace GameEngine {
 
@@ -50,14 +52,7 @@ GLTFLoader::LoadResult GLTFLoader::LoadGLTF(const std::string& filepath) {
     m_baseDirectory = std::filesystem::path(filepath).parent_path().string();
     
     // Clear previous data
-    m_buffers.clear();
-    m_bufferViews.clear();
-    m_accessors.clear();
-    m_materials.clear();
-    m_meshes.clear();
-    m_animations.clear();
-    m_skeletons.clear();
-    m_skins.clear();
+    ClearParsedData();
     
     bool loadSuccess = false;
     
@@ -73,52 +68,23 @@ GLTFLoader::LoadResult GLTFLoader::LoadGLTF(const std::string& filepath) {
     }
     
     if (!loadSuccess) {
+        m_mappedFile.Close();
         result.errorMessage = "Failed to load GLTF file";
         LogError(result.errorMessage);
         return result;
     }
     
-    // Parse GLTF components
-    if (!ParseBuffers() || !ParseBufferViews() || !ParseAccessors() || 
-        !ParseMaterials() || !ParseMeshes() || !ParseAnimations() || !ParseSkins()) {
-        result.errorMessage = "Failed to parse GLTF components";
-        LogError(result.errorMessage);
-        return result;
-    }
-    
-    // Parse scene
-    result.model = ParseScene();
-    if (!result.model) {
-        result.errorMessage = "Failed to parse GLTF scene";
-        LogError(result.errorMessage);
-        return result;
-    }
-    
-    // Calculate statistics
-    result.nodeCount = static_cast<uint32_t>(result.model->GetAllNodes().size());
-    result.meshCount = static_cast<uint32_t>(m_meshes.size());
-    result.materialCount = static_cast<uint32_t>(m_materials.size());
-    
-    for (const auto& mesh : m_meshes) {
-        if (mesh) {
-            result.totalVertices += mesh->GetVertexCount();
-            result.totalTriangles += mesh->GetTriangleCount();
-        }
-    }
-    
-    auto endTime = std::chrono::high_resolution_clock::now();
-    result.loadingTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
-    
-    result.success = true;
-    LogInfo("GLTF loaded successfully: " + std::to_string(result.meshCount) + " meshes, " +
-            std::to_string(result.totalVertices) + " vertices, " +
-            std::to_string(result.totalTriangles) + " triangles in " +
-            std::to_string(result.loadingTimeMs) + "ms");
-    
+    // GLB vertex data is decoded straight out of the mapping, which is released afterwards
+    result = FinishLoad(startTime);
+    m_mappedFile.Close();
     return result;
 }
 
 GLTFLoader::LoadResult GLTFLoader::LoadGLTFFromMemory(const std::vector<uint8_t>& data, const std::string& baseDir) {
+    return LoadGLTFFromMemory(data.data(), data.size(), baseDir);
+}
+
+GLTFLoader::LoadResult GLTFLoader::LoadGLTFFromMemory(const uint8_t* data, size_t size, const std::string& baseDir) {
     LoadResult result;
     auto startTime = std::chrono::high_resolution_clock::now();
     
@@ -127,62 +93,68 @@ GLTFLoader::LoadResult GLTFLoader::LoadGLTFFromMemory(const std::vector<uint8_t>
     m_baseDirectory = baseDir;
     
     // Clear previous data
-    m_buffers.clear();
-    m_bufferViews.clear();
-    m_accessors.clear();
-    m_materials.clear();
-    m_meshes.clear();
-    m_animations.clear();
-    m_skeletons.clear();
-    m_skins.clear();
+    ClearParsedData();
     
-    // Check if it's GLB format (starts with magic number)
-    if (data.size() >= 12) {
-        uint32_t magic = *reinterpret_cast<const uint32_t*>(data.data());
-        if (magic == GLTF_MAGIC) {
-            // Parse GLB format
-            std::string jsonChunk;
-            std::vector<uint8_t> binaryChunk;
-            
-            if (!ExtractGLBChunks(data, jsonChunk, binaryChunk)) {
-                result.errorMessage = "Failed to extract GLB chunks";
-                LogError(result.errorMessage);
-                return result;
-            }
-            
-            try {
-                m_gltfJson = nlohmann::json::parse(jsonChunk);
-                
-                // Add binary chunk as first buffer if present
-                if (!binaryChunk.empty()) {
-                    BufferInfo binaryBuffer;
-                    binaryBuffer.data = std::move(binaryChunk);
-                    binaryBuffer.byteLength = static_cast<uint32_t>(binaryBuffer.data.size());
-                    m_buffers.push_back(std::move(binaryBuffer));
-                }
-                
-            } catch (const nlohmann::json::exception& e) {
-                result.errorMessage = "Failed to parse GLB JSON: " + std::string(e.what());
-                LogError(result.errorMessage);
-                return result;
-            }
-        } else {
-            // Assume JSON format
-            try {
-                std::string jsonStr(data.begin(), data.end());
-                m_gltfJson = nlohmann::json::parse(jsonStr);
-            } catch (const nlohmann::json::exception& e) {
-                result.errorMessage = "Failed to parse GLTF JSON: " + std::string(e.what());
-                LogError(result.errorMessage);
-                return result;
-            }
-        }
-    } else {
+    if (!data || size < 12) {
         result.errorMessage = "Invalid GLTF data size";
         LogError(result.errorMessage);
         return result;
     }
     
+    if (!ParseDocument(data, size, result.errorMessage)) {
+        LogError(result.errorMessage);
+        return result;
+    }
+    
+    return FinishLoad(startTime);
+}
+
+bool GLTFLoader::ParseDocument(const uint8_t* data, size_t size, std::string& errorMessage) {
+    // GLB starts with the magic number, anything else is treated as JSON
+    uint32_t magic = 0;
+    std::memcpy(&magic, data, sizeof(magic));
+    
+    if (magic == GLTF_MAGIC) {
+        const char* jsonChunk = nullptr;
+        size_t jsonLength = 0;
+        const uint8_t* binaryChunk = nullptr;
+        size_t binaryLength = 0;
+        
+        if (!ExtractGLBChunks(data, size, jsonChunk, jsonLength, binaryChunk, binaryLength)) {
+            errorMessage = "Failed to extract GLB chunks";
+            return false;
+        }
+        
+        try {
+            m_gltfJson = nlohmann::json::parse(jsonChunk, jsonChunk + jsonLength);
+        } catch (const nlohmann::json::exception& e) {
+            errorMessage = "Failed to parse GLB JSON: " + std::string(e.what());
+            return false;
+        }
+        
+        // The binary chunk becomes buffer 0, referenced in place rather than copied
+        if (binaryChunk && binaryLength > 0) {
+            BufferInfo binaryBuffer;
+            binaryBuffer.view = binaryChunk;
+            binaryBuffer.byteLength = static_cast<uint32_t>(binaryLength);
+            m_buffers.push_back(std::move(binaryBuffer));
+        }
+        return true;
+    }
+    
+    try {
+        const char* text = reinterpret_cast<const char*>(data);
+        m_gltfJson = nlohmann::json::parse(text, text + size);
+    } catch (const nlohmann::json::exception& e) {
+        errorMessage = "Failed to parse GLTF JSON: " + std::string(e.what());
+        return false;
+    }
+    return true;
+}
+
+GLTFLoader::LoadResult GLTFLoader::FinishLoad(std::chrono::high_resolution_clock::time_point startTime) {
+    LoadResult result;
+    
     // Parse GLTF components
     if (!ParseBuffers() || !ParseBufferViews() || !ParseAccessors() || 
         !ParseMaterials() || !ParseMeshes() || !ParseAnimations() || !ParseSkins()) {
@@ -199,6 +171,11 @@ GLTFLoader::LoadResult GLTFLoader::LoadGLTFFromMemory(const std::vector<uint8_t>
         return result;
     }
     
+    // Everything has been decoded into meshes, skins and animations; drop the source bytes
+    // (and any view into caller memory) now rather than at the next load
+    m_buffers.clear();
+    m_buffers.shrink_to_fit();
+    
     // Calculate statistics
     result.nodeCount = static_cast<uint32_t>(result.model->GetAllNodes().size());
     result.meshCount = static_cast<uint32_t>(m_meshes.size());
@@ -215,7 +192,7 @@ GLTFLoader::LoadResult GLTFLoader::LoadGLTFFromMemory(const std::vector<uint8_t>
     result.loadingTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
     
     result.success = true;
-    LogInfo("GLTF loaded from memory successfully: " + std::to_string(result.meshCount) + " meshes, " +
+    LogInfo("GLTF loaded successfully: " + std::to_string(result.meshCount) + " meshes, " +
             std::to_string(result.totalVertices) + " vertices, " +
             std::to_string(result.totalTriangles) + " triangles in " +
             std::to_string(result.loadingTimeMs) + "ms");
@@ -223,6 +200,17 @@ GLTFLoader::LoadResult GLTFLoader::LoadGLTFFromMemory(const std::vector<uint8_t>
     return result;
 }
 
+void GLTFLoader::ClearParsedData() {
+    m_buffers.clear();
+    m_bufferViews.clear();
+    m_accessors.clear();
+    m_materials.clear();
+    m_meshes.clear();
+    m_animations.clear();
+    m_skeletons.clear();
+    m_skins.clear();
+}
+
 bool GLTFLoader::IsGLTFFile(const std::string& filepath) {
     std::string extension = std::filesystem::path(filepath).extension().string();
     std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
@@ -235,6 +223,11 @@ bool GLTFLoader::IsGLBFile(const std::string& filepath) {
     return extension == ".glb";
 }
 
+void GLTFLoader::SetCompactVertices(bool enabled, const VertexFormatOptions& options) {
+    m_compactVertices = enabled;
+    m_vertexFormatOptions = options;
+}
+
 bool GLTFLoader::LoadGLTFJson(const std::string& filepath) {
     try {
         std::ifstream file(filepath);
@@ -253,45 +246,19 @@ bool GLTFLoader::LoadGLTFJson(const std::string& filepath) {
 }
 
 bool GLTFLoader::LoadGLBBinary(const std::string& filepath) {
-    std::ifstream file(filepath, std::ios::binary);
-    if (!file.is_open()) {
+    // Map the file instead of reading it; the binary chunk is used in place until LoadGLTF returns
+    if (!m_mappedFile.Open(filepath)) {
         LogError("Failed to open GLB file: " + filepath);
         return false;
     }
     
-    // Read entire file
-    file.seekg(0, std::ios::end);
-    size_t fileSize = file.tellg();
-    file.seekg(0, std::ios::beg);
-    
-    std::vector<uint8_t> data(fileSize);
-    file.read(reinterpret_cast<char*>(data.data()), fileSize);
-    
-    // Extract JSON and binary chunks
-    std::string jsonChunk;
-    std::vector<uint8_t> binaryChunk;
-    
-    if (!ExtractGLBChunks(data, jsonChunk, binaryChunk)) {
+    std::string errorMessage;
+    if (!ParseDocument(m_mappedFile.GetData(), m_mappedFile.GetSize(), errorMessage)) {
+        LogError(errorMessage);
         return false;
     }
     
-    try {
-        m_gltfJson = nlohmann::json::parse(jsonChunk);
-        
-        // Add binary chunk as first buffer if present
-        if (!binaryChunk.empty()) {
-            BufferInfo binaryBuffer;
-            binaryBuffer.data = std::move(binaryChunk);
-            binaryBuffer.byteLength = static_cast<uint32_t>(binaryBuffer.data.size());
-            m_buffers.push_back(std::move(binaryBuffer));
-        }
-        
-        return ParseGLTFJson(m_gltfJson);
-        
-    } catch (const nlohmann::json::exception& e) {
-        LogError("Failed to parse GLB JSON: " + std::string(e.what()));
-        return false;
-    }
+    return ParseGLTFJson(m_gltfJson);
 }
 
 bool GLTFLoader::ParseGLTFJson(const nlohmann::json& json) {
@@ -311,16 +278,23 @@ bool GLTFLoader::ParseGLTFJson(const nlohmann::json& json) {
     return true;
 }
 
-bool GLTFLoader::ExtractGLBChunks(const std::vector<uint8_t>& data, std::string& jsonChunk, std::vector<uint8_t>& binaryChunk) {
-    if (data.size() < 12) {
+bool GLTFLoader::ExtractGLBChunks(const uint8_t* data, size_t size, const char*& jsonChunk, size_t& jsonLength,
+                                  const uint8_t*& binaryChunk, size_t& binaryLength) {
+    if (size < 12) {
         LogError("GLB file too small");
         return false;
     }
     
+    auto readUint32 = [data](size_t offset) {
+        uint32_t value = 0;
+        std::memcpy(&value, data + offset, sizeof(value));
+        return value;
+    };
+    
     // Parse GLB header
-    uint32_t magic = *reinterpret_cast<const uint32_t*>(data.data());
-    uint32_t version = *reinterpret_cast<const uint32_t*>(data.data() + 4);
-    uint32_t length = *reinterpret_cast<const uint32_t*>(data.data() + 8);
+    uint32_t magic = readUint32(0);
+    uint32_t version = readUint32(4);
+    uint32_t length = readUint32(8);
     
     if (magic != GLTF_MAGIC) {
         LogError("Invalid GLB magic number");
@@ -332,7 +306,7 @@ bool GLTFLoader::ExtractGLBChunks(const std::vector<uint8_t>& data, std::string&
         return false;
     }
     
-    if (length > data.size()) {
+    if (length > size) {
         LogError("GLB length exceeds file size");
         return false;
     }
@@ -340,13 +314,13 @@ bool GLTFLoader::ExtractGLBChunks(const std::vector<uint8_t>& data, std::string&
     size_t offset = 12; // Skip header
     
     // Parse JSON chunk
-    if (offset + 8 > data.size()) {
+    if (offset + 8 > size) {
         LogError("GLB file truncated at JSON chunk header");
         return false;
     }
     
-    uint32_t jsonLength = *reinterpret_cast<const uint32_t*>(data.data() + offset);
-    uint32_t jsonType = *reinterpret_cast<const uint32_t*>(data.data() + offset + 4);
+    uint32_t jsonChunkLength = readUint32(offset);
+    uint32_t jsonType = readUint32(offset + 4);
     offset += 8;
     
     if (jsonType != GLTF_CHUNK_JSON) {
@@ -354,22 +328,26 @@ bool GLTFLoader::ExtractGLBChunks(const std::vector<uint8_t>& data, std::string&
         return false;
     }
     
-    if (offset + jsonLength > data.size()) {
+    if (offset + jsonChunkLength > size) {
         LogError("GLB file truncated at JSON chunk data");
         return false;
     }
     
-    jsonChunk = std::string(data.begin() + offset, data.begin() + offset + jsonLength);
-    offset += jsonLength;
+    jsonChunk = reinterpret_cast<const char*>(data + offset);
+    jsonLength = jsonChunkLength;
+    offset += jsonChunkLength;
     
     // Parse binary chunk (optional)
-    if (offset + 8 <= data.size()) {
-        uint32_t binaryLength = *reinterpret_cast<const uint32_t*>(data.data() + offset);
-        uint32_t binaryType = *reinterpret_cast<const uint32_t*>(data.data() + offset + 4);
+    binaryChunk = nullptr;
+    binaryLength = 0;
+    if (offset + 8 <= size) {
+        uint32_t binaryChunkLength = readUint32(offset);
+        uint32_t binaryType = readUint32(offset + 4);
         offset += 8;
         
-        if (binaryType == GLTF_CHUNK_BIN && offset + binaryLength <= data.size()) {
-            binaryChunk = std::vector<uint8_t>(data.begin() + offset, data.begin() + offset + binaryLength);
+        if (binaryType == GLTF_CHUNK_BIN && offset + binaryChunkLength <= size) {
+            binaryChunk = data + offset;
+            binaryLength = binaryChunkLength;
         }
     }
     
@@ -449,6 +427,7 @@ bool GLTFLoader::ParseAccessors() {
     
     for (const auto& accessorJson : accessorsJson) {
         AccessorInfo accessor;
+        accessor.hasBufferView = accessorJson.contains("bufferView");
         accessor.bufferView = accessorJson.value("bufferView", 0);
         accessor.byteOffset = accessorJson.value("byteOffset", 0);
         accessor.componentType = accessorJson["componentType"];
@@ -456,6 +435,20 @@ bool GLTFLoader::ParseAccessors() {
         accessor.type = accessorJson["type"];
         accessor.normalized = accessorJson.value("normalized", false);
         
+        if (accessorJson.contains("sparse")) {
+            const auto& sparseJson = accessorJson["sparse"];
+            accessor.sparseCount = sparseJson.value("count", 0);
+            if (accessor.sparseCount > 0) {
+                const auto& indicesJson = sparseJson["indices"];
+                const auto& valuesJson = sparseJson["values"];
+                accessor.sparseIndicesBufferView = indicesJson["bufferView"];
+                accessor.sparseIndicesByteOffset = indicesJson.value("byteOffset", 0);
+                accessor.sparseIndicesComponentType = indicesJson["componentType"];
+                accessor.sparseValuesBufferView = valuesJson["bufferView"];
+                accessor.sparseValuesByteOffset = valuesJson.value("byteOffset", 0);
+            }
+        }
+        
         m_accessors.push_back(accessor);
     }
     
@@ -668,9 +661,6 @@ bool GLTFLoader::ParseMeshPrimitive(const nlohmann::json& primitiveJson, std::sh
     
     const auto& attributesJson = primitiveJson["attributes"];
     
-    // Parse vertex attributes
-    std::vector<Vertex> vertices;
-    
     // Position is required
     if (!attributesJson.contains("POSITION")) {
         LogError("Primitive missing POSITION attribute");
@@ -678,99 +668,53 @@ bool GLTFLoader::ParseMeshPrimitive(const nlohmann::json& primitiveJson, std::sh
     }
     
     uint32_t positionAccessor = attributesJson["POSITION"];
-    auto positions = GetVec3AccessorData(positionAccessor);
-    
-    if (positions.empty()) {
+    if (positionAccessor >= m_accessors.size() || m_accessors[positionAccessor].count == 0) {
         LogError("Failed to get position data");
         return false;
     }
     
-    vertices.resize(positions.size());
-    for (size_t i = 0; i < positions.size(); ++i) {
-        vertices[i].position = positions[i];
-    }
-    
-    // Normal (optional)
-    if (attributesJson.contains("NORMAL")) {
-        uint32_t normalAccessor = attributesJson["NORMAL"];
-        auto normals = GetVec3AccessorData(normalAccessor);
-        
-        if (normals.size() == vertices.size()) {
-            for (size_t i = 0; i < normals.size(); ++i) {
-                vertices[i].normal = normals[i];
-            }
-        }
-    }
-    
-    // Texture coordinates (optional)
-    if (attributesJson.contains("TEXCOORD_0")) {
-        uint32_t texCoordAccessor = attributesJson["TEXCOORD_0"];
-        auto texCoords = GetVec2AccessorData(texCoordAccessor);
-        
-        if (texCoords.size() == vertices.size()) {
-            for (size_t i = 0; i < texCoords.size(); ++i) {
-                vertices[i].texCoords = texCoords[i];
-            }
-        }
-    }
-    
-    // Tangent (optional)
-    if (attributesJson.contains("TANGENT")) {
-        uint32_t tangentAccessor = attributesJson["TANGENT"];
-        // Tangents are Vec4 in GLTF (w component for handedness)
-        // For now, we'll just use the xyz components
-        auto tangentData = GetAccessorData<Math::Vec4>(tangentAccessor);
-        
-        if (tangentData.size() == vertices.size()) {
-            for (size_t i = 0; i < tangentData.size(); ++i) {
-                vertices[i].tangent = Math::Vec3(tangentData[i].x, tangentData[i].y, tangentData[i].z);
-            }
-        }
-    }
-    
-    // Color (optional)
-    if (attributesJson.contains("COLOR_0")) {
-        uint32_t colorAccessor = attributesJson["COLOR_0"];
-        auto colors = GetAccessorData<Math::Vec4>(colorAccessor);
-        
-        if (colors.size() == vertices.size()) {
-            for (size_t i = 0; i < colors.size(); ++i) {
-                vertices[i].color = colors[i];
-            }
-        }
-    }
+    // Every attribute is decoded from its buffer straight into its field of the final vertex
+    // array; no per-attribute temporaries
+    const uint32_t vertexCount = m_accessors[positionAccessor].count;
+    std::vector<Vertex> vertices(vertexCount);
+    const size_t vertexStride = sizeof(Vertex);
     
-    // Bone IDs (for skinning)
-    if (attributesJson.contains("JOINTS_0")) {
-        uint32_t jointsAccessor = attributesJson["JOINTS_0"];
-        auto joints = GetAccessorData<Math::Vec4>(jointsAccessor);
-        
-        if (joints.size() == vertices.size()) {
-            for (size_t i = 0; i < joints.size(); ++i) {
-                vertices[i].boneIds = joints[i];
-            }
-        }
+    if (!DecodeAccessor(positionAccessor, &vertices[0].position.x, vertexStride, 3, vertexCount)) {
+        LogError("Failed to get position data");
+        return false;
     }
     
-    // Bone weights (for skinning)
-    if (attributesJson.contains("WEIGHTS_0")) {
-        uint32_t weightsAccessor = attributesJson["WEIGHTS_0"];
-        auto weights = GetAccessorData<Math::Vec4>(weightsAccessor);
-        
-        if (weights.size() == vertices.size()) {
-            for (size_t i = 0; i < weights.size(); ++i) {
-                vertices[i].boneWeights = weights[i];
-            }
+    // Optional attributes; a mismatched accessor leaves the field at its default
+    struct AttributeTarget {
+        const char* name;
+        float* destination;
+        uint32_t components;
+    };
+    const AttributeTarget optionalAttributes[] = {
+        {"NORMAL", &vertices[0].normal.x, 3},
+        {"TEXCOORD_0", &vertices[0].texCoords.x, 2},
+        {"TEXCOORD_1", &vertices[0].texCoords2.x, 2},
+        {"TANGENT", &vertices[0].tangent.x, 3},        // xyz; w (handedness) is not stored
+        {"COLOR_0", &vertices[0].color.x, 4},          // VEC3 colors keep alpha at 1
+        {"JOINTS_0", &vertices[0].boneIds.x, 4},
+        {"WEIGHTS_0", &vertices[0].boneWeights.x, 4}
+    };
+    for (const auto& attribute : optionalAttributes) {
+        if (attributesJson.contains(attribute.name)) {
+            uint32_t accessorIndex = attributesJson[attribute.name];
+            DecodeAccessor(accessorIndex, attribute.destination, vertexStride, attribute.components, vertexCount);
         }
     }
     
-    mesh->SetVertices(vertices);
+    mesh->SetVertices(std::move(vertices));
     
     // Parse indices
     if (primitiveJson.contains("indices")) {
         uint32_t indicesAccessor = primitiveJson["indices"];
-        auto indices = GetScalarAccessorData(indicesAccessor);
-        mesh->SetIndices(indices);
+        std::vector<uint32_t> indices;
+        if (DecodeIndices(indicesAccessor, indices)) {
+            mesh->SetIndices(std::move(indices));
+        }
     }
     
     // Parse material
@@ -794,6 +738,10 @@ bool GLTFLoader::ParseMeshPrimitive(const nlohmann::json& primitiveJson, std::sh
         }
     }
     
+    if (m_compactVertices) {
+        mesh->PackVertices(m_vertexFormatOptions);
+    }
+    
     return true;
 }
 
@@ -874,49 +822,246 @@ void GLTFLoader::ParsePBRMetallicRoughness(const nlohmann::json& pbrJson, std::s
     }
 }
 
+namespace {
+
+// Reads component c of an element; unaligned-safe since interleaved views need not be aligned
 template<typename T>
-std::vector<T> GLTFLoader::GetAccessorData(uint32_t accessorIndex) {
+inline T ReadComponent(const uint8_t* element, uint32_t c) {
+    T value;
+    std::memcpy(&value, element + c * sizeof(T), sizeof(T));
+    return value;
+}
+
+// Integer to float per the glTF normalization rules (signed values clamp at -1)
+template<typename T>
+inline float NormalizeComponent(T value) {
+    if constexpr (std::is_signed_v<T>) {
+        return std::max(static_cast<float>(value) / static_cast<float>(std::numeric_limits<T>::max()), -1.0f);
+    } else {
+        return static_cast<float>(value) / static_cast<float>(std::numeric_limits<T>::max());
+    }
+}
+
+template<typename T>
+void DecodeStrided(const uint8_t* source, size_t sourceStride, uint32_t count, bool normalized,
+                   uint8_t* destination, size_t destinationStride, uint32_t components) {
+    for (uint32_t i = 0; i < count; ++i) {
+        const uint8_t* element = source + i * sourceStride;
+        float* out = reinterpret_cast<float*>(destination + i * destinationStride);
+        if constexpr (std::is_same_v<T, float>) {
+            std::memcpy(out, element, components * sizeof(float));
+        } else if (normalized) {
+            for (uint32_t c = 0; c < components; ++c) {
+                out[c] = NormalizeComponent(ReadComponent<T>(element, c));
+            }
+        } else {
+            for (uint32_t c = 0; c < components; ++c) {
+                out[c] = static_cast<float>(ReadComponent<T>(element, c));
+            }
+        }
+    }
+}
+
+bool DecodeComponents(uint32_t componentType, const uint8_t* source, size_t sourceStride, uint32_t count, bool normalized,
+                      uint8_t* destination, size_t destinationStride, uint32_t components) {
+    switch (componentType) {
+        case COMPONENT_TYPE_FLOAT:
+            DecodeStrided<float>(source, sourceStride, count, normalized, destination, destinationStride, components);
+            return true;
+        case COMPONENT_TYPE_BYTE:
+            DecodeStrided<int8_t>(source, sourceStride, count, normalized, destination, destinationStride, components);
+            return true;
+        case COMPONENT_TYPE_UNSIGNED_BYTE:
+            DecodeStrided<uint8_t>(source, sourceStride, count, normalized, destination, destinationStride, components);
+            return true;
+        case COMPONENT_TYPE_SHORT:
+            DecodeStrided<int16_t>(source, sourceStride, count, normalized, destination, destinationStride, components);
+            return true;
+        case COMPONENT_TYPE_UNSIGNED_SHORT:
+            DecodeStrided<uint16_t>(source, sourceStride, count, normalized, destination, destinationStride, components);
+            return true;
+        case COMPONENT_TYPE_UNSIGNED_INT:
+            DecodeStrided<uint32_t>(source, sourceStride, count, normalized, destination, destinationStride, components);
+            return true;
+        default:
+            return false;
+    }
+}
+
+inline uint32_t ReadIndex(uint32_t componentType, const uint8_t* element) {
+    switch (componentType) {
+        case COMPONENT_TYPE_UNSIGNED_BYTE: return ReadComponent<uint8_t>(element, 0);
+        case COMPONENT_TYPE_UNSIGNED_SHORT: return ReadComponent<uint16_t>(element, 0);
+        default: return ReadComponent<uint32_t>(element, 0);
+    }
+}
+
+} // namespace
+
+bool GLTFLoader::GetBufferViewData(uint32_t bufferViewIndex, uint64_t byteOffset, uint64_t elementSize, uint32_t count,
+                                   const uint8_t*& data, size_t& stride) {
+    if (bufferViewIndex >= m_bufferViews.size()) {
+        LogError("Buffer view index out of range: " + std::to_string(bufferViewIndex));
+        return false;
+    }
+    
+    const auto& bufferView = m_bufferViews[bufferViewIndex];
+    
+    if (bufferView.buffer >= m_buffers.size()) {
+        LogError("Buffer index out of range: " + std::to_string(bufferView.buffer));
+        return false;
+    }
+    
+    const auto& buffer = m_buffers[bufferView.buffer];
+    
+    // Tightly packed unless the view declares a stride (interleaved attributes)
+    stride = bufferView.byteStride != 0 ? bufferView.byteStride : static_cast<size_t>(elementSize);
+    
+    // The last element only needs elementSize bytes, not a whole stride
+    const uint64_t span = count == 0 ? 0 : (static_cast<uint64_t>(count) - 1) * stride + elementSize;
+    if (byteOffset + span > bufferView.byteLength ||
+        static_cast<uint64_t>(bufferView.byteOffset) + bufferView.byteLength > buffer.GetSize()) {
+        LogError("Accessor data exceeds buffer size");
+        return false;
+    }
+    
+    data = buffer.GetData() + bufferView.byteOffset + byteOffset;
+    return true;
+}
+
+bool GLTFLoader::GetAccessorView(uint32_t accessorIndex, AccessorView& view) {
     if (accessorIndex >= m_accessors.size()) {
         LogError("Accessor index out of range: " + std::to_string(accessorIndex));
-        return {};
+        return false;
     }
     
     const auto& accessor = m_accessors[accessorIndex];
     
-    if (accessor.bufferView >= m_bufferViews.size()) {
-        LogError("Buffer view index out of range: " + std::to_string(accessor.bufferView));
-        return {};
+    view = AccessorView();
+    view.count = accessor.count;
+    view.componentType = accessor.componentType;
+    view.componentCount = GetTypeComponentCount(accessor.type);
+    view.normalized = accessor.normalized;
+    
+    const uint32_t componentSize = GetComponentSize(accessor.componentType);
+    if (componentSize == 0 || view.componentCount == 0) {
+        return false;
     }
     
-    const auto& bufferView = m_bufferViews[accessor.bufferView];
+    const uint64_t elementSize = static_cast<uint64_t>(componentSize) * view.componentCount;
+    if (!accessor.hasBufferView) {
+        view.stride = static_cast<size_t>(elementSize);
+        return true;
+    }
     
-    if (bufferView.buffer >= m_buffers.size()) {
-        LogError("Buffer index out of range: " + std::to_string(bufferView.buffer));
-        return {};
+    return GetBufferViewData(accessor.bufferView, accessor.byteOffset, elementSize, accessor.count, view.data, view.stride);
+}
+
+bool GLTFLoader::DecodeAccessor(uint32_t accessorIndex, float* destination, size_t destinationStride,
+                                uint32_t destinationComponents, uint32_t expectedCount) {
+    AccessorView view;
+    if (!GetAccessorView(accessorIndex, view)) {
+        return false;
     }
     
-    const auto& buffer = m_buffers[bufferView.buffer];
+    if (view.count != expectedCount) {
+        LogWarning("Accessor " + std::to_string(accessorIndex) + " has " + std::to_string(view.count) +
+                   " elements, expected " + std::to_string(expectedCount));
+        return false;
+    }
     
-    // Calculate data offset and size
-    size_t dataOffset = bufferView.byteOffset + accessor.byteOffset;
-    size_t componentSize = GetComponentSize(accessor.componentType);
-    size_t componentCount = GetTypeComponentCount(accessor.type);
-    size_t elementSize = componentSize * componentCount;
+    const uint32_t components = std::min(view.componentCount, destinationComponents);
+    uint8_t* output = reinterpret_cast<uint8_t*>(destination);
     
-    if (dataOffset + accessor.count * elementSize > buffer.data.size()) {
-        LogError("Accessor data exceeds buffer size");
-        return {};
+    if (view.data) {
+        if (!DecodeComponents(view.componentType, view.data, view.stride, view.count, view.normalized,
+                              output, destinationStride, components)) {
+            LogError("Unsupported accessor component type: " + std::to_string(view.componentType));
+            return false;
+        }
+    } else {
+        for (uint32_t i = 0; i < view.count; ++i) {
+            std::memset(output + i * destinationStride, 0, components * sizeof(float));
+        }
     }
     
-    std::vector<T> result;
-    result.reserve(accessor.count);
+    // Sparse accessors: overwrite the listed elements in place
+    const auto& accessor = m_accessors[accessorIndex];
+    if (accessor.sparseCount > 0) {
+        const uint32_t indexSize = GetComponentSize(accessor.sparseIndicesComponentType);
+        const uint64_t valueSize = static_cast<uint64_t>(GetComponentSize(view.componentType)) * view.componentCount;
+        
+        const uint8_t* sparseIndices = nullptr;
+        const uint8_t* sparseValues = nullptr;
+        size_t indexStride = 0;
+        size_t valueStride = 0;
+        if (indexSize == 0 ||
+            !GetBufferViewData(accessor.sparseIndicesBufferView, accessor.sparseIndicesByteOffset, indexSize,
+                               accessor.sparseCount, sparseIndices, indexStride) ||
+            !GetBufferViewData(accessor.sparseValuesBufferView, accessor.sparseValuesByteOffset, valueSize,
+                               accessor.sparseCount, sparseValues, valueStride)) {
+            LogError("Invalid sparse data in accessor " + std::to_string(accessorIndex));
+            return false;
+        }
+        
+        // Sparse data is always tightly packed
+        indexStride = indexSize;
+        valueStride = static_cast<size_t>(valueSize);
+        
+        for (uint32_t k = 0; k < accessor.sparseCount; ++k) {
+            const uint32_t target = ReadIndex(accessor.sparseIndicesComponentType, sparseIndices + k * indexStride);
+            if (target >= view.count) {
+                LogError("Sparse index out of range in accessor " + std::to_string(accessorIndex));
+                return false;
+            }
+            DecodeComponents(view.componentType, sparseValues + k * valueStride, valueStride, 1, view.normalized,
+                             output + target * destinationStride, destinationStride, components);
+        }
+    }
     
-    const uint8_t* dataPtr = buffer.data.data() + dataOffset;
+    return true;
+}
+
+bool GLTFLoader::DecodeIndices(uint32_t accessorIndex, std::vector<uint32_t>& indices) {
+    AccessorView view;
+    if (!GetAccessorView(accessorIndex, view) || !view.data) {
+        return false;
+    }
+    
+    if (view.componentType != COMPONENT_TYPE_UNSIGNED_BYTE &&
+        view.componentType != COMPONENT_TYPE_UNSIGNED_SHORT &&
+        view.componentType != COMPONENT_TYPE_UNSIGNED_INT) {
+        LogError("Unsupported component type for indices: " + std::to_string(view.componentType));
+        return false;
+    }
+    
+    indices.resize(view.count);
+    if (view.componentType == COMPONENT_TYPE_UNSIGNED_INT && view.stride == sizeof(uint32_t)) {
+        std::memcpy(indices.data(), view.data, view.count * sizeof(uint32_t));
+        return true;
+    }
+    for (uint32_t i = 0; i < view.count; ++i) {
+        indices[i] = ReadIndex(view.componentType, view.data + i * view.stride);
+    }
+    return true;
+}
+
+template<typename T>
+std::vector<T> GLTFLoader::GetAccessorData(uint32_t accessorIndex) {
+    // Float-based element types (vectors, quaternions, matrices) go through the full decoder
+    static_assert(sizeof(T) % sizeof(float) == 0, "Accessor element types are made of floats");
     
-    for (uint32_t i = 0; i < accessor.count; ++i) {
-        T element;
-        std::memcpy(&element, dataPtr + i * elementSize, sizeof(T));
-        result.push_back(element);
+    if (accessorIndex >= m_accessors.size()) {
+        LogError("Accessor index out of range: " + std::to_string(accessorIndex));
+        return {};
+    }
+    
+    const uint32_t count = m_accessors[accessorIndex].count;
+    std::vector<T> result(count);
+    if (count > 0 &&
+        !DecodeAccessor(accessorIndex, reinterpret_cast<float*>(result.data()), sizeof(T),
+                        static_cast<uint32_t>(sizeof(T) / sizeof(float)), count)) {
+        return {};
     }
     
     return result;
@@ -931,40 +1076,9 @@ std::vector<Math::Vec2> GLTFLoader::GetVec2AccessorData(uint32_t accessorIndex)
 }
 
 std::vector<uint32_t> GLTFLoader::GetScalarAccessorData(uint32_t accessorIndex) {
-    if (accessorIndex >= m_accessors.size()) {
-        LogError("Accessor index out of range: " + std::to_string(accessorIndex));
-        return {};
-    }
-    
-    const auto& accessor = m_accessors[accessorIndex];
-    
-    // Handle different component types for indices
-    switch (accessor.componentType) {
-        case COMPONENT_TYPE_UNSIGNED_BYTE: {
-            auto data = GetAccessorData<uint8_t>(accessorIndex);
-            std::vector<uint32_t> result;
-            result.reserve(data.size());
-            for (uint8_t value : data) {
-                result.push_back(static_cast<uint32_t>(value));
-            }
-            return result;
-        }
-        case COMPONENT_TYPE_UNSIGNED_SHORT: {
-            auto data = GetAccessorData<uint16_t>(accessorIndex);
-            std::vector<uint32_t> result;
-            result.reserve(data.size());
-            for (uint16_t value : data) {
-                result.push_back(static_cast<uint32_t>(value));
-            }
-            return result;
-        }
-        case COMPONENT_TYPE_UNSIGNED_INT: {
-            return GetAccessorData<uint32_t>(accessorIndex);
-        }
-        default:
-            LogError("Unsupported component type for indices: " + std::to_string(accessor.componentType));
-            return {};
-    }
+    std::vector<uint32_t> result;
+    DecodeIndices(accessorIndex, result);
+    return result;
 }
 
 bool GLTFLoader::LoadExternalBuffer(const std::string& uri, std::vector<uint8_t>& data) {
@@ -0,0 +1,141 @@
+#include "Resource/MappedFile.h"
+#include "Core/Logger.h"
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace GameEngine {
+
+    MappedFile::~MappedFile() {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            Close();
+            std::swap(m_data, other.m_data);
+            std::swap(m_size, other.m_size);
+#ifdef _WIN32
+            std::swap(m_fileHandle, other.m_fileHandle);
+            std::swap(m_mappingHandle, other.m_mappingHandle);
+#else
+            std::swap(m_fileDescriptor, other.m_fileDescriptor);
+#endif
+        }
+        return *this;
+    }
+
+#ifdef _WIN32
+    bool MappedFile::Open(const std::string& path) {
+        Close();
+
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            LOG_ERROR("Failed to open file for mapping: " + path);
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+            LOG_ERROR("Cannot map empty or unreadable file: " + path);
+            CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            LOG_ERROR("Failed to create file mapping: " + path);
+            CloseHandle(file);
+            return false;
+        }
+
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            LOG_ERROR("Failed to map view of file: " + path);
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        m_fileHandle = file;
+        m_mappingHandle = mapping;
+        m_data = static_cast<const uint8_t*>(view);
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (m_data) {
+            UnmapViewOfFile(m_data);
+        }
+        if (m_mappingHandle) {
+            CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+        }
+        if (m_fileHandle) {
+            CloseHandle(static_cast<HANDLE>(m_fileHandle));
+        }
+        m_data = nullptr;
+        m_size = 0;
+        m_mappingHandle = nullptr;
+        m_fileHandle = nullptr;
+    }
+#else
+    bool MappedFile::Open(const std::string& path) {
+        Close();
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            LOG_ERROR("Failed to open file for mapping: " + path);
+            return false;
+        }
+
+        struct stat fileInfo;
+        if (::fstat(fd, &fileInfo) != 0 || fileInfo.st_size == 0) {
+            LOG_ERROR("Cannot map empty or unreadable file: " + path);
+            ::close(fd);
+            return false;
+        }
+
+        const size_t size = static_cast<size_t>(fileInfo.st_size);
+        void* view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            LOG_ERROR("Failed to map file: " + path);
+            ::close(fd);
+            return false;
+        }
+
+        // Whole-file reads front to back; let the kernel read ahead
+        ::madvise(view, size, MADV_SEQUENTIAL);
+        ::madvise(view, size, MADV_WILLNEED);
+
+        m_fileDescriptor = fd;
+        m_data = static_cast<const uint8_t*>(view);
+        m_size = size;
+        return true;
+    }
+
+    void MappedFile::Close() {
+        if (m_data) {
+            ::munmap(const_cast<uint8_t*>(m_data), m_size);
+        }
+        if (m_fileDescriptor >= 0) {
+            ::close(m_fileDescriptor);
+        }
+        m_data = nullptr;
+        m_size = 0;
+        m_fileDescriptor = -1;
+    }
+#endif
+}
@@ -1,12 +1,15 @@
 #include "Resource/MeshLoader.h"
 #include "Resource/MTLLoader.h"
+#include "Resource/ParallelImport.h"
 #include "Core/Logger.h"
-#include <fstream>
-#include <sstream>
 #include <algorithm>
 #include <cctype>
+#include <cfloat>
+#include <charconv>
 #include <chrono>
+#include <cstring>
 #include <filesystem>
+#include <numeric>
 
 namespace GameEngine {
     
@@ -98,6 +101,24 @@ namespace GameEngine {
         return meshes;
     }
     
+    std::shared_ptr<Mesh> MeshLoader::CreateMeshFromData(const MeshData& meshData, const VertexFormatOptions& options) {
+        auto mesh = CreateMeshFromData(meshData);
+        if (mesh && meshData.isValid) {
+            mesh->PackVertices(options);
+            Logger::GetInstance().Log(LogLevel::Debug, "Packed mesh '" + mesh->GetName() + "' to " + 
+                                     std::to_string(mesh->GetVertexLayout().stride) + " bytes per vertex");
+        }
+        return mesh;
+    }
+    
+    std::vector<std::shared_ptr<Mesh>> MeshLoader::CreateMeshesFromResult(const OBJLoadResult& result, const VertexFormatOptions& options) {
+        std::vector<std::shared_ptr<Mesh>> meshes = CreateMeshesFromResult(result);
+        for (auto& mesh : meshes) {
+            mesh->PackVertices(options);
+        }
+        return meshes;
+    }
+    
     MeshLoader::MeshData MeshLoader::CreateDefaultCubeData() {
         MeshData cubeData;
         
@@ -173,48 +194,423 @@ namespace GameEngine {
         return mesh;
     }
     
+    struct MeshLoader::OBJChunk {
+        // Attributes defined in this chunk, in file order
+        std::vector<Math::Vec3> positions;
+        std::vector<Math::Vec3> normals;
+        std::vector<Math::Vec2> texCoords;
+        
+        // Triangulated face corners, three per triangle, with 1-based OBJ indices (0 = absent)
+        struct Corner {
+            int32_t position = 0;
+            int32_t texCoord = 0;
+            int32_t normal = 0;
+        };
+        std::vector<Corner> corners;
+        
+        // mtllib/usemtl/g/o statements, each tagged with the number of corners before it
+        enum class CommandType { MaterialLib, UseMaterial, Group, Object };
+        struct Command {
+            CommandType type;
+            std::string_view name;  // Points into the mapped file
+            size_t cornerOffset;
+        };
+        std::vector<Command> commands;
+        
+        size_t lineCount = 0;
+        size_t malformedLines = 0;
+        size_t firstMalformedLine = 0;  // 1-based within the chunk
+    };
+    
+    namespace {
+        // Files are tokenized in chunks of about this size, split at line boundaries. The
+        // split depends only on the file, so results do not depend on the thread count.
+        constexpr size_t OBJ_CHUNK_SIZE = 1 << 20;
+        
+        inline const char* SkipBlanks(const char* p, const char* end) {
+            while (p < end && (*p == ' ' || *p == '\t')) {
+                ++p;
+            }
+            return p;
+        }
+        
+        inline bool ParseFloat(const char*& p, const char* end, float& value) {
+            p = SkipBlanks(p, end);
+            if (p < end && *p == '+') {
+                ++p;
+            }
+            auto [next, error] = std::from_chars(p, end, value);
+            if (error != std::errc()) {
+                return false;
+            }
+            p = next;
+            return true;
+        }
+        
+        inline bool ParseIndex(const char*& p, const char* end, int32_t& value) {
+            auto [next, error] = std::from_chars(p, end, value);
+            if (error != std::errc()) {
+                return false;
+            }
+            p = next;
+            return true;
+        }
+        
+        inline std::string_view TrimmedView(const char* begin, const char* end) {
+            begin = SkipBlanks(begin, end);
+            while (end > begin && (end[-1] == ' ' || end[-1] == '\t')) {
+                --end;
+            }
+            return std::string_view(begin, static_cast<size_t>(end - begin));
+        }
+    }
+    
+    // "f" arguments: v, v/vt, v//vn or v/vt/vn corners, fan-triangulated as they are read
+    bool MeshLoader::TokenizeOBJFace(const char* p, const char* end, OBJChunk& chunk) {
+        using Corner = OBJChunk::Corner;
+        const size_t start = chunk.corners.size();
+        Corner first;
+        Corner previous;
+        int count = 0;
+        
+        while ((p = SkipBlanks(p, end)) < end) {
+            Corner corner;
+            bool valid = ParseIndex(p, end, corner.position);
+            if (valid && p < end && *p == '/') {
+                ++p;
+                if (p < end && *p != '/' && *p != ' ' && *p != '\t') {
+                    valid = ParseIndex(p, end, corner.texCoord);
+                }
+                if (valid && p < end && *p == '/') {
+                    ++p;
+                    if (p < end && *p != ' ' && *p != '\t') {
+                        valid = ParseIndex(p, end, corner.normal);
+                    }
+                }
+            }
+            if (!valid || (p < end && *p != ' ' && *p != '\t')) {
+                chunk.corners.resize(start);
+                return false;
+            }
+            
+            if (count == 0) {
+                first = corner;
+            } else if (count >= 2) {
+                chunk.corners.push_back(first);
+                chunk.corners.push_back(previous);
+                chunk.corners.push_back(corner);
+            }
+            previous = corner;
+            ++count;
+        }
+        
+        if (count < 3) {
+            chunk.corners.resize(start);
+            return false; // Need at least 3 vertices for a triangle
+        }
+        return true;
+    }
+    
+    // One trimmed, non-empty, non-comment line
+    bool MeshLoader::TokenizeOBJLine(const char* p, const char* end, OBJChunk& chunk) {
+        using CommandType = OBJChunk::CommandType;
+        const char* keywordEnd = p;
+        while (keywordEnd < end && *keywordEnd != ' ' && *keywordEnd != '\t') {
+            ++keywordEnd;
+        }
+        const std::string_view keyword(p, static_cast<size_t>(keywordEnd - p));
+        p = keywordEnd;
+        
+        if (keyword == "v") {
+            Math::Vec3 position;
+            if (!ParseFloat(p, end, position.x) || !ParseFloat(p, end, position.y) || !ParseFloat(p, end, position.z)) {
+                return false;
+            }
+            chunk.positions.push_back(position);
+        } else if (keyword == "vn") {
+            Math::Vec3 normal;
+            if (!ParseFloat(p, end, normal.x) || !ParseFloat(p, end, normal.y) || !ParseFloat(p, end, normal.z)) {
+                return false;
+            }
+            chunk.normals.push_back(normal);
+        } else if (keyword == "vt") {
+            Math::Vec2 texCoord;
+            if (!ParseFloat(p, end, texCoord.x) || !ParseFloat(p, end, texCoord.y)) {
+                return false;
+            }
+            // Flip V coordinate for OpenGL (OBJ uses bottom-left origin, OpenGL uses top-left)
+            texCoord.y = 1.0f - texCoord.y;
+            
+            // Clamp to valid range
+            texCoord.x = std::max(0.0f, std::min(1.0f, texCoord.x));
+            texCoord.y = std::max(0.0f, std::min(1.0f, texCoord.y));
+            chunk.texCoords.push_back(texCoord);
+        } else if (keyword == "f") {
+            return TokenizeOBJFace(p, end, chunk);
+        } else if (keyword == "mtllib") {
+            chunk.commands.push_back({CommandType::MaterialLib, TrimmedView(p, end), chunk.corners.size()});
+        } else if (keyword == "usemtl") {
+            chunk.commands.push_back({CommandType::UseMaterial, TrimmedView(p, end), chunk.corners.size()});
+        } else if (keyword == "g") {
+            chunk.commands.push_back({CommandType::Group, TrimmedView(p, end), chunk.corners.size()});
+        } else if (keyword == "o") {
+            chunk.commands.push_back({CommandType::Object, TrimmedView(p, end), chunk.corners.size()});
+        }
+        
+        return true; // Other lines (s, l, ...) are ignored but not considered errors
+    }
+    
+    void MeshLoader::TokenizeOBJChunk(const char* begin, const char* end, OBJChunk& chunk) {
+        const char* p = begin;
+        while (p < end) {
+            const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+            if (!lineEnd) {
+                lineEnd = end;
+            }
+            ++chunk.lineCount;
+            
+            const char* lineStart = SkipBlanks(p, lineEnd);
+            const char* lineStop = lineEnd;
+            while (lineStop > lineStart && (lineStop[-1] == '\r' || lineStop[-1] == ' ' || lineStop[-1] == '\t')) {
+                --lineStop;
+            }
+            
+            // Skip empty lines and comments
+            if (lineStart < lineStop && *lineStart != '#' && !TokenizeOBJLine(lineStart, lineStop, chunk)) {
+                if (chunk.malformedLines++ == 0) {
+                    chunk.firstMalformedLine = chunk.lineCount;
+                }
+            }
+            p = lineEnd + 1;
+        }
+    }
+    
+    bool MeshLoader::TokenizeOBJFile(const std::string& filepath, MappedFile& file, std::vector<OBJChunk>& chunks,
+                                     OBJParseState& state, std::string& errorMessage) {
+        std::error_code error;
+        const bool isEmpty = std::filesystem::is_regular_file(filepath, error) && std::filesystem::file_size(filepath, error) == 0;
+        if (!isEmpty && !file.Open(filepath)) {
+            errorMessage = "Could not open file: " + filepath;
+            return false;
+        }
+        
+        const char* data = reinterpret_cast<const char*>(file.GetData());
+        const size_t size = file.GetSize();
+        
+        // Split at the first line break after each chunk-size step
+        std::vector<std::pair<size_t, size_t>> ranges;
+        for (size_t begin = 0; begin < size;) {
+            size_t end = std::min(begin + OBJ_CHUNK_SIZE, size);
+            if (end < size) {
+                const void* lineBreak = std::memchr(data + end, '\n', size - end);
+                end = lineBreak ? static_cast<size_t>(static_cast<const char*>(lineBreak) - data) + 1 : size;
+            }
+            ranges.emplace_back(begin, end);
+            begin = end;
+        }
+        
+        chunks.resize(ranges.size());
+        ParallelImportFor(ranges.size(), [&](size_t i) {
+            TokenizeOBJChunk(data + ranges[i].first, data + ranges[i].second, chunks[i]);
+        });
+        
+        // Report malformed lines once, with the first one's line number in the file
+        size_t malformedLines = 0;
+        size_t firstMalformedLine = 0;
+        size_t linesBefore = 0;
+        for (const auto& chunk : chunks) {
+            if (chunk.malformedLines > 0 && malformedLines == 0) {
+                firstMalformedLine = linesBefore + chunk.firstMalformedLine;
+            }
+            malformedLines += chunk.malformedLines;
+            linesBefore += chunk.lineCount;
+        }
+        if (malformedLines > 0) {
+            Logger::GetInstance().Warning("Could not parse " + std::to_string(malformedLines) + " line(s) in file " + filepath +
+                                         " (first at line " + std::to_string(firstMalformedLine) + ")");
+        }
+        
+        // Concatenate attributes in chunk order; face indices refer to these global arrays
+        size_t positionCount = 0;
+        size_t normalCount = 0;
+        size_t texCoordCount = 0;
+        for (const auto& chunk : chunks) {
+            positionCount += chunk.positions.size();
+            normalCount += chunk.normals.size();
+            texCoordCount += chunk.texCoords.size();
+        }
+        state.positions.reserve(positionCount);
+        state.normals.reserve(normalCount);
+        state.texCoords.reserve(texCoordCount);
+        for (auto& chunk : chunks) {
+            state.positions.insert(state.positions.end(), chunk.positions.begin(), chunk.positions.end());
+            state.normals.insert(state.normals.end(), chunk.normals.begin(), chunk.normals.end());
+            state.texCoords.insert(state.texCoords.end(), chunk.texCoords.begin(), chunk.texCoords.end());
+            std::vector<Math::Vec3>().swap(chunk.positions);
+            std::vector<Math::Vec3>().swap(chunk.normals);
+            std::vector<Math::Vec2>().swap(chunk.texCoords);
+        }
+        
+        // Triangles with a position index outside the file are dropped
+        std::vector<size_t> droppedTriangles(chunks.size(), 0);
+        ParallelImportFor(chunks.size(), [&](size_t i) {
+            OBJChunk& chunk = chunks[i];
+            size_t commandIndex = 0;
+            size_t kept = 0;
+            for (size_t corner = 0; corner < chunk.corners.size(); corner += 3) {
+                while (commandIndex < chunk.commands.size() && chunk.commands[commandIndex].cornerOffset <= corner) {
+                    chunk.commands[commandIndex++].cornerOffset = kept;
+                }
+                bool valid = true;
+                for (size_t k = corner; k < corner + 3; ++k) {
+                    const int32_t position = chunk.corners[k].position;
+                    valid = valid && position > 0 && static_cast<size_t>(position) <= positionCount;
+                }
+                if (!valid) {
+                    droppedTriangles[i]++;
+                    continue;
+                }
+                if (kept != corner) {
+                    std::copy(chunk.corners.begin() + corner, chunk.corners.begin() + corner + 3, chunk.corners.begin() + kept);
+                }
+                kept += 3;
+            }
+            for (; commandIndex < chunk.commands.size(); ++commandIndex) {
+                chunk.commands[commandIndex].cornerOffset = kept;
+            }
+            chunk.corners.resize(kept);
+        });
+        
+        const size_t dropped = std::accumulate(droppedTriangles.begin(), droppedTriangles.end(), size_t(0));
+        if (dropped > 0) {
+            Logger::GetInstance().Warning("Dropped " + std::to_string(dropped) + " triangle(s) with invalid position indices in file " + filepath);
+        }
+        
+        return true;
+    }
+    
+    void MeshLoader::ResolveOBJCorners(const std::vector<OBJChunk>& chunks, OBJParseState& state) {
+        // Size every planned mesh, then let each chunk write its corners into place
+        std::vector<std::vector<std::pair<size_t, const OBJCornerRange*>>> chunkWork(chunks.size());
+        for (size_t meshIndex = 0; meshIndex < state.meshes.size(); ++meshIndex) {
+            size_t cornerCount = 0;
+            for (const auto& range : state.meshRanges[meshIndex]) {
+                chunkWork[range.chunk].emplace_back(meshIndex, &range);
+                cornerCount += range.end - range.begin;
+            }
+            state.meshes[meshIndex].vertices.resize(cornerCount);
+            state.meshes[meshIndex].indices.resize(cornerCount);
+        }
+        
+        const auto& positions = state.positions;
+        const auto& normals = state.normals;
+        const auto& texCoords = state.texCoords;
+        ParallelImportFor(chunks.size(), [&](size_t chunkIndex) {
+            const OBJChunk& chunk = chunks[chunkIndex];
+            for (const auto& [meshIndex, range] : chunkWork[chunkIndex]) {
+                MeshData& mesh = state.meshes[meshIndex];
+                for (size_t k = range->begin; k < range->end; ++k) {
+                    const OBJChunk::Corner& corner = chunk.corners[k];
+                    const size_t target = range->destination + (k - range->begin);
+                    Vertex& vertex = mesh.vertices[target];
+                    
+                    vertex.position = positions[corner.position - 1];
+                    
+                    // Texture coordinate index (optional)
+                    if (corner.texCoord > 0 && static_cast<size_t>(corner.texCoord) <= texCoords.size()) {
+                        vertex.texCoords = texCoords[corner.texCoord - 1];
+                    }
+                    
+                    // Normal index (optional); missing or zero normals default to up
+                    if (corner.normal > 0 && static_cast<size_t>(corner.normal) <= normals.size()) {
+                        vertex.normal = normals[corner.normal - 1];
+                    }
+                    if (vertex.normal.x == 0.0f && vertex.normal.y == 0.0f && vertex.normal.z == 0.0f) {
+                        vertex.normal = Math::Vec3(0.0f, 1.0f, 0.0f);
+                    }
+                    
+                    mesh.indices[target] = static_cast<uint32_t>(target);
+                }
+            }
+        });
+    }
+    
+    void MeshLoader::AddCornerRange(OBJParseState& state, uint32_t chunk, size_t begin, size_t end) {
+        if (end <= begin) {
+            return;
+        }
+        const size_t destination = state.currentRanges.empty() ? 0 :
+            state.currentRanges.back().destination + (state.currentRanges.back().end - state.currentRanges.back().begin);
+        state.currentRanges.push_back({chunk, begin, end, destination});
+        state.hasFaces = true;
+    }
+    
     MeshLoader::OBJLoadResult MeshLoader::LoadOBJWithMaterialsImpl(const std::string& filepath) {
         OBJLoadResult result;
         auto startTime = std::chrono::high_resolution_clock::now();
         
-        std::ifstream file(filepath);
-        if (!file.is_open()) {
-            result.errorMessage = "Could not open file: " + filepath;
+        MappedFile file;
+        std::vector<OBJChunk> chunks;
+        OBJParseState state;
+        if (!TokenizeOBJFile(filepath, file, chunks, state, result.errorMessage)) {
             Logger::GetInstance().Error("MeshLoader::LoadOBJWithMaterialsImpl: " + result.errorMessage);
             return result;
         }
         
         std::string basePath = GetDirectoryPath(filepath);
-        OBJParseState state;
         state.currentMesh.objectName = "default";
         state.currentMesh.groupName = "default";
         
-        std::string line;
-        int lineNumber = 0;
-        
-        while (std::getline(file, line)) {
-            lineNumber++;
-            line = TrimString(line);
-            
-            if (line.empty() || line[0] == '#') {
-                continue; // Skip empty lines and comments
-            }
-            
-            if (!ParseOBJLine(line, state, basePath)) {
-                Logger::GetInstance().Warning("Warning: Could not parse line " + std::to_string(lineNumber) + 
-                                             " in file " + filepath + ": " + line);
+        // Replay statements in file order to split the corners into meshes by group, object
+        // and material, exactly as a line-by-line pass would
+        for (uint32_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+            const OBJChunk& chunk = chunks[chunkIndex];
+            size_t cursor = 0;
+            for (const auto& command : chunk.commands) {
+                AddCornerRange(state, chunkIndex, cursor, command.cornerOffset);
+                cursor = command.cornerOffset;
+                
+                const std::string name(command.name);
+                switch (command.type) {
+                    case OBJChunk::CommandType::MaterialLib:
+                        ApplyMaterialLib(name, state, basePath);
+                        break;
+                    case OBJChunk::CommandType::UseMaterial:
+                        ApplyUseMaterial(name, state);
+                        break;
+                    case OBJChunk::CommandType::Group:
+                        ApplyGroup(name, state);
+                        break;
+                    case OBJChunk::CommandType::Object:
+                        ApplyObject(name, state);
+                        break;
+                }
             }
+            AddCornerRange(state, chunkIndex, cursor, chunk.corners.size());
         }
         
-        file.close();
-        
-        // Finalize the last mesh if it has faces
+        // Close the last mesh if it has faces
         if (state.hasFaces) {
-            FinalizeMesh(state);
+            EndCurrentMesh(state);
+        }
+        
+        ResolveOBJCorners(chunks, state);
+        chunks.clear();
+        file.Close();
+        
+        // Validate and optimize meshes independently, then keep the valid ones in order
+        std::vector<char> valid(state.meshes.size(), 0);
+        ParallelImportFor(state.meshes.size(), [&](size_t i) {
+            valid[i] = FinalizeMeshData(state.meshes[i]) ? 1 : 0;
+        });
+        for (size_t i = 0; i < state.meshes.size(); ++i) {
+            if (valid[i]) {
+                result.meshes.push_back(std::move(state.meshes[i]));
+            }
         }
         
         // Calculate statistics
-        for (const auto& meshData : state.meshes) {
+        for (const auto& meshData : result.meshes) {
             result.totalVertices += static_cast<uint32_t>(meshData.vertices.size());
             result.totalTriangles += static_cast<uint32_t>(meshData.indices.size() / 3);
         }
@@ -223,7 +619,6 @@ namespace GameEngine {
         auto endTime = std::chrono::high_resolution_clock::now();
         result.loadingTimeMs = std::chrono::duration<float, std::milli>(endTime - startTime).count();
         
-        result.meshes = std::move(state.meshes);
         result.materials = std::move(state.materials);
         result.success = !result.meshes.empty();
         
@@ -245,36 +640,26 @@ namespace GameEngine {
     MeshLoader::MeshData MeshLoader::LoadOBJImpl(const std::string& filepath) {
         MeshData meshData;
         
-        std::ifstream file(filepath);
-        if (!file.is_open()) {
+        MappedFile file;
+        std::vector<OBJChunk> chunks;
+        OBJParseState state;
+        if (!TokenizeOBJFile(filepath, file, chunks, state, meshData.errorMessage)) {
             meshData.isValid = false;
-            meshData.errorMessage = "Could not open file: " + filepath;
             Logger::GetInstance().Log(LogLevel::Error, meshData.errorMessage);
             return meshData;
         }
         
-        std::vector<Math::Vec3> positions;
-        std::vector<Math::Vec3> normals;
-        std::vector<Math::Vec2> texCoords;
-        
-        std::string line;
-        int lineNumber = 0;
-        
-        while (std::getline(file, line)) {
-            lineNumber++;
-            line = TrimString(line);
-            
-            if (line.empty() || line[0] == '#') {
-                continue; // Skip empty lines and comments
-            }
-            
-            if (!ParseOBJLine(line, meshData, positions, normals, texCoords)) {
-                Logger::GetInstance().Log(LogLevel::Warning, "Warning: Could not parse line " + std::to_string(lineNumber) + 
-                                         " in file " + filepath + ": " + line);
-            }
+        // Every face goes into one mesh; groups and materials are ignored
+        for (uint32_t chunkIndex = 0; chunkIndex < chunks.size(); ++chunkIndex) {
+            AddCornerRange(state, chunkIndex, 0, chunks[chunkIndex].corners.size());
         }
+        EndCurrentMesh(state);
+        ResolveOBJCorners(chunks, state);
+        chunks.clear();
+        file.Close();
         
-        file.close();
+        meshData.vertices = std::move(state.meshes[0].vertices);
+        meshData.indices = std::move(state.meshes[0].indices);
         
         if (meshData.vertices.empty()) {
             meshData.isValid = false;
@@ -330,213 +715,7 @@ namespace GameEngine {
         return meshData;
     }    
 
-    bool MeshLoader::ParseOBJLine(const std::string& line, MeshData& meshData,
-                                 std::vector<Math::Vec3>& positions,
-                                 std::vector<Math::Vec3>& normals,
-                                 std::vector<Math::Vec2>& texCoords) {
-        if (line.length() < 2) return false;
-        
-        if (line.substr(0, 2) == "v ") {
-            // Vertex position
-            Math::Vec3 vertex;
-            if (ParseVertex(line, vertex)) {
-                positions.push_back(vertex);
-                return true;
-            }
-        }
-        else if (line.substr(0, 3) == "vn ") {
-            // Vertex normal
-            Math::Vec3 normal;
-            if (ParseNormal(line, normal)) {
-                normals.push_back(normal);
-                return true;
-            }
-        }
-        else if (line.substr(0, 3) == "vt ") {
-            // Texture coordinate
-            Math::Vec2 texCoord;
-            if (ParseTexCoord(line, texCoord)) {
-                texCoords.push_back(texCoord);
-                return true;
-            }
-        }
-        else if (line.substr(0, 2) == "f ") {
-            // Face
-            return ParseFace(line, meshData, positions, normals, texCoords);
-        }
-        
-        return true; // Other lines are ignored but not considered errors
-    }
-    
-    bool MeshLoader::ParseVertex(const std::string& line, Math::Vec3& vertex) {
-        std::istringstream iss(line.substr(2)); // Skip "v "
-        return !!(iss >> vertex.x >> vertex.y >> vertex.z);
-    }
-    
-    bool MeshLoader::ParseNormal(const std::string& line, Math::Vec3& normal) {
-        std::istringstream iss(line.substr(3)); // Skip "vn "
-        return !!(iss >> normal.x >> normal.y >> normal.z);
-    }
-    
-    bool MeshLoader::ParseTexCoord(const std::string& line, Math::Vec2& texCoord) {
-        std::istringstream iss(line.substr(3)); // Skip "vt "
-        bool success = !!(iss >> texCoord.x >> texCoord.y);
-        
-        if (success) {
-            // Flip V coordinate for OpenGL (OBJ uses bottom-left origin, OpenGL uses top-left)
-            texCoord.y = 1.0f - texCoord.y;
-            
-            // Clamp to valid range
-            texCoord.x = std::max(0.0f, std::min(1.0f, texCoord.x));
-            texCoord.y = std::max(0.0f, std::min(1.0f, texCoord.y));
-        }
-        
-        return success;
-    }
-    
-    bool MeshLoader::ParseFace(const std::string& line, MeshData& meshData,
-                              const std::vector<Math::Vec3>& positions,
-                              const std::vector<Math::Vec3>& normals,
-                              const std::vector<Math::Vec2>& texCoords) {
-        std::string faceData = line.substr(2); // Skip "f "
-        std::vector<std::string> vertices = SplitString(faceData, ' ');
-        
-        if (vertices.size() < 3) {
-            return false; // Need at least 3 vertices for a triangle
-        }
-        
-        // Convert face to triangles (fan triangulation for polygons)
-        for (size_t i = 1; i < vertices.size() - 1; ++i) {
-            // Create triangle: vertex[0], vertex[i], vertex[i+1]
-            std::vector<std::string> triangleVertices = {vertices[0], vertices[i], vertices[i + 1]};
-            
-            for (const std::string& vertexStr : triangleVertices) {
-                Vertex vertex = {};
-                
-                // Parse vertex indices (format: v/vt/vn or v//vn or v/vt or v)
-                std::vector<std::string> indices = SplitString(vertexStr, '/');
-                
-                if (indices.empty()) continue;
-                
-                // Position index (required)
-                int posIndex = std::stoi(indices[0]) - 1; // OBJ indices are 1-based
-                if (posIndex >= 0 && posIndex < static_cast<int>(positions.size())) {
-                    vertex.position = positions[posIndex];
-                } else {
-                    return false; // Invalid position index
-                }
-                
-                // Texture coordinate index (optional)
-                if (indices.size() > 1 && !indices[1].empty()) {
-                    int texIndex = std::stoi(indices[1]) - 1;
-                    if (texIndex >= 0 && texIndex < static_cast<int>(texCoords.size())) {
-                        vertex.texCoords = texCoords[texIndex];
-                    }
-                }
-                
-                // Normal index (optional)
-                if (indices.size() > 2 && !indices[2].empty()) {
-                    int normalIndex = std::stoi(indices[2]) - 1;
-                    if (normalIndex >= 0 && normalIndex < static_cast<int>(normals.size())) {
-                        vertex.normal = normals[normalIndex];
-                    }
-                }
-                
-                // If no normal was provided, we'll calculate it later
-                if (vertex.normal.x == 0.0f && vertex.normal.y == 0.0f && vertex.normal.z == 0.0f) {
-                    vertex.normal = Math::Vec3(0.0f, 1.0f, 0.0f); // Default up normal
-                }
-                
-                meshData.vertices.push_back(vertex);
-                meshData.indices.push_back(static_cast<uint32_t>(meshData.vertices.size() - 1));
-            }
-        }
-        
-        return true;
-    }
-    
-    std::vector<std::string> MeshLoader::SplitString(const std::string& str, char delimiter) {
-        std::vector<std::string> tokens;
-        std::stringstream ss(str);
-        std::string token;
-        
-        while (std::getline(ss, token, delimiter)) {
-            token = TrimString(token);
-            if (!token.empty()) {
-                tokens.push_back(token);
-            }
-        }
-        
-        return tokens;
-    }
-    
-    std::string MeshLoader::TrimString(const std::string& str) {
-        size_t start = str.find_first_not_of(" \t\r\n");
-        if (start == std::string::npos) return "";
-        
-        size_t end = str.find_last_not_of(" \t\r\n");
-        return str.substr(start, end - start + 1);
-    }
-    
-    bool MeshLoader::ParseOBJLine(const std::string& line, OBJParseState& state, const std::string& basePath) {
-        if (line.length() < 2) return false;
-        
-        if (line.substr(0, 2) == "v ") {
-            // Vertex position
-            Math::Vec3 vertex;
-            if (ParseVertex(line, vertex)) {
-                state.positions.push_back(vertex);
-                return true;
-            }
-        }
-        else if (line.substr(0, 3) == "vn ") {
-            // Vertex normal
-            Math::Vec3 normal;
-            if (ParseNormal(line, normal)) {
-                state.normals.push_back(normal);
-                return true;
-            }
-        }
-        else if (line.substr(0, 3) == "vt ") {
-            // Texture coordinate
-            Math::Vec2 texCoord;
-            if (ParseTexCoord(line, texCoord)) {
-                state.texCoords.push_back(texCoord);
-                return true;
-            }
-        }
-        else if (line.substr(0, 2) == "f ") {
-            // Face
-            return ParseFace(line, state);
-        }
-        else if (line.substr(0, 7) == "mtllib ") {
-            // Material library
-            return ParseMaterialLib(line, state, basePath);
-        }
-        else if (line.substr(0, 7) == "usemtl ") {
-            // Use material
-            return ParseUseMaterial(line, state);
-        }
-        else if (line.substr(0, 2) == "g ") {
-            // Group
-            return ParseGroup(line, state);
-        }
-        else if (line.substr(0, 2) == "o ") {
-            // Object
-            return ParseObject(line, state);
-        }
-        else if (line.substr(0, 2) == "s ") {
-            // Smoothing group (ignored for now)
-            return true;
-        }
-        
-        return true; // Other lines are ignored but not considered errors
-    }
-    
-    bool MeshLoader::ParseMaterialLib(const std::string& line, OBJParseState& state, const std::string& basePath) {
-        std::string mtlFilename = line.substr(7); // Skip "mtllib "
-        mtlFilename = TrimString(mtlFilename);
-        
+    bool MeshLoader::ApplyMaterialLib(const std::string& mtlFilename, OBJParseState& state, const std::string& basePath) {
         std::string mtlPath = MTLLoader::FindMTLFile(basePath + "/dummy.obj", mtlFilename);
         if (mtlPath.empty()) {
             Logger::GetInstance().Warning("MTL file not found: " + mtlFilename);
@@ -565,13 +744,10 @@ namespace GameEngine {
         }
     }
     
-    bool MeshLoader::ParseUseMaterial(const std::string& line, OBJParseState& state) {
-        std::string materialName = line.substr(7); // Skip "usemtl "
-        materialName = TrimString(materialName);
-        
-        // If we're switching materials and have faces, finalize current mesh
+    void MeshLoader::ApplyUseMaterial(const std::string& materialName, OBJParseState& state) {
+        // If we're switching materials and have faces, close the current mesh
         if (state.hasFaces && state.currentMaterial != materialName) {
-            FinalizeMesh(state);
+            EndCurrentMesh(state);
             StartNewMesh(state);
         }
         
@@ -583,117 +759,42 @@ namespace GameEngine {
         if (it != state.materials.end()) {
             state.currentMesh.material = it->second;
         }
-        
-        return true;
     }
     
-    bool MeshLoader::ParseGroup(const std::string& line, OBJParseState& state) {
-        std::string groupName = line.substr(2); // Skip "g "
-        groupName = TrimString(groupName);
-        
-        if (groupName.empty()) {
-            groupName = "default";
-        }
+    void MeshLoader::ApplyGroup(const std::string& name, OBJParseState& state) {
+        const std::string groupName = name.empty() ? "default" : name;
         
-        // If we're switching groups and have faces, finalize current mesh
+        // If we're switching groups and have faces, close the current mesh
         if (state.hasFaces && state.currentGroup != groupName) {
-            FinalizeMesh(state);
+            EndCurrentMesh(state);
             StartNewMesh(state);
         }
         
         state.currentGroup = groupName;
         state.currentMesh.groupName = groupName;
-        
-        return true;
     }
     
-    bool MeshLoader::ParseObject(const std::string& line, OBJParseState& state) {
-        std::string objectName = line.substr(2); // Skip "o "
-        objectName = TrimString(objectName);
-        
-        if (objectName.empty()) {
-            objectName = "default";
-        }
+    void MeshLoader::ApplyObject(const std::string& name, OBJParseState& state) {
+        const std::string objectName = name.empty() ? "default" : name;
         
-        // If we're switching objects and have faces, finalize current mesh
+        // If we're switching objects and have faces, close the current mesh
         if (state.hasFaces && state.currentObject != objectName) {
-            FinalizeMesh(state);
+            EndCurrentMesh(state);
             StartNewMesh(state);
         }
         
         state.currentObject = objectName;
         state.currentMesh.objectName = objectName;
-        
-        return true;
-    }
-    
-    bool MeshLoader::ParseFace(const std::string& line, OBJParseState& state) {
-        std::string faceData = line.substr(2); // Skip "f "
-        std::vector<std::string> vertices = SplitString(faceData, ' ');
-        
-        if (vertices.size() < 3) {
-            return false; // Need at least 3 vertices for a triangle
-        }
-        
-        // Convert face to triangles (fan triangulation for polygons)
-        for (size_t i = 1; i < vertices.size() - 1; ++i) {
-            // Create triangle: vertex[0], vertex[i], vertex[i+1]
-            std::vector<std::string> triangleVertices = {vertices[0], vertices[i], vertices[i + 1]};
-            
-            for (const std::string& vertexStr : triangleVertices) {
-                Vertex vertex = {};
-                
-                // Parse vertex indices (format: v/vt/vn or v//vn or v/vt or v)
-                std::vector<std::string> indices = SplitString(vertexStr, '/');
-                
-                if (indices.empty()) continue;
-                
-                // Position index (required)
-                int posIndex = std::stoi(indices[0]) - 1; // OBJ indices are 1-based
-                if (posIndex >= 0 && posIndex < static_cast<int>(state.positions.size())) {
-                    vertex.position = state.positions[posIndex];
-                } else {
-                    return false; // Invalid position index
-                }
-                
-                // Texture coordinate index (optional)
-                if (indices.size() > 1 && !indices[1].empty()) {
-                    int texIndex = std::stoi(indices[1]) - 1;
-                    if (texIndex >= 0 && texIndex < static_cast<int>(state.texCoords.size())) {
-                        vertex.texCoords = state.texCoords[texIndex];
-                    }
-                }
-                
-                // Normal index (optional)
-                if (indices.size() > 2 && !indices[2].empty()) {
-                    int normalIndex = std::stoi(indices[2]) - 1;
-                    if (normalIndex >= 0 && normalIndex < static_cast<int>(state.normals.size())) {
-                        vertex.normal = state.normals[normalIndex];
-                    }
-                }
-                
-                // If no normal was provided, we'll calculate it later
-                if (vertex.normal.x == 0.0f && vertex.normal.y == 0.0f && vertex.normal.z == 0.0f) {
-                    vertex.normal = Math::Vec3(0.0f, 1.0f, 0.0f); // Default up normal
-                }
-                
-                state.currentMesh.vertices.push_back(vertex);
-                state.currentMesh.indices.push_back(static_cast<uint32_t>(state.currentMesh.vertices.size() - 1));
-            }
-        }
-        
-        state.hasFaces = true;
-        return true;
     }
     
-    void MeshLoader::FinalizeMesh(OBJParseState& state) {
-        if (state.currentMesh.vertices.empty()) {
-            return;
+    bool MeshLoader::FinalizeMeshData(MeshData& meshData) {
+        if (meshData.vertices.empty()) {
+            return false;
         }
         
         // Validate the mesh and collect any issues
         std::vector<std::string> validationErrors;
-        bool isValid = ValidateOBJMesh(state.currentMesh, validationErrors);
+        bool isValid = ValidateOBJMesh(meshData, validationErrors);
         
         // Log validation results
         if (!validationErrors.empty()) {
@@ -713,15 +814,15 @@ namespace GameEngine {
         // Only proceed if the mesh has basic validity (vertices and indices)
         if (!isValid) {
             Logger::GetInstance().Error("Mesh failed validation, skipping");
-            return;
+            return false;
         }
         
         // Optimize the mesh (removes degenerate triangles, generates normals, etc.)
-        OptimizeOBJMesh(state.currentMesh);
+        OptimizeOBJMesh(meshData);
         
         // Generate fallback UV coordinates if needed
         bool hasValidUVs = false;
-        for (const auto& vertex : state.currentMesh.vertices) {
+        for (const auto& vertex : meshData.vertices) {
             if (vertex.texCoords.x != 0.0f || vertex.texCoords.y != 0.0f) {
                 hasValidUVs = true;
                 break;
@@ -731,9 +832,9 @@ namespace GameEngine {
         if (!hasValidUVs) {
             Logger::GetInstance().Debug("Generating fallback UV coordinates");
             // Generate simple planar UV coordinates
-            if (!state.currentMesh.vertices.empty()) {
+            if (!meshData.vertices.empty()) {
                 Math::Vec3 minPos(FLT_MAX), maxPos(-FLT_MAX);
-                for (const auto& vertex : state.currentMesh.vertices) {
+                for (const auto& vertex : meshData.vertices) {
                     minPos = glm::min(minPos, vertex.position);
                     maxPos = glm::max(maxPos, vertex.position);
                 }
@@ -742,7 +843,7 @@ namespace GameEngine {
                 float maxDimension = std::max({size.x, size.y, size.z});
                 
                 if (maxDimension > 0.0f) {
-                    for (auto& vertex : state.currentMesh.vertices) {
+                    for (auto& vertex : meshData.vertices) {
                         vertex.texCoords.x = (vertex.position.x - minPos.x) / maxDimension;
                         vertex.texCoords.y = (vertex.position.z - minPos.z) / maxDimension;
                         vertex.texCoords.x = std::max(0.0f, std::min(1.0f, vertex.texCoords.x));
@@ -752,14 +853,21 @@ namespace GameEngine {
             }
         }
         
-        state.currentMesh.isValid = true;
-        state.meshes.push_back(state.currentMesh);
+        meshData.isValid = true;
         
-        Logger::GetInstance().Debug("Finalized mesh: object='" + state.currentMesh.objectName + 
-                                   "', group='" + state.currentMesh.groupName + 
-                                   "', material='" + state.currentMesh.materialName + 
-                                   "', vertices=" + std::to_string(state.currentMesh.vertices.size()) +
-                                   ", triangles=" + std::to_string(state.currentMesh.indices.size() / 3));
+        Logger::GetInstance().Debug("Finalized mesh: object='" + meshData.objectName + 
+                                   "', group='" + meshData.groupName + 
+                                   "', material='" + meshData.materialName + 
+                                   "', vertices=" + std::to_string(meshData.vertices.size()) +
+                                   ", triangles=" + std::to_string(meshData.indices.size() / 3));
+        return true;
+    }
+    
+    void MeshLoader::EndCurrentMesh(OBJParseState& state) {
+        // Vertices are filled in later by ResolveOBJCorners from the recorded corner ranges
+        state.meshes.push_back(std::move(state.currentMesh));
+        state.meshRanges.push_back(std::move(state.currentRanges));
+        state.currentRanges.clear();
     }
     
     void MeshLoader::StartNewMesh(OBJParseState& state) {
@@ -1,6 +1,9 @@
 #include "Resource/ModelCache.h"
+#include "Resource/MappedFile.h"
 #include "Graphics/Model.h"
 #include "Graphics/Mesh.h"
+#include "Graphics/VertexPacking.h"
+#include "Graphics/MeshOptimizer.h"
 #include "Graphics/Material.h"
 #include "Graphics/ModelNode.h"
 #include "Graphics/GraphicsAnimation.h"
@@ -12,9 +15,221 @@
 #include <chrono>
 #include <sstream>
 #include <iomanip>
+#include <cstring>
+#include <type_traits>
 
 namespace GameEngine {
 
+    namespace {
+        // Cache file layout (all offsets from the start of the file):
+        //   CacheFileHeader | CacheMeshRecord[meshCount] | CacheMaterialRecord[materialCount] |
+        //   string table | per mesh: vertex blob, index blob, then for meshes with meshlets
+        //   CacheMeshletRecord[meshletCount], meshlet vertex blob, meshlet triangle blob
+        //   (each BLOB_ALIGNMENT aligned)
+        constexpr uint64_t BLOB_ALIGNMENT = 64;
+        constexpr uint32_t MAX_PACKED_ATTRIBUTES = 10;     // One per VertexAttribute
+        constexpr uint8_t ATTRIBUTE_DISABLED = 0x80;       // Flag on a packed attribute's format
+
+        struct CacheStringRef {
+            uint32_t offset = 0;        // Into the string table
+            uint32_t length = 0;
+        };
+
+        struct CacheFileHeader {
+            uint32_t magic = 0;
+            uint32_t version = 0;
+            uint32_t vertexStride = 0;  // sizeof(Vertex) when written; unpacked blobs are raw Vertex arrays
+            uint32_t meshCount = 0;
+            uint32_t materialCount = 0;
+            uint32_t nodeCount = 0;
+            uint32_t totalVertices = 0;
+            uint32_t totalTriangles = 0;
+            uint64_t meshTableOffset = 0;
+            uint64_t materialTableOffset = 0;
+            uint64_t stringTableOffset = 0;
+            uint64_t stringTableSize = 0;
+            CacheStringRef name;
+            CacheStringRef formatUsed;
+        };
+
+        struct CacheMeshRecord {
+            CacheStringRef name;
+            uint32_t materialIndex = 0;
+            uint32_t primitiveType = 0;
+            uint32_t vertexCount = 0;
+            uint32_t indexCount = 0;
+            uint64_t vertexOffset = 0;
+            uint64_t indexOffset = 0;
+            // Packed vertex blob: bytes per vertex and its attributes in layout order;
+            // packedAttributeCount is 0 for raw Vertex arrays
+            uint32_t vertexStride = 0;
+            uint32_t packedAttributeCount = 0;
+            uint8_t attributeTypes[MAX_PACKED_ATTRIBUTES] = {};
+            uint8_t attributeFormats[MAX_PACKED_ATTRIBUTES] = {};
+            // Meshlets; meshletCount is 0 when the mesh has none
+            uint32_t meshletCount = 0;
+            uint32_t meshletVertexCount = 0;
+            uint32_t meshletTriangleBytes = 0;
+            uint16_t meshletMaxVertices = 0;
+            uint16_t meshletMaxTriangles = 0;
+            uint64_t meshletOffset = 0;
+            uint64_t meshletVertexOffset = 0;
+            uint64_t meshletTriangleOffset = 0;
+        };
+
+        struct CacheMeshletRecord {
+            uint32_t vertexOffset = 0;
+            uint32_t triangleOffset = 0;
+            uint32_t vertexCount = 0;
+            uint32_t triangleCount = 0;
+            float center[3] = {0.0f, 0.0f, 0.0f};
+            float radius = 0.0f;
+            float coneApex[3] = {0.0f, 0.0f, 0.0f};
+            float coneAxis[3] = {0.0f, 0.0f, 1.0f};
+            float coneCutoff = 1.0f;
+        };
+
+        struct CacheMaterialRecord {
+            CacheStringRef name;
+            float albedo[3] = {0.0f, 0.0f, 0.0f};
+            float metallic = 0.0f;
+            float roughness = 0.0f;
+            uint32_t reserved = 0;
+        };
+
+        static_assert(std::is_trivially_copyable_v<Vertex>, "Vertex blobs are copied as raw bytes");
+
+        uint64_t AlignOffset(uint64_t offset, uint64_t alignment) {
+            return (offset + alignment - 1) & ~(alignment - 1);
+        }
+
+        CacheStringRef AddString(std::string& table, const std::string& str) {
+            CacheStringRef ref;
+            ref.offset = static_cast<uint32_t>(table.size());
+            ref.length = static_cast<uint32_t>(str.size());
+            table += str;
+            return ref;
+        }
+
+        bool ReadTableString(const char* table, uint64_t tableSize, const CacheStringRef& ref, std::string& out) {
+            if (static_cast<uint64_t>(ref.offset) + ref.length > tableSize) {
+                return false;
+            }
+            out.assign(table + ref.offset, ref.length);
+            return true;
+        }
+
+        void WritePadding(std::ofstream& file, uint64_t& position, uint64_t target) {
+            static const char zeros[BLOB_ALIGNMENT] = {};
+            while (position < target) {
+                const uint64_t count = std::min<uint64_t>(target - position, BLOB_ALIGNMENT);
+                file.write(zeros, static_cast<std::streamsize>(count));
+                position += count;
+            }
+        }
+
+        void WriteBytes(std::ofstream& file, uint64_t& position, const void* data, uint64_t size) {
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            position += size;
+        }
+
+        void WritePackedLayout(CacheMeshRecord& record, const VertexLayout& layout) {
+            record.vertexStride = layout.stride;
+            record.packedAttributeCount = static_cast<uint32_t>(std::min<size_t>(layout.attributes.size(), MAX_PACKED_ATTRIBUTES));
+            for (uint32_t i = 0; i < record.packedAttributeCount; ++i) {
+                const auto& attr = layout.attributes[i];
+                record.attributeTypes[i] = static_cast<uint8_t>(attr.type);
+                record.attributeFormats[i] = static_cast<uint8_t>(attr.format) | (attr.enabled ? 0 : ATTRIBUTE_DISABLED);
+            }
+        }
+
+        std::vector<CacheMeshletRecord> WriteMeshlets(CacheMeshRecord& record, const MeshletData& meshlets) {
+            record.meshletCount = static_cast<uint32_t>(meshlets.meshlets.size());
+            record.meshletVertexCount = static_cast<uint32_t>(meshlets.vertices.size());
+            record.meshletTriangleBytes = static_cast<uint32_t>(meshlets.triangles.size());
+            record.meshletMaxVertices = static_cast<uint16_t>(meshlets.maxVertices);
+            record.meshletMaxTriangles = static_cast<uint16_t>(std::min<uint32_t>(meshlets.maxTriangles, 0xFFFFu));
+
+            std::vector<CacheMeshletRecord> records(meshlets.meshlets.size());
+            for (size_t i = 0; i < records.size(); ++i) {
+                const Meshlet& meshlet = meshlets.meshlets[i];
+                records[i].vertexOffset = meshlet.vertexOffset;
+                records[i].triangleOffset = meshlet.triangleOffset;
+                records[i].vertexCount = meshlet.vertexCount;
+                records[i].triangleCount = meshlet.triangleCount;
+                for (int c = 0; c < 3; ++c) {
+                    records[i].center[c] = meshlet.bounds.center[c];
+                    records[i].coneApex[c] = meshlet.coneApex[c];
+                    records[i].coneAxis[c] = meshlet.coneAxis[c];
+                }
+                records[i].radius = meshlet.bounds.radius;
+                records[i].coneCutoff = meshlet.coneCutoff;
+            }
+            return records;
+        }
+
+        // Every meshlet must stay inside the shared arrays and reference vertices of the mesh
+        bool ReadMeshlets(const CacheMeshRecord& record, const CacheMeshletRecord* records, const uint32_t* vertices,
+                          const uint8_t* triangles, MeshletData& meshlets) {
+            meshlets.maxVertices = record.meshletMaxVertices;
+            meshlets.maxTriangles = record.meshletMaxTriangles;
+            meshlets.vertices.assign(vertices, vertices + record.meshletVertexCount);
+            meshlets.triangles.assign(triangles, triangles + record.meshletTriangleBytes);
+            for (uint32_t vertex : meshlets.vertices) {
+                if (vertex >= record.vertexCount) {
+                    return false;
+                }
+            }
+
+            meshlets.meshlets.resize(record.meshletCount);
+            for (uint32_t i = 0; i < record.meshletCount; ++i) {
+                const CacheMeshletRecord& source = records[i];
+                if (static_cast<uint64_t>(source.vertexOffset) + source.vertexCount > record.meshletVertexCount ||
+                    static_cast<uint64_t>(source.triangleOffset) + static_cast<uint64_t>(source.triangleCount) * 3 > record.meshletTriangleBytes) {
+                    return false;
+                }
+                for (uint32_t j = 0; j < source.triangleCount * 3; ++j) {
+                    if (triangles[source.triangleOffset + j] >= source.vertexCount) {
+                        return false;
+                    }
+                }
+
+                Meshlet& meshlet = meshlets.meshlets[i];
+                meshlet.vertexOffset = source.vertexOffset;
+                meshlet.triangleOffset = source.triangleOffset;
+                meshlet.vertexCount = source.vertexCount;
+                meshlet.triangleCount = source.triangleCount;
+                meshlet.bounds = BoundingSphere(Math::Vec3(source.center[0], source.center[1], source.center[2]), source.radius);
+                meshlet.coneApex = Math::Vec3(source.coneApex[0], source.coneApex[1], source.coneApex[2]);
+                meshlet.coneAxis = Math::Vec3(source.coneAxis[0], source.coneAxis[1], source.coneAxis[2]);
+                meshlet.coneCutoff = source.coneCutoff;
+            }
+            return true;
+        }
+
+        bool ReadPackedLayout(const CacheMeshRecord& record, VertexLayout& layout) {
+            if (record.packedAttributeCount == 0 || record.packedAttributeCount > MAX_PACKED_ATTRIBUTES) {
+                return false;
+            }
+            layout.attributes.clear();
+            layout.packed = true;
+            for (uint32_t i = 0; i < record.packedAttributeCount; ++i) {
+                const uint8_t format = record.attributeFormats[i] & ~ATTRIBUTE_DISABLED;
+                if (record.attributeTypes[i] >= MAX_PACKED_ATTRIBUTES ||
+                    format > static_cast<uint8_t>(VertexFormat::UInt8)) {
+                    return false;
+                }
+                const auto type = static_cast<VertexAttribute>(record.attributeTypes[i]);
+                layout.AddAttribute(type, static_cast<VertexFormat>(format));
+                if (record.attributeFormats[i] & ATTRIBUTE_DISABLED) {
+                    layout.DisableAttribute(type);
+                }
+            }
+            // Packed layouts keep space for disabled attributes, so the stride is unchanged
+            return layout.stride == record.vertexStride;
+        }
+    }
+
     std::unique_ptr<ModelCache> GlobalModelCache::s_instance = nullptr;
 
     ModelCache& GlobalModelCache::GetInstance() {
@@ -110,32 +325,14 @@ namespace GameEngine {
         const auto& entry = m_cacheIndex[cacheKey];
 
         try {
-            std::ifstream file(entry.cachePath, std::ios::binary);
-            if (!file.is_open()) {
+            MappedFile file;
+            if (!file.Open(entry.cachePath)) {
                 LOG_ERROR("Failed to open cache file: " + entry.cachePath);
                 m_stats.cacheMisses++;
                 return nullptr;
             }
 
-            // Verify magic number and version
-            uint32_t magic, version;
-            file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
-            file.read(reinterpret_cast<char*>(&version), sizeof(version));
-
-            if (magic != CACHE_MAGIC) {
-                LOG_ERROR("Invalid cache file magic number: " + entry.cachePath);
-                m_stats.cacheMisses++;
-                return nullptr;
-            }
-
-            if (version != CACHE_VERSION) {
-                LOG_WARNING("Cache file version mismatch (expected " + std::to_string(CACHE_VERSION) + 
-                           ", got " + std::to_string(version) + "): " + entry.cachePath);
-                m_stats.cacheMisses++;
-                return nullptr;
-            }
-
-            // Deserialize model
+            // Deserialize model (validates magic number, version and layout)
             auto model = DeserializeModel(file, modelPath);
             if (!model) {
                 LOG_ERROR("Failed to deserialize model from cache: " + entry.cachePath);
@@ -176,13 +373,7 @@ namespace GameEngine {
                 return false;
             }
 
-            // Write magic number and version
-            uint32_t magic = CACHE_MAGIC;
-            uint32_t version = CACHE_VERSION;
-            file.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
-            file.write(reinterpret_cast<const char*>(&version), sizeof(version));
-
-            // Serialize model
+            // Serialize model (header with magic number and version first)
             if (!SerializeModel(model, file)) {
                 LOG_ERROR("Failed to serialize model to cache: " + cachePath);
                 file.close();
@@ -352,6 +543,14 @@ namespace GameEngine {
         // For now, this is just a configuration flag
     }
 
+    void ModelCache::SetCompactVertices(bool enabled) {
+        m_compactVertices = enabled;
+    }
+
+    void ModelCache::SetBuildMeshlets(bool enabled) {
+        m_buildMeshlets = enabled;
+    }
+
     ModelCache::CacheStats ModelCache::GetStats() const {
         m_stats.totalEntries = static_cast<uint32_t>(m_cacheIndex.size());
         m_stats.validEntries = 0;
@@ -545,9 +744,11 @@ namespace GameEngine {
             return false;
         }
 
-        // Check if original file has been modified
+        // Check if original file has been modified; the index stores whole seconds, so compare at that
+        // resolution or every entry read back from disk looks stale
         auto currentModTime = GetFileModificationTime(entry.originalPath);
-        if (currentModTime > entry.originalModTime) {
+        if (std::chrono::floor<std::chrono::seconds>(currentModTime) >
+            std::chrono::floor<std::chrono::seconds>(entry.originalModTime)) {
             return false;
         }
 
@@ -575,56 +776,153 @@ namespace GameEngine {
         return entry;
     }
 
-    // Serialization methods would be implemented here
-    // For brevity, I'll implement key methods and leave others as stubs
-
     bool ModelCache::SerializeModel(std::shared_ptr<Model> model, std::ofstream& file) {
         if (!model) {
             return false;
         }
 
         try {
-            // Write model metadata
-            WriteString(file, model->GetName());
-            WriteString(file, model->GetPath());
-            
-            // Write model stats
             auto stats = model->GetStats();
-            file.write(reinterpret_cast<const char*>(&stats.nodeCount), sizeof(stats.nodeCount));
-            file.write(reinterpret_cast<const char*>(&stats.meshCount), sizeof(stats.meshCount));
-            file.write(reinterpret_cast<const char*>(&stats.materialCount), sizeof(stats.materialCount));
-            file.write(reinterpret_cast<const char*>(&stats.totalVertices), sizeof(stats.totalVertices));
-            file.write(reinterpret_cast<const char*>(&stats.totalTriangles), sizeof(stats.totalTriangles));
-            WriteString(file, stats.formatUsed);
-
-            // Write meshes
             auto meshes = model->GetMeshes();
-            uint32_t meshCount = static_cast<uint32_t>(meshes.size());
-            file.write(reinterpret_cast<const char*>(&meshCount), sizeof(meshCount));
-            
+            auto materials = model->GetMaterials();
+
             for (const auto& mesh : meshes) {
-                if (!SerializeMesh(mesh, file)) {
+                if (!mesh) {
                     return false;
                 }
             }
-
-            // Write materials
-            auto materials = model->GetMaterials();
-            uint32_t materialCount = static_cast<uint32_t>(materials.size());
-            file.write(reinterpret_cast<const char*>(&materialCount), sizeof(materialCount));
-            
             for (const auto& material : materials) {
-                if (!SerializeMaterial(material, file)) {
+                if (!material) {
                     return false;
                 }
             }
 
+            // Build the tables first so every offset is known before writing
+            std::string stringTable;
+            CacheFileHeader header;
+            header.magic = CACHE_MAGIC;
+            header.version = CACHE_VERSION;
+            header.vertexStride = static_cast<uint32_t>(sizeof(Vertex));
+            header.meshCount = static_cast<uint32_t>(meshes.size());
+            header.materialCount = static_cast<uint32_t>(materials.size());
+            header.nodeCount = stats.nodeCount;
+            header.totalVertices = stats.totalVertices;
+            header.totalTriangles = stats.totalTriangles;
+            header.name = AddString(stringTable, model->GetName());
+            header.formatUsed = AddString(stringTable, stats.formatUsed);
+
+            // Vertex blob per mesh: its packed bytes, bytes packed here when compact vertices are
+            // enabled, or the raw Vertex array
+            std::vector<CacheMeshRecord> meshRecords(meshes.size());
+            std::vector<std::vector<uint8_t>> packedForWrite(meshes.size());
+            // Meshlets per mesh: its own, or built here when enabled
+            std::vector<MeshletData> builtMeshlets(meshes.size());
+            std::vector<const MeshletData*> meshletSources(meshes.size(), nullptr);
+            std::vector<std::vector<CacheMeshletRecord>> meshletRecords(meshes.size());
+            for (size_t i = 0; i < meshes.size(); ++i) {
+                const auto& mesh = meshes[i];
+                meshRecords[i].name = AddString(stringTable, mesh->GetName());
+                meshRecords[i].materialIndex = mesh->GetMaterialIndex();
+                meshRecords[i].primitiveType = static_cast<uint32_t>(mesh->GetPrimitiveType());
+                meshRecords[i].vertexCount = mesh->GetVertexCount();
+                meshRecords[i].indexCount = static_cast<uint32_t>(mesh->GetIndices().size());
+                meshRecords[i].vertexStride = static_cast<uint32_t>(sizeof(Vertex));
+
+                if (mesh->IsPacked()) {
+                    WritePackedLayout(meshRecords[i], mesh->GetVertexLayout());
+                } else if (m_compactVertices && mesh->GetVertexCount() > 0) {
+                    const auto& vertices = mesh->GetVertices();
+                    const VertexLayout layout = VertexPacking::CreateLayout(vertices.data(), vertices.size());
+                    packedForWrite[i].resize(vertices.size() * layout.stride);
+                    VertexPacking::Pack(vertices.data(), vertices.size(), layout, packedForWrite[i].data());
+                    WritePackedLayout(meshRecords[i], layout);
+                }
+
+                const MeshletData* meshlets = &mesh->GetMeshlets();
+                if (meshlets->IsEmpty() && m_buildMeshlets && mesh->GetPrimitiveType() == Mesh::PrimitiveType::Triangles) {
+                    builtMeshlets[i] = MeshOptimizer::BuildMeshlets(mesh->DecodeVertices(), mesh->GetIndices());
+                    meshlets = &builtMeshlets[i];
+                }
+                if (!meshlets->IsEmpty()) {
+                    meshletRecords[i] = WriteMeshlets(meshRecords[i], *meshlets);
+                    meshletSources[i] = meshlets;
+                }
+            }
+
+            std::vector<CacheMaterialRecord> materialRecords(materials.size());
+            for (size_t i = 0; i < materials.size(); ++i) {
+                const auto& material = materials[i];
+                const Math::Vec3 albedo = material->GetAlbedo();
+                materialRecords[i].name = AddString(stringTable, material->GetName());
+                materialRecords[i].albedo[0] = albedo.x;
+                materialRecords[i].albedo[1] = albedo.y;
+                materialRecords[i].albedo[2] = albedo.z;
+                materialRecords[i].metallic = material->GetMetallic();
+                materialRecords[i].roughness = material->GetRoughness();
+            }
+
+            header.meshTableOffset = AlignOffset(sizeof(CacheFileHeader), alignof(CacheMeshRecord));
+            header.materialTableOffset = AlignOffset(header.meshTableOffset + meshRecords.size() * sizeof(CacheMeshRecord),
+                                                     alignof(CacheMaterialRecord));
+            header.stringTableOffset = header.materialTableOffset + materialRecords.size() * sizeof(CacheMaterialRecord);
+            header.stringTableSize = stringTable.size();
+
+            uint64_t blobOffset = header.stringTableOffset + header.stringTableSize;
+            for (auto& record : meshRecords) {
+                record.vertexOffset = AlignOffset(blobOffset, BLOB_ALIGNMENT);
+                blobOffset = record.vertexOffset + static_cast<uint64_t>(record.vertexCount) * record.vertexStride;
+                record.indexOffset = AlignOffset(blobOffset, BLOB_ALIGNMENT);
+                blobOffset = record.indexOffset + static_cast<uint64_t>(record.indexCount) * sizeof(uint32_t);
+                if (record.meshletCount > 0) {
+                    record.meshletOffset = AlignOffset(blobOffset, BLOB_ALIGNMENT);
+                    blobOffset = record.meshletOffset + static_cast<uint64_t>(record.meshletCount) * sizeof(CacheMeshletRecord);
+                    record.meshletVertexOffset = AlignOffset(blobOffset, BLOB_ALIGNMENT);
+                    blobOffset = record.meshletVertexOffset + static_cast<uint64_t>(record.meshletVertexCount) * sizeof(uint32_t);
+                    record.meshletTriangleOffset = AlignOffset(blobOffset, BLOB_ALIGNMENT);
+                    blobOffset = record.meshletTriangleOffset + record.meshletTriangleBytes;
+                }
+            }
+
+            uint64_t position = 0;
+            WriteBytes(file, position, &header, sizeof(header));
+            WritePadding(file, position, header.meshTableOffset);
+            WriteBytes(file, position, meshRecords.data(), meshRecords.size() * sizeof(CacheMeshRecord));
+            WritePadding(file, position, header.materialTableOffset);
+            WriteBytes(file, position, materialRecords.data(), materialRecords.size() * sizeof(CacheMaterialRecord));
+            WriteBytes(file, position, stringTable.data(), stringTable.size());
+
+            for (size_t i = 0; i < meshes.size(); ++i) {
+                const auto& mesh = meshes[i];
+                const auto& indices = mesh->GetIndices();
+                WritePadding(file, position, meshRecords[i].vertexOffset);
+                if (mesh->IsPacked()) {
+                    const auto& packed = mesh->GetPackedVertexData();
+                    WriteBytes(file, position, packed.data(), packed.size());
+                } else if (meshRecords[i].packedAttributeCount > 0) {
+                    WriteBytes(file, position, packedForWrite[i].data(), packedForWrite[i].size());
+                } else {
+                    const auto& vertices = mesh->GetVertices();
+                    WriteBytes(file, position, vertices.data(), vertices.size() * sizeof(Vertex));
+                }
+                WritePadding(file, position, meshRecords[i].indexOffset);
+                WriteBytes(file, position, indices.data(), indices.size() * sizeof(uint32_t));
+                if (meshRecords[i].meshletCount > 0) {
+                    const MeshletData& meshlets = *meshletSources[i];
+                    WritePadding(file, position, meshRecords[i].meshletOffset);
+                    WriteBytes(file, position, meshletRecords[i].data(), meshletRecords[i].size() * sizeof(CacheMeshletRecord));
+                    WritePadding(file, position, meshRecords[i].meshletVertexOffset);
+                    WriteBytes(file, position, meshlets.vertices.data(), meshlets.vertices.size() * sizeof(uint32_t));
+                    WritePadding(file, position, meshRecords[i].meshletTriangleOffset);
+                    WriteBytes(file, position, meshlets.triangles.data(), meshlets.triangles.size());
+                }
+            }
+
             // Write root node
             if (!SerializeModelNode(model->GetRootNode(), file)) {
                 return false;
             }
 
-            return true;
+            return file.good();
 
         } catch (const std::exception& e) {
             LOG_ERROR("Exception during model serialization: " + std::string(e.what()));
@@ -632,62 +930,129 @@ namespace GameEngine {
         }
     }
 
-    std::shared_ptr<Model> ModelCache::DeserializeModel(std::ifstream& file, const std::string& originalPath) {
+    std::shared_ptr<Model> ModelCache::DeserializeModel(const MappedFile& file, const std::string& originalPath) {
         try {
+            const uint8_t* headerData = file.GetRange(0, sizeof(CacheFileHeader));
+            if (!headerData) {
+                LOG_ERROR("Cache file too small: " + originalPath);
+                return nullptr;
+            }
+
+            CacheFileHeader header;
+            std::memcpy(&header, headerData, sizeof(header));
+
+            if (header.magic != CACHE_MAGIC) {
+                LOG_ERROR("Invalid cache file magic number for: " + originalPath);
+                return nullptr;
+            }
+
+            if (header.version != CACHE_VERSION) {
+                LOG_WARNING("Cache file version mismatch (expected " + std::to_string(CACHE_VERSION) +
+                           ", got " + std::to_string(header.version) + ") for: " + originalPath);
+                return nullptr;
+            }
+
+            if (header.vertexStride != sizeof(Vertex)) {
+                LOG_WARNING("Cache file vertex layout differs from this build for: " + originalPath);
+                return nullptr;
+            }
+
+            // Tables are read in place; the writer aligned them for their record types
+            const uint8_t* meshTable = file.GetRange(header.meshTableOffset,
+                                                     static_cast<uint64_t>(header.meshCount) * sizeof(CacheMeshRecord));
+            const uint8_t* materialTable = file.GetRange(header.materialTableOffset,
+                                                         static_cast<uint64_t>(header.materialCount) * sizeof(CacheMaterialRecord));
+            const uint8_t* stringTableData = file.GetRange(header.stringTableOffset, header.stringTableSize);
+            if (!meshTable || !materialTable || !stringTableData ||
+                header.meshTableOffset % alignof(CacheMeshRecord) != 0 ||
+                header.materialTableOffset % alignof(CacheMaterialRecord) != 0) {
+                LOG_ERROR("Corrupt cache file tables for: " + originalPath);
+                return nullptr;
+            }
+
+            const auto* meshRecords = reinterpret_cast<const CacheMeshRecord*>(meshTable);
+            const auto* materialRecords = reinterpret_cast<const CacheMaterialRecord*>(materialTable);
+            const char* stringTable = reinterpret_cast<const char*>(stringTableData);
+
             auto model = std::make_shared<Model>(originalPath);
 
-            // Read model metadata
-            std::string name = ReadString(file);
-            std::string path = ReadString(file);
+            std::string name;
+            if (!ReadTableString(stringTable, header.stringTableSize, header.name, name)) {
+                return nullptr;
+            }
             model->SetName(name);
 
-            // Read model stats (for validation)
-            uint32_t nodeCount, meshCount, materialCount, totalVertices, totalTriangles;
-            file.read(reinterpret_cast<char*>(&nodeCount), sizeof(nodeCount));
-            file.read(reinterpret_cast<char*>(&meshCount), sizeof(meshCount));
-            file.read(reinterpret_cast<char*>(&materialCount), sizeof(materialCount));
-            file.read(reinterpret_cast<char*>(&totalVertices), sizeof(totalVertices));
-            file.read(reinterpret_cast<char*>(&totalTriangles), sizeof(totalTriangles));
-            std::string formatUsed = ReadString(file);
-
-            // Read meshes
-            uint32_t meshCountFromFile;
-            file.read(reinterpret_cast<char*>(&meshCountFromFile), sizeof(meshCountFromFile));
-            
             std::vector<std::shared_ptr<Mesh>> meshes;
-            meshes.reserve(meshCountFromFile);
-            
-            for (uint32_t i = 0; i < meshCountFromFile; ++i) {
-                auto mesh = DeserializeMesh(file);
-                if (!mesh) {
+            meshes.reserve(header.meshCount);
+
+            for (uint32_t i = 0; i < header.meshCount; ++i) {
+                const CacheMeshRecord& record = meshRecords[i];
+
+                std::string meshName;
+                VertexLayout packedLayout;
+                const bool packed = record.packedAttributeCount > 0;
+                const bool layoutValid = packed ? ReadPackedLayout(record, packedLayout) : record.vertexStride == sizeof(Vertex);
+                const uint8_t* vertexData = file.GetRange(record.vertexOffset, static_cast<uint64_t>(record.vertexCount) * record.vertexStride);
+                const uint8_t* indexData = file.GetRange(record.indexOffset, static_cast<uint64_t>(record.indexCount) * sizeof(uint32_t));
+                if (!ReadTableString(stringTable, header.stringTableSize, record.name, meshName) || !layoutValid || !vertexData || !indexData ||
+                    record.vertexOffset % alignof(Vertex) != 0 || record.indexOffset % alignof(uint32_t) != 0) {
+                    LOG_ERROR("Corrupt mesh record " + std::to_string(i) + " in cache file for: " + originalPath);
                     return nullptr;
                 }
+
+                // One bulk copy per blob straight out of the mapping
+                auto mesh = std::make_shared<Mesh>(meshName);
+                mesh->SetName(meshName);
+                mesh->SetMaterialIndex(record.materialIndex);
+                mesh->SetPrimitiveType(static_cast<Mesh::PrimitiveType>(record.primitiveType));
+                if (packed) {
+                    mesh->SetPackedVertices(vertexData, record.vertexCount, packedLayout);
+                } else {
+                    mesh->SetVertices(reinterpret_cast<const Vertex*>(vertexData), record.vertexCount);
+                }
+                mesh->SetIndices(reinterpret_cast<const uint32_t*>(indexData), record.indexCount);
+
+                if (record.meshletCount > 0) {
+                    const uint8_t* meshletData = file.GetRange(record.meshletOffset,
+                                                               static_cast<uint64_t>(record.meshletCount) * sizeof(CacheMeshletRecord));
+                    const uint8_t* meshletVertexData = file.GetRange(record.meshletVertexOffset,
+                                                                     static_cast<uint64_t>(record.meshletVertexCount) * sizeof(uint32_t));
+                    const uint8_t* meshletTriangleData = file.GetRange(record.meshletTriangleOffset, record.meshletTriangleBytes);
+                    MeshletData meshlets;
+                    if (!meshletData || !meshletVertexData || !meshletTriangleData ||
+                        record.meshletOffset % alignof(CacheMeshletRecord) != 0 || record.meshletVertexOffset % alignof(uint32_t) != 0 ||
+                        !ReadMeshlets(record, reinterpret_cast<const CacheMeshletRecord*>(meshletData),
+                                      reinterpret_cast<const uint32_t*>(meshletVertexData), meshletTriangleData, meshlets)) {
+                        LOG_ERROR("Corrupt meshlets for mesh record " + std::to_string(i) + " in cache file for: " + originalPath);
+                        return nullptr;
+                    }
+                    mesh->SetMeshlets(std::move(meshlets));
+                }
                 meshes.push_back(mesh);
             }
             model->SetMeshes(meshes);
 
-            // Read materials
-            uint32_t materialCountFromFile;
-            file.read(reinterpret_cast<char*>(&materialCountFromFile), sizeof(materialCountFromFile));
-            
             std::vector<std::shared_ptr<Material>> materials;
-            materials.reserve(materialCountFromFile);
-            
-            for (uint32_t i = 0; i < materialCountFromFile; ++i) {
-                auto material = DeserializeMaterial(file);
-                if (!material) {
+            materials.reserve(header.materialCount);
+
+            for (uint32_t i = 0; i < header.materialCount; ++i) {
+                const CacheMaterialRecord& record = materialRecords[i];
+
+                std::string materialName;
+                if (!ReadTableString(stringTable, header.stringTableSize, record.name, materialName)) {
                     return nullptr;
                 }
+
+                auto material = std::make_shared<Material>();
+                material->SetName(materialName);
+                material->SetAlbedo(Math::Vec3(record.albedo[0], record.albedo[1], record.albedo[2]));
+                material->SetMetallic(record.metallic);
+                material->SetRoughness(record.roughness);
                 materials.push_back(material);
             }
             model->SetMaterials(materials);
 
             // Read root node (placeholder - would need ModelNode serialization)
-            // For now, create a simple root node
-            // auto rootNode = DeserializeModelNode(file);
-            // if (!rootNode) {
-            //     return nullptr;
-            // }
 
             return model;
 
@@ -697,98 +1062,6 @@ namespace GameEngine {
         }
     }
 
-    // Stub implementations for component serialization
-    bool ModelCache::SerializeMesh(std::shared_ptr<Mesh> mesh, std::ofstream& file) {
-        if (!mesh) {
-            return false;
-        }
-
-        // Write mesh name
-        WriteString(file, mesh->GetName());
-
-        // Write vertex data
-        auto vertices = mesh->GetVertices();
-        uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
-        file.write(reinterpret_cast<const char*>(&vertexCount), sizeof(vertexCount));
-        file.write(reinterpret_cast<const char*>(vertices.data()), vertexCount * sizeof(Vertex));
-
-        // Write index data
-        auto indices = mesh->GetIndices();
-        uint32_t indexCount = static_cast<uint32_t>(indices.size());
-        file.write(reinterpret_cast<const char*>(&indexCount), sizeof(indexCount));
-        file.write(reinterpret_cast<const char*>(indices.data()), indexCount * sizeof(uint32_t));
-
-        return true;
-    }
-
-    std::shared_ptr<Mesh> ModelCache::DeserializeMesh(std::ifstream& file) {
-        try {
-            // Read mesh name
-            std::string name = ReadString(file);
-            auto mesh = std::make_shared<Mesh>(name);
-
-            // Read vertex data
-            uint32_t vertexCount;
-            file.read(reinterpret_cast<char*>(&vertexCount), sizeof(vertexCount));
-            
-            std::vector<Vertex> vertices(vertexCount);
-            file.read(reinterpret_cast<char*>(vertices.data()), vertexCount * sizeof(Vertex));
-            mesh->SetVertices(vertices);
-
-            // Read index data
-            uint32_t indexCount;
-            file.read(reinterpret_cast<char*>(&indexCount), sizeof(indexCount));
-            
-            std::vector<uint32_t> indices(indexCount);
-            file.read(reinterpret_cast<char*>(indices.data()), indexCount * sizeof(uint32_t));
-            mesh->SetIndices(indices);
-
-            return mesh;
-
-        } catch (const std::exception& e) {
-            LOG_ERROR("Exception during mesh deserialization: " + std::string(e.what()));
-            return nullptr;
-        }
-    }
-
-    bool ModelCache::SerializeMaterial(std::shared_ptr<Material> material, std::ofstream& file) {
-        // Placeholder implementation
-        if (!material) {
-            return false;
-        }
-
-        // Write basic material properties
-        WriteVector3(file, material->GetAlbedo());
-        float metallic = material->GetMetallic();
-        float roughness = material->GetRoughness();
-        file.write(reinterpret_cast<const char*>(&metallic), sizeof(float));
-        file.write(reinterpret_cast<const char*>(&roughness), sizeof(float));
-
-        return true;
-    }
-
-    std::shared_ptr<Material> ModelCache::DeserializeMaterial(std::ifstream& file) {
-        try {
-            auto material = std::make_shared<Material>();
-
-            // Read basic material properties
-            Math::Vec3 albedo = ReadVector3(file);
-            material->SetAlbedo(albedo);
-
-            float metallic, roughness;
-            file.read(reinterpret_cast<char*>(&metallic), sizeof(float));
-            file.read(reinterpret_cast<char*>(&roughness), sizeof(float));
-            material->SetMetallic(metallic);
-            material->SetRoughness(roughness);
-
-            return material;
-
-        } catch (const std::exception& e) {
-            LOG_ERROR("Exception during material deserialization: " + std::string(e.what()));
-            return nullptr;
-        }
-    }
-
     // Stub implementations for other components
     bool ModelCache::SerializeModelNode(std::shared_ptr<ModelNode> node, std::ofstream& file) {
         // Placeholder - would implement full node hierarchy serialization
@@ -836,58 +1109,6 @@ namespace GameEngine {
         return str;
     }
 
-    void ModelCache::WriteVector3(std::ofstream& file, const Math::Vec3& vec) {
-        file.write(reinterpret_cast<const char*>(&vec.x), sizeof(float));
-        file.write(reinterpret_cast<const char*>(&vec.y), sizeof(float));
-        file.write(reinterpret_cast<const char*>(&vec.z), sizeof(float));
-    }
-
-    Math::Vec3 ModelCache::ReadVector3(std::ifstream& file) {
-        Math::Vec3 vec;
-        file.read(reinterpret_cast<char*>(&vec.x), sizeof(float));
-        file.read(reinterpret_cast<char*>(&vec.y), sizeof(float));
-        file.read(reinterpret_cast<char*>(&vec.z), sizeof(float));
-        return vec;
-    }
-
-    void ModelCache::WriteVector2(std::ofstream& file, const Math::Vec2& vec) {
-        file.write(reinterpret_cast<const char*>(&vec.x), sizeof(float));
-        file.write(reinterpret_cast<const char*>(&vec.y), sizeof(float));
-    }
-
-    Math::Vec2 ModelCache::ReadVector2(std::ifstream& file) {
-        Math::Vec2 vec;
-        file.read(reinterpret_cast<char*>(&vec.x), sizeof(float));
-        file.read(reinterpret_cast<char*>(&vec.y), sizeof(float));
-        return vec;
-    }
-
-    void ModelCache::WriteVector4(std::ofstream& file, const Math::Vec4& vec) {
-        file.write(reinterpret_cast<const char*>(&vec.x), sizeof(float));
-        file.write(reinterpret_cast<const char*>(&vec.y), sizeof(float));
-        file.write(reinterpret_cast<const char*>(&vec.z), sizeof(float));
-        file.write(reinterpret_cast<const char*>(&vec.w), sizeof(float));
-    }
-
-    Math::Vec4 ModelCache::ReadVector4(std::ifstream& file) {
-        Math::Vec4 vec;
-        file.read(reinterpret_cast<char*>(&vec.x), sizeof(float));
-        file.read(reinterpret_cast<char*>(&vec.y), sizeof(float));
-        file.read(reinterpret_cast<char*>(&vec.z), sizeof(float));
-        file.read(reinterpret_cast<char*>(&vec.w), sizeof(float));
-        return vec;
-    }
-
-    void ModelCache::WriteMatrix4(std::ofstream& file, const Math::Mat4& mat) {
-        file.write(reinterpret_cast<const char*>(&mat[0][0]), 16 * sizeof(float));
-    }
-
-    Math::Mat4 ModelCache::ReadMatrix4(std::ifstream& file) {
-        Math::Mat4 mat;
-        file.read(reinterpret_cast<char*>(&mat[0][0]), 16 * sizeof(float));
-        return mat;
-    }
-
     // Cache maintenance methods
     void ModelCache::EvictOldEntries() {
         auto now = std::chrono::system_clock::now();
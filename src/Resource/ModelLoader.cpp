@@ -4,6 +4,7 @@
 #include "Resource/FBXLoader.h"
 #include "Resource/ModelLoadingException.h"
 #include "Resource/ModelCache.h"
+#include "Resource/ParallelImport.h"
 #include "Animation/AnimationImporter.h"
 #include "Core/Logger.h"
 #include <filesystem>
@@ -55,6 +56,10 @@ bool ModelLoader::Initialize() {
         Logger::GetInstance().Warning("Failed to initialize FBX loader");
         m_fbxLoader.reset();
     }
+    if (m_fbxLoader) {
+        SetParallelProcessingEnabled(m_parallelProcessing);
+        m_fbxLoader->SetJobSystem(m_jobSystem);
+    }
 
 #ifdef GAMEENGINE_HAS_ASSIMP
     try {
@@ -484,6 +489,22 @@ void ModelLoader::SetImportScale(float scale) {
     }
 }
 
+void ModelLoader::SetParallelProcessingEnabled(bool enabled) {
+    m_parallelProcessing = enabled;
+    if (m_fbxLoader) {
+        auto config = m_fbxLoader->GetLoadingConfig();
+        config.parallelMeshProcessing = enabled;
+        m_fbxLoader->SetLoadingConfig(config);
+    }
+}
+
+void ModelLoader::SetJobSystem(JobSystem* jobSystem) {
+    m_jobSystem = jobSystem;
+    if (m_fbxLoader) {
+        m_fbxLoader->SetJobSystem(jobSystem);
+    }
+}
+
 void ModelLoader::SetAnimationImportEnabled(bool enabled) {
     m_animationImportEnabled = enabled;
     LOG_INFO("Animation import " + std::string(enabled ? "enabled" : "disabled"));
@@ -546,8 +567,26 @@ ModelLoader::LoadResult ModelLoader::ProcessScene(const aiScene* scene, const st
     LoadResult result;
     
     try {
-        // Process all meshes in the scene
-        ProcessNode(scene->mRootNode, scene, result.meshes);
+        // Convert meshes in parallel into slots that keep scene-graph order
+        std::vector<const aiMesh*> sceneMeshes;
+        CollectNodeMeshes(scene->mRootNode, scene, sceneMeshes);
+        
+        std::vector<MeshData> meshData(sceneMeshes.size());
+        ParallelImportFor(sceneMeshes.size(), [&](size_t i) {
+            MeshData& data = meshData[i];
+            if (ConvertMesh(sceneMeshes[i], data)) {
+                Mesh::CalculateBounds(data.vertices, data.boundingBox, data.boundingSphere);
+            }
+        }, m_jobSystem, m_parallelProcessing ? 0 : 1);
+        
+        // Meshes upload their buffers, so they are created here rather than on the workers
+        for (MeshData& data : meshData) {
+            if (data.converted) {
+                if (auto mesh = CreateMesh(data)) {
+                    result.meshes.push_back(std::move(mesh));
+                }
+            }
+        }
         
         // Calculate statistics
         for (const auto& mesh : result.meshes) {
@@ -578,16 +617,14 @@ ModelLoader::LoadResult ModelLoader::ProcessScene(const aiScene* scene, const st
     return result;
 }
 
-std::shared_ptr<Mesh> ModelLoader::ProcessMesh(const aiMesh* mesh, const aiScene* scene) {
+bool ModelLoader::ConvertMesh(const aiMesh* mesh, MeshData& data) const {
     if (!mesh) {
-        return nullptr;
+        return false;
     }
     
     try {
-        auto engineMesh = std::make_shared<Mesh>();
-        
-        std::vector<Vertex> vertices;
-        std::vector<uint32_t> indices;
+        std::vector<Vertex>& vertices = data.vertices;
+        std::vector<uint32_t>& indices = data.indices;
         
         // Process vertices
         vertices.reserve(mesh->mNumVertices);
@@ -639,49 +676,61 @@ std::shared_ptr<Mesh> ModelLoader::ProcessMesh(const aiMesh* mesh, const aiScene
                 indices.push_back(face.mIndices[1]);
                 indices.push_back(face.mIndices[2]);
             } else {
-                Logger::GetInstance().Warning("ModelLoader::ProcessMesh: Non-triangular face with " + 
+                Logger::GetInstance().Warning("ModelLoader::ConvertMesh: Non-triangular face with " + 
                                             std::to_string(face.mNumIndices) + " indices found");
             }
         }
         
-        // Set mesh data
-        engineMesh->SetVertices(vertices);
-        engineMesh->SetIndices(indices);
-        
         // Set mesh name if available
         if (mesh->mName.length > 0) {
-            engineMesh->SetName(std::string(mesh->mName.C_Str()));
+            data.name = std::string(mesh->mName.C_Str());
+        }
+        
+        data.converted = true;
+        return true;
+        
+    } catch (const std::exception& e) {
+        Logger::GetInstance().Error("ModelLoader::ConvertMesh: Exception processing mesh: " + std::string(e.what()));
+        return false;
+    }
+}
+
+std::shared_ptr<Mesh> ModelLoader::CreateMesh(MeshData& data) const {
+    try {
+        auto engineMesh = std::make_shared<Mesh>();
+        const size_t vertexCount = data.vertices.size();
+        const size_t triangleCount = data.indices.size() / 3;
+        
+        // Set mesh data; bounds were computed on the worker, so this only uploads
+        engineMesh->SetGeometry(std::move(data.vertices), std::move(data.indices), data.boundingBox, data.boundingSphere);
+        if (!data.name.empty()) {
+            engineMesh->SetName(data.name);
         }
         
         Logger::GetInstance().Debug("Processed mesh '" + engineMesh->GetName() + "': " + 
-                                  std::to_string(vertices.size()) + " vertices, " + 
-                                  std::to_string(indices.size() / 3) + " triangles");
+                                  std::to_string(vertexCount) + " vertices, " + 
+                                  std::to_string(triangleCount) + " triangles");
         
         return engineMesh;
         
     } catch (const std::exception& e) {
-        Logger::GetInstance().Error("ModelLoader::ProcessMesh: Exception processing mesh: " + std::string(e.what()));
+        Logger::GetInstance().Error("ModelLoader::CreateMesh: Exception creating mesh: " + std::string(e.what()));
         return nullptr;
     }
 }
 
-void ModelLoader::ProcessNode(const aiNode* node, const aiScene* scene, std::vector<std::shared_ptr<Mesh>>& meshes) {
+void ModelLoader::CollectNodeMeshes(const aiNode* node, const aiScene* scene, std::vector<const aiMesh*>& meshes) const {
     if (!node) {
         return;
     }
     
-    // Process all meshes in this node
+    // Meshes of this node, then children depth-first; this is the order meshes appear in the result
     for (uint32_t i = 0; i < node->mNumMeshes; i++) {
-        aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-        auto engineMesh = ProcessMesh(mesh, scene);
-        if (engineMesh) {
-            meshes.push_back(engineMesh);
-        }
+        meshes.push_back(scene->mMeshes[node->mMeshes[i]]);
     }
     
-    // Recursively process child nodes
     for (uint32_t i = 0; i < node->mNumChildren; i++) {
-        ProcessNode(node->mChildren[i], scene, meshes);
+        CollectNodeMeshes(node->mChildren[i], scene, meshes);
     }
 }
 
@@ -929,7 +929,7 @@ void ModelValidator::UpdateReportCounts(ValidationReport& report) {
 void ModelValidator::ValidateTriangleQuality(std::shared_ptr<Mesh> mesh, std::vector<ValidationIssue>& issues, const std::string& meshName) {
     if (!mesh) return;
     
-    const auto& vertices = mesh->GetVertices();
+    const auto vertices = mesh->DecodeVertices();
     const auto& indices = mesh->GetIndices();
     
     if (indices.size() % 3 != 0) {
@@ -982,7 +982,7 @@ void ModelValidator::ValidateTriangleQuality(std::shared_ptr<Mesh> mesh, std::ve
 void ModelValidator::ValidateNormals(std::shared_ptr<Mesh> mesh, std::vector<ValidationIssue>& issues, const std::string& meshName) {
     if (!mesh) return;
     
-    const auto& vertices = mesh->GetVertices();
+    const auto vertices = mesh->DecodeVertices();
     
     bool hasNormals = false;
     size_t invalidNormals = 0;
@@ -1024,7 +1024,7 @@ void ModelValidator::ValidateNormals(std::shared_ptr<Mesh> mesh, std::vector<Val
 void ModelValidator::ValidateTextureCoordinates(std::shared_ptr<Mesh> mesh, std::vector<ValidationIssue>& issues, const std::string& meshName) {
     if (!mesh) return;
     
-    const auto& vertices = mesh->GetVertices();
+    const auto vertices = mesh->DecodeVertices();
     
     bool hasTexCoords = false;
     size_t outOfRangeCoords = 0;
@@ -1074,7 +1074,7 @@ bool ModelValidator::IsTriangleDegenerate(const Math::Vec3& v1, const Math::Vec3
 size_t ModelValidator::CountDuplicateVertices(std::shared_ptr<Mesh> mesh, float epsilon) {
     if (!mesh) return 0;
     
-    const auto& vertices = mesh->GetVertices();
+    const auto vertices = mesh->DecodeVertices();
     size_t duplicates = 0;
     
     for (size_t i = 0; i < vertices.size(); ++i) {
@@ -0,0 +1,68 @@
+#include "Resource/ParallelImport.h"
+#include "Core/JobSystem.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GameEngine {
+
+    void ParallelImportFor(size_t count, const std::function<void(size_t)>& body, JobSystem* jobSystem, size_t maxThreads) {
+        if (count == 0) {
+            return;
+        }
+
+        std::exception_ptr firstError;
+        std::mutex errorMutex;
+        auto runIndex = [&](size_t index) {
+            try {
+                body(index);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!firstError) {
+                    firstError = std::current_exception();
+                }
+            }
+        };
+
+        size_t threadCount = maxThreads != 0 ? maxThreads : std::max(1u, std::thread::hardware_concurrency());
+        threadCount = std::min(threadCount, count);
+
+        if (threadCount <= 1) {
+            for (size_t i = 0; i < count; ++i) {
+                runIndex(i);
+            }
+        } else if (jobSystem && jobSystem->IsInitialized()) {
+            // One index per chunk: meshes differ a lot in size, so let stealing balance them.
+            // The caller waits for the result, so this is normal work that yields to frame jobs
+            jobSystem->ParallelFor(count, 1, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    runIndex(i);
+                }
+            }, JobPriority::Normal);
+        } else {
+            std::atomic<size_t> nextIndex{0};
+            auto worker = [&]() {
+                for (size_t i = nextIndex.fetch_add(1); i < count; i = nextIndex.fetch_add(1)) {
+                    runIndex(i);
+                }
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(threadCount - 1);
+            for (size_t t = 1; t < threadCount; ++t) {
+                threads.emplace_back(worker);
+            }
+            worker();
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        }
+
+        if (firstError) {
+            std::rethrow_exception(firstError);
+        }
+    }
+}
@@ -3,6 +3,8 @@
 #include "Resource/LRUResourceCache.h"
 #include "Resource/GPUUploadOptimizer.h"
 #include "../../engine/core/Logger.h"
+#include "../../engine/core/JobSystem.h"
+#include <algorithm>
 #include <filesystem>
 #include <sstream>
 
@@ -10,8 +12,9 @@ namespace GameEngine {
     ResourceManager::ResourceManager() : m_lastMemoryPressureCheck(std::chrono::steady_clock::now()) {
         // Initialize performance optimization components
         m_memoryPool = std::make_unique<ResourceMemoryPool>();
-        m_lruCache = std::make_unique<LRUResourceCache<Resource>>();
+        m_lruCache = std::make_unique<ShardedLRUResourceCache<Resource>>();
         m_gpuUploadOptimizer = std::make_unique<GPUUploadOptimizer>();
+        m_loadJobs = std::make_unique<JobGroup>();
         
         LOG_DEBUG("ResourceManager created with performance optimizations");
     }
@@ -87,6 +90,11 @@ namespace GameEngine {
         LOG_INFO("Shutting down Resource Manager...");
         
         try {
+            // Finish queued async loads; they still reference this manager
+            if (m_jobSystem) {
+                m_jobSystem->Wait(*m_loadJobs);
+            }
+            
             // Shutdown performance optimization components
             if (m_gpuUploadOptimizer) {
                 m_gpuUploadOptimizer->Shutdown();
@@ -113,6 +121,7 @@ namespace GameEngine {
             ss << "  Total loads: " << m_totalLoads << "\n";
             ss << "  Cache hits: " << m_cacheHits << " (" << (m_totalLoads > 0 ? (m_cacheHits * 100.0 / m_totalLoads) : 0.0) << "%)\n";
             ss << "  Cache misses: " << m_cacheMisses << "\n";
+            ss << "  Shared in-flight loads: " << m_sharedLoads << "\n";
             ss << "  Load failures: " << m_loadFailureCount << "\n";
             ss << "  Fallback resources created: " << m_fallbackResourcesCreated << "\n";
             ss << "  LRU cleanups: " << m_lruCleanups << "\n";
@@ -130,7 +139,13 @@ namespace GameEngine {
 
     void ResourceManager::UnloadAll() {
         std::lock_guard<std::mutex> lock(m_resourcesMutex);
-        size_t resourceCount = GetResourceCount();
+        // Counted here; GetResourceCount would relock the mutex
+        size_t resourceCount = 0;
+        for (const auto& pair : m_resources) {
+            if (!pair.second.expired()) {
+                ++resourceCount;
+            }
+        }
         m_resources.clear();
         LOG_INFO("All resources unloaded (" + std::to_string(resourceCount) + " resources)");
     }
@@ -270,6 +285,12 @@ namespace GameEngine {
             return;
         }
         
+        // Loading threads check concurrently; one check at a time is enough
+        std::unique_lock<std::mutex> checkLock(m_memoryPressureMutex, std::try_to_lock);
+        if (!checkLock.owns_lock()) {
+            return;
+        }
+        
         // Throttle memory pressure checks to avoid excessive overhead
         auto now = std::chrono::steady_clock::now();
         auto timeSinceLastCheck = std::chrono::duration_cast<std::chrono::seconds>(now - m_lastMemoryPressureCheck);
@@ -575,4 +596,19 @@ namespace GameEngine {
         }
         return 0;
     }
+
+    size_t ResourceManager::GetInFlightLoadCount() const {
+        std::lock_guard<std::mutex> lock(m_resourcesMutex);
+        return m_inFlightLoads.size();
+    }
+
+    void ResourceManager::EnqueueLoad(std::function<void()> task) {
+        if (!m_jobSystem) {
+            task();
+            return;
+        }
+        
+        // Background jobs are capped to part of the workers, so loads never crowd out frame jobs
+        m_jobSystem->Submit(std::move(task), *m_loadJobs, JobPriority::Background);
+    }
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Resource/AsyncModelLoader.h"
+#include "Core/JobSystem.h"
 #include "Resource/ModelLoader.h"
 #include "Core/Logger.h"
 #include "../TestUtils.h"
@@ -90,8 +91,12 @@ bool TestAsyncLoadingWithProgressTracking() {
         return true;
     }
     
+    JobSystem jobSystem;
+    jobSystem.Initialize(JobSystemConfig{2, 2}); // Use 2 worker threads, all allowed to run loads
+
     AsyncModelLoader asyncLoader;
-    EXPECT_TRUE(asyncLoader.Initialize(2)); // Use 2 worker threads
+    asyncLoader.SetJobSystem(&jobSystem);
+    EXPECT_TRUE(asyncLoader.Initialize());
     
     // Setup progress tracking
     std::atomic<int> progressCallbackCount{0};
@@ -150,6 +155,7 @@ bool TestAsyncLoadingWithProgressTracking() {
     TestOutput::PrintInfo("  Progress callbacks: " + std::to_string(progressCallbackCount.load()));
     
     asyncLoader.Shutdown();
+    jobSystem.Shutdown();
     
     // Cleanup
     std::filesystem::remove_all("test_assets");
@@ -171,8 +177,12 @@ bool TestConcurrentModelLoading() {
         return true;
     }
     
+    JobSystem jobSystem;
+    jobSystem.Initialize(JobSystemConfig{3, 3}); // Use 3 worker threads, all allowed to run loads
+
     AsyncModelLoader asyncLoader;
-    EXPECT_TRUE(asyncLoader.Initialize(3)); // Use 3 worker threads
+    asyncLoader.SetJobSystem(&jobSystem);
+    EXPECT_TRUE(asyncLoader.Initialize());
     
     // Setup concurrent loading tracking
     std::atomic<int> completedLoads{0};
@@ -226,6 +236,7 @@ bool TestConcurrentModelLoading() {
     TestOutput::PrintInfo("  Loads failed: " + std::to_string(stats.totalLoadsFailed));
     
     asyncLoader.Shutdown();
+    jobSystem.Shutdown();
     
     // Cleanup
     std::filesystem::remove_all("test_assets");
@@ -247,8 +258,12 @@ bool TestLoadCancellationAndManagement() {
         return true;
     }
     
+    JobSystem jobSystem;
+    jobSystem.Initialize(JobSystemConfig{2, 2});
+
     AsyncModelLoader asyncLoader;
-    EXPECT_TRUE(asyncLoader.Initialize(2));
+    asyncLoader.SetJobSystem(&jobSystem);
+    EXPECT_TRUE(asyncLoader.Initialize());
     
     // Test load cancellation
     std::string testFile = "test_assets/complex_mesh.obj";
@@ -311,6 +326,7 @@ bool TestLoadCancellationAndManagement() {
     TestOutput::PrintInfo("  Current active: " + std::to_string(stats.currentActiveLoads));
     
     asyncLoader.Shutdown();
+    jobSystem.Shutdown();
     
     // Cleanup
     std::filesystem::remove_all("test_assets");
@@ -326,8 +342,12 @@ bool TestLoadCancellationAndManagement() {
 bool TestAsyncLoadingErrorHandling() {
     TestOutput::PrintTestStart("async loading error handling");
     
+    JobSystem jobSystem;
+    jobSystem.Initialize(JobSystemConfig{2, 2});
+
     AsyncModelLoader asyncLoader;
-    EXPECT_TRUE(asyncLoader.Initialize(2));
+    asyncLoader.SetJobSystem(&jobSystem);
+    EXPECT_TRUE(asyncLoader.Initialize());
     
     // Test loading non-existent file
     auto future1 = asyncLoader.LoadModelAsync("non_existent_file.obj");
@@ -396,6 +416,7 @@ bool TestAsyncLoadingErrorHandling() {
     ) + "%");
     
     asyncLoader.Shutdown();
+    jobSystem.Shutdown();
     
     // Cleanup
     std::filesystem::remove_all("test_assets");
@@ -423,8 +444,12 @@ bool TestAsyncLoadingPerformance() {
     for (uint32_t threadCount : threadCounts) {
         TestOutput::PrintInfo("Testing with " + std::to_string(threadCount) + " threads");
         
+        JobSystem jobSystem;
+        jobSystem.Initialize(JobSystemConfig{threadCount, threadCount});
+
         AsyncModelLoader asyncLoader;
-        EXPECT_TRUE(asyncLoader.Initialize(threadCount));
+        asyncLoader.SetJobSystem(&jobSystem);
+        EXPECT_TRUE(asyncLoader.Initialize());
         EXPECT_EQUAL(asyncLoader.GetWorkerThreadCount(), threadCount);
         
         // Measure loading performance
@@ -460,6 +485,7 @@ bool TestAsyncLoadingPerformance() {
         }
         
         asyncLoader.Shutdown();
+        jobSystem.Shutdown();
     }
     
     // Cleanup
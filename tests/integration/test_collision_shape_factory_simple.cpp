@@ -1,15 +1,52 @@
 #ifdef GAMEENGINE_HAS_BULLET
 
 #include "Physics/CollisionShapeFactory.h"
+#include "Physics/CollisionShapeCache.h"
 #include "Physics/PhysicsEngine.h"
 #include "../TestUtils.h"
 #include <iostream>
+#include <cmath>
+#include <filesystem>
 #include <btBulletDynamicsCommon.h>
+#include <BulletCollision/CollisionShapes/btScaledBvhTriangleMeshShape.h>
 
 using namespace GameEngine;
 using namespace GameEngine::Physics;
 using namespace GameEngine::Testing;
 
+namespace {
+    // Flat size x size quad grid on the XZ plane centred at the origin, two triangles per quad
+    std::shared_ptr<const CollisionMeshData> MakeGridMesh(uint32_t size, float spacing = 1.0f) {
+        std::vector<Math::Vec3> positions;
+        std::vector<uint32_t> indices;
+        const float offset = size * spacing * 0.5f;
+        for (uint32_t z = 0; z <= size; ++z) {
+            for (uint32_t x = 0; x <= size; ++x) {
+                positions.emplace_back(x * spacing - offset, 0.0f, z * spacing - offset);
+            }
+        }
+        for (uint32_t z = 0; z < size; ++z) {
+            for (uint32_t x = 0; x < size; ++x) {
+                const uint32_t i = z * (size + 1) + x;
+                indices.insert(indices.end(), { i, i + size + 1, i + 1, i + 1, i + size + 1, i + size + 2 });
+            }
+        }
+        return std::make_shared<const CollisionMeshData>(std::move(positions), std::move(indices));
+    }
+
+    // Points on a unit sphere, far more than a hull budget
+    std::shared_ptr<const CollisionMeshData> MakeSpherePoints(uint32_t count) {
+        std::vector<Math::Vec3> positions;
+        for (uint32_t i = 0; i < count; ++i) {
+            const float y = 1.0f - 2.0f * (i + 0.5f) / count;
+            const float r = std::sqrt(1.0f - y * y);
+            const float phi = 2.39996323f * i;
+            positions.emplace_back(r * std::cos(phi), y, r * std::sin(phi));
+        }
+        return std::make_shared<const CollisionMeshData>(std::move(positions));
+    }
+}
+
 /**
  * Test box shape creation
  * Requirements: Physics collision shape creation
@@ -86,8 +123,8 @@ bool TestInvalidShapeRejection() {
 }
 
 /**
- * Test mesh shape handling (not implemented)
- * Requirements: Physics collision shape creation
+ * Test mesh shape handling without triangle data
+ * Requirements: Physics collision shape validation
  */
 bool TestMeshShapeHandling() {
     TestOutput::PrintTestStart("mesh shape handling");
@@ -97,12 +134,255 @@ bool TestMeshShapeHandling() {
     meshDesc.dimensions = Math::Vec3(1.0f, 1.0f, 1.0f);
 
     auto meshShape = CollisionShapeFactory::CreateShape(meshDesc);
-    EXPECT_NULL(meshShape); // Should return null as mesh shapes are not implemented
+    EXPECT_NULL(meshShape); // Should return null without mesh data
+
+    // Point clouds have no triangles to build a BVH from
+    meshDesc.mesh = MakeSpherePoints(16);
+    EXPECT_NULL(CollisionShapeFactory::CreateShape(meshDesc));
     
     TestOutput::PrintTestPass("mesh shape handling");
     return true;
 }
 
+/**
+ * Test BVH triangle mesh creation, scaled instances and static-only bodies
+ * Requirements: Static triangle mesh collision shapes
+ */
+bool TestTriangleMeshShapeCreation() {
+    TestOutput::PrintTestStart("triangle mesh shape creation");
+
+    CollisionShape meshDesc;
+    meshDesc.type = CollisionShape::Mesh;
+    meshDesc.mesh = MakeGridMesh(8);
+
+    auto meshShape = CollisionShapeFactory::CreateShape(meshDesc);
+    EXPECT_NOT_NULL(meshShape);
+    EXPECT_TRUE(meshShape->getShapeType() == TRIANGLE_MESH_SHAPE_PROXYTYPE);
+
+    meshDesc.dimensions = Math::Vec3(2.0f, 1.0f, 2.0f);
+    auto scaledShape = CollisionShapeFactory::CreateShape(meshDesc);
+    EXPECT_NOT_NULL(scaledShape);
+    EXPECT_TRUE(scaledShape->getShapeType() == SCALED_TRIANGLE_MESH_SHAPE_PROXYTYPE);
+
+    // Dynamic mesh bodies are created static, so a ray still hits the floor after stepping
+    PhysicsEngine engine;
+    EXPECT_TRUE(engine.Initialize(PhysicsConfiguration::Default()));
+    RigidBody floorDesc;
+    floorDesc.isStatic = false;
+    floorDesc.mass = 10.0f;
+    const uint32_t floorId = engine.CreateRigidBody(floorDesc, meshDesc);
+    EXPECT_TRUE(floorId != 0);
+    engine.Update(0.5f);
+
+    // The 8x8 grid scaled by 2 spans +-8 on X and Z
+    RaycastHit hit = engine.Raycast(Math::Vec3(7.0f, 5.0f, -7.0f), Math::Vec3(0.0f, -1.0f, 0.0f), 10.0f);
+    EXPECT_TRUE(hit.hasHit);
+    EXPECT_EQUAL(hit.bodyId, floorId);
+    EXPECT_NEARLY_EQUAL_EPSILON(hit.distance, 5.0f, 0.01f);
+
+    engine.Shutdown();
+
+    TestOutput::PrintTestPass("triangle mesh shape creation");
+    return true;
+}
+
+/**
+ * Test convex hull creation with vertex simplification
+ * Requirements: Convex hull collision shapes with simplification
+ */
+bool TestConvexHullShapeCreation() {
+    TestOutput::PrintTestStart("convex hull shape creation");
+
+    CollisionShape hullDesc;
+    hullDesc.type = CollisionShape::ConvexHull;
+    hullDesc.mesh = MakeSpherePoints(500);
+    hullDesc.maxHullVertices = 32;
+    hullDesc.dimensions = Math::Vec3(2.0f);
+
+    auto hullShape = CollisionShapeFactory::CreateShape(hullDesc);
+    EXPECT_NOT_NULL(hullShape);
+    EXPECT_TRUE(hullShape->getShapeType() == CONVEX_HULL_SHAPE_PROXYTYPE);
+
+    const auto* hull = static_cast<const btConvexHullShape*>(hullShape.get());
+    EXPECT_TRUE(hull->getNumPoints() > 4);
+    EXPECT_TRUE(hull->getNumPoints() <= 32);
+
+    // Scaled by 2, the simplified unit sphere still reaches close to radius 2 on every axis
+    btVector3 aabbMin, aabbMax;
+    hullShape->getAabb(btTransform::getIdentity(), aabbMin, aabbMax);
+    EXPECT_IN_RANGE(aabbMax.x(), 1.7f, 2.1f);
+    EXPECT_IN_RANGE(aabbMax.y(), 1.7f, 2.1f);
+    EXPECT_IN_RANGE(-aabbMin.z(), 1.7f, 2.1f);
+
+    hullDesc.mesh = nullptr;
+    EXPECT_NULL(CollisionShapeFactory::CreateShape(hullDesc));
+
+    TestOutput::PrintTestPass("convex hull shape creation");
+    return true;
+}
+
+/**
+ * Test compound shape creation from child shapes
+ * Requirements: Compound collision shapes
+ */
+bool TestCompoundShapeCreation() {
+    TestOutput::PrintTestStart("compound shape creation");
+
+    CollisionShape compoundDesc;
+    compoundDesc.type = CollisionShape::Compound;
+    EXPECT_NULL(CollisionShapeFactory::CreateShape(compoundDesc)); // No children
+
+    CollisionShape::Child seat;
+    seat.shape.type = CollisionShape::Box;
+    seat.shape.dimensions = Math::Vec3(1.0f, 0.2f, 1.0f);
+    CollisionShape::Child back;
+    back.shape.type = CollisionShape::Box;
+    back.shape.dimensions = Math::Vec3(1.0f, 1.0f, 0.2f);
+    back.position = Math::Vec3(0.0f, 0.5f, -0.4f);
+    compoundDesc.children = { seat, back };
+
+    auto compoundShape = CollisionShapeFactory::CreateShape(compoundDesc);
+    EXPECT_NOT_NULL(compoundShape);
+    EXPECT_TRUE(compoundShape->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+    EXPECT_EQUAL(static_cast<const btCompoundShape*>(compoundShape.get())->getNumChildShapes(), 2);
+
+    // One invalid child invalidates the compound
+    compoundDesc.children[1].shape.dimensions.z = 0.0f;
+    EXPECT_NULL(CollisionShapeFactory::CreateShape(compoundDesc));
+
+    TestOutput::PrintTestPass("compound shape creation");
+    return true;
+}
+
+/**
+ * Test that identical descriptors share one shape through the cache
+ * Requirements: Content-hashed collision shape cache
+ */
+bool TestShapeCacheSharing() {
+    TestOutput::PrintTestStart("shape cache sharing");
+
+    CollisionShapeCache cache;
+
+    CollisionShape crate;
+    crate.type = CollisionShape::Box;
+    crate.dimensions = Math::Vec3(1.0f);
+    auto first = cache.Acquire(crate);
+    auto second = cache.Acquire(crate);
+    EXPECT_NOT_NULL(first);
+    EXPECT_TRUE(first == second);
+
+    CollisionShape bigCrate = crate;
+    bigCrate.dimensions = Math::Vec3(2.0f);
+    EXPECT_TRUE(cache.Acquire(bigCrate) != first);
+
+    // Separately built but identical mesh data shares a shape, scaled instances share its BVH
+    CollisionShape rock;
+    rock.type = CollisionShape::Mesh;
+    rock.mesh = MakeGridMesh(4);
+    CollisionShape sameRock = rock;
+    sameRock.mesh = MakeGridMesh(4);
+    auto rockShape = cache.Acquire(rock);
+    EXPECT_TRUE(cache.Acquire(sameRock) == rockShape);
+
+    CollisionShape bigRock = rock;
+    bigRock.dimensions = Math::Vec3(3.0f);
+    auto bigRockShape = cache.Acquire(bigRock);
+    EXPECT_TRUE(bigRockShape->getShapeType() == SCALED_TRIANGLE_MESH_SHAPE_PROXYTYPE);
+    EXPECT_TRUE(static_cast<const btScaledBvhTriangleMeshShape*>(bigRockShape.get())->getChildShape() == rockShape.get());
+
+    // Compound children come from the cache as well
+    CollisionShape pallet;
+    pallet.type = CollisionShape::Compound;
+    CollisionShape::Child child;
+    child.shape = crate;
+    pallet.children = { child };
+    auto palletShape = cache.Acquire(pallet);
+    EXPECT_TRUE(static_cast<const btCompoundShape*>(palletShape.get())->getChildShape(0) == first.get());
+
+    CollisionShapeCacheStats stats = cache.GetStats();
+    EXPECT_EQUAL(stats.shapeCount, static_cast<size_t>(5)); // crate, big crate, rock, big rock, pallet
+    EXPECT_EQUAL(stats.bvhBuilds, static_cast<size_t>(1));
+    EXPECT_TRUE(stats.memoryBytes > 0);
+
+    // Purging keeps shapes still in use, including children of shapes in use
+    first.reset();
+    second.reset();
+    rockShape.reset();
+    EXPECT_EQUAL(cache.Purge(), static_cast<size_t>(1)); // Only the big crate is unused
+    palletShape.reset();
+    bigRockShape.reset();
+    EXPECT_EQUAL(cache.Purge(), static_cast<size_t>(4));
+    EXPECT_EQUAL(cache.GetStats().shapeCount, static_cast<size_t>(0));
+
+    TestOutput::PrintTestPass("shape cache sharing");
+    return true;
+}
+
+/**
+ * Test that bodies created through the engine share shapes and that BVHs round-trip through disk
+ * Requirements: Shared shape cache and serialized mesh BVHs
+ */
+bool TestBvhSerialization() {
+    TestOutput::PrintTestStart("BVH serialization");
+
+    const std::filesystem::path directory = std::filesystem::temp_directory_path() / "gameengine_bvh_cache_test";
+    std::filesystem::remove_all(directory);
+
+    PhysicsConfiguration config = PhysicsConfiguration::Default();
+    config.collisionCacheDirectory = directory.string();
+
+    CollisionShape terrain;
+    terrain.type = CollisionShape::Mesh;
+    terrain.mesh = MakeGridMesh(32, 0.5f);
+
+    RigidBody bodyDesc;
+    bodyDesc.isStatic = true;
+
+    for (int run = 0; run < 2; ++run) {
+        PhysicsEngine engine;
+        EXPECT_TRUE(engine.Initialize(config));
+        bodyDesc.position = Math::Vec3(0.0f);
+        const uint32_t firstId = engine.CreateRigidBody(bodyDesc, terrain);
+        bodyDesc.position = Math::Vec3(0.0f, -10.0f, 0.0f);
+        const uint32_t secondId = engine.CreateRigidBody(bodyDesc, terrain);
+        EXPECT_TRUE(firstId != 0 && secondId != 0);
+
+        CollisionShapeCacheStats stats = engine.GetShapeCacheStats();
+        EXPECT_EQUAL(stats.shapeCount, static_cast<size_t>(1));
+        EXPECT_EQUAL(stats.hits, static_cast<size_t>(1));
+        // The first run builds and stores the BVH, the second loads it
+        EXPECT_EQUAL(stats.bvhBuilds, static_cast<size_t>(run == 0 ? 1 : 0));
+        EXPECT_EQUAL(stats.bvhLoads, static_cast<size_t>(run == 0 ? 0 : 1));
+
+        RaycastHit hit = engine.Raycast(Math::Vec3(3.3f, 4.0f, -2.7f), Math::Vec3(0.0f, -1.0f, 0.0f), 8.0f);
+        EXPECT_TRUE(hit.hasHit);
+        EXPECT_EQUAL(hit.bodyId, firstId);
+        EXPECT_NEARLY_EQUAL_EPSILON(hit.distance, 4.0f, 0.01f);
+
+        // Destroying both bodies leaves the shape cached until purged
+        engine.DestroyRigidBody(firstId);
+        engine.DestroyRigidBody(secondId);
+        EXPECT_EQUAL(engine.PurgeShapeCache(), static_cast<size_t>(1));
+        engine.Shutdown();
+    }
+
+    // A file cooked for different triangles is ignored
+    std::filesystem::path bvhFile;
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+        bvhFile = entry.path();
+    }
+    EXPECT_TRUE(bvhFile.extension() == ".bvh");
+    bool loaded = true;
+    auto otherMesh = MakeGridMesh(16);
+    EXPECT_NOT_NULL(CollisionShapeFactory::CreateTriangleMeshShape(otherMesh, bvhFile.string(), &loaded));
+    EXPECT_FALSE(loaded);
+
+    std::filesystem::remove_all(directory);
+
+    TestOutput::PrintTestPass("BVH serialization");
+    return true;
+}
+
 int main() {
     TestOutput::PrintHeader("Collision Shape Factory Integration");
 
@@ -118,6 +398,11 @@ int main() {
         allPassed &= suite.RunTest("Capsule Shape Creation", TestCapsuleShapeCreation);
         allPassed &= suite.RunTest("Invalid Shape Rejection", TestInvalidShapeRejection);
         allPassed &= suite.RunTest("Mesh Shape Handling", TestMeshShapeHandling);
+        allPassed &= suite.RunTest("Triangle Mesh Shape Creation", TestTriangleMeshShapeCreation);
+        allPassed &= suite.RunTest("Convex Hull Shape Creation", TestConvexHullShapeCreation);
+        allPassed &= suite.RunTest("Compound Shape Creation", TestCompoundShapeCreation);
+        allPassed &= suite.RunTest("Shape Cache Sharing", TestShapeCacheSharing);
+        allPassed &= suite.RunTest("BVH Serialization", TestBvhSerialization);
 
         // Print detailed summary
         suite.PrintSummary();
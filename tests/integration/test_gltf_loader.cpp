@@ -1,12 +1,120 @@
 #include "Resource/GLTFLoader.h"
+#include "Resource/MappedFile.h"
+#include "Graphics/Mesh.h"
 #include "Core/Logger.h"
 #include "TestUtils.h"
 #include <iostream>
 #include <filesystem>
+#include <fstream>
+#include <cstring>
 
 using namespace GameEngine;
 using namespace GameEngine::Testing;
 
+namespace {
+    template<typename T>
+    void AppendBytes(std::vector<uint8_t>& buffer, const T& value) {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+        buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    void PadTo4(std::vector<uint8_t>& buffer, uint8_t padding) {
+        while (buffer.size() % 4 != 0) {
+            buffer.push_back(padding);
+        }
+    }
+
+    /**
+     * A quad exercising the accessor decoder: interleaved position/normal (byteStride 24),
+     * normalized UNSIGNED_SHORT texcoords, UNSIGNED_SHORT indices and a sparse accessor that
+     * moves vertex 2 to (5, 6, 7).
+     */
+    std::vector<uint8_t> CreateAccessorTestGLB() {
+        std::vector<uint8_t> bin;
+
+        // bufferView 0: interleaved position + normal, 4 vertices
+        const float positions[4][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}};
+        for (const auto& position : positions) {
+            for (float p : position) AppendBytes(bin, p);
+            AppendBytes(bin, 0.0f); AppendBytes(bin, 0.0f); AppendBytes(bin, 1.0f);
+        }
+
+        // bufferView 1 at 96: normalized texcoords
+        const uint16_t texCoords[4][2] = {{0, 0}, {65535, 0}, {65535, 65535}, {0, 65535}};
+        for (const auto& uv : texCoords) {
+            AppendBytes(bin, uv[0]); AppendBytes(bin, uv[1]);
+        }
+
+        // bufferView 2 at 112: indices
+        for (uint16_t index : {0, 1, 2, 0, 2, 3}) {
+            AppendBytes(bin, index);
+        }
+
+        // bufferView 3 at 124: sparse indices; bufferView 4 at 128: sparse values
+        bin.push_back(2);
+        PadTo4(bin, 0);
+        AppendBytes(bin, 5.0f); AppendBytes(bin, 6.0f); AppendBytes(bin, 7.0f);
+
+        std::string json = R"({
+            "asset": {"version": "2.0"},
+            "scene": 0,
+            "scenes": [{"nodes": [0]}],
+            "nodes": [{"mesh": 0}],
+            "meshes": [{"primitives": [{"attributes": {"POSITION": 0, "NORMAL": 1, "TEXCOORD_0": 2}, "indices": 3}]}],
+            "buffers": [{"byteLength": 140}],
+            "bufferViews": [
+                {"buffer": 0, "byteOffset": 0, "byteLength": 96, "byteStride": 24},
+                {"buffer": 0, "byteOffset": 96, "byteLength": 16},
+                {"buffer": 0, "byteOffset": 112, "byteLength": 12},
+                {"buffer": 0, "byteOffset": 124, "byteLength": 1},
+                {"buffer": 0, "byteOffset": 128, "byteLength": 12}
+            ],
+            "accessors": [
+                {"bufferView": 0, "componentType": 5126, "count": 4, "type": "VEC3",
+                 "sparse": {"count": 1, "indices": {"bufferView": 3, "componentType": 5121}, "values": {"bufferView": 4}}},
+                {"bufferView": 0, "byteOffset": 12, "componentType": 5126, "count": 4, "type": "VEC3"},
+                {"bufferView": 1, "componentType": 5123, "normalized": true, "count": 4, "type": "VEC2"},
+                {"bufferView": 2, "componentType": 5123, "count": 6, "type": "SCALAR"}
+            ]
+        })";
+        while (json.size() % 4 != 0) {
+            json.push_back(' ');
+        }
+
+        std::vector<uint8_t> glb;
+        AppendBytes(glb, uint32_t(0x46546C67));
+        AppendBytes(glb, uint32_t(2));
+        AppendBytes(glb, uint32_t(12 + 8 + json.size() + 8 + bin.size()));
+        AppendBytes(glb, uint32_t(json.size()));
+        AppendBytes(glb, uint32_t(0x4E4F534A));
+        glb.insert(glb.end(), json.begin(), json.end());
+        AppendBytes(glb, uint32_t(bin.size()));
+        AppendBytes(glb, uint32_t(0x004E4942));
+        glb.insert(glb.end(), bin.begin(), bin.end());
+        return glb;
+    }
+
+    bool CheckAccessorTestMesh(const GLTFLoader::LoadResult& result) {
+        EXPECT_TRUE(result.success);
+        EXPECT_NOT_NULL(result.model);
+        auto meshes = result.model->GetMeshes();
+        EXPECT_EQUAL(meshes.size(), static_cast<size_t>(1));
+
+        const auto& vertices = meshes[0]->GetVertices();
+        EXPECT_EQUAL(vertices.size(), static_cast<size_t>(4));
+        EXPECT_VEC3_NEARLY_EQUAL(vertices[1].position, Math::Vec3(1.0f, 0.0f, 0.0f));
+        EXPECT_VEC3_NEARLY_EQUAL(vertices[2].position, Math::Vec3(5.0f, 6.0f, 7.0f));
+        EXPECT_VEC3_NEARLY_EQUAL(vertices[3].normal, Math::Vec3(0.0f, 0.0f, 1.0f));
+        EXPECT_NEARLY_EQUAL(vertices[1].texCoords.x, 1.0f);
+        EXPECT_NEARLY_EQUAL(vertices[3].texCoords.y, 1.0f);
+        EXPECT_NEARLY_EQUAL(vertices[3].texCoords.x, 0.0f);
+
+        const std::vector<uint32_t> expectedIndices = {0, 1, 2, 0, 2, 3};
+        EXPECT_TRUE(meshes[0]->GetIndices() == expectedIndices);
+        return true;
+    }
+}
+
 bool TestGLTFLoaderInitialization() {
     TestOutput::PrintTestStart("GLTF loader initialization");
     
@@ -121,6 +229,47 @@ bool TestGLTFLoaderMemoryLoading() {
     return true;
 }
 
+/**
+ * Test decoding interleaved, normalized and sparse accessors from a GLB in memory and mapped from disk
+ * Requirements: glTF accessors decode in place from the binary chunk into vertex storage
+ */
+bool TestGLTFLoaderAccessorDecoding() {
+    TestOutput::PrintTestStart("GLTF loader accessor decoding");
+
+    auto glb = CreateAccessorTestGLB();
+
+    GLTFLoader loader;
+    auto memoryResult = loader.LoadGLTFFromMemory(glb.data(), glb.size());
+    if (!CheckAccessorTestMesh(memoryResult)) {
+        return false;
+    }
+
+    std::string tempFile = "temp_accessors.glb";
+    {
+        std::ofstream file(tempFile, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(glb.data()), glb.size());
+    }
+
+    // LoadGLTF maps the file; a caller-provided mapping goes through LoadGLTFFromMemory
+    auto fileResult = loader.LoadGLTF(tempFile);
+    if (!CheckAccessorTestMesh(fileResult)) {
+        return false;
+    }
+
+    MappedFile mapped;
+    EXPECT_TRUE(mapped.Open(tempFile));
+    auto mappedResult = loader.LoadGLTFFromMemory(mapped.GetData(), mapped.GetSize());
+    mapped.Close();
+    if (!CheckAccessorTestMesh(mappedResult)) {
+        return false;
+    }
+
+    std::filesystem::remove(tempFile);
+
+    TestOutput::PrintTestPass("GLTF loader accessor decoding");
+    return true;
+}
+
 bool TestGLTFLoaderWithRealFile() {
     TestOutput::PrintTestStart("GLTF loader with real GLTF file");
     
@@ -176,6 +325,7 @@ int main() {
         allPassed &= suite.RunTest("GLTF Loader with Invalid JSON", TestGLTFLoaderWithInvalidJSON);
         allPassed &= suite.RunTest("GLTF Loader with Minimal Valid GLTF", TestGLTFLoaderWithMinimalValidGLTF);
         allPassed &= suite.RunTest("GLTF Loader Memory Loading", TestGLTFLoaderMemoryLoading);
+        allPassed &= suite.RunTest("GLTF Loader Accessor Decoding", TestGLTFLoaderAccessorDecoding);
         allPassed &= suite.RunTest("GLTF Loader with Real File", TestGLTFLoaderWithRealFile);
 
         // Print detailed summary
@@ -3,6 +3,7 @@
 #include "Resource/ModelLoader.h"
 #include "Graphics/Model.h"
 #include "Graphics/Mesh.h"
+#include "Graphics/Material.h"
 #include "Core/Logger.h"
 #include <filesystem>
 #include <chrono>
@@ -89,6 +90,142 @@ bool TestModelCacheBasicOperations() {
     return true;
 }
 
+bool TestModelCacheMeshDataRoundTrip() {
+    TestOutput::PrintTestStart("model cache mesh data round trip");
+
+    ModelCache cache;
+    EXPECT_TRUE(cache.Initialize("test_cache"));
+
+    auto model = std::make_shared<Model>("test_roundtrip.obj");
+    model->SetName("RoundTrip");
+
+    std::vector<std::shared_ptr<Mesh>> meshes;
+    for (int m = 0; m < 3; ++m) {
+        std::vector<Vertex> vertices(100 + m);
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            vertices[i].position = Math::Vec3(static_cast<float>(i), static_cast<float>(m), 0.0f);
+            vertices[i].texCoords = Math::Vec2(0.5f, static_cast<float>(i) / vertices.size());
+        }
+        std::vector<uint32_t> indices(3 * vertices.size());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            indices[i] = static_cast<uint32_t>((i * 7) % vertices.size());
+        }
+
+        auto mesh = std::make_shared<Mesh>("roundtrip_mesh_" + std::to_string(m));
+        mesh->SetName("roundtrip_mesh_" + std::to_string(m));
+        mesh->SetVertices(vertices);
+        mesh->SetIndices(indices);
+        mesh->SetMaterialIndex(static_cast<uint32_t>(m % 2));
+        meshes.push_back(mesh);
+    }
+    model->SetMeshes(meshes);
+
+    auto material = std::make_shared<Material>();
+    material->SetName("RoundTripMaterial");
+    material->SetMetallic(0.25f);
+    model->SetMaterials({material});
+
+    std::string testPath = "test_roundtrip.obj";
+    std::ofstream dummyFile(testPath);
+    dummyFile << "# Test OBJ file\n";
+    dummyFile.close();
+
+    EXPECT_TRUE(cache.SaveToCache(testPath, model));
+    auto cachedModel = cache.LoadFromCache(testPath);
+    EXPECT_NOT_NULL(cachedModel);
+
+    auto cachedMeshes = cachedModel->GetMeshes();
+    EXPECT_EQUAL(cachedMeshes.size(), meshes.size());
+    for (size_t m = 0; m < meshes.size(); ++m) {
+        EXPECT_EQUAL(cachedMeshes[m]->GetName(), meshes[m]->GetName());
+        EXPECT_EQUAL(cachedMeshes[m]->GetMaterialIndex(), meshes[m]->GetMaterialIndex());
+        EXPECT_TRUE(cachedMeshes[m]->GetVertices() == meshes[m]->GetVertices());
+        EXPECT_TRUE(cachedMeshes[m]->GetIndices() == meshes[m]->GetIndices());
+    }
+    EXPECT_EQUAL(cachedModel->GetMaterials().size(), static_cast<size_t>(1));
+    EXPECT_EQUAL(cachedModel->GetMaterials()[0]->GetName(), "RoundTripMaterial");
+    EXPECT_NEARLY_EQUAL(cachedModel->GetMaterials()[0]->GetMetallic(), 0.25f);
+
+    // A truncated cache file is rejected instead of read past its end
+    std::string cachePath = cache.GetCachePath(testPath);
+    std::filesystem::resize_file(cachePath, std::filesystem::file_size(cachePath) / 2);
+    EXPECT_NULL(cache.LoadFromCache(testPath));
+
+    std::filesystem::remove(testPath);
+    cache.Shutdown();
+    std::filesystem::remove_all("test_cache");
+
+    TestOutput::PrintTestPass("model cache mesh data round trip");
+    return true;
+}
+
+bool TestModelCacheCompactVertices() {
+    TestOutput::PrintTestStart("model cache compact vertices");
+
+    ModelCache cache;
+    EXPECT_TRUE(cache.Initialize("test_cache"));
+    cache.SetCompactVertices(true);
+
+    auto model = std::make_shared<Model>("test_compact.obj");
+    model->SetName("Compact");
+
+    std::vector<Vertex> vertices(64);
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        vertices[i].position = Math::Vec3(static_cast<float>(i), 1.0f, -2.0f);
+        vertices[i].normal = Math::Vec3(0.0f, 1.0f, 0.0f);
+        vertices[i].texCoords = Math::Vec2(0.25f, static_cast<float>(i) / vertices.size());
+    }
+    std::vector<uint32_t> indices = {0, 1, 2, 2, 3, 0};
+
+    // One mesh packed by its loader, one written as full vertices and packed by the cache
+    auto packedMesh = std::make_shared<Mesh>("packed_mesh");
+    packedMesh->SetName("packed_mesh");
+    packedMesh->SetVertices(vertices);
+    packedMesh->SetIndices(indices);
+    VertexFormatOptions options;
+    options.octahedralNormals = true;
+    packedMesh->PackVertices(options);
+
+    auto plainMesh = std::make_shared<Mesh>("plain_mesh");
+    plainMesh->SetName("plain_mesh");
+    plainMesh->SetVertices(vertices);
+    plainMesh->SetIndices(indices);
+    model->SetMeshes({packedMesh, plainMesh});
+
+    std::string testPath = "test_compact.obj";
+    std::ofstream dummyFile(testPath);
+    dummyFile << "# Test OBJ file\n";
+    dummyFile.close();
+
+    EXPECT_TRUE(cache.SaveToCache(testPath, model));
+    auto cachedModel = cache.LoadFromCache(testPath);
+    EXPECT_NOT_NULL(cachedModel);
+
+    auto cachedMeshes = cachedModel->GetMeshes();
+    EXPECT_EQUAL(cachedMeshes.size(), static_cast<size_t>(2));
+    EXPECT_TRUE(cachedMeshes[0]->IsPacked());
+    EXPECT_EQUAL(cachedMeshes[0]->GetVertexLayout().stride, packedMesh->GetVertexLayout().stride);
+    EXPECT_TRUE(cachedMeshes[0]->GetPackedVertexData() == packedMesh->GetPackedVertexData());
+
+    EXPECT_TRUE(cachedMeshes[1]->IsPacked());
+    EXPECT_TRUE(cachedMeshes[1]->GetVertexDataSize() < vertices.size() * sizeof(Vertex));
+    EXPECT_EQUAL(cachedMeshes[1]->GetVertexCount(), static_cast<uint32_t>(vertices.size()));
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        const Vertex vertex = cachedMeshes[1]->GetVertex(i);
+        EXPECT_TRUE(vertex.position == vertices[i].position);
+        EXPECT_TRUE(vertex.normal == vertices[i].normal);
+        EXPECT_NEARLY_EQUAL_EPSILON(vertex.texCoords.y, vertices[i].texCoords.y, 0.001f);
+    }
+    EXPECT_TRUE(cachedMeshes[1]->GetIndices() == indices);
+
+    std::filesystem::remove(testPath);
+    cache.Shutdown();
+    std::filesystem::remove_all("test_cache");
+
+    TestOutput::PrintTestPass("model cache compact vertices");
+    return true;
+}
+
 bool TestModelCacheVersionCompatibility() {
     TestOutput::PrintTestStart("model cache version compatibility");
 
@@ -253,6 +390,8 @@ int main() {
     try {
         suite.RunTest("Model Cache Initialization", TestModelCacheInitialization);
         suite.RunTest("Model Cache Basic Operations", TestModelCacheBasicOperations);
+        suite.RunTest("Model Cache Mesh Data Round Trip", TestModelCacheMeshDataRoundTrip);
+        suite.RunTest("Model Cache Compact Vertices", TestModelCacheCompactVertices);
         suite.RunTest("Model Cache Version Compatibility", TestModelCacheVersionCompatibility);
         suite.RunTest("Model Cache Statistics", TestModelCacheStatistics);
         suite.RunTest("Model Loader Cache Integration", TestModelLoaderCacheIntegration);
@@ -0,0 +1,245 @@
+#ifdef GAMEENGINE_HAS_BULLET
+
+#include "Physics/PhysicsEngine.h"
+#include "TestUtils.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr float STEP = 1.0f / 60.0f;
+
+    uint32_t CreateBox(PhysicsEngine& engine, const Math::Vec3& position, bool isStatic, const Math::Vec3& size = Math::Vec3(1.0f)) {
+        RigidBody desc;
+        desc.position = position;
+        desc.isStatic = isStatic;
+        desc.mass = 1.0f;
+        CollisionShape shape;
+        shape.type = CollisionShape::Box;
+        shape.dimensions = size;
+        return engine.CreateRigidBody(desc, shape);
+    }
+}
+
+/**
+ * Test that Update runs whole fixed steps, carries the remainder and caps the backlog
+ * Requirements: Fixed-timestep physics with interpolation alpha
+ */
+bool TestFixedStepAccumulation() {
+    TestOutput::PrintTestStart("fixed step accumulation");
+
+    PhysicsEngine engine;
+    EXPECT_TRUE(engine.Initialize());
+
+    // 10 ms frames against a 16.7 ms step: 6 frames hold 3 steps and 10 ms of remainder
+    for (int frame = 0; frame < 6; ++frame) {
+        engine.Update(0.010f);
+    }
+    EXPECT_EQUAL(engine.GetStepCount(), uint64_t(3));
+    EXPECT_NEARLY_EQUAL_EPSILON(engine.GetInterpolationAlpha(), 0.010f / STEP, 0.001f);
+
+    // A one second hitch runs maxSubSteps steps and drops the rest
+    engine.Update(1.0f);
+    EXPECT_EQUAL(engine.GetStepCount(), uint64_t(3 + engine.GetConfiguration().maxSubSteps));
+    EXPECT_TRUE(engine.GetInterpolationAlpha() >= 0.0f && engine.GetInterpolationAlpha() < 1.0f);
+
+    TestOutput::PrintTestPass("fixed step accumulation");
+    return true;
+}
+
+/**
+ * Test that interpolated transforms blend the last two steps by alpha
+ * Requirements: Render interpolation between fixed steps
+ */
+bool TestInterpolatedTransform() {
+    TestOutput::PrintTestStart("interpolated transform");
+
+    PhysicsEngine engine;
+    EXPECT_TRUE(engine.Initialize());
+    const uint32_t boxId = CreateBox(engine, Math::Vec3(0.0f, 10.0f, 0.0f), false);
+
+    Math::Vec3 position, interpolated;
+    Math::Quat rotation, interpolatedRotation;
+
+    // One full step: alpha 0 shows the pose the step started from
+    engine.Update(STEP);
+    EXPECT_TRUE(engine.GetRigidBodyTransform(boxId, position, rotation));
+    const float firstStepY = position.y;
+    EXPECT_TRUE(firstStepY < 10.0f);
+    EXPECT_TRUE(engine.GetInterpolatedTransform(boxId, interpolated, interpolatedRotation));
+    EXPECT_NEARLY_EQUAL_EPSILON(interpolated.y, 10.0f, 1e-5f);
+
+    // Half a step later, halfway between the two poses, with no new step
+    engine.Update(STEP * 0.5f);
+    EXPECT_EQUAL(engine.GetStepCount(), uint64_t(1));
+    EXPECT_TRUE(engine.GetInterpolatedTransform(boxId, interpolated, interpolatedRotation));
+    EXPECT_NEARLY_EQUAL_EPSILON(interpolated.y, (10.0f + firstStepY) * 0.5f, 1e-5f);
+    EXPECT_NEAR_QUAT(interpolatedRotation, rotation);
+
+    // The other half completes the second step
+    engine.Update(STEP * 0.5f);
+    EXPECT_EQUAL(engine.GetStepCount(), uint64_t(2));
+    EXPECT_TRUE(engine.GetInterpolatedTransform(boxId, interpolated, interpolatedRotation));
+    EXPECT_NEARLY_EQUAL_EPSILON(interpolated.y, firstStepY, 1e-5f);
+
+    // Teleports snap instead of blending
+    engine.SetRigidBodyTransform(boxId, Math::Vec3(5.0f, 20.0f, 0.0f), rotation);
+    EXPECT_TRUE(engine.GetInterpolatedTransform(boxId, interpolated, interpolatedRotation));
+    EXPECT_NEAR_VEC3(interpolated, Math::Vec3(5.0f, 20.0f, 0.0f));
+
+    TestOutput::PrintTestPass("interpolated transform");
+    return true;
+}
+
+/**
+ * Test that a force applied once per frame acts on every step of that frame
+ * Requirements: Fixed-timestep physics keeps force semantics across steps
+ */
+bool TestForcesAcrossSteps() {
+    TestOutput::PrintTestStart("forces across steps");
+
+    PhysicsConfiguration config = PhysicsConfiguration::Default();
+    config.gravity = Math::Vec3(0.0f);
+    PhysicsEngine engine;
+    EXPECT_TRUE(engine.Initialize(config));
+    const uint32_t boxId = CreateBox(engine, Math::Vec3(0.0f), false);
+
+    // 10 N on 1 kg for two steps
+    engine.ApplyForce(boxId, Math::Vec3(10.0f, 0.0f, 0.0f));
+    engine.Update(STEP * 2.0f);
+    EXPECT_EQUAL(engine.GetStepCount(), uint64_t(2));
+
+    Math::Vec3 velocity, angularVelocity;
+    EXPECT_TRUE(engine.GetRigidBodyVelocity(boxId, velocity, angularVelocity));
+    EXPECT_NEARLY_EQUAL_EPSILON(velocity.x, 10.0f * STEP * 2.0f, 1e-3f);
+
+    // Forces do not carry over to the next frame
+    engine.Update(STEP);
+    EXPECT_TRUE(engine.GetRigidBodyVelocity(boxId, velocity, angularVelocity));
+    EXPECT_NEARLY_EQUAL_EPSILON(velocity.x, 10.0f * STEP * 2.0f, 1e-3f);
+
+    TestOutput::PrintTestPass("forces across steps");
+    return true;
+}
+
+/**
+ * Test bulk transform sync: moving bodies only, sleeping bodies drop out after a final write,
+ * and per-body reads through a cached slot survive removals
+ * Requirements: Bulk SoA transform readback of active, moved bodies
+ */
+bool TestTransformSync() {
+    TestOutput::PrintTestStart("transform sync");
+
+    PhysicsEngine engine;
+    EXPECT_TRUE(engine.Initialize());
+    CreateBox(engine, Math::Vec3(0.0f, -0.5f, 0.0f), true, Math::Vec3(50.0f, 1.0f, 50.0f));
+
+    std::vector<uint32_t> boxIds;
+    for (int i = 0; i < 4; ++i) {
+        boxIds.push_back(CreateBox(engine, Math::Vec3(i * 3.0f, 2.0f, 0.0f), false));
+    }
+
+    // Slot hint of the last box; the removal below moves it into the freed slot
+    uint32_t lastSlot = PhysicsEngine::INVALID_MOTION_SLOT;
+    Math::Vec3 hintedPosition;
+    Math::Quat hintedRotation;
+    EXPECT_TRUE(engine.GetInterpolatedTransform(boxIds[3], lastSlot, hintedPosition, hintedRotation));
+    const uint32_t slotBeforeRemoval = lastSlot;
+
+    // Removing a body keeps the remaining ones addressable
+    engine.DestroyRigidBody(boxIds[1]);
+    boxIds.erase(boxIds.begin() + 1);
+
+    TransformSyncBuffer buffer;
+    engine.Update(STEP * 1.5f);
+    EXPECT_EQUAL(engine.SyncTransforms(buffer), size_t(3)); // Static ground excluded
+    std::vector<uint32_t> syncedIds = buffer.bodyIds;
+    std::sort(syncedIds.begin(), syncedIds.end());
+    EXPECT_TRUE(syncedIds == boxIds);
+
+    for (size_t i = 0; i < buffer.Size(); ++i) {
+        Math::Vec3 position;
+        Math::Quat rotation;
+        EXPECT_TRUE(engine.GetInterpolatedTransform(buffer.bodyIds[i], position, rotation));
+        EXPECT_NEAR_VEC3(buffer.positions[i], position);
+        EXPECT_NEAR_QUAT(buffer.rotations[i], rotation);
+    }
+
+    // A stale slot hint is refreshed and still resolves to the same body
+    EXPECT_TRUE(engine.GetInterpolatedTransform(boxIds.back(), lastSlot, hintedPosition, hintedRotation));
+    EXPECT_TRUE(lastSlot != slotBeforeRemoval);
+    Math::Vec3 position;
+    Math::Quat rotation;
+    EXPECT_TRUE(engine.GetInterpolatedTransform(boxIds.back(), position, rotation));
+    EXPECT_NEAR_VEC3(hintedPosition, position);
+    EXPECT_NEAR_QUAT(hintedRotation, rotation);
+
+    // Let the boxes land and fall asleep; the sync after that writes their final pose, then nothing
+    for (int frame = 0; frame < 360; ++frame) {
+        engine.Update(STEP);
+    }
+    engine.SyncTransforms(buffer);
+    engine.Update(STEP);
+    EXPECT_EQUAL(engine.SyncTransforms(buffer), size_t(0));
+    EXPECT_EQUAL(engine.SyncTransforms(buffer, false), size_t(3));
+
+    // Waking one box brings back just that one
+    engine.ApplyImpulse(boxIds[0], Math::Vec3(0.0f, 5.0f, 0.0f));
+    engine.Update(STEP);
+    EXPECT_EQUAL(engine.SyncTransforms(buffer), size_t(1));
+    EXPECT_EQUAL(buffer.bodyIds[0], boxIds[0]);
+
+    TestOutput::PrintTestPass("transform sync");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Physics Fixed Timestep");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Physics Fixed Timestep Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Fixed Step Accumulation", TestFixedStepAccumulation);
+        allPassed &= suite.RunTest("Interpolated Transform", TestInterpolatedTransform);
+        allPassed &= suite.RunTest("Forces Across Steps", TestForcesAcrossSteps);
+        allPassed &= suite.RunTest("Transform Sync", TestTransformSync);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
+
+#else
+
+#include "TestUtils.h"
+
+using namespace GameEngine::Testing;
+
+int main() {
+    TestOutput::PrintHeader("Physics Fixed Timestep");
+    TestOutput::PrintWarning("Bullet Physics not available - fixed timestep tests skipped");
+    TestOutput::PrintFooter(true);
+    return 0;
+}
+
+#endif // GAMEENGINE_HAS_BULLET
@@ -0,0 +1,138 @@
+#ifdef GAMEENGINE_HAS_BULLET
+
+#include "../TestUtils.h"
+#include "../../engine/core/Engine.h"
+#include "../../engine/core/JobSystem.h"
+#include "../../engine/interfaces/IGraphicsModule.h"
+#include "../../engine/interfaces/IPhysicsModule.h"
+#include "Physics/PhysicsEngine.h"
+#include "Core/Logger.h"
+#include <GLFW/glfw3.h>
+#include <vector>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+/**
+ * Test that the engine steps a multithreaded world from the "Physics" frame-graph job
+ * Requirements: Multithreaded Bullet world running on the engine JobSystem
+ */
+bool TestEngineStepsMultithreadedWorld() {
+    TestOutput::PrintTestStart("engine steps multithreaded world");
+
+    constexpr int FRAMES = 90;
+    constexpr int STACKS = 16;
+    constexpr int STACK_HEIGHT = 5;
+
+    Engine engine;
+    EXPECT_TRUE(engine.Initialize());
+    EXPECT_NOT_NULL(engine.GetJobSystem());
+
+    Physics::IPhysicsModule* physicsModule = engine.GetPhysicsModule();
+    EXPECT_NOT_NULL(physicsModule);
+
+    // The world takes its workers from the engine's job system through the physics module
+    PhysicsConfiguration config = PhysicsConfiguration::Default();
+    config.multithreadedSimulation = true;
+    auto world = physicsModule->CreateWorld(config);
+    EXPECT_NOT_NULL(world);
+    physicsModule->SetActiveWorld(world);
+
+    PhysicsEngine* physics = engine.GetPhysics();
+    EXPECT_NOT_NULL(physics);
+    EXPECT_TRUE(physics->GetSimulationThreadCount() > 1);
+
+    RigidBody groundDesc;
+    groundDesc.position = Math::Vec3(0.0f, -0.5f, 0.0f);
+    groundDesc.isStatic = true;
+    CollisionShape groundShape;
+    groundShape.type = CollisionShape::Box;
+    groundShape.dimensions = Math::Vec3(100.0f, 1.0f, 100.0f);
+    physics->CreateRigidBody(groundDesc, groundShape);
+
+    CollisionShape boxShape;
+    boxShape.type = CollisionShape::Box;
+    boxShape.dimensions = Math::Vec3(1.0f);
+
+    std::vector<uint32_t> topBoxes;
+    for (int stack = 0; stack < STACKS; ++stack) {
+        for (int level = 0; level < STACK_HEIGHT; ++level) {
+            RigidBody desc;
+            desc.position = Math::Vec3((stack % 4) * 3.0f, 0.5f + level * 1.01f, (stack / 4) * 3.0f);
+            const uint32_t id = physics->CreateRigidBody(desc, boxShape);
+            if (level == STACK_HEIGHT - 1) {
+                topBoxes.push_back(id);
+            }
+        }
+    }
+
+    // Run the real frame loop: physics is stepped by the "Physics" job on whichever thread takes it
+    GLFWwindow* window = static_cast<GLFWwindow*>(engine.GetGraphicsModule()->GetWindow());
+    int frames = 0;
+    engine.SetUpdateCallback([&](float) {
+        if (++frames == FRAMES) {
+            glfwSetWindowShouldClose(window, GLFW_TRUE);
+        }
+    });
+    engine.Run();
+
+    EXPECT_EQUAL(frames, FRAMES);
+    EXPECT_TRUE(physics->GetStepCount() > 0);
+
+    // Every stack settles in place instead of exploding or falling through the ground
+    for (uint32_t id : topBoxes) {
+        Math::Vec3 position;
+        Math::Quat rotation;
+        EXPECT_TRUE(physics->GetRigidBodyTransform(id, position, rotation));
+        EXPECT_IN_RANGE(position.y, (STACK_HEIGHT - 1) * 1.0f, STACK_HEIGHT * 1.01f);
+    }
+
+    engine.Shutdown();
+
+    TestOutput::PrintTestPass("engine steps multithreaded world");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Multithreaded Physics Frame Graph");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Multithreaded Physics Frame Graph Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Engine Steps Multithreaded World", TestEngineStepsMultithreadedWorld);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
+
+#else
+
+#include "../TestUtils.h"
+
+using namespace GameEngine::Testing;
+
+int main() {
+    TestOutput::PrintHeader("Multithreaded Physics Frame Graph");
+    TestOutput::PrintWarning("Bullet Physics not available - multithreaded frame graph test skipped");
+    TestOutput::PrintFooter(true);
+    return 0;
+}
+
+#endif // GAMEENGINE_HAS_BULLET
@@ -3,6 +3,9 @@
 #include "Core/Logger.h"
 #include <iostream>
 #include <cassert>
+#include <cmath>
+#include <thread>
+#include <vector>
 
 using namespace GameEngine;
 using namespace GameEngine::Testing;
@@ -169,6 +172,316 @@ bool TestOverlapSphere() {
     return true;
 }
 
+/**
+ * Test batched raycasts against single raycasts, filter masks and ignored bodies
+ * Requirements: Batched physics queries, collision filtering
+ */
+bool TestRaycastBatch() {
+    TestOutput::PrintTestStart("raycast batch");
+
+    PhysicsEngine engine;
+    if (!engine.Initialize()) {
+        TestOutput::PrintError("Failed to initialize physics engine");
+        return false;
+    }
+
+    // A row of static boxes and one dynamic box above the first; the world is never stepped
+    // so the dynamic box stays put
+    CollisionShape boxShape;
+    boxShape.type = CollisionShape::Box;
+    boxShape.dimensions = Math::Vec3(1.0f, 1.0f, 1.0f);
+
+    std::vector<uint32_t> bodyIds;
+    for (int i = 0; i < 8; ++i) {
+        RigidBody boxDesc;
+        boxDesc.position = Math::Vec3(static_cast<float>(i) * 3.0f, 0.0f, 0.0f);
+        boxDesc.isStatic = true;
+        bodyIds.push_back(engine.CreateRigidBody(boxDesc, boxShape));
+    }
+    RigidBody dynamicDesc;
+    dynamicDesc.position = Math::Vec3(0.0f, 4.0f, 0.0f);
+    uint32_t dynamicId = engine.CreateRigidBody(dynamicDesc, boxShape);
+    bodyIds.push_back(dynamicId);
+
+    // Downward rays over the row, most hitting a box and some falling between boxes
+    std::vector<RaycastQuery> queries;
+    for (int i = 0; i < 200; ++i) {
+        RaycastQuery query;
+        query.origin = Math::Vec3(static_cast<float>(i) * 0.12f - 1.0f, 10.0f, 0.3f * std::sin(static_cast<float>(i)));
+        query.direction = Math::Vec3(0.0f, -2.0f, 0.0f);
+        query.maxDistance = 20.0f;
+        queries.push_back(query);
+    }
+
+    std::vector<RaycastHit> hits(queries.size());
+    EXPECT_TRUE(engine.RaycastBatch(queries, hits));
+
+    int hitCount = 0;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        RaycastHit single = engine.Raycast(queries[i].origin, queries[i].direction, queries[i].maxDistance);
+        EXPECT_TRUE(hits[i].hasHit == single.hasHit);
+        if (single.hasHit) {
+            EXPECT_EQUAL(hits[i].bodyId, single.bodyId);
+            EXPECT_NEARLY_EQUAL_EPSILON(hits[i].distance, single.distance, 1e-4f);
+            EXPECT_NEAR_VEC3_EPSILON(hits[i].normal, single.normal, 1e-4f);
+            ++hitCount;
+        }
+    }
+    EXPECT_TRUE(hitCount > 0 && hitCount < static_cast<int>(queries.size()));
+    TestOutput::PrintInfo(std::to_string(hitCount) + "/" + std::to_string(queries.size()) + " rays hit, matching Raycast");
+
+    // The first ray hits the dynamic box; skipping it or masking out dynamic bodies reaches the static box below
+    RaycastQuery query = queries[10];
+    query.origin.x = 0.0f;
+    RaycastQuery ignoring = query;
+    ignoring.filter.ignoreBodyId = dynamicId;
+    RaycastQuery staticOnly = query;
+    staticOnly.filter.filterMask = 2;
+    RaycastQuery filtered[] = { query, ignoring, staticOnly };
+    RaycastHit filteredHits[3];
+    EXPECT_TRUE(engine.RaycastBatch(filtered, filteredHits));
+    EXPECT_EQUAL(filteredHits[0].bodyId, dynamicId);
+    EXPECT_EQUAL(filteredHits[1].bodyId, bodyIds[0]);
+    EXPECT_EQUAL(filteredHits[2].bodyId, bodyIds[0]);
+
+    // Too small a result buffer is rejected
+    EXPECT_FALSE(engine.RaycastBatch(queries, std::span<RaycastHit>(hits.data(), 10)));
+
+    for (uint32_t bodyId : bodyIds) {
+        engine.DestroyRigidBody(bodyId);
+    }
+    engine.Shutdown();
+
+    TestOutput::PrintTestPass("raycast batch");
+    return true;
+}
+
+/**
+ * Test batched capsule and sphere sweeps against SweepCapsule
+ * Requirements: Batched physics queries, character controller sweeps
+ */
+bool TestSweepBatch() {
+    TestOutput::PrintTestStart("sweep batch");
+
+    PhysicsEngine engine;
+    if (!engine.Initialize()) {
+        TestOutput::PrintError("Failed to initialize physics engine");
+        return false;
+    }
+
+    RigidBody wallDesc;
+    wallDesc.position = Math::Vec3(5.0f, 0.0f, 0.0f);
+    wallDesc.isStatic = true;
+    CollisionShape wallShape;
+    wallShape.type = CollisionShape::Box;
+    wallShape.dimensions = Math::Vec3(0.5f, 4.0f, 4.0f);
+    uint32_t wallId = engine.CreateRigidBody(wallDesc, wallShape);
+
+    std::vector<SweepQuery> queries;
+    for (int i = 0; i < 64; ++i) {
+        SweepQuery query;
+        query.from = Math::Vec3(0.0f, 0.0f, static_cast<float>(i) * 0.2f - 6.0f);
+        query.to = query.from + Math::Vec3(10.0f, 0.0f, 0.0f);
+        query.radius = 0.4f;
+        query.height = 1.0f;
+        queries.push_back(query);
+    }
+
+    std::vector<PhysicsEngine::SweepHit> hits(queries.size());
+    EXPECT_TRUE(engine.SweepBatch(queries, hits));
+
+    int hitCount = 0;
+    for (size_t i = 0; i < queries.size(); ++i) {
+        PhysicsEngine::SweepHit single = engine.SweepCapsule(queries[i].from, queries[i].to, queries[i].radius, queries[i].height);
+        EXPECT_TRUE(hits[i].hasHit == single.hasHit);
+        if (single.hasHit) {
+            EXPECT_EQUAL(hits[i].bodyId, wallId);
+            EXPECT_NEARLY_EQUAL_EPSILON(hits[i].fraction, single.fraction, 1e-4f);
+            ++hitCount;
+        }
+    }
+    EXPECT_TRUE(hitCount > 0 && hitCount < static_cast<int>(queries.size()));
+
+    // A sphere sweep stops its radius short of the wall face at x = 4.75
+    SweepQuery sphereQuery;
+    sphereQuery.from = Math::Vec3(0.0f, 0.0f, 0.0f);
+    sphereQuery.to = Math::Vec3(10.0f, 0.0f, 0.0f);
+    sphereQuery.radius = 0.5f;
+    PhysicsEngine::SweepHit sphereHit;
+    EXPECT_TRUE(engine.SweepBatch(std::span<const SweepQuery>(&sphereQuery, 1), std::span<PhysicsEngine::SweepHit>(&sphereHit, 1)));
+    EXPECT_TRUE(sphereHit.hasHit);
+    EXPECT_NEARLY_EQUAL_EPSILON(sphereHit.distance, 4.25f, 0.05f);
+    TestOutput::PrintInfo(std::to_string(hitCount) + "/" + std::to_string(queries.size()) +
+                          " capsule sweeps hit, sphere sweep stopped at " + StringUtils::FormatFloat(sphereHit.distance));
+
+    engine.DestroyRigidBody(wallId);
+    engine.Shutdown();
+
+    TestOutput::PrintTestPass("sweep batch");
+    return true;
+}
+
+/**
+ * Test batched sphere overlaps, including result truncation
+ * Requirements: Batched physics queries, collision detection
+ */
+bool TestOverlapBatch() {
+    TestOutput::PrintTestStart("overlap batch");
+
+    PhysicsEngine engine;
+    if (!engine.Initialize()) {
+        TestOutput::PrintError("Failed to initialize physics engine");
+        return false;
+    }
+
+    CollisionShape boxShape;
+    boxShape.type = CollisionShape::Box;
+    boxShape.dimensions = Math::Vec3(1.0f, 1.0f, 1.0f);
+
+    // Same layout as the single overlap test: two boxes near the origin, one far away
+    std::vector<uint32_t> bodyIds;
+    for (float x : { 0.0f, 1.5f, 10.0f }) {
+        RigidBody boxDesc;
+        boxDesc.position = Math::Vec3(x, 0.0f, 0.0f);
+        boxDesc.isStatic = true;
+        bodyIds.push_back(engine.CreateRigidBody(boxDesc, boxShape));
+    }
+
+    OverlapQuery queries[3];
+    queries[0].center = Math::Vec3(0.0f, 0.0f, 0.0f);
+    queries[0].radius = 3.0f;
+    queries[1].center = Math::Vec3(10.0f, 0.0f, 0.0f);
+    queries[1].radius = 1.0f;
+    queries[2].center = Math::Vec3(0.0f, 20.0f, 0.0f);
+    queries[2].radius = 1.0f;
+
+    const uint32_t maxResults = 4;
+    std::vector<OverlapResult> results(3 * maxResults);
+    uint32_t counts[3] = {};
+    EXPECT_TRUE(engine.OverlapBatch(queries, results, counts, maxResults));
+    EXPECT_EQUAL(counts[0], 2u);
+    EXPECT_EQUAL(counts[1], 1u);
+    EXPECT_EQUAL(counts[2], 0u);
+
+    bool foundBox1 = false, foundBox2 = false;
+    for (uint32_t i = 0; i < counts[0]; ++i) {
+        foundBox1 |= results[i].bodyId == bodyIds[0];
+        foundBox2 |= results[i].bodyId == bodyIds[1];
+        EXPECT_TRUE(results[i].penetrationDepth <= 0.0f);
+    }
+    EXPECT_TRUE(foundBox1 && foundBox2);
+    EXPECT_EQUAL(results[maxResults].bodyId, bodyIds[2]);
+
+    // With room for one result per query the count still reports every overlapping body
+    std::vector<OverlapResult> single(3);
+    EXPECT_TRUE(engine.OverlapBatch(queries, single, counts, 1));
+    EXPECT_EQUAL(counts[0], 2u);
+    EXPECT_EQUAL(single[1].bodyId, bodyIds[2]);
+
+    // Ignoring a body removes it from the results
+    queries[0].filter.ignoreBodyId = bodyIds[0];
+    EXPECT_TRUE(engine.OverlapBatch(queries, results, counts, maxResults));
+    EXPECT_EQUAL(counts[0], 1u);
+    EXPECT_EQUAL(results[0].bodyId, bodyIds[1]);
+
+    for (uint32_t bodyId : bodyIds) {
+        engine.DestroyRigidBody(bodyId);
+    }
+    engine.Shutdown();
+
+    TestOutput::PrintTestPass("overlap batch");
+    return true;
+}
+
+/**
+ * Test batches issued from several threads at once against the same engine
+ * Requirements: Batched physics queries, thread-safe query scratch
+ */
+bool TestConcurrentBatches() {
+    TestOutput::PrintTestStart("concurrent batches");
+
+    constexpr int THREADS = 4;
+    constexpr int ROUNDS = 20;
+
+    PhysicsEngine engine;
+    if (!engine.Initialize()) {
+        TestOutput::PrintError("Failed to initialize physics engine");
+        return false;
+    }
+
+    CollisionShape boxShape;
+    boxShape.type = CollisionShape::Box;
+    boxShape.dimensions = Math::Vec3(1.0f, 1.0f, 1.0f);
+
+    std::vector<uint32_t> bodyIds;
+    for (int z = 0; z < 8; ++z) {
+        for (int x = 0; x < 8; ++x) {
+            RigidBody boxDesc;
+            boxDesc.position = Math::Vec3(static_cast<float>(x) * 2.0f, 0.0f, static_cast<float>(z) * 2.0f);
+            boxDesc.isStatic = true;
+            bodyIds.push_back(engine.CreateRigidBody(boxDesc, boxShape));
+        }
+    }
+
+    // Enough queries per batch that every batch splits into several chunks
+    std::vector<OverlapQuery> overlaps(1024);
+    std::vector<RaycastQuery> rays(1024);
+    for (size_t i = 0; i < overlaps.size(); ++i) {
+        const float x = static_cast<float>(i % 32) * 0.5f;
+        const float z = static_cast<float>(i / 32) * 0.5f;
+        overlaps[i].center = Math::Vec3(x, 0.0f, z);
+        overlaps[i].radius = 0.6f;
+        rays[i].origin = Math::Vec3(x, 5.0f, z);
+        rays[i].direction = Math::Vec3(0.0f, -1.0f, 0.0f);
+        rays[i].maxDistance = 10.0f;
+    }
+
+    const uint32_t maxResults = 4;
+    std::vector<OverlapResult> expectedResults(overlaps.size() * maxResults);
+    std::vector<uint32_t> expectedCounts(overlaps.size());
+    std::vector<RaycastHit> expectedHits(rays.size());
+    EXPECT_TRUE(engine.OverlapBatch(overlaps, expectedResults, expectedCounts, maxResults));
+    EXPECT_TRUE(engine.RaycastBatch(rays, expectedHits));
+
+    std::vector<int> mismatches(THREADS, 0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            std::vector<OverlapResult> results(overlaps.size() * maxResults);
+            std::vector<uint32_t> counts(overlaps.size());
+            std::vector<RaycastHit> hits(rays.size());
+            for (int round = 0; round < ROUNDS; ++round) {
+                if (!engine.OverlapBatch(overlaps, results, counts, maxResults) || counts != expectedCounts) {
+                    ++mismatches[t];
+                }
+                if (!engine.RaycastBatch(rays, hits)) {
+                    ++mismatches[t];
+                }
+                for (size_t i = 0; i < hits.size(); ++i) {
+                    if (hits[i].hasHit != expectedHits[i].hasHit || hits[i].bodyId != expectedHits[i].bodyId) {
+                        ++mismatches[t];
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int t = 0; t < THREADS; ++t) {
+        EXPECT_EQUAL(mismatches[t], 0);
+    }
+
+    for (uint32_t bodyId : bodyIds) {
+        engine.DestroyRigidBody(bodyId);
+    }
+    engine.Shutdown();
+
+    TestOutput::PrintTestPass("concurrent batches");
+    return true;
+}
+
 int main() {
     TestOutput::PrintHeader("Physics Queries Integration");
 
@@ -181,6 +494,10 @@ int main() {
         // Run all tests
         allPassed &= suite.RunTest("Raycast Functionality", TestRaycast);
         allPassed &= suite.RunTest("Overlap Sphere Functionality", TestOverlapSphere);
+        allPassed &= suite.RunTest("Raycast Batch", TestRaycastBatch);
+        allPassed &= suite.RunTest("Sweep Batch", TestSweepBatch);
+        allPassed &= suite.RunTest("Overlap Batch", TestOverlapBatch);
+        allPassed &= suite.RunTest("Concurrent Batches", TestConcurrentBatches);
 
         // Print detailed summary
         suite.PrintSummary();
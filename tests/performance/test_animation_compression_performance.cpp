@@ -0,0 +1,212 @@
+/**
+ * Animation Compression Performance Tests
+ *
+ * Error-vs-size report for bit-packed QuantizedAnimation clips over the sample
+ * assets (when the importer can load them) and synthetic locomotion clips, plus
+ * decode throughput compared with sampling the keyframe tracks.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include <filesystem>
+#include "TestUtils.h"
+#include "Animation/QuantizedAnimation.h"
+#include "Animation/AnimationCompression.h"
+#include "Animation/AnimationImporter.h"
+#include "Animation/IndexedPose.h"
+#include "Animation/AnimationSkeleton.h"
+#include "Animation/SkeletalAnimation.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+using namespace GameEngine::Animation;
+
+namespace {
+    struct ReportClip {
+        std::string source;
+        std::shared_ptr<AnimationSkeleton> skeleton;
+        std::shared_ptr<SkeletalAnimation> animation;
+    };
+
+    ReportClip CreateSyntheticClip(const std::string& name, int boneCount, float duration, float amplitude) {
+        ReportClip clip;
+        clip.source = "synthetic";
+        clip.skeleton = std::make_shared<AnimationSkeleton>(name + "Skeleton");
+        clip.animation = std::make_shared<SkeletalAnimation>(name);
+        clip.animation->SetDuration(duration);
+        clip.animation->SetFrameRate(30.0f);
+
+        for (int i = 0; i < boneCount; ++i) {
+            const std::string boneName = "Bone_" + std::to_string(i);
+            clip.skeleton->CreateBone(boneName, glm::translate(Math::Mat4(1.0f), Math::Vec3(0.0f, 0.1f, 0.0f)));
+            if (i > 0) {
+                clip.skeleton->SetBoneParent(boneName, "Bone_" + std::to_string(i - 1));
+            }
+
+            // Like exported mocap: every bone keyed every frame, most of them barely moving
+            for (int frame = 0; frame <= static_cast<int>(duration * 30.0f); ++frame) {
+                float time = frame / 30.0f;
+                float angle = std::sin(time * Math::TWO_PI + i * 0.3f) * amplitude * (i % 3 == 0 ? 1.0f : 0.0f);
+                clip.animation->AddRotationKeyframe(boneName, time, glm::angleAxis(angle, Math::Vec3(1.0f, 0.0f, 0.0f)));
+                clip.animation->AddPositionKeyframe(boneName, time,
+                    i == 0 ? Math::Vec3(time * 1.4f, std::abs(std::sin(time * 6.0f)) * 0.05f, 0.0f) : Math::Vec3(0.0f, 0.1f, 0.0f));
+                clip.animation->AddScaleKeyframe(boneName, time, Math::Vec3(1.0f));
+            }
+        }
+        return clip;
+    }
+
+    std::vector<ReportClip> LoadReportClips() {
+        std::vector<ReportClip> clips;
+
+        AnimationImporter importer;
+        const std::vector<std::string> assets = {
+            "assets/meshes/Idle.fbx",
+            "assets/GLTF/Fox/glTF/Fox.gltf",
+            "assets/GLTF/RiggedFigure/glTF/RiggedFigure.gltf"
+        };
+        for (const auto& path : assets) {
+            if (!std::filesystem::exists(path)) {
+                continue;
+            }
+            AnimationImportResult result = importer.ImportFromFile(path);
+            if (!result.success || !result.skeleton) {
+                TestOutput::PrintInfo("Skipping " + path + " (not importable in this build)");
+                continue;
+            }
+            for (const auto& animation : result.animations) {
+                if (animation && !animation->IsEmpty()) {
+                    clips.push_back({path, result.skeleton, animation});
+                }
+            }
+        }
+
+        clips.push_back(CreateSyntheticClip("Walk", 65, 1.0f, 0.6f));
+        clips.push_back(CreateSyntheticClip("Cinematic", 120, 10.0f, 1.2f));
+        return clips;
+    }
+}
+
+/**
+ * Report compressed size and reconstruction error per clip and bit depth
+ * Requirements: 5-10x smaller clips with bounded error
+ */
+bool TestCompressionErrorVsSizeReport() {
+    TestOutput::PrintTestStart("compression error vs size report");
+
+    std::vector<ReportClip> clips = LoadReportClips();
+    const int bitDepths[] = {16, 12, 10};
+
+    size_t totalOriginal = 0;
+    size_t totalCompressed = 0;
+    for (const auto& clip : clips) {
+        auto layout = PoseLayout::Create(*clip.skeleton);
+        TestOutput::PrintInfo(clip.animation->GetName() + " [" + clip.source + "], " +
+                              std::to_string(layout->GetBoneCount()) + " bones, " +
+                              StringUtils::FormatFloat(clip.animation->GetDuration(), 2) + "s");
+
+        for (int bits : bitDepths) {
+            CompressionSettings settings;
+            settings.positionBits = bits;
+            settings.scaleBits = bits;
+            settings.rotationBits = std::min(bits, 15);
+
+            auto quantized = QuantizedAnimation::Create(*clip.animation, layout, settings);
+            QuantizationReport report = quantized->Measure(*clip.animation, layout);
+
+            TestOutput::PrintInfo("  " + std::to_string(bits) + " bits: " +
+                std::to_string(report.originalBytes / 1024) + " KB -> " + std::to_string(report.compressedBytes / 1024) + " KB (" +
+                StringUtils::FormatFloat(report.compressionRatio, 1) + "x), tracks " +
+                std::to_string(report.animatedTracks) + " animated / " + std::to_string(report.constantTracks) + " constant, max error pos " +
+                StringUtils::FormatFloat(report.maxPositionError, 5) + " rot " +
+                StringUtils::FormatFloat(report.maxRotationError, 5) + " rad scale " +
+                StringUtils::FormatFloat(report.maxScaleError, 5));
+
+            if (bits == 16) {
+                totalOriginal += report.originalBytes;
+                totalCompressed += report.compressedBytes;
+            }
+        }
+    }
+
+    const float overallRatio = totalCompressed > 0 ? static_cast<float>(totalOriginal) / static_cast<float>(totalCompressed) : 0.0f;
+    TestOutput::PrintInfo("Overall at 16 bits: " + StringUtils::FormatFloat(overallRatio, 1) + "x smaller");
+
+    if (overallRatio >= 5.0f) {
+        TestOutput::PrintTestPass("compression error vs size report");
+        return true;
+    }
+
+    TestOutput::PrintTestFail("compression error vs size report", ">= 5x smaller", StringUtils::FormatFloat(overallRatio, 1) + "x");
+    return false;
+}
+
+/**
+ * Test decoding from the packed stream versus sampling keyframe tracks
+ * Requirements: sampling directly from the packed stream without full decompression
+ */
+bool TestQuantizedDecodePerformance() {
+    TestOutput::PrintTestStart("quantized decode");
+
+    ReportClip clip = CreateSyntheticClip("Walk", 65, 1.0f, 0.6f);
+    auto layout = PoseLayout::Create(*clip.skeleton);
+    auto quantized = QuantizedAnimation::Create(*clip.animation, layout);
+    AnimationBinding binding = AnimationBinding::Create(*clip.animation, *layout);
+
+    const int samples = 2000;
+    IndexedPose pose(layout);
+    AnimationCursor cursor;
+
+    TestTimer trackTimer;
+    for (int i = 0; i < samples; ++i) {
+        PoseEvaluator::EvaluateAnimation(*clip.animation, binding, i * 0.0137f, cursor, pose);
+    }
+    double trackTime = trackTimer.ElapsedMs();
+
+    TestTimer decodeTimer;
+    for (int i = 0; i < samples; ++i) {
+        quantized->Sample(clip.animation->WrapTime(i * 0.0137f), pose);
+    }
+    double decodeTime = decodeTimer.ElapsedMs();
+
+    TestOutput::PrintTiming("keyframe track sampling", trackTime, samples);
+    TestOutput::PrintTiming("quantized stream sampling", decodeTime, samples);
+
+    TestOutput::PrintTestPass("quantized decode");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Animation Compression Performance");
+
+    // Import and bone creation log at info level; keep the report readable
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Animation Compression Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Compression Error Vs Size Report", TestCompressionErrorVsSizeReport);
+        allPassed &= suite.RunTest("Quantized Decode Performance", TestQuantizedDecodePerformance);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
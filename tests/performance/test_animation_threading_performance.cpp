@@ -0,0 +1,234 @@
+/**
+ * Animation Threading Performance Tests
+ *
+ * Core scaling of the work-stealing AnimationThreadPool from one thread up to the
+ * hardware thread count: crowd pose sampling through ParallelFor, and the
+ * MultiThreadedAnimationManager batched update compared with future-per-batch submission.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <thread>
+#include "TestUtils.h"
+#include "Animation/AnimationThreading.h"
+#include "Animation/AnimationController.h"
+#include "Animation/IndexedPose.h"
+#include "Animation/Pose.h"
+#include "Animation/AnimationSkeleton.h"
+#include "Animation/SkeletalAnimation.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+using namespace GameEngine::Animation;
+
+namespace {
+    constexpr int BONE_COUNT = 60;
+    constexpr size_t INSTANCE_COUNT = 2048;
+    constexpr int FRAME_COUNT = 20;
+
+    std::shared_ptr<AnimationSkeleton> CreateBenchmarkSkeleton() {
+        auto skeleton = std::make_shared<AnimationSkeleton>("CrowdSkeleton");
+        for (int i = 0; i < BONE_COUNT; ++i) {
+            skeleton->CreateBone("Bone_" + std::to_string(i), glm::translate(Math::Mat4(1.0f), Math::Vec3(0.0f, 0.1f, 0.0f)));
+            if (i > 0) {
+                skeleton->SetBoneParent("Bone_" + std::to_string(i), "Bone_" + std::to_string(i - 1));
+            }
+        }
+        return skeleton;
+    }
+
+    std::shared_ptr<SkeletalAnimation> CreateBenchmarkAnimation() {
+        auto animation = std::make_shared<SkeletalAnimation>("Walk");
+        animation->SetDuration(1.0f);
+        for (int i = 0; i < BONE_COUNT; ++i) {
+            const std::string boneName = "Bone_" + std::to_string(i);
+            for (int key = 0; key <= 30; ++key) {
+                float time = key / 30.0f;
+                float angle = std::sin((time + i * 0.05f) * Math::TWO_PI) * 0.3f;
+                animation->AddRotationKeyframe(boneName, time, glm::angleAxis(angle, Math::Vec3(0.0f, 0.0f, 1.0f)));
+            }
+        }
+        return animation;
+    }
+
+    // 1, 2, 4, ... up to the hardware thread count (always included)
+    std::vector<size_t> GetThreadCounts() {
+        const size_t hardwareThreads = std::max<size_t>(1, std::thread::hardware_concurrency());
+        std::vector<size_t> counts;
+        for (size_t count = 1; count < hardwareThreads; count *= 2) {
+            counts.push_back(count);
+        }
+        counts.push_back(hardwareThreads);
+        return counts;
+    }
+
+    // Pool worker count for a core count; the submitting thread works while it waits
+    size_t GetWorkerCount(size_t cores) {
+        return std::max<size_t>(1, cores - 1);
+    }
+}
+
+/**
+ * Test crowd pose sampling across 1..N cores
+ * Requirements: work-stealing pool scales with core count at 2k+ instances
+ */
+bool TestCrowdSamplingScaling() {
+    TestOutput::PrintTestStart("crowd sampling scaling");
+
+    auto skeleton = CreateBenchmarkSkeleton();
+    auto layout = PoseLayout::Create(*skeleton);
+    auto animation = CreateBenchmarkAnimation();
+    const AnimationBinding binding = AnimationBinding::Create(*animation, *layout);
+
+    std::vector<IndexedPose> poses(INSTANCE_COUNT, IndexedPose(layout));
+    std::vector<AnimationCursor> cursors(INSTANCE_COUNT);
+    std::vector<float> times(INSTANCE_COUNT);
+    for (size_t i = 0; i < INSTANCE_COUNT; ++i) {
+        times[i] = static_cast<float>(i % 97) / 97.0f;
+    }
+
+    double singleCoreTime = 0.0;
+    for (size_t cores : GetThreadCounts()) {
+        AnimationThreadPool threadPool;
+        AnimationThreadConfig config;
+        config.numThreads = GetWorkerCount(cores);
+        EXPECT_TRUE(threadPool.Initialize(config));
+
+        auto sampleRange = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                times[i] = animation->WrapTime(times[i] + 0.016f);
+                PoseEvaluator::EvaluateAnimation(*animation, binding, times[i], cursors[i], poses[i]);
+            }
+        };
+
+        TestTimer timer;
+        for (int frame = 0; frame < FRAME_COUNT; ++frame) {
+            if (cores == 1) {
+                sampleRange(0, INSTANCE_COUNT);
+            } else {
+                threadPool.ParallelFor(INSTANCE_COUNT, 32, sampleRange);
+            }
+        }
+        double elapsed = timer.ElapsedMs();
+        if (cores == 1) {
+            singleCoreTime = elapsed;
+        }
+
+        TestOutput::PrintTiming(std::to_string(cores) + " core(s), " + std::to_string(INSTANCE_COUNT) + " instances",
+                                elapsed, FRAME_COUNT);
+        TestOutput::PrintInfo("  speedup " + StringUtils::FormatFloat(static_cast<float>(singleCoreTime / std::max(elapsed, 0.001)), 2) + "x");
+
+        threadPool.Shutdown();
+    }
+
+    TestOutput::PrintTestPass("crowd sampling scaling");
+    return true;
+}
+
+/**
+ * Test the batched manager update against future-per-batch submission
+ * Requirements: no per-task futures or global queue lock on the per-instance path
+ */
+bool TestBatchedUpdateScaling() {
+    TestOutput::PrintTestStart("batched update scaling");
+
+    auto skeleton = CreateBenchmarkSkeleton();
+    auto animation = CreateBenchmarkAnimation();
+
+    std::vector<std::shared_ptr<AnimationController>> controllers;
+    controllers.reserve(INSTANCE_COUNT);
+    for (size_t i = 0; i < INSTANCE_COUNT; ++i) {
+        auto controller = std::make_shared<AnimationController>();
+        EXPECT_TRUE(controller->Initialize(skeleton));
+        controller->AddAnimation("Walk", animation);
+        controller->Play("Walk", 0.0f);
+        controllers.push_back(controller);
+    }
+
+    const size_t batchSize = 8;
+    for (size_t cores : GetThreadCounts()) {
+        AnimationThreadConfig config;
+        config.numThreads = GetWorkerCount(cores);
+        config.maxQueueSize = INSTANCE_COUNT;
+
+        // Counter-based range submission through the manager
+        MultiThreadedAnimationManager manager;
+        EXPECT_TRUE(manager.Initialize(config));
+        for (const auto& controller : controllers) {
+            manager.RegisterAnimationController(controller);
+        }
+
+        TestTimer batchedTimer;
+        for (int frame = 0; frame < FRAME_COUNT; ++frame) {
+            manager.UpdateAnimationsBatched(0.016f, batchSize);
+            manager.WaitForAnimationUpdates();
+        }
+        double batchedTime = batchedTimer.ElapsedMs();
+        manager.Shutdown();
+
+        // One future per batch, as the manager used to submit
+        AnimationThreadPool threadPool;
+        EXPECT_TRUE(threadPool.Initialize(config));
+
+        TestTimer futureTimer;
+        for (int frame = 0; frame < FRAME_COUNT; ++frame) {
+            std::vector<std::future<void>> futures;
+            for (size_t i = 0; i < controllers.size(); i += batchSize) {
+                AnimationBatch batch;
+                batch.deltaTime = 0.016f;
+                const size_t end = std::min(i + batchSize, controllers.size());
+                batch.controllers.assign(controllers.begin() + i, controllers.begin() + end);
+                futures.push_back(threadPool.SubmitBatch(batch));
+            }
+            for (auto& future : futures) {
+                future.wait();
+            }
+        }
+        double futureTime = futureTimer.ElapsedMs();
+        threadPool.Shutdown();
+
+        TestOutput::PrintInfo(std::to_string(cores) + " core(s): counter ranges " +
+                              StringUtils::FormatFloat(static_cast<float>(batchedTime / FRAME_COUNT), 3) + " ms/frame, futures " +
+                              StringUtils::FormatFloat(static_cast<float>(futureTime / FRAME_COUNT), 3) + " ms/frame");
+    }
+
+    TestOutput::PrintTestPass("batched update scaling");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Animation Threading Performance");
+
+    // Controller and pool setup log at info level; keep the report readable
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Animation Threading Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Crowd Sampling Scaling", TestCrowdSamplingScaling);
+        allPassed &= suite.RunTest("Batched Update Scaling", TestBatchedUpdateScaling);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
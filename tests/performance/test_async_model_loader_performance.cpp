@@ -0,0 +1,186 @@
+/**
+ * Async Model Loader Performance Tests
+ *
+ * Time-to-first-model for critical loads issued while a 500-asset background stream is
+ * queued: critical loads submitted at critical priority against the same loads submitted
+ * at background priority, which is what the previous first-in-first-out queue gave them.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include "TestUtils.h"
+#include "Resource/AsyncModelLoader.h"
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr int BACKGROUND_ASSET_COUNT = 500;
+    constexpr int CRITICAL_ASSET_COUNT = 8;
+    constexpr int GRID_SIZE = 24;
+    constexpr uint32_t MAX_CONCURRENT_LOADS = 4;
+    constexpr auto CRITICAL_SPACING = std::chrono::milliseconds(5);
+
+    const std::string ASSET_DIRECTORY = "perf_async_loader_assets";
+
+    void WriteGridModel(const std::string& path) {
+        std::ofstream file(path);
+        for (int y = 0; y < GRID_SIZE; ++y) {
+            for (int x = 0; x < GRID_SIZE; ++x) {
+                file << "v " << x << " 0 " << y << "\n";
+            }
+        }
+        for (int y = 0; y + 1 < GRID_SIZE; ++y) {
+            for (int x = 0; x + 1 < GRID_SIZE; ++x) {
+                int i = y * GRID_SIZE + x + 1;
+                file << "f " << i << " " << i + GRID_SIZE << " " << i + 1 << "\n";
+                file << "f " << i + 1 << " " << i + GRID_SIZE << " " << i + GRID_SIZE + 1 << "\n";
+            }
+        }
+    }
+
+    std::string GetAssetPath(const std::string& prefix, int index) {
+        return ASSET_DIRECTORY + "/" + prefix + "_" + std::to_string(index) + ".obj";
+    }
+
+    struct StreamResult {
+        double averageCriticalMs = 0.0;
+        double maxCriticalMs = 0.0;
+        double totalMs = 0.0;
+        AsyncModelLoader::PriorityLatencyStats backgroundLatency;
+        bool allLoaded = false;
+    };
+
+    // Queues the background stream, then issues the critical loads a few milliseconds apart
+    StreamResult RunStream(AsyncModelLoader::TaskPriority criticalPriority) {
+        using Clock = std::chrono::steady_clock;
+        StreamResult result;
+
+        JobSystem jobSystem;
+        jobSystem.Initialize(JobSystemConfig{MAX_CONCURRENT_LOADS, MAX_CONCURRENT_LOADS});
+
+        AsyncModelLoader loader;
+        loader.SetJobSystem(&jobSystem);
+        if (!loader.Initialize()) {
+            return result;
+        }
+        loader.SetMaxConcurrentLoads(MAX_CONCURRENT_LOADS);
+
+        std::mutex timesMutex;
+        std::unordered_map<std::string, Clock::time_point> completionTimes;
+        loader.SetProgressCallback([&](const std::string& filepath, float, const std::string& stage) {
+            if (stage == "Complete") {
+                std::lock_guard<std::mutex> lock(timesMutex);
+                completionTimes[filepath] = Clock::now();
+            }
+        });
+
+        auto flags = ModelLoader::LoadingFlags::None;
+        std::vector<std::future<std::shared_ptr<Model>>> futures;
+        TestTimer timer;
+        for (int i = 0; i < BACKGROUND_ASSET_COUNT; ++i) {
+            futures.push_back(loader.LoadModelAsync(GetAssetPath("background", i), flags, AsyncModelLoader::TaskPriority::Low));
+        }
+
+        std::vector<std::pair<std::string, Clock::time_point>> criticalSubmits;
+        for (int i = 0; i < CRITICAL_ASSET_COUNT; ++i) {
+            std::this_thread::sleep_for(CRITICAL_SPACING);
+            std::string path = GetAssetPath("critical", i);
+            criticalSubmits.emplace_back(path, Clock::now());
+            futures.push_back(loader.LoadModelAsync(path, flags, criticalPriority));
+        }
+
+        result.allLoaded = true;
+        for (auto& future : futures) {
+            result.allLoaded &= future.get() != nullptr;
+        }
+        result.totalMs = timer.ElapsedMs();
+
+        std::lock_guard<std::mutex> lock(timesMutex);
+        for (const auto& submit : criticalSubmits) {
+            double latencyMs = std::chrono::duration<double, std::milli>(completionTimes[submit.first] - submit.second).count();
+            result.averageCriticalMs += latencyMs / CRITICAL_ASSET_COUNT;
+            result.maxCriticalMs = std::max(result.maxCriticalMs, latencyMs);
+        }
+        result.backgroundLatency = loader.GetLatencyStats(AsyncModelLoader::TaskPriority::Low);
+
+        loader.Shutdown();
+        jobSystem.Shutdown();
+        return result;
+    }
+}
+
+/**
+ * Test critical load latency under a large background stream
+ * Requirements: priority scheduling with aging keeps time-to-first-model low for critical loads
+ */
+bool TestCriticalLatencyUnderBackgroundStream() {
+    TestOutput::PrintTestStart("critical latency under background stream");
+
+    std::filesystem::create_directories(ASSET_DIRECTORY);
+    for (int i = 0; i < BACKGROUND_ASSET_COUNT; ++i) {
+        WriteGridModel(GetAssetPath("background", i));
+    }
+    for (int i = 0; i < CRITICAL_ASSET_COUNT; ++i) {
+        WriteGridModel(GetAssetPath("critical", i));
+    }
+
+    StreamResult fifo = RunStream(AsyncModelLoader::TaskPriority::Low);
+    StreamResult prioritized = RunStream(AsyncModelLoader::TaskPriority::Critical);
+
+    EXPECT_TRUE(fifo.allLoaded);
+    EXPECT_TRUE(prioritized.allLoaded);
+    EXPECT_EQUAL(prioritized.backgroundLatency.completedLoads, static_cast<uint32_t>(BACKGROUND_ASSET_COUNT));
+
+    TestOutput::PrintInfo(std::to_string(BACKGROUND_ASSET_COUNT) + " background + " + std::to_string(CRITICAL_ASSET_COUNT) +
+                          " critical loads, " + std::to_string(MAX_CONCURRENT_LOADS) + " concurrent");
+    TestOutput::PrintInfo("critical at background priority: avg " + StringUtils::FormatFloat(static_cast<float>(fifo.averageCriticalMs), 1) +
+                          " ms, max " + StringUtils::FormatFloat(static_cast<float>(fifo.maxCriticalMs), 1) + " ms");
+    TestOutput::PrintInfo("critical at critical priority:   avg " + StringUtils::FormatFloat(static_cast<float>(prioritized.averageCriticalMs), 1) +
+                          " ms, max " + StringUtils::FormatFloat(static_cast<float>(prioritized.maxCriticalMs), 1) + " ms");
+    TestOutput::PrintInfo("background stream: " + StringUtils::FormatFloat(static_cast<float>(prioritized.totalMs), 1) +
+                          " ms total, max latency " + StringUtils::FormatFloat(prioritized.backgroundLatency.maxLatencyMs, 1) + " ms");
+
+    std::filesystem::remove_all(ASSET_DIRECTORY);
+
+    TestOutput::PrintTestPass("critical latency under background stream");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Async Model Loader Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Async Model Loader Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Critical Latency Under Background Stream", TestCriticalLatencyUnderBackgroundStream);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
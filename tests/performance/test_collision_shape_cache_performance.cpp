@@ -0,0 +1,224 @@
+/**
+ * Collision Shape Cache Performance Tests
+ *
+ * Builds a 10,000 body scene of crates in a handful of sizes, convex hull rocks and static
+ * triangle mesh props, once with every body owning its own shape and once with shapes shared
+ * through the collision shape cache, and reports creation time and estimated shape memory for
+ * both. A third pass starts a new engine on the same BVH directory to time cached BVH loading.
+ */
+
+#ifdef GAMEENGINE_HAS_BULLET
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <filesystem>
+#include "TestUtils.h"
+#include "Physics/PhysicsEngine.h"
+#include "Physics/CollisionShapeFactory.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Physics;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr size_t BODY_COUNT = 10000;
+    constexpr size_t ROCK_EVERY = 10;   // Every 10th body is a convex hull rock
+    constexpr size_t PROP_EVERY = 50;   // Every 50th body is a static mesh prop
+
+    struct SceneBody {
+        RigidBody body;
+        CollisionShape shape;
+    };
+
+    // Rolling terrain patch used by every mesh prop, about 8k triangles
+    std::shared_ptr<const CollisionMeshData> CreatePropMesh() {
+        constexpr uint32_t size = 64;
+        std::vector<Math::Vec3> positions;
+        std::vector<uint32_t> indices;
+        for (uint32_t z = 0; z <= size; ++z) {
+            for (uint32_t x = 0; x <= size; ++x) {
+                const float height = std::sin(x * 0.3f) * std::cos(z * 0.2f);
+                positions.emplace_back(x * 0.25f - 8.0f, height, z * 0.25f - 8.0f);
+            }
+        }
+        for (uint32_t z = 0; z < size; ++z) {
+            for (uint32_t x = 0; x < size; ++x) {
+                const uint32_t i = z * (size + 1) + x;
+                indices.insert(indices.end(), { i, i + size + 1, i + 1, i + 1, i + size + 1, i + size + 2 });
+            }
+        }
+        return std::make_shared<const CollisionMeshData>(std::move(positions), std::move(indices));
+    }
+
+    // Lumpy point cloud of 600 points for the rock hulls
+    std::shared_ptr<const CollisionMeshData> CreateRockPoints() {
+        std::vector<Math::Vec3> positions;
+        for (uint32_t i = 0; i < 600; ++i) {
+            const float y = 1.0f - 2.0f * (i + 0.5f) / 600.0f;
+            const float r = std::sqrt(1.0f - y * y);
+            const float phi = 2.39996323f * i;
+            const float bump = 1.0f + 0.15f * std::sin(phi * 3.0f) * std::cos(y * 5.0f);
+            positions.emplace_back(bump * r * std::cos(phi), bump * y * 0.7f, bump * r * std::sin(phi));
+        }
+        return std::make_shared<const CollisionMeshData>(std::move(positions));
+    }
+
+    std::vector<SceneBody> CreateScene() {
+        const auto propMesh = CreatePropMesh();
+        const auto rockPoints = CreateRockPoints();
+        const Math::Vec3 crateSizes[] = { Math::Vec3(1.0f), Math::Vec3(0.5f), Math::Vec3(1.0f, 0.5f, 1.0f), Math::Vec3(2.0f, 1.0f, 1.0f) };
+
+        std::vector<SceneBody> scene(BODY_COUNT);
+        for (size_t i = 0; i < BODY_COUNT; ++i) {
+            SceneBody& entry = scene[i];
+            entry.body.position = Math::Vec3(static_cast<float>(i % 100) * 3.0f, 1.0f, static_cast<float>(i / 100) * 3.0f);
+            if (i % PROP_EVERY == 0) {
+                entry.shape.type = CollisionShape::Mesh;
+                entry.shape.mesh = propMesh;
+                entry.shape.dimensions = Math::Vec3((i / PROP_EVERY) % 2 == 0 ? 1.0f : 1.5f);
+                entry.body.isStatic = true;
+            } else if (i % ROCK_EVERY == 0) {
+                entry.shape.type = CollisionShape::ConvexHull;
+                entry.shape.mesh = rockPoints;
+                entry.shape.dimensions = Math::Vec3((i / ROCK_EVERY) % 2 == 0 ? 1.0f : 0.6f);
+            } else {
+                entry.shape.type = CollisionShape::Box;
+                entry.shape.dimensions = crateSizes[i % 4];
+            }
+        }
+        return scene;
+    }
+
+    double CreateBodies(PhysicsEngine& engine, const std::vector<SceneBody>& scene, bool& allCreated) {
+        TestTimer timer;
+        for (const SceneBody& entry : scene) {
+            allCreated &= engine.CreateRigidBody(entry.body, entry.shape) != 0;
+        }
+        return timer.ElapsedMs();
+    }
+
+    std::string FormatMs(double ms) {
+        return StringUtils::FormatFloat(static_cast<float>(ms)) + " ms";
+    }
+
+    std::string FormatKiB(size_t bytes) {
+        return StringUtils::FormatFloat(static_cast<float>(bytes) / 1024.0f) + " KiB";
+    }
+}
+
+/**
+ * Test creation time and shape memory of a 10k body scene with and without shape sharing
+ * Requirements: Shared collision shape cache, serialized mesh BVHs
+ */
+bool TestSceneCreation() {
+    TestOutput::PrintTestStart("10k body scene creation");
+
+    const std::vector<SceneBody> scene = CreateScene();
+    const std::filesystem::path bvhDirectory = std::filesystem::temp_directory_path() / "gameengine_shape_cache_perf";
+    std::filesystem::remove_all(bvhDirectory);
+
+    // Unshared: every body builds its own shape, hull and BVH
+    PhysicsConfiguration unsharedConfig = PhysicsConfiguration::Default();
+    unsharedConfig.shareCollisionShapes = false;
+    PhysicsEngine unsharedEngine;
+    EXPECT_TRUE(unsharedEngine.Initialize(unsharedConfig));
+    bool allCreated = true;
+    const double unsharedMs = CreateBodies(unsharedEngine, scene, allCreated);
+    unsharedEngine.Shutdown();
+
+    // The same shapes again outside the timed run, only to total their memory
+    size_t unsharedBytes = 0;
+    for (const SceneBody& entry : scene) {
+        auto shape = CollisionShapeFactory::CreateShape(entry.shape);
+        EXPECT_NOT_NULL(shape);
+        unsharedBytes += CollisionShapeFactory::EstimateMemoryUsage(*shape);
+    }
+
+    // Shared, cold: one shape per distinct descriptor, BVHs built and written to disk
+    PhysicsConfiguration sharedConfig = PhysicsConfiguration::Default();
+    sharedConfig.collisionCacheDirectory = bvhDirectory.string();
+    PhysicsEngine sharedEngine;
+    EXPECT_TRUE(sharedEngine.Initialize(sharedConfig));
+    const double sharedMs = CreateBodies(sharedEngine, scene, allCreated);
+    const CollisionShapeCacheStats sharedStats = sharedEngine.GetShapeCacheStats();
+    sharedEngine.Shutdown();
+
+    // Shared, warm: a new engine loads the BVH instead of building it
+    PhysicsEngine warmEngine;
+    EXPECT_TRUE(warmEngine.Initialize(sharedConfig));
+    const double warmMs = CreateBodies(warmEngine, scene, allCreated);
+    const CollisionShapeCacheStats warmStats = warmEngine.GetShapeCacheStats();
+    warmEngine.Shutdown();
+    std::filesystem::remove_all(bvhDirectory);
+
+    TestOutput::PrintInfo(std::to_string(BODY_COUNT) + " bodies: crates in 4 sizes, " +
+                          std::to_string(BODY_COUNT / ROCK_EVERY - BODY_COUNT / PROP_EVERY) + " hull rocks, " +
+                          std::to_string(BODY_COUNT / PROP_EVERY) + " mesh props");
+    TestOutput::PrintInfo("  Unshared:       " + FormatMs(unsharedMs) + ", " + std::to_string(BODY_COUNT) +
+                          " shapes, ~" + FormatKiB(unsharedBytes));
+    TestOutput::PrintInfo("  Shared (cold):  " + FormatMs(sharedMs) + ", " + std::to_string(sharedStats.shapeCount) +
+                          " shapes, ~" + FormatKiB(sharedStats.memoryBytes) + ", " +
+                          std::to_string(sharedStats.bvhBuilds) + " BVH built");
+    TestOutput::PrintInfo("  Shared (warm):  " + FormatMs(warmMs) + ", " + std::to_string(warmStats.bvhLoads) + " BVH loaded");
+    TestOutput::PrintInfo("  Creation speedup: " + StringUtils::FormatFloat(static_cast<float>(unsharedMs / std::max(sharedMs, 0.001))) +
+                          "x, memory reduction: " + StringUtils::FormatFloat(static_cast<float>(unsharedBytes) /
+                                                                             static_cast<float>(std::max<size_t>(sharedStats.memoryBytes, 1))) + "x");
+
+    EXPECT_TRUE(allCreated);
+    // 4 crates, 2 rocks, the unit-scale prop and its scaled instance
+    EXPECT_EQUAL(sharedStats.shapeCount, static_cast<size_t>(8));
+    EXPECT_EQUAL(sharedStats.bvhBuilds, static_cast<size_t>(1));
+    EXPECT_EQUAL(warmStats.bvhLoads, static_cast<size_t>(1));
+    EXPECT_EQUAL(warmStats.bvhBuilds, static_cast<size_t>(0));
+    EXPECT_TRUE(sharedStats.memoryBytes * 100 < unsharedBytes);
+
+    TestOutput::PrintTestPass("10k body scene creation");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Collision Shape Cache Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Collision Shape Cache Performance Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Scene Creation", TestSceneCreation);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
+
+#else
+
+#include "TestUtils.h"
+
+using namespace GameEngine::Testing;
+
+int main() {
+    TestOutput::PrintHeader("Collision Shape Cache Performance");
+    TestOutput::PrintWarning("Bullet Physics not available - collision shape cache performance tests skipped");
+    TestOutput::PrintFooter(true);
+    return 0;
+}
+
+#endif // GAMEENGINE_HAS_BULLET
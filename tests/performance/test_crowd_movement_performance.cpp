@@ -0,0 +1,227 @@
+/**
+ * Crowd Movement Performance Tests
+ *
+ * 5,000 NPCs moved by CrowdMovementSystem, once per kernel level on flat ground and, with
+ * Bullet, against a ground slab and a wall through batched capsule sweeps. Every level and
+ * every repeat must end in bit-identical agent state.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include "TestUtils.h"
+#include "Game/CrowdMovementSystem.h"
+#include "Physics/PhysicsEngine.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr int AGENTS_X = 100;
+    constexpr int AGENTS_Z = 50;
+    constexpr int AGENT_COUNT = AGENTS_X * AGENTS_Z;
+    constexpr float AGENT_SPACING_X = 0.35f;
+    constexpr float AGENT_SPACING_Z = 1.0f;
+    constexpr float FRAME_TIME = 1.0f / 60.0f;
+    constexpr int FLAT_FRAMES = 600;
+
+    struct CrowdRun {
+        double elapsedMs = 0.0;
+        std::vector<Math::Vec3> positions;
+        size_t groundedCount = 0;
+    };
+
+    void SpawnGrid(CrowdMovementSystem& crowd) {
+        for (int z = 0; z < AGENTS_Z; ++z) {
+            for (int x = 0; x < AGENTS_X; ++x) {
+                crowd.AddAgent(Math::Vec3(x * AGENT_SPACING_X, 0.9f, z * AGENT_SPACING_Z));
+            }
+        }
+    }
+
+    // Wandering AI: each agent changes heading every second, staggered so some change every frame
+    void UpdateAiInput(CrowdMovementSystem& crowd, int frame) {
+        for (uint32_t id = 0; id < AGENT_COUNT; ++id) {
+            if ((id + frame) % 60 == 0) {
+                const float heading = static_cast<float>((id * 7919u + frame) % 360u) * 0.0174533f;
+                crowd.SetAgentMoveInput(id, Math::Vec3(std::sin(heading), 0.0f, std::cos(heading)));
+            }
+            if ((id * 13u + frame) % 240 == 0) {
+                crowd.RequestJump(id);
+            }
+        }
+    }
+
+    CrowdRun SimulateFlat(SimdLevel level) {
+        CrowdMovementSystem crowd;
+        crowd.SetSimdLevel(level);
+        crowd.Initialize(nullptr);
+        SpawnGrid(crowd);
+
+        CrowdRun run;
+        TestTimer timer;
+        for (int frame = 0; frame < FLAT_FRAMES; ++frame) {
+            UpdateAiInput(crowd, frame);
+            crowd.Update(FRAME_TIME);
+        }
+        run.elapsedMs = timer.ElapsedMs();
+
+        run.positions.resize(crowd.GetAgentCount());
+        crowd.GetAgentPositions(run.positions);
+        for (CrowdMovementSystem::AgentId id : crowd.GetAgentIds()) {
+            run.groundedCount += crowd.IsAgentGrounded(id) ? 1 : 0;
+        }
+        return run;
+    }
+
+    bool SamePositions(const CrowdRun& a, const CrowdRun& b) {
+        return a.positions.size() == b.positions.size() &&
+               std::memcmp(a.positions.data(), b.positions.data(), a.positions.size() * sizeof(Math::Vec3)) == 0;
+    }
+
+    std::string FormatMs(double ms) {
+        return StringUtils::FormatFloat(static_cast<float>(ms)) + " ms";
+    }
+}
+
+/**
+ * Test per-frame cost and determinism of 5k agents on flat ground at every kernel level
+ * Requirements: SoA crowd movement in SIMD batches, bit-identical for replays
+ */
+bool TestFlatGroundCrowd() {
+    TestOutput::PrintTestStart("5k agents on flat ground");
+
+    const SimdLevel supported = DetectSupportedSimdLevel();
+    TestOutput::PrintInfo(std::to_string(AGENT_COUNT) + " agents, " + std::to_string(FLAT_FRAMES) + " frames");
+
+    std::vector<CrowdRun> runs;
+    for (int level = 0; level <= static_cast<int>(supported); ++level) {
+        runs.push_back(SimulateFlat(static_cast<SimdLevel>(level)));
+        const double frameMs = runs.back().elapsedMs / FLAT_FRAMES;
+        const double speedup = runs.front().elapsedMs / std::max(runs.back().elapsedMs, 0.001);
+        TestOutput::PrintInfo(std::string("  ") + GetSimdLevelName(static_cast<SimdLevel>(level)) + ": " +
+                              FormatMs(frameMs) + "/frame (" + StringUtils::FormatFloat(static_cast<float>(speedup)) + "x)");
+    }
+
+    // Replays must reproduce the same bits, whichever kernels ran
+    const CrowdRun repeat = SimulateFlat(supported);
+    EXPECT_TRUE(SamePositions(runs.back(), repeat));
+    for (const CrowdRun& run : runs) {
+        EXPECT_TRUE(SamePositions(runs.front(), run));
+    }
+
+    const CrowdRun& first = runs.front();
+    EXPECT_TRUE(first.groundedCount > 0);
+    EXPECT_TRUE(first.positions[0] != Math::Vec3(0.0f, 0.9f, 0.0f));
+
+    TestOutput::PrintTestPass("5k agents on flat ground");
+    return true;
+}
+
+#ifdef GAMEENGINE_HAS_BULLET
+
+/**
+ * Test 5k agents walking into a wall with batched ground and movement sweeps
+ * Requirements: capsule sweeps through the batched physics query path
+ */
+bool TestPhysicsCrowd() {
+    TestOutput::PrintTestStart("5k agents with batched sweeps");
+
+    constexpr int FRAMES = 120;
+    constexpr float WALL_X = 40.0f;
+
+    PhysicsEngine engine;
+    engine.Initialize(PhysicsConfiguration::Default());
+
+    RigidBody groundDesc;
+    groundDesc.position = Math::Vec3(25.0f, -0.5f, 25.0f);
+    groundDesc.isStatic = true;
+    CollisionShape groundShape;
+    groundShape.type = CollisionShape::Box;
+    groundShape.dimensions = Math::Vec3(90.0f, 1.0f, 90.0f);
+    engine.CreateRigidBody(groundDesc, groundShape);
+
+    RigidBody wallDesc;
+    wallDesc.position = Math::Vec3(WALL_X, 2.0f, 25.0f);
+    wallDesc.isStatic = true;
+    CollisionShape wallShape;
+    wallShape.type = CollisionShape::Box;
+    wallShape.dimensions = Math::Vec3(1.0f, 4.0f, 90.0f);
+    engine.CreateRigidBody(wallDesc, wallShape);
+
+    CrowdMovementSystem crowd;
+    crowd.Initialize(&engine);
+    SpawnGrid(crowd);
+    for (uint32_t id = 0; id < AGENT_COUNT; ++id) {
+        crowd.SetAgentMoveInput(id, Math::Vec3(1.0f, 0.0f, 0.0f));
+    }
+
+    TestTimer timer;
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        crowd.Update(FRAME_TIME);
+    }
+    const double elapsedMs = timer.ElapsedMs();
+
+    float maxX = 0.0f;
+    size_t groundedCount = 0;
+    for (CrowdMovementSystem::AgentId id : crowd.GetAgentIds()) {
+        maxX = std::max(maxX, crowd.GetAgentPosition(id).x);
+        groundedCount += crowd.IsAgentGrounded(id) ? 1 : 0;
+    }
+
+    TestOutput::PrintInfo(std::to_string(AGENT_COUNT) + " agents, " + std::to_string(FRAMES) + " frames, " +
+                          std::to_string(AGENT_COUNT * 2) + " sweeps/frame");
+    TestOutput::PrintInfo("  " + FormatMs(elapsedMs / FRAMES) + "/frame, furthest agent at x = " +
+                          StringUtils::FormatFloat(maxX));
+
+    // The wall's face is at x = 39.5; capsule centres stop a radius short of it
+    EXPECT_TRUE(maxX < WALL_X - 0.5f - crowd.GetCharacterRadius() + 0.05f);
+    EXPECT_TRUE(maxX > WALL_X - 2.0f);
+    EXPECT_EQUAL(groundedCount, static_cast<size_t>(AGENT_COUNT));
+    EXPECT_NEARLY_EQUAL_EPSILON(crowd.GetAgentPosition(0).y, 0.9f, 0.1f);
+
+    engine.Shutdown();
+
+    TestOutput::PrintTestPass("5k agents with batched sweeps");
+    return true;
+}
+
+#endif // GAMEENGINE_HAS_BULLET
+
+int main() {
+    TestOutput::PrintHeader("Crowd Movement Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Crowd Movement Performance Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Flat Ground Crowd", TestFlatGroundCrowd);
+#ifdef GAMEENGINE_HAS_BULLET
+        allPassed &= suite.RunTest("Physics Crowd", TestPhysicsCrowd);
+#else
+        TestOutput::PrintWarning("Bullet Physics not available - batched sweep crowd test skipped");
+#endif
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
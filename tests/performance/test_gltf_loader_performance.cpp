@@ -0,0 +1,306 @@
+/**
+ * GLTF Loader Performance Tests
+ *
+ * Load time and peak heap use for a large GLB. The current loader maps the file and decodes
+ * accessors from the binary chunk straight into Vertex storage. It is compared against the
+ * previous scheme: read the file into a vector, copy the binary chunk, copy every accessor
+ * into its own temporary vector, then fill the vertices in a second loop.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include "TestUtils.h"
+#include "Resource/GLTFLoader.h"
+#include "Graphics/Mesh.h"
+#include "Core/Logger.h"
+#include <nlohmann/json.hpp>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+// Heap accounting for peak-memory measurement; every allocation carries its size in a header
+namespace {
+    constexpr size_t ALLOCATION_HEADER = alignof(std::max_align_t);
+    std::atomic<size_t> g_heapInUse{0};
+    std::atomic<size_t> g_heapPeak{0};
+
+    void* TrackedAllocate(size_t size) {
+        void* block = std::malloc(size + ALLOCATION_HEADER);
+        if (!block) {
+            throw std::bad_alloc();
+        }
+        *static_cast<size_t*>(block) = size;
+        const size_t inUse = g_heapInUse.fetch_add(size) + size;
+        size_t peak = g_heapPeak.load();
+        while (inUse > peak && !g_heapPeak.compare_exchange_weak(peak, inUse)) {
+        }
+        return static_cast<char*>(block) + ALLOCATION_HEADER;
+    }
+
+    void TrackedFree(void* pointer) {
+        if (!pointer) {
+            return;
+        }
+        void* block = static_cast<char*>(pointer) - ALLOCATION_HEADER;
+        g_heapInUse.fetch_sub(*static_cast<size_t*>(block));
+        std::free(block);
+    }
+
+    void ResetPeak() {
+        g_heapPeak.store(g_heapInUse.load());
+    }
+
+    // Peak heap growth since the last ResetPeak
+    size_t PeakGrowth(size_t baseline) {
+        return g_heapPeak.load() - baseline;
+    }
+}
+
+void* operator new(size_t size) { return TrackedAllocate(size); }
+void* operator new[](size_t size) { return TrackedAllocate(size); }
+void operator delete(void* pointer) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer) noexcept { TrackedFree(pointer); }
+void operator delete(void* pointer, size_t) noexcept { TrackedFree(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { TrackedFree(pointer); }
+
+namespace {
+    constexpr uint32_t VERTEX_COUNT = 1u << 20;
+    constexpr uint32_t INDEX_COUNT = VERTEX_COUNT * 3;
+    constexpr int LOAD_ITERATIONS = 3;
+
+    const std::string GLB_PATH = "perf_gltf_large.glb";
+
+    // Separate POSITION, NORMAL, TANGENT (float) and TEXCOORD_0 (normalized ushort) views plus uint32 indices
+    void WriteLargeGLB(const std::string& path) {
+        std::vector<uint8_t> bin;
+        auto append = [&bin](const void* data, size_t size) {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            bin.insert(bin.end(), bytes, bytes + size);
+        };
+
+        for (uint32_t i = 0; i < VERTEX_COUNT; ++i) {
+            const float position[3] = {static_cast<float>(i % 1024), 0.0f, static_cast<float>(i / 1024)};
+            append(position, sizeof(position));
+        }
+        for (uint32_t i = 0; i < VERTEX_COUNT; ++i) {
+            const float normal[3] = {0.0f, 1.0f, 0.0f};
+            append(normal, sizeof(normal));
+        }
+        for (uint32_t i = 0; i < VERTEX_COUNT; ++i) {
+            const float tangent[4] = {1.0f, 0.0f, 0.0f, 1.0f};
+            append(tangent, sizeof(tangent));
+        }
+        for (uint32_t i = 0; i < VERTEX_COUNT; ++i) {
+            const uint16_t uv[2] = {static_cast<uint16_t>(i % 1024 * 64), static_cast<uint16_t>(i / 1024 * 64)};
+            append(uv, sizeof(uv));
+        }
+        for (uint32_t i = 0; i < INDEX_COUNT; ++i) {
+            const uint32_t index = (i * 7) % VERTEX_COUNT;
+            append(&index, sizeof(index));
+        }
+
+        const size_t positionOffset = 0;
+        const size_t normalOffset = positionOffset + VERTEX_COUNT * 12;
+        const size_t tangentOffset = normalOffset + VERTEX_COUNT * 12;
+        const size_t uvOffset = tangentOffset + VERTEX_COUNT * 16;
+        const size_t indexOffset = uvOffset + VERTEX_COUNT * 4;
+
+        nlohmann::json json;
+        json["asset"]["version"] = "2.0";
+        json["scene"] = 0;
+        json["scenes"] = {{{"nodes", {0}}}};
+        json["nodes"] = {{{"mesh", 0}}};
+        nlohmann::json primitive;
+        primitive["attributes"] = {{"POSITION", 0}, {"NORMAL", 1}, {"TANGENT", 2}, {"TEXCOORD_0", 3}};
+        primitive["indices"] = 4;
+        json["meshes"][0]["primitives"] = nlohmann::json::array({primitive});
+        json["buffers"] = {{{"byteLength", bin.size()}}};
+        json["bufferViews"] = {
+            {{"buffer", 0}, {"byteOffset", positionOffset}, {"byteLength", VERTEX_COUNT * 12}},
+            {{"buffer", 0}, {"byteOffset", normalOffset}, {"byteLength", VERTEX_COUNT * 12}},
+            {{"buffer", 0}, {"byteOffset", tangentOffset}, {"byteLength", VERTEX_COUNT * 16}},
+            {{"buffer", 0}, {"byteOffset", uvOffset}, {"byteLength", VERTEX_COUNT * 4}},
+            {{"buffer", 0}, {"byteOffset", indexOffset}, {"byteLength", INDEX_COUNT * 4}}
+        };
+        json["accessors"] = {
+            {{"bufferView", 0}, {"componentType", 5126}, {"count", VERTEX_COUNT}, {"type", "VEC3"}},
+            {{"bufferView", 1}, {"componentType", 5126}, {"count", VERTEX_COUNT}, {"type", "VEC3"}},
+            {{"bufferView", 2}, {"componentType", 5126}, {"count", VERTEX_COUNT}, {"type", "VEC4"}},
+            {{"bufferView", 3}, {"componentType", 5123}, {"normalized", true}, {"count", VERTEX_COUNT}, {"type", "VEC2"}},
+            {{"bufferView", 4}, {"componentType", 5125}, {"count", INDEX_COUNT}, {"type", "SCALAR"}}
+        };
+
+        std::string jsonText = json.dump();
+        while (jsonText.size() % 4 != 0) {
+            jsonText.push_back(' ');
+        }
+
+        std::ofstream file(path, std::ios::binary);
+        auto writeUint32 = [&file](uint32_t value) { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+        writeUint32(0x46546C67);
+        writeUint32(2);
+        writeUint32(static_cast<uint32_t>(12 + 8 + jsonText.size() + 8 + bin.size()));
+        writeUint32(static_cast<uint32_t>(jsonText.size()));
+        writeUint32(0x4E4F534A);
+        file.write(jsonText.data(), jsonText.size());
+        writeUint32(static_cast<uint32_t>(bin.size()));
+        writeUint32(0x004E4942);
+        file.write(reinterpret_cast<const char*>(bin.data()), bin.size());
+    }
+
+    template<typename T>
+    std::vector<T> CopyAccessor(const std::vector<uint8_t>& buffer, size_t offset, uint32_t count, size_t elementSize) {
+        std::vector<T> result;
+        result.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            T element;
+            std::memcpy(&element, buffer.data() + offset + i * elementSize, sizeof(T));
+            result.push_back(element);
+        }
+        return result;
+    }
+
+    // The previous decode path for the same file, producing the same mesh
+    std::shared_ptr<Mesh> LoadLegacy(const std::string& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(data.data()), data.size());
+
+        uint32_t jsonLength = 0;
+        std::memcpy(&jsonLength, data.data() + 12, sizeof(jsonLength));
+        std::string jsonChunk(data.begin() + 20, data.begin() + 20 + jsonLength);
+        auto json = nlohmann::json::parse(jsonChunk);
+        uint32_t binaryLength = 0;
+        std::memcpy(&binaryLength, data.data() + 20 + jsonLength, sizeof(binaryLength));
+        const size_t binaryStart = 20 + jsonLength + 8;
+        std::vector<uint8_t> binary(data.begin() + binaryStart, data.begin() + binaryStart + binaryLength);
+
+        auto viewOffset = [&json](int accessor) {
+            return json["bufferViews"][json["accessors"][accessor]["bufferView"].get<int>()]["byteOffset"].get<size_t>();
+        };
+
+        auto positions = CopyAccessor<Math::Vec3>(binary, viewOffset(0), VERTEX_COUNT, 12);
+        std::vector<Vertex> vertices(positions.size());
+        for (size_t i = 0; i < positions.size(); ++i) {
+            vertices[i].position = positions[i];
+        }
+        auto normals = CopyAccessor<Math::Vec3>(binary, viewOffset(1), VERTEX_COUNT, 12);
+        for (size_t i = 0; i < normals.size(); ++i) {
+            vertices[i].normal = normals[i];
+        }
+        auto tangents = CopyAccessor<Math::Vec4>(binary, viewOffset(2), VERTEX_COUNT, 16);
+        for (size_t i = 0; i < tangents.size(); ++i) {
+            vertices[i].tangent = Math::Vec3(tangents[i].x, tangents[i].y, tangents[i].z);
+        }
+        auto uvs = CopyAccessor<uint32_t>(binary, viewOffset(3), VERTEX_COUNT, 4);
+        for (size_t i = 0; i < uvs.size(); ++i) {
+            vertices[i].texCoords = Math::Vec2((uvs[i] & 0xFFFF) / 65535.0f, (uvs[i] >> 16) / 65535.0f);
+        }
+        auto indices = CopyAccessor<uint32_t>(binary, viewOffset(4), INDEX_COUNT, 4);
+
+        auto mesh = std::make_shared<Mesh>();
+        mesh->SetVertices(vertices);
+        mesh->SetIndices(indices);
+        return mesh;
+    }
+}
+
+/**
+ * Test load time and peak heap of a large GLB against the copy-based decoder
+ * Requirements: zero-copy accessor decoding into final vertex storage
+ */
+bool TestLargeGLBLoad() {
+    TestOutput::PrintTestStart("large GLB load");
+
+    WriteLargeGLB(GLB_PATH);
+    const size_t fileSize = std::filesystem::file_size(GLB_PATH);
+
+    double legacyBest = 1e9;
+    double mappedBest = 1e9;
+    size_t legacyPeak = 0;
+    size_t mappedPeak = 0;
+    uint32_t decodedVertices = 0;
+    size_t decodedIndices = 0;
+
+    GLTFLoader loader;
+    for (int i = 0; i < LOAD_ITERATIONS; ++i) {
+        {
+            const size_t baseline = g_heapInUse.load();
+            ResetPeak();
+            TestTimer timer;
+            auto mesh = LoadLegacy(GLB_PATH);
+            legacyBest = std::min(legacyBest, timer.ElapsedMs());
+            legacyPeak = std::max(legacyPeak, PeakGrowth(baseline));
+        }
+        {
+            const size_t baseline = g_heapInUse.load();
+            ResetPeak();
+            TestTimer timer;
+            auto result = loader.LoadGLTF(GLB_PATH);
+            mappedBest = std::min(mappedBest, timer.ElapsedMs());
+            mappedPeak = std::max(mappedPeak, PeakGrowth(baseline));
+
+            EXPECT_TRUE(result.success);
+            decodedVertices = result.totalVertices;
+            decodedIndices = result.model->GetMeshes()[0]->GetIndices().size();
+        }
+    }
+
+    EXPECT_EQUAL(decodedVertices, VERTEX_COUNT);
+    EXPECT_EQUAL(decodedIndices, static_cast<size_t>(INDEX_COUNT));
+
+    const size_t outputSize = VERTEX_COUNT * sizeof(Vertex) + INDEX_COUNT * sizeof(uint32_t);
+    TestOutput::PrintInfo(std::to_string(VERTEX_COUNT) + " vertices, GLB " + std::to_string(fileSize / 1024 / 1024) +
+                          " MB, decoded mesh " + std::to_string(outputSize / 1024 / 1024) + " MB");
+    TestOutput::PrintInfo("copying decoder: " + StringUtils::FormatFloat(static_cast<float>(legacyBest), 1) + " ms, peak heap " +
+                          std::to_string(legacyPeak / 1024 / 1024) + " MB");
+    TestOutput::PrintInfo("in-place decoder: " + StringUtils::FormatFloat(static_cast<float>(mappedBest), 1) + " ms, peak heap " +
+                          std::to_string(mappedPeak / 1024 / 1024) + " MB");
+    TestOutput::PrintInfo("  speedup " + StringUtils::FormatFloat(static_cast<float>(legacyBest / std::max(mappedBest, 0.001)), 2) +
+                          "x, peak heap " + StringUtils::FormatFloat(static_cast<float>(legacyPeak) / std::max<size_t>(mappedPeak, 1), 2) + "x lower");
+
+    // The in-place path should need little beyond the decoded mesh itself
+    EXPECT_TRUE(mappedPeak < legacyPeak);
+
+    std::filesystem::remove(GLB_PATH);
+
+    TestOutput::PrintTestPass("large GLB load");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("GLTF Loader Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("GLTF Loader Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Large GLB Load", TestLargeGLBLoad);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -0,0 +1,316 @@
+/**
+ * IndexedPose Performance Tests
+ *
+ * Compares the dense SoA IndexedPose against the name-keyed Pose for the
+ * per-frame animation work: sampling a clip, blending two poses, applying an
+ * additive layer and evaluating the bone hierarchy.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include "TestUtils.h"
+#include "Animation/IndexedPose.h"
+#include "Animation/Pose.h"
+#include "Animation/PoseBlendKernels.h"
+#include "Animation/BakedAnimation.h"
+#include "Animation/AnimationSkeleton.h"
+#include "Animation/SkeletalAnimation.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+using namespace GameEngine::Animation;
+
+namespace {
+    constexpr int BONE_COUNT = 120;
+    constexpr int CHARACTER_COUNT = 200;
+
+    std::shared_ptr<AnimationSkeleton> CreateBenchmarkSkeleton() {
+        auto skeleton = std::make_shared<AnimationSkeleton>("BenchmarkSkeleton");
+        for (int i = 0; i < BONE_COUNT; ++i) {
+            Math::Mat4 bindPose = glm::translate(Math::Mat4(1.0f), Math::Vec3(0.0f, 0.1f, 0.0f));
+            skeleton->CreateBone("Bone_" + std::to_string(i), bindPose);
+            if (i > 0) {
+                // Short chains hanging off a spine, similar to fingers on a humanoid
+                int parent = (i % 4 == 0) ? i - 4 : i - 1;
+                skeleton->SetBoneParent("Bone_" + std::to_string(i), "Bone_" + std::to_string(parent));
+            }
+        }
+        return skeleton;
+    }
+
+    std::shared_ptr<SkeletalAnimation> CreateBenchmarkAnimation(const std::string& name, float phase) {
+        auto animation = std::make_shared<SkeletalAnimation>(name);
+        animation->SetDuration(1.0f);
+        for (int i = 0; i < BONE_COUNT; ++i) {
+            const std::string boneName = "Bone_" + std::to_string(i);
+            for (int key = 0; key <= 30; ++key) {
+                float time = key / 30.0f;
+                float angle = std::sin((time + phase) * Math::TWO_PI) * 0.3f;
+                animation->AddPositionKeyframe(boneName, time, Math::Vec3(0.0f, 0.1f + angle * 0.01f, 0.0f));
+                animation->AddRotationKeyframe(boneName, time, glm::angleAxis(angle, Math::Vec3(0.0f, 0.0f, 1.0f)));
+            }
+        }
+        return animation;
+    }
+}
+
+/**
+ * Test sampling a clip into the map-based Pose versus an IndexedPose
+ * Requirements: PoseEvaluator::EvaluateAnimation without bone name hashing
+ */
+bool TestAnimationSamplingPerformance() {
+    TestOutput::PrintTestStart("animation sampling (map vs indexed)");
+
+    auto skeleton = CreateBenchmarkSkeleton();
+    auto layout = PoseLayout::Create(*skeleton);
+    auto animation = CreateBenchmarkAnimation("Walk", 0.0f);
+    AnimationBinding binding = AnimationBinding::Create(*animation, *layout);
+
+    TestTimer mapTimer;
+    for (int c = 0; c < CHARACTER_COUNT; ++c) {
+        Pose pose = PoseEvaluator::EvaluateAnimation(*animation, c * 0.01f, skeleton);
+        volatile size_t sink = pose.GetBoneCount();
+        (void)sink;
+    }
+    double mapTime = mapTimer.ElapsedMs();
+
+    IndexedPose indexedPose(layout);
+    TestTimer indexedTimer;
+    for (int c = 0; c < CHARACTER_COUNT; ++c) {
+        PoseEvaluator::EvaluateAnimation(*animation, binding, c * 0.01f, indexedPose);
+    }
+    double indexedTime = indexedTimer.ElapsedMs();
+
+    TestOutput::PrintTiming("map-based Pose sampling", mapTime, CHARACTER_COUNT);
+    TestOutput::PrintTiming("IndexedPose sampling", indexedTime, CHARACTER_COUNT);
+    TestOutput::PrintInfo("Speedup: " + StringUtils::FormatFloat(static_cast<float>(mapTime / std::max(indexedTime, 0.001)), 2) + "x");
+
+    TestOutput::PrintTestPass("animation sampling (map vs indexed)");
+    return true;
+}
+
+/**
+ * Test forward playback of a long clip with and without per-instance keyframe cursors
+ * Requirements: amortized O(1) keyframe lookup for forward playback
+ */
+bool TestCursorSamplingPerformance() {
+    TestOutput::PrintTestStart("keyframe cursor sampling");
+
+    auto skeleton = CreateBenchmarkSkeleton();
+    auto layout = PoseLayout::Create(*skeleton);
+
+    // 20 second cinematic-length clip at 30 keys per second
+    auto animation = std::make_shared<SkeletalAnimation>("Cinematic");
+    animation->SetDuration(20.0f);
+    for (int i = 0; i < BONE_COUNT; ++i) {
+        const std::string boneName = "Bone_" + std::to_string(i);
+        for (int key = 0; key <= 600; ++key) {
+            float time = key / 30.0f;
+            animation->AddRotationKeyframe(boneName, time, glm::angleAxis(std::sin(time) * 0.3f, Math::Vec3(0.0f, 0.0f, 1.0f)));
+        }
+    }
+    AnimationBinding binding = AnimationBinding::Create(*animation, *layout);
+
+    IndexedPose pose(layout);
+    const int frames = 600;
+    const float frameTime = 1.0f / 30.0f;
+
+    TestTimer searchTimer;
+    for (int frame = 0; frame < frames; ++frame) {
+        PoseEvaluator::EvaluateAnimation(*animation, binding, frame * frameTime, pose);
+    }
+    double searchTime = searchTimer.ElapsedMs();
+
+    AnimationCursor cursor;
+    TestTimer cursorTimer;
+    for (int frame = 0; frame < frames; ++frame) {
+        PoseEvaluator::EvaluateAnimation(*animation, binding, frame * frameTime, cursor, pose);
+    }
+    double cursorTime = cursorTimer.ElapsedMs();
+
+    TestOutput::PrintTiming("sampling with keyframe search", searchTime, frames);
+    TestOutput::PrintTiming("sampling with cursors", cursorTime, frames);
+    TestOutput::PrintInfo("Speedup: " + StringUtils::FormatFloat(static_cast<float>(searchTime / std::max(cursorTime, 0.001)), 2) + "x");
+
+    TestOutput::PrintTestPass("keyframe cursor sampling");
+    return true;
+}
+
+/**
+ * Test crowd playback from keyframe tracks versus a baked clip
+ * Requirements: fixed-rate baked clips sampled without keyframe search
+ */
+bool TestBakedPlaybackPerformance() {
+    TestOutput::PrintTestStart("baked clip playback");
+
+    auto skeleton = CreateBenchmarkSkeleton();
+    auto layout = PoseLayout::Create(*skeleton);
+    auto animation = CreateBenchmarkAnimation("Walk", 0.0f);
+    AnimationBinding binding = AnimationBinding::Create(*animation, *layout);
+    auto baked = BakedAnimation::Bake(*animation, layout, 30.0f);
+
+    IndexedPose pose(layout);
+    std::vector<AnimationCursor> cursors(CHARACTER_COUNT);
+
+    TestTimer trackTimer;
+    for (int c = 0; c < CHARACTER_COUNT; ++c) {
+        PoseEvaluator::EvaluateAnimation(*animation, binding, c * 0.013f, cursors[c], pose);
+    }
+    double trackTime = trackTimer.ElapsedMs();
+
+    TestTimer bakedTimer;
+    for (int c = 0; c < CHARACTER_COUNT; ++c) {
+        baked->Sample(animation->WrapTime(c * 0.013f), pose);
+    }
+    double bakedTime = bakedTimer.ElapsedMs();
+
+    TestOutput::PrintTiming("keyframe track playback", trackTime, CHARACTER_COUNT);
+    TestOutput::PrintTiming("baked clip playback", bakedTime, CHARACTER_COUNT);
+    TestOutput::PrintInfo("Speedup: " + StringUtils::FormatFloat(static_cast<float>(trackTime / std::max(bakedTime, 0.001)), 2) + "x");
+    TestOutput::PrintInfo("Baked clip memory: " + std::to_string(baked->GetMemoryUsage() / 1024) + " KB");
+
+    TestOutput::PrintTestPass("baked clip playback");
+    return true;
+}
+
+/**
+ * Test blending, additive layering and local-to-world for a crowd
+ * Requirements: linear SoA blend/additive/hierarchy walks
+ */
+bool TestBlendAndHierarchyPerformance() {
+    TestOutput::PrintTestStart("blend and hierarchy (map vs indexed)");
+
+    auto skeleton = CreateBenchmarkSkeleton();
+    auto layout = PoseLayout::Create(*skeleton);
+    auto walk = CreateBenchmarkAnimation("Walk", 0.0f);
+    auto run = CreateBenchmarkAnimation("Run", 0.25f);
+
+    Pose walkPose = PoseEvaluator::EvaluateAnimation(*walk, 0.3f, skeleton);
+    Pose runPose = PoseEvaluator::EvaluateAnimation(*run, 0.3f, skeleton);
+
+    TestTimer mapTimer;
+    for (int c = 0; c < CHARACTER_COUNT; ++c) {
+        Pose blended = Pose::Blend(walkPose, runPose, 0.4f);
+        blended.BlendAdditiveWith(runPose, 0.1f);
+        std::vector<Math::Mat4> skinning;
+        blended.GetSkinningMatrices(skinning);
+        volatile size_t sink = skinning.size();
+        (void)sink;
+    }
+    double mapTime = mapTimer.ElapsedMs();
+
+    IndexedPose indexedWalk(layout);
+    IndexedPose indexedRun(layout);
+    indexedWalk.FromPose(walkPose);
+    indexedRun.FromPose(runPose);
+    IndexedPose blended(layout);
+    std::vector<Math::Mat4> skinning;
+
+    TestTimer indexedTimer;
+    for (int c = 0; c < CHARACTER_COUNT; ++c) {
+        IndexedPose::Blend(indexedWalk, indexedRun, 0.4f, blended);
+        blended.BlendAdditiveWith(indexedRun, 0.1f);
+        blended.GetSkinningMatrices(skinning);
+    }
+    double indexedTime = indexedTimer.ElapsedMs();
+
+    TestOutput::PrintTiming("map-based Pose blend + skinning", mapTime, CHARACTER_COUNT);
+    TestOutput::PrintTiming("IndexedPose blend + skinning", indexedTime, CHARACTER_COUNT);
+    TestOutput::PrintInfo("Speedup: " + StringUtils::FormatFloat(static_cast<float>(mapTime / std::max(indexedTime, 0.001)), 2) + "x");
+
+    if (indexedTime <= mapTime) {
+        TestOutput::PrintTestPass("blend and hierarchy (map vs indexed)");
+        return true;
+    }
+
+    TestOutput::PrintTestFail("blend and hierarchy (map vs indexed)",
+        "IndexedPose faster than map-based Pose",
+        StringUtils::FormatFloat(static_cast<float>(indexedTime)) + "ms vs " + StringUtils::FormatFloat(static_cast<float>(mapTime)) + "ms");
+    return false;
+}
+
+/**
+ * Test the batch blend kernels at every instruction set the CPU supports
+ * Requirements: SIMD pose blending with scalar fallback
+ */
+bool TestBlendKernelLevelsPerformance() {
+    TestOutput::PrintTestStart("blend kernels per SIMD level");
+
+    auto skeleton = CreateBenchmarkSkeleton();
+    auto layout = PoseLayout::Create(*skeleton);
+    auto walk = CreateBenchmarkAnimation("Walk", 0.0f);
+    auto run = CreateBenchmarkAnimation("Run", 0.25f);
+
+    IndexedPose walkPose(layout);
+    IndexedPose runPose(layout);
+    PoseEvaluator::EvaluateAnimation(*walk, AnimationBinding::Create(*walk, *layout), 0.3f, walkPose);
+    PoseEvaluator::EvaluateAnimation(*run, AnimationBinding::Create(*run, *layout), 0.3f, runPose);
+    IndexedPose blended(layout);
+
+    const SimdLevel originalLevel = PoseBlendKernels::GetActiveLevel();
+    const SimdLevel supported = PoseBlendKernels::DetectSupportedLevel();
+    const int iterations = CHARACTER_COUNT * 20;
+
+    double scalarTime = 0.0;
+    for (int level = 0; level <= static_cast<int>(supported); ++level) {
+        PoseBlendKernels::SetActiveLevel(static_cast<SimdLevel>(level));
+
+        TestTimer timer;
+        for (int i = 0; i < iterations; ++i) {
+            IndexedPose::Blend(walkPose, runPose, 0.4f, blended);
+            blended.BlendAdditiveWith(runPose, 0.1f);
+        }
+        double elapsed = timer.ElapsedMs();
+        if (level == 0) {
+            scalarTime = elapsed;
+        }
+
+        const char* levelName = PoseBlendKernels::GetLevelName(static_cast<SimdLevel>(level));
+        TestOutput::PrintTiming(std::string(levelName) + " blend + additive", elapsed, iterations);
+        TestOutput::PrintInfo(std::string(levelName) + " speedup over scalar: " +
+            StringUtils::FormatFloat(static_cast<float>(scalarTime / std::max(elapsed, 0.001)), 2) + "x");
+    }
+
+    PoseBlendKernels::SetActiveLevel(originalLevel);
+
+    TestOutput::PrintTestPass("blend kernels per SIMD level");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("IndexedPose Performance");
+
+    // Bone creation logs at info level; keep the benchmark output readable
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("IndexedPose Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Animation Sampling Performance", TestAnimationSamplingPerformance);
+        allPassed &= suite.RunTest("Cursor Sampling Performance", TestCursorSamplingPerformance);
+        allPassed &= suite.RunTest("Baked Playback Performance", TestBakedPlaybackPerformance);
+        allPassed &= suite.RunTest("Blend And Hierarchy Performance", TestBlendAndHierarchyPerformance);
+        allPassed &= suite.RunTest("Blend Kernel Levels Performance", TestBlendKernelLevelsPerformance);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
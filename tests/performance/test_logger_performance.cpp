@@ -0,0 +1,206 @@
+/**
+ * Logger Performance Tests
+ *
+ * Cost of a log call on the calling thread: compiled-out and runtime-filtered calls,
+ * enqueueing onto the asynchronous writer from one and several threads, and the
+ * synchronous path for comparison. Output goes to a temporary file only.
+ */
+
+// Build this benchmark with Info as the lowest compiled-in level so LOG_DEBUG is elided
+#undef GAMEENGINE_MIN_LOG_LEVEL
+#define GAMEENGINE_MIN_LOG_LEVEL 1
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+#include "TestUtils.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr int CALL_COUNT = 100000;
+    const char* LOG_FILE = "logger_performance.log";
+
+    // Asynchronous, file-only output with room for a whole run
+    LoggerConfig CreateConfig(bool asynchronous, LogOverflowPolicy policy = LogOverflowPolicy::Drop) {
+        LoggerConfig config;
+        config.asynchronous = asynchronous;
+        config.queueCapacity = 1 << 16;
+        config.overflowPolicy = policy;
+        config.consoleOutput = false;
+        return config;
+    }
+
+    double NanosecondsPerCall(double elapsedMs, int calls) {
+        return elapsedMs * 1000000.0 / std::max(calls, 1);
+    }
+
+    void PrintCallCost(const std::string& label, double elapsedMs, int calls) {
+        TestOutput::PrintInfo(label + ": " + StringUtils::FormatFloat(static_cast<float>(NanosecondsPerCall(elapsedMs, calls)), 1) + " ns/call");
+    }
+}
+
+/**
+ * Test the cost of calls that never reach the queue
+ * Requirements: LOG_DEBUG compiles to nothing below the build-time minimum level
+ */
+bool TestFilteredCallCost() {
+    TestOutput::PrintTestStart("filtered call cost");
+
+    Logger& logger = Logger::GetInstance();
+    logger.SetLogLevel(LogLevel::Warning);
+
+    // Elided at compile time: the argument is never evaluated
+    int evaluated = 0;
+    auto buildMessage = [&evaluated](int i) { evaluated++; return "debug " + std::to_string(i); };
+    TestTimer elidedTimer;
+    for (int i = 0; i < CALL_COUNT; ++i) {
+        LOG_DEBUG(buildMessage(i));
+    }
+    double elidedTime = elidedTimer.ElapsedMs();
+    EXPECT_EQUAL(evaluated, 0);
+
+    // Compiled in but below the runtime level: one atomic load, no message built
+    TestTimer filteredTimer;
+    for (int i = 0; i < CALL_COUNT; ++i) {
+        LOG_INFO(buildMessage(i));
+    }
+    double filteredTime = filteredTimer.ElapsedMs();
+    EXPECT_EQUAL(evaluated, 0);
+
+    PrintCallCost("LOG_DEBUG (compiled out)", elidedTime, CALL_COUNT);
+    PrintCallCost("LOG_INFO (runtime filtered)", filteredTime, CALL_COUNT);
+
+    logger.SetLogLevel(LogLevel::Info);
+
+    TestOutput::PrintTestPass("filtered call cost");
+    return true;
+}
+
+/**
+ * Test enqueue cost on the asynchronous path against synchronous writes
+ * Requirements: producers only push a record; one background thread does the I/O
+ */
+bool TestAsyncCallCost() {
+    TestOutput::PrintTestStart("async call cost");
+
+    Logger& logger = Logger::GetInstance();
+    logger.SetLogLevel(LogLevel::Info);
+
+    // Synchronous baseline
+    logger.Configure(CreateConfig(false));
+    const int syncCalls = CALL_COUNT / 10;
+    TestTimer syncTimer;
+    for (int i = 0; i < syncCalls; ++i) {
+        LOG_INFO("synchronous message " + std::to_string(i));
+    }
+    double syncTime = syncTimer.ElapsedMs();
+
+    // Single producer
+    logger.Configure(CreateConfig(true));
+    const size_t droppedBefore = logger.GetDroppedMessageCount();
+    TestTimer asyncTimer;
+    for (int i = 0; i < CALL_COUNT; ++i) {
+        LOG_INFO("asynchronous message " + std::to_string(i));
+    }
+    double asyncTime = asyncTimer.ElapsedMs();
+    logger.Flush();
+
+    PrintCallCost("synchronous", syncTime, syncCalls);
+    PrintCallCost("asynchronous, 1 thread", asyncTime, CALL_COUNT);
+    TestOutput::PrintInfo("  dropped " + std::to_string(logger.GetDroppedMessageCount() - droppedBefore));
+
+    TestOutput::PrintTestPass("async call cost");
+    return true;
+}
+
+/**
+ * Test producer cost with several threads logging at once, under both overflow policies
+ * Requirements: safe from multiple threads; drop or block under backpressure
+ */
+bool TestContendedCallCost() {
+    TestOutput::PrintTestStart("contended call cost");
+
+    Logger& logger = Logger::GetInstance();
+    logger.SetLogLevel(LogLevel::Info);
+
+    const size_t threadCount = std::max<size_t>(2, std::min<size_t>(4, std::thread::hardware_concurrency()));
+    const int callsPerThread = CALL_COUNT / static_cast<int>(threadCount);
+
+    for (LogOverflowPolicy policy : {LogOverflowPolicy::Drop, LogOverflowPolicy::Block}) {
+        logger.Configure(CreateConfig(true, policy));
+        const size_t droppedBefore = logger.GetDroppedMessageCount();
+
+        std::vector<double> threadTimes(threadCount, 0.0);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; ++t) {
+            threads.emplace_back([t, callsPerThread, &threadTimes]() {
+                const std::string prefix = "thread " + std::to_string(t) + " message ";
+                TestTimer timer;
+                for (int i = 0; i < callsPerThread; ++i) {
+                    LOG_INFO(prefix + std::to_string(i));
+                }
+                threadTimes[t] = timer.ElapsedMs();
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        logger.Flush();
+
+        double slowest = *std::max_element(threadTimes.begin(), threadTimes.end());
+        const size_t dropped = logger.GetDroppedMessageCount() - droppedBefore;
+        const bool blocking = policy == LogOverflowPolicy::Block;
+        if (blocking) {
+            EXPECT_EQUAL(dropped, static_cast<size_t>(0));
+        }
+
+        PrintCallCost(std::string("asynchronous, ") + std::to_string(threadCount) + " threads, " + (blocking ? "block" : "drop"),
+                      slowest, callsPerThread);
+        TestOutput::PrintInfo("  dropped " + std::to_string(dropped));
+    }
+
+    TestOutput::PrintTestPass("contended call cost");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Logger Performance");
+
+    Logger::GetInstance().Initialize(LOG_FILE);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Logger Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Filtered Call Cost", TestFilteredCallCost);
+        allPassed &= suite.RunTest("Async Call Cost", TestAsyncCallCost);
+        allPassed &= suite.RunTest("Contended Call Cost", TestContendedCallCost);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        // Back to the defaults for anything logged during teardown
+        Logger::GetInstance().Configure(LoggerConfig{});
+        Logger::GetInstance().Shutdown();
+        std::remove(LOG_FILE);
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -0,0 +1,168 @@
+/**
+ * LRU Resource Cache Performance Tests
+ *
+ * Throughput of a mixed read/insert workload from many threads against one cache lock,
+ * a sharded LRU cache and a sharded cache using the clock policy, and the cost of
+ * trimming a large cache by memory.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include "TestUtils.h"
+#include "Resource/LRUResourceCache.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr int THREAD_COUNT = 8;
+    constexpr int OPERATIONS_PER_THREAD = 200000;
+    constexpr int KEY_COUNT = 4096;
+    constexpr size_t CACHE_CAPACITY = 2048;
+    constexpr int READ_PERCENT = 90;
+    constexpr int TRIM_ENTRY_COUNT = 50000;
+
+    struct BenchmarkResource {
+        size_t GetMemoryUsage() const { return 4096; }
+    };
+
+    std::vector<std::string> MakeKeys() {
+        std::vector<std::string> keys;
+        keys.reserve(KEY_COUNT);
+        for (int i = 0; i < KEY_COUNT; ++i) {
+            keys.push_back("assets/meshes/mesh_" + std::to_string(i) + ".obj");
+        }
+        return keys;
+    }
+
+    // Each thread walks its own pseudo-random key sequence; misses insert the resource
+    template<typename Cache>
+    double RunMixedWorkload(Cache& cache, const std::vector<std::string>& keys) {
+        auto resource = std::make_shared<BenchmarkResource>();
+        std::vector<std::thread> threads;
+        TestTimer timer;
+        for (int t = 0; t < THREAD_COUNT; ++t) {
+            threads.emplace_back([&cache, &keys, &resource, t]() {
+                uint32_t state = 2654435761u * static_cast<uint32_t>(t + 1);
+                for (int i = 0; i < OPERATIONS_PER_THREAD; ++i) {
+                    state = state * 1664525u + 1013904223u;
+                    const std::string& key = keys[(state >> 8) % KEY_COUNT];
+                    if (static_cast<int>((state >> 24) % 100) < READ_PERCENT) {
+                        cache.Get(key);
+                    } else {
+                        cache.Put(key, resource);
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        return timer.ElapsedMs();
+    }
+
+    void PrintThroughput(const std::string& name, double elapsedMs, float hitRatio) {
+        const double totalOperations = static_cast<double>(THREAD_COUNT) * OPERATIONS_PER_THREAD;
+        const double millionsPerSecond = totalOperations / (elapsedMs * 1000.0);
+        TestOutput::PrintInfo(name + ": " + StringUtils::FormatFloat(static_cast<float>(elapsedMs), 1) + " ms, " +
+                              StringUtils::FormatFloat(static_cast<float>(millionsPerSecond), 2) + " Mops/s, hit ratio " +
+                              StringUtils::FormatFloat(hitRatio, 2));
+    }
+}
+
+/**
+ * Test mixed read/insert throughput with many threads
+ * Requirements: sharded locking so lookups from loader and render threads don't contend
+ */
+bool TestMixedWorkloadThroughput() {
+    TestOutput::PrintTestStart("mixed read/insert throughput");
+
+    const std::vector<std::string> keys = MakeKeys();
+    const size_t maxMemory = CACHE_CAPACITY * 4096;
+
+    LRUResourceCache<BenchmarkResource> singleLock(CACHE_CAPACITY, maxMemory);
+    const double singleLockMs = RunMixedWorkload(singleLock, keys);
+
+    ShardedLRUResourceCache<BenchmarkResource> shardedLru(CACHE_CAPACITY, maxMemory, 16);
+    const double shardedLruMs = RunMixedWorkload(shardedLru, keys);
+
+    ShardedLRUResourceCache<BenchmarkResource> shardedClock(CACHE_CAPACITY, maxMemory, 16, CacheEvictionPolicy::Clock);
+    const double shardedClockMs = RunMixedWorkload(shardedClock, keys);
+
+    EXPECT_TRUE(singleLock.GetSize() <= CACHE_CAPACITY);
+    EXPECT_TRUE(shardedLru.GetSize() <= CACHE_CAPACITY + shardedLru.GetShardCount());
+    EXPECT_TRUE(shardedClock.GetMemoryUsage() <= maxMemory + shardedClock.GetShardCount() * 4096);
+
+    TestOutput::PrintInfo(std::to_string(THREAD_COUNT) + " threads x " + std::to_string(OPERATIONS_PER_THREAD) +
+                          " ops, " + std::to_string(READ_PERCENT) + "% reads, " + std::to_string(KEY_COUNT) +
+                          " keys, capacity " + std::to_string(CACHE_CAPACITY));
+    PrintThroughput("single lock LRU", singleLockMs, singleLock.GetHitRatio());
+    PrintThroughput("16 shards, LRU", shardedLruMs, shardedLru.GetHitRatio());
+    PrintThroughput("16 shards, clock", shardedClockMs, shardedClock.GetHitRatio());
+    TestOutput::PrintInfo("  sharded speedup " + StringUtils::FormatFloat(static_cast<float>(singleLockMs / std::max(shardedLruMs, 0.001)), 2) + "x");
+
+    TestOutput::PrintTestPass("mixed read/insert throughput");
+    return true;
+}
+
+/**
+ * Test trimming a large cache to a memory target
+ * Requirements: eviction by memory uses the running total instead of re-walking the cache
+ */
+bool TestEvictByMemoryScaling() {
+    TestOutput::PrintTestStart("evict by memory scaling");
+
+    auto resource = std::make_shared<BenchmarkResource>();
+    LRUResourceCache<BenchmarkResource> cache(TRIM_ENTRY_COUNT, static_cast<size_t>(TRIM_ENTRY_COUNT) * 4096);
+    for (int i = 0; i < TRIM_ENTRY_COUNT; ++i) {
+        cache.Put("resource_" + std::to_string(i), resource);
+    }
+
+    TestTimer timer;
+    cache.EvictByMemory(cache.GetMemoryUsage() / 10);
+    const double trimMs = timer.ElapsedMs();
+
+    EXPECT_EQUAL(cache.GetSize(), static_cast<size_t>(TRIM_ENTRY_COUNT / 10));
+    EXPECT_EQUAL(cache.GetEvictionCount(), static_cast<size_t>(TRIM_ENTRY_COUNT - TRIM_ENTRY_COUNT / 10));
+
+    TestOutput::PrintInfo("trimmed " + std::to_string(TRIM_ENTRY_COUNT) + " entries to 10% in " +
+                          StringUtils::FormatFloat(static_cast<float>(trimMs), 2) + " ms");
+
+    TestOutput::PrintTestPass("evict by memory scaling");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("LRU Resource Cache Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("LRU Resource Cache Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Mixed Workload Throughput", TestMixedWorkloadThroughput);
+        allPassed &= suite.RunTest("Evict By Memory Scaling", TestEvictByMemoryScaling);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -0,0 +1,416 @@
+/**
+ * Mesh Optimizer Performance Tests
+ *
+ * Vertex cache, overdraw and simplification passes on a 1M-triangle heightfield with normals
+ * and UVs, submitted in shuffled triangle order. Reports ACMR/ATVR and timings, with the
+ * previous quadratic Forsyth implementation (re-implemented here) as the baseline on a grid
+ * small enough for it to finish. Also reports how many triangles meshlet culling removes.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <thread>
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include "TestUtils.h"
+#include "Graphics/MeshOptimizer.h"
+#include "Graphics/Mesh.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr int LARGE_GRID_SIZE = 708;  // 708 * 708 * 2 = 1,002,528 triangles
+    constexpr int LEGACY_GRID_SIZE = 32;
+    constexpr uint32_t CACHE_SIZE = 32;
+
+    struct TestMesh {
+        std::vector<Vertex> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    // Rolling heightfield so simplification has curvature to preserve; triangles are shuffled
+    // to model an unoptimized exporter order
+    TestMesh CreateHeightfield(int size) {
+        TestMesh mesh;
+        mesh.vertices.reserve((size + 1) * (size + 1));
+        for (int y = 0; y <= size; ++y) {
+            for (int x = 0; x <= size; ++x) {
+                const float u = static_cast<float>(x) / size;
+                const float v = static_cast<float>(y) / size;
+                const float height = 0.05f * std::sin(u * 12.0f) * std::cos(v * 9.0f);
+                const float dx = 0.05f * 12.0f * std::cos(u * 12.0f) * std::cos(v * 9.0f);
+                const float dy = -0.05f * 9.0f * std::sin(u * 12.0f) * std::sin(v * 9.0f);
+
+                Vertex vertex = {};
+                vertex.position = Math::Vec3(u, v, height);
+                vertex.normal = glm::normalize(Math::Vec3(-dx, -dy, 1.0f));
+                vertex.texCoords = Math::Vec2(u, v);
+                mesh.vertices.push_back(vertex);
+            }
+        }
+
+        std::vector<uint32_t> triangles;
+        triangles.reserve(size * size * 6);
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                const uint32_t i0 = y * (size + 1) + x;
+                const uint32_t i1 = i0 + 1, i2 = i0 + size + 1, i3 = i2 + 1;
+                triangles.insert(triangles.end(), {i0, i1, i3, i0, i3, i2});
+            }
+        }
+
+        std::vector<uint32_t> order(triangles.size() / 3);
+        for (size_t i = 0; i < order.size(); ++i) {
+            order[i] = static_cast<uint32_t>(i);
+        }
+        std::shuffle(order.begin(), order.end(), std::mt19937(1234));
+        mesh.indices.reserve(triangles.size());
+        for (uint32_t t : order) {
+            mesh.indices.insert(mesh.indices.end(), triangles.begin() + t * 3, triangles.begin() + t * 3 + 3);
+        }
+        return mesh;
+    }
+
+    // Previous OptimizeIndices: every step rescans all triangles and scores each vertex with a
+    // linear search through the cache
+    namespace Legacy {
+        std::vector<uint32_t> OptimizeIndices(const std::vector<uint32_t>& indices, size_t vertexCount) {
+            const float CACHE_DECAY_POWER = 1.5f;
+            const float LAST_TRI_SCORE = 0.75f;
+            const float VALENCE_BOOST_SCALE = 2.0f;
+            const float VALENCE_BOOST_POWER = 0.5f;
+
+            uint32_t numTriangles = static_cast<uint32_t>(indices.size() / 3);
+            std::vector<std::vector<uint32_t>> vertexTriangles(vertexCount);
+            std::vector<bool> triangleAdded(numTriangles, false);
+            for (uint32_t i = 0; i < numTriangles; ++i) {
+                for (uint32_t k = 0; k < 3; ++k) {
+                    vertexTriangles[indices[i * 3 + k]].push_back(i);
+                }
+            }
+
+            std::vector<uint32_t> cache;
+            std::vector<uint32_t> vertexValence(vertexCount);
+            for (size_t i = 0; i < vertexCount; ++i) {
+                vertexValence[i] = static_cast<uint32_t>(vertexTriangles[i].size());
+            }
+
+            auto calculateVertexScore = [&](uint32_t vertex) -> float {
+                if (vertexValence[vertex] == 0) return -1.0f;
+                float score = 0.0f;
+                auto cacheIt = std::find(cache.begin(), cache.end(), vertex);
+                if (cacheIt != cache.end()) {
+                    uint32_t cachePos = static_cast<uint32_t>(std::distance(cache.begin(), cacheIt));
+                    if (cachePos < 3) {
+                        score = LAST_TRI_SCORE;
+                    } else {
+                        score = std::pow(1.0f - (cachePos - 3) * (1.0f / (CACHE_SIZE - 3)), CACHE_DECAY_POWER);
+                    }
+                }
+                return score + VALENCE_BOOST_SCALE * std::pow(static_cast<float>(vertexValence[vertex]), -VALENCE_BOOST_POWER);
+            };
+
+            std::vector<uint32_t> newIndices;
+            newIndices.reserve(indices.size());
+            for (uint32_t addedTriangles = 0; addedTriangles < numTriangles; ++addedTriangles) {
+                uint32_t bestTriangle = 0;
+                float bestScore = -1.0f;
+                for (uint32_t i = 0; i < numTriangles; ++i) {
+                    if (triangleAdded[i]) continue;
+                    float score = calculateVertexScore(indices[i * 3]) + calculateVertexScore(indices[i * 3 + 1]) +
+                                  calculateVertexScore(indices[i * 3 + 2]);
+                    if (score > bestScore) {
+                        bestScore = score;
+                        bestTriangle = i;
+                    }
+                }
+
+                triangleAdded[bestTriangle] = true;
+                for (uint32_t k = 0; k < 3; ++k) {
+                    const uint32_t vertex = indices[bestTriangle * 3 + k];
+                    newIndices.push_back(vertex);
+                    cache.erase(std::remove(cache.begin(), cache.end(), vertex), cache.end());
+                    cache.insert(cache.begin(), vertex);
+                    if (cache.size() > CACHE_SIZE) {
+                        cache.resize(CACHE_SIZE);
+                    }
+                }
+                for (uint32_t k = 0; k < 3; ++k) {
+                    const uint32_t vertex = indices[bestTriangle * 3 + k];
+                    auto& triangles = vertexTriangles[vertex];
+                    triangles.erase(std::remove(triangles.begin(), triangles.end(), bestTriangle), triangles.end());
+                    vertexValence[vertex] = static_cast<uint32_t>(triangles.size());
+                }
+            }
+            return newIndices;
+        }
+    }
+
+    std::string FormatMs(double ms) {
+        return StringUtils::FormatFloat(static_cast<float>(ms), 1) + " ms";
+    }
+
+    std::string FormatCacheStats(const std::vector<uint32_t>& indices, size_t vertexCount) {
+        return "ACMR " + StringUtils::FormatFloat(MeshOptimizer::CalculateACMR(indices, CACHE_SIZE), 3) +
+               ", ATVR " + StringUtils::FormatFloat(MeshOptimizer::CalculateATVR(indices, vertexCount), 3);
+    }
+
+    const TestMesh& LargeMesh() {
+        static const TestMesh mesh = CreateHeightfield(LARGE_GRID_SIZE);
+        return mesh;
+    }
+}
+
+/**
+ * Test vertex cache optimization on 1M triangles and against the previous implementation
+ * Requirements: linear-time vertex cache optimization
+ */
+bool TestVertexCacheOptimization() {
+    TestOutput::PrintTestStart("vertex cache optimization");
+
+    MeshOptimizer::SetCacheSize(CACHE_SIZE);
+
+    // Small grid: both implementations
+    const TestMesh small = CreateHeightfield(LEGACY_GRID_SIZE);
+    TestTimer legacyTimer;
+    const auto legacyIndices = Legacy::OptimizeIndices(small.indices, small.vertices.size());
+    const double legacyMs = legacyTimer.ElapsedMs();
+    TestTimer smallTimer;
+    const auto smallIndices = MeshOptimizer::OptimizeIndices(small.indices, small.vertices.size());
+    const double smallMs = smallTimer.ElapsedMs();
+
+    EXPECT_EQUAL(smallIndices.size(), small.indices.size());
+    EXPECT_TRUE(MeshOptimizer::CalculateACMR(smallIndices, CACHE_SIZE) <= MeshOptimizer::CalculateACMR(legacyIndices, CACHE_SIZE) + 0.05f);
+
+    TestOutput::PrintInfo(std::to_string(small.indices.size() / 3) + " triangles, shuffled: " +
+                          FormatCacheStats(small.indices, small.vertices.size()));
+    TestOutput::PrintInfo("  previous Forsyth: " + FormatMs(legacyMs) + ", " + FormatCacheStats(legacyIndices, small.vertices.size()));
+    TestOutput::PrintInfo("  linear Forsyth:   " + FormatMs(smallMs) + ", " + FormatCacheStats(smallIndices, small.vertices.size()));
+
+    // 1M triangles: linear version only
+    const TestMesh& large = LargeMesh();
+    TestTimer largeTimer;
+    const auto largeIndices = MeshOptimizer::OptimizeIndices(large.indices, large.vertices.size());
+    const double largeMs = largeTimer.ElapsedMs();
+
+    EXPECT_EQUAL(largeIndices.size(), large.indices.size());
+    const float shuffledACMR = MeshOptimizer::CalculateACMR(large.indices, CACHE_SIZE);
+    const float optimizedACMR = MeshOptimizer::CalculateACMR(largeIndices, CACHE_SIZE);
+    EXPECT_TRUE(optimizedACMR < shuffledACMR * 0.5f);
+    EXPECT_TRUE(optimizedACMR < 0.8f);
+
+    TestOutput::PrintInfo(std::to_string(large.indices.size() / 3) + " triangles, shuffled: " +
+                          FormatCacheStats(large.indices, large.vertices.size()));
+    TestOutput::PrintInfo("  linear Forsyth:   " + FormatMs(largeMs) + ", " + FormatCacheStats(largeIndices, large.vertices.size()) +
+                          " (" + StringUtils::FormatFloat(static_cast<float>(large.indices.size() / 3 / std::max(largeMs, 0.001) / 1000.0), 2) +
+                          " M triangles/s)");
+
+    TestOutput::PrintTestPass("vertex cache optimization");
+    return true;
+}
+
+/**
+ * Test cluster-based overdraw ordering on 1M triangles
+ * Requirements: overdraw sorting that keeps cache efficiency within the threshold
+ */
+bool TestOverdrawOptimization() {
+    TestOutput::PrintTestStart("overdraw optimization");
+
+    const TestMesh& large = LargeMesh();
+    const auto cacheOptimized = MeshOptimizer::OptimizeIndices(large.indices, large.vertices.size());
+
+    TestTimer timer;
+    const auto overdrawOptimized = MeshOptimizer::OptimizeOverdrawIndices(cacheOptimized, large.vertices, 1.05f);
+    const double overdrawMs = timer.ElapsedMs();
+
+    EXPECT_EQUAL(overdrawOptimized.size(), cacheOptimized.size());
+    const float cacheACMR = MeshOptimizer::CalculateACMR(cacheOptimized, CACHE_SIZE);
+    const float overdrawACMR = MeshOptimizer::CalculateACMR(overdrawOptimized, CACHE_SIZE);
+    EXPECT_TRUE(overdrawACMR < cacheACMR * 1.25f);
+
+    TestOutput::PrintInfo("Cluster sort (threshold 1.05): " + FormatMs(overdrawMs) + ", ACMR " +
+                          StringUtils::FormatFloat(cacheACMR, 3) + " -> " + StringUtils::FormatFloat(overdrawACMR, 3));
+
+    TestOutput::PrintTestPass("overdraw optimization");
+    return true;
+}
+
+/**
+ * Test quadric simplification of 1M triangles to several targets
+ * Requirements: attribute-aware quadric simplification with a priority queue
+ */
+bool TestSimplification() {
+    TestOutput::PrintTestStart("simplification");
+
+    const TestMesh& large = LargeMesh();
+    const size_t triangleCount = large.indices.size() / 3;
+
+    for (float ratio : {0.5f, 0.1f, 0.01f}) {
+        SimplificationOptions options;
+        options.targetTriangles = static_cast<uint32_t>(triangleCount * ratio);
+
+        float error = 0.0f;
+        TestTimer timer;
+        const auto simplified = MeshOptimizer::SimplifyIndices(large.vertices, large.indices, options, &error);
+        const double simplifyMs = timer.ElapsedMs();
+
+        EXPECT_TRUE(simplified.size() / 3 <= options.targetTriangles);
+        EXPECT_TRUE(error < 0.01f);
+
+        TestOutput::PrintInfo(std::to_string(triangleCount) + " -> " + std::to_string(simplified.size() / 3) +
+                              " triangles: " + FormatMs(simplifyMs) + ", relative error " +
+                              StringUtils::FormatFloat(error, 5));
+    }
+
+    TestOutput::PrintTestPass("simplification");
+    return true;
+}
+
+/**
+ * Test LOD chain generation with levels in parallel against simplifying them one by one
+ * Requirements: GenerateLODChain parallel over LOD levels
+ */
+bool TestLODChainGeneration() {
+    TestOutput::PrintTestStart("LOD chain generation");
+
+    const TestMesh& large = LargeMesh();
+    Mesh mesh;
+    mesh.SetVertices(large.vertices);
+    mesh.SetIndices(large.indices);
+    const std::vector<float> ratios = {0.5f, 0.25f, 0.1f, 0.05f};
+
+    TestTimer serialTimer;
+    std::vector<std::shared_ptr<Mesh>> serialChain;
+    for (float ratio : ratios) {
+        serialChain.push_back(MeshOptimizer::Simplify(mesh, ratio));
+    }
+    const double serialMs = serialTimer.ElapsedMs();
+
+    TestTimer parallelTimer;
+    const auto chain = MeshOptimizer::GenerateLODChain(mesh, ratios);
+    const double parallelMs = parallelTimer.ElapsedMs();
+
+    EXPECT_EQUAL(chain.size(), ratios.size() + 1);
+    for (size_t i = 0; i < serialChain.size() && i + 1 < chain.size(); ++i) {
+        EXPECT_EQUAL(chain[i + 1]->GetTriangleCount(), serialChain[i]->GetTriangleCount());
+    }
+
+    TestOutput::PrintInfo(std::to_string(ratios.size()) + " levels, " + std::to_string(std::thread::hardware_concurrency()) +
+                          " hardware threads");
+    TestOutput::PrintInfo("  one by one: " + FormatMs(serialMs));
+    TestOutput::PrintInfo("  parallel:   " + FormatMs(parallelMs) + " (speedup " +
+                          StringUtils::FormatFloat(static_cast<float>(serialMs / std::max(parallelMs, 0.001)), 2) + "x)");
+
+    TestOutput::PrintTestPass("LOD chain generation");
+    return true;
+}
+
+/**
+ * Test meshlet building and culling on 1M triangles
+ * Requirements: meshlets with bounds and normal cones; frustum and backface cone culling
+ * that only drops triangles which are outside the view or facing away
+ */
+bool TestMeshletCulling() {
+    TestOutput::PrintTestStart("meshlet culling");
+
+    const TestMesh& large = LargeMesh();
+    const auto cacheOptimized = MeshOptimizer::OptimizeIndices(large.indices, large.vertices.size());
+
+    TestTimer buildTimer;
+    const MeshletData meshlets = MeshOptimizer::BuildMeshlets(large.vertices, cacheOptimized);
+    const double buildMs = buildTimer.ElapsedMs();
+    EXPECT_FALSE(meshlets.IsEmpty());
+
+    const size_t triangleCount = cacheOptimized.size() / 3;
+    TestOutput::PrintInfo(std::to_string(meshlets.meshlets.size()) + " meshlets (" +
+                          StringUtils::FormatFloat(static_cast<float>(meshlets.vertices.size()) / meshlets.meshlets.size(), 1) + " vertices, " +
+                          StringUtils::FormatFloat(static_cast<float>(triangleCount) / meshlets.meshlets.size(), 1) +
+                          " triangles on average) in " + FormatMs(buildMs));
+
+    // Top-down view of one quarter of the heightfield
+    const Math::Mat4 quarterView(Math::Vec4(4.0f, 0.0f, 0.0f, 0.0f), Math::Vec4(0.0f, 4.0f, 0.0f, 0.0f),
+                                 Math::Vec4(0.0f, 0.0f, 0.5f, 0.0f), Math::Vec4(-1.0f, -1.0f, 0.0f, 1.0f));
+    std::vector<uint32_t> visible;
+    TestTimer cullTimer;
+    const size_t visibleMeshlets = MeshOptimizer::CullMeshlets(meshlets, Frustum::FromMatrix(quarterView),
+                                                               Math::Vec3(0.25f, 0.25f, 1.0f), visible);
+    const double cullMs = cullTimer.ElapsedMs();
+    EXPECT_TRUE(visible.size() / 3 >= triangleCount / 4);
+    EXPECT_TRUE(visible.size() / 3 < triangleCount / 2);
+    TestOutput::PrintInfo("Quarter view: " + std::to_string(visibleMeshlets) + " meshlets, " +
+                          StringUtils::FormatFloat(100.0f * visible.size() / cacheOptimized.size(), 1) +
+                          "% of triangles submitted, culled in " + FormatMs(cullMs));
+
+    // Grazing view from the side: the cones drop slopes facing away, and only those
+    const Frustum everything = Frustum::FromMatrix(Math::Mat4(Math::Vec4(0.1f, 0.0f, 0.0f, 0.0f), Math::Vec4(0.0f, 0.1f, 0.0f, 0.0f),
+                                                              Math::Vec4(0.0f, 0.0f, 0.1f, 0.0f), Math::Vec4(0.0f, 0.0f, 0.0f, 1.0f)));
+    const Math::Vec3 viewer(3.0f, 0.5f, 0.02f);
+    std::vector<uint32_t> all;
+    MeshOptimizer::CullMeshlets(meshlets, everything, viewer, all, false);
+    MeshOptimizer::CullMeshlets(meshlets, everything, viewer, visible);
+    EXPECT_EQUAL(all.size(), cacheOptimized.size());
+    EXPECT_TRUE(visible.size() < all.size());
+
+    auto toTriangles = [](const std::vector<uint32_t>& indices) {
+        std::vector<std::array<uint32_t, 3>> triangles(indices.size() / 3);
+        for (size_t i = 0; i < triangles.size(); ++i) {
+            triangles[i] = {indices[i * 3], indices[i * 3 + 1], indices[i * 3 + 2]};
+        }
+        std::sort(triangles.begin(), triangles.end());
+        return triangles;
+    };
+    const auto allTriangles = toTriangles(all);
+    const auto visibleTriangles = toTriangles(visible);
+    std::vector<std::array<uint32_t, 3>> culled;
+    std::set_difference(allTriangles.begin(), allTriangles.end(), visibleTriangles.begin(), visibleTriangles.end(),
+                        std::back_inserter(culled));
+    for (const auto& triangle : culled) {
+        const Math::Vec3& p0 = large.vertices[triangle[0]].position;
+        const Math::Vec3 normal = glm::cross(large.vertices[triangle[1]].position - p0, large.vertices[triangle[2]].position - p0);
+        EXPECT_TRUE(glm::dot(normal, viewer - p0) <= 0.0f);
+    }
+    TestOutput::PrintInfo("Grazing view: backface cones drop " +
+                          StringUtils::FormatFloat(100.0f * culled.size() / allTriangles.size(), 1) + "% of triangles");
+
+    TestOutput::PrintTestPass("meshlet culling");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Mesh Optimizer Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Mesh Optimizer Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Vertex Cache Optimization", TestVertexCacheOptimization);
+        allPassed &= suite.RunTest("Overdraw Optimization", TestOverdrawOptimization);
+        allPassed &= suite.RunTest("Simplification", TestSimplification);
+        allPassed &= suite.RunTest("LOD Chain Generation", TestLODChainGeneration);
+        allPassed &= suite.RunTest("Meshlet Culling", TestMeshletCulling);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -0,0 +1,210 @@
+/**
+ * Model Cache Performance Tests
+ *
+ * Load time of a large multi-mesh model from the memory-mapped cache container against
+ * the previous stream-based cache format (per-mesh name, count and array reads through
+ * std::ifstream into temporary vectors).
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <filesystem>
+#include "TestUtils.h"
+#include "Resource/ModelCache.h"
+#include "Graphics/Model.h"
+#include "Graphics/Mesh.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr int MESH_COUNT = 32;
+    constexpr uint32_t VERTICES_PER_MESH = 16384;
+    constexpr int LOAD_ITERATIONS = 5;
+
+    const std::string CACHE_DIRECTORY = "perf_model_cache";
+    const std::string SOURCE_PATH = "perf_model_cache_source.obj";
+    const std::string LEGACY_PATH = "perf_model_cache_legacy.kmc";
+
+    std::shared_ptr<Model> CreateLargeModel() {
+        auto model = std::make_shared<Model>(SOURCE_PATH);
+        model->SetName("LargeScene");
+
+        std::vector<std::shared_ptr<Mesh>> meshes;
+        for (int m = 0; m < MESH_COUNT; ++m) {
+            std::vector<Vertex> vertices(VERTICES_PER_MESH);
+            for (uint32_t i = 0; i < VERTICES_PER_MESH; ++i) {
+                const float x = static_cast<float>(i % 128);
+                const float z = static_cast<float>(i / 128);
+                vertices[i].position = Math::Vec3(x + m * 200.0f, 0.0f, z);
+                vertices[i].normal = Math::Vec3(0.0f, 1.0f, 0.0f);
+                vertices[i].texCoords = Math::Vec2(x / 128.0f, z / 128.0f);
+            }
+
+            // Grid triangulation, two triangles per cell
+            std::vector<uint32_t> indices;
+            indices.reserve(127 * 127 * 6);
+            for (uint32_t row = 0; row + 1 < VERTICES_PER_MESH / 128; ++row) {
+                for (uint32_t col = 0; col + 1 < 128; ++col) {
+                    const uint32_t i = row * 128 + col;
+                    indices.insert(indices.end(), {i, i + 128, i + 1, i + 1, i + 128, i + 129});
+                }
+            }
+
+            auto mesh = std::make_shared<Mesh>("mesh_" + std::to_string(m));
+            mesh->SetName("mesh_" + std::to_string(m));
+            mesh->SetVertices(vertices);
+            mesh->SetIndices(indices);
+            meshes.push_back(mesh);
+        }
+        model->SetMeshes(meshes);
+        return model;
+    }
+
+    // The previous cache layout: every mesh as a length-prefixed name, vertex count, vertices, index count, indices
+    void WriteLegacyCache(const Model& model, const std::string& path) {
+        std::ofstream file(path, std::ios::binary);
+        auto meshes = model.GetMeshes();
+        uint32_t meshCount = static_cast<uint32_t>(meshes.size());
+        file.write(reinterpret_cast<const char*>(&meshCount), sizeof(meshCount));
+        for (const auto& mesh : meshes) {
+            uint32_t nameLength = static_cast<uint32_t>(mesh->GetName().size());
+            file.write(reinterpret_cast<const char*>(&nameLength), sizeof(nameLength));
+            file.write(mesh->GetName().data(), nameLength);
+
+            auto vertices = mesh->GetVertices();
+            uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+            file.write(reinterpret_cast<const char*>(&vertexCount), sizeof(vertexCount));
+            file.write(reinterpret_cast<const char*>(vertices.data()), vertexCount * sizeof(Vertex));
+
+            auto indices = mesh->GetIndices();
+            uint32_t indexCount = static_cast<uint32_t>(indices.size());
+            file.write(reinterpret_cast<const char*>(&indexCount), sizeof(indexCount));
+            file.write(reinterpret_cast<const char*>(indices.data()), indexCount * sizeof(uint32_t));
+        }
+    }
+
+    std::shared_ptr<Model> ReadLegacyCache(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        auto model = std::make_shared<Model>(SOURCE_PATH);
+
+        uint32_t meshCount = 0;
+        file.read(reinterpret_cast<char*>(&meshCount), sizeof(meshCount));
+        std::vector<std::shared_ptr<Mesh>> meshes;
+        for (uint32_t m = 0; m < meshCount; ++m) {
+            uint32_t nameLength = 0;
+            file.read(reinterpret_cast<char*>(&nameLength), sizeof(nameLength));
+            std::string name(nameLength, '\0');
+            file.read(&name[0], nameLength);
+            auto mesh = std::make_shared<Mesh>(name);
+
+            uint32_t vertexCount = 0;
+            file.read(reinterpret_cast<char*>(&vertexCount), sizeof(vertexCount));
+            std::vector<Vertex> vertices(vertexCount);
+            file.read(reinterpret_cast<char*>(vertices.data()), vertexCount * sizeof(Vertex));
+            mesh->SetVertices(vertices);
+
+            uint32_t indexCount = 0;
+            file.read(reinterpret_cast<char*>(&indexCount), sizeof(indexCount));
+            std::vector<uint32_t> indices(indexCount);
+            file.read(reinterpret_cast<char*>(indices.data()), indexCount * sizeof(uint32_t));
+            mesh->SetIndices(indices);
+
+            meshes.push_back(mesh);
+        }
+        model->SetMeshes(meshes);
+        return model;
+    }
+}
+
+/**
+ * Test loading a large model from the mapped cache against the stream format
+ * Requirements: cache loads build meshes straight from the mapped file
+ */
+bool TestLargeModelLoad() {
+    TestOutput::PrintTestStart("large model cache load");
+
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+    {
+        std::ofstream source(SOURCE_PATH);
+        source << "# Stand-in source file for cache validation\n";
+    }
+
+    auto model = CreateLargeModel();
+
+    ModelCache cache;
+    EXPECT_TRUE(cache.Initialize(CACHE_DIRECTORY));
+    EXPECT_TRUE(cache.SaveToCache(SOURCE_PATH, model));
+    WriteLegacyCache(*model, LEGACY_PATH);
+
+    const size_t cacheSize = std::filesystem::file_size(cache.GetCachePath(SOURCE_PATH));
+    const size_t legacySize = std::filesystem::file_size(LEGACY_PATH);
+
+    // Both files are in the page cache after writing; take the best of several loads
+    double mappedBest = 1e9;
+    double legacyBest = 1e9;
+    std::shared_ptr<Model> mappedModel;
+    std::shared_ptr<Model> legacyModel;
+    for (int i = 0; i < LOAD_ITERATIONS; ++i) {
+        TestTimer legacyTimer;
+        legacyModel = ReadLegacyCache(LEGACY_PATH);
+        legacyBest = std::min(legacyBest, legacyTimer.ElapsedMs());
+
+        TestTimer mappedTimer;
+        mappedModel = cache.LoadFromCache(SOURCE_PATH);
+        mappedBest = std::min(mappedBest, mappedTimer.ElapsedMs());
+    }
+
+    EXPECT_NOT_NULL(mappedModel);
+    EXPECT_NOT_NULL(legacyModel);
+    EXPECT_EQUAL(mappedModel->GetMeshes().size(), static_cast<size_t>(MESH_COUNT));
+    EXPECT_EQUAL(mappedModel->GetMeshes().back()->GetVertexCount(), VERTICES_PER_MESH);
+    EXPECT_EQUAL(mappedModel->GetMeshes().back()->GetIndices().size(), model->GetMeshes().back()->GetIndices().size());
+
+    TestOutput::PrintInfo(std::to_string(MESH_COUNT) + " meshes x " + std::to_string(VERTICES_PER_MESH) + " vertices");
+    TestOutput::PrintInfo("stream format: " + std::to_string(legacySize / 1024 / 1024) + " MB, " +
+                          StringUtils::FormatFloat(static_cast<float>(legacyBest), 1) + " ms");
+    TestOutput::PrintInfo("mapped format: " + std::to_string(cacheSize / 1024 / 1024) + " MB, " +
+                          StringUtils::FormatFloat(static_cast<float>(mappedBest), 1) + " ms");
+    TestOutput::PrintInfo("  speedup " + StringUtils::FormatFloat(static_cast<float>(legacyBest / std::max(mappedBest, 0.001)), 2) + "x");
+
+    cache.Shutdown();
+    std::filesystem::remove_all(CACHE_DIRECTORY);
+    std::filesystem::remove(SOURCE_PATH);
+    std::filesystem::remove(LEGACY_PATH);
+
+    TestOutput::PrintTestPass("large model cache load");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Model Cache Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Model Cache Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Large Model Load", TestLargeModelLoad);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
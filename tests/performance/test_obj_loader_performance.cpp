@@ -0,0 +1,277 @@
+/**
+ * OBJ Loader Performance Tests
+ *
+ * Load time of a large multi-group OBJ file with MeshLoader's chunked from_chars parser
+ * over a memory-mapped file, against the previous getline/istringstream parser, which is
+ * re-implemented here as the baseline.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <thread>
+#include "TestUtils.h"
+#include "Resource/MeshLoader.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr int GRID_SIZE = 400;
+    constexpr int GROUP_COUNT = 24;
+    constexpr int LOAD_ITERATIONS = 3;
+
+    const std::string FIXTURE_PATH = "perf_obj_loader_fixture.obj";
+
+    // A GRID_SIZE x GRID_SIZE quad grid with normals and UVs, split into groups with
+    // alternating materials
+    void WriteFixture(const std::string& path) {
+        std::ofstream file(path, std::ios::binary);
+        file << "# OBJ loader benchmark fixture\n";
+        file << "o benchmark\n";
+        for (int z = 0; z <= GRID_SIZE; ++z) {
+            for (int x = 0; x <= GRID_SIZE; ++x) {
+                file << "v " << x * 0.125f << " " << ((x * z) % 17) * 0.0625f << " " << z * -0.125f << "\n";
+                file << "vt " << static_cast<float>(x) / GRID_SIZE << " " << static_cast<float>(z) / GRID_SIZE << "\n";
+                file << "vn 0 1 0\n";
+            }
+        }
+
+        const int rowsPerGroup = GRID_SIZE / GROUP_COUNT;
+        for (int z = 0; z < GRID_SIZE; ++z) {
+            if (z % rowsPerGroup == 0) {
+                const int group = z / rowsPerGroup;
+                file << "g group_" << group << "\n";
+                file << "usemtl material_" << (group % 3) << "\n";
+            }
+            for (int x = 0; x < GRID_SIZE; ++x) {
+                // OBJ indices are 1-based
+                const int i0 = z * (GRID_SIZE + 1) + x + 1;
+                const int i1 = i0 + 1;
+                const int i2 = i0 + GRID_SIZE + 1;
+                const int i3 = i2 + 1;
+                file << "f " << i0 << "/" << i0 << "/" << i0 << " "
+                     << i2 << "/" << i2 << "/" << i2 << " "
+                     << i3 << "/" << i3 << "/" << i3 << " "
+                     << i1 << "/" << i1 << "/" << i1 << "\n";
+            }
+        }
+    }
+
+    // Previous parser: std::getline per line, an istringstream per attribute line and
+    // SplitString for every face and face corner
+    namespace Legacy {
+        struct ParseState {
+            std::vector<Math::Vec3> positions;
+            std::vector<Math::Vec3> normals;
+            std::vector<Math::Vec2> texCoords;
+            std::string currentMaterial;
+            std::string currentGroup;
+            std::vector<MeshLoader::MeshData> meshes;
+            MeshLoader::MeshData currentMesh;
+            bool hasFaces = false;
+        };
+
+        std::string TrimString(const std::string& str) {
+            size_t start = str.find_first_not_of(" \t\r\n");
+            if (start == std::string::npos) return "";
+            size_t end = str.find_last_not_of(" \t\r\n");
+            return str.substr(start, end - start + 1);
+        }
+
+        std::vector<std::string> SplitString(const std::string& str, char delimiter) {
+            std::vector<std::string> tokens;
+            std::stringstream ss(str);
+            std::string token;
+            while (std::getline(ss, token, delimiter)) {
+                token = TrimString(token);
+                if (!token.empty()) {
+                    tokens.push_back(token);
+                }
+            }
+            return tokens;
+        }
+
+        void FinishMesh(ParseState& state) {
+            if (!state.currentMesh.vertices.empty()) {
+                state.currentMesh.isValid = true;
+                state.meshes.push_back(state.currentMesh);
+            }
+            state.currentMesh = MeshLoader::MeshData();
+            state.currentMesh.groupName = state.currentGroup;
+            state.currentMesh.materialName = state.currentMaterial;
+            state.hasFaces = false;
+        }
+
+        bool ParseFace(const std::string& line, ParseState& state) {
+            std::vector<std::string> vertices = SplitString(line.substr(2), ' ');
+            if (vertices.size() < 3) {
+                return false;
+            }
+            for (size_t i = 1; i < vertices.size() - 1; ++i) {
+                std::vector<std::string> triangleVertices = {vertices[0], vertices[i], vertices[i + 1]};
+                for (const std::string& vertexStr : triangleVertices) {
+                    Vertex vertex = {};
+                    std::vector<std::string> indices = SplitString(vertexStr, '/');
+                    if (indices.empty()) continue;
+
+                    int posIndex = std::stoi(indices[0]) - 1;
+                    if (posIndex < 0 || posIndex >= static_cast<int>(state.positions.size())) {
+                        return false;
+                    }
+                    vertex.position = state.positions[posIndex];
+                    if (indices.size() > 1) {
+                        int texIndex = std::stoi(indices[1]) - 1;
+                        if (texIndex >= 0 && texIndex < static_cast<int>(state.texCoords.size())) {
+                            vertex.texCoords = state.texCoords[texIndex];
+                        }
+                    }
+                    if (indices.size() > 2) {
+                        int normalIndex = std::stoi(indices[2]) - 1;
+                        if (normalIndex >= 0 && normalIndex < static_cast<int>(state.normals.size())) {
+                            vertex.normal = state.normals[normalIndex];
+                        }
+                    }
+                    state.currentMesh.vertices.push_back(vertex);
+                    state.currentMesh.indices.push_back(static_cast<uint32_t>(state.currentMesh.vertices.size() - 1));
+                }
+            }
+            state.hasFaces = true;
+            return true;
+        }
+
+        std::vector<MeshLoader::MeshData> LoadOBJ(const std::string& filepath) {
+            std::ifstream file(filepath);
+            ParseState state;
+            std::string line;
+            while (std::getline(file, line)) {
+                line = TrimString(line);
+                if (line.empty() || line[0] == '#') {
+                    continue;
+                }
+                if (line.substr(0, 2) == "v ") {
+                    Math::Vec3 v;
+                    std::istringstream iss(line.substr(2));
+                    if (iss >> v.x >> v.y >> v.z) state.positions.push_back(v);
+                } else if (line.substr(0, 3) == "vn ") {
+                    Math::Vec3 n;
+                    std::istringstream iss(line.substr(3));
+                    if (iss >> n.x >> n.y >> n.z) state.normals.push_back(n);
+                } else if (line.substr(0, 3) == "vt ") {
+                    Math::Vec2 t;
+                    std::istringstream iss(line.substr(3));
+                    if (iss >> t.x >> t.y) {
+                        t.y = 1.0f - t.y;
+                        state.texCoords.push_back(t);
+                    }
+                } else if (line.substr(0, 2) == "f ") {
+                    ParseFace(line, state);
+                } else if (line.substr(0, 7) == "usemtl ") {
+                    std::string name = TrimString(line.substr(7));
+                    if (state.hasFaces && state.currentMaterial != name) {
+                        FinishMesh(state);
+                    }
+                    state.currentMaterial = name;
+                    state.currentMesh.materialName = name;
+                } else if (line.substr(0, 2) == "g ") {
+                    std::string name = TrimString(line.substr(2));
+                    if (state.hasFaces && state.currentGroup != name) {
+                        FinishMesh(state);
+                    }
+                    state.currentGroup = name;
+                    state.currentMesh.groupName = name;
+                }
+            }
+            if (state.hasFaces) {
+                FinishMesh(state);
+            }
+            return std::move(state.meshes);
+        }
+    }
+}
+
+/**
+ * Test loading a large multi-group OBJ with the chunked parser against the previous parser
+ * Requirements: allocation-free tokenization over a mapped file, split across cores at line
+ * boundaries, with group and material order preserved
+ */
+bool TestLargeOBJLoad() {
+    TestOutput::PrintTestStart("large OBJ load");
+
+    WriteFixture(FIXTURE_PATH);
+    const auto fileSize = std::filesystem::file_size(FIXTURE_PATH);
+
+    double legacyMs = 1e9;
+    std::vector<MeshLoader::MeshData> legacyMeshes;
+    for (int i = 0; i < LOAD_ITERATIONS; ++i) {
+        TestTimer timer;
+        legacyMeshes = Legacy::LoadOBJ(FIXTURE_PATH);
+        legacyMs = std::min(legacyMs, timer.ElapsedMs());
+    }
+
+    double chunkedMs = 1e9;
+    MeshLoader::OBJLoadResult result;
+    for (int i = 0; i < LOAD_ITERATIONS; ++i) {
+        TestTimer timer;
+        result = MeshLoader::LoadOBJWithMaterials(FIXTURE_PATH);
+        chunkedMs = std::min(chunkedMs, timer.ElapsedMs());
+    }
+
+    // Same meshes in the same order
+    EXPECT_TRUE(result.success);
+    EXPECT_EQUAL(result.meshes.size(), legacyMeshes.size());
+    for (size_t i = 0; i < result.meshes.size() && i < legacyMeshes.size(); ++i) {
+        EXPECT_EQUAL(result.meshes[i].groupName, legacyMeshes[i].groupName);
+        EXPECT_EQUAL(result.meshes[i].materialName, legacyMeshes[i].materialName);
+        EXPECT_EQUAL(result.meshes[i].vertices.size(), legacyMeshes[i].vertices.size());
+    }
+
+    const double megabytes = static_cast<double>(fileSize) / (1024.0 * 1024.0);
+    TestOutput::PrintInfo(StringUtils::FormatFloat(static_cast<float>(megabytes), 1) + " MB, " +
+                          std::to_string(result.meshes.size()) + " meshes, " +
+                          std::to_string(result.totalTriangles) + " triangles, " +
+                          std::to_string(std::thread::hardware_concurrency()) + " hardware threads");
+    TestOutput::PrintInfo("getline/istringstream: " + StringUtils::FormatFloat(static_cast<float>(legacyMs), 1) + " ms (" +
+                          StringUtils::FormatFloat(static_cast<float>(megabytes * 1000.0 / legacyMs), 1) + " MB/s, parse only)");
+    TestOutput::PrintInfo("chunked from_chars:    " + StringUtils::FormatFloat(static_cast<float>(chunkedMs), 1) + " ms (" +
+                          StringUtils::FormatFloat(static_cast<float>(megabytes * 1000.0 / chunkedMs), 1) + " MB/s, with validation)");
+    TestOutput::PrintInfo("  speedup " + StringUtils::FormatFloat(static_cast<float>(legacyMs / std::max(chunkedMs, 0.001)), 2) + "x");
+
+    std::filesystem::remove(FIXTURE_PATH);
+
+    TestOutput::PrintTestPass("large OBJ load");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("OBJ Loader Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("OBJ Loader Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Large OBJ Load", TestLargeOBJLoad);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
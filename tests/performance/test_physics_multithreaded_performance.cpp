@@ -0,0 +1,199 @@
+/**
+ * Multithreaded Physics Performance Tests
+ *
+ * 5,000 boxes in 500 stacks of ten on a ground slab, stepped for three seconds of simulated
+ * time by the single-threaded world and twice by the multithreaded world (parallel narrowphase,
+ * islands solved on a solver pool, loops on a JobSystem). The second multithreaded run steps
+ * from a frame-graph job on a worker, as the engine does. The two multithreaded runs must end
+ * in bit-identical transforms, and every stack must still be standing in all three.
+ */
+
+#ifdef GAMEENGINE_HAS_BULLET
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "TestUtils.h"
+#include "Physics/PhysicsEngine.h"
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr int STACKS_X = 25;
+    constexpr int STACKS_Z = 20;
+    constexpr int STACK_HEIGHT = 10;
+    constexpr float STACK_SPACING = 3.0f;
+    constexpr float LAYER_HEIGHT = 1.01f;    // Unit boxes with a small gap so none start overlapping
+    constexpr int STEPS = 180;
+
+    struct SimulationRun {
+        double elapsedMs = 0.0;
+        int threads = 1;
+        std::vector<Math::Vec3> positions;
+        std::vector<Math::Quat> rotations;
+        float lowestTop = 0.0f;              // Lowest top box, to check that no stack fell
+    };
+
+    // Without a job system the world is single-threaded; with stepFromGraph each step runs in
+    // a "Physics" job of a frame graph instead of on this thread
+    SimulationRun Simulate(JobSystem* jobSystem, bool stepFromGraph) {
+        PhysicsConfiguration config = PhysicsConfiguration::Default();
+        config.multithreadedSimulation = jobSystem != nullptr;
+        PhysicsEngine engine;
+        engine.SetJobSystem(jobSystem);
+        engine.Initialize(config);
+
+        RigidBody groundDesc;
+        groundDesc.position = Math::Vec3(STACKS_X * STACK_SPACING * 0.5f, -0.5f, STACKS_Z * STACK_SPACING * 0.5f);
+        groundDesc.isStatic = true;
+        CollisionShape groundShape;
+        groundShape.type = CollisionShape::Box;
+        groundShape.dimensions = Math::Vec3(STACKS_X * STACK_SPACING + 10.0f, 1.0f, STACKS_Z * STACK_SPACING + 10.0f);
+        engine.CreateRigidBody(groundDesc, groundShape);
+
+        CollisionShape boxShape;
+        boxShape.type = CollisionShape::Box;
+        boxShape.dimensions = Math::Vec3(1.0f);
+
+        std::vector<uint32_t> bodyIds;
+        for (int z = 0; z < STACKS_Z; ++z) {
+            for (int x = 0; x < STACKS_X; ++x) {
+                for (int level = 0; level < STACK_HEIGHT; ++level) {
+                    RigidBody desc;
+                    desc.position = Math::Vec3(x * STACK_SPACING, 0.5f + level * LAYER_HEIGHT, z * STACK_SPACING);
+                    desc.restitution = 0.0f;
+                    bodyIds.push_back(engine.CreateRigidBody(desc, boxShape));
+                }
+            }
+        }
+
+        SimulationRun run;
+        run.threads = engine.GetSimulationThreadCount();
+
+        JobGraph frameGraph;
+        frameGraph.AddJob("Physics", [&]() { engine.Update(config.timeStep); });
+
+        TestTimer timer;
+        for (int step = 0; step < STEPS; ++step) {
+            if (stepFromGraph) {
+                jobSystem->RunAndWait(frameGraph);
+            } else {
+                engine.Update(config.timeStep);
+            }
+        }
+        run.elapsedMs = timer.ElapsedMs();
+
+        run.positions.resize(bodyIds.size());
+        run.rotations.resize(bodyIds.size());
+        for (size_t i = 0; i < bodyIds.size(); ++i) {
+            engine.GetRigidBodyTransform(bodyIds[i], run.positions[i], run.rotations[i]);
+        }
+
+        run.lowestTop = run.positions[STACK_HEIGHT - 1].y;
+        for (size_t i = STACK_HEIGHT - 1; i < run.positions.size(); i += STACK_HEIGHT) {
+            run.lowestTop = std::min(run.lowestTop, run.positions[i].y);
+        }
+        return run;
+    }
+
+    std::string FormatMs(double ms) {
+        return StringUtils::FormatFloat(static_cast<float>(ms)) + " ms";
+    }
+}
+
+/**
+ * Test determinism and step time of the multithreaded world on 5k stacked bodies
+ * Requirements: Opt-in multithreaded Bullet world with a parallel solver pool
+ */
+bool TestStackedBodies() {
+    TestOutput::PrintTestStart("5k stacked bodies");
+
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
+    const SimulationRun single = Simulate(nullptr, false);
+    const SimulationRun first = Simulate(&jobSystem, false);
+    const SimulationRun second = Simulate(&jobSystem, true);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < first.positions.size(); ++i) {
+        if (first.positions[i] != second.positions[i] || first.rotations[i] != second.rotations[i]) {
+            ++mismatches;
+        }
+    }
+
+    const int bodyCount = STACKS_X * STACKS_Z * STACK_HEIGHT;
+    const double speedup = single.elapsedMs / std::max(std::min(first.elapsedMs, second.elapsedMs), 0.001);
+    TestOutput::PrintInfo(std::to_string(bodyCount) + " bodies in " + std::to_string(STACKS_X * STACKS_Z) +
+                          " stacks, " + std::to_string(STEPS) + " steps");
+    TestOutput::PrintInfo("  Single-threaded: " + FormatMs(single.elapsedMs / STEPS) + "/step");
+    TestOutput::PrintInfo("  Multithreaded (" + std::to_string(first.threads) + " threads): " +
+                          FormatMs(first.elapsedMs / STEPS) + "/step, " + FormatMs(second.elapsedMs / STEPS) +
+                          "/step (" + StringUtils::FormatFloat(static_cast<float>(speedup)) + "x)");
+    TestOutput::PrintInfo("  Bodies differing between multithreaded runs (main thread, frame graph): " +
+                          std::to_string(mismatches));
+    if (first.threads > 2 && speedup < 1.0) {
+        TestOutput::PrintWarning("No speedup; Bullet may have been built without BT_THREADSAFE");
+    }
+
+    EXPECT_TRUE(first.threads > 1);
+    EXPECT_EQUAL(mismatches, static_cast<size_t>(0));
+
+    // Top boxes start at 9.59 and settle a little; a toppled stack leaves one far lower
+    const float standingHeight = (STACK_HEIGHT - 1) * LAYER_HEIGHT;
+    EXPECT_TRUE(single.lowestTop > standingHeight);
+    EXPECT_TRUE(first.lowestTop > standingHeight);
+
+    jobSystem.Shutdown();
+
+    TestOutput::PrintTestPass("5k stacked bodies");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Multithreaded Physics Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Multithreaded Physics Performance Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Stacked Bodies", TestStackedBodies);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
+
+#else
+
+#include "TestUtils.h"
+
+using namespace GameEngine::Testing;
+
+int main() {
+    TestOutput::PrintHeader("Multithreaded Physics Performance");
+    TestOutput::PrintWarning("Bullet Physics not available - multithreaded physics performance tests skipped");
+    TestOutput::PrintFooter(true);
+    return 0;
+}
+
+#endif // GAMEENGINE_HAS_BULLET
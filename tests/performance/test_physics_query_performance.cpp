@@ -0,0 +1,310 @@
+/**
+ * Physics Query Performance Tests
+ *
+ * Frames of 10,000 line-of-sight style raycasts (plus smaller sweep and overlap loads) over a
+ * 32x32 field of boxes with a ground slab, issued one call at a time through Raycast,
+ * SweepCapsule and OverlapSphere and as one batch per frame. The batch is timed on the calling
+ * thread alone and on every core, and must report the same hits as the single-query calls.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <thread>
+#include <algorithm>
+#include "TestUtils.h"
+#include "Physics/PhysicsEngine.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr int FIELD_SIZE = 32;
+    constexpr float FIELD_SPACING = 3.0f;
+    constexpr size_t RAYS_PER_FRAME = 10000;
+    constexpr size_t SWEEPS_PER_FRAME = 1000;
+    constexpr size_t OVERLAPS_PER_FRAME = 1000;
+    constexpr int FRAMES = 10;
+    constexpr uint32_t MAX_OVERLAPS = 8;
+
+    // Ground slab plus a field of static boxes of varying height, with a few dynamic boxes
+    // dropped on top and settled by stepping the world
+    std::vector<uint32_t> BuildScene(PhysicsEngine& engine) {
+        std::vector<uint32_t> bodyIds;
+        const float extent = FIELD_SIZE * FIELD_SPACING;
+
+        RigidBody groundDesc;
+        groundDesc.position = Math::Vec3(extent * 0.5f, -0.5f, extent * 0.5f);
+        groundDesc.isStatic = true;
+        CollisionShape groundShape;
+        groundShape.type = CollisionShape::Box;
+        groundShape.dimensions = Math::Vec3(extent + 10.0f, 1.0f, extent + 10.0f);
+        bodyIds.push_back(engine.CreateRigidBody(groundDesc, groundShape));
+
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> height(0.5f, 4.0f);
+        for (int z = 0; z < FIELD_SIZE; ++z) {
+            for (int x = 0; x < FIELD_SIZE; ++x) {
+                CollisionShape shape;
+                shape.type = CollisionShape::Box;
+                shape.dimensions = Math::Vec3(1.2f, height(rng), 1.2f);
+
+                RigidBody desc;
+                desc.position = Math::Vec3(x * FIELD_SPACING, shape.dimensions.y * 0.5f, z * FIELD_SPACING);
+                desc.isStatic = (x + z) % 16 != 0;
+                if (!desc.isStatic) {
+                    desc.position.y += 6.0f;
+                }
+                bodyIds.push_back(engine.CreateRigidBody(desc, shape));
+            }
+        }
+
+        for (int step = 0; step < 60; ++step) {
+            engine.Update(1.0f / 60.0f);
+        }
+        return bodyIds;
+    }
+
+    // Agents at eye height looking at random targets across the field
+    std::vector<RaycastQuery> CreateRays(std::mt19937& rng) {
+        const float extent = FIELD_SIZE * FIELD_SPACING;
+        std::uniform_real_distribution<float> coord(0.0f, extent);
+        std::vector<RaycastQuery> rays(RAYS_PER_FRAME);
+        for (RaycastQuery& ray : rays) {
+            ray.origin = Math::Vec3(coord(rng), 1.7f, coord(rng));
+            const Math::Vec3 target(coord(rng), 0.5f, coord(rng));
+            ray.direction = target - ray.origin;
+            ray.maxDistance = std::max(glm::length(ray.direction), 0.1f);
+        }
+        return rays;
+    }
+
+    std::vector<SweepQuery> CreateSweeps(std::mt19937& rng) {
+        const float extent = FIELD_SIZE * FIELD_SPACING;
+        std::uniform_real_distribution<float> coord(0.0f, extent);
+        std::uniform_real_distribution<float> step(-4.0f, 4.0f);
+        std::vector<SweepQuery> sweeps(SWEEPS_PER_FRAME);
+        for (SweepQuery& sweep : sweeps) {
+            sweep.from = Math::Vec3(coord(rng), 1.0f, coord(rng));
+            sweep.to = sweep.from + Math::Vec3(step(rng), 0.0f, step(rng));
+            sweep.radius = 0.3f;
+            sweep.height = 1.2f;
+        }
+        return sweeps;
+    }
+
+    std::vector<OverlapQuery> CreateOverlaps(std::mt19937& rng) {
+        const float extent = FIELD_SIZE * FIELD_SPACING;
+        std::uniform_real_distribution<float> coord(0.0f, extent);
+        std::vector<OverlapQuery> overlaps(OVERLAPS_PER_FRAME);
+        for (OverlapQuery& overlap : overlaps) {
+            overlap.center = Math::Vec3(coord(rng), 1.0f, coord(rng));
+            overlap.radius = 1.5f;
+        }
+        return overlaps;
+    }
+
+    std::string FormatMs(double ms) {
+        return StringUtils::FormatFloat(static_cast<float>(ms)) + " ms";
+    }
+
+    std::string FormatFrame(double totalMs, double baselineMs) {
+        return FormatMs(totalMs / FRAMES) + "/frame (" +
+               StringUtils::FormatFloat(static_cast<float>(baselineMs / std::max(totalMs, 0.001))) + "x)";
+    }
+}
+
+/**
+ * Test 10k raycasts per frame through Raycast and RaycastBatch
+ * Requirements: Batched physics queries, parallel execution
+ */
+bool TestRaycastThroughput() {
+    TestOutput::PrintTestStart("raycast throughput");
+
+    PhysicsEngine engine;
+    if (!engine.Initialize()) {
+        TestOutput::PrintError("Failed to initialize physics engine");
+        return false;
+    }
+    std::vector<uint32_t> bodyIds = BuildScene(engine);
+
+    std::mt19937 rng(42);
+    std::vector<std::vector<RaycastQuery>> frames;
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        frames.push_back(CreateRays(rng));
+    }
+
+    std::vector<std::vector<RaycastHit>> singleHits(FRAMES);
+    TestTimer singleTimer;
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        singleHits[frame].reserve(RAYS_PER_FRAME);
+        for (const RaycastQuery& ray : frames[frame]) {
+            singleHits[frame].push_back(engine.Raycast(ray.origin, ray.direction, ray.maxDistance));
+        }
+    }
+    const double singleMs = singleTimer.ElapsedMs();
+
+    std::vector<std::vector<RaycastHit>> batchHits(FRAMES, std::vector<RaycastHit>(RAYS_PER_FRAME));
+    PhysicsConfiguration config = engine.GetConfiguration();
+    double batchMs[2] = {};
+    for (int pass = 0; pass < 2; ++pass) {
+        config.queryThreads = pass == 0 ? 1 : 0;
+        engine.SetConfiguration(config);
+
+        TestTimer batchTimer;
+        for (int frame = 0; frame < FRAMES; ++frame) {
+            EXPECT_TRUE(engine.RaycastBatch(frames[frame], batchHits[frame]));
+        }
+        batchMs[pass] = batchTimer.ElapsedMs();
+    }
+
+    size_t mismatches = 0;
+    size_t hitCount = 0;
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        for (size_t i = 0; i < RAYS_PER_FRAME; ++i) {
+            const RaycastHit& expected = singleHits[frame][i];
+            const RaycastHit& hit = batchHits[frame][i];
+            hitCount += expected.hasHit ? 1 : 0;
+            if (hit.hasHit != expected.hasHit || hit.bodyId != expected.bodyId) {
+                ++mismatches;
+            }
+        }
+    }
+
+    TestOutput::PrintInfo(std::to_string(RAYS_PER_FRAME) + " rays x " + std::to_string(FRAMES) + " frames, " +
+                          std::to_string(bodyIds.size()) + " bodies, " +
+                          std::to_string(hitCount * 100 / (RAYS_PER_FRAME * FRAMES)) + "% hit");
+    TestOutput::PrintInfo("  Raycast per query:   " + FormatMs(singleMs / FRAMES) + "/frame");
+    TestOutput::PrintInfo("  RaycastBatch 1 thread: " + FormatFrame(batchMs[0], singleMs));
+    TestOutput::PrintInfo("  RaycastBatch " + std::to_string(std::max(1u, std::thread::hardware_concurrency())) +
+                          " threads: " + FormatFrame(batchMs[1], singleMs));
+    EXPECT_EQUAL(mismatches, size_t(0));
+
+    for (uint32_t bodyId : bodyIds) {
+        engine.DestroyRigidBody(bodyId);
+    }
+    engine.Shutdown();
+
+    TestOutput::PrintTestPass("raycast throughput");
+    return true;
+}
+
+/**
+ * Test capsule sweeps and sphere overlaps through the single and batched APIs
+ * Requirements: Batched physics queries, parallel execution
+ */
+bool TestSweepAndOverlapThroughput() {
+    TestOutput::PrintTestStart("sweep and overlap throughput");
+
+    PhysicsEngine engine;
+    if (!engine.Initialize()) {
+        TestOutput::PrintError("Failed to initialize physics engine");
+        return false;
+    }
+    std::vector<uint32_t> bodyIds = BuildScene(engine);
+
+    std::mt19937 rng(1234);
+    const std::vector<SweepQuery> sweeps = CreateSweeps(rng);
+    const std::vector<OverlapQuery> overlaps = CreateOverlaps(rng);
+
+    TestTimer singleSweepTimer;
+    size_t singleSweepHits = 0;
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        for (const SweepQuery& sweep : sweeps) {
+            singleSweepHits += engine.SweepCapsule(sweep.from, sweep.to, sweep.radius, sweep.height).hasHit ? 1 : 0;
+        }
+    }
+    const double singleSweepMs = singleSweepTimer.ElapsedMs();
+
+    std::vector<PhysicsEngine::SweepHit> sweepHits(sweeps.size());
+    TestTimer batchSweepTimer;
+    size_t batchSweepHits = 0;
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        EXPECT_TRUE(engine.SweepBatch(sweeps, sweepHits));
+        batchSweepHits += std::count_if(sweepHits.begin(), sweepHits.end(),
+                                        [](const PhysicsEngine::SweepHit& hit) { return hit.hasHit; });
+    }
+    const double batchSweepMs = batchSweepTimer.ElapsedMs();
+
+    TestTimer singleOverlapTimer;
+    size_t singleOverlapBodies = 0;
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        for (const OverlapQuery& overlap : overlaps) {
+            std::vector<OverlapResult> found = engine.OverlapSphere(overlap.center, overlap.radius);
+            // OverlapSphere reports every contact point, including near misses within the contact
+            // threshold; count each penetrating body once as OverlapBatch does
+            std::vector<uint32_t> ids;
+            for (const OverlapResult& result : found) {
+                if (result.penetrationDepth <= 0.0f) {
+                    ids.push_back(result.bodyId);
+                }
+            }
+            std::sort(ids.begin(), ids.end());
+            singleOverlapBodies += std::unique(ids.begin(), ids.end()) - ids.begin();
+        }
+    }
+    const double singleOverlapMs = singleOverlapTimer.ElapsedMs();
+
+    std::vector<OverlapResult> overlapResults(overlaps.size() * MAX_OVERLAPS);
+    std::vector<uint32_t> overlapCounts(overlaps.size());
+    TestTimer batchOverlapTimer;
+    size_t batchOverlapBodies = 0;
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        EXPECT_TRUE(engine.OverlapBatch(overlaps, overlapResults, overlapCounts, MAX_OVERLAPS));
+        for (uint32_t count : overlapCounts) {
+            batchOverlapBodies += count;
+        }
+    }
+    const double batchOverlapMs = batchOverlapTimer.ElapsedMs();
+
+    TestOutput::PrintInfo(std::to_string(SWEEPS_PER_FRAME) + " capsule sweeps x " + std::to_string(FRAMES) + " frames, " +
+                          std::to_string(batchSweepHits) + " hits");
+    TestOutput::PrintInfo("  SweepCapsule per query: " + FormatMs(singleSweepMs / FRAMES) + "/frame");
+    TestOutput::PrintInfo("  SweepBatch:             " + FormatFrame(batchSweepMs, singleSweepMs));
+    TestOutput::PrintInfo(std::to_string(OVERLAPS_PER_FRAME) + " sphere overlaps x " + std::to_string(FRAMES) + " frames, " +
+                          std::to_string(batchOverlapBodies) + " bodies found");
+    TestOutput::PrintInfo("  OverlapSphere per query: " + FormatMs(singleOverlapMs / FRAMES) + "/frame");
+    TestOutput::PrintInfo("  OverlapBatch:            " + FormatFrame(batchOverlapMs, singleOverlapMs));
+    EXPECT_EQUAL(batchSweepHits, singleSweepHits);
+    EXPECT_EQUAL(batchOverlapBodies, singleOverlapBodies);
+
+    for (uint32_t bodyId : bodyIds) {
+        engine.DestroyRigidBody(bodyId);
+    }
+    engine.Shutdown();
+
+    TestOutput::PrintTestPass("sweep and overlap throughput");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Physics Query Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Physics Query Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Raycast Throughput", TestRaycastThroughput);
+        allPassed &= suite.RunTest("Sweep And Overlap Throughput", TestSweepAndOverlapThroughput);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
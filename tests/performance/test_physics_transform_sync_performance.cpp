@@ -0,0 +1,172 @@
+/**
+ * Physics Transform Sync Performance Tests
+ *
+ * A 20,000 body scene in which one body in ten keeps moving and the rest have gone to sleep,
+ * read back once per frame the way a renderer would: GetRigidBodyTransform for every body ID,
+ * SyncTransforms over every dynamic body, and SyncTransforms over the bodies that moved.
+ */
+
+#ifdef GAMEENGINE_HAS_BULLET
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "TestUtils.h"
+#include "Physics/PhysicsEngine.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr int GRID_SIZE = 142;           // 142 x 142 = 20,164 bodies
+    constexpr float GRID_SPACING = 4.0f;
+    constexpr int MOVING_EVERY = 10;
+    constexpr int SETTLE_FRAMES = 150;       // Past Bullet's 2 s deactivation time
+    constexpr int FRAMES = 60;
+
+    // Boxes spaced apart in zero gravity; every tenth one keeps drifting above the sleep thresholds
+    std::vector<uint32_t> BuildScene(PhysicsEngine& engine, size_t& movingCount) {
+        std::vector<uint32_t> bodyIds;
+        movingCount = 0;
+
+        CollisionShape shape;
+        shape.type = CollisionShape::Box;
+        shape.dimensions = Math::Vec3(1.0f);
+
+        for (int z = 0; z < GRID_SIZE; ++z) {
+            for (int x = 0; x < GRID_SIZE; ++x) {
+                RigidBody desc;
+                desc.position = Math::Vec3(x * GRID_SPACING, 0.0f, z * GRID_SPACING);
+                if (bodyIds.size() % MOVING_EVERY == 0) {
+                    desc.velocity = Math::Vec3(0.0f, 2.0f, 0.0f);
+                    desc.angularVelocity = Math::Vec3(0.0f, 2.0f, 0.0f);
+                    ++movingCount;
+                }
+                bodyIds.push_back(engine.CreateRigidBody(desc, shape));
+            }
+        }
+
+        for (int frame = 0; frame < SETTLE_FRAMES; ++frame) {
+            engine.Update(1.0f / 60.0f);
+        }
+        return bodyIds;
+    }
+
+    std::string FormatMs(double ms) {
+        return StringUtils::FormatFloat(static_cast<float>(ms)) + " ms";
+    }
+
+    std::string FormatFrame(double totalMs, double baselineMs) {
+        return FormatMs(totalMs / FRAMES) + "/frame (" +
+               StringUtils::FormatFloat(static_cast<float>(baselineMs / std::max(totalMs, 0.001))) + "x)";
+    }
+}
+
+/**
+ * Test per-frame transform readback cost of per-body lookups against bulk sync
+ * Requirements: Bulk SoA transform readback of active, moved bodies
+ */
+bool TestTransformReadback() {
+    TestOutput::PrintTestStart("20k body transform readback");
+
+    PhysicsConfiguration config = PhysicsConfiguration::Default();
+    config.gravity = Math::Vec3(0.0f);
+    PhysicsEngine engine;
+    EXPECT_TRUE(engine.Initialize(config));
+
+    size_t movingCount = 0;
+    const std::vector<uint32_t> bodyIds = BuildScene(engine, movingCount);
+
+    TransformSyncBuffer buffer;
+    engine.SyncTransforms(buffer, false);
+
+    double perBodyMs = 0.0;
+    double fullSyncMs = 0.0;
+    double movedSyncMs = 0.0;
+    size_t fullCount = 0;
+    size_t movedCount = 0;
+    float checksum = 0.0f;
+
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        engine.Update(1.0f / 60.0f);
+
+        TestTimer perBodyTimer;
+        for (uint32_t bodyId : bodyIds) {
+            Math::Vec3 position;
+            Math::Quat rotation;
+            if (engine.GetRigidBodyTransform(bodyId, position, rotation)) {
+                checksum += position.y;
+            }
+        }
+        perBodyMs += perBodyTimer.ElapsedMs();
+
+        // Moved-only first so the full pass does not mark this step as already synced
+        TestTimer movedTimer;
+        movedCount = engine.SyncTransforms(buffer);
+        movedSyncMs += movedTimer.ElapsedMs();
+
+        TestTimer fullTimer;
+        fullCount = engine.SyncTransforms(buffer, false);
+        fullSyncMs += fullTimer.ElapsedMs();
+    }
+
+    TestOutput::PrintInfo(std::to_string(bodyIds.size()) + " bodies, " + std::to_string(movingCount) +
+                          " awake, " + std::to_string(FRAMES) + " frames");
+    TestOutput::PrintInfo("  GetRigidBodyTransform per body: " + FormatMs(perBodyMs / FRAMES) + "/frame");
+    TestOutput::PrintInfo("  SyncTransforms all:   " + FormatFrame(fullSyncMs, perBodyMs));
+    TestOutput::PrintInfo("  SyncTransforms moved: " + FormatFrame(movedSyncMs, perBodyMs) +
+                          ", " + std::to_string(movedCount) + " bodies");
+
+    EXPECT_TRUE(checksum != 0.0f);
+    EXPECT_EQUAL(fullCount, bodyIds.size());
+    EXPECT_EQUAL(movedCount, movingCount);
+
+    TestOutput::PrintTestPass("20k body transform readback");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Physics Transform Sync Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Physics Transform Sync Performance Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Transform Readback", TestTransformReadback);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
+
+#else
+
+#include "TestUtils.h"
+
+using namespace GameEngine::Testing;
+
+int main() {
+    TestOutput::PrintHeader("Physics Transform Sync Performance");
+    TestOutput::PrintWarning("Bullet Physics not available - transform sync performance tests skipped");
+    TestOutput::PrintFooter(true);
+    return 0;
+}
+
+#endif // GAMEENGINE_HAS_BULLET
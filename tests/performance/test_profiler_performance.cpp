@@ -0,0 +1,148 @@
+/**
+ * Profiler Performance Tests
+ *
+ * Per-zone instrumentation overhead with the profiler recording and disabled, from one
+ * thread and from several at once, plus the cost of exporting the resulting trace.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <thread>
+#include "TestUtils.h"
+#include "Core/Profiler.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr int ZONE_COUNT = 200000;
+    constexpr double MAX_ZONE_OVERHEAD_NS = 50.0;
+
+    double NanosecondsPerZone(double elapsedMs, int zones) {
+        return elapsedMs * 1000000.0 / std::max(zones, 1);
+    }
+
+    // Empty zones, so the loop measures nothing but the instrumentation
+    double RunZones(int count) {
+        TestTimer timer;
+        for (int i = 0; i < count; ++i) {
+            GAMEENGINE_PROFILE_ZONE("BenchmarkZone");
+        }
+        return timer.ElapsedMs();
+    }
+}
+
+/**
+ * Test single-thread zone overhead
+ * Requirements: zone overhead under 50ns
+ */
+bool TestZoneOverhead() {
+    TestOutput::PrintTestStart("zone overhead");
+
+    Profiler& profiler = Profiler::GetInstance();
+    profiler.Clear();
+
+    profiler.SetEnabled(false);
+    double disabledTime = RunZones(ZONE_COUNT);
+
+    profiler.SetEnabled(true);
+    RunZones(ZONE_COUNT);           // Warm up the thread's buffer; Clear keeps its chunks
+    profiler.Clear();
+    double enabledTime = RunZones(ZONE_COUNT);
+    profiler.SetEnabled(false);
+
+    const double disabledNs = NanosecondsPerZone(disabledTime, ZONE_COUNT);
+    const double enabledNs = NanosecondsPerZone(enabledTime, ZONE_COUNT);
+    TestOutput::PrintInfo("disabled: " + StringUtils::FormatFloat(static_cast<float>(disabledNs), 1) + " ns/zone");
+    TestOutput::PrintInfo("recording: " + StringUtils::FormatFloat(static_cast<float>(enabledNs), 1) + " ns/zone");
+
+    TestOutput::PrintInfo("  target < " + StringUtils::FormatFloat(static_cast<float>(MAX_ZONE_OVERHEAD_NS), 0) + " ns: " +
+                          (enabledNs < MAX_ZONE_OVERHEAD_NS ? "met" : "not met"));
+    EXPECT_EQUAL(profiler.GetDroppedEventCount(), static_cast<size_t>(0));
+
+    TestTimer exportTimer;
+    const std::string trace = profiler.ExportChromeTrace();
+    TestOutput::PrintTiming("export " + std::to_string(ZONE_COUNT) + " zones (" + std::to_string(trace.size() / 1024) + " KB)",
+                            exportTimer.ElapsedMs(), 1);
+
+    profiler.Clear();
+
+    TestOutput::PrintTestPass("zone overhead");
+    return true;
+}
+
+/**
+ * Test zone overhead with every core recording at once
+ * Requirements: thread-local buffers, no shared state on the recording path
+ */
+bool TestContendedZoneOverhead() {
+    TestOutput::PrintTestStart("contended zone overhead");
+
+    Profiler& profiler = Profiler::GetInstance();
+    profiler.Clear();
+    profiler.SetEnabled(true);
+
+    const size_t threadCount = std::max<size_t>(2, std::thread::hardware_concurrency());
+    std::vector<double> threadTimes(threadCount, 0.0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([t, &threadTimes]() {
+            RunZones(ZONE_COUNT / 10);
+            threadTimes[t] = RunZones(ZONE_COUNT);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    profiler.SetEnabled(false);
+
+    double slowest = *std::max_element(threadTimes.begin(), threadTimes.end());
+    const double slowestNs = NanosecondsPerZone(slowest, ZONE_COUNT);
+    TestOutput::PrintInfo(std::to_string(threadCount) + " threads: " + StringUtils::FormatFloat(static_cast<float>(slowestNs), 1) +
+                          " ns/zone (slowest thread)");
+
+    ProfileCapture capture = profiler.Capture();
+    size_t recordedZones = 0;
+    for (const auto& thread : capture.threads) {
+        recordedZones += thread.zones.size();
+    }
+    EXPECT_EQUAL(recordedZones, threadCount * static_cast<size_t>(ZONE_COUNT + ZONE_COUNT / 10));
+
+    profiler.Clear();
+
+    TestOutput::PrintTestPass("contended zone overhead");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Profiler Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Profiler Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Zone Overhead", TestZoneOverhead);
+        allPassed &= suite.RunTest("Contended Zone Overhead", TestContendedZoneOverhead);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -0,0 +1,202 @@
+/**
+ * Resource Manager Performance Tests
+ *
+ * Contention when 16 threads load overlapping asset sets: the manager's lock-free
+ * loading path with shared in-flight loads against the previous behaviour of holding
+ * one lock across every load, and LoadAsync batches from a single thread.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include "TestUtils.h"
+#include "Resource/ResourceManager.h"
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr int THREAD_COUNT = 16;
+    constexpr int ASSET_COUNT = 64;
+    constexpr int ASSETS_PER_THREAD = 24;
+    constexpr auto LOAD_TIME = std::chrono::milliseconds(2);
+
+    // Stands in for a mesh or texture: a fixed amount of I/O and decode time per load
+    class BenchmarkResource : public Resource {
+    public:
+        static std::atomic<int> s_loadCount;
+
+        explicit BenchmarkResource(const std::string& path) : Resource(path) {}
+
+        bool LoadFromFile(const std::string&) override {
+            ++s_loadCount;
+            std::this_thread::sleep_for(LOAD_TIME);
+            return true;
+        }
+    };
+
+    std::atomic<int> BenchmarkResource::s_loadCount{0};
+
+    std::string GetAssetPath(int index) {
+        return "benchmark/asset_" + std::to_string(index % ASSET_COUNT) + ".bin";
+    }
+
+    // Thread t requests a window of assets starting at t * 4, so neighbouring threads overlap
+    double RunContendedLoads(ResourceManager& manager, std::mutex* globalLoadLock) {
+        std::atomic<int> failures{0};
+        std::vector<std::thread> threads;
+        TestTimer timer;
+        for (int t = 0; t < THREAD_COUNT; ++t) {
+            threads.emplace_back([&manager, &failures, globalLoadLock, t]() {
+                std::vector<std::shared_ptr<BenchmarkResource>> held;
+                for (int i = 0; i < ASSETS_PER_THREAD; ++i) {
+                    const std::string path = GetAssetPath(t * 4 + i);
+                    std::shared_ptr<BenchmarkResource> resource;
+                    if (globalLoadLock) {
+                        std::lock_guard<std::mutex> lock(*globalLoadLock);
+                        resource = manager.Load<BenchmarkResource>(path);
+                    } else {
+                        resource = manager.Load<BenchmarkResource>(path);
+                    }
+                    if (!resource) {
+                        ++failures;
+                    }
+                    held.push_back(resource);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        double elapsed = timer.ElapsedMs();
+        return failures.load() == 0 ? elapsed : -1.0;
+    }
+}
+
+/**
+ * Test 16 threads loading overlapping asset sets
+ * Requirements: loads of different paths run in parallel, one load per path
+ */
+bool TestContendedLoading() {
+    TestOutput::PrintTestStart("contended loading");
+
+    // Previous behaviour: one lock held across every load
+    double serializedTime = 0.0;
+    int serializedLoads = 0;
+    {
+        ResourceManager manager;
+        manager.Initialize();
+        std::mutex globalLoadLock;
+        BenchmarkResource::s_loadCount = 0;
+        serializedTime = RunContendedLoads(manager, &globalLoadLock);
+        serializedLoads = BenchmarkResource::s_loadCount.load();
+        manager.Shutdown();
+    }
+
+    double parallelTime = 0.0;
+    int parallelLoads = 0;
+    {
+        ResourceManager manager;
+        manager.Initialize();
+        BenchmarkResource::s_loadCount = 0;
+        parallelTime = RunContendedLoads(manager, nullptr);
+        parallelLoads = BenchmarkResource::s_loadCount.load();
+        manager.Shutdown();
+    }
+
+    EXPECT_TRUE(serializedTime >= 0.0);
+    EXPECT_TRUE(parallelTime >= 0.0);
+
+    TestOutput::PrintInfo(std::to_string(THREAD_COUNT) + " threads x " + std::to_string(ASSETS_PER_THREAD) + " requests over " +
+                          std::to_string(ASSET_COUNT) + " assets");
+    TestOutput::PrintInfo("lock held across loads: " + StringUtils::FormatFloat(static_cast<float>(serializedTime), 1) +
+                          " ms, " + std::to_string(serializedLoads) + " loads");
+    TestOutput::PrintInfo("lookup-only lock + shared loads: " + StringUtils::FormatFloat(static_cast<float>(parallelTime), 1) +
+                          " ms, " + std::to_string(parallelLoads) + " loads");
+    TestOutput::PrintInfo("  speedup " + StringUtils::FormatFloat(static_cast<float>(serializedTime / std::max(parallelTime, 0.001)), 2) + "x");
+
+    TestOutput::PrintTestPass("contended loading");
+    return true;
+}
+
+/**
+ * Test LoadAsync for a whole asset set issued from one thread
+ * Requirements: LoadAsync returns the shared in-flight future
+ */
+bool TestAsyncBatchLoading() {
+    TestOutput::PrintTestStart("async batch loading");
+
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
+    ResourceManager manager;
+    manager.SetJobSystem(&jobSystem);
+    manager.Initialize();
+    BenchmarkResource::s_loadCount = 0;
+
+    TestTimer timer;
+    std::vector<std::shared_future<std::shared_ptr<BenchmarkResource>>> futures;
+    for (int i = 0; i < ASSET_COUNT * 2; ++i) {
+        futures.push_back(manager.LoadAsync<BenchmarkResource>(GetAssetPath(i)));
+    }
+    double issueTime = timer.ElapsedMs();
+
+    std::vector<std::shared_ptr<BenchmarkResource>> resources;
+    for (auto& future : futures) {
+        resources.push_back(future.get());
+    }
+    double totalTime = timer.ElapsedMs();
+
+    for (const auto& resource : resources) {
+        EXPECT_NOT_NULL(resource);
+    }
+    EXPECT_EQUAL(BenchmarkResource::s_loadCount.load(), ASSET_COUNT);
+
+    TestOutput::PrintInfo(std::to_string(ASSET_COUNT * 2) + " requests issued in " + StringUtils::FormatFloat(static_cast<float>(issueTime), 3) +
+                          " ms, all loaded after " + StringUtils::FormatFloat(static_cast<float>(totalTime), 1) + " ms (" +
+                          std::to_string(ASSET_COUNT) + " loads)");
+
+    manager.Shutdown();
+    jobSystem.Shutdown();
+
+    TestOutput::PrintTestPass("async batch loading");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Resource Manager Performance");
+
+    // Every load logs at info level; keep the report readable
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Resource Manager Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Contended Loading", TestContendedLoading);
+        allPassed &= suite.RunTest("Async Batch Loading", TestAsyncBatchLoading);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
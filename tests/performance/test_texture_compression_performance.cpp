@@ -0,0 +1,340 @@
+/**
+ * Texture Compression Performance Tests
+ *
+ * Throughput and PSNR of the CPU block encoder on the sample textures: BC1 range fit and
+ * cluster fit, BC3, BC7 and BC5 on normal maps, the SSE2 index search against the scalar
+ * path, and scaling over block rows with the thread count.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "TestUtils.h"
+#include "Graphics/BlockCompression.h"
+#include "Resource/TextureLoader.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    const std::vector<std::string> COLOR_TEXTURES = {
+        "assets/GLTF/Fox/glTF/Texture.png",
+        "assets/GLTF/Suzanne/glTF/Suzanne_BaseColor.png",
+        "assets/GLTF/Suzanne/glTF/Suzanne_MetallicRoughness.png",
+        "assets/GLTF/ABeautifulGame/glTF/chessboard_base_color.jpg",
+        "assets/GLTF/ABeautifulGame/glTF/knight_white_base_color.jpg",
+        "assets/GLTF/ABeautifulGame/glTF/Knight_ORM.jpg",
+        "assets/textures/wall.jpg"
+    };
+
+    const std::vector<std::string> NORMAL_TEXTURES = {
+        "assets/GLTF/ABeautifulGame/glTF/Knight_normal.jpg",
+        "assets/GLTF/ABeautifulGame/glTF/chessboard_normal.jpg"
+    };
+
+    // Larger textures are cropped around the centre so each one costs about the same
+    const uint32_t MAX_EXTENT = 1024;
+
+    struct Image {
+        std::string name;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t channels = 0;
+        std::vector<uint8_t> pixels;
+    };
+
+    struct Measurement {
+        double milliseconds = 0.0;
+        double psnrSum = 0.0;
+        size_t pixels = 0;
+        size_t images = 0;
+
+        double MeanPSNR() const { return images > 0 ? psnrSum / images : 0.0; }
+        double MegapixelsPerSecond() const { return milliseconds > 0.0 ? pixels / (milliseconds * 1000.0) : 0.0; }
+    };
+
+    bool LoadTexture(TextureLoader& loader, const std::string& path, Image& image) {
+        if (!std::filesystem::exists(path)) {
+            TestOutput::PrintInfo("Skipping missing texture: " + path);
+            return false;
+        }
+        TextureLoader::ImageData data = loader.LoadImageData(path);
+        if (!data.isValid) {
+            TestOutput::PrintInfo("Skipping texture that failed to load: " + path);
+            return false;
+        }
+
+        image.name = std::filesystem::path(path).filename().string();
+        image.channels = static_cast<uint32_t>(data.channels);
+        image.width = std::min(static_cast<uint32_t>(data.width), MAX_EXTENT);
+        image.height = std::min(static_cast<uint32_t>(data.height), MAX_EXTENT);
+        const uint32_t left = (static_cast<uint32_t>(data.width) - image.width) / 2;
+        const uint32_t top = (static_cast<uint32_t>(data.height) - image.height) / 2;
+
+        image.pixels.resize(static_cast<size_t>(image.width) * image.height * image.channels);
+        for (uint32_t y = 0; y < image.height; ++y) {
+            const size_t rowBytes = static_cast<size_t>(image.width) * image.channels;
+            const uint8_t* source = data.data + ((static_cast<size_t>(top) + y) * data.width + left) * image.channels;
+            std::copy(source, source + rowBytes, image.pixels.data() + y * rowBytes);
+        }
+        return true;
+    }
+
+    // Gradients, hard edges and noise, used when no texture can be loaded (e.g. built without stb)
+    Image CreateSyntheticImage(uint32_t channels) {
+        Image image;
+        image.name = "synthetic";
+        image.width = MAX_EXTENT;
+        image.height = MAX_EXTENT;
+        image.channels = channels;
+        image.pixels.resize(static_cast<size_t>(image.width) * image.height * channels);
+
+        uint32_t seed = 7;
+        for (uint32_t y = 0; y < image.height; ++y) {
+            for (uint32_t x = 0; x < image.width; ++x) {
+                seed = seed * 1664525u + 1013904223u;
+                const int noise = static_cast<int>((seed >> 24) % 7) - 3;
+                const int rgba[4] = {
+                    static_cast<int>(x * 255 / image.width) + noise,
+                    static_cast<int>(128.0f + 100.0f * std::sin(y * 0.05f)) + noise,
+                    static_cast<int>(((x / 37 + y / 23) % 3) * 90) + noise,
+                    255
+                };
+                uint8_t* out = image.pixels.data() + (static_cast<size_t>(y) * image.width + x) * channels;
+                for (uint32_t c = 0; c < channels; ++c) {
+                    out[c] = static_cast<uint8_t>(std::clamp(rgba[c], 0, 255));
+                }
+            }
+        }
+        return image;
+    }
+
+    std::vector<Image> LoadTextures(const std::vector<std::string>& paths, uint32_t fallbackChannels) {
+        TextureLoader loader;
+        std::vector<Image> images;
+        for (const auto& path : paths) {
+            Image image;
+            if (LoadTexture(loader, path, image)) {
+                images.push_back(std::move(image));
+            }
+        }
+        if (images.empty()) {
+            TestOutput::PrintInfo("No textures loaded, measuring a synthetic " + std::to_string(MAX_EXTENT) + "x" +
+                                  std::to_string(MAX_EXTENT) + " image instead");
+            images.push_back(CreateSyntheticImage(fallbackChannels));
+        }
+        return images;
+    }
+
+    double CalculatePSNR(const Image& image, const std::vector<uint8_t>& decoded, uint32_t comparedChannels) {
+        const size_t pixelCount = static_cast<size_t>(image.width) * image.height;
+        const uint32_t channels = std::min(comparedChannels, image.channels);
+        double squaredError = 0.0;
+        for (size_t i = 0; i < pixelCount; ++i) {
+            for (uint32_t c = 0; c < channels; ++c) {
+                const double d = static_cast<double>(image.pixels[i * image.channels + c]) - decoded[i * 4 + c];
+                squaredError += d * d;
+            }
+        }
+        const double mse = squaredError / static_cast<double>(pixelCount * channels);
+        return mse > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : 99.0;
+    }
+
+    bool Measure(const Image& image, CompressionFormat format, CompressionQuality quality, uint32_t comparedChannels,
+                 size_t maxThreads, Measurement& measurement, std::vector<uint8_t>* blocksOut = nullptr) {
+        std::vector<uint8_t> blocks, decoded;
+        TestTimer timer;
+        const bool compressed = BlockCompression::CompressImage(image.pixels.data(), image.width, image.height, image.channels,
+                                                                format, quality, blocks, maxThreads);
+        const double elapsed = timer.ElapsedMs();
+        if (!compressed || !BlockCompression::DecompressImage(blocks.data(), image.width, image.height, format, decoded)) {
+            return false;
+        }
+
+        measurement.milliseconds += elapsed;
+        measurement.pixels += static_cast<size_t>(image.width) * image.height;
+        measurement.psnrSum += CalculatePSNR(image, decoded, comparedChannels);
+        measurement.images++;
+        if (blocksOut) {
+            *blocksOut = std::move(blocks);
+        }
+        return true;
+    }
+
+    std::string FormatMeasurement(const Measurement& measurement) {
+        return StringUtils::FormatFloat(static_cast<float>(measurement.MegapixelsPerSecond()), 2) + " MPix/s, " +
+               StringUtils::FormatFloat(static_cast<float>(measurement.MeanPSNR()), 2) + " dB";
+    }
+
+    std::string FormatPixels(size_t pixels) {
+        return StringUtils::FormatFloat(static_cast<float>(pixels) / 1.0e6f, 1) + " MPix";
+    }
+}
+
+/**
+ * Test throughput and quality of the colour formats on the sample textures
+ * Requirements: cluster fit at least as good as range fit, BC7 ahead of BC1, usable PSNR
+ */
+bool TestColorTextureCompression() {
+    TestOutput::PrintTestStart("color texture compression");
+
+    const auto images = LoadTextures(COLOR_TEXTURES, 4);
+
+    struct Config {
+        const char* name;
+        CompressionFormat format;
+        CompressionQuality quality;
+        uint32_t comparedChannels;
+    };
+    const Config configs[] = {
+        {"BC1 fast (range fit)", CompressionFormat::DXT1, CompressionQuality::Fast, 3},
+        {"BC1 normal", CompressionFormat::DXT1, CompressionQuality::Normal, 3},
+        {"BC1 high (cluster fit)", CompressionFormat::DXT1, CompressionQuality::High, 3},
+        {"BC3 normal", CompressionFormat::DXT5, CompressionQuality::Normal, 4},
+        {"BC7 fast", CompressionFormat::BC7, CompressionQuality::Fast, 4},
+        {"BC7 normal", CompressionFormat::BC7, CompressionQuality::Normal, 4}
+    };
+
+    std::vector<Measurement> results;
+    size_t totalPixels = 0;
+    for (const auto& image : images) {
+        totalPixels += static_cast<size_t>(image.width) * image.height;
+    }
+    TestOutput::PrintInfo(std::to_string(images.size()) + " textures, " + FormatPixels(totalPixels) + " per configuration");
+
+    for (const auto& config : configs) {
+        Measurement measurement;
+        for (const auto& image : images) {
+            EXPECT_TRUE(Measure(image, config.format, config.quality, config.comparedChannels, 0, measurement));
+        }
+        TestOutput::PrintInfo(std::string("  ") + config.name + ": " + FormatMeasurement(measurement));
+        results.push_back(measurement);
+    }
+
+    const double bc1Fast = results[0].MeanPSNR();
+    const double bc1Normal = results[1].MeanPSNR();
+    const double bc1High = results[2].MeanPSNR();
+    const double bc7Normal = results[5].MeanPSNR();
+    EXPECT_TRUE(bc1Fast > 30.0);
+    EXPECT_TRUE(bc1Normal >= bc1Fast - 0.05);
+    EXPECT_TRUE(bc1High >= bc1Normal - 0.05);
+    EXPECT_TRUE(results[4].MeanPSNR() > bc1Fast);
+    EXPECT_TRUE(bc7Normal > bc1High);
+
+    TestOutput::PrintTestPass("color texture compression");
+    return true;
+}
+
+/**
+ * Test BC5 against the colour formats on tangent-space normal maps
+ * Requirements: two-channel BC5 keeps the normal XY more accurately than BC1 and BC7
+ */
+bool TestNormalMapCompression() {
+    TestOutput::PrintTestStart("normal map compression");
+
+    const auto images = LoadTextures(NORMAL_TEXTURES, 3);
+
+    Measurement bc1, bc7, bc5;
+    for (const auto& image : images) {
+        EXPECT_TRUE(Measure(image, CompressionFormat::DXT1, CompressionQuality::Normal, 2, 0, bc1));
+        EXPECT_TRUE(Measure(image, CompressionFormat::BC7, CompressionQuality::Fast, 2, 0, bc7));
+        EXPECT_TRUE(Measure(image, CompressionFormat::BC5, CompressionQuality::Normal, 2, 0, bc5));
+    }
+
+    TestOutput::PrintInfo("Normal XY, " + std::to_string(images.size()) + " maps:");
+    TestOutput::PrintInfo("  BC1 normal: " + FormatMeasurement(bc1));
+    TestOutput::PrintInfo("  BC7 fast:   " + FormatMeasurement(bc7));
+    TestOutput::PrintInfo("  BC5 normal: " + FormatMeasurement(bc5));
+
+    EXPECT_TRUE(bc5.MeanPSNR() > bc1.MeanPSNR());
+    EXPECT_TRUE(bc5.MeanPSNR() > bc7.MeanPSNR());
+
+    TestOutput::PrintTestPass("normal map compression");
+    return true;
+}
+
+/**
+ * Test the SSE2 index search and row-parallel encoding against the single-threaded scalar path
+ * Requirements: identical blocks from every path; reports the speedups
+ */
+bool TestSimdAndThreadScaling() {
+    TestOutput::PrintTestStart("SIMD and thread scaling");
+
+    const auto images = LoadTextures({COLOR_TEXTURES.front()}, 4);
+    const Image& image = images.front();
+    TestOutput::PrintInfo(image.name + " (" + std::to_string(image.width) + "x" + std::to_string(image.height) + ")");
+
+    struct Config {
+        const char* name;
+        CompressionFormat format;
+        CompressionQuality quality;
+    };
+    const Config configs[] = {
+        {"BC1 normal", CompressionFormat::DXT1, CompressionQuality::Normal},
+        {"BC5 normal", CompressionFormat::BC5, CompressionQuality::Normal},
+        {"BC7 fast", CompressionFormat::BC7, CompressionQuality::Fast}
+    };
+
+    for (const auto& config : configs) {
+        Measurement simd, scalar;
+        std::vector<uint8_t> simdBlocks, scalarBlocks;
+        EXPECT_TRUE(Measure(image, config.format, config.quality, 4, 1, simd, &simdBlocks));
+        BlockCompression::SetSimdEnabled(false);
+        EXPECT_TRUE(Measure(image, config.format, config.quality, 4, 1, scalar, &scalarBlocks));
+        BlockCompression::SetSimdEnabled(true);
+        EXPECT_TRUE(simdBlocks == scalarBlocks);
+
+        TestOutput::PrintInfo(std::string("  ") + config.name + ": scalar " +
+                              StringUtils::FormatFloat(static_cast<float>(scalar.MegapixelsPerSecond()), 2) + " MPix/s, " +
+                              (BlockCompression::IsSimdAvailable() ? "SSE2 " : "SIMD unavailable ") +
+                              StringUtils::FormatFloat(static_cast<float>(simd.MegapixelsPerSecond()), 2) + " MPix/s");
+    }
+
+    Measurement single, threaded;
+    std::vector<uint8_t> singleBlocks, threadedBlocks;
+    EXPECT_TRUE(Measure(image, CompressionFormat::BC7, CompressionQuality::Normal, 4, 1, single, &singleBlocks));
+    EXPECT_TRUE(Measure(image, CompressionFormat::BC7, CompressionQuality::Normal, 4, 0, threaded, &threadedBlocks));
+    EXPECT_TRUE(singleBlocks == threadedBlocks);
+    TestOutput::PrintInfo("  BC7 normal: 1 thread " + StringUtils::FormatFloat(static_cast<float>(single.milliseconds), 1) +
+                          " ms, " + std::to_string(std::max(1u, std::thread::hardware_concurrency())) + " threads " +
+                          StringUtils::FormatFloat(static_cast<float>(threaded.milliseconds), 1) + " ms");
+
+    TestOutput::PrintTestPass("SIMD and thread scaling");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Texture Compression Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Texture Compression Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Color Texture Compression", TestColorTextureCompression);
+        allPassed &= suite.RunTest("Normal Map Compression", TestNormalMapCompression);
+        allPassed &= suite.RunTest("SIMD and Thread Scaling", TestSimdAndThreadScaling);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
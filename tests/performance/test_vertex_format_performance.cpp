@@ -0,0 +1,148 @@
+/**
+ * Vertex Format Performance Tests
+ *
+ * Vertex memory of the sample glTF assets stored as full Vertex structs against packed
+ * layouts that keep only the attributes each mesh uses, with half-float UVs, byte skinning
+ * data and, optionally, octahedral normals. Also reports the extra load time of packing.
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <filesystem>
+#include "TestUtils.h"
+#include "Resource/GLTFLoader.h"
+#include "Graphics/Model.h"
+#include "Graphics/Mesh.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    const std::vector<std::string> ASSET_PATHS = {
+        "assets/GLTF/Fox/glTF-Binary/Fox.glb",
+        "assets/GLTF/RiggedFigure/glTF-Binary/RiggedFigure.glb",
+        "assets/GLTF/Suzanne/glTF/Suzanne.gltf"
+    };
+
+    struct VertexMemory {
+        size_t vertexCount = 0;
+        size_t vertexBytes = 0;
+        double loadMs = 0.0;
+    };
+
+    VertexMemory LoadAndMeasure(const std::string& path, bool compact, const VertexFormatOptions& options) {
+        GLTFLoader loader;
+        loader.SetCompactVertices(compact, options);
+
+        VertexMemory memory;
+        TestTimer timer;
+        auto result = loader.LoadGLTF(path);
+        memory.loadMs = timer.ElapsedMs();
+        if (!result.success || !result.model) {
+            return memory;
+        }
+
+        for (const auto& mesh : result.model->GetMeshes()) {
+            memory.vertexCount += mesh->GetVertexCount();
+            memory.vertexBytes += mesh->GetVertexDataSize();
+        }
+        return memory;
+    }
+
+    std::string FormatBytes(size_t bytes) {
+        return StringUtils::FormatFloat(static_cast<float>(bytes) / 1024.0f, 1) + " KB";
+    }
+
+    std::string FormatStride(const VertexMemory& memory) {
+        const double stride = memory.vertexCount > 0 ? static_cast<double>(memory.vertexBytes) / memory.vertexCount : 0.0;
+        return StringUtils::FormatFloat(static_cast<float>(stride), 1) + " B/vertex";
+    }
+}
+
+/**
+ * Test vertex memory of the sample assets with full and packed vertex storage
+ * Requirements: per-mesh packed layouts with compact attribute formats reduce vertex memory
+ * without changing vertex counts
+ */
+bool TestAssetVertexMemory() {
+    TestOutput::PrintTestStart("asset vertex memory");
+
+    VertexFormatOptions octahedral;
+    octahedral.octahedralNormals = true;
+
+    VertexMemory fatTotal, packedTotal, octahedralTotal;
+    for (const auto& path : ASSET_PATHS) {
+        if (!std::filesystem::exists(path)) {
+            TestOutput::PrintInfo("Skipping missing asset: " + path);
+            continue;
+        }
+
+        const VertexMemory fat = LoadAndMeasure(path, false, VertexFormatOptions());
+        const VertexMemory packed = LoadAndMeasure(path, true, VertexFormatOptions());
+        const VertexMemory packedOctahedral = LoadAndMeasure(path, true, octahedral);
+
+        EXPECT_TRUE(fat.vertexCount > 0);
+        EXPECT_EQUAL(packed.vertexCount, fat.vertexCount);
+        EXPECT_EQUAL(packedOctahedral.vertexCount, fat.vertexCount);
+        EXPECT_TRUE(packed.vertexBytes < fat.vertexBytes);
+        EXPECT_TRUE(packedOctahedral.vertexBytes <= packed.vertexBytes);
+
+        TestOutput::PrintInfo(std::filesystem::path(path).filename().string() + ": " +
+                              std::to_string(fat.vertexCount) + " vertices");
+        TestOutput::PrintInfo("  Vertex struct: " + FormatBytes(fat.vertexBytes) + " (" + FormatStride(fat) + "), load " +
+                              StringUtils::FormatFloat(static_cast<float>(fat.loadMs), 2) + " ms");
+        TestOutput::PrintInfo("  packed:        " + FormatBytes(packed.vertexBytes) + " (" + FormatStride(packed) + "), load " +
+                              StringUtils::FormatFloat(static_cast<float>(packed.loadMs), 2) + " ms");
+        TestOutput::PrintInfo("  + octahedral:  " + FormatBytes(packedOctahedral.vertexBytes) + " (" + FormatStride(packedOctahedral) + ")");
+
+        fatTotal.vertexCount += fat.vertexCount;
+        fatTotal.vertexBytes += fat.vertexBytes;
+        packedTotal.vertexCount += packed.vertexCount;
+        packedTotal.vertexBytes += packed.vertexBytes;
+        octahedralTotal.vertexCount += packedOctahedral.vertexCount;
+        octahedralTotal.vertexBytes += packedOctahedral.vertexBytes;
+    }
+
+    if (fatTotal.vertexBytes > 0) {
+        const auto saving = [&fatTotal](const VertexMemory& memory) {
+            return StringUtils::FormatFloat(100.0f * (1.0f - static_cast<float>(memory.vertexBytes) / fatTotal.vertexBytes), 1) + "% smaller";
+        };
+        TestOutput::PrintInfo("Total: " + FormatBytes(fatTotal.vertexBytes) + " -> " + FormatBytes(packedTotal.vertexBytes) +
+                              " packed (" + saving(packedTotal) + "), " + FormatBytes(octahedralTotal.vertexBytes) +
+                              " with octahedral normals (" + saving(octahedralTotal) + ")");
+    }
+
+    TestOutput::PrintTestPass("asset vertex memory");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Vertex Format Performance");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Vertex Format Performance Tests");
+
+        // Run all performance tests
+        allPassed &= suite.RunTest("Asset Vertex Memory", TestAssetVertexMemory);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -2,6 +2,8 @@
 #include "Animation/SkeletalAnimation.h"
 #include "Animation/AnimationCompression.h"
 #include "Animation/AnimationStreaming.h"
+#include "Animation/QuantizedAnimation.h"
+#include "Animation/AnimationSkeleton.h"
 
 using namespace GameEngine;
 using namespace GameEngine::Testing;
@@ -120,6 +122,103 @@ bool TestAnimationCompressor() {
     return true;
 }
 
+/**
+ * Test bit-packed quantized clips with constant track detection
+ * Requirements: smallest-three rotations, range-quantized vectors, sampling from the packed stream
+ */
+bool TestQuantizedAnimation() {
+    TestOutput::PrintTestStart("quantized animation");
+
+    auto skeleton = std::make_shared<GameEngine::Animation::AnimationSkeleton>("quantized_skeleton");
+    for (int i = 0; i < 10; ++i) {
+        skeleton->CreateBone("bone" + std::to_string(i), glm::translate(Math::Mat4(1.0f), Math::Vec3(0.0f, 0.5f, 0.0f)));
+    }
+    auto layout = GameEngine::Animation::PoseLayout::Create(*skeleton);
+
+    // Two-second clip keyed every frame; bone9 is never animated
+    GameEngine::Animation::SkeletalAnimation original("quantized_animation");
+    original.SetDuration(2.0f);
+    original.SetFrameRate(30.0f);
+    for (int i = 0; i < 9; ++i) {
+        const std::string boneName = "bone" + std::to_string(i);
+        for (int frame = 0; frame <= 60; ++frame) {
+            float time = frame / 30.0f;
+            original.AddRotationKeyframe(boneName, time, glm::angleAxis(std::sin(time * 3.0f + i) * 1.5f, glm::normalize(Math::Vec3(1.0f, 0.5f, 0.2f * i))));
+            original.AddPositionKeyframe(boneName, time, Math::Vec3(0.0f, 0.5f, 0.0f) + (i == 0 ? Math::Vec3(time, 0.0f, 0.0f) : Math::Vec3(0.0f)));
+        }
+    }
+
+    GameEngine::Animation::AnimationCompressor compressor;
+    GameEngine::Animation::CompressionSettings settings;
+    auto quantized = compressor.QuantizeAnimation(original, layout, settings);
+    EXPECT_NOT_NULL(quantized);
+    EXPECT_TRUE(quantized->IsCompatibleWith(*layout));
+
+    // Only bone0 translates; every bone keeps a constant scale; bone9 has a constant rotation
+    EXPECT_EQUAL(quantized->GetAnimatedTrackCount(), static_cast<size_t>(1 + 9));
+    EXPECT_EQUAL(quantized->GetConstantTrackCount(), static_cast<size_t>(9 + 1 + 10));
+
+    auto report = quantized->Measure(original, layout);
+    TestOutput::PrintInfo("Compressed " + std::to_string(report.originalBytes) + " -> " + std::to_string(report.compressedBytes) +
+                          " bytes (" + StringUtils::FormatFloat(report.compressionRatio, 1) + "x), max rotation error " +
+                          StringUtils::FormatFloat(report.maxRotationError, 5) + " rad");
+    EXPECT_TRUE(report.compressionRatio >= 5.0f);
+    EXPECT_TRUE(report.maxPositionError < 0.001f);
+    EXPECT_TRUE(report.maxRotationError < 0.002f);
+    EXPECT_TRUE(report.maxScaleError < 0.001f);
+
+    const auto& stats = compressor.GetLastCompressionStats();
+    EXPECT_EQUAL(stats.compressedMemoryBytes, quantized->GetMemoryUsage());
+
+    TestOutput::PrintTestPass("quantized animation");
+    return true;
+}
+
+/**
+ * Test sampling the end of a quantized clip whose duration is not a whole number of frames
+ * Requirements: sampling from the packed stream returns the clip's end pose
+ */
+bool TestQuantizedSamplingAtFractionalEnd() {
+    TestOutput::PrintTestStart("quantized sampling at fractional end");
+
+    auto skeleton = std::make_shared<GameEngine::Animation::AnimationSkeleton>("fractional_skeleton");
+    skeleton->CreateBone("root");
+    skeleton->CreateBone("spine", glm::translate(Math::Mat4(1.0f), Math::Vec3(0.0f, 1.0f, 0.0f)));
+    skeleton->SetBoneParent("spine", "root");
+    auto layout = GameEngine::Animation::PoseLayout::Create(*skeleton);
+
+    // 1.05 s at 30 Hz: the last stored segment is half a frame long
+    GameEngine::Animation::SkeletalAnimation original("fractional_animation");
+    original.SetDuration(1.05f);
+    original.AddPositionKeyframe("root", 0.0f, Math::Vec3(0.0f));
+    original.AddPositionKeyframe("root", 1.05f, Math::Vec3(2.1f, 0.0f, 0.0f));
+    original.AddRotationKeyframe("spine", 0.0f, Math::Quat(1.0f, 0.0f, 0.0f, 0.0f));
+    original.AddRotationKeyframe("spine", 1.05f, glm::angleAxis(1.0f, Math::Vec3(0.0f, 1.0f, 0.0f)));
+
+    GameEngine::Animation::CompressionSettings settings;
+    settings.sampleRate = 30.0f;
+    auto quantized = GameEngine::Animation::QuantizedAnimation::Create(original, layout, settings);
+    EXPECT_NOT_NULL(quantized);
+    EXPECT_EQUAL(quantized->GetFrameCount(), static_cast<size_t>(33));
+
+    const auto binding = GameEngine::Animation::AnimationBinding::Create(original, *layout);
+    GameEngine::Animation::IndexedPose quantizedPose(layout);
+    GameEngine::Animation::IndexedPose trackPose(layout);
+
+    // The clip end returns the end pose, and times inside the short segment stay on the tracks
+    for (float time : {1.05f, 1.04f, 1.0f}) {
+        quantized->Sample(time, quantizedPose);
+        GameEngine::Animation::PoseEvaluator::EvaluateAnimation(original, binding, time, trackPose);
+        for (size_t i = 0; i < layout->GetBoneCount(); ++i) {
+            EXPECT_NEAR_VEC3_EPSILON(quantizedPose.GetTranslations()[i], trackPose.GetTranslations()[i], 0.001f);
+            EXPECT_TRUE(std::abs(glm::dot(quantizedPose.GetRotations()[i], trackPose.GetRotations()[i])) > 0.99999f);
+        }
+    }
+
+    TestOutput::PrintTestPass("quantized sampling at fractional end");
+    return true;
+}
+
 /**
  * Test animation streaming manager
  * Requirements: 7.5, 7.6 (streaming and memory management)
@@ -248,6 +347,8 @@ int main() {
         allPassed &= suite.RunTest("Animation Keyframe Optimization", TestAnimationKeyframeOptimization);
         allPassed &= suite.RunTest("Animation Compression", TestAnimationCompression);
         allPassed &= suite.RunTest("Animation Compressor", TestAnimationCompressor);
+        allPassed &= suite.RunTest("Quantized Animation", TestQuantizedAnimation);
+        allPassed &= suite.RunTest("Quantized Sampling At Fractional End", TestQuantizedSamplingAtFractionalEnd);
         allPassed &= suite.RunTest("Animation Streaming Manager", TestAnimationStreamingManager);
         allPassed &= suite.RunTest("Animation Data Cache", TestAnimationDataCache);
         allPassed &= suite.RunTest("Animation Preloader", TestAnimationPreloader);
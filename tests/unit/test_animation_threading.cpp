@@ -2,9 +2,12 @@
 #include "Animation/AnimationThreading.h"
 #include "Animation/AnimationController.h"
 #include "Animation/AnimationSkeleton.h"
+#include "Core/JobSystem.h"
 #include "Core/Math.h"
 #include <thread>
 #include <chrono>
+#include <atomic>
+#include <vector>
 
 using namespace GameEngine;
 using namespace GameEngine::Testing;
@@ -118,6 +121,106 @@ bool TestAnimationBatchProcessing() {
     return true;
 }
 
+/**
+ * Test counter-based submission, ranges and nested tasks
+ * Requirements: lock-free work-stealing deques with a completion counter instead of futures
+ */
+bool TestAnimationTaskCounter() {
+    TestOutput::PrintTestStart("animation task counter");
+
+    AnimationThreadPool threadPool;
+
+    AnimationThreadConfig config;
+    config.numThreads = 3;
+
+    EXPECT_TRUE(threadPool.Initialize(config));
+
+    // Every index of a range is visited exactly once, whatever the stealing pattern
+    std::vector<std::atomic<int>> visits(5000);
+    for (auto& visit : visits) {
+        visit = 0;
+    }
+    threadPool.ParallelFor(visits.size(), 16, [&visits](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            visits[i]++;
+        }
+    });
+    bool allVisitedOnce = true;
+    for (const auto& visit : visits) {
+        allVisitedOnce &= visit.load() == 1;
+    }
+    EXPECT_TRUE(allVisitedOnce);
+
+    // Tasks that submit and wait on their own children (pushed to the worker's deque)
+    AnimationTaskCounter counter;
+    std::atomic<int> executed{0};
+    for (int i = 0; i < 100; ++i) {
+        threadPool.Submit([&threadPool, &executed]() {
+            AnimationTaskCounter children;
+            for (int child = 0; child < 4; ++child) {
+                threadPool.Submit([&executed]() { executed++; }, children);
+            }
+            threadPool.Wait(children);
+            executed++;
+        }, counter);
+    }
+    threadPool.Wait(counter);
+
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQUAL(executed.load(), 500);
+    EXPECT_TRUE(threadPool.IsIdle());
+
+    threadPool.Shutdown();
+
+    TestOutput::PrintTestPass("animation task counter");
+    return true;
+}
+
+/**
+ * Test a pool running on the engine job system instead of its own threads
+ * Requirements: animation work shares the engine JobSystem workers
+ */
+bool TestAnimationThreadPoolOnJobSystem() {
+    TestOutput::PrintTestStart("animation thread pool on job system");
+
+    JobSystem jobSystem;
+    jobSystem.Initialize(JobSystemConfig{3, 0});
+
+    AnimationThreadPool threadPool;
+    threadPool.SetJobSystem(&jobSystem);
+    EXPECT_TRUE(threadPool.Initialize());
+    EXPECT_EQUAL(threadPool.GetThreadCount(), jobSystem.GetWorkerCount());
+
+    std::atomic<int> executed{0};
+    AnimationTaskCounter counter;
+    threadPool.SubmitRange(1000, 0, [&executed](size_t begin, size_t end) {
+        executed += static_cast<int>(end - begin);
+    }, counter, AnimationTaskPriority::High);
+    for (int i = 0; i < 50; ++i) {
+        threadPool.Submit([&threadPool, &executed]() {
+            AnimationTaskCounter children;
+            threadPool.SubmitRange(4, 1, [&executed](size_t begin, size_t end) {
+                executed += static_cast<int>(end - begin);
+            }, children);
+            threadPool.Wait(children);
+        }, counter);
+    }
+    threadPool.Wait(counter);
+    EXPECT_EQUAL(executed.load(), 1200);
+
+    auto future = threadPool.SubmitTask([&executed]() { executed++; });
+    future.wait();
+    threadPool.WaitForAll();
+    EXPECT_EQUAL(executed.load(), 1201);
+    EXPECT_TRUE(threadPool.IsIdle());
+
+    threadPool.Shutdown();
+    jobSystem.Shutdown();
+
+    TestOutput::PrintTestPass("animation thread pool on job system");
+    return true;
+}
+
 /**
  * Test multi-threaded animation manager
  * Requirements: 9.6 (multi-threaded animation updates)
@@ -152,6 +255,11 @@ bool TestMultiThreadedAnimationManager() {
     manager.UpdateAnimations(0.016f);
     manager.WaitForAnimationUpdates();
 
+    // Batched path runs asynchronously until waited on
+    manager.UpdateAnimationsBatched(0.016f, 2);
+    manager.UpdateAnimationsBatched(0.016f, 2);
+    manager.WaitForAnimationUpdates();
+
     // Get statistics
     auto stats = manager.GetStats();
     EXPECT_EQUAL(stats.totalInstances, static_cast<size_t>(5));
@@ -360,6 +468,8 @@ int main() {
         allPassed &= suite.RunTest("Animation Thread Pool Initialization", TestAnimationThreadPoolInitialization);
         allPassed &= suite.RunTest("Animation Task Submission", TestAnimationTaskSubmission);
         allPassed &= suite.RunTest("Animation Batch Processing", TestAnimationBatchProcessing);
+        allPassed &= suite.RunTest("Animation Task Counter", TestAnimationTaskCounter);
+        allPassed &= suite.RunTest("Animation Thread Pool On Job System", TestAnimationThreadPoolOnJobSystem);
         allPassed &= suite.RunTest("Multi-Threaded Animation Manager", TestMultiThreadedAnimationManager);
         allPassed &= suite.RunTest("Animation Thread Pool Statistics", TestAnimationThreadPoolStatistics);
         allPassed &= suite.RunTest("GPU Animation Processor", TestGPUAnimationProcessor);
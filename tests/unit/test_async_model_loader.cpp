@@ -1,61 +1,99 @@
 #include "TestUtils.h"
 #include "Resource/AsyncModelLoader.h"
+#include "Core/JobSystem.h"
 #include "Core/Logger.h"
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
 #include <thread>
 
 using namespace GameEngine;
 using namespace GameEngine::Testing;
 
+namespace {
+    const std::string SCHEDULER_ASSET_DIRECTORY = "test_scheduler_assets";
+
+    std::string CreateTriangleModel(const std::string& name) {
+        std::filesystem::create_directories(SCHEDULER_ASSET_DIRECTORY);
+        std::string path = SCHEDULER_ASSET_DIRECTORY + "/" + name + ".obj";
+        std::ofstream file(path);
+        file << "v 0.0 0.0 0.0\nv 1.0 0.0 0.0\nv 0.0 1.0 0.0\nf 1 2 3\n";
+        return path;
+    }
+
+    // Records the order loads start in, holding the first one until Release() so the rest queue up
+    class LoadGate {
+    public:
+        void OnProgress(const std::string& filepath, const std::string& stage) {
+            if (stage != "Initializing") {
+                return;
+            }
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_startOrder.push_back(filepath);
+            if (m_startOrder.size() == 1) {
+                m_condition.wait(lock, [this] { return m_released; });
+            }
+        }
+
+        void Release() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_released = true;
+            }
+            m_condition.notify_all();
+        }
+
+        std::vector<std::string> GetStartOrder() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_startOrder;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::vector<std::string> m_startOrder;
+        bool m_released = false;
+    };
+
+    size_t IndexOf(const std::vector<std::string>& order, const std::string& filepath) {
+        return static_cast<size_t>(std::find(order.begin(), order.end(), filepath) - order.begin());
+    }
+}
+
 bool TestAsyncModelLoaderInitialization() {
     TestOutput::PrintTestStart("AsyncModelLoader initialization");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize(JobSystemConfig{2, 2});
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     
     // Test initialization
-    EXPECT_TRUE(loader.Initialize(2));
+    EXPECT_TRUE(loader.Initialize());
     EXPECT_TRUE(loader.IsInitialized());
     EXPECT_EQUAL(loader.GetWorkerThreadCount(), static_cast<uint32_t>(2));
     
     // Test shutdown
     loader.Shutdown();
+    jobSystem.Shutdown();
     EXPECT_FALSE(loader.IsInitialized());
 
     TestOutput::PrintTestPass("AsyncModelLoader initialization");
     return true;
 }
 
-bool TestThreadPoolBasic() {
-    TestOutput::PrintTestStart("ThreadPool basic functionality");
-
-    ThreadPool pool(2);
-    
-    // Test simple task execution
-    std::atomic<int> counter{0};
-    std::vector<std::future<void>> futures;
-    
-    for (int i = 0; i < 5; ++i) {
-        futures.push_back(pool.Enqueue([&counter]() {
-            counter++;
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        }));
-    }
-    
-    // Wait for all tasks
-    for (auto& future : futures) {
-        future.wait();
-    }
-    
-    EXPECT_EQUAL(counter.load(), 5);
-
-    TestOutput::PrintTestPass("ThreadPool basic functionality");
-    return true;
-}
-
 bool TestAsyncModelLoaderConfiguration() {
     TestOutput::PrintTestStart("AsyncModelLoader configuration");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     EXPECT_TRUE(loader.Initialize());
 
     // Test default configuration
@@ -71,6 +109,7 @@ bool TestAsyncModelLoaderConfiguration() {
     EXPECT_TRUE(static_cast<uint32_t>(loader.GetDefaultLoadingFlags()) == static_cast<uint32_t>(ModelLoader::LoadingFlags::GenerateNormals));
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("AsyncModelLoader configuration");
     return true;
@@ -79,7 +118,11 @@ bool TestAsyncModelLoaderConfiguration() {
 bool TestProgressTracking() {
     TestOutput::PrintTestStart("progress tracking");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     EXPECT_TRUE(loader.Initialize());
 
     // Test progress callback
@@ -104,6 +147,7 @@ bool TestProgressTracking() {
     EXPECT_EQUAL(activeLoads.size(), static_cast<size_t>(0));
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("progress tracking");
     return true;
@@ -112,7 +156,11 @@ bool TestProgressTracking() {
 bool TestLoadCancellation() {
     TestOutput::PrintTestStart("load cancellation");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     EXPECT_TRUE(loader.Initialize());
 
     // Test cancellation of non-existent load
@@ -122,6 +170,7 @@ bool TestLoadCancellation() {
     loader.CancelAllLoads();
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("load cancellation");
     return true;
@@ -130,7 +179,11 @@ bool TestLoadCancellation() {
 bool TestLoadingStats() {
     TestOutput::PrintTestStart("loading statistics");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     EXPECT_TRUE(loader.Initialize());
 
     // Test initial stats
@@ -147,6 +200,7 @@ bool TestLoadingStats() {
     EXPECT_EQUAL(stats.totalLoadsStarted, static_cast<uint32_t>(0));
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("loading statistics");
     return true;
@@ -155,7 +209,11 @@ bool TestLoadingStats() {
 bool TestAsyncModelLoaderErrorHandling() {
     TestOutput::PrintTestStart("AsyncModelLoader error handling");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
 
     // Test operations without initialization
     try {
@@ -192,6 +250,7 @@ bool TestAsyncModelLoaderErrorHandling() {
     }
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("AsyncModelLoader error handling");
     return true;
@@ -200,7 +259,11 @@ bool TestAsyncModelLoaderErrorHandling() {
 bool TestCleanupAndResourceManagement() {
     TestOutput::PrintTestStart("cleanup and resource management");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     EXPECT_TRUE(loader.Initialize());
 
     // Test cleanup of completed tasks
@@ -210,11 +273,215 @@ bool TestCleanupAndResourceManagement() {
     loader.WaitForAllLoads(); // Should return immediately
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("cleanup and resource management");
     return true;
 }
 
+/**
+ * Test that queued loads start by priority rather than submission order
+ * Requirements: priority scheduling for queued model loads
+ */
+bool TestPriorityScheduling() {
+    TestOutput::PrintTestStart("priority scheduling");
+
+    std::string blocker = CreateTriangleModel("priority_blocker");
+    std::string low0 = CreateTriangleModel("priority_low0");
+    std::string low1 = CreateTriangleModel("priority_low1");
+    std::string high = CreateTriangleModel("priority_high");
+    std::string critical = CreateTriangleModel("priority_critical");
+
+    JobSystem jobSystem;
+    jobSystem.Initialize(JobSystemConfig{2, 2});
+
+    AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
+    EXPECT_TRUE(loader.Initialize());
+    loader.SetMaxConcurrentLoads(1);
+
+    LoadGate gate;
+    loader.SetProgressCallback([&gate](const std::string& filepath, float, const std::string& stage) {
+        gate.OnProgress(filepath, stage);
+    });
+
+    using Priority = AsyncModelLoader::TaskPriority;
+    auto flags = ModelLoader::LoadingFlags::None;
+    std::vector<std::future<std::shared_ptr<Model>>> futures;
+    futures.push_back(loader.LoadModelAsync(blocker, flags, Priority::Normal));
+    futures.push_back(loader.LoadModelAsync(low0, flags, Priority::Low));
+    futures.push_back(loader.LoadModelAsync(low1, flags, Priority::Low));
+    futures.push_back(loader.LoadModelAsync(high, flags, Priority::High));
+    futures.push_back(loader.LoadModelAsync(critical, flags, Priority::Critical));
+
+    std::vector<std::string> queued = loader.GetQueuedTasks();
+    EXPECT_EQUAL(queued.size(), static_cast<size_t>(4));
+    if (queued.size() == 4) {
+        EXPECT_STRING_EQUAL(queued[0], critical);
+        EXPECT_STRING_EQUAL(queued[3], low1);
+    }
+
+    gate.Release();
+    for (auto& future : futures) {
+        EXPECT_NOT_NULL(future.get());
+    }
+
+    std::vector<std::string> order = gate.GetStartOrder();
+    std::vector<std::string> expected = {blocker, critical, high, low0, low1};
+    EXPECT_TRUE(order == expected);
+
+    auto criticalLatency = loader.GetLatencyStats(Priority::Critical);
+    EXPECT_EQUAL(criticalLatency.completedLoads, static_cast<uint32_t>(1));
+    EXPECT_TRUE(criticalLatency.averageLatencyMs >= criticalLatency.averageQueueTimeMs);
+    EXPECT_EQUAL(loader.GetLoadingStats().latencyByPriority[0].completedLoads, static_cast<uint32_t>(2));
+
+    loader.Shutdown();
+    jobSystem.Shutdown();
+    std::filesystem::remove_all(SCHEDULER_ASSET_DIRECTORY);
+
+    TestOutput::PrintTestPass("priority scheduling");
+    return true;
+}
+
+/**
+ * Test that dependents start only after their inputs load, and fail if an input fails
+ * Requirements: dependency DAG resolution for model loads
+ */
+bool TestDependencyResolution() {
+    TestOutput::PrintTestStart("dependency resolution");
+
+    std::string blocker = CreateTriangleModel("dependency_blocker");
+    std::string skeleton = CreateTriangleModel("dependency_skeleton");
+    std::string materials = CreateTriangleModel("dependency_materials");
+    std::string character = CreateTriangleModel("dependency_character");
+    std::string orphan = CreateTriangleModel("dependency_orphan");
+    std::string missing = SCHEDULER_ASSET_DIRECTORY + "/does_not_exist.obj";
+
+    JobSystem jobSystem;
+    jobSystem.Initialize(JobSystemConfig{2, 2});
+
+    AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
+    EXPECT_TRUE(loader.Initialize());
+    loader.SetMaxConcurrentLoads(1);
+
+    LoadGate gate;
+    loader.SetProgressCallback([&gate](const std::string& filepath, float, const std::string& stage) {
+        gate.OnProgress(filepath, stage);
+    });
+
+    using Priority = AsyncModelLoader::TaskPriority;
+    auto flags = ModelLoader::LoadingFlags::None;
+    auto blockerFuture = loader.LoadModelAsync(blocker, flags, Priority::Normal);
+
+    // The skeleton is queued explicitly at low priority; the materials only as a dependency
+    auto skeletonFuture = loader.LoadModelAsync(skeleton, flags, Priority::Low);
+    auto characterFuture = loader.LoadModelAsync(character, flags, Priority::Critical, {skeleton, materials});
+    auto orphanFuture = loader.LoadModelAsync(orphan, flags, Priority::High, {missing});
+
+    EXPECT_FALSE(loader.HasDependenciesResolved(character));
+    EXPECT_TRUE(loader.IsLoading(blocker));
+
+    gate.Release();
+    EXPECT_NOT_NULL(blockerFuture.get());
+    EXPECT_NOT_NULL(skeletonFuture.get());
+    EXPECT_NOT_NULL(characterFuture.get());
+
+    // The failed input takes its dependent down with it
+    bool orphanFailed = false;
+    try {
+        orphanFuture.get();
+    } catch (const std::exception& e) {
+        orphanFailed = std::string(e.what()).find("Dependency failed") != std::string::npos;
+    }
+    EXPECT_TRUE(orphanFailed);
+
+    loader.WaitForAllLoads();
+    std::vector<std::string> order = gate.GetStartOrder();
+    EXPECT_TRUE(IndexOf(order, character) > IndexOf(order, skeleton));
+    EXPECT_TRUE(IndexOf(order, character) > IndexOf(order, materials));
+    EXPECT_TRUE(IndexOf(order, character) < order.size());
+    EXPECT_TRUE(IndexOf(order, orphan) == order.size());
+
+    // The critical dependent lifted its low-priority input ahead of the high-priority orphan chain
+    EXPECT_TRUE(IndexOf(order, skeleton) < IndexOf(order, missing));
+
+    loader.Shutdown();
+    jobSystem.Shutdown();
+    std::filesystem::remove_all(SCHEDULER_ASSET_DIRECTORY);
+
+    TestOutput::PrintTestPass("dependency resolution");
+    return true;
+}
+
+/**
+ * Test changing priority of and cancelling tasks that are already queued
+ * Requirements: priority changes and cancellation for queued tasks
+ */
+bool TestQueuedTaskManagement() {
+    TestOutput::PrintTestStart("queued task management");
+
+    std::string blocker = CreateTriangleModel("queued_blocker");
+    std::string first = CreateTriangleModel("queued_first");
+    std::string second = CreateTriangleModel("queued_second");
+    std::string dependent = CreateTriangleModel("queued_dependent");
+
+    JobSystem jobSystem;
+    jobSystem.Initialize(JobSystemConfig{2, 2});
+
+    AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
+    EXPECT_TRUE(loader.Initialize());
+    loader.SetMaxConcurrentLoads(1);
+
+    LoadGate gate;
+    loader.SetProgressCallback([&gate](const std::string& filepath, float, const std::string& stage) {
+        gate.OnProgress(filepath, stage);
+    });
+
+    using Priority = AsyncModelLoader::TaskPriority;
+    auto flags = ModelLoader::LoadingFlags::None;
+    auto blockerFuture = loader.LoadModelAsync(blocker, flags, Priority::Normal);
+    auto firstFuture = loader.LoadModelAsync(first, flags, Priority::Low);
+    auto secondFuture = loader.LoadModelAsync(second, flags, Priority::Low);
+    auto dependentFuture = loader.LoadModelAsync(dependent, flags, Priority::Normal, {first});
+
+    // Running loads can't be re-prioritized; queued ones move in the queue
+    EXPECT_FALSE(loader.SetLoadPriority(blocker, Priority::Critical));
+    EXPECT_TRUE(loader.SetLoadPriority(second, Priority::High));
+    std::vector<std::string> queued = loader.GetQueuedTasks();
+    EXPECT_TRUE(!queued.empty() && queued.front() == second);
+
+    // Cancelling a queued task fails it (and what depends on it) without waiting for a slot
+    EXPECT_TRUE(loader.CancelLoad(first));
+    EXPECT_TRUE(firstFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    EXPECT_TRUE(dependentFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    bool dependentFailed = false;
+    try {
+        dependentFuture.get();
+    } catch (const std::exception&) {
+        dependentFailed = true;
+    }
+    EXPECT_TRUE(dependentFailed);
+    EXPECT_EQUAL(loader.GetQueuedTasks().size(), static_cast<size_t>(1));
+
+    gate.Release();
+    EXPECT_NOT_NULL(blockerFuture.get());
+    EXPECT_NOT_NULL(secondFuture.get());
+    loader.WaitForAllLoads();
+
+    std::vector<std::string> order = gate.GetStartOrder();
+    EXPECT_EQUAL(order.size(), static_cast<size_t>(2));
+    EXPECT_EQUAL(loader.GetLoadingStats().totalLoadsCancelled, static_cast<uint32_t>(2));
+
+    loader.Shutdown();
+    jobSystem.Shutdown();
+    std::filesystem::remove_all(SCHEDULER_ASSET_DIRECTORY);
+
+    TestOutput::PrintTestPass("queued task management");
+    return true;
+}
+
 int main() {
     TestOutput::PrintHeader("AsyncModelLoader Unit Tests");
 
@@ -223,13 +490,15 @@ int main() {
 
     try {
         allPassed &= suite.RunTest("AsyncModelLoader Initialization", TestAsyncModelLoaderInitialization);
-        allPassed &= suite.RunTest("ThreadPool Basic Functionality", TestThreadPoolBasic);
         allPassed &= suite.RunTest("AsyncModelLoader Configuration", TestAsyncModelLoaderConfiguration);
         allPassed &= suite.RunTest("Progress Tracking", TestProgressTracking);
         allPassed &= suite.RunTest("Load Cancellation", TestLoadCancellation);
         allPassed &= suite.RunTest("Loading Statistics", TestLoadingStats);
         allPassed &= suite.RunTest("AsyncModelLoader Error Handling", TestAsyncModelLoaderErrorHandling);
         allPassed &= suite.RunTest("Cleanup and Resource Management", TestCleanupAndResourceManagement);
+        allPassed &= suite.RunTest("Priority Scheduling", TestPriorityScheduling);
+        allPassed &= suite.RunTest("Dependency Resolution", TestDependencyResolution);
+        allPassed &= suite.RunTest("Queued Task Management", TestQueuedTaskManagement);
 
         // Print detailed summary
         suite.PrintSummary();
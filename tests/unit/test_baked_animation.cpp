@@ -0,0 +1,203 @@
+#include "TestUtils.h"
+#include "Animation/BakedAnimation.h"
+#include "Animation/AnimationController.h"
+#include "Animation/IndexedPose.h"
+#include "Animation/Pose.h"
+#include "Animation/AnimationSkeleton.h"
+#include "Animation/SkeletalAnimation.h"
+#include "Core/Logger.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+using namespace GameEngine::Animation;
+
+namespace {
+    std::shared_ptr<AnimationSkeleton> CreateTestSkeleton() {
+        auto skeleton = std::make_shared<AnimationSkeleton>("BakedSkeleton");
+        skeleton->CreateBone("Root");
+        skeleton->CreateBone("Spine", glm::translate(Math::Mat4(1.0f), Math::Vec3(0.0f, 1.0f, 0.0f)));
+        skeleton->CreateBone("Static", glm::translate(Math::Mat4(1.0f), Math::Vec3(1.0f, 0.0f, 0.0f)));
+        skeleton->SetBoneParent("Spine", "Root");
+        skeleton->SetBoneParent("Static", "Root");
+        return skeleton;
+    }
+
+    // Keys at a different rate than the bake so baked frames fall between keys
+    std::shared_ptr<SkeletalAnimation> CreateTestAnimation() {
+        auto animation = std::make_shared<SkeletalAnimation>("Sway");
+        animation->SetDuration(1.0f);
+        for (int key = 0; key <= 4; ++key) {
+            float time = key * 0.25f;
+            animation->AddPositionKeyframe("Root", time, Math::Vec3(time * 2.0f, 0.0f, 0.0f));
+            animation->AddRotationKeyframe("Spine", time, glm::angleAxis(time, Math::Vec3(0.0f, 1.0f, 0.0f)));
+        }
+        return animation;
+    }
+}
+
+/**
+ * Test that baked frames reproduce the keyframe evaluation
+ * Requirements: fixed-rate resampling into one interleaved frame buffer
+ */
+bool TestBakedSamplingMatchesTracks() {
+    TestOutput::PrintTestStart("baked sampling matches tracks");
+
+    auto skeleton = CreateTestSkeleton();
+    auto layout = PoseLayout::Create(*skeleton);
+    auto animation = CreateTestAnimation();
+    auto baked = BakedAnimation::Bake(*animation, layout, 60.0f);
+
+    EXPECT_NOT_NULL(baked);
+    EXPECT_EQUAL(baked->GetFrameCount(), static_cast<size_t>(61));
+    EXPECT_EQUAL(baked->GetBoneCount(), layout->GetBoneCount());
+    EXPECT_TRUE(baked->IsCompatibleWith(*layout));
+
+    const AnimationBinding binding = AnimationBinding::Create(*animation, *layout);
+    IndexedPose bakedPose(layout);
+    IndexedPose trackPose(layout);
+
+    // Tracks are linear, so the baked reconstruction matches between frames as well
+    for (float time : {0.0f, 0.1f, 0.37f, 0.5f, 0.99f, 1.0f}) {
+        baked->Sample(time, bakedPose);
+        PoseEvaluator::EvaluateAnimation(*animation, binding, time, trackPose);
+        for (size_t i = 0; i < layout->GetBoneCount(); ++i) {
+            EXPECT_NEAR_VEC3(bakedPose.GetTranslations()[i], trackPose.GetTranslations()[i]);
+            EXPECT_NEAR_QUAT(bakedPose.GetRotations()[i], trackPose.GetRotations()[i]);
+            EXPECT_NEAR_VEC3(bakedPose.GetScales()[i], trackPose.GetScales()[i]);
+        }
+    }
+
+    // Unanimated bones are baked at their bind pose
+    const size_t staticIndex = static_cast<size_t>(layout->GetBoneIndex("Static"));
+    EXPECT_NEAR_VEC3(bakedPose.GetTranslations()[staticIndex], layout->GetBindTranslations()[staticIndex]);
+
+    TestOutput::PrintTestPass("baked sampling matches tracks");
+    return true;
+}
+
+/**
+ * Test sampling the end of a clip whose duration is not a whole number of frames
+ * Requirements: fixed-rate resampling into one interleaved frame buffer
+ */
+bool TestBakedSamplingAtFractionalEnd() {
+    TestOutput::PrintTestStart("baked sampling at fractional end");
+
+    auto skeleton = CreateTestSkeleton();
+    auto layout = PoseLayout::Create(*skeleton);
+
+    // 1.05 s at 30 Hz: the last baked segment is half a frame long
+    auto animation = std::make_shared<SkeletalAnimation>("Short");
+    animation->SetDuration(1.05f);
+    animation->AddPositionKeyframe("Root", 0.0f, Math::Vec3(0.0f));
+    animation->AddPositionKeyframe("Root", 1.05f, Math::Vec3(2.1f, 0.0f, 0.0f));
+    animation->AddRotationKeyframe("Spine", 0.0f, Math::Quat(1.0f, 0.0f, 0.0f, 0.0f));
+    animation->AddRotationKeyframe("Spine", 1.05f, glm::angleAxis(1.0f, Math::Vec3(0.0f, 1.0f, 0.0f)));
+
+    auto baked = BakedAnimation::Bake(*animation, layout, 30.0f);
+    EXPECT_NOT_NULL(baked);
+    EXPECT_EQUAL(baked->GetFrameCount(), static_cast<size_t>(33));
+
+    const AnimationBinding binding = AnimationBinding::Create(*animation, *layout);
+    IndexedPose bakedPose(layout);
+    IndexedPose trackPose(layout);
+
+    // The clip end returns the end pose, and times inside the short segment stay on the tracks
+    for (float time : {1.05f, 1.04f, 1.0f}) {
+        baked->Sample(time, bakedPose);
+        PoseEvaluator::EvaluateAnimation(*animation, binding, time, trackPose);
+        for (size_t i = 0; i < layout->GetBoneCount(); ++i) {
+            EXPECT_NEAR_VEC3(bakedPose.GetTranslations()[i], trackPose.GetTranslations()[i]);
+            EXPECT_NEAR_QUAT(bakedPose.GetRotations()[i], trackPose.GetRotations()[i]);
+        }
+    }
+
+    TestOutput::PrintTestPass("baked sampling at fractional end");
+    return true;
+}
+
+/**
+ * Test that a controller plays a shared baked clip
+ * Requirements: controllers can play baked clips instead of keyframe tracks
+ */
+bool TestControllerBakedPlayback() {
+    TestOutput::PrintTestStart("controller baked playback");
+
+    auto skeleton = CreateTestSkeleton();
+    auto animation = CreateTestAnimation();
+
+    AnimationController trackController;
+    AnimationController bakedController;
+    EXPECT_TRUE(trackController.Initialize(skeleton));
+    EXPECT_TRUE(bakedController.Initialize(skeleton));
+    trackController.AddAnimation("Sway", animation);
+    bakedController.AddAnimation("Sway", animation);
+
+    // Bake once and share, as a crowd would
+    auto layout = PoseLayout::Create(*skeleton);
+    std::shared_ptr<const BakedAnimation> baked = BakedAnimation::Bake(*animation, layout, 120.0f);
+    EXPECT_TRUE(bakedController.SetBakedAnimation("Sway", baked));
+    EXPECT_TRUE(bakedController.HasBakedAnimation("Sway"));
+    EXPECT_FALSE(trackController.HasBakedAnimation("Sway"));
+
+    trackController.AddAnimationLayer("Sway", 1.0f, 0.4f);
+    bakedController.AddAnimationLayer("Sway", 1.0f, 0.4f);
+
+    Pose trackPose = trackController.EvaluateCurrentPose();
+    Pose bakedPose = bakedController.EvaluateCurrentPose();
+    for (const auto& bone : skeleton->GetAllBones()) {
+        EXPECT_NEAR_VEC3(bakedPose.GetBoneTransform(bone->GetName()).position, trackPose.GetBoneTransform(bone->GetName()).position);
+        EXPECT_NEAR_QUAT(bakedPose.GetBoneTransform(bone->GetName()).rotation, trackPose.GetBoneTransform(bone->GetName()).rotation);
+    }
+
+    // A clip baked for another skeleton is rejected
+    auto otherSkeleton = std::make_shared<AnimationSkeleton>("Other");
+    otherSkeleton->CreateBone("Root");
+    auto otherBaked = BakedAnimation::Bake(*animation, PoseLayout::Create(*otherSkeleton));
+    EXPECT_FALSE(bakedController.SetBakedAnimation("Sway", otherBaked));
+
+    EXPECT_TRUE(bakedController.SetBakedAnimation("Sway", nullptr));
+    EXPECT_FALSE(bakedController.HasBakedAnimation("Sway"));
+
+    // Replacing the clip under the same name releases the old clip's baked data
+    EXPECT_TRUE(bakedController.SetBakedAnimation("Sway", baked));
+    std::weak_ptr<const BakedAnimation> replacedBake = baked;
+    baked.reset();
+    bakedController.AddAnimation("Sway", CreateTestAnimation());
+    EXPECT_FALSE(bakedController.HasBakedAnimation("Sway"));
+    EXPECT_TRUE(replacedBake.expired());
+
+    TestOutput::PrintTestPass("controller baked playback");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("BakedAnimation");
+
+    // Controller setup logs at info level; keep the test output readable
+    Logger::GetInstance().SetLogLevel(LogLevel::Error);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("BakedAnimation Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Baked Sampling Matches Tracks", TestBakedSamplingMatchesTracks);
+        allPassed &= suite.RunTest("Baked Sampling At Fractional End", TestBakedSamplingAtFractionalEnd);
+        allPassed &= suite.RunTest("Controller Baked Playback", TestControllerBakedPlayback);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -0,0 +1,287 @@
+#include "TestUtils.h"
+#include "Graphics/BlockCompression.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    // Smooth gradients with a hard edge, a few colour clusters and mild noise; alpha ramps
+    std::vector<uint8_t> CreateTestImage(uint32_t width, uint32_t height, uint32_t channels) {
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * channels);
+        uint32_t seed = 12345;
+        for (uint32_t y = 0; y < height; ++y) {
+            for (uint32_t x = 0; x < width; ++x) {
+                seed = seed * 1664525u + 1013904223u;
+                const int noise = static_cast<int>((seed >> 24) % 9) - 4;
+                const float u = static_cast<float>(x) / width;
+                const float v = static_cast<float>(y) / height;
+                int rgba[4] = {
+                    static_cast<int>(255.0f * u),
+                    static_cast<int>(128.0f + 100.0f * std::sin(v * 9.0f)),
+                    x > width / 2 ? 200 : 40,
+                    static_cast<int>(255.0f * v)
+                };
+                uint8_t* out = pixels.data() + (static_cast<size_t>(y) * width + x) * channels;
+                for (uint32_t c = 0; c < channels; ++c) {
+                    out[c] = static_cast<uint8_t>(std::clamp(rgba[c] + (c < 3 ? noise : 0), 0, 255));
+                }
+            }
+        }
+        return pixels;
+    }
+
+    // PSNR over the first `channels` channels of an RGBA8 decode against the source
+    double CalculatePSNR(const std::vector<uint8_t>& source, uint32_t sourceChannels,
+                         const std::vector<uint8_t>& decoded, uint32_t channels) {
+        const size_t pixelCount = source.size() / sourceChannels;
+        double squaredError = 0.0;
+        for (size_t i = 0; i < pixelCount; ++i) {
+            for (uint32_t c = 0; c < channels; ++c) {
+                const double d = static_cast<double>(source[i * sourceChannels + c]) - decoded[i * 4 + c];
+                squaredError += d * d;
+            }
+        }
+        const double mse = squaredError / static_cast<double>(pixelCount * channels);
+        return mse > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : 99.0;
+    }
+
+    double RoundTripPSNR(const std::vector<uint8_t>& image, uint32_t width, uint32_t height, uint32_t channels,
+                         CompressionFormat format, CompressionQuality quality, uint32_t comparedChannels) {
+        std::vector<uint8_t> blocks, decoded;
+        if (!BlockCompression::CompressImage(image.data(), width, height, channels, format, quality, blocks, 1) ||
+            !BlockCompression::DecompressImage(blocks.data(), width, height, format, decoded)) {
+            return 0.0;
+        }
+        return CalculatePSNR(image, channels, decoded, comparedChannels);
+    }
+
+    std::string FormatDb(double psnr) {
+        return StringUtils::FormatFloat(static_cast<float>(psnr), 2) + " dB";
+    }
+}
+
+/**
+ * Test that single-colour blocks survive every format
+ * Requirements: exact or nearest-representable colours for flat regions
+ */
+bool TestSolidBlocks() {
+    TestOutput::PrintTestStart("solid blocks");
+
+    const uint8_t colors[][4] = {{255, 0, 0, 255}, {0, 0, 0, 255}, {255, 255, 255, 255}, {93, 161, 27, 255}, {200, 130, 7, 255}};
+    for (const auto& color : colors) {
+        uint8_t rgba[64];
+        for (int i = 0; i < 16; ++i) {
+            std::memcpy(rgba + i * 4, color, 4);
+        }
+
+        uint8_t bc1[8], bc7[16], decoded[64];
+        BlockCompression::EncodeBC1(rgba, bc1, CompressionQuality::Fast);
+        BlockCompression::DecodeBC1(bc1, decoded);
+        for (int i = 0; i < 16; ++i) {
+            // The 1/3 interpolant of the best endpoint pair is within a couple of steps
+            for (int c = 0; c < 3; ++c) {
+                EXPECT_TRUE(std::abs(decoded[i * 4 + c] - color[c]) <= 2);
+            }
+            EXPECT_EQUAL(decoded[i * 4 + 3], static_cast<uint8_t>(255));
+        }
+
+        BlockCompression::EncodeBC7(rgba, bc7, CompressionQuality::Normal);
+        EXPECT_TRUE(BlockCompression::DecodeBC7(bc7, decoded));
+        for (int i = 0; i < 64; ++i) {
+            EXPECT_TRUE(std::abs(decoded[i] - rgba[i]) <= 1);
+        }
+
+        uint8_t values[16], bc4[8], decodedValues[16];
+        std::fill(values, values + 16, color[1]);
+        BlockCompression::EncodeBC4(values, bc4, CompressionQuality::Fast);
+        BlockCompression::DecodeBC4(bc4, decodedValues);
+        for (int i = 0; i < 16; ++i) {
+            EXPECT_EQUAL(decodedValues[i], values[i]);
+        }
+    }
+
+    TestOutput::PrintTestPass("solid blocks");
+    return true;
+}
+
+/**
+ * Test alpha handling of BC1 punch-through, BC2 explicit alpha and BC3/BC4 interpolated alpha
+ * Requirements: transparent texels stay transparent, two-level alpha is exact in BC3
+ */
+bool TestAlphaEncoding() {
+    TestOutput::PrintTestStart("alpha encoding");
+
+    uint8_t rgba[64];
+    for (int i = 0; i < 16; ++i) {
+        rgba[i * 4 + 0] = static_cast<uint8_t>(i * 16);
+        rgba[i * 4 + 1] = static_cast<uint8_t>(255 - i * 16);
+        rgba[i * 4 + 2] = 64;
+        rgba[i * 4 + 3] = (i % 3 == 0) ? 0 : 255;
+    }
+
+    uint8_t bc1[8], decoded[64];
+    BlockCompression::EncodeBC1(rgba, bc1, CompressionQuality::High, true);
+    BlockCompression::DecodeBC1(bc1, decoded);
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_EQUAL(decoded[i * 4 + 3], rgba[i * 4 + 3]);
+    }
+
+    // Without punch-through the block is opaque four-colour
+    BlockCompression::EncodeBC1(rgba, bc1, CompressionQuality::High, false);
+    BlockCompression::DecodeBC1(bc1, decoded);
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_EQUAL(decoded[i * 4 + 3], static_cast<uint8_t>(255));
+    }
+
+    uint8_t bc3[16];
+    BlockCompression::EncodeBC3(rgba, bc3, CompressionQuality::Normal);
+    BlockCompression::DecodeBC3(bc3, decoded);
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_EQUAL(decoded[i * 4 + 3], rgba[i * 4 + 3]);
+    }
+
+    uint8_t bc2[16];
+    for (int i = 0; i < 16; ++i) {
+        rgba[i * 4 + 3] = static_cast<uint8_t>(i * 17);
+    }
+    BlockCompression::EncodeBC2(rgba, bc2, CompressionQuality::Fast);
+    BlockCompression::DecodeBC2(bc2, decoded);
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_EQUAL(decoded[i * 4 + 3], rgba[i * 4 + 3]);
+    }
+
+    // BC4 takes 0 and 255 exactly from the six-value mode when the rest is in between
+    uint8_t values[16] = {0, 255, 100, 110, 120, 130, 140, 150, 160, 170, 180, 190, 0, 255, 105, 175};
+    uint8_t bc4[8], decodedValues[16];
+    BlockCompression::EncodeBC4(values, bc4, CompressionQuality::Normal);
+    BlockCompression::DecodeBC4(bc4, decodedValues);
+    EXPECT_TRUE(bc4[0] <= bc4[1]);
+    EXPECT_EQUAL(decodedValues[0], static_cast<uint8_t>(0));
+    EXPECT_EQUAL(decodedValues[1], static_cast<uint8_t>(255));
+    for (int i = 0; i < 16; ++i) {
+        EXPECT_TRUE(std::abs(decodedValues[i] - values[i]) <= 9);
+    }
+
+    TestOutput::PrintTestPass("alpha encoding");
+    return true;
+}
+
+/**
+ * Test image quality of every format and quality level on a synthetic image
+ * Requirements: cluster fit no worse than range fit, BC7 ahead of BC1, BC5 for two channels
+ */
+bool TestImageQuality() {
+    TestOutput::PrintTestStart("image quality");
+
+    const uint32_t width = 64, height = 64;
+    const auto rgb = CreateTestImage(width, height, 3);
+    const auto rgba = CreateTestImage(width, height, 4);
+    const auto rg = CreateTestImage(width, height, 2);
+
+    const double bc1Fast = RoundTripPSNR(rgb, width, height, 3, CompressionFormat::DXT1, CompressionQuality::Fast, 3);
+    const double bc1Normal = RoundTripPSNR(rgb, width, height, 3, CompressionFormat::DXT1, CompressionQuality::Normal, 3);
+    const double bc1High = RoundTripPSNR(rgb, width, height, 3, CompressionFormat::DXT1, CompressionQuality::High, 3);
+    const double bc1Ultra = RoundTripPSNR(rgb, width, height, 3, CompressionFormat::DXT1, CompressionQuality::Ultra, 3);
+    const double bc3 = RoundTripPSNR(rgba, width, height, 4, CompressionFormat::DXT5, CompressionQuality::Normal, 4);
+    const double bc5 = RoundTripPSNR(rg, width, height, 2, CompressionFormat::BC5, CompressionQuality::Normal, 2);
+    const double bc7Fast = RoundTripPSNR(rgba, width, height, 4, CompressionFormat::BC7, CompressionQuality::Fast, 4);
+    const double bc7Normal = RoundTripPSNR(rgb, width, height, 3, CompressionFormat::BC7, CompressionQuality::Normal, 3);
+    const double bc7High = RoundTripPSNR(rgb, width, height, 3, CompressionFormat::BC7, CompressionQuality::High, 3);
+
+    TestOutput::PrintInfo("BC1 fast/normal/high/ultra: " + FormatDb(bc1Fast) + " / " + FormatDb(bc1Normal) + " / " +
+                          FormatDb(bc1High) + " / " + FormatDb(bc1Ultra));
+    TestOutput::PrintInfo("BC3: " + FormatDb(bc3) + ", BC5: " + FormatDb(bc5));
+    TestOutput::PrintInfo("BC7 fast (RGBA)/normal/high: " + FormatDb(bc7Fast) + " / " + FormatDb(bc7Normal) + " / " + FormatDb(bc7High));
+
+    EXPECT_TRUE(bc1Fast > 32.0);
+    EXPECT_TRUE(bc1Normal >= bc1Fast - 0.05);
+    EXPECT_TRUE(bc1High >= bc1Normal - 0.05);
+    EXPECT_TRUE(bc1Ultra >= bc1High - 0.05);
+    EXPECT_TRUE(bc3 > 32.0);
+    EXPECT_TRUE(bc5 > 38.0);
+    EXPECT_TRUE(bc7Fast > bc1Fast);
+    EXPECT_TRUE(bc7Normal > bc1High);
+    EXPECT_TRUE(bc7High >= bc7Normal - 0.05);
+
+    TestOutput::PrintTestPass("image quality");
+    return true;
+}
+
+/**
+ * Test partial edge blocks, thread splitting and the SIMD index search
+ * Requirements: output independent of thread count and of the SSE2 path
+ */
+bool TestDeterministicOutput() {
+    TestOutput::PrintTestStart("deterministic output");
+
+    const uint32_t width = 37, height = 21;
+    const auto image = CreateTestImage(width, height, 4);
+    const CompressionFormat formats[] = {CompressionFormat::DXT1, CompressionFormat::DXT3, CompressionFormat::DXT5,
+                                         CompressionFormat::BC4, CompressionFormat::BC5, CompressionFormat::BC7};
+
+    for (CompressionFormat format : formats) {
+        std::vector<uint8_t> single, threaded, scalar;
+        EXPECT_TRUE(BlockCompression::CompressImage(image.data(), width, height, 4, format, CompressionQuality::High, single, 1));
+        EXPECT_TRUE(BlockCompression::CompressImage(image.data(), width, height, 4, format, CompressionQuality::High, threaded, 4));
+        EXPECT_EQUAL(single.size(), BlockCompression::GetCompressedSize(width, height, format));
+        EXPECT_EQUAL(single.size(), 10u * 6u * BlockCompression::GetBlockSize(format));
+        EXPECT_TRUE(single == threaded);
+
+        if (BlockCompression::IsSimdAvailable()) {
+            BlockCompression::SetSimdEnabled(false);
+            BlockCompression::CompressImage(image.data(), width, height, 4, format, CompressionQuality::High, scalar, 1);
+            BlockCompression::SetSimdEnabled(true);
+            EXPECT_TRUE(single == scalar);
+        }
+
+        std::vector<uint8_t> decoded;
+        EXPECT_TRUE(BlockCompression::DecompressImage(single.data(), width, height, format, decoded));
+        EXPECT_EQUAL(decoded.size(), static_cast<size_t>(width) * height * 4);
+    }
+
+    // Unsupported input is rejected
+    std::vector<uint8_t> output;
+    EXPECT_FALSE(BlockCompression::CompressImage(image.data(), width, height, 5, CompressionFormat::DXT1, CompressionQuality::Fast, output));
+    EXPECT_FALSE(BlockCompression::CompressImage(image.data(), width, height, 4, CompressionFormat::ASTC_4x4, CompressionQuality::Fast, output));
+
+    TestOutput::PrintTestPass("deterministic output");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("BlockCompression");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("BlockCompression Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Solid Blocks", TestSolidBlocks);
+        allPassed &= suite.RunTest("Alpha Encoding", TestAlphaEncoding);
+        allPassed &= suite.RunTest("Image Quality", TestImageQuality);
+        allPassed &= suite.RunTest("Deterministic Output", TestDeterministicOutput);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
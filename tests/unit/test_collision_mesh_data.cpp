@@ -0,0 +1,155 @@
+#include "TestUtils.h"
+#include "Physics/CollisionMeshData.h"
+#include "Graphics/Mesh.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    // Points on a sphere of the given radius, evenly spread
+    std::vector<Math::Vec3> CreateSpherePoints(uint32_t count, float radius) {
+        std::vector<Math::Vec3> points;
+        for (uint32_t i = 0; i < count; ++i) {
+            const float y = 1.0f - 2.0f * (i + 0.5f) / count;
+            const float r = std::sqrt(1.0f - y * y);
+            const float phi = 2.39996323f * i;
+            points.emplace_back(radius * r * std::cos(phi), radius * y, radius * r * std::sin(phi));
+        }
+        return points;
+    }
+}
+
+/**
+ * Test conversion from render meshes, indexed and unindexed
+ * Requirements: collision data is built from Mesh index/vertex data
+ */
+bool TestFromMesh() {
+    TestOutput::PrintTestStart("from mesh");
+
+    std::vector<Vertex> vertices(4);
+    vertices[0].position = Math::Vec3(0.0f, 0.0f, 0.0f);
+    vertices[1].position = Math::Vec3(1.0f, 0.0f, 0.0f);
+    vertices[2].position = Math::Vec3(1.0f, 0.0f, 1.0f);
+    vertices[3].position = Math::Vec3(0.0f, 0.0f, 1.0f);
+
+    Mesh mesh;
+    mesh.SetVertices(vertices);
+    mesh.SetIndices(std::vector<uint32_t>{ 0, 1, 2, 0, 2, 3 });
+
+    auto data = CollisionMeshData::FromMesh(mesh);
+    EXPECT_EQUAL(data->GetPositions().size(), static_cast<size_t>(4));
+    EXPECT_EQUAL(data->GetTriangleCount(), static_cast<size_t>(2));
+    EXPECT_NEAR_VEC3(data->GetPositions()[2], Math::Vec3(1.0f, 0.0f, 1.0f));
+    EXPECT_TRUE(data->IsValidTriangleMesh());
+
+    // Without indices every three vertices form a triangle; the leftover vertex is unused
+    Mesh unindexed;
+    unindexed.SetVertices(vertices);
+    auto sequential = CollisionMeshData::FromMesh(unindexed);
+    EXPECT_EQUAL(sequential->GetTriangleCount(), static_cast<size_t>(1));
+    EXPECT_EQUAL(sequential->GetIndices()[2], 2u);
+
+    TestOutput::PrintTestPass("from mesh");
+    return true;
+}
+
+/**
+ * Test content hashing and triangle list validation
+ * Requirements: shape cache keys depend on mesh content, not on the instance
+ */
+bool TestContentHash() {
+    TestOutput::PrintTestStart("content hash");
+
+    const std::vector<Math::Vec3> positions = { {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f} };
+    CollisionMeshData a(positions, { 0, 1, 2 });
+    CollisionMeshData b(positions, { 0, 1, 2 });
+    CollisionMeshData flipped(positions, { 0, 2, 1 });
+    CollisionMeshData points(positions);
+
+    EXPECT_EQUAL(a.GetContentHash(), b.GetContentHash());
+    EXPECT_NOT_EQUAL(a.GetContentHash(), flipped.GetContentHash());
+    EXPECT_NOT_EQUAL(a.GetContentHash(), points.GetContentHash());
+
+    std::vector<Math::Vec3> moved = positions;
+    moved[1].x = 1.0001f;
+    EXPECT_NOT_EQUAL(a.GetContentHash(), CollisionMeshData(moved, { 0, 1, 2 }).GetContentHash());
+
+    EXPECT_TRUE(a.IsValidTriangleMesh());
+    EXPECT_FALSE(points.IsValidTriangleMesh());
+    EXPECT_FALSE(CollisionMeshData(positions, { 0, 1 }).IsValidTriangleMesh());
+    EXPECT_FALSE(CollisionMeshData(positions, { 0, 1, 3 }).IsValidTriangleMesh());
+
+    TestOutput::PrintTestPass("content hash");
+    return true;
+}
+
+/**
+ * Test convex hull simplification against a vertex budget
+ * Requirements: simplified hulls keep original vertices and the shape's extent
+ */
+bool TestHullSimplification() {
+    TestOutput::PrintTestStart("hull simplification");
+
+    const std::vector<Math::Vec3> sphere = CreateSpherePoints(2000, 3.0f);
+    CollisionMeshData data(sphere);
+
+    for (uint32_t budget : { 8u, 32u, 64u }) {
+        const std::vector<Math::Vec3> hull = data.ComputeHullVertices(budget);
+        EXPECT_TRUE(hull.size() <= budget);
+        // Coarse budgets still use most of what they are given
+        EXPECT_TRUE(hull.size() >= budget / 2);
+
+        float extent[3] = { 0.0f, 0.0f, 0.0f };
+        for (const Math::Vec3& point : hull) {
+            EXPECT_TRUE(std::find(sphere.begin(), sphere.end(), point) != sphere.end());
+            for (int axis = 0; axis < 3; ++axis) {
+                extent[axis] = std::max(extent[axis], std::abs(point[axis]));
+            }
+        }
+        for (int axis = 0; axis < 3; ++axis) {
+            EXPECT_IN_RANGE(extent[axis], budget == 8u ? 2.0f : 2.6f, 3.0f);
+        }
+    }
+
+    // Point sets within the budget, or with no budget, are returned as they are
+    EXPECT_EQUAL(data.ComputeHullVertices(0).size(), sphere.size());
+    EXPECT_EQUAL(CollisionMeshData(CreateSpherePoints(20, 1.0f)).ComputeHullVertices(32).size(), static_cast<size_t>(20));
+
+    TestOutput::PrintTestPass("hull simplification");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("CollisionMeshData");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("CollisionMeshData Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("From Mesh", TestFromMesh);
+        allPassed &= suite.RunTest("Content Hash", TestContentHash);
+        allPassed &= suite.RunTest("Hull Simplification", TestHullSimplification);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -1,5 +1,6 @@
 #include "TestUtils.h"
 #include "Resource/AsyncModelLoader.h"
+#include "Core/JobSystem.h"
 #include "Core/Logger.h"
 #include <chrono>
 #include <thread>
@@ -10,7 +11,11 @@ using namespace GameEngine::Testing;
 bool TestPriorityLoading() {
     TestOutput::PrintTestStart("priority loading");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     EXPECT_TRUE(loader.Initialize());
 
     // Test priority configuration
@@ -18,6 +23,7 @@ bool TestPriorityLoading() {
     EXPECT_TRUE(static_cast<int>(loader.GetDefaultPriority()) == static_cast<int>(AsyncModelLoader::TaskPriority::High));
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("priority loading");
     return true;
@@ -26,7 +32,11 @@ bool TestPriorityLoading() {
 bool TestMemoryManagement() {
     TestOutput::PrintTestStart("memory management");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     EXPECT_TRUE(loader.Initialize());
 
     // Test memory limit configuration
@@ -38,6 +48,7 @@ bool TestMemoryManagement() {
     loader.FreeMemoryIfNeeded(); // Should not crash
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("memory management");
     return true;
@@ -46,7 +57,11 @@ bool TestMemoryManagement() {
 bool TestQueueManagement() {
     TestOutput::PrintTestStart("queue management");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     EXPECT_TRUE(loader.Initialize());
 
     // Test queue queries
@@ -60,6 +75,7 @@ bool TestQueueManagement() {
     loader.ProcessTaskQueue(); // Should not crash
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("queue management");
     return true;
@@ -68,7 +84,11 @@ bool TestQueueManagement() {
 bool TestConcurrentLoadingStats() {
     TestOutput::PrintTestStart("concurrent loading statistics");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     EXPECT_TRUE(loader.Initialize());
 
     // Test enhanced statistics
@@ -78,6 +98,7 @@ bool TestConcurrentLoadingStats() {
     EXPECT_EQUAL(stats.peakMemoryUsage, static_cast<size_t>(0));
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("concurrent loading statistics");
     return true;
@@ -86,7 +107,11 @@ bool TestConcurrentLoadingStats() {
 bool TestDependencyLoading() {
     TestOutput::PrintTestStart("dependency loading");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     EXPECT_TRUE(loader.Initialize());
 
     // Test loading with dependencies (will fail but test the interface)
@@ -104,6 +129,7 @@ bool TestDependencyLoading() {
     }
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("dependency loading");
     return true;
@@ -112,7 +138,11 @@ bool TestDependencyLoading() {
 bool TestBatchLoadingWithPriority() {
     TestOutput::PrintTestStart("batch loading with priority");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     EXPECT_TRUE(loader.Initialize());
 
     // Test batch loading with priority
@@ -131,6 +161,7 @@ bool TestBatchLoadingWithPriority() {
     }
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("batch loading with priority");
     return true;
@@ -139,7 +170,11 @@ bool TestBatchLoadingWithPriority() {
 bool TestResourceCleanup() {
     TestOutput::PrintTestStart("resource cleanup");
 
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
     AsyncModelLoader loader;
+    loader.SetJobSystem(&jobSystem);
     EXPECT_TRUE(loader.Initialize());
 
     // Test cleanup methods
@@ -147,6 +182,7 @@ bool TestResourceCleanup() {
     loader.FreeMemoryIfNeeded(); // Should not crash
 
     loader.Shutdown();
+    jobSystem.Shutdown();
 
     TestOutput::PrintTestPass("resource cleanup");
     return true;
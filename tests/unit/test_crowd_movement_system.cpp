@@ -0,0 +1,248 @@
+#include "TestUtils.h"
+#include "Game/CrowdMovementSystem.h"
+#include "Core/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    constexpr float FRAME_TIME = 1.0f / 60.0f;
+    constexpr float STANDING_HEIGHT = 0.9f; // Capsule centre for the default 1.8 m character on y = 0
+
+    void Simulate(CrowdMovementSystem& crowd, float seconds) {
+        const int frames = static_cast<int>(std::lround(seconds / FRAME_TIME));
+        for (int frame = 0; frame < frames; ++frame) {
+            crowd.Update(FRAME_TIME);
+        }
+    }
+
+    // Agents start at varied heights and get varying inputs and jumps, with one removal halfway
+    std::vector<float> RunScriptedCrowd(SimdLevel level, size_t agentCount) {
+        CrowdMovementSystem crowd;
+        crowd.SetSimdLevel(level);
+        crowd.Initialize(nullptr);
+
+        for (size_t i = 0; i < agentCount; ++i) {
+            crowd.AddAgent(Math::Vec3(i * 0.5f, STANDING_HEIGHT + (i % 7) * 0.3f, 0.0f));
+        }
+
+        for (uint32_t frame = 0; frame < 300; ++frame) {
+            for (uint32_t id = 0; id < agentCount; ++id) {
+                if ((id + frame) % 97 == 0) {
+                    crowd.RequestJump(id);
+                }
+                if ((id * 31 + frame) % 50 == 0) {
+                    const float z = (id + frame) % 3 == 0 ? 0.0f : std::cos(id * 1.7f);
+                    crowd.SetAgentMoveInput(id, Math::Vec3(std::sin(id + frame * 0.1f), 0.0f, z));
+                }
+            }
+            if (frame == 150) {
+                crowd.RemoveAgent(static_cast<uint32_t>(agentCount / 2));
+            }
+            crowd.Update(FRAME_TIME + (frame % 3) * 0.001f);
+        }
+
+        std::vector<float> state;
+        for (CrowdMovementSystem::AgentId id : crowd.GetAgentIds()) {
+            const Math::Vec3 position = crowd.GetAgentPosition(id);
+            const Math::Vec3 velocity = crowd.GetAgentVelocity(id);
+            state.insert(state.end(), {position.x, position.y, position.z, velocity.x, velocity.y, velocity.z,
+                                       crowd.IsAgentGrounded(id) ? 1.0f : 0.0f});
+        }
+        return state;
+    }
+}
+
+/**
+ * Test that airborne agents fall under gravity and land on the ground plane
+ * Requirements: gravity and ground snapping matching DeterministicMovementComponent
+ */
+bool TestFallAndLand() {
+    TestOutput::PrintTestStart("agents fall and land");
+
+    CrowdMovementSystem crowd;
+    crowd.Initialize(nullptr);
+    const CrowdMovementSystem::AgentId agent = crowd.AddAgent(Math::Vec3(0.0f, 5.0f, 0.0f));
+
+    crowd.Update(FRAME_TIME);
+    EXPECT_FALSE(crowd.IsAgentGrounded(agent));
+    crowd.Update(FRAME_TIME);
+    EXPECT_TRUE(crowd.GetAgentVelocity(agent).y < 0.0f);
+
+    Simulate(crowd, 2.0f);
+    EXPECT_TRUE(crowd.IsAgentGrounded(agent));
+    EXPECT_NEARLY_EQUAL_EPSILON(crowd.GetAgentPosition(agent).y, STANDING_HEIGHT, 1e-5f);
+    EXPECT_NEARLY_EQUAL_EPSILON(crowd.GetAgentVelocity(agent).y, 0.0f, 1e-6f);
+
+    crowd.SetGroundLevel(2.0f);
+    Simulate(crowd, 0.1f);
+    EXPECT_NEARLY_EQUAL_EPSILON(crowd.GetAgentPosition(agent).y, 2.0f + STANDING_HEIGHT, 1e-5f);
+
+    TestOutput::PrintTestPass("agents fall and land");
+    return true;
+}
+
+/**
+ * Test walking up to the speed limit, facing, and braking to a stop
+ * Requirements: input acceleration, max walk speed and braking friction
+ */
+bool TestWalkAndBrake() {
+    TestOutput::PrintTestStart("agents walk and brake");
+
+    CrowdMovementSystem crowd;
+    crowd.Initialize(nullptr);
+    const CrowdMovementSystem::AgentId agent = crowd.AddAgent(Math::Vec3(0.0f, STANDING_HEIGHT, 0.0f));
+
+    crowd.SetAgentMoveInput(agent, Math::Vec3(2.0f, 0.0f, 0.0f)); // Clamped to unit length
+    Simulate(crowd, 2.0f);
+
+    const Math::Vec3 velocity = crowd.GetAgentVelocity(agent);
+    const float maxSpeed = crowd.GetMovementConfig().maxWalkSpeed;
+    EXPECT_TRUE(velocity.x > maxSpeed * 0.9f);
+    EXPECT_TRUE(velocity.x <= maxSpeed);
+    EXPECT_NEARLY_EQUAL_EPSILON(velocity.z, 0.0f, 1e-6f);
+    EXPECT_TRUE(crowd.GetAgentPosition(agent).x > 9.0f);
+    EXPECT_NEARLY_EQUAL_EPSILON(crowd.GetAgentRotation(agent), 90.0f, 1e-3f);
+
+    crowd.SetAgentMoveInput(agent, Math::Vec3(0.0f));
+    Simulate(crowd, 0.5f);
+    EXPECT_EQUAL(crowd.GetAgentVelocity(agent).x, 0.0f);
+    EXPECT_NEARLY_EQUAL_EPSILON(crowd.GetAgentRotation(agent), 90.0f, 1e-3f);
+    EXPECT_TRUE(crowd.IsAgentGrounded(agent));
+
+    TestOutput::PrintTestPass("agents walk and brake");
+    return true;
+}
+
+/**
+ * Test that a jump lifts a grounded agent and ends on landing
+ * Requirements: jump requests consumed once, jump velocity from MovementConfig
+ */
+bool TestJump() {
+    TestOutput::PrintTestStart("agents jump");
+
+    CrowdMovementSystem crowd;
+    crowd.Initialize(nullptr);
+    const CrowdMovementSystem::AgentId agent = crowd.AddAgent(Math::Vec3(0.0f, STANDING_HEIGHT, 0.0f));
+    crowd.Update(FRAME_TIME);
+    EXPECT_TRUE(crowd.IsAgentGrounded(agent));
+
+    crowd.RequestJump(agent);
+    crowd.Update(FRAME_TIME);
+    EXPECT_TRUE(crowd.IsAgentJumping(agent));
+    EXPECT_FALSE(crowd.IsAgentGrounded(agent));
+
+    // Peak of v^2 / 2g = 100 / 30 above the ground
+    float peak = 0.0f;
+    for (int frame = 0; frame < 120; ++frame) {
+        crowd.Update(FRAME_TIME);
+        peak = std::max(peak, crowd.GetAgentPosition(agent).y);
+    }
+    EXPECT_IN_RANGE(peak - STANDING_HEIGHT, 3.0f, 3.5f);
+    EXPECT_TRUE(crowd.IsAgentGrounded(agent));
+    EXPECT_FALSE(crowd.IsAgentJumping(agent));
+
+    // Jumping disabled in the shared config
+    CharacterMovementComponent::MovementConfig config = crowd.GetMovementConfig();
+    config.canJump = false;
+    crowd.SetMovementConfig(config);
+    crowd.RequestJump(agent);
+    crowd.Update(FRAME_TIME);
+    EXPECT_TRUE(crowd.IsAgentGrounded(agent));
+
+    TestOutput::PrintTestPass("agents jump");
+    return true;
+}
+
+/**
+ * Test that removing an agent leaves the others and their ids intact
+ * Requirements: stable agent ids over swap-removed SoA slots
+ */
+bool TestRemoveAgent() {
+    TestOutput::PrintTestStart("remove agent");
+
+    CrowdMovementSystem crowd;
+    crowd.Initialize(nullptr);
+    const CrowdMovementSystem::AgentId first = crowd.AddAgent(Math::Vec3(1.0f, STANDING_HEIGHT, 0.0f));
+    const CrowdMovementSystem::AgentId second = crowd.AddAgent(Math::Vec3(2.0f, STANDING_HEIGHT, 0.0f));
+    const CrowdMovementSystem::AgentId third = crowd.AddAgent(Math::Vec3(3.0f, STANDING_HEIGHT, 0.0f));
+    crowd.SetAgentMoveInput(third, Math::Vec3(0.0f, 0.0f, 1.0f));
+
+    EXPECT_TRUE(crowd.RemoveAgent(first));
+    EXPECT_FALSE(crowd.RemoveAgent(first));
+    EXPECT_FALSE(crowd.HasAgent(first));
+    EXPECT_EQUAL(crowd.GetAgentCount(), static_cast<size_t>(2));
+
+    crowd.Update(FRAME_TIME);
+    EXPECT_NEARLY_EQUAL_EPSILON(crowd.GetAgentPosition(second).x, 2.0f, 1e-6f);
+    EXPECT_NEARLY_EQUAL_EPSILON(crowd.GetAgentPosition(third).x, 3.0f, 1e-6f);
+    EXPECT_TRUE(crowd.GetAgentVelocity(third).z > 0.0f);
+    EXPECT_EQUAL(crowd.GetAgentVelocity(second).z, 0.0f);
+
+    const CrowdMovementSystem::AgentId fourth = crowd.AddAgent(Math::Vec3(4.0f, STANDING_HEIGHT, 0.0f));
+    EXPECT_NOT_EQUAL(fourth, first);
+    EXPECT_EQUAL(crowd.GetAgentCount(), static_cast<size_t>(3));
+
+    TestOutput::PrintTestPass("remove agent");
+    return true;
+}
+
+/**
+ * Test that every kernel level produces the same bits
+ * Requirements: SIMD batches deterministic across instruction sets and runs
+ */
+bool TestKernelLevelsAreBitIdentical() {
+    TestOutput::PrintTestStart("crowd kernel levels are bit identical");
+
+    const SimdLevel supported = DetectSupportedSimdLevel();
+    TestOutput::PrintInfo(std::string("Supported SIMD level: ") + GetSimdLevelName(supported));
+
+    for (size_t count : {1u, 7u, 8u, 13u, 203u}) {
+        const std::vector<float> reference = RunScriptedCrowd(SimdLevel::Scalar, count);
+        for (int level = 0; level <= static_cast<int>(supported); ++level) {
+            const std::vector<float> result = RunScriptedCrowd(static_cast<SimdLevel>(level), count);
+            EXPECT_EQUAL(result.size(), reference.size());
+            EXPECT_TRUE(std::memcmp(result.data(), reference.data(), reference.size() * sizeof(float)) == 0);
+        }
+    }
+
+    TestOutput::PrintTestPass("crowd kernel levels are bit identical");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("CrowdMovementSystem");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("CrowdMovementSystem Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Fall And Land", TestFallAndLand);
+        allPassed &= suite.RunTest("Walk And Brake", TestWalkAndBrake);
+        allPassed &= suite.RunTest("Jump", TestJump);
+        allPassed &= suite.RunTest("Remove Agent", TestRemoveAgent);
+        allPassed &= suite.RunTest("Kernel Levels Are Bit Identical", TestKernelLevelsAreBitIdentical);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
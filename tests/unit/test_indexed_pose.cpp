@@ -0,0 +1,207 @@
+#include "TestUtils.h"
+#include "Animation/IndexedPose.h"
+#include "Animation/Pose.h"
+#include "Animation/AnimationSkeleton.h"
+#include "Animation/SkeletalAnimation.h"
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+using namespace GameEngine::Animation;
+
+namespace {
+    // Root -> Spine -> Head, with Arm declared before its parent to exercise evaluation ordering
+    std::shared_ptr<AnimationSkeleton> CreateTestSkeleton() {
+        auto skeleton = std::make_shared<AnimationSkeleton>("IndexedPoseSkeleton");
+        skeleton->CreateBone("Root");
+        skeleton->CreateBone("Arm", glm::translate(Math::Mat4(1.0f), Math::Vec3(1.0f, 0.0f, 0.0f)));
+        skeleton->CreateBone("Spine", glm::translate(Math::Mat4(1.0f), Math::Vec3(0.0f, 1.0f, 0.0f)));
+        skeleton->CreateBone("Head", glm::translate(Math::Mat4(1.0f), Math::Vec3(0.0f, 0.5f, 0.0f)));
+        skeleton->SetBoneParent("Spine", "Root");
+        skeleton->SetBoneParent("Head", "Spine");
+        skeleton->SetBoneParent("Arm", "Spine");
+        return skeleton;
+    }
+}
+
+/**
+ * Test layout construction, lookups and parent-first evaluation order
+ * Requirements: dense skeleton-indexed pose layout
+ */
+bool TestPoseLayoutCreation() {
+    TestOutput::PrintTestStart("pose layout creation");
+
+    auto skeleton = CreateTestSkeleton();
+    auto layout = PoseLayout::Create(*skeleton);
+
+    EXPECT_EQUAL(layout->GetBoneCount(), skeleton->GetBoneCount());
+    EXPECT_EQUAL(layout->GetBoneIndex("Root"), 0);
+    EXPECT_EQUAL(layout->GetBoneIndex("Arm"), 1);
+    EXPECT_EQUAL(layout->GetBoneIndex("Missing"), -1);
+    EXPECT_EQUAL(layout->GetParentIndices()[layout->GetBoneIndex("Arm")], layout->GetBoneIndex("Spine"));
+    EXPECT_EQUAL(layout->GetParentIndices()[0], -1);
+
+    // Every bone must appear after its parent
+    const auto& order = layout->GetEvaluationOrder();
+    EXPECT_EQUAL(order.size(), layout->GetBoneCount());
+    std::vector<int> position(order.size(), -1);
+    for (size_t i = 0; i < order.size(); ++i) {
+        position[order[i]] = static_cast<int>(i);
+    }
+    for (size_t bone = 0; bone < order.size(); ++bone) {
+        int32_t parent = layout->GetParentIndices()[bone];
+        if (parent >= 0) {
+            EXPECT_TRUE(position[parent] < position[bone]);
+        }
+    }
+
+    TestOutput::PrintTestPass("pose layout creation");
+    return true;
+}
+
+/**
+ * Test that blending matches the name-keyed Pose implementation
+ * Requirements: blend and additive operations over SoA arrays
+ */
+bool TestIndexedPoseBlendMatchesPose() {
+    TestOutput::PrintTestStart("indexed pose blend matches pose");
+
+    auto skeleton = CreateTestSkeleton();
+    auto layout = PoseLayout::Create(*skeleton);
+
+    Pose poseA(skeleton);
+    Pose poseB(skeleton);
+    poseB.SetBoneTransform("Spine", BoneTransform(Math::Vec3(0.0f, 2.0f, 0.0f),
+        glm::angleAxis(Math::HALF_PI, Math::Vec3(0.0f, 0.0f, 1.0f)), Math::Vec3(2.0f)));
+
+    IndexedPose indexedA(layout);
+    IndexedPose indexedB(layout);
+    indexedA.FromPose(poseA);
+    indexedB.FromPose(poseB);
+
+    Pose blended = Pose::Blend(poseA, poseB, 0.25f);
+    IndexedPose indexedBlended;
+    IndexedPose::Blend(indexedA, indexedB, 0.25f, indexedBlended);
+
+    for (size_t i = 0; i < layout->GetBoneCount(); ++i) {
+        BoneTransform expected = blended.GetBoneTransform(layout->GetBoneName(i));
+        BoneTransform actual = indexedBlended.GetBoneTransform(i);
+        EXPECT_NEAR_VEC3(actual.position, expected.position);
+        EXPECT_NEAR_QUAT(actual.rotation, expected.rotation);
+        EXPECT_NEAR_VEC3(actual.scale, expected.scale);
+    }
+
+    Pose additive = Pose::BlendAdditive(poseA, poseB, 0.5f);
+    indexedA.BlendAdditiveWith(indexedB, 0.5f);
+
+    for (size_t i = 0; i < layout->GetBoneCount(); ++i) {
+        BoneTransform expected = additive.GetBoneTransform(layout->GetBoneName(i));
+        BoneTransform actual = indexedA.GetBoneTransform(i);
+        EXPECT_NEAR_VEC3(actual.position, expected.position);
+        EXPECT_NEAR_QUAT(actual.rotation, expected.rotation);
+        EXPECT_NEAR_VEC3(actual.scale, expected.scale);
+    }
+
+    TestOutput::PrintTestPass("indexed pose blend matches pose");
+    return true;
+}
+
+/**
+ * Test local-to-world evaluation and skinning matrices against the skeleton
+ * Requirements: linear hierarchy evaluation
+ */
+bool TestIndexedPoseLocalToWorld() {
+    TestOutput::PrintTestStart("indexed pose local to world");
+
+    auto skeleton = CreateTestSkeleton();
+    auto layout = PoseLayout::Create(*skeleton);
+
+    IndexedPose pose(layout);
+    std::vector<Math::Mat4> world;
+    pose.EvaluateLocalToWorld(world);
+
+    // Bind pose transforms are local, so Head sits at Root + Spine + Head offsets
+    Math::Vec3 headPosition(world[layout->GetBoneIndex("Head")][3]);
+    EXPECT_NEAR_VEC3(headPosition, Math::Vec3(0.0f, 1.5f, 0.0f));
+    Math::Vec3 armPosition(world[layout->GetBoneIndex("Arm")][3]);
+    EXPECT_NEAR_VEC3(armPosition, Math::Vec3(1.0f, 1.0f, 0.0f));
+
+    // Matches the skeleton's own matrix hierarchy
+    PoseEvaluator::ApplyPoseToSkeleton(Pose(skeleton), skeleton);
+    for (size_t i = 0; i < layout->GetBoneCount(); ++i) {
+        EXPECT_MATRIX_EQUAL(world[i], skeleton->GetAllBones()[i]->GetWorldTransform());
+    }
+
+    std::vector<Math::Mat4> skinning;
+    pose.GetSkinningMatrices(skinning);
+    EXPECT_EQUAL(skinning.size(), layout->GetBoneCount());
+
+    TestOutput::PrintTestPass("indexed pose local to world");
+    return true;
+}
+
+/**
+ * Test animation evaluation through a pre-resolved binding
+ * Requirements: PoseEvaluator sampling without bone name hashing
+ */
+bool TestIndexedPoseAnimationEvaluation() {
+    TestOutput::PrintTestStart("indexed pose animation evaluation");
+
+    auto skeleton = CreateTestSkeleton();
+    auto layout = PoseLayout::Create(*skeleton);
+
+    SkeletalAnimation animation("Bob");
+    animation.SetDuration(1.0f);
+    animation.AddPositionKeyframe("Spine", 0.0f, Math::Vec3(0.0f, 1.0f, 0.0f));
+    animation.AddPositionKeyframe("Spine", 1.0f, Math::Vec3(0.0f, 2.0f, 0.0f));
+    animation.AddRotationKeyframe("Head", 0.0f, Math::Quat(1.0f, 0.0f, 0.0f, 0.0f));
+    animation.AddRotationKeyframe("Head", 1.0f, glm::angleAxis(Math::HALF_PI, Math::Vec3(0.0f, 1.0f, 0.0f)));
+    animation.AddPositionKeyframe("NotInSkeleton", 0.0f, Math::Vec3(5.0f));
+
+    AnimationBinding binding = AnimationBinding::Create(animation, *layout);
+    EXPECT_EQUAL(binding.entries.size(), static_cast<size_t>(2));
+
+    IndexedPose indexed(layout);
+    PoseEvaluator::EvaluateAnimation(animation, binding, 0.5f, indexed);
+    Pose reference = PoseEvaluator::EvaluateAnimation(animation, 0.5f, skeleton);
+
+    for (size_t i = 0; i < layout->GetBoneCount(); ++i) {
+        BoneTransform expected = reference.GetBoneTransform(layout->GetBoneName(i));
+        BoneTransform actual = indexed.GetBoneTransform(i);
+        EXPECT_NEAR_VEC3(actual.position, expected.position);
+        EXPECT_NEAR_QUAT(actual.rotation, expected.rotation);
+        EXPECT_NEAR_VEC3(actual.scale, expected.scale);
+    }
+
+    TestOutput::PrintTestPass("indexed pose animation evaluation");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("IndexedPose");
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("IndexedPose Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("PoseLayout Creation", TestPoseLayoutCreation);
+        allPassed &= suite.RunTest("IndexedPose Blend Matches Pose", TestIndexedPoseBlendMatchesPose);
+        allPassed &= suite.RunTest("IndexedPose Local To World", TestIndexedPoseLocalToWorld);
+        allPassed &= suite.RunTest("IndexedPose Animation Evaluation", TestIndexedPoseAnimationEvaluation);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
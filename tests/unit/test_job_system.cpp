@@ -0,0 +1,189 @@
+#include "TestUtils.h"
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+/**
+ * Test that graph jobs start only after their dependencies
+ * Requirements: job graphs with dependencies, reusable every frame
+ */
+bool TestJobGraphDependencies() {
+    TestOutput::PrintTestStart("job graph dependencies");
+
+    JobSystem jobSystem;
+    JobSystemConfig config;
+    config.workerCount = 3;
+    EXPECT_TRUE(jobSystem.Initialize(config));
+
+    // Animation -> (Physics, Audio) -> Render-prep, like a frame
+    std::atomic<int> sequence{0};
+    int animation = -1;
+    int physics = -1;
+    int audio = -1;
+    int renderPrep = -1;
+
+    JobGraph graph;
+    JobGraph::JobId animationJob = graph.AddJob("Animation", [&]() { animation = sequence++; });
+    JobGraph::JobId physicsJob = graph.AddJob("Physics", [&]() { physics = sequence++; });
+    JobGraph::JobId audioJob = graph.AddJob("Audio", [&]() { audio = sequence++; });
+    JobGraph::JobId renderPrepJob = graph.AddJob("RenderPrep", [&]() { renderPrep = sequence++; });
+    EXPECT_TRUE(graph.AddDependency(physicsJob, animationJob));
+    EXPECT_TRUE(graph.AddDependency(audioJob, animationJob));
+    EXPECT_TRUE(graph.AddDependency(renderPrepJob, physicsJob));
+    EXPECT_TRUE(graph.AddDependency(renderPrepJob, audioJob));
+    EXPECT_TRUE(graph.IsAcyclic());
+    EXPECT_EQUAL(graph.FindJob("Audio"), audioJob);
+
+    for (int frame = 0; frame < 50; ++frame) {
+        sequence = 0;
+        EXPECT_TRUE(jobSystem.RunAndWait(graph));
+        EXPECT_EQUAL(animation, 0);
+        EXPECT_TRUE(physics > animation && audio > animation);
+        EXPECT_EQUAL(renderPrep, 3);
+    }
+
+    // A cycle is rejected instead of deadlocking
+    JobGraph cyclic;
+    JobGraph::JobId first = cyclic.AddJob("First", []() {});
+    JobGraph::JobId second = cyclic.AddJob("Second", []() {});
+    cyclic.AddDependency(first, second);
+    cyclic.AddDependency(second, first);
+    EXPECT_FALSE(cyclic.IsAcyclic());
+    Logger::GetInstance().SetLogLevel(LogLevel::Critical);
+    EXPECT_FALSE(jobSystem.RunAndWait(cyclic));
+    Logger::GetInstance().SetLogLevel(LogLevel::Info);
+
+    jobSystem.Shutdown();
+
+    TestOutput::PrintTestPass("job graph dependencies");
+    return true;
+}
+
+/**
+ * Test parallel-for coverage and wait-for-group points
+ * Requirements: parallel-for and per-frame group waits
+ */
+bool TestParallelForAndGroups() {
+    TestOutput::PrintTestStart("parallel-for and groups");
+
+    JobSystem jobSystem;
+    JobSystemConfig config;
+    config.workerCount = 3;
+    EXPECT_TRUE(jobSystem.Initialize(config));
+
+    std::vector<std::atomic<int>> visits(10000);
+    for (auto& visit : visits) {
+        visit = 0;
+    }
+    jobSystem.ParallelFor(visits.size(), 0, [&visits](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            visits[i]++;
+        }
+    });
+    bool allVisitedOnce = true;
+    for (const auto& visit : visits) {
+        allVisitedOnce &= visit.load() == 1;
+    }
+    EXPECT_TRUE(allVisitedOnce);
+
+    // Jobs that fork their own children and join on them
+    JobGroup group;
+    std::atomic<int> executed{0};
+    for (int i = 0; i < 64; ++i) {
+        jobSystem.Submit([&jobSystem, &executed]() {
+            JobGroup children;
+            for (int child = 0; child < 4; ++child) {
+                jobSystem.Submit([&executed]() { executed++; }, children);
+            }
+            jobSystem.Wait(children);
+            executed++;
+        }, group);
+    }
+    jobSystem.Wait(group);
+    EXPECT_TRUE(group.IsDone());
+    EXPECT_EQUAL(executed.load(), 320);
+
+    jobSystem.Shutdown();
+
+    TestOutput::PrintTestPass("parallel-for and groups");
+    return true;
+}
+
+/**
+ * Test that background work does not hold up frame work
+ * Requirements: priority lanes for frame-critical vs. background jobs
+ */
+bool TestBackgroundLane() {
+    TestOutput::PrintTestStart("background lane");
+
+    JobSystem jobSystem;
+    JobSystemConfig config;
+    config.workerCount = 2;
+    config.maxBackgroundWorkers = 1;
+    EXPECT_TRUE(jobSystem.Initialize(config));
+
+    // Long background jobs, e.g. asset loads
+    JobGroup background;
+    std::atomic<int> loaded{0};
+    for (int i = 0; i < 4; ++i) {
+        jobSystem.Submit([&loaded]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            loaded++;
+        }, background, JobPriority::Background);
+    }
+
+    // Frame work still completes while the loads are in flight
+    std::atomic<int> frameWork{0};
+    TestTimer timer;
+    jobSystem.ParallelFor(256, 8, [&frameWork](size_t begin, size_t end) {
+        frameWork += static_cast<int>(end - begin);
+    });
+    double frameTime = timer.ElapsedMs();
+
+    EXPECT_EQUAL(frameWork.load(), 256);
+    EXPECT_TRUE(loaded.load() < 4);
+    TestOutput::PrintTiming("frame work during background loads", frameTime, 1);
+
+    jobSystem.Wait(background);
+    EXPECT_EQUAL(loaded.load(), 4);
+
+    jobSystem.Shutdown();
+
+    TestOutput::PrintTestPass("background lane");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("JobSystem");
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("JobSystem Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Job Graph Dependencies", TestJobGraphDependencies);
+        allPassed &= suite.RunTest("Parallel-For And Groups", TestParallelForAndGroups);
+        allPassed &= suite.RunTest("Background Lane", TestBackgroundLane);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -0,0 +1,157 @@
+#include "TestUtils.h"
+#include "Animation/Keyframe.h"
+#include "Animation/IndexedPose.h"
+#include "Animation/Pose.h"
+#include "Animation/SkeletalAnimation.h"
+#include "Animation/AnimationSkeleton.h"
+#include "Core/Logger.h"
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+using namespace GameEngine::Animation;
+
+namespace {
+    PositionTrack CreateTrack(int keyCount) {
+        PositionTrack track("Bone", "position");
+        for (int i = 0; i < keyCount; ++i) {
+            float time = i * 0.1f;
+            track.AddKeyframe(time, Math::Vec3(std::sin(time), std::cos(time), time));
+        }
+        return track;
+    }
+}
+
+/**
+ * Test that forward playback through a cursor matches stateless sampling
+ * Requirements: amortized O(1) forward sampling with identical results
+ */
+bool TestCursorForwardPlayback() {
+    TestOutput::PrintTestStart("cursor forward playback");
+
+    PositionTrack track = CreateTrack(50);
+    KeyframeCursor cursor;
+
+    // Small steps stay on the probe path, large steps exercise the binary search fallback
+    for (float step : {0.016f, 0.35f}) {
+        cursor.Reset();
+        for (float time = 0.0f; time <= track.GetEndTime() + 0.1f; time += step) {
+            EXPECT_NEAR_VEC3(track.SampleAt(time, cursor), track.SampleAt(time));
+        }
+    }
+
+    TestOutput::PrintTestPass("cursor forward playback");
+    return true;
+}
+
+/**
+ * Test seeks backwards and loop wraps through a cursor
+ * Requirements: binary search fallback when time moves backwards
+ */
+bool TestCursorSeekAndLoop() {
+    TestOutput::PrintTestStart("cursor seek and loop");
+
+    PositionTrack track = CreateTrack(50);
+    KeyframeCursor cursor;
+
+    const float times[] = {4.5f, 0.05f, 2.33f, 2.31f, 4.89f, 0.0f, 0.11f, 3.0f, 1.0f};
+    for (float time : times) {
+        EXPECT_NEAR_VEC3(track.SampleAt(time, cursor), track.SampleAt(time));
+    }
+
+    // A stale cursor from a longer track must not index out of range
+    PositionTrack shortTrack = CreateTrack(3);
+    cursor.index = 40;
+    EXPECT_NEAR_VEC3(shortTrack.SampleAt(0.15f, cursor), shortTrack.SampleAt(0.15f));
+    EXPECT_TRUE(cursor.index < shortTrack.GetKeyframeCount());
+
+    TestOutput::PrintTestPass("cursor seek and loop");
+    return true;
+}
+
+/**
+ * Test several threads sampling one shared clip with their own cursors
+ * Requirements: shared SkeletalAnimation is only read during playback
+ */
+bool TestSharedClipAcrossThreads() {
+    TestOutput::PrintTestStart("shared clip across threads");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    auto skeleton = std::make_shared<AnimationSkeleton>("CursorSkeleton");
+    auto animation = std::make_shared<SkeletalAnimation>("CursorClip");
+    animation->SetDuration(2.0f);
+    for (int bone = 0; bone < 8; ++bone) {
+        const std::string boneName = "Bone_" + std::to_string(bone);
+        skeleton->CreateBone(boneName);
+        for (int key = 0; key <= 60; ++key) {
+            float time = key / 30.0f;
+            animation->AddPositionKeyframe(boneName, time, Math::Vec3(time, static_cast<float>(bone), 0.0f));
+            animation->AddRotationKeyframe(boneName, time, glm::angleAxis(time, Math::Vec3(0.0f, 1.0f, 0.0f)));
+        }
+    }
+
+    auto layout = PoseLayout::Create(*skeleton);
+    const AnimationBinding binding = AnimationBinding::Create(*animation, *layout);
+
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            AnimationCursor cursor;
+            IndexedPose cursorPose(layout);
+            IndexedPose referencePose(layout);
+            for (int frame = 0; frame < 500; ++frame) {
+                float time = (frame + t * 7) * (1.0f / 60.0f); // Wraps past the clip end several times
+                PoseEvaluator::EvaluateAnimation(*animation, binding, time, cursor, cursorPose);
+                PoseEvaluator::EvaluateAnimation(*animation, binding, time, referencePose);
+                for (size_t i = 0; i < layout->GetBoneCount(); ++i) {
+                    if (glm::length(cursorPose.GetTranslations()[i] - referencePose.GetTranslations()[i]) > 1e-5f ||
+                        std::abs(glm::dot(cursorPose.GetRotations()[i], referencePose.GetRotations()[i])) < 0.99999f) {
+                        mismatches.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQUAL(mismatches.load(), 0);
+
+    TestOutput::PrintTestPass("shared clip across threads");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("KeyframeCursor");
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("KeyframeCursor Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Cursor Forward Playback", TestCursorForwardPlayback);
+        allPassed &= suite.RunTest("Cursor Seek And Loop", TestCursorSeekAndLoop);
+        allPassed &= suite.RunTest("Shared Clip Across Threads", TestSharedClipAcrossThreads);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -0,0 +1,227 @@
+#include "TestUtils.h"
+#include "Resource/LRUResourceCache.h"
+#include "Core/Logger.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    // Minimal cached type; the cache only needs GetMemoryUsage()
+    struct SizedResource {
+        explicit SizedResource(size_t size) : bytes(size) {}
+        size_t GetMemoryUsage() const { return bytes; }
+        size_t bytes;
+    };
+
+    std::shared_ptr<SizedResource> MakeResource(size_t size) {
+        return std::make_shared<SizedResource>(size);
+    }
+}
+
+/**
+ * Test that the running memory total follows put, replace, resize, remove and eviction
+ * Requirements: O(1) memory accounting for LRU cache trimming
+ */
+bool TestMemoryAccounting() {
+    TestOutput::PrintTestStart("memory accounting");
+
+    LRUResourceCache<SizedResource> cache(100, 1000);
+    cache.Put("a", MakeResource(100));
+    cache.Put("b", MakeResource(200));
+    cache.Put("c", MakeResource(300));
+    EXPECT_EQUAL(cache.GetMemoryUsage(), static_cast<size_t>(600));
+
+    // Replacing an entry swaps its size in the total
+    cache.Put("b", MakeResource(50));
+    EXPECT_EQUAL(cache.GetMemoryUsage(), static_cast<size_t>(450));
+
+    // A resource that grows in place is re-measured on request
+    auto growing = cache.Get("a");
+    growing->bytes = 400;
+    cache.UpdateMemoryUsage("a");
+    EXPECT_EQUAL(cache.GetMemoryUsage(), static_cast<size_t>(750));
+
+    cache.Remove("c");
+    EXPECT_EQUAL(cache.GetMemoryUsage(), static_cast<size_t>(450));
+
+    // Going over the memory limit evicts from the cold end ("b" is older than "a" after the Get)
+    cache.Put("d", MakeResource(600));
+    EXPECT_FALSE(cache.Contains("b"));
+    EXPECT_TRUE(cache.Contains("a"));
+    EXPECT_EQUAL(cache.GetMemoryUsage(), static_cast<size_t>(1000));
+    EXPECT_EQUAL(cache.GetEvictionCount(), static_cast<size_t>(1));
+
+    cache.Clear();
+    EXPECT_EQUAL(cache.GetMemoryUsage(), static_cast<size_t>(0));
+    EXPECT_EQUAL(cache.GetSize(), static_cast<size_t>(0));
+
+    TestOutput::PrintTestPass("memory accounting");
+    return true;
+}
+
+/**
+ * Test trimming a large cache by memory while keeping pinned entries
+ * Requirements: EvictByMemory stops at the target and never evicts pinned resources
+ */
+bool TestEvictByMemory() {
+    TestOutput::PrintTestStart("evict by memory");
+
+    LRUResourceCache<SizedResource> cache(100000, 1ull << 40);
+    for (int i = 0; i < 10000; ++i) {
+        cache.Put("res_" + std::to_string(i), MakeResource(10));
+    }
+    cache.Pin("res_0");
+    EXPECT_EQUAL(cache.GetMemoryUsage(), static_cast<size_t>(100000));
+
+    cache.EvictByMemory(25000);
+    EXPECT_EQUAL(cache.GetMemoryUsage(), static_cast<size_t>(25000));
+    EXPECT_EQUAL(cache.GetSize(), static_cast<size_t>(2500));
+    EXPECT_TRUE(cache.Contains("res_0"));
+    EXPECT_TRUE(cache.Contains("res_9999"));
+    EXPECT_FALSE(cache.Contains("res_1"));
+
+    // Only the pinned entry survives a trim to zero, and the trim still terminates
+    cache.EvictByMemory(0);
+    EXPECT_EQUAL(cache.GetSize(), static_cast<size_t>(1));
+    EXPECT_EQUAL(cache.GetMemoryUsage(), static_cast<size_t>(10));
+
+    // An all-pinned cache over its limits does not spin on insert
+    LRUResourceCache<SizedResource> pinned(1, 1000);
+    pinned.Put("x", MakeResource(10));
+    pinned.Pin("x");
+    pinned.Put("y", MakeResource(10));
+    EXPECT_TRUE(pinned.Contains("x"));
+
+    TestOutput::PrintTestPass("evict by memory");
+    return true;
+}
+
+/**
+ * Test the clock policy gives recently hit entries a second chance
+ * Requirements: CLOCK eviction without reordering on hits
+ */
+bool TestClockPolicy() {
+    TestOutput::PrintTestStart("clock policy");
+
+    LRUResourceCache<SizedResource> cache(3, 1000, CacheEvictionPolicy::Clock);
+    EXPECT_TRUE(cache.GetEvictionPolicy() == CacheEvictionPolicy::Clock);
+    cache.Put("a", MakeResource(1));
+    cache.Put("b", MakeResource(1));
+    cache.Put("c", MakeResource(1));
+
+    // Hits do not reorder the list
+    EXPECT_NOT_NULL(cache.Get("a"));
+    std::vector<std::string> keys = cache.GetKeys();
+    EXPECT_STRING_EQUAL(keys.front(), std::string("c"));
+    EXPECT_STRING_EQUAL(keys.back(), std::string("a"));
+
+    // "a" was referenced, so the hand passes it and takes "b"
+    cache.Put("d", MakeResource(1));
+    EXPECT_TRUE(cache.Contains("a"));
+    EXPECT_FALSE(cache.Contains("b"));
+    EXPECT_TRUE(cache.Contains("c"));
+    EXPECT_TRUE(cache.Contains("d"));
+
+    // The hand carries on from where it stopped rather than restarting at the oldest entry
+    cache.Put("e", MakeResource(1));
+    EXPECT_TRUE(cache.Contains("a"));
+    EXPECT_FALSE(cache.Contains("c"));
+    EXPECT_EQUAL(cache.GetSize(), static_cast<size_t>(3));
+    EXPECT_EQUAL(cache.GetMemoryUsage(), static_cast<size_t>(3));
+
+    TestOutput::PrintTestPass("clock policy");
+    return true;
+}
+
+/**
+ * Test the sharded cache under concurrent readers and writers
+ * Requirements: N-way sharded locking with totals summed over shards
+ */
+bool TestShardedCache() {
+    TestOutput::PrintTestStart("sharded cache");
+
+    ShardedLRUResourceCache<SizedResource> cache(1000, 1ull << 30, 6);
+    EXPECT_EQUAL(cache.GetShardCount(), static_cast<size_t>(8));
+
+    // Small budgets get fewer shards rather than a handful of entries each
+    EXPECT_EQUAL(ShardedLRUResourceCache<SizedResource>(100).GetShardCount(), static_cast<size_t>(2));
+    EXPECT_EQUAL(ShardedLRUResourceCache<SizedResource>(10).GetShardCount(), static_cast<size_t>(1));
+    EXPECT_EQUAL(ShardedLRUResourceCache<SizedResource>(100000).GetShardCount(), static_cast<size_t>(16));
+
+    for (int i = 0; i < 200; ++i) {
+        cache.Put("mesh_" + std::to_string(i), MakeResource(64));
+    }
+    EXPECT_EQUAL(cache.GetSize(), static_cast<size_t>(200));
+    EXPECT_EQUAL(cache.GetMemoryUsage(), static_cast<size_t>(200 * 64));
+    EXPECT_NOT_NULL(cache.Get("mesh_7"));
+    EXPECT_NULL(cache.Get("missing"));
+    EXPECT_NEARLY_EQUAL(cache.GetHitRatio(), 0.5f);
+
+    cache.Pin("mesh_7");
+    cache.EvictByMemory(0);
+    EXPECT_TRUE(cache.Contains("mesh_7"));
+    EXPECT_EQUAL(cache.GetSize(), static_cast<size_t>(1));
+
+    // Many threads mixing lookups and inserts; the size limit holds per shard
+    cache.Clear();
+    cache.SetMaxSize(256);
+    std::atomic<int> found{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&cache, &found, t]() {
+            for (int i = 0; i < 2000; ++i) {
+                const std::string key = "key_" + std::to_string((i * 7 + t) % 512);
+                if (cache.Get(key)) {
+                    found++;
+                } else {
+                    cache.Put(key, MakeResource(16));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_TRUE(found.load() > 0);
+    EXPECT_TRUE(cache.GetSize() <= static_cast<size_t>(256));
+    EXPECT_EQUAL(cache.GetMemoryUsage(), cache.GetSize() * 16);
+
+    TestOutput::PrintTestPass("sharded cache");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("LRUResourceCache");
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("LRUResourceCache Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Memory Accounting", TestMemoryAccounting);
+        allPassed &= suite.RunTest("Evict By Memory", TestEvictByMemory);
+        allPassed &= suite.RunTest("Clock Policy", TestClockPolicy);
+        allPassed &= suite.RunTest("Sharded Cache", TestShardedCache);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -3,6 +3,8 @@
 #include "Core/Logger.h"
 #include "../TestUtils.h"
 #include <cmath>
+#include <cstdio>
+#include <fstream>
 
 using namespace GameEngine;
 using namespace GameEngine::Testing;
@@ -72,6 +74,140 @@ bool TestMeshLoaderOBJWithMaterials() {
     }
 }
 
+bool TestMeshLoaderOBJFaceFormats() {
+    TestOutput::PrintTestStart("OBJ face formats");
+    
+    const std::string path = "test_obj_face_formats.obj";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "# comment line\n"
+             << "v 0 0 0\n"
+             << "v 1 0 0\r\n"
+             << "v 1 1 0\n"
+             << "v +0 1.0e0 0\n"
+             << "vt 0 0\n"
+             << "vt 1 0\n"
+             << "vt 1 0.25\n"
+             << "vn 0 0 1\n"
+             << "\n"
+             << "\tf 1//1 2//1 3//1\r\n"
+             << "f 1/1 3/3 4/2\n"
+             << "f 1 2 oops\n"
+             << "f 1 2 9\n"
+             << "s off\n"
+             << "f 1 2 3 4\n";
+    }
+    
+    Logger::GetInstance().SetLogLevel(LogLevel::Error);
+    MeshLoader::MeshData data = MeshLoader::LoadOBJ(path);
+    Logger::GetInstance().SetLogLevel(LogLevel::Info);
+    std::remove(path.c_str());
+    
+    // Triangle, triangle, quad; the malformed face and the out-of-range face are skipped
+    EXPECT_TRUE(data.isValid);
+    EXPECT_EQUAL(data.vertices.size(), 12);
+    EXPECT_EQUAL(data.indices.size(), 12);
+    
+    // v//vn reads the third component as the normal
+    EXPECT_NEARLY_EQUAL_EPSILON(data.vertices[0].normal.z, 1.0f, 0.001f);
+    EXPECT_NEARLY_EQUAL_EPSILON(data.vertices[0].normal.y, 0.0f, 0.001f);
+    
+    // v/vt picks the texture coordinate with V flipped, and the default normal
+    EXPECT_NEARLY_EQUAL_EPSILON(data.vertices[4].texCoords.x, 1.0f, 0.001f);
+    EXPECT_NEARLY_EQUAL_EPSILON(data.vertices[4].texCoords.y, 0.75f, 0.001f);
+    EXPECT_NEARLY_EQUAL_EPSILON(data.vertices[4].normal.y, 1.0f, 0.001f);
+    
+    // Quads are fan triangulated: (1 2 3) (1 3 4)
+    EXPECT_NEARLY_EQUAL_EPSILON(data.vertices[10].position.x, 1.0f, 0.001f);
+    EXPECT_NEARLY_EQUAL_EPSILON(data.vertices[11].position.y, 1.0f, 0.001f);
+    EXPECT_NEARLY_EQUAL_EPSILON(data.vertices[11].position.x, 0.0f, 0.001f);
+    
+    TestOutput::PrintTestPass("OBJ face formats");
+    return true;
+}
+
+bool TestMeshLoaderOBJChunkedGroups() {
+    TestOutput::PrintTestStart("OBJ chunked group and material order");
+    
+    // Large enough to be split into several chunks, with group and material changes
+    // spread across the chunk boundaries
+    constexpr int gridSize = 200;
+    constexpr int groupCount = 7;
+    const std::string path = "test_obj_chunked_groups.obj";
+    
+    struct ExpectedMesh {
+        std::string group;
+        std::string material;
+        size_t triangles = 0;
+    };
+    std::vector<ExpectedMesh> expected;
+    
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "o chunked\n";
+        for (int z = 0; z <= gridSize; ++z) {
+            for (int x = 0; x <= gridSize; ++x) {
+                file << "v " << x << ".25 " << (x + z) % 5 << ".5 -" << z << ".125\n";
+            }
+        }
+        file << "vn 0 1 0\n";
+        
+        const int rowsPerGroup = (gridSize + groupCount - 1) / groupCount;
+        for (int z = 0; z < gridSize; ++z) {
+            const int group = z / rowsPerGroup;
+            if (z % rowsPerGroup == 0) {
+                file << "g part_" << group << "\n";
+                file << "g part_" << group << "\n"; // Same group again does not split
+            }
+            for (int x = 0; x < gridSize; ++x) {
+                // Each row switches material halfway; the first half repeats the previous row's end
+                const std::string material = (x < gridSize / 2) ? "mat_a" : "mat_b";
+                if (x == 0 || x == gridSize / 2) {
+                    file << "usemtl " << material << "\n";
+                }
+                if (expected.empty() || expected.back().group != "part_" + std::to_string(group) ||
+                    expected.back().material != material) {
+                    expected.push_back({"part_" + std::to_string(group), material, 0});
+                }
+                expected.back().triangles += 2;
+                
+                const int i0 = z * (gridSize + 1) + x + 1;
+                const int i1 = i0 + 1;
+                const int i2 = i0 + gridSize + 1;
+                const int i3 = i2 + 1;
+                file << "f " << i0 << "//1 " << i2 << "//1 " << i3 << "//1 " << i1 << "//1\n";
+            }
+        }
+    }
+    
+    Logger::GetInstance().SetLogLevel(LogLevel::Error);
+    MeshLoader::OBJLoadResult result = MeshLoader::LoadOBJWithMaterials(path);
+    Logger::GetInstance().SetLogLevel(LogLevel::Info);
+    std::remove(path.c_str());
+    
+    EXPECT_TRUE(result.success);
+    EXPECT_EQUAL(result.meshes.size(), expected.size());
+    EXPECT_EQUAL(result.totalTriangles, static_cast<uint32_t>(gridSize * gridSize * 2));
+    
+    for (size_t i = 0; i < result.meshes.size() && i < expected.size(); ++i) {
+        const auto& mesh = result.meshes[i];
+        EXPECT_EQUAL(mesh.objectName, std::string("chunked"));
+        EXPECT_EQUAL(mesh.groupName, expected[i].group);
+        EXPECT_EQUAL(mesh.materialName, expected[i].material);
+        EXPECT_EQUAL(mesh.indices.size(), expected[i].triangles * 3);
+    }
+    
+    // The last triangle of the file lands at the end of the last mesh
+    const auto& last = result.meshes.back();
+    const Math::Vec3& corner = last.vertices[last.vertices.size() - 3].position;
+    EXPECT_NEARLY_EQUAL_EPSILON(corner.x, (gridSize - 1) + 0.25f, 0.001f);
+    EXPECT_NEARLY_EQUAL_EPSILON(corner.z, -((gridSize - 1) + 0.125f), 0.001f);
+    
+    TestOutput::PrintTestPass("OBJ chunked group and material order - " + 
+                             std::to_string(result.meshes.size()) + " meshes");
+    return true;
+}
+
 bool TestMeshLoaderOBJValidation() {
     TestOutput::PrintTestStart("OBJ mesh validation and optimization");
     
@@ -407,6 +543,8 @@ int main() {
         allPassed &= suite.RunTest("OBJ Loading", TestMeshLoaderOBJ);
         allPassed &= suite.RunTest("OBJ Loading with Materials", TestMeshLoaderOBJWithMaterials);
         allPassed &= suite.RunTest("OBJ Transformations", TestMeshLoaderOBJTransformations);
+        allPassed &= suite.RunTest("OBJ Face Formats", TestMeshLoaderOBJFaceFormats);
+        allPassed &= suite.RunTest("OBJ Chunked Group Order", TestMeshLoaderOBJChunkedGroups);
         // Temporarily disable validation test to check if it's causing issues
         // allPassed &= suite.RunTest("OBJ Validation and Optimization", TestMeshLoaderOBJValidation);
         allPassed &= suite.RunTest("Default Cube Creation", TestMeshLoaderCreateDefault);
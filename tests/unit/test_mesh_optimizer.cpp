@@ -5,6 +5,9 @@
 #include <iostream>
 #include <vector>
 #include <memory>
+#include <algorithm>
+#include <array>
+#include <random>
 
 using namespace GameEngine;
 using namespace GameEngine::Testing;
@@ -31,6 +34,49 @@ std::shared_ptr<Mesh> CreateTestMesh() {
     return mesh;
 }
 
+// Flat size x size quad grid in the XY plane with UVs following the position. With a seam,
+// the right half is offset in UV space and the middle column is split into two wedges.
+void CreateGrid(int size, bool seam, std::vector<Vertex>& vertices, std::vector<uint32_t>& indices) {
+    const int seamColumn = seam ? size / 2 : -1;
+    std::vector<uint32_t> left((size + 1) * (size + 1)), right((size + 1) * (size + 1));
+    for (int y = 0; y <= size; ++y) {
+        for (int x = 0; x <= size; ++x) {
+            Vertex vertex = {};
+            vertex.position = Math::Vec3(static_cast<float>(x), static_cast<float>(y), 0.0f);
+            vertex.normal = Math::Vec3(0.0f, 0.0f, 1.0f);
+            vertex.texCoords = Math::Vec2(static_cast<float>(x) / size, static_cast<float>(y) / size);
+            if (seamColumn >= 0 && x > seamColumn) {
+                vertex.texCoords.x += 0.5f;
+            }
+            left[y * (size + 1) + x] = right[y * (size + 1) + x] = static_cast<uint32_t>(vertices.size());
+            vertices.push_back(vertex);
+            if (x == seamColumn) {
+                vertex.texCoords.x += 0.5f;
+                right[y * (size + 1) + x] = static_cast<uint32_t>(vertices.size());
+                vertices.push_back(vertex);
+            }
+        }
+    }
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            const int i0 = y * (size + 1) + x;
+            const int i1 = i0 + 1, i2 = i0 + size + 1, i3 = i2 + 1;
+            // Quads right of the seam use the second wedge
+            const std::vector<uint32_t>& column = x >= seamColumn && seamColumn >= 0 ? right : left;
+            indices.insert(indices.end(), {column[i0], column[i1], column[i3], column[i0], column[i3], column[i2]});
+        }
+    }
+}
+
+std::vector<std::array<uint32_t, 3>> SortedTriangles(const std::vector<uint32_t>& indices) {
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+        triangles.push_back({indices[i], indices[i + 1], indices[i + 2]});
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
 /**
  * Test mesh analysis functionality
  * Requirements: Mesh optimization and analysis
@@ -144,6 +190,188 @@ bool TestMeshSimplification() {
     return true;
 }
 
+/**
+ * Test linear-time vertex cache optimization on a shuffled grid
+ * Requirements: Mesh optimization for GPU performance
+ */
+bool TestVertexCacheReordering() {
+    TestOutput::PrintTestStart("vertex cache reordering");
+    
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    CreateGrid(48, false, vertices, indices);
+    
+    // Shuffle the triangle order so the cache starts out cold
+    std::vector<std::array<uint32_t, 3>> triangles = SortedTriangles(indices);
+    std::shuffle(triangles.begin(), triangles.end(), std::mt19937(42));
+    std::vector<uint32_t> shuffled;
+    for (const auto& triangle : triangles) {
+        shuffled.insert(shuffled.end(), triangle.begin(), triangle.end());
+    }
+    
+    auto optimized = MeshOptimizer::OptimizeIndices(shuffled, vertices.size());
+    
+    // Same triangles with the same winding, in a cache-friendly order
+    EXPECT_TRUE(SortedTriangles(optimized) == SortedTriangles(shuffled));
+    const float shuffledACMR = MeshOptimizer::CalculateACMR(shuffled, 32);
+    const float optimizedACMR = MeshOptimizer::CalculateACMR(optimized, 32);
+    EXPECT_TRUE(shuffledACMR > 2.0f);
+    EXPECT_TRUE(optimizedACMR < 0.8f);
+    EXPECT_TRUE(MeshOptimizer::CalculateATVR(optimized, vertices.size()) < 1.5f);
+    
+    // Overdraw clustering keeps every triangle and most of the cache efficiency
+    auto overdraw = MeshOptimizer::OptimizeOverdrawIndices(optimized, vertices, 1.05f);
+    EXPECT_TRUE(SortedTriangles(overdraw) == SortedTriangles(shuffled));
+    EXPECT_TRUE(MeshOptimizer::CalculateACMR(overdraw, 32) < optimizedACMR * 1.25f);
+    
+    TestOutput::PrintTestPass("vertex cache reordering");
+    return true;
+}
+
+/**
+ * Test quadric simplification with border and seam locking
+ * Requirements: Mesh LOD generation and simplification
+ */
+bool TestQuadricSimplification() {
+    TestOutput::PrintTestStart("quadric simplification");
+    
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    CreateGrid(16, true, vertices, indices);
+    
+    SimplificationOptions options;
+    options.targetTriangles = 128;
+    float error = 1.0f;
+    auto simplified = MeshOptimizer::SimplifyIndices(vertices, indices, options, &error);
+    
+    EXPECT_TRUE(simplified.size() / 3 <= 128);
+    EXPECT_TRUE(simplified.size() / 3 > 0);
+    // UVs vary linearly over the plane, so the attribute-aware error stays zero
+    EXPECT_TRUE(error < 0.001f);
+    
+    std::vector<bool> used(vertices.size(), false);
+    for (uint32_t index : simplified) {
+        used[index] = true;
+    }
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        const Math::Vec3& position = vertices[i].position;
+        const bool border = position.x == 0.0f || position.y == 0.0f || position.x == 16.0f || position.y == 16.0f;
+        const bool seam = position.x == 8.0f;
+        if (border || seam) {
+            EXPECT_TRUE(used[i]);
+        }
+    }
+    
+    // No triangle flipped
+    for (size_t i = 0; i < simplified.size(); i += 3) {
+        const Math::Vec3 normal = glm::cross(vertices[simplified[i + 1]].position - vertices[simplified[i]].position,
+                                             vertices[simplified[i + 2]].position - vertices[simplified[i]].position);
+        EXPECT_TRUE(normal.z > 0.0f);
+    }
+    
+    // Unlocked borders slide along themselves and allow a smaller result
+    options.preserveBoundaries = false;
+    options.targetTriangles = 0;
+    auto unlocked = MeshOptimizer::SimplifyIndices(vertices, indices, options);
+    EXPECT_TRUE(unlocked.size() < simplified.size());
+    
+    // The mesh path compacts vertices
+    Mesh mesh;
+    mesh.SetVertices(vertices);
+    mesh.SetIndices(indices);
+    auto lod = MeshOptimizer::SimplifyToTriangleCount(mesh, 128);
+    EXPECT_NOT_NULL(lod);
+    EXPECT_TRUE(lod->GetTriangleCount() <= 128);
+    EXPECT_TRUE(lod->GetVertexCount() < vertices.size());
+    EXPECT_TRUE(MeshOptimizer::ValidateMesh(*lod));
+    
+    auto chain = MeshOptimizer::GenerateLODChain(mesh, {0.5f, 0.25f});
+    EXPECT_EQUAL(chain.size(), static_cast<size_t>(3));
+    EXPECT_TRUE(chain[1]->GetTriangleCount() <= 256);
+    EXPECT_TRUE(chain[2]->GetTriangleCount() <= 128);
+    
+    TestOutput::PrintTestPass("quadric simplification");
+    return true;
+}
+
+/**
+ * Test meshlet building and per-meshlet culling
+ * Requirements: meshlets with vertex/triangle limits, bounding spheres, normal cones;
+ * frustum and backface cone culling into a compacted index list
+ */
+bool TestMeshletCulling() {
+    TestOutput::PrintTestStart("meshlet culling");
+    
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    CreateGrid(32, false, vertices, indices);
+    indices = MeshOptimizer::OptimizeIndices(indices, vertices.size());
+    
+    const MeshletData data = MeshOptimizer::BuildMeshlets(vertices, indices, 64, 124);
+    EXPECT_FALSE(data.IsEmpty());
+    // Grid patches fill most of a meshlet's vertex budget
+    EXPECT_TRUE(data.meshlets.size() < 50);
+    
+    std::vector<uint32_t> meshletIndices;
+    for (const auto& meshlet : data.meshlets) {
+        EXPECT_TRUE(meshlet.vertexCount <= 64);
+        EXPECT_TRUE(meshlet.triangleCount > 0 && meshlet.triangleCount <= 124);
+        for (uint32_t i = 0; i < meshlet.vertexCount; ++i) {
+            const Math::Vec3& position = vertices[data.vertices[meshlet.vertexOffset + i]].position;
+            EXPECT_TRUE(glm::length(position - meshlet.bounds.center) <= meshlet.bounds.radius + 0.0001f);
+        }
+        for (uint32_t i = 0; i < meshlet.triangleCount * 3; ++i) {
+            meshletIndices.push_back(data.vertices[meshlet.vertexOffset + data.triangles[meshlet.triangleOffset + i]]);
+        }
+        // A flat grid facing +Z gives a tight cone
+        EXPECT_NEAR_VEC3_EPSILON(meshlet.coneAxis, Math::Vec3(0.0f, 0.0f, 1.0f), 0.0001f);
+        EXPECT_TRUE(meshlet.coneCutoff < 0.01f);
+    }
+    EXPECT_TRUE(SortedTriangles(meshletIndices) == SortedTriangles(indices));
+    
+    // Orthographic view of x, y in [0, 16]
+    Math::Mat4 projection(Math::Vec4(0.125f, 0.0f, 0.0f, 0.0f), Math::Vec4(0.0f, 0.125f, 0.0f, 0.0f),
+                          Math::Vec4(0.0f, 0.0f, 0.1f, 0.0f), Math::Vec4(-1.0f, -1.0f, 0.0f, 1.0f));
+    const Frustum frustum = Frustum::FromMatrix(projection);
+    
+    std::vector<uint32_t> visible;
+    const size_t visibleCount = MeshOptimizer::CullMeshlets(data, frustum, Math::Vec3(8.0f, 8.0f, 5.0f), visible);
+    EXPECT_TRUE(visibleCount > 0 && visibleCount < data.meshlets.size());
+    EXPECT_TRUE(visible.size() < indices.size());
+    
+    // Every triangle inside the view survives
+    const auto visibleTriangles = SortedTriangles(visible);
+    for (const auto& triangle : SortedTriangles(indices)) {
+        bool inside = true;
+        for (uint32_t index : triangle) {
+            inside = inside && vertices[index].position.x <= 16.0f && vertices[index].position.y <= 16.0f;
+        }
+        if (inside) {
+            EXPECT_TRUE(std::binary_search(visibleTriangles.begin(), visibleTriangles.end(), triangle));
+        }
+    }
+    
+    // From below, every meshlet faces away
+    EXPECT_EQUAL(MeshOptimizer::CullMeshlets(data, frustum, Math::Vec3(8.0f, 8.0f, -5.0f), visible), static_cast<size_t>(0));
+    EXPECT_TRUE(visible.empty());
+    EXPECT_EQUAL(MeshOptimizer::CullMeshlets(data, frustum, Math::Vec3(8.0f, 8.0f, -5.0f), visible, false), visibleCount);
+    
+    // Meshlets are stored on the mesh and dropped when its indices change
+    Mesh mesh;
+    mesh.SetVertices(vertices);
+    mesh.SetIndices(indices);
+    const size_t memoryBefore = mesh.GetMemoryUsage();
+    MeshOptimizer::BuildMeshlets(mesh);
+    EXPECT_TRUE(mesh.HasMeshlets());
+    EXPECT_EQUAL(mesh.GetMeshlets().meshlets.size(), data.meshlets.size());
+    EXPECT_TRUE(mesh.GetMemoryUsage() > memoryBefore);
+    mesh.SetIndices(indices);
+    EXPECT_FALSE(mesh.HasMeshlets());
+    
+    TestOutput::PrintTestPass("meshlet culling");
+    return true;
+}
+
 /**
  * Test duplicate vertex removal
  * Requirements: Mesh optimization and vertex deduplication
@@ -188,7 +416,10 @@ int main() {
         allPassed &= suite.RunTest("Mesh Analysis", TestMeshAnalysis);
         allPassed &= suite.RunTest("Mesh Validation", TestMeshValidation);
         allPassed &= suite.RunTest("Vertex Cache Optimization", TestVertexCacheOptimization);
+        allPassed &= suite.RunTest("Vertex Cache Reordering", TestVertexCacheReordering);
         allPassed &= suite.RunTest("Mesh Simplification", TestMeshSimplification);
+        allPassed &= suite.RunTest("Quadric Simplification", TestQuadricSimplification);
+        allPassed &= suite.RunTest("Meshlet Culling", TestMeshletCulling);
         allPassed &= suite.RunTest("Duplicate Vertex Removal", TestDuplicateVertexRemoval);
 
         // Print detailed summary
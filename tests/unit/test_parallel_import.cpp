@@ -0,0 +1,153 @@
+#include "TestUtils.h"
+#include "Resource/ParallelImport.h"
+#include "Core/JobSystem.h"
+#include "Core/Logger.h"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    // Uneven work per index, like a scene with a few large meshes among many small ones
+    uint64_t ConvertSlot(size_t index) {
+        uint64_t value = index;
+        const size_t rounds = (index % 7 == 0) ? 20000 : 200;
+        for (size_t i = 0; i < rounds; ++i) {
+            value = value * 6364136223846793005ull + 1442695040888963407ull;
+        }
+        return value;
+    }
+
+    std::vector<uint64_t> ConvertAll(size_t count, JobSystem* jobSystem, size_t maxThreads) {
+        std::vector<uint64_t> slots(count, 0);
+        ParallelImportFor(count, [&](size_t i) { slots[i] = ConvertSlot(i); }, jobSystem, maxThreads);
+        return slots;
+    }
+}
+
+/**
+ * Test that every index runs exactly once on both the thread and JobSystem paths
+ * Requirements: parallel per-mesh import covers every mesh once
+ */
+bool TestEveryIndexRunsOnce() {
+    TestOutput::PrintTestStart("every index runs once");
+
+    constexpr size_t count = 257;
+
+    std::vector<std::atomic<int>> visits(count);
+    ParallelImportFor(count, [&](size_t i) { visits[i]++; }, nullptr, 4);
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQUAL(visits[i].load(), 1);
+    }
+
+    JobSystem jobSystem;
+    JobSystemConfig config;
+    config.workerCount = 3;
+    EXPECT_TRUE(jobSystem.Initialize(config));
+
+    std::vector<std::atomic<int>> jobVisits(count);
+    ParallelImportFor(count, [&](size_t i) { jobVisits[i]++; }, &jobSystem);
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQUAL(jobVisits[i].load(), 1);
+    }
+    jobSystem.Shutdown();
+
+    // Empty and single-item ranges run inline
+    bool ranEmpty = false;
+    ParallelImportFor(0, [&](size_t) { ranEmpty = true; });
+    EXPECT_FALSE(ranEmpty);
+
+    std::thread::id runner;
+    ParallelImportFor(1, [&](size_t) { runner = std::this_thread::get_id(); });
+    EXPECT_TRUE(runner == std::this_thread::get_id());
+
+    TestOutput::PrintTestPass("every index runs once");
+    return true;
+}
+
+/**
+ * Test that slot output is identical for serial, threaded and JobSystem runs
+ * Requirements: deterministic assembly of parallel import results
+ */
+bool TestDeterministicSlots() {
+    TestOutput::PrintTestStart("deterministic slots");
+
+    constexpr size_t count = 96;
+    const auto serial = ConvertAll(count, nullptr, 1);
+
+    for (int run = 0; run < 5; ++run) {
+        EXPECT_TRUE(ConvertAll(count, nullptr, 4) == serial);
+    }
+
+    JobSystem jobSystem;
+    JobSystemConfig config;
+    config.workerCount = 3;
+    EXPECT_TRUE(jobSystem.Initialize(config));
+    for (int run = 0; run < 5; ++run) {
+        EXPECT_TRUE(ConvertAll(count, &jobSystem, 0) == serial);
+    }
+    jobSystem.Shutdown();
+
+    TestOutput::PrintTestPass("deterministic slots");
+    return true;
+}
+
+/**
+ * Test that a throwing body does not stop the other indices and is rethrown to the caller
+ * Requirements: importer errors surface on the importing thread
+ */
+bool TestExceptionPropagation() {
+    TestOutput::PrintTestStart("exception propagation");
+
+    constexpr size_t count = 64;
+    std::atomic<int> completed{0};
+    bool caught = false;
+    try {
+        ParallelImportFor(count, [&](size_t i) {
+            if (i == 10) {
+                throw std::runtime_error("bad mesh");
+            }
+            completed++;
+        }, nullptr, 4);
+    } catch (const std::runtime_error& e) {
+        caught = std::string(e.what()) == "bad mesh";
+    }
+
+    EXPECT_TRUE(caught);
+    EXPECT_EQUAL(completed.load(), static_cast<int>(count - 1));
+
+    TestOutput::PrintTestPass("exception propagation");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("ParallelImport");
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("ParallelImport Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Every Index Runs Once", TestEveryIndexRunsOnce);
+        allPassed &= suite.RunTest("Deterministic Slots", TestDeterministicSlots);
+        allPassed &= suite.RunTest("Exception Propagation", TestExceptionPropagation);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -0,0 +1,143 @@
+#include "TestUtils.h"
+#include "Animation/PoseBlendKernels.h"
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+using namespace GameEngine::Animation;
+
+namespace {
+    struct KernelInputs {
+        std::vector<Math::Vec3> vectorsA;
+        std::vector<Math::Vec3> vectorsB;
+        std::vector<Math::Quat> rotationsA;
+        std::vector<Math::Quat> rotationsB;
+    };
+
+    KernelInputs CreateInputs(size_t count, unsigned seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+        KernelInputs inputs;
+        for (size_t i = 0; i < count; ++i) {
+            inputs.vectorsA.emplace_back(dist(rng), dist(rng), dist(rng));
+            inputs.vectorsB.emplace_back(dist(rng), dist(rng), dist(rng));
+            inputs.rotationsA.push_back(glm::normalize(Math::Quat(dist(rng), dist(rng), dist(rng), dist(rng))));
+            inputs.rotationsB.push_back(glm::normalize(Math::Quat(dist(rng), dist(rng), dist(rng), dist(rng))));
+        }
+        return inputs;
+    }
+}
+
+/**
+ * Test kernels against glm reference math
+ * Requirements: vector lerp, hemisphere-corrected nlerp and additive blend
+ */
+bool TestKernelsMatchReference() {
+    TestOutput::PrintTestStart("pose blend kernels match reference");
+
+    const size_t count = 37; // Exercises the SIMD body and the scalar tail
+    KernelInputs inputs = CreateInputs(count, 7u);
+    const float t = 0.35f;
+
+    std::vector<Math::Vec3> lerped(count);
+    std::vector<Math::Quat> nlerped(count);
+    std::vector<Math::Quat> additive(count);
+    PoseBlendKernels::LerpVectors(inputs.vectorsA.data(), inputs.vectorsB.data(), lerped.data(), count, t);
+    PoseBlendKernels::NlerpRotations(inputs.rotationsA.data(), inputs.rotationsB.data(), nlerped.data(), count, t);
+    PoseBlendKernels::AddRotations(inputs.rotationsA.data(), inputs.rotationsB.data(), additive.data(), count, t);
+
+    const Math::Quat identity(1.0f, 0.0f, 0.0f, 0.0f);
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_NEAR_VEC3(lerped[i], glm::mix(inputs.vectorsA[i], inputs.vectorsB[i], t));
+
+        Math::Quat target = inputs.rotationsB[i];
+        if (glm::dot(inputs.rotationsA[i], target) < 0.0f) {
+            target = -target;
+        }
+        Math::Quat expected = glm::normalize(inputs.rotationsA[i] * (1.0f - t) + target * t);
+        EXPECT_NEAR_QUAT(nlerped[i], expected);
+        EXPECT_NEARLY_EQUAL(glm::length(nlerped[i]), 1.0f);
+
+        Math::Quat additiveTarget = inputs.rotationsB[i].w < 0.0f ? -inputs.rotationsB[i] : inputs.rotationsB[i];
+        Math::Quat weighted = glm::normalize(identity * (1.0f - t) + additiveTarget * t);
+        EXPECT_NEAR_QUAT(additive[i], inputs.rotationsA[i] * weighted);
+    }
+
+    TestOutput::PrintTestPass("pose blend kernels match reference");
+    return true;
+}
+
+/**
+ * Test that every supported instruction set produces bit-identical results
+ * Requirements: runtime dispatch with scalar fallback
+ */
+bool TestKernelLevelsAreBitIdentical() {
+    TestOutput::PrintTestStart("pose blend kernel levels are bit identical");
+
+    const SimdLevel originalLevel = PoseBlendKernels::GetActiveLevel();
+    const SimdLevel supported = PoseBlendKernels::DetectSupportedLevel();
+    TestOutput::PrintInfo(std::string("Supported SIMD level: ") + PoseBlendKernels::GetLevelName(supported));
+
+    for (size_t count : {1u, 4u, 7u, 8u, 9u, 130u}) {
+        KernelInputs inputs = CreateInputs(count, static_cast<unsigned>(count));
+
+        std::vector<std::vector<Math::Quat>> rotationResults;
+        std::vector<std::vector<Math::Vec3>> vectorResults;
+
+        for (int level = 0; level <= static_cast<int>(supported); ++level) {
+            EXPECT_EQUAL(static_cast<int>(PoseBlendKernels::SetActiveLevel(static_cast<SimdLevel>(level))), level);
+
+            std::vector<Math::Quat> rotations(count);
+            std::vector<Math::Vec3> vectors = inputs.vectorsA;
+            PoseBlendKernels::NlerpRotations(inputs.rotationsA.data(), inputs.rotationsB.data(), rotations.data(), count, 0.6f);
+            PoseBlendKernels::AddRotations(rotations.data(), inputs.rotationsB.data(), rotations.data(), count, 0.25f);
+            PoseBlendKernels::LerpVectors(vectors.data(), inputs.vectorsB.data(), vectors.data(), count, 0.6f);
+            PoseBlendKernels::AddVectors(vectors.data(), inputs.vectorsB.data(), vectors.data(), count, 0.5f);
+            PoseBlendKernels::AddScales(vectors.data(), inputs.vectorsB.data(), vectors.data(), count, 0.5f);
+
+            rotationResults.push_back(std::move(rotations));
+            vectorResults.push_back(std::move(vectors));
+        }
+
+        for (size_t level = 1; level < rotationResults.size(); ++level) {
+            EXPECT_TRUE(std::memcmp(rotationResults[0].data(), rotationResults[level].data(), count * sizeof(Math::Quat)) == 0);
+            EXPECT_TRUE(std::memcmp(vectorResults[0].data(), vectorResults[level].data(), count * sizeof(Math::Vec3)) == 0);
+        }
+    }
+
+    PoseBlendKernels::SetActiveLevel(originalLevel);
+
+    TestOutput::PrintTestPass("pose blend kernel levels are bit identical");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("PoseBlendKernels");
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("PoseBlendKernels Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Kernels Match Reference", TestKernelsMatchReference);
+        allPassed &= suite.RunTest("Kernel Levels Are Bit Identical", TestKernelLevelsAreBitIdentical);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -0,0 +1,237 @@
+#include "TestUtils.h"
+#include "Core/Profiler.h"
+#include "Core/Logger.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    const ProfileThreadTimeline* FindThread(const ProfileCapture& capture, const std::string& name) {
+        for (const auto& thread : capture.threads) {
+            if (thread.threadName == name) {
+                return &thread;
+            }
+        }
+        return nullptr;
+    }
+
+    const ProfileTimelineZone* FindZone(const ProfileThreadTimeline& thread, const std::string& name) {
+        for (const auto& zone : thread.zones) {
+            if (name == zone.name) {
+                return &zone;
+            }
+        }
+        return nullptr;
+    }
+
+    void BusyWait(std::chrono::microseconds duration) {
+        const auto end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end) {
+        }
+    }
+}
+
+/**
+ * Test that nested zones form a per-thread call tree
+ * Requirements: scoped zones with static IDs, nested per-thread timelines
+ */
+bool TestNestedZones() {
+    TestOutput::PrintTestStart("nested zones");
+
+    Profiler& profiler = Profiler::GetInstance();
+    profiler.Clear();
+    profiler.SetEnabled(true);
+    profiler.SetThreadName("Test Main");
+
+    {
+        GAMEENGINE_PROFILE_ZONE("Frame");
+        {
+            GAMEENGINE_PROFILE_ZONE_CATEGORY("Animation", "Animation");
+            BusyWait(std::chrono::microseconds(20));
+            {
+                GAMEENGINE_PROFILE_ZONE("Skinning");
+                BusyWait(std::chrono::microseconds(20));
+            }
+        }
+        {
+            GAMEENGINE_PROFILE_ZONE("Physics");
+            BusyWait(std::chrono::microseconds(20));
+        }
+    }
+
+    // Zones opened while disabled are never recorded
+    profiler.SetEnabled(false);
+    {
+        GAMEENGINE_PROFILE_ZONE("Disabled");
+    }
+    profiler.SetEnabled(true);
+
+    ProfileCapture capture = profiler.Capture();
+    const ProfileThreadTimeline* thread = FindThread(capture, "Test Main");
+    EXPECT_NOT_NULL(thread);
+    EXPECT_EQUAL(thread->zones.size(), static_cast<size_t>(4));
+
+    const ProfileTimelineZone* frame = FindZone(*thread, "Frame");
+    const ProfileTimelineZone* animation = FindZone(*thread, "Animation");
+    const ProfileTimelineZone* skinning = FindZone(*thread, "Skinning");
+    const ProfileTimelineZone* physics = FindZone(*thread, "Physics");
+    EXPECT_NOT_NULL(frame);
+    EXPECT_NOT_NULL(animation);
+    EXPECT_NOT_NULL(skinning);
+    EXPECT_NOT_NULL(physics);
+    EXPECT_NULL(FindZone(*thread, "Disabled"));
+
+    EXPECT_EQUAL(frame->depth, 0u);
+    EXPECT_EQUAL(animation->depth, 1u);
+    EXPECT_EQUAL(skinning->depth, 2u);
+    EXPECT_EQUAL(physics->depth, 1u);
+    EXPECT_STRING_EQUAL(animation->category, "Animation");
+    EXPECT_TRUE(frame->durationNs >= animation->durationNs + physics->durationNs);
+    EXPECT_TRUE(physics->startNs >= animation->startNs + animation->durationNs);
+
+    // Parents come before their children
+    EXPECT_STRING_EQUAL(thread->zones.front().name, "Frame");
+
+    profiler.SetEnabled(false);
+    profiler.Clear();
+
+    TestOutput::PrintTestPass("nested zones");
+    return true;
+}
+
+/**
+ * Test that every thread gets its own timeline and Clear resets them
+ * Requirements: thread-local event buffers, counters and frame markers
+ */
+bool TestThreadTimelines() {
+    TestOutput::PrintTestStart("thread timelines");
+
+    Profiler& profiler = Profiler::GetInstance();
+    profiler.Clear();
+    profiler.SetEnabled(true);
+
+    const int threadCount = 4;
+    const int zonesPerThread = 5000;    // Spans more than one event chunk
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([t]() {
+            Profiler::GetInstance().SetThreadName("Test Worker " + std::to_string(t));
+            for (int i = 0; i < zonesPerThread; ++i) {
+                GAMEENGINE_PROFILE_ZONE("WorkItem");
+            }
+            GAMEENGINE_PROFILE_COUNTER("Items", zonesPerThread);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    GAMEENGINE_PROFILE_FRAME();
+    GAMEENGINE_PROFILE_FRAME();
+
+    ProfileCapture capture = profiler.Capture();
+    for (int t = 0; t < threadCount; ++t) {
+        const ProfileThreadTimeline* thread = FindThread(capture, "Test Worker " + std::to_string(t));
+        EXPECT_NOT_NULL(thread);
+        EXPECT_EQUAL(thread->zones.size(), static_cast<size_t>(zonesPerThread));
+        EXPECT_EQUAL(thread->counters.size(), static_cast<size_t>(1));
+        EXPECT_NEARLY_EQUAL(static_cast<float>(thread->counters[0].value), static_cast<float>(zonesPerThread));
+    }
+    EXPECT_EQUAL(capture.frameStartsNs.size(), static_cast<size_t>(2));
+    EXPECT_EQUAL(capture.droppedEvents, static_cast<size_t>(0));
+
+    // Cleared events are gone, including those of threads that have exited
+    profiler.Clear();
+    capture = profiler.Capture();
+    EXPECT_TRUE(capture.threads.empty());
+    EXPECT_TRUE(capture.frameStartsNs.empty());
+
+    profiler.SetEnabled(false);
+
+    TestOutput::PrintTestPass("thread timelines");
+    return true;
+}
+
+/**
+ * Test Chrome trace_event export
+ * Requirements: Chrome trace JSON viewable in Perfetto
+ */
+bool TestChromeTraceExport() {
+    TestOutput::PrintTestStart("Chrome trace export");
+
+    Profiler& profiler = Profiler::GetInstance();
+    profiler.Clear();
+    profiler.SetEnabled(true);
+    profiler.SetThreadName("Trace \"Main\"");
+
+    GAMEENGINE_PROFILE_FRAME();
+    {
+        GAMEENGINE_PROFILE_ZONE("Update");
+        GAMEENGINE_PROFILE_COUNTER("Visible Meshes", 42);
+    }
+    {
+        GAMEENGINE_PROFILE_ZONE_CATEGORY(profiler.InternName("shader_" + std::to_string(7)), "Shader");
+    }
+
+    const std::string traceFile = "profiler_test_trace.json";
+    EXPECT_TRUE(profiler.ExportChromeTrace(traceFile));
+
+    std::ifstream file(traceFile);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    const std::string json = contents.str();
+    file.close();
+    std::remove(traceFile.c_str());
+
+    EXPECT_TRUE(json.find("\"traceEvents\":[") != std::string::npos);
+    EXPECT_TRUE(json.find("\"name\":\"Update\",\"cat\":\"Engine\",\"ph\":\"X\"") != std::string::npos);
+    EXPECT_TRUE(json.find("\"name\":\"shader_7\",\"cat\":\"Shader\"") != std::string::npos);
+    EXPECT_TRUE(json.find("\"name\":\"Visible Meshes\",\"ph\":\"C\"") != std::string::npos);
+    EXPECT_TRUE(json.find("\"args\":{\"value\":42}") != std::string::npos);
+    EXPECT_TRUE(json.find("\"ph\":\"i\",\"s\":\"g\"") != std::string::npos);
+    EXPECT_TRUE(json.find("\"args\":{\"name\":\"Trace \\\"Main\\\"\"}") != std::string::npos);
+    EXPECT_TRUE(json.rfind("]}") != std::string::npos);
+
+    profiler.SetEnabled(false);
+    profiler.Clear();
+
+    TestOutput::PrintTestPass("Chrome trace export");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("Profiler");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("Profiler Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Nested Zones", TestNestedZones);
+        allPassed &= suite.RunTest("Thread Timelines", TestThreadTimelines);
+        allPassed &= suite.RunTest("Chrome Trace Export", TestChromeTraceExport);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}
@@ -1,4 +1,5 @@
 #include "Resource/ResourceManager.h"
+#include "Core/JobSystem.h"
 #include "Graphics/Texture.h"
 #include "Graphics/Mesh.h"
 #include "Audio/AudioEngine.h"
@@ -8,6 +9,7 @@
 #include <filesystem>
 #include <thread>
 #include <chrono>
+#include <atomic>
 
 using namespace GameEngine;
 using namespace GameEngine::Testing;
@@ -74,6 +76,22 @@ bool CreateTestMeshFile(const std::string& filename) {
     return true;
 }
 
+// Resource whose load takes a while and counts how often it actually runs
+class SlowTestResource : public Resource {
+public:
+    static std::atomic<int> s_loadCount;
+
+    explicit SlowTestResource(const std::string& path) : Resource(path) {}
+
+    bool LoadFromFile(const std::string&) override {
+        ++s_loadCount;
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        return true;
+    }
+};
+
+std::atomic<int> SlowTestResource::s_loadCount{0};
+
 // Helper function to create a simple test audio file (WAV)
 bool CreateTestAudioFile(const std::string& filename, float durationSeconds = 0.1f) {
     std::ofstream file(filename, std::ios::binary);
@@ -612,6 +630,86 @@ bool TestResourceThreadSafety() {
     return true;
 }
 
+/**
+ * Test that concurrent requests for one path share a single load and
+ * that different paths load in parallel
+ * Requirements: lock held only for lookup and insert, per-key in-flight deduplication
+ */
+bool TestConcurrentLoadDeduplication() {
+    TestOutput::PrintTestStart("Concurrent load deduplication");
+
+    ResourceManager manager;
+    manager.Initialize();
+    SlowTestResource::s_loadCount = 0;
+
+    // Eight threads, two paths: each path loads exactly once
+    std::vector<std::thread> threads;
+    std::vector<std::shared_ptr<SlowTestResource>> results(8);
+    TestTimer timer;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&manager, &results, i]() {
+            results[i] = manager.Load<SlowTestResource>(i % 2 == 0 ? "slow_a.bin" : "slow_b.bin");
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double elapsed = timer.ElapsedMs();
+
+    EXPECT_EQUAL(SlowTestResource::s_loadCount.load(), 2);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_NOT_NULL(results[i]);
+        EXPECT_TRUE(results[i].get() == results[i % 2].get());
+    }
+    EXPECT_TRUE(results[0].get() != results[1].get());
+    EXPECT_EQUAL(manager.GetInFlightLoadCount(), static_cast<size_t>(0));
+
+    // Both 30ms loads overlapped instead of running one after the other
+    EXPECT_TRUE(elapsed < 55.0);
+
+    manager.Shutdown();
+
+    TestOutput::PrintTestPass("Concurrent load deduplication");
+    return true;
+}
+
+/**
+ * Test LoadAsync futures and their interaction with Load
+ * Requirements: LoadAsync returns the shared in-flight future
+ */
+bool TestLoadAsync() {
+    TestOutput::PrintTestStart("Load async");
+
+    JobSystem jobSystem;
+    jobSystem.Initialize();
+
+    ResourceManager manager;
+    manager.SetJobSystem(&jobSystem);
+    manager.Initialize();
+    SlowTestResource::s_loadCount = 0;
+
+    auto first = manager.LoadAsync<SlowTestResource>("async_asset.bin");
+    auto second = manager.LoadAsync<SlowTestResource>("async_asset.bin");
+    auto blocking = manager.Load<SlowTestResource>("async_asset.bin");
+
+    EXPECT_NOT_NULL(first.get());
+    EXPECT_TRUE(first.get() == second.get());
+    EXPECT_TRUE(first.get() == blocking);
+    EXPECT_EQUAL(SlowTestResource::s_loadCount.load(), 1);
+
+    // Already loaded: the future is ready immediately
+    auto cached = manager.LoadAsync<SlowTestResource>("async_asset.bin");
+    EXPECT_TRUE(cached.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    EXPECT_TRUE(cached.get() == blocking);
+    EXPECT_EQUAL(SlowTestResource::s_loadCount.load(), 1);
+
+    manager.Shutdown();
+    jobSystem.Shutdown();
+
+    TestOutput::PrintTestPass("Load async");
+    return true;
+}
+
 int main() {
     TestOutput::PrintHeader("Resource Manager Unit Tests");
     Logger::GetInstance().Initialize();
@@ -632,6 +730,8 @@ int main() {
     allPassed &= suite.RunTest("Performance Optimizations", TestResourcePerformanceOptimizations);
     allPassed &= suite.RunTest("Asset Pipeline", TestResourceAssetPipeline);
     allPassed &= suite.RunTest("Thread Safety", TestResourceThreadSafety);
+    allPassed &= suite.RunTest("Concurrent Load Deduplication", TestConcurrentLoadDeduplication);
+    allPassed &= suite.RunTest("Load Async", TestLoadAsync);
 
     suite.PrintSummary();
     TestOutput::PrintFooter(allPassed);
@@ -0,0 +1,210 @@
+#include "TestUtils.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/VertexPacking.h"
+#include "Core/Logger.h"
+#include <cmath>
+#include <vector>
+
+using namespace GameEngine;
+using namespace GameEngine::Testing;
+
+namespace {
+    // A skinned, textured quad: normals, UVs, tangents, bone data, default colors
+    std::vector<Vertex> CreateSkinnedQuad() {
+        std::vector<Vertex> vertices(4);
+        const Math::Vec3 positions[4] = {{-1.0f, -1.0f, 0.0f}, {1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {-1.0f, 1.0f, 0.0f}};
+        const Math::Vec2 uvs[4] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+        for (int i = 0; i < 4; ++i) {
+            vertices[i].position = positions[i];
+            vertices[i].normal = Math::Vec3(0.0f, 0.0f, 1.0f);
+            vertices[i].texCoords = uvs[i];
+            vertices[i].tangent = Math::Vec3(1.0f, 0.0f, 0.0f);
+            vertices[i].boneIds = Math::Vec4(static_cast<float>(i), 3.0f, 0.0f, 0.0f);
+            vertices[i].boneWeights = Math::Vec4(0.75f, 0.25f, 0.0f, 0.0f);
+        }
+        return vertices;
+    }
+}
+
+/**
+ * Test half-float conversion and octahedral unit vector encoding accuracy
+ * Requirements: compact attribute encodings round-trip within their precision
+ */
+bool TestComponentEncodings() {
+    TestOutput::PrintTestStart("component encodings");
+
+    // Exactly representable values survive unchanged
+    const float exact[] = {0.0f, -0.0f, 1.0f, -2.0f, 0.5f, 0.25f, 65504.0f, 1.0f / 1024.0f};
+    for (float value : exact) {
+        EXPECT_EQUAL(VertexPacking::HalfToFloat(VertexPacking::FloatToHalf(value)), value);
+    }
+
+    // UVs keep about three decimal digits; out of range goes to infinity
+    for (float value = -4.0f; value <= 4.0f; value += 0.0137f) {
+        const float decoded = VertexPacking::HalfToFloat(VertexPacking::FloatToHalf(value));
+        EXPECT_NEARLY_EQUAL_EPSILON(decoded, value, std::abs(value) * 0.001f + 1e-6f);
+    }
+    EXPECT_TRUE(std::isinf(VertexPacking::HalfToFloat(VertexPacking::FloatToHalf(1.0e6f))));
+    // Halfway between two halves rounds to the even one
+    EXPECT_EQUAL(VertexPacking::FloatToHalf(1.0f + 1.0f / 2048.0f), static_cast<uint16_t>(0x3C00));
+    EXPECT_EQUAL(VertexPacking::FloatToHalf(1.0f + 3.0f / 2048.0f), static_cast<uint16_t>(0x3C02));
+
+    // Octahedral directions stay within a small angle, including the folded lower hemisphere
+    float maxError = 0.0f;
+    for (int i = 0; i < 2000; ++i) {
+        const float z = -1.0f + 2.0f * (i + 0.5f) / 2000.0f;
+        const float angle = i * 2.39996f;
+        const float radius = std::sqrt(1.0f - z * z);
+        const Math::Vec3 direction(radius * std::cos(angle), radius * std::sin(angle), z);
+
+        int16_t encoded[2];
+        VertexPacking::EncodeOctahedral(direction, encoded);
+        const Math::Vec3 decoded = VertexPacking::DecodeOctahedral(encoded);
+        maxError = std::max(maxError, glm::length(decoded - direction));
+    }
+    EXPECT_TRUE(maxError < 0.0002f);
+
+    int16_t down[2];
+    VertexPacking::EncodeOctahedral(Math::Vec3(0.0f, 0.0f, -1.0f), down);
+    EXPECT_NEAR_VEC3_EPSILON(VertexPacking::DecodeOctahedral(down), Math::Vec3(0.0f, 0.0f, -1.0f), 0.0001f);
+
+    TestOutput::PrintTestPass("component encodings");
+    return true;
+}
+
+/**
+ * Test that packed layouts only carry the attributes the data uses
+ * Requirements: per-mesh layouts, fallback to wider formats where data does not fit
+ */
+bool TestLayoutDetection() {
+    TestOutput::PrintTestStart("layout detection");
+
+    const auto vertices = CreateSkinnedQuad();
+    const VertexLayout layout = VertexPacking::CreateLayout(vertices.data(), vertices.size());
+
+    EXPECT_TRUE(layout.packed);
+    EXPECT_TRUE(layout.HasAttribute(VertexAttribute::Position));
+    EXPECT_TRUE(layout.HasAttribute(VertexAttribute::Normal));
+    EXPECT_TRUE(layout.HasAttribute(VertexAttribute::TexCoords));
+    EXPECT_TRUE(layout.HasAttribute(VertexAttribute::Tangent));
+    EXPECT_TRUE(layout.HasAttribute(VertexAttribute::BoneIds));
+    EXPECT_TRUE(layout.HasAttribute(VertexAttribute::BoneWeights));
+    EXPECT_FALSE(layout.HasAttribute(VertexAttribute::Bitangent));
+    EXPECT_FALSE(layout.HasAttribute(VertexAttribute::Color));
+    EXPECT_FALSE(layout.HasAttribute(VertexAttribute::TexCoords2));
+
+    // Position and normal/tangent float32, half UVs, byte bone indices and weights
+    EXPECT_EQUAL(layout.GetAttributeOffset(VertexAttribute::Position), 0u);
+    EXPECT_TRUE(layout.FindAttribute(VertexAttribute::TexCoords)->format == VertexFormat::Float16);
+    EXPECT_TRUE(layout.FindAttribute(VertexAttribute::BoneIds)->format == VertexFormat::UInt8);
+    EXPECT_TRUE(layout.FindAttribute(VertexAttribute::BoneWeights)->format == VertexFormat::Unorm8);
+    EXPECT_EQUAL(layout.stride, 12u + 12u + 4u + 12u + 4u + 4u);
+
+    VertexFormatOptions options;
+    options.octahedralNormals = true;
+    const VertexLayout octahedral = VertexPacking::CreateLayout(vertices.data(), vertices.size(), options);
+    EXPECT_TRUE(octahedral.FindAttribute(VertexAttribute::Normal)->format == VertexFormat::Octahedral16);
+    EXPECT_EQUAL(octahedral.stride, 12u + 4u + 4u + 4u + 4u + 4u);
+
+    // Bone indices past 255 and HDR colors keep float storage
+    auto wide = vertices;
+    wide[2].boneIds.x = 300.0f;
+    wide[1].color = Math::Vec4(2.0f, 1.0f, 1.0f, 1.0f);
+    const VertexLayout wideLayout = VertexPacking::CreateLayout(wide.data(), wide.size());
+    EXPECT_TRUE(wideLayout.FindAttribute(VertexAttribute::BoneIds)->format == VertexFormat::Float32);
+    EXPECT_TRUE(wideLayout.FindAttribute(VertexAttribute::BoneWeights)->format == VertexFormat::Float32);
+    EXPECT_TRUE(wideLayout.FindAttribute(VertexAttribute::Color)->format == VertexFormat::Float32);
+
+    TestOutput::PrintTestPass("layout detection");
+    return true;
+}
+
+/**
+ * Test packing a mesh and reading it back through the Mesh accessors
+ * Requirements: packed storage with accessors for tools and loaders; editing unpacks
+ */
+bool TestPackedMesh() {
+    TestOutput::PrintTestStart("packed mesh");
+
+    const auto vertices = CreateSkinnedQuad();
+    Mesh mesh;
+    mesh.SetVertices(vertices);
+    mesh.SetIndices(std::vector<uint32_t>{0, 1, 2, 0, 2, 3});
+    const BoundingBox bounds = mesh.GetBoundingBox();
+
+    mesh.PackVertices();
+    EXPECT_TRUE(mesh.IsPacked());
+    EXPECT_EQUAL(mesh.GetVertexCount(), 4u);
+    EXPECT_EQUAL(mesh.GetVertexDataSize(), 4u * mesh.GetVertexLayout().stride);
+    EXPECT_TRUE(mesh.GetVertexDataSize() * 2 < vertices.size() * sizeof(Vertex));
+    EXPECT_NEAR_VEC3_EPSILON(mesh.GetBoundingBox().min, bounds.min, 0.0001f);
+    EXPECT_NEAR_VEC3_EPSILON(mesh.GetBoundingBox().max, bounds.max, 0.0001f);
+    EXPECT_TRUE(mesh.Validate());
+
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        const Vertex vertex = mesh.GetVertex(i);
+        EXPECT_NEAR_VEC3_EPSILON(mesh.GetVertexPosition(i), vertices[i].position, 1e-6f);
+        EXPECT_NEAR_VEC3_EPSILON(vertex.normal, vertices[i].normal, 0.0001f);
+        EXPECT_NEARLY_EQUAL_EPSILON(vertex.texCoords.x, vertices[i].texCoords.x, 0.001f);
+        EXPECT_NEARLY_EQUAL_EPSILON(vertex.texCoords.y, vertices[i].texCoords.y, 0.001f);
+        EXPECT_EQUAL(vertex.boneIds.x, vertices[i].boneIds.x);
+        EXPECT_NEARLY_EQUAL_EPSILON(vertex.boneWeights.x, 0.75f, 1.0f / 255.0f);
+        EXPECT_TRUE(vertex.color == Math::Vec4(1.0f));
+    }
+
+    // Decoded copies are handed out without inflating the mesh
+    const size_t packedMemory = mesh.GetMemoryUsage();
+    EXPECT_TRUE(mesh.GetVertices().empty());
+    const std::vector<Vertex> decoded = mesh.DecodeVertices();
+    EXPECT_EQUAL(decoded.size(), vertices.size());
+    EXPECT_NEAR_VEC3_EPSILON(decoded[2].position, vertices[2].position, 1e-6f);
+    EXPECT_TRUE(mesh.IsPacked());
+    EXPECT_EQUAL(mesh.GetMemoryUsage(), packedMemory);
+    EXPECT_EQUAL(mesh.GetVertexCount(), 4u);
+
+    // Packed bytes can be handed to another mesh as-is
+    Mesh copy;
+    copy.SetPackedVertices(mesh.GetPackedVertexData().data(), mesh.GetVertexCount(), mesh.GetVertexLayout());
+    EXPECT_TRUE(copy.IsPacked());
+    EXPECT_TRUE(copy.GetPackedVertexData() == mesh.GetPackedVertexData());
+
+    // Editing operations switch back to full vertices
+    mesh.GenerateNormals();
+    EXPECT_FALSE(mesh.IsPacked());
+    EXPECT_EQUAL(mesh.GetVertexCount(), 4u);
+    EXPECT_EQUAL(mesh.GetVertexDataSize(), 4u * sizeof(Vertex));
+
+    TestOutput::PrintTestPass("packed mesh");
+    return true;
+}
+
+int main() {
+    TestOutput::PrintHeader("VertexPacking");
+
+    Logger::GetInstance().SetLogLevel(LogLevel::Warning);
+
+    bool allPassed = true;
+
+    try {
+        // Create test suite for result tracking
+        TestSuite suite("VertexPacking Tests");
+
+        // Run all tests
+        allPassed &= suite.RunTest("Component Encodings", TestComponentEncodings);
+        allPassed &= suite.RunTest("Layout Detection", TestLayoutDetection);
+        allPassed &= suite.RunTest("Packed Mesh", TestPackedMesh);
+
+        // Print detailed summary
+        suite.PrintSummary();
+
+        TestOutput::PrintFooter(allPassed);
+        return allPassed ? 0 : 1;
+
+    } catch (const std::exception& e) {
+        TestOutput::PrintError("TEST EXCEPTION: " + std::string(e.what()));
+        return 1;
+    } catch (...) {
+        TestOutput::PrintError("UNKNOWN TEST ERROR!");
+        return 1;
+    }
+}